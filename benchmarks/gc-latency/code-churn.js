@@ -0,0 +1,30 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Code-churn workload: repeatedly creates, runs and drops dynamically
+// compiled functions, so code space and the feedback metadata behind it
+// are allocated and collected at a steady rate. Code-space collection
+// cost does not show up in the plain object workloads.
+
+var CodeChurn = {
+  name: 'CodeChurn',
+
+  kIterations: 2000,
+  kFunctionsPerIteration: 20,
+
+  Setup: function() {
+    return { live: new Array(128), sum: 0 };
+  },
+
+  Run: function(state) {
+    for (var i = 0; i < this.kIterations; i++) {
+      for (var j = 0; j < this.kFunctionsPerIteration; j++) {
+        var f = new Function('x', 'return x + ' + ((i + j) % 97) + ';');
+        state.sum += f(j);
+        // A rotating window of functions stays live across collections.
+        state.live[(i * this.kFunctionsPerIteration + j) & 127] = f;
+      }
+    }
+  }
+};
@@ -0,0 +1,41 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A large stable object graph plus a high rate of short-lived allocation.
+// The stable graph forces full collections to trace a deep live set; the
+// churn drives scavenges at a controlled rate, so this workload exposes
+// both marking pauses and young-generation pause regressions.
+
+var GraphChurn = {
+  name: 'GraphChurn',
+
+  kStableNodes: 300000,
+  kIterations: 20000,
+  kChurnPerIteration: 50,
+
+  Setup: function() {
+    var nodes = new Array(this.kStableNodes);
+    for (var i = 0; i < this.kStableNodes; i++) {
+      nodes[i] = { payload: i, left: null, right: null };
+    }
+    // Link the nodes into a graph with long paths and cross edges.
+    for (var i = 1; i < this.kStableNodes; i++) {
+      nodes[i].left = nodes[(i * 7919) % i];
+      nodes[i].right = nodes[i - 1];
+    }
+    return { nodes: nodes, window: new Array(64), sum: 0 };
+  },
+
+  Run: function(state) {
+    for (var i = 0; i < this.kIterations; i++) {
+      for (var j = 0; j < this.kChurnPerIteration; j++) {
+        // Most of these die young; a rotating window survives a while.
+        var box = { value: j, list: [i, j, i + j] };
+        state.window[(i + j) & 63] = box;
+      }
+      // Touch the stable graph so it stays genuinely live.
+      state.sum += state.nodes[i % this.kStableNodes].payload;
+    }
+  }
+};
@@ -0,0 +1,48 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Harness for the GC latency workloads. Each workload runs with a
+// controlled allocation rate and live-set shape; every GC pause is
+// recorded through d8's performance.gcPauses() hook (backed by the
+// GCTracer statistics callback) and reported as percentile pauses and
+// mutator utilization, the metrics that matter for latency work in
+// src/heap. Throughput is deliberately not reported.
+
+load('graph-churn.js');
+load('strings.js');
+load('code-churn.js');
+
+function Percentile(sorted, p) {
+  if (sorted.length == 0) return 0;
+  var index = Math.min(sorted.length - 1, Math.round(p * (sorted.length - 1)));
+  return sorted[index];
+}
+
+function RunWorkload(workload) {
+  if (typeof performance == 'undefined' || !performance.gcPauses) {
+    print(workload.name + ': GC pause instrumentation not available');
+    return;
+  }
+  // Build the stable live set outside the measured region.
+  var state = workload.Setup();
+  performance.resetGCPauses();
+  var start = performance.now();
+  workload.Run(state);
+  var wall = performance.now() - start;
+  var pauses = performance.gcPauses();
+  var total = 0;
+  for (var i = 0; i < pauses.length; i++) total += pauses[i];
+  pauses.sort(function(a, b) { return a - b; });
+  var utilization = wall > 0 ? 100 * (1 - total / wall) : 100;
+  print(workload.name + '-gcs: ' + pauses.length);
+  print(workload.name + '-p50: ' + Percentile(pauses, 0.5).toFixed(2));
+  print(workload.name + '-p95: ' + Percentile(pauses, 0.95).toFixed(2));
+  print(workload.name + '-p999: ' + Percentile(pauses, 0.999).toFixed(2));
+  print(workload.name + '-max: ' + Percentile(pauses, 1).toFixed(2));
+  print(workload.name + '-utilization: ' + utilization.toFixed(2));
+}
+
+RunWorkload(GraphChurn);
+RunWorkload(Strings);
+RunWorkload(CodeChurn);
@@ -0,0 +1,37 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// String-heavy workload: builds ropes, flattens slices out of them, and
+// keeps a rotating window of medium-lived strings alive. This stresses
+// scavenging of sequential strings and cons-string chains, a live-set
+// shape the object-graph workloads do not cover.
+
+var Strings = {
+  name: 'Strings',
+
+  kIterations: 30000,
+  kWindowSize: 1024,
+
+  Setup: function() {
+    var seed = [];
+    for (var i = 0; i < 64; i++) {
+      seed.push('fragment-' + i + '-' + (i * 2654435761 % 997));
+    }
+    return { seed: seed, window: new Array(this.kWindowSize), length: 0 };
+  },
+
+  Run: function(state) {
+    for (var i = 0; i < this.kIterations; i++) {
+      var s = state.seed[i & 63];
+      // Build a rope of cons strings...
+      for (var j = 0; j < 8; j++) {
+        s += state.seed[(i + j) & 63];
+      }
+      // ... flatten part of it, and keep the slice alive for a while.
+      var flat = s.substring(7, 7 + 128);
+      state.window[i % this.kWindowSize] = flat;
+      state.length += flat.length;
+    }
+  }
+};
@@ -32,6 +32,17 @@ v8::Platform* CreateDefaultPlatform(int thread_pool_size = 0);
 bool PumpMessageLoop(v8::Platform* platform, v8::Isolate* isolate);
 
 
+/**
+ * Runs pending idle tasks for at most |idle_time_in_seconds| seconds.
+ *
+ * The caller has to make sure that this is called from the right thread.
+ * This call does not block if no task is pending. The |platform| has to be
+ * created using |CreateDefaultPlatform|.
+ */
+void RunIdleTasks(v8::Platform* platform, v8::Isolate* isolate,
+                  double idle_time_in_seconds);
+
+
 }  // namespace platform
 }  // namespace v8
 
@@ -601,13 +601,19 @@ class PersistentValueVector {
   }
 
   /**
-   * Remove all elements from the vector.
+   * Remove all elements from the vector. The underlying global handles
+   * are disposed in a single call into V8 rather than one Reset per
+   * element, which matters for large vectors.
    */
   void Clear() {
     size_t length = Traits::Size(&impl_);
-    for (size_t i = 0; i < length; i++) {
-      Global<V> p;
-      p.val_ = FromVal(Traits::Get(&impl_, i));
+    if (length > 0) {
+      std::vector<internal::Object**> handles(length);
+      for (size_t i = 0; i < length; i++) {
+        handles[i] = reinterpret_cast<internal::Object**>(
+            FromVal(Traits::Get(&impl_, i)));
+      }
+      V8::DisposeGlobalBatch(&handles[0], length);
     }
     Traits::Clear(&impl_);
   }
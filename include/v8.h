@@ -145,6 +145,7 @@ struct StreamedSource;
 template<typename T> class CustomArguments;
 class PropertyCallbackArguments;
 class FunctionCallbackArguments;
+class GCTracer;
 class GlobalHandles;
 }
 
@@ -596,6 +597,16 @@ template <class T> class PersistentBase {
    */
   V8_INLINE void MarkPartiallyDependent();
 
+  /**
+   * Allows the second pass callback registered with SetWeak for this handle
+   * to be invoked on a background thread. The first pass callback is always
+   * invoked on the thread that performed the garbage collection. Opt in only
+   * if the second pass callback does not call back into V8 in any way: it
+   * runs without holding the isolate's lock and may only release embedder
+   * memory. Several opted-in callbacks may be delivered in one batch.
+   */
+  V8_INLINE void MarkSecondPassCallbackOffThread();
+
   V8_INLINE bool IsIndependent() const;
 
   /** Checks if the handle holds the only reference to an object. */
@@ -1066,6 +1077,16 @@ class V8_EXPORT UnboundScript {
    */
   int GetLineNumber(int code_pos);
 
+  /**
+   * Drops the on-heap source string of the script. It will be re-attached
+   * lazily from the isolate's external source store when it is needed
+   * again, e.g. for lazy compilation, an error message or
+   * Function.prototype.toString. Returns false if no external source store
+   * callback is registered on the isolate or the script has no on-heap
+   * source to drop.
+   */
+  bool DropSource();
+
   static const int kNoScriptId = 0;
 };
 
@@ -1321,6 +1342,11 @@ class V8_EXPORT ScriptCompiler {
    *
    * This API allows to start the streaming with as little data as possible, and
    * the remaining data (for example, the ScriptOrigin) is passed to Compile.
+   *
+   * Tasks for different scripts are independent and can run concurrently on
+   * separate background threads, also for the same isolate; each carries its
+   * own parser state. Only the Compile call that finalizes a script needs the
+   * main thread.
    */
   static ScriptStreamingTask* StartStreamingScript(
       Isolate* isolate, StreamedSource* source,
@@ -1638,6 +1664,43 @@ class V8_EXPORT JSON {
                            Local<Value> Parse(Local<String> json_string));
   static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(
       Isolate* isolate, Local<String> json_string);
+
+  /**
+   * An interface for receiving a JSON serialization as a stream of chunks.
+   */
+  class V8_EXPORT OutputStream {  // NOLINT
+   public:
+    enum WriteResult {
+      kContinue = 0,
+      kAbort = 1
+    };
+    virtual ~OutputStream() {}
+    /** Notify about the end of stream. */
+    virtual void EndOfStream() = 0;
+    /**
+     * Writes the next chunk of the UTF-8 encoded serialization into the
+     * stream. Writing can be stopped by returning kAbort as function result.
+     * EndOfStream will not be called in case writing was aborted.
+     */
+    virtual WriteResult WriteUtf8Chunk(const char* data, int size) = 0;
+  };
+
+  /**
+   * Serializes |json_value| as by JSON.stringify and streams the result
+   * into |stream| in chunks as it is produced, instead of materializing the
+   * complete result string on the V8 heap. Chunk boundaries fall at
+   * arbitrary character positions; a surrogate pair split across a boundary
+   * is encoded as two separate three-byte sequences.
+   *
+   * \param json_value The value to serialize.
+   * \param stream The stream receiving the serialization.
+   * \return Just(true) if serialization completed (nothing is written for
+   *   values that JSON.stringify maps to undefined), Just(false) if the
+   *   stream aborted the write, and nothing if an exception was thrown.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> Stringify(Isolate* isolate,
+                                                     Local<Value> json_value,
+                                                     OutputStream* stream);
 };
 
 
@@ -2115,7 +2178,13 @@ class V8_EXPORT String : public Name {
     // Used by WriteUtf8 to replace orphan surrogate code units with the
     // unicode replacement character. Needs to be set to guarantee valid UTF-8
     // output.
-    REPLACE_INVALID_UTF8 = 8
+    REPLACE_INVALID_UTF8 = 8,
+    // Used by WriteUtf8 to indicate that the buffer capacity was computed
+    // with Utf8Length() and the whole string fits, so the internal length
+    // recomputation and per-character capacity checks are skipped. The
+    // caller must guarantee that the string's UTF-8 encoding fits into the
+    // buffer; otherwise the buffer is overrun.
+    PRECOMPUTED_UTF8_LENGTH = 16
   };
 
   // 16-bit character codes.
@@ -2134,6 +2203,33 @@ class V8_EXPORT String : public Name {
                 int* nchars_ref = NULL,
                 int options = NO_OPTIONS) const;
 
+  /**
+   * A contiguous chunk of a caller-provided output buffer, in the style of
+   * struct iovec. Used by WriteUtf8Segments.
+   */
+  struct Utf8Segment {
+    char* data;
+    int capacity;
+  };
+
+  /**
+   * UTF-8 encodes the string into the given segments in order, moving on to
+   * the next segment when the next character no longer fits into the
+   * current one. Characters are never split across a segment boundary, so
+   * every segment remains individually valid UTF-8 and the segments can be
+   * handed to a scatter-gather socket write without recopying. Only
+   * null-terminates if the whole string was written and there is space left
+   * in the last segment used. nchars_ref and options behave as for
+   * WriteUtf8; the string is always flattened first.
+   *
+   * \return The total number of bytes written across all segments,
+   *    including the null terminator (if written).
+   */
+  int WriteUtf8Segments(Utf8Segment* segments,
+                        int segment_count,
+                        int* nchars_ref = NULL,
+                        int options = NO_OPTIONS) const;
+
   /**
    * A zero length string.
    */
@@ -2341,6 +2437,17 @@ class V8_EXPORT String : public Name {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewExternalOneByte(
       Isolate* isolate, ExternalOneByteStringResource* resource);
 
+  /**
+   * Creates a new external one-byte string that adopts the given buffer,
+   * which must have been allocated with malloc. No copy of the characters
+   * is made; the string takes ownership of the buffer and frees it with
+   * free() when the string dies. If an empty value is returned (only when
+   * length > kMaxLength) the buffer has not been adopted and remains owned
+   * by the caller.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewExternalOneByte(
+      Isolate* isolate, char* data, size_t length);
+
   /**
    * Associate an external string resource with this string by transforming it
    * in place so that existing references to this string in the JavaScript heap
@@ -3080,6 +3187,13 @@ class PropertyCallbackInfo {
 
 typedef void (*FunctionCallback)(const FunctionCallbackInfo<Value>& info);
 
+/**
+ * Declared fast-path variant of FunctionCallback; receives the arguments
+ * unwrapped as doubles and returns the result as a double.  See
+ * FunctionTemplate::SetFastPrimitiveHandler.
+ */
+typedef double (*PrimitiveFunctionCallback)(const double* args, int length);
+
 
 /**
  * A JavaScript function object (ECMA-262, 15.3).
@@ -3431,6 +3545,38 @@ class V8_EXPORT ArrayBufferView : public Object {
    */
   bool HasBuffer() const;
 
+  /**
+   * The raw contents of a pinned ArrayBufferView; see PinContents.
+   */
+  class Contents {  // NOLINT
+   public:
+    Contents() : data_(NULL), byte_length_(0) {}
+
+    void* Data() const { return data_; }
+    size_t ByteLength() const { return byte_length_; }
+
+   private:
+    void* data_;
+    size_t byte_length_;
+
+    friend class ArrayBufferView;
+  };
+
+  /**
+   * Pins the view's backing store and returns a raw pointer to the bytes
+   * the view covers. The backing ArrayBuffer is materialized off the V8
+   * heap if necessary and marked non-neuterable, so the pointer stays
+   * valid, without re-entering V8, until UnpinContents is called. Pinning
+   * does not keep the buffer alive: the embedder must hold a handle to the
+   * view or its buffer for as long as the pointer is in use.
+   */
+  Contents PinContents();
+
+  /**
+   * Makes the backing store neuterable again after PinContents.
+   */
+  void UnpinContents();
+
   V8_INLINE static ArrayBufferView* Cast(Value* obj);
 
   static const int kInternalFieldCount =
@@ -4152,6 +4298,17 @@ class V8_EXPORT FunctionTemplate : public Template {
   void SetCallHandler(FunctionCallback callback,
                       Handle<Value> data = Handle<Value>());
 
+  /**
+   * Declare a fast-path handler in addition to the regular call-handler
+   * callback.  When every argument of a call is a number, V8 may invoke the
+   * fast handler with the unwrapped values instead of the regular callback,
+   * skipping the callback-info setup; otherwise it falls back to the regular
+   * callback.  The two handlers must therefore be behaviorally equivalent
+   * for all-number arguments.  The fast handler must not call back into V8.
+   * SetCallHandler must have been called first.
+   */
+  void SetFastPrimitiveHandler(PrimitiveFunctionCallback fast_handler);
+
   /** Set the predefined length property for the FunctionTemplate. */
   void SetLength(int length);
 
@@ -4762,6 +4919,20 @@ typedef void (*FailedAccessCheckCallback)(Local<Object> target,
  */
 typedef bool (*AllowCodeGenerationFromStringsCallback)(Local<Context> context);
 
+// --- External source store callback ---
+
+/**
+ * Callback to re-attach the source of a script whose on-heap source string
+ * was dropped with UnboundScript::DropSource. The embedder returns a
+ * resource holding the source of the script identified by |script_id| (the
+ * value UnboundScript::GetId returned at compile time), or NULL if the
+ * store cannot provide it. V8 takes ownership of the returned resource.
+ * Backing the resources by a file mapping keeps the sources out of both
+ * the JavaScript heap and, until actually touched, physical memory.
+ */
+typedef String::ExternalOneByteStringResource* (*ExternalSourceStoreCallback)(
+    Isolate* isolate, int script_id);
+
 // --- Garbage Collection Callbacks ---
 
 /**
@@ -4857,6 +5028,136 @@ class V8_EXPORT HeapObjectStatistics {
 };
 
 
+/**
+ * Structured statistics about a single completed garbage collection.
+ *
+ * Instances of this class are passed to the callback installed with
+ * Isolate::SetGCStatisticsCallback, so that embedders can feed GC metrics
+ * into their monitoring without parsing --trace-gc output.
+ */
+class V8_EXPORT GCStatistics {
+ public:
+  GCStatistics();
+  /** The type of the collection. */
+  GCType type() const { return type_; }
+  /** Total stop-the-world pause of the collection in milliseconds. */
+  double pause_time_in_ms() const { return pause_time_in_ms_; }
+  /** Time spent in embedder callbacks during the pause. */
+  double external_time_in_ms() const { return external_time_in_ms_; }
+  /** Time spent marking inside the pause; zero for scavenges. */
+  double marking_time_in_ms() const { return marking_time_in_ms_; }
+  /** Time spent sweeping inside the pause; zero for scavenges. */
+  double sweeping_time_in_ms() const { return sweeping_time_in_ms_; }
+  /** Time spent evacuating pages and updating pointers. */
+  double evacuation_time_in_ms() const { return evacuation_time_in_ms_; }
+  /** Time spent processing and clearing weak references. */
+  double weak_processing_time_in_ms() const { return weak_processing_time_in_ms_; }
+  /** Bytes promoted to the old generation by this collection. */
+  size_t promoted_size() const { return promoted_size_; }
+  /** Bytes that survived within the young generation. */
+  size_t semi_space_copied_size() const { return semi_space_copied_size_; }
+  /** Recent incremental marking throughput in bytes per millisecond. */
+  size_t incremental_marking_speed() const { return incremental_marking_speed_; }
+
+ private:
+  GCType type_;
+  double pause_time_in_ms_;
+  double external_time_in_ms_;
+  double marking_time_in_ms_;
+  double sweeping_time_in_ms_;
+  double evacuation_time_in_ms_;
+  double weak_processing_time_in_ms_;
+  size_t promoted_size_;
+  size_t semi_space_copied_size_;
+  size_t incremental_marking_speed_;
+
+  friend class internal::GCTracer;
+};
+
+
+/**
+ * A policy controlling how aggressively the garbage collector flushes the
+ * compiled code of functions that have not been executed for a while. The
+ * default-constructed policy imposes no constraints beyond the collector's
+ * regular code aging heuristic. See Isolate::SetCodeRetentionPolicy.
+ */
+class V8_EXPORT CodeRetentionPolicy {
+ public:
+  CodeRetentionPolicy()
+      : minimum_code_age_in_ms_(0),
+        hot_function_tick_threshold_(0),
+        code_flush_budget_per_gc_(0) {}
+
+  /**
+   * Code is only flushed once the function has not been executed for at
+   * least this many milliseconds, approximated from the timestamps of the
+   * full garbage collections the code has survived. Zero means the
+   * generation-based aging heuristic alone decides.
+   */
+  int minimum_code_age_in_ms() const { return minimum_code_age_in_ms_; }
+  void set_minimum_code_age_in_ms(int value) {
+    minimum_code_age_in_ms_ = value;
+  }
+
+  /**
+   * Functions that have accumulated at least this many runtime profiler
+   * ticks are never flushed, so that hot but periodically idle functions
+   * avoid the recompilation cost. Zero disables the exemption.
+   */
+  int hot_function_tick_threshold() const {
+    return hot_function_tick_threshold_;
+  }
+  void set_hot_function_tick_threshold(int value) {
+    hot_function_tick_threshold_ = value;
+  }
+
+  /**
+   * At most this many bytes of compiled code are flushed per full garbage
+   * collection, bounding the lazy recompilation work a single collection
+   * can cause. Zero means unlimited.
+   */
+  size_t code_flush_budget_per_gc() const { return code_flush_budget_per_gc_; }
+  void set_code_flush_budget_per_gc(size_t value) {
+    code_flush_budget_per_gc_ = value;
+  }
+
+ private:
+  int minimum_code_age_in_ms_;
+  int hot_function_tick_threshold_;
+  size_t code_flush_budget_per_gc_;
+};
+
+
+/**
+ * Cumulative statistics about code flushing, filled in by
+ * Isolate::GetCodeFlushingStatistics. Embedders can use these counters to
+ * tune a CodeRetentionPolicy by comparing the memory reclaimed through
+ * flushing against the lazy recompilation work it caused.
+ */
+class V8_EXPORT CodeFlushingStatistics {
+ public:
+  CodeFlushingStatistics();
+  /** Number of functions whose compiled code was flushed. */
+  size_t flushed_function_count() const { return flushed_function_count_; }
+  /** Total size in bytes of the flushed code objects. */
+  size_t flushed_code_size() const { return flushed_code_size_; }
+  /** Number of previously flushed functions that were recompiled. */
+  size_t recompiled_function_count() const {
+    return recompiled_function_count_;
+  }
+  /** Total size in bytes of the code recompiled after flushing. */
+  size_t recompiled_code_size() const { return recompiled_code_size_; }
+
+ private:
+  size_t flushed_function_count_;
+  size_t flushed_code_size_;
+  size_t recompiled_function_count_;
+  size_t recompiled_code_size_;
+
+  friend class Isolate;
+};
+
+
 class RetainedObjectInfo;
 
 
@@ -5406,6 +5707,31 @@ class V8_EXPORT Isolate {
    */
   void RemoveGCEpilogueCallback(GCEpilogueCallback callback);
 
+  typedef void (*GCStatisticsCallback)(Isolate* isolate,
+                                       const GCStatistics& statistics);
+
+  /**
+   * Enables the host application to receive structured statistics after
+   * each garbage collection. Allocations are allowed in the callback
+   * function, but the callback is not re-entrant: if an allocation inside
+   * it triggers a garbage collection, the callback won't be called again.
+   * Passing NULL removes a previously installed callback.
+   */
+  void SetGCStatisticsCallback(GCStatisticsCallback callback);
+
+  /**
+   * Sets the policy controlling how aggressively compiled code is flushed
+   * for functions that have not been executed recently. The policy takes
+   * effect at the next full garbage collection.
+   */
+  void SetCodeRetentionPolicy(const CodeRetentionPolicy& policy);
+
+  /**
+   * Fills the given structure with cumulative statistics about code
+   * flushing and the lazy recompilation it caused in this isolate.
+   */
+  void GetCodeFlushingStatistics(CodeFlushingStatistics* statistics);
+
 
   /**
    * Forcefully terminate the current thread of JavaScript execution
@@ -5560,6 +5886,12 @@ class V8_EXPORT Isolate {
   /**
    * Optional notification that the system is running low on memory.
    * V8 uses these notifications to attempt to free memory.
+   *
+   * This is also the supported way to recycle an isolate in a pool across
+   * sandboxed workloads: dispose of all contexts and handles the workload
+   * used, then call this to clear the compilation cache and compact the
+   * heap, returning the isolate close to its post-snapshot footprint while
+   * keeping its warmed-up builtins and stubs.
    */
   void LowMemoryNotification();
 
@@ -5635,6 +5967,12 @@ class V8_EXPORT Isolate {
   void SetAllowCodeGenerationFromStringsCallback(
       AllowCodeGenerationFromStringsCallback callback);
 
+  /**
+   * Set the callback that re-attaches dropped script sources from an
+   * embedder-managed store. See UnboundScript::DropSource.
+   */
+  void SetExternalSourceStoreCallback(ExternalSourceStoreCallback callback);
+
   /**
   * Check if V8 is dead and therefore unusable.  This is the case after
   * fatal errors such as out-of-memory situations.
@@ -5669,6 +6007,15 @@ class V8_EXPORT Isolate {
       bool capture, int frame_limit = 10,
       StackTrace::StackTraceOptions options = StackTrace::kOverview);
 
+  /**
+   * Sets a hard cap on the number of frames captured when an Error object
+   * is constructed, applied on top of the script-visible
+   * Error.stackTraceLimit. This bounds the cost of stack capture in
+   * applications that throw frequently from deep stacks. A negative value
+   * (the default) means no cap.
+   */
+  void SetStackTraceFrameCap(int frame_cap);
+
   /**
    * Enables the host application to provide a mechanism to be notified
    * and perform custom logging when V8 Allocates Executable Memory.
@@ -5718,6 +6065,55 @@ class V8_EXPORT Isolate {
   void SetReferenceFromGroup(UniqueId id, internal::Object** object);
   void SetReference(internal::Object** parent, internal::Object** child);
   void CollectAllGarbage(const char* gc_reason);
+  void ReportExternalAllocationLimitReached();
+};
+
+
+/**
+ * A balance of externally allocated memory kept alive by JavaScript objects.
+ * Embedders that manage many external allocations with a common lifetime,
+ * for example the buffers belonging to a single document or connection, can
+ * attribute them to a pool and retire the whole balance with a single call
+ * (or simply by deleting the pool) instead of reversing every adjustment
+ * individually.
+ */
+class V8_EXPORT ExternalMemoryPool {
+ public:
+  /**
+   * Creates a new, empty pool. The pool must only be used from the thread
+   * that has entered the isolate and must be deleted before the isolate is
+   * disposed.
+   */
+  static ExternalMemoryPool* New(Isolate* isolate);
+
+  /** Releases any remaining balance of the pool. */
+  ~ExternalMemoryPool();
+
+  /**
+   * Adjusts the external memory attributed to this pool, forwarding the
+   * change to Isolate::AdjustAmountOfExternalAllocatedMemory. Negative
+   * adjustments are clamped so the balance of the pool never goes below
+   * zero.
+   * \returns the balance of the pool after the adjustment.
+   */
+  int64_t Adjust(int64_t change_in_bytes);
+
+  /** Releases the entire balance of the pool. */
+  void ReleaseAll();
+
+  /** Returns the external memory currently attributed to this pool. */
+  int64_t Amount() const { return amount_; }
+
+ private:
+  explicit ExternalMemoryPool(Isolate* isolate)
+      : isolate_(isolate), amount_(0) {}
+
+  Isolate* isolate_;
+  int64_t amount_;
+
+  // Disallow copying and assigning.
+  ExternalMemoryPool(const ExternalMemoryPool&);
+  void operator=(const ExternalMemoryPool&);
 };
 
 class V8_EXPORT StartupData {
@@ -5798,6 +6194,10 @@ class V8_EXPORT V8 {
    *   given data blob, so pretty please keep it around until V8 exit.
    * - Compression of the startup blob might be useful, but needs to
    *   handled entirely on the embedders' side.
+   * - The snapshot blob is consumed strictly front to back during isolate
+   *   and context creation, so embedders that stream or decompress it from
+   *   slow media can overlap that work with deserialization by filling the
+   *   blob ahead of the reader.
    * - The call will abort if the data is invalid.
    */
   static void SetNativesDataBlob(StartupData* startup_blob);
@@ -5810,6 +6210,18 @@ class V8_EXPORT V8 {
    */
   static StartupData CreateSnapshotDataBlob(const char* custom_source = NULL);
 
+  /**
+   * Bootstrap an isolate and a context from the given existing snapshot
+   * blob, run the given warm-up script in a throw-away context, and
+   * serialize a new snapshot blob in which the code compiled while warming
+   * up is retained. Isolates created from the result start with that code
+   * already compiled.
+   * Returns { NULL, 0 } on failure.
+   * The caller owns the data array in the return value.
+   */
+  static StartupData WarmUpSnapshotDataBlob(StartupData cold_snapshot_blob,
+                                            const char* warmup_source);
+
   /**
    * Adds a message listener.
    *
@@ -6064,6 +6476,8 @@ class V8_EXPORT V8 {
                                                internal::Object** handle);
   static internal::Object** CopyPersistent(internal::Object** handle);
   static void DisposeGlobal(internal::Object** global_handle);
+  static void DisposeGlobalBatch(internal::Object*** global_handles,
+                                 size_t count);
   typedef WeakCallbackData<Value, void>::Callback WeakCallback;
   static void MakeWeak(internal::Object** global_handle, void* data,
                        WeakCallback weak_callback);
@@ -6077,6 +6491,8 @@ class V8_EXPORT V8 {
                        int internal_field_index2,
                        WeakCallbackInfo<void>::Callback weak_callback);
   static void* ClearWeak(internal::Object** global_handle);
+  static void MarkSecondPassCallbackOffThread(
+      internal::Object** global_handle);
   static void Eternalize(Isolate* isolate,
                          Value* handle,
                          int* index);
@@ -6095,6 +6511,7 @@ class V8_EXPORT V8 {
   template <class T> friend class Eternal;
   template <class T> friend class PersistentBase;
   template <class T, class M> friend class Persistent;
+  template<class F1, class F2> friend class PersistentValueVector;
   friend class Context;
 };
 
@@ -7090,6 +7507,14 @@ void PersistentBase<T>::MarkPartiallyDependent() {
 }
 
 
+template <class T>
+void PersistentBase<T>::MarkSecondPassCallbackOffThread() {
+  if (this->IsEmpty()) return;
+  V8::MarkSecondPassCallbackOffThread(
+      reinterpret_cast<internal::Object**>(this->val_));
+}
+
+
 template <class T>
 void PersistentBase<T>::SetWrapperClassId(uint16_t class_id) {
   typedef internal::Internals I;
@@ -7903,12 +8328,15 @@ int64_t Isolate::AdjustAmountOfExternalAllocatedMemory(
           reinterpret_cast<uint8_t*>(this) +
           I::kAmountOfExternalAllocatedMemoryAtLastGlobalGCOffset);
   int64_t amount = *amount_of_external_allocated_memory + change_in_bytes;
+  *amount_of_external_allocated_memory = amount;
   if (change_in_bytes > 0 &&
       amount - *amount_of_external_allocated_memory_at_last_global_gc >
           I::kExternalAllocationLimit) {
-    CollectAllGarbage("external memory allocation limit reached.");
+    // The heap decides based on the external allocation rate whether
+    // collecting now is worthwhile, so crossing the limit repeatedly under
+    // steady allocation does not cause back-to-back full collections.
+    ReportExternalAllocationLimitReached();
   }
-  *amount_of_external_allocated_memory = amount;
   return *amount_of_external_allocated_memory;
 }
 
@@ -412,11 +412,19 @@ void Accessors::ScriptSourceGetter(
     v8::Local<v8::Name> name,
     const v8::PropertyCallbackInfo<v8::Value>& info) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(info.GetIsolate());
-  DisallowHeapAllocation no_allocation;
   HandleScope scope(isolate);
-  Object* object = *Utils::OpenHandle(*info.This());
-  Object* source = Script::cast(JSValue::cast(object)->value())->source();
-  info.GetReturnValue().Set(Utils::ToLocal(Handle<Object>(source, isolate)));
+  Handle<Object> object = Utils::OpenHandle(*info.This());
+  Handle<Script> script(Script::cast(JSValue::cast(*object)->value()),
+                        isolate);
+  Handle<String> string_source;
+  Handle<Object> source;
+  if (Script::EnsureSource(script).ToHandle(&string_source)) {
+    source = string_source;
+  } else {
+    if (isolate->has_pending_exception()) isolate->clear_pending_exception();
+    source = isolate->factory()->undefined_value();
+  }
+  info.GetReturnValue().Set(Utils::ToLocal(source));
 }
 
 
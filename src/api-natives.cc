@@ -150,6 +150,26 @@ class AccessCheckDisableScope {
 };
 
 
+// Above this many properties an object gives up on fast mode while its
+// template's properties are installed anyway (see
+// Map::TooManyFastProperties).
+const int kMaxFastTemplateInstantiationProperties = 128;
+
+
+// Returns the number of properties the template would install.
+int TemplatePropertyCount(Isolate* isolate, Handle<TemplateInfo> data) {
+  auto property_list = handle(data->property_list(), isolate);
+  if (property_list->IsUndefined()) return 0;
+  NeanderArray properties(property_list);
+  int count = 0;
+  for (int i = 0; i < properties.length();) {
+    i += Smi::cast(properties.get(i))->value() + 1;
+    count++;
+  }
+  return count;
+}
+
+
 MaybeHandle<JSObject> ConfigureInstance(Isolate* isolate, Handle<JSObject> obj,
                                         Handle<TemplateInfo> data) {
   auto property_list = handle(data->property_list(), isolate);
@@ -203,6 +223,16 @@ MaybeHandle<JSObject> InstantiateObject(Isolate* isolate,
         isolate, cons, InstantiateFunction(isolate, cons_templ), JSFunction);
   }
   auto object = isolate->factory()->NewJSObject(cons);
+  // Templates with many properties would otherwise be instantiated through
+  // a long chain of map transitions with ever larger copied descriptor
+  // arrays. Go to dictionary mode with the right capacity up front; the
+  // migration below then builds the final shape in a single step.
+  int property_count = TemplatePropertyCount(isolate, info);
+  if (property_count > kMaxFastTemplateInstantiationProperties) {
+    JSObject::NormalizeProperties(object, CLEAR_INOBJECT_PROPERTIES,
+                                  property_count,
+                                  "ApiNatives::InstantiateObject");
+  }
   ASSIGN_RETURN_ON_EXCEPTION(
       isolate, result, ConfigureInstance(isolate, object, info), JSFunction);
   // TODO(dcarney): is this necessary?
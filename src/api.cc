@@ -33,8 +33,12 @@
 #include "src/heap/spaces.h"
 #include "src/heap-profiler.h"
 #include "src/heap-snapshot-generator-inl.h"
+#ifdef V8_I18N_SUPPORT
+#include "src/i18n.h"
+#endif
 #include "src/icu_util.h"
 #include "src/json-parser.h"
+#include "src/json-stringifier.h"
 #include "src/messages.h"
 #include "src/parser.h"
 #include "src/pending-compilation-error-handler.h"
@@ -396,6 +400,78 @@ StartupData V8::CreateSnapshotDataBlob(const char* custom_source) {
 }
 
 
+StartupData V8::WarmUpSnapshotDataBlob(StartupData cold_snapshot_blob,
+                                       const char* warmup_source) {
+  CHECK(cold_snapshot_blob.raw_size > 0 && cold_snapshot_blob.data != NULL);
+  CHECK(warmup_source != NULL);
+  i::Isolate* internal_isolate = new i::Isolate(true);
+  ArrayBufferAllocator allocator;
+  internal_isolate->set_array_buffer_allocator(&allocator);
+  internal_isolate->set_snapshot_blob(&cold_snapshot_blob);
+  Isolate* isolate = reinterpret_cast<Isolate*>(internal_isolate);
+  StartupData result = {NULL, 0};
+  {
+    base::ElapsedTimer timer;
+    timer.Start();
+    Isolate::Scope isolate_scope(isolate);
+    if (i::Snapshot::Initialize(internal_isolate)) {
+      i::Snapshot::Metadata metadata;
+      metadata.set_embeds_script(i::Snapshot::EmbedsScript(internal_isolate));
+      bool warmed_up;
+      {
+        // Run the warm-up script in a throw-away context. Code compiled
+        // while it runs stays in the compilation cache, which is part of
+        // the startup snapshot, while the context it ran in is discarded
+        // so that its side effects do not end up in the blob.
+        HandleScope handle_scope(isolate);
+        Handle<Context> warmup_context = Context::New(isolate);
+        Context::Scope context_scope(warmup_context);
+        warmed_up = RunExtraCode(isolate, warmup_source);
+      }
+      Persistent<Context> context;
+      if (warmed_up) {
+        HandleScope handle_scope(isolate);
+        Handle<Context> new_context = Context::New(isolate);
+        context.Reset(isolate, new_context);
+      }
+      if (!context.IsEmpty()) {
+        // Make sure all builtin scripts are cached.
+        {
+          HandleScope scope(isolate);
+          for (int i = 0; i < i::Natives::GetBuiltinsCount(); i++) {
+            internal_isolate->bootstrapper()->SourceLookup<i::Natives>(i);
+          }
+        }
+        // If we don't do this then we end up with a stray root pointing at
+        // the context even after we have disposed of the context.
+        internal_isolate->heap()->CollectAllAvailableGarbage("mksnapshot");
+        i::Object* raw_context = *v8::Utils::OpenPersistent(context);
+        context.Reset();
+
+        i::SnapshotByteSink snapshot_sink;
+        i::StartupSerializer ser(internal_isolate, &snapshot_sink);
+        ser.SerializeStrongReferences();
+
+        i::SnapshotByteSink context_sink;
+        i::PartialSerializer context_ser(internal_isolate, &ser,
+                                         &context_sink);
+        context_ser.Serialize(&raw_context);
+        ser.SerializeWeakReferencesAndDeferred();
+
+        result = i::Snapshot::CreateSnapshotBlob(ser, context_ser, metadata);
+      }
+    }
+    if (i::FLAG_profile_deserialization) {
+      i::PrintF("Warming up snapshot took %0.3f ms\n",
+                timer.Elapsed().InMillisecondsF());
+    }
+    timer.Stop();
+  }
+  isolate->Dispose();
+  return result;
+}
+
+
 void V8::SetFlagsFromString(const char* str, int length) {
   i::FlagList::SetFlagsFromString(str, length);
 }
@@ -587,11 +663,21 @@ void* V8::ClearWeak(i::Object** obj) {
 }
 
 
+void V8::MarkSecondPassCallbackOffThread(i::Object** obj) {
+  i::GlobalHandles::MarkSecondPassCallbackOffThread(obj);
+}
+
+
 void V8::DisposeGlobal(i::Object** obj) {
   i::GlobalHandles::Destroy(obj);
 }
 
 
+void V8::DisposeGlobalBatch(i::Object*** objs, size_t count) {
+  i::GlobalHandles::DestroyBatch(objs, count);
+}
+
+
 void V8::Eternalize(Isolate* v8_isolate, Value* value, int* index) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
   i::Object* object = *Utils::OpenHandle(value);
@@ -1084,6 +1170,22 @@ void FunctionTemplate::SetCallHandler(FunctionCallback callback,
 }
 
 
+void FunctionTemplate::SetFastPrimitiveHandler(
+    PrimitiveFunctionCallback fast_handler) {
+  auto info = Utils::OpenHandle(this);
+  EnsureNotInstantiated(info, "v8::FunctionTemplate::SetFastPrimitiveHandler");
+  i::Isolate* isolate = info->GetIsolate();
+  ENTER_V8(isolate);
+  i::HandleScope scope(isolate);
+  Utils::ApiCheck(!info->call_code()->IsUndefined(),
+                  "v8::FunctionTemplate::SetFastPrimitiveHandler",
+                  "SetCallHandler must be called first");
+  i::Handle<i::CallHandlerInfo> obj(
+      i::CallHandlerInfo::cast(info->call_code()), isolate);
+  SET_FIELD_WRAPPED(obj, set_fast_handler, fast_handler);
+}
+
+
 static i::Handle<i::AccessorInfo> SetAccessorInfoProperties(
     i::Handle<i::AccessorInfo> obj,
     v8::Handle<Name> name,
@@ -1592,6 +1694,23 @@ int UnboundScript::GetId() {
 }
 
 
+bool UnboundScript::DropSource() {
+  i::Handle<i::HeapObject> obj =
+      i::Handle<i::HeapObject>::cast(Utils::OpenHandle(this));
+  i::Isolate* isolate = obj->GetIsolate();
+  LOG_API(isolate, "v8::UnboundScript::DropSource");
+  if (isolate->external_source_store_callback() == NULL) return false;
+  i::HandleScope scope(isolate);
+  i::Handle<i::SharedFunctionInfo> function_info(
+      i::SharedFunctionInfo::cast(*obj));
+  if (!function_info->script()->IsScript()) return false;
+  i::Handle<i::Script> script(i::Script::cast(function_info->script()));
+  if (!script->source()->IsString()) return false;
+  i::Script::DropSource(script);
+  return true;
+}
+
+
 int UnboundScript::GetLineNumber(int code_pos) {
   i::Handle<i::SharedFunctionInfo> obj =
       i::Handle<i::SharedFunctionInfo>::cast(Utils::OpenHandle(this));
@@ -2623,6 +2742,50 @@ Local<Value> JSON::Parse(Local<String> json_string) {
 }
 
 
+namespace {
+
+// Adapts an embedder-provided JSON::OutputStream to the string builder's
+// part sink, re-encoding each completed part as UTF-8.
+class JsonOutputStreamAdapter : public i::IncrementalStringBuilder::PartSink {
+ public:
+  explicit JsonOutputStreamAdapter(JSON::OutputStream* stream)
+      : stream_(stream) {}
+  virtual bool WritePart(i::Handle<i::String> part) {
+    Local<String> part_local = Utils::ToLocal(part);
+    int length = part_local->Utf8Length();
+    if (length == 0) return true;
+    i::ScopedVector<char> chunk(length);
+    part_local->WriteUtf8(chunk.start(), length, NULL,
+                          String::NO_NULL_TERMINATION);
+    return stream_->WriteUtf8Chunk(chunk.start(), length) ==
+           JSON::OutputStream::kContinue;
+  }
+
+ private:
+  JSON::OutputStream* stream_;
+};
+
+}  // namespace
+
+
+Maybe<bool> JSON::Stringify(Isolate* v8_isolate, Local<Value> json_value,
+                            OutputStream* stream) {
+  auto isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  PREPARE_FOR_EXECUTION_GENERIC(isolate, Local<Context>(), "JSON::Stringify",
+                                Nothing<bool>(), i::HandleScope, false);
+  i::Handle<i::Object> object = Utils::OpenHandle(*json_value);
+  JsonOutputStreamAdapter sink(stream);
+  i::BasicJsonStringifier stringifier(isolate);
+  i::Handle<i::Object> result;
+  has_pending_exception =
+      !stringifier.StringifyToSink(object, &sink).ToHandle(&result);
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  if (result->IsFalse()) return Just(false);
+  stream->EndOfStream();
+  return Just(true);
+}
+
+
 // --- D a t a ---
 
 bool Value::FullIsUndefined() const {
@@ -4803,6 +4966,29 @@ int String::Utf8Length() const {
 }
 
 
+// Returns the length of the leading run of characters below 0x80. Those
+// encode to themselves in UTF-8, so the caller can block-copy the run. The
+// input is tested one word at a time.
+static int AsciiRunLength(const uint8_t* chars, int length) {
+  static const uintptr_t kMsbInEveryByte =
+      (i::kUintptrAllBitsSet / 0xFF) << 7;
+  int i = 0;
+  while (i < length &&
+         !i::IsAligned(reinterpret_cast<uintptr_t>(chars + i),
+                       sizeof(uintptr_t))) {
+    if (chars[i] >= 0x80) return i;
+    i++;
+  }
+  for (; i + static_cast<int>(sizeof(uintptr_t)) <= length;
+       i += sizeof(uintptr_t)) {
+    uintptr_t w = *reinterpret_cast<const uintptr_t*>(chars + i);
+    if ((w & kMsbInEveryByte) != 0) break;
+  }
+  while (i < length && chars[i] < 0x80) i++;
+  return i;
+}
+
+
 class Utf8WriterVisitor {
  public:
   Utf8WriterVisitor(
@@ -4893,9 +5079,23 @@ class Utf8WriterVisitor {
       }
       // Write the characters to the stream.
       if (sizeof(Char) == 1) {
-        for (; i < fast_length; i++) {
+        // Block-copy runs of characters below 0x80, which encode to
+        // themselves; only the characters with the high bit set go through
+        // the encoder.
+        while (i < fast_length) {
+          const uint8_t* run_start = reinterpret_cast<const uint8_t*>(chars);
+          int run = AsciiRunLength(run_start, fast_length - i);
+          if (run > 0) {
+            i::MemCopy(buffer, run_start, run);
+            buffer += run;
+            chars += run;
+            i += run;
+            DCHECK(capacity_ == -1 || (buffer - start_) <= capacity_);
+            if (i == fast_length) break;
+          }
           buffer +=
               Utf8::EncodeOneByte(buffer, static_cast<uint8_t>(*chars++));
+          i++;
           DCHECK(capacity_ == -1 || (buffer - start_) <= capacity_);
         }
       } else {
@@ -4953,6 +5153,13 @@ class Utf8WriterVisitor {
     return early_termination_;
   }
 
+  // Lets the streaming encoder resume across caller-provided buffer
+  // segments; see String::WriteUtf8Segments.
+  inline int last_character() const { return last_character_; }
+  inline void set_last_character(int character) {
+    last_character_ = character;
+  }
+
   inline void VisitOneByteString(const uint8_t* chars, int length) {
     Visit(chars, length);
   }
@@ -5024,7 +5231,10 @@ int String::WriteUtf8(char* buffer,
   bool replace_invalid_utf8 = (options & REPLACE_INVALID_UTF8);
   int max16BitCodeUnitSize = unibrow::Utf8::kMax16BitCodeUnitSize;
   // First check if we can just write the string without checking capacity.
-  if (capacity == -1 || capacity / max16BitCodeUnitSize >= string_length) {
+  // Callers that sized the buffer with Utf8Length() can assert as much and
+  // skip both the length recomputation and the per-character checks.
+  if (capacity == -1 || capacity / max16BitCodeUnitSize >= string_length ||
+      (options & PRECOMPUTED_UTF8_LENGTH)) {
     Utf8WriterVisitor writer(buffer, capacity, true, replace_invalid_utf8);
     const int kMaxRecursion = 100;
     bool success = RecursivelySerializeToUtf8(*str, &writer, kMaxRecursion);
@@ -5059,6 +5269,54 @@ int String::WriteUtf8(char* buffer,
 }
 
 
+int String::WriteUtf8Segments(Utf8Segment* segments,
+                              int segment_count,
+                              int* nchars_ref,
+                              int options) const {
+  i::Isolate* isolate = Utils::OpenHandle(this)->GetIsolate();
+  LOG_API(isolate, "String::WriteUtf8Segments");
+  ENTER_V8(isolate);
+  // The string is visited once per segment, so flatten up front to make
+  // each visit a simple bounded scan.
+  i::Handle<i::String> str = i::String::Flatten(Utils::OpenHandle(this));
+  bool write_null = !(options & NO_NULL_TERMINATION);
+  bool replace_invalid_utf8 = (options & REPLACE_INVALID_UTF8);
+  const int string_length = str->length();
+  int offset = 0;
+  int total_written = 0;
+  int last_character = unibrow::Utf16::kNoPreviousCharacter;
+  for (int seg = 0; seg < segment_count && offset < string_length; seg++) {
+    if (segments[seg].capacity <= 0) continue;
+    Utf8WriterVisitor writer(segments[seg].data, segments[seg].capacity,
+                             false, replace_invalid_utf8);
+    writer.set_last_character(last_character);
+    i::String::VisitFlat(&writer, *str, offset);
+    int chars_read = 0;
+    int written = writer.CompleteWrite(false, &chars_read);
+    last_character = writer.last_character();
+    offset += chars_read;
+    // A lead surrogate at the end of a full segment must be re-encoded in
+    // the next segment together with its trail surrogate, because the
+    // encoder combines a pair by rewriting the lead's bytes in place and
+    // those bytes must not cross a segment boundary.
+    if (offset < string_length &&
+        unibrow::Utf16::IsLeadSurrogate(last_character)) {
+      written -= unibrow::Utf8::kSizeOfUnmatchedSurrogate;
+      offset--;
+      last_character = unibrow::Utf16::kNoPreviousCharacter;
+    }
+    total_written += written;
+    if (offset == string_length && write_null &&
+        written < segments[seg].capacity) {
+      segments[seg].data[written] = '\0';
+      total_written++;
+    }
+  }
+  if (nchars_ref != NULL) *nchars_ref = offset;
+  return total_written;
+}
+
+
 template<typename CharType>
 static inline int WriteHelper(const String* string,
                               CharType* buffer,
@@ -5339,6 +5597,26 @@ HeapStatistics::HeapStatistics(): total_heap_size_(0),
                                   heap_size_limit_(0) { }
 
 
+GCStatistics::GCStatistics()
+    : type_(kGCTypeScavenge),
+      pause_time_in_ms_(0),
+      external_time_in_ms_(0),
+      marking_time_in_ms_(0),
+      sweeping_time_in_ms_(0),
+      evacuation_time_in_ms_(0),
+      weak_processing_time_in_ms_(0),
+      promoted_size_(0),
+      semi_space_copied_size_(0),
+      incremental_marking_speed_(0) {}
+
+
+CodeFlushingStatistics::CodeFlushingStatistics()
+    : flushed_function_count_(0),
+      flushed_code_size_(0),
+      recompiled_function_count_(0),
+      recompiled_code_size_(0) {}
+
+
 HeapSpaceStatistics::HeapSpaceStatistics(): space_name_(0),
                                             space_size_(0),
                                             space_used_size_(0),
@@ -5774,6 +6052,37 @@ Local<String> v8::String::NewExternal(
 }
 
 
+namespace {
+
+// Wraps a malloc'd buffer adopted through
+// String::NewExternalOneByte(Isolate*, char*, size_t).
+class AdoptedOneByteResource
+    : public v8::String::ExternalOneByteStringResource {
+ public:
+  AdoptedOneByteResource(char* data, size_t length)
+      : data_(data), length_(length) {}
+  virtual ~AdoptedOneByteResource() { free(data_); }
+  virtual const char* data() const { return data_; }
+  virtual size_t length() const { return length_; }
+
+ private:
+  char* data_;
+  size_t length_;
+};
+
+}  // namespace
+
+
+MaybeLocal<String> v8::String::NewExternalOneByte(Isolate* isolate, char* data,
+                                                  size_t length) {
+  CHECK(data);
+  if (length > static_cast<size_t>(i::String::kMaxLength)) {
+    return MaybeLocal<String>();
+  }
+  return NewExternalOneByte(isolate, new AdoptedOneByteResource(data, length));
+}
+
+
 bool v8::String::MakeExternal(v8::String::ExternalStringResource* resource) {
   i::Handle<i::String> obj = Utils::OpenHandle(this);
   i::Isolate* isolate = obj->GetIsolate();
@@ -5973,6 +6282,10 @@ void v8::Date::DateTimeConfigurationChangeNotification(Isolate* isolate) {
   LOG_API(i_isolate, "Date::DateTimeConfigurationChangeNotification");
   ENTER_V8(i_isolate);
   i_isolate->date_cache()->ResetDateCache();
+#ifdef V8_I18N_SUPPORT
+  // Cached ICU date formats embed the configuration they were created with.
+  i_isolate->icu_service_cache()->Clear();
+#endif
   if (!i_isolate->eternal_handles()->Exists(
           i::EternalHandles::DATE_CACHE_VERSION)) {
     return;
@@ -6254,7 +6567,8 @@ v8::ArrayBuffer::Contents v8::ArrayBuffer::Externalize() {
   Utils::ApiCheck(!self->is_external(), "v8::ArrayBuffer::Externalize",
                   "ArrayBuffer already externalized");
   self->set_is_external(true);
-  isolate->heap()->UnregisterArrayBuffer(self->backing_store());
+  isolate->heap()->UnregisterArrayBuffer(isolate->heap()->InNewSpace(*self),
+                                         self->backing_store());
 
   return GetContents();
 }
@@ -6361,6 +6675,37 @@ bool v8::ArrayBufferView::HasBuffer() const {
 }
 
 
+v8::ArrayBufferView::Contents v8::ArrayBufferView::PinContents() {
+  i::Handle<i::JSArrayBufferView> self = Utils::OpenHandle(this);
+  i::Isolate* isolate = self->GetIsolate();
+  ENTER_V8(isolate);
+  i::Handle<i::JSArrayBuffer> buffer;
+  if (self->IsJSDataView()) {
+    buffer = i::handle(i::JSArrayBuffer::cast(
+        i::JSDataView::cast(*self)->buffer()));
+  } else {
+    DCHECK(self->IsJSTypedArray());
+    // Materializes the backing store off the V8 heap if the typed array's
+    // storage still lives in its elements.
+    buffer = i::JSTypedArray::cast(*self)->GetBuffer();
+  }
+  buffer->set_is_neuterable(false);
+  size_t byte_offset = i::NumberToSize(isolate, self->byte_offset());
+  Contents contents;
+  contents.data_ =
+      static_cast<uint8_t*>(buffer->backing_store()) + byte_offset;
+  contents.byte_length_ = i::NumberToSize(isolate, self->byte_length());
+  return contents;
+}
+
+
+void v8::ArrayBufferView::UnpinContents() {
+  i::Handle<i::JSArrayBufferView> self = Utils::OpenHandle(this);
+  i::Handle<i::JSArrayBuffer> buffer(i::JSArrayBuffer::cast(self->buffer()));
+  buffer->set_is_neuterable(true);
+}
+
+
 size_t v8::ArrayBufferView::ByteOffset() {
   i::Handle<i::JSArrayBufferView> obj = Utils::OpenHandle(this);
   return static_cast<size_t>(obj->byte_offset()->Number());
@@ -6551,6 +6896,35 @@ void Isolate::CollectAllGarbage(const char* gc_reason) {
 }
 
 
+void Isolate::ReportExternalAllocationLimitReached() {
+  reinterpret_cast<i::Isolate*>(this)->heap()->ReportExternalMemoryPressure(
+      "external memory allocation limit reached.");
+}
+
+
+ExternalMemoryPool* ExternalMemoryPool::New(Isolate* isolate) {
+  return new ExternalMemoryPool(isolate);
+}
+
+
+ExternalMemoryPool::~ExternalMemoryPool() { ReleaseAll(); }
+
+
+int64_t ExternalMemoryPool::Adjust(int64_t change_in_bytes) {
+  if (change_in_bytes < -amount_) change_in_bytes = -amount_;
+  amount_ += change_in_bytes;
+  isolate_->AdjustAmountOfExternalAllocatedMemory(change_in_bytes);
+  return amount_;
+}
+
+
+void ExternalMemoryPool::ReleaseAll() {
+  if (amount_ == 0) return;
+  isolate_->AdjustAmountOfExternalAllocatedMemory(-amount_);
+  amount_ = 0;
+}
+
+
 HeapProfiler* Isolate::GetHeapProfiler() {
   i::HeapProfiler* heap_profiler =
       reinterpret_cast<i::Isolate*>(this)->heap_profiler();
@@ -6665,6 +7039,30 @@ void Isolate::RemoveGCEpilogueCallback(GCEpilogueCallback callback) {
 }
 
 
+void Isolate::SetGCStatisticsCallback(GCStatisticsCallback callback) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->set_gc_statistics_callback(callback);
+}
+
+
+void Isolate::SetCodeRetentionPolicy(const CodeRetentionPolicy& policy) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->set_code_retention_policy(
+      policy.minimum_code_age_in_ms(), policy.hot_function_tick_threshold(),
+      policy.code_flush_budget_per_gc());
+}
+
+
+void Isolate::GetCodeFlushingStatistics(CodeFlushingStatistics* statistics) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::Heap* heap = isolate->heap();
+  statistics->flushed_function_count_ = heap->flushed_function_count();
+  statistics->flushed_code_size_ = heap->flushed_code_size();
+  statistics->recompiled_function_count_ = heap->recompiled_function_count();
+  statistics->recompiled_code_size_ = heap->recompiled_code_size();
+}
+
+
 void V8::AddGCPrologueCallback(GCPrologueCallback callback, GCType gc_type) {
   i::Isolate* isolate = i::Isolate::Current();
   isolate->heap()->AddGCPrologueCallback(
@@ -7122,6 +7520,13 @@ void Isolate::SetAllowCodeGenerationFromStringsCallback(
 }
 
 
+void Isolate::SetExternalSourceStoreCallback(
+    ExternalSourceStoreCallback callback) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->set_external_source_store_callback(callback);
+}
+
+
 bool Isolate::IsDead() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   return isolate->IsDead();
@@ -7174,6 +7579,12 @@ void Isolate::SetCaptureStackTraceForUncaughtExceptions(
 }
 
 
+void Isolate::SetStackTraceFrameCap(int frame_cap) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->set_stack_trace_frame_cap(frame_cap);
+}
+
+
 void Isolate::VisitExternalResources(ExternalResourceVisitor* visitor) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   isolate->heap()->VisitExternalResources(visitor);
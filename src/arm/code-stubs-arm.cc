@@ -2717,6 +2717,13 @@ void CallIC_ArrayStub::Generate(MacroAssembler* masm) {
   __ CompareRoot(r5, Heap::kAllocationSiteMapRootIndex);
   __ b(ne, &miss);
 
+  // Increment the call count; the count is kept in the upper bits of the
+  // extra vector slot, above the has-returned-minus-zero flag.
+  __ add(r5, r2, Operand::PointerOffsetFromSmiKey(r3));
+  __ ldr(ip, FieldMemOperand(r5, FixedArray::kHeaderSize + kPointerSize));
+  __ add(ip, ip, Operand(Smi::FromInt(CallICNexus::kCallCountIncrement)));
+  __ str(ip, FieldMemOperand(r5, FixedArray::kHeaderSize + kPointerSize));
+
   __ mov(r2, r4);
   __ mov(r3, r1);
   ArrayConstructorStub stub(masm->isolate(), arg_count());
@@ -2776,6 +2783,13 @@ void CallICStub::Generate(MacroAssembler* masm) {
   // convincing us that we have a monomorphic JSFunction.
   __ JumpIfSmi(r1, &extra_checks_or_miss);
 
+  // Increment the call count; the count is kept in the upper bits of the
+  // extra vector slot, above the has-returned-minus-zero flag.
+  __ add(r4, r2, Operand::PointerOffsetFromSmiKey(r3));
+  __ ldr(r5, FieldMemOperand(r4, FixedArray::kHeaderSize + kPointerSize));
+  __ add(r5, r5, Operand(Smi::FromInt(CallICNexus::kCallCountIncrement)));
+  __ str(r5, FieldMemOperand(r4, FixedArray::kHeaderSize + kPointerSize));
+
   __ bind(&have_js_function);
   if (CallAsMethod()) {
     EmitContinueIfStrictOrNative(masm, &cont);
@@ -2851,6 +2865,11 @@ void CallICStub::Generate(MacroAssembler* masm) {
   __ add(r4, r4, Operand(Smi::FromInt(1)));
   __ str(r4, FieldMemOperand(r2, with_types_offset));
 
+  // Initialize the call count to one.
+  __ add(r4, r2, Operand::PointerOffsetFromSmiKey(r3));
+  __ mov(r5, Operand(Smi::FromInt(CallICNexus::kCallCountIncrement)));
+  __ str(r5, FieldMemOperand(r4, FixedArray::kHeaderSize + kPointerSize));
+
   // Store the function. Use a stub since we need a frame for allocation.
   // r2 - vector
   // r3 - slot
@@ -3372,6 +3391,22 @@ void StringHelper::GenerateFlatOneByteStringEquals(
 
   // Compare characters.
   __ bind(&compare_chars);
+
+  // Fast negative check: if both hash codes have been computed, different
+  // hashes mean different strings, and the characters never have to be
+  // looked at.
+  Label hash_not_usable;
+  STATIC_ASSERT(Name::kHashNotComputedMask != 0);
+  __ ldr(scratch2, FieldMemOperand(left, String::kHashFieldOffset));
+  __ ldr(scratch3, FieldMemOperand(right, String::kHashFieldOffset));
+  __ tst(scratch2, Operand(Name::kHashNotComputedMask));
+  __ b(ne, &hash_not_usable);
+  __ tst(scratch3, Operand(Name::kHashNotComputedMask));
+  __ b(ne, &hash_not_usable);
+  __ cmp(scratch2, scratch3);
+  __ b(ne, &strings_not_equal);
+  __ bind(&hash_not_usable);
+
   GenerateOneByteCharsCompareLoop(masm, left, right, length, scratch2, scratch3,
                                   &strings_not_equal);
 
@@ -2283,12 +2283,28 @@ void FullCodeGenerator::EmitGeneratorResume(Expression *generator,
   __ ldr(r3, FieldMemOperand(r3, FixedArray::kLengthOffset));
   __ SmiUntag(r3);
 
-  // If we are sending a value and there is no operand stack, we can jump back
-  // in directly.
+  // If we are sending a value, the saved operand stack (if any) holds plain
+  // values, so we can restore it inline and jump back in directly. The
+  // runtime is only needed to throw into the generator.
   if (resume_mode == JSGeneratorObject::NEXT) {
-    Label slow_resume;
-    __ cmp(r3, Operand(0));
-    __ b(ne, &slow_resume);
+    // Push the saved operands, walking the backing store with r2 so that no
+    // extra register is needed.
+    Label push_operand, restore_done;
+    __ ldr(r2, FieldMemOperand(r1, JSGeneratorObject::kOperandStackOffset));
+    __ bind(&push_operand);
+    __ sub(r3, r3, Operand(1), SetCC);
+    __ b(mi, &restore_done);
+    __ ldr(ip, FieldMemOperand(r2, FixedArray::kHeaderSize));
+    __ push(ip);
+    __ add(r2, r2, Operand(kPointerSize));
+    __ b(&push_operand);
+    __ bind(&restore_done);
+
+    // Detach the saved operand stack; the empty fixed array is immortal and
+    // immovable, so no write barrier is needed.
+    __ mov(r2, Operand(isolate()->factory()->empty_fixed_array()));
+    __ str(r2, FieldMemOperand(r1, JSGeneratorObject::kOperandStackOffset));
+
     __ ldr(r3, FieldMemOperand(r4, JSFunction::kCodeEntryOffset));
 
     { ConstantPoolUnavailableScope constant_pool_unavailable(masm_);
@@ -2305,25 +2321,24 @@ void FullCodeGenerator::EmitGeneratorResume(Expression *generator,
       __ str(r2, FieldMemOperand(r1, JSGeneratorObject::kContinuationOffset));
       __ Jump(r3);
     }
-    __ bind(&slow_resume);
+  } else {
+    // Push holes for the operand stack and call the runtime to fix up the
+    // stack and throw the value.
+    Label push_operand_holes, call_resume;
+    __ bind(&push_operand_holes);
+    __ sub(r3, r3, Operand(1), SetCC);
+    __ b(mi, &call_resume);
+    __ push(r2);
+    __ b(&push_operand_holes);
+    __ bind(&call_resume);
+    DCHECK(!result_register().is(r1));
+    __ Push(r1, result_register());
+    __ Push(Smi::FromInt(resume_mode));
+    __ CallRuntime(Runtime::kResumeJSGeneratorObject, 3);
+    // Not reached: the runtime call returns elsewhere.
+    __ stop("not-reached");
   }
 
-  // Otherwise, we push holes for the operand stack and call the runtime to fix
-  // up the stack and the handlers.
-  Label push_operand_holes, call_resume;
-  __ bind(&push_operand_holes);
-  __ sub(r3, r3, Operand(1), SetCC);
-  __ b(mi, &call_resume);
-  __ push(r2);
-  __ b(&push_operand_holes);
-  __ bind(&call_resume);
-  DCHECK(!result_register().is(r1));
-  __ Push(r1, result_register());
-  __ Push(Smi::FromInt(resume_mode));
-  __ CallRuntime(Runtime::kResumeJSGeneratorObject, 3);
-  // Not reached: the runtime call returns elsewhere.
-  __ stop("not-reached");
-
   __ bind(&done);
   context()->Plug(result_register());
 }
@@ -2515,53 +2530,68 @@ void FullCodeGenerator::EmitClassDefineProperties(ClassLiteral* lit) {
          FieldMemOperand(r0, JSFunction::kPrototypeOrInitialMapOffset));
   __ push(scratch);
 
-  for (int i = 0; i < lit->properties()->length(); i++) {
-    ObjectLiteral::Property* property = lit->properties()->at(i);
-    Expression* value = property->value();
-
-    if (property->is_static()) {
-      __ ldr(scratch, MemOperand(sp, kPointerSize));  // constructor
-    } else {
-      __ ldr(scratch, MemOperand(sp, 0));  // prototype
-    }
+  if (lit->HasOnlySimpleMethods()) {
+    // The class body consists only of plain prototype methods;
+    // install the whole method table with a single runtime call.
+    __ ldr(scratch, MemOperand(sp, 0));  // prototype
     __ push(scratch);
-    EmitPropertyKey(property, lit->GetIdForProperty(i));
-
-    // The static prototype property is read only. We handle the non computed
-    // property name case in the parser. Since this is the only case where we
-    // need to check for an own read only property we special case this so we do
-    // not need to do this for every property.
-    if (property->is_static() && property->is_computed_name()) {
-      __ CallRuntime(Runtime::kThrowIfStaticPrototype, 1);
-      __ push(r0);
+    for (int i = 0; i < lit->properties()->length(); i++) {
+      ObjectLiteral::Property* property = lit->properties()->at(i);
+      EmitPropertyKey(property, lit->GetIdForProperty(i));
+      VisitForStackValue(property->value());
+      EmitSetHomeObjectIfNeeded(property->value(), 2 * i + 2);
     }
+    __ CallRuntime(Runtime::kDefineClassMethods,
+                   2 * lit->properties()->length() + 1);
+  } else {
+    for (int i = 0; i < lit->properties()->length(); i++) {
+      ObjectLiteral::Property* property = lit->properties()->at(i);
+      Expression* value = property->value();
 
-    VisitForStackValue(value);
-    EmitSetHomeObjectIfNeeded(value, 2);
+      if (property->is_static()) {
+        __ ldr(scratch, MemOperand(sp, kPointerSize));  // constructor
+      } else {
+        __ ldr(scratch, MemOperand(sp, 0));  // prototype
+      }
+      __ push(scratch);
+      EmitPropertyKey(property, lit->GetIdForProperty(i));
+
+      // The static prototype property is read only. We handle the non
+      // computed property name case in the parser. Since this is the only
+      // case where we need to check for an own read only property we special
+      // case this so we do not need to do this for every property.
+      if (property->is_static() && property->is_computed_name()) {
+        __ CallRuntime(Runtime::kThrowIfStaticPrototype, 1);
+        __ push(r0);
+      }
 
-    switch (property->kind()) {
-      case ObjectLiteral::Property::CONSTANT:
-      case ObjectLiteral::Property::MATERIALIZED_LITERAL:
-      case ObjectLiteral::Property::PROTOTYPE:
-        UNREACHABLE();
-      case ObjectLiteral::Property::COMPUTED:
-        __ CallRuntime(Runtime::kDefineClassMethod, 3);
-        break;
+      VisitForStackValue(value);
+      EmitSetHomeObjectIfNeeded(value, 2);
 
-      case ObjectLiteral::Property::GETTER:
-        __ mov(r0, Operand(Smi::FromInt(DONT_ENUM)));
-        __ push(r0);
-        __ CallRuntime(Runtime::kDefineGetterPropertyUnchecked, 4);
-        break;
+      switch (property->kind()) {
+        case ObjectLiteral::Property::CONSTANT:
+        case ObjectLiteral::Property::MATERIALIZED_LITERAL:
+        case ObjectLiteral::Property::PROTOTYPE:
+          UNREACHABLE();
+        case ObjectLiteral::Property::COMPUTED:
+          __ CallRuntime(Runtime::kDefineClassMethod, 3);
+          break;
 
-      case ObjectLiteral::Property::SETTER:
-        __ mov(r0, Operand(Smi::FromInt(DONT_ENUM)));
-        __ push(r0);
-        __ CallRuntime(Runtime::kDefineSetterPropertyUnchecked, 4);
-        break;
+        case ObjectLiteral::Property::GETTER:
+          __ mov(r0, Operand(Smi::FromInt(DONT_ENUM)));
+          __ push(r0);
+          __ CallRuntime(Runtime::kDefineGetterPropertyUnchecked, 4);
+          break;
 
-      default:
-        UNREACHABLE();
+        case ObjectLiteral::Property::SETTER:
+          __ mov(r0, Operand(Smi::FromInt(DONT_ENUM)));
+          __ push(r0);
+          __ CallRuntime(Runtime::kDefineSetterPropertyUnchecked, 4);
+          break;
+
+        default:
+          UNREACHABLE();
+      }
     }
   }
 
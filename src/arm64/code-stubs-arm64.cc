@@ -3114,6 +3114,14 @@ void CallIC_ArrayStub::Generate(MacroAssembler* masm) {
   __ Ldr(map, FieldMemOperand(scratch, HeapObject::kMapOffset));
   __ JumpIfNotRoot(map, Heap::kAllocationSiteMapRootIndex, &miss);
 
+  // Increment the call count; the count is kept in the upper bits of the
+  // extra vector slot, above the has-returned-minus-zero flag.
+  __ Add(x5, feedback_vector,
+         Operand::UntagSmiAndScale(index, kPointerSizeLog2));
+  __ Ldr(x6, FieldMemOperand(x5, FixedArray::kHeaderSize + kPointerSize));
+  __ Add(x6, x6, Operand(Smi::FromInt(CallICNexus::kCallCountIncrement)));
+  __ Str(x6, FieldMemOperand(x5, FixedArray::kHeaderSize + kPointerSize));
+
   Register allocation_site = feedback_vector;
   __ Mov(allocation_site, scratch);
 
@@ -3183,6 +3191,14 @@ void CallICStub::Generate(MacroAssembler* masm) {
   // convincing us that we have a monomorphic JSFunction.
   __ JumpIfSmi(function, &extra_checks_or_miss);
 
+  // Increment the call count; the count is kept in the upper bits of the
+  // extra vector slot, above the has-returned-minus-zero flag.
+  __ Add(x4, feedback_vector,
+         Operand::UntagSmiAndScale(index, kPointerSizeLog2));
+  __ Ldr(x5, FieldMemOperand(x4, FixedArray::kHeaderSize + kPointerSize));
+  __ Add(x5, x5, Operand(Smi::FromInt(CallICNexus::kCallCountIncrement)));
+  __ Str(x5, FieldMemOperand(x4, FixedArray::kHeaderSize + kPointerSize));
+
   __ bind(&have_js_function);
   if (CallAsMethod()) {
     EmitContinueIfStrictOrNative(masm, &cont);
@@ -3258,6 +3274,12 @@ void CallICStub::Generate(MacroAssembler* masm) {
   __ Adds(x4, x4, Operand(Smi::FromInt(1)));
   __ Str(x4, FieldMemOperand(feedback_vector, with_types_offset));
 
+  // Initialize the call count to one.
+  __ Add(x4, feedback_vector,
+         Operand::UntagSmiAndScale(index, kPointerSizeLog2));
+  __ Mov(x5, Operand(Smi::FromInt(CallICNexus::kCallCountIncrement)));
+  __ Str(x5, FieldMemOperand(x4, FixedArray::kHeaderSize + kPointerSize));
+
   // Store the function. Use a stub since we need a frame for allocation.
   // x2 - vector
   // x3 - slot
@@ -4094,6 +4116,22 @@ void StringHelper::GenerateFlatOneByteStringEquals(
 
   // Compare characters. Falls through if all characters are equal.
   __ Bind(&compare_chars);
+
+  // Fast negative check: if both hash codes have been computed, different
+  // hashes mean different strings, and the characters never have to be
+  // looked at.
+  Label hash_not_usable;
+  STATIC_ASSERT(Name::kHashNotComputedMask != 0);
+  __ Ldr(scratch2.W(), FieldMemOperand(left, String::kHashFieldOffset));
+  __ Ldr(scratch3.W(), FieldMemOperand(right, String::kHashFieldOffset));
+  __ TestAndBranchIfAnySet(scratch2.W(), Name::kHashNotComputedMask,
+                           &hash_not_usable);
+  __ TestAndBranchIfAnySet(scratch3.W(), Name::kHashNotComputedMask,
+                           &hash_not_usable);
+  __ Cmp(scratch2.W(), scratch3.W());
+  __ B(ne, &strings_not_equal);
+  __ Bind(&hash_not_usable);
+
   GenerateOneByteCharsCompareLoop(masm, left, right, left_length, scratch2,
                                   scratch3, &strings_not_equal);
 
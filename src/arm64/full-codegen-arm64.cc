@@ -2208,53 +2208,68 @@ void FullCodeGenerator::EmitClassDefineProperties(ClassLiteral* lit) {
          FieldMemOperand(x0, JSFunction::kPrototypeOrInitialMapOffset));
   __ Push(scratch);
 
-  for (int i = 0; i < lit->properties()->length(); i++) {
-    ObjectLiteral::Property* property = lit->properties()->at(i);
-    Expression* value = property->value();
-
-    if (property->is_static()) {
-      __ Peek(scratch, kPointerSize);  // constructor
-    } else {
-      __ Peek(scratch, 0);  // prototype
-    }
+  if (lit->HasOnlySimpleMethods()) {
+    // The class body consists only of plain prototype methods;
+    // install the whole method table with a single runtime call.
+    __ Peek(scratch, 0);  // prototype
     __ Push(scratch);
-    EmitPropertyKey(property, lit->GetIdForProperty(i));
-
-    // The static prototype property is read only. We handle the non computed
-    // property name case in the parser. Since this is the only case where we
-    // need to check for an own read only property we special case this so we do
-    // not need to do this for every property.
-    if (property->is_static() && property->is_computed_name()) {
-      __ CallRuntime(Runtime::kThrowIfStaticPrototype, 1);
-      __ Push(x0);
+    for (int i = 0; i < lit->properties()->length(); i++) {
+      ObjectLiteral::Property* property = lit->properties()->at(i);
+      EmitPropertyKey(property, lit->GetIdForProperty(i));
+      VisitForStackValue(property->value());
+      EmitSetHomeObjectIfNeeded(property->value(), 2 * i + 2);
     }
+    __ CallRuntime(Runtime::kDefineClassMethods,
+                   2 * lit->properties()->length() + 1);
+  } else {
+    for (int i = 0; i < lit->properties()->length(); i++) {
+      ObjectLiteral::Property* property = lit->properties()->at(i);
+      Expression* value = property->value();
 
-    VisitForStackValue(value);
-    EmitSetHomeObjectIfNeeded(value, 2);
+      if (property->is_static()) {
+        __ Peek(scratch, kPointerSize);  // constructor
+      } else {
+        __ Peek(scratch, 0);  // prototype
+      }
+      __ Push(scratch);
+      EmitPropertyKey(property, lit->GetIdForProperty(i));
+
+      // The static prototype property is read only. We handle the non
+      // computed property name case in the parser. Since this is the only
+      // case where we need to check for an own read only property we special
+      // case this so we do not need to do this for every property.
+      if (property->is_static() && property->is_computed_name()) {
+        __ CallRuntime(Runtime::kThrowIfStaticPrototype, 1);
+        __ Push(x0);
+      }
 
-    switch (property->kind()) {
-      case ObjectLiteral::Property::CONSTANT:
-      case ObjectLiteral::Property::MATERIALIZED_LITERAL:
-      case ObjectLiteral::Property::PROTOTYPE:
-        UNREACHABLE();
-      case ObjectLiteral::Property::COMPUTED:
-        __ CallRuntime(Runtime::kDefineClassMethod, 3);
-        break;
+      VisitForStackValue(value);
+      EmitSetHomeObjectIfNeeded(value, 2);
 
-      case ObjectLiteral::Property::GETTER:
-        __ Mov(x0, Smi::FromInt(DONT_ENUM));
-        __ Push(x0);
-        __ CallRuntime(Runtime::kDefineGetterPropertyUnchecked, 4);
-        break;
+      switch (property->kind()) {
+        case ObjectLiteral::Property::CONSTANT:
+        case ObjectLiteral::Property::MATERIALIZED_LITERAL:
+        case ObjectLiteral::Property::PROTOTYPE:
+          UNREACHABLE();
+        case ObjectLiteral::Property::COMPUTED:
+          __ CallRuntime(Runtime::kDefineClassMethod, 3);
+          break;
 
-      case ObjectLiteral::Property::SETTER:
-        __ Mov(x0, Smi::FromInt(DONT_ENUM));
-        __ Push(x0);
-        __ CallRuntime(Runtime::kDefineSetterPropertyUnchecked, 4);
-        break;
+        case ObjectLiteral::Property::GETTER:
+          __ Mov(x0, Smi::FromInt(DONT_ENUM));
+          __ Push(x0);
+          __ CallRuntime(Runtime::kDefineGetterPropertyUnchecked, 4);
+          break;
 
-      default:
-        UNREACHABLE();
+        case ObjectLiteral::Property::SETTER:
+          __ Mov(x0, Smi::FromInt(DONT_ENUM));
+          __ Push(x0);
+          __ CallRuntime(Runtime::kDefineSetterPropertyUnchecked, 4);
+          break;
+
+        default:
+          UNREACHABLE();
+      }
     }
   }
 
@@ -5179,11 +5194,27 @@ void FullCodeGenerator::EmitGeneratorResume(Expression *generator,
   __ Ldr(operand_stack_size,
          UntagSmiFieldMemOperand(x10, FixedArray::kLengthOffset));
 
-  // If we are sending a value and there is no operand stack, we can jump back
-  // in directly.
+  // If we are sending a value, the saved operand stack (if any) holds plain
+  // values, so we can restore it inline and jump back in directly. The
+  // runtime is only needed to throw into the generator.
   if (resume_mode == JSGeneratorObject::NEXT) {
-    Label slow_resume;
-    __ Cbnz(operand_stack_size, &slow_resume);
+    // Push the saved operands; x10 walks the backing store.
+    Label push_operand, restore_done;
+    __ Bind(&push_operand);
+    __ Subs(operand_stack_size, operand_stack_size, 1);
+    __ B(mi, &restore_done);
+    __ Ldr(x11, FieldMemOperand(x10, FixedArray::kHeaderSize));
+    __ Push(x11);
+    __ Add(x10, x10, kPointerSize);
+    __ B(&push_operand);
+    __ Bind(&restore_done);
+
+    // Detach the saved operand stack; the empty fixed array is immortal and
+    // immovable, so no write barrier is needed.
+    __ LoadRoot(x10, Heap::kEmptyFixedArrayRootIndex);
+    __ Str(x10, FieldMemOperand(generator_object,
+                                JSGeneratorObject::kOperandStackOffset));
+
     __ Ldr(x10, FieldMemOperand(function, JSFunction::kCodeEntryOffset));
     __ Ldrsw(x11,
              UntagSmiFieldMemOperand(generator_object,
@@ -5193,20 +5224,18 @@ void FullCodeGenerator::EmitGeneratorResume(Expression *generator,
     __ Str(x12, FieldMemOperand(generator_object,
                                 JSGeneratorObject::kContinuationOffset));
     __ Br(x10);
-
-    __ Bind(&slow_resume);
+  } else {
+    // Push holes for the operand stack and call the runtime to fix up the
+    // stack and throw the value.
+    __ PushMultipleTimes(the_hole, operand_stack_size);
+
+    __ Mov(x10, Smi::FromInt(resume_mode));
+    __ Push(generator_object, result_register(), x10);
+    __ CallRuntime(Runtime::kResumeJSGeneratorObject, 3);
+    // Not reached: the runtime call returns elsewhere.
+    __ Unreachable();
   }
 
-  // Otherwise, we push holes for the operand stack and call the runtime to fix
-  // up the stack and the handlers.
-  __ PushMultipleTimes(the_hole, operand_stack_size);
-
-  __ Mov(x10, Smi::FromInt(resume_mode));
-  __ Push(generator_object, result_register(), x10);
-  __ CallRuntime(Runtime::kResumeJSGeneratorObject, 3);
-  // Not reached: the runtime call returns elsewhere.
-  __ Unreachable();
-
   __ Bind(&done);
   context()->Plug(result_register());
 }
@@ -369,10 +369,12 @@ void LCodeGen::RegisterEnvironmentForDeoptimization(LEnvironment* environment,
     }
     Translation translation(&translations_, frame_count, jsframe_count, zone());
     WriteTranslation(environment, &translation);
+    int translation_index = translations_.CommitEntry(translation.index(),
+                                                      zone());
     int deoptimization_index = deoptimizations_.length();
     int pc_offset = masm()->pc_offset();
     environment->Register(deoptimization_index,
-                          translation.index(),
+                          translation_index,
                           (mode == Safepoint::kLazyDeopt) ? pc_offset : -1);
     deoptimizations_.Add(environment, zone());
   }
@@ -935,7 +937,7 @@ bool LCodeGen::GenerateSafepointTable() {
   // We do not know how much data will be emitted for the safepoint table, so
   // force emission of the veneer pool.
   masm()->CheckVeneerPool(true, true);
-  safepoints_.Emit(masm(), GetStackSlotCount());
+  safepoints_.Emit(isolate(), GetStackSlotCount());
   return !is_aborted();
 }
 
@@ -943,7 +945,7 @@ bool LCodeGen::GenerateSafepointTable() {
 void LCodeGen::FinishCode(Handle<Code> code) {
   DCHECK(is_done());
   code->set_stack_slots(GetStackSlotCount());
-  code->set_safepoint_table_offset(safepoints_.GetCodeOffset());
+  code->set_safepoint_table(*safepoints_.GetSafepointTable());
   PopulateDeoptimizationData(code);
 }
 
@@ -570,6 +570,9 @@ function ArrayReverse() {
   var array = TO_OBJECT_INLINE(this);
   var len = TO_UINT32(array.length);
 
+  // Packed arrays reverse their backing store in place in the runtime.
+  if (IS_ARRAY(array) && %FastArrayReverse(array)) return array;
+
   if (UseSparseVariant(array, len, IS_ARRAY(array), len)) {
     %NormalizeElements(array);
     SparseReverse(array, len);
@@ -868,6 +871,9 @@ function ArraySort(comparefn) {
   // For short (length <= 22) arrays, insertion sort is used for efficiency.
 
   if (!IS_SPEC_FUNCTION(comparefn)) {
+    // Packed arrays of numbers sort into the default order entirely in the
+    // runtime, without calling back into JavaScript per comparison.
+    if (IS_ARRAY(this) && %SortDefaultNumberElements(this)) return this;
     comparefn = function (x, y) {
       if (x === y) return 0;
       if (%_IsSmi(x) && %_IsSmi(y)) {
@@ -1304,6 +1310,12 @@ function ArrayMap(f, receiver) {
 
   var result = new GlobalArray();
   var accumulator = new InternalArray(length);
+  if (length > 100000 && %_IsSmi(length)) {
+    // Beyond kInitialMaxFastElementArray the single-argument constructor
+    // starts the array off in dictionary mode; the result size is known, so
+    // give the accumulator a fast store of exactly that size instead.
+    %PreallocateArrayElements(accumulator, length);
+  }
   var is_array = IS_ARRAY(array);
   var stepping = DEBUG_IS_ACTIVE && %DebugCallbackSupportsStepping(f);
   for (var i = 0; i < length; i++) {
@@ -1338,6 +1350,11 @@ function ArrayIndexOf(element, index) {
   }
   var min = index;
   var max = length;
+  // Packed smi and double arrays search their backing store in the runtime.
+  if (IS_ARRAY(this) && min < max && %_IsSmi(min)) {
+    var result = %FastArrayIndexOf(this, element, min);
+    if (!IS_UNDEFINED(result)) return result;
+  }
   if (UseSparseVariant(this, length, IS_ARRAY(this), max - min)) {
     %NormalizeElements(this);
     var indices = %GetArrayKeys(this, length);
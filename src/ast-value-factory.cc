@@ -198,6 +198,15 @@ void AstValue::Internalize(Isolate* isolate) {
 
 AstRawString* AstValueFactory::GetOneByteStringInternal(
     Vector<const uint8_t> literal) {
+  if (literal.length() == 1 && literal[0] < kMaxOneCharStringValue) {
+    int key = literal[0];
+    if (one_character_strings_[key] == NULL) {
+      uint32_t hash = StringHasher::HashSequentialString<uint8_t>(
+          literal.start(), literal.length(), hash_seed_);
+      one_character_strings_[key] = GetString(hash, true, literal);
+    }
+    return one_character_strings_[key];
+  }
   uint32_t hash = StringHasher::HashSequentialString<uint8_t>(
       literal.start(), literal.length(), hash_seed_);
   return GetString(hash, true, literal);
@@ -252,6 +261,10 @@ void AstValueFactory::Internalize(Isolate* isolate) {
     // Everything is already internalized.
     return;
   }
+  // Grow the string table once up front instead of element by element while
+  // internalizing; after a background parse most of the strings below are
+  // inserted in one burst.
+  StringTable::EnsureCapacityForDeserialization(isolate, strings_.length());
   // Strings need to be internalized before values, because values refer to
   // strings.
   for (int i = 0; i < strings_.length(); ++i) {
@@ -288,6 +288,9 @@ class AstValueFactory {
 #define F(name, str) name##_string_ = NULL;
     STRING_CONSTANTS(F)
 #undef F
+    for (int i = 0; i < kMaxOneCharStringValue; i++) {
+      one_character_strings_[i] = NULL;
+    }
 #define F(name) name##_ = NULL;
     OTHER_CONSTANTS(F)
 #undef F
@@ -348,6 +351,10 @@ class AstValueFactory {
 
   // All strings are copied here, one after another (no NULLs inbetween).
   HashMap string_table_;
+  // Caches one-character ASCII strings, which dominate minified sources, so
+  // repeated lookups skip hashing and the string table entirely.
+  static const int kMaxOneCharStringValue = 128;
+  AstRawString* one_character_strings_[kMaxOneCharStringValue];
   // For keeping track of all AstValues and AstRawStrings we've created (so that
   // they can be internalized later).
   List<AstValue*> values_;
@@ -291,6 +291,19 @@ bool ObjectLiteral::IsBoilerplateProperty(ObjectLiteral::Property* property) {
 }
 
 
+bool ClassLiteral::HasOnlySimpleMethods() const {
+  if (properties()->length() == 0) return false;
+  for (int i = 0; i < properties()->length(); i++) {
+    Property* property = properties()->at(i);
+    if (property->is_static() || property->is_computed_name() ||
+        property->kind() != ObjectLiteral::Property::COMPUTED) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
 void ObjectLiteral::BuildConstantProperties(Isolate* isolate) {
   if (!constant_properties_.is_null()) return;
 
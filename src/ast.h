@@ -2616,6 +2616,11 @@ class ClassLiteral final : public Expression {
   // Return an AST id for a property that is used in simulate instructions.
   BailoutId GetIdForProperty(int i) { return BailoutId(local_id(i + 4)); }
 
+  // True if the class body consists only of non-static methods with literal
+  // names, so that code generators can install the whole method table with a
+  // single %DefineClassMethods call.
+  bool HasOnlySimpleMethods() const;
+
   // Unlike other AST nodes, this number of bailout IDs allocated for an
   // ClassLiteral can vary, so num_ids() is not a static method.
   int num_ids() const { return parent_num_ids() + 4 + properties()->length(); }
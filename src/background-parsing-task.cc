@@ -42,6 +42,17 @@ BackgroundParsingTask::BackgroundParsingTask(
 }
 
 
+// Note on parallelizing this task further: handing function bodies that the
+// preparser skips over to concurrent parser tasks does not work with the
+// current pipeline. The parser cannot proceed past a lazy function until the
+// body has been scanned to find its closing brace, so there is no point at
+// which a body is known but not yet scanned; and the streamed source has no
+// random access, so a second parser cannot re-read a body range once the
+// main parse has moved on. Both would have to change (buffering the decoded
+// source and re-parsing bodies after the main parse) before parser tasks can
+// be spawned from here. Until then, the streaming parse keeps the whole scan
+// off the main thread, and kProduceParserCache/kConsumeParserCache avoids
+// re-scanning bodies on repeated loads of the same script.
 void BackgroundParsingTask::Run() {
   DisallowHeapAllocation no_allocation;
   DisallowHandleAllocation no_handles;
@@ -16,7 +16,11 @@ namespace internal {
 
 // Internal representation of v8::ScriptCompiler::StreamedSource. Contains all
 // data which needs to be transmitted between threads for background parsing,
-// finalizing it on the main thread, and compiling on the main thread.
+// finalizing it on the main thread, and compiling on the main thread. Each
+// StreamedSource is owned by exactly one BackgroundParsingTask and shares
+// nothing with other streamed compilations, so any number of tasks may run
+// concurrently; the parser must not touch the isolate while on the background
+// thread (see the DCHECKs in Parser).
 struct StreamedSource {
   StreamedSource(ScriptCompiler::ExternalSourceStream* source_stream,
                  ScriptCompiler::StreamedSource::Encoding encoding)
@@ -330,6 +330,7 @@ CPU::CPU()
       has_bmi2_(false),
       has_lzcnt_(false),
       has_popcnt_(false),
+      has_invariant_tsc_(false),
       has_idiva_(false),
       has_neon_(false),
       has_thumb2_(false),
@@ -417,6 +418,13 @@ CPU::CPU()
     has_sahf_ = (cpu_info[2] & 0x00000001) != 0;
   }
 
+  if (num_ext_ids >= 0x80000007) {
+    __cpuid(cpu_info, 0x80000007);
+    // Invariant TSC: the time stamp counter runs at a constant rate in all
+    // ACPI P-, C- and T-states, so it can serve as a wall clock source.
+    has_invariant_tsc_ = (cpu_info[3] & 0x00000100) != 0;
+  }
+
 #elif V8_HOST_ARCH_ARM
 
 #if V8_OS_LINUX
@@ -90,6 +90,7 @@ class CPU final {
   bool has_bmi2() const { return has_bmi2_; }
   bool has_lzcnt() const { return has_lzcnt_; }
   bool has_popcnt() const { return has_popcnt_; }
+  bool has_invariant_tsc() const { return has_invariant_tsc_; }
   bool is_atom() const { return is_atom_; }
 
   // arm features
@@ -133,6 +134,7 @@ class CPU final {
   bool has_bmi2_;
   bool has_lzcnt_;
   bool has_popcnt_;
+  bool has_invariant_tsc_;
   bool has_idiva_;
   bool has_neon_;
   bool has_thumb2_;
@@ -9,6 +9,19 @@
 namespace v8 {
 namespace base {
 
+// Initial, maximum and recovery values for the adaptive spin bound of
+// Mutex::Lock(). The bound doubles (plus one, so a bound of zero can
+// recover) on an acquisition within the bound and halves when the spin is
+// exhausted and the thread parks in the kernel.
+static const int kInitialMutexSpinCount = 64;
+static const int kMaxMutexSpinCount = 1024;
+
+// Aggregate contention statistics; see Mutex::ContendedAcquires() and
+// SpinLock::ContendedAcquires().
+static Atomic32 contended_mutex_acquires = 0;
+static Atomic32 parked_mutex_acquires = 0;
+static Atomic32 contended_spin_lock_acquires = 0;
+
 #if V8_OS_POSIX
 
 static V8_INLINE void InitializeNativeHandle(pthread_mutex_t* mutex) {
@@ -112,6 +125,7 @@ static V8_INLINE bool TryLockNativeHandle(PCRITICAL_SECTION cs) {
 
 Mutex::Mutex() {
   InitializeNativeHandle(&native_handle_);
+  spin_count_ = kInitialMutexSpinCount;
 #ifdef DEBUG
   level_ = 0;
 #endif
@@ -125,11 +139,67 @@ Mutex::~Mutex() {
 
 
 void Mutex::Lock() {
-  LockNativeHandle(&native_handle_);
+  // Nanosecond-scale critical sections pay more for a futex transition than
+  // for the work they guard, so try the cheap user-space acquisition path
+  // before parking in the kernel.
+  if (V8_UNLIKELY(!TryLockNativeHandle(&native_handle_))) {
+    LockContended();
+  }
   AssertUnheldAndMark();
 }
 
 
+void Mutex::LockContended() {
+  NoBarrier_AtomicIncrement(&contended_mutex_acquires, 1);
+  // Retry the user-space path for a bounded number of rounds. The bound
+  // adapts to how this mutex behaved recently: a lock that keeps being
+  // handed over within the bound stays worth spinning on, one that
+  // repeatedly parks anyway stops paying for the spin.
+  int spins = static_cast<int>(NoBarrier_Load(&spin_count_));
+  for (int i = 0; i < spins; i++) {
+    RelaxCpu();
+    if (TryLockNativeHandle(&native_handle_)) {
+      int new_spins = 2 * spins + 1;
+      if (new_spins > kMaxMutexSpinCount) new_spins = kMaxMutexSpinCount;
+      NoBarrier_Store(&spin_count_, new_spins);
+      return;
+    }
+  }
+  NoBarrier_Store(&spin_count_, spins / 2);
+  NoBarrier_AtomicIncrement(&parked_mutex_acquires, 1);
+  LockNativeHandle(&native_handle_);
+}
+
+
+// static
+int Mutex::ContendedAcquires() {
+  return static_cast<int>(NoBarrier_Load(&contended_mutex_acquires));
+}
+
+
+// static
+int Mutex::ParkedAcquires() {
+  return static_cast<int>(NoBarrier_Load(&parked_mutex_acquires));
+}
+
+
+void SpinLock::LockSlow() {
+  NoBarrier_AtomicIncrement(&contended_spin_lock_acquires, 1);
+  for (;;) {
+    // Spin on a plain load to keep the cache line shared until the lock is
+    // observed free, then race for it.
+    while (NoBarrier_Load(&state_) != kUnlocked) RelaxCpu();
+    if (TryLock()) return;
+  }
+}
+
+
+// static
+int SpinLock::ContendedAcquires() {
+  return static_cast<int>(NoBarrier_Load(&contended_spin_lock_acquires));
+}
+
+
 void Mutex::Unlock() {
   AssertHeldAndUnmark();
   UnlockNativeHandle(&native_handle_);
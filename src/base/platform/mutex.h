@@ -5,6 +5,7 @@
 #ifndef V8_BASE_PLATFORM_MUTEX_H_
 #define V8_BASE_PLATFORM_MUTEX_H_
 
+#include "src/base/atomicops.h"
 #include "src/base/lazy-instance.h"
 #if V8_OS_WIN
 #include "src/base/win32-headers.h"
@@ -40,8 +41,9 @@ class Mutex final {
 
   // Locks the given mutex. If the mutex is currently unlocked, it becomes
   // locked and owned by the calling thread, and immediately. If the mutex
-  // is already locked by another thread, suspends the calling thread until
-  // the mutex is unlocked.
+  // is already locked by another thread, retries the cheap user-space
+  // acquisition path for a bounded, adaptively sized number of rounds
+  // before suspending the calling thread until the mutex is unlocked.
   void Lock();
 
   // Unlocks the given mutex. The mutex is assumed to be locked and owned by
@@ -52,6 +54,13 @@ class Mutex final {
   // successfully locked.
   bool TryLock() WARN_UNUSED_RESULT;
 
+  // Aggregate contention statistics over all mutexes, imprecise under
+  // concurrency: the number of Lock() calls that found the mutex held, and
+  // the subset of those that exhausted the spin bound and parked in the
+  // kernel.
+  static int ContendedAcquires();
+  static int ParkedAcquires();
+
   // The implementation-defined native handle type.
 #if V8_OS_POSIX
   typedef pthread_mutex_t NativeHandle;
@@ -68,10 +77,17 @@ class Mutex final {
 
  private:
   NativeHandle native_handle_;
+  // Bound on the user-space acquisition rounds Lock() attempts before
+  // parking. Updated with plain racy loads and stores; the bound is a
+  // heuristic and any value is correct.
+  Atomic32 spin_count_;
 #ifdef DEBUG
   int level_;
 #endif
 
+  // Slow path of Lock() for a mutex that was observed held.
+  void LockContended();
+
   V8_INLINE void AssertHeldAndUnmark() {
 #ifdef DEBUG
     DCHECK_EQ(1, level_);
@@ -107,6 +123,69 @@ typedef LazyStaticInstance<Mutex, DefaultConstructTrait<Mutex>,
 #define LAZY_MUTEX_INITIALIZER LAZY_STATIC_INSTANCE_INITIALIZER
 
 
+// Tells the processor that the caller is in a busy-wait loop, to reduce
+// power consumption and let a hyper-threaded sibling make progress.
+V8_INLINE void RelaxCpu() {
+#if V8_CC_MSVC
+  YieldProcessor();
+#elif V8_HOST_ARCH_IA32 || V8_HOST_ARCH_X64
+  __asm__ __volatile__("pause");
+#elif V8_HOST_ARCH_ARM || V8_HOST_ARCH_ARM64
+  __asm__ __volatile__("yield");
+#endif
+}
+
+
+// ----------------------------------------------------------------------------
+// SpinLock
+//
+// Synchronization primitive for critical sections that are known to be a
+// handful of memory accesses long. Waiters spin in user space instead of
+// parking in the kernel, so an acquisition never pays for a futex
+// transition; in return the holder must not block in the kernel or perform
+// more than a trivial amount of work while holding the lock. Offers the
+// same exclusive, non-recursive ownership semantics as Mutex and works
+// with LockGuard.
+
+class SpinLock final {
+ public:
+  SpinLock() : state_(kUnlocked) {}
+
+  // Locks the spin lock, busy-waiting until it is released if some other
+  // thread currently holds it.
+  void Lock() {
+    if (V8_LIKELY(TryLock())) return;
+    LockSlow();
+  }
+
+  // Unlocks the spin lock. The lock is assumed to be held by the calling
+  // thread on entrance.
+  void Unlock() {
+    Release_Store(&state_, kUnlocked);
+  }
+
+  // Tries to lock the spin lock. Returns whether the lock was successfully
+  // acquired.
+  bool TryLock() WARN_UNUSED_RESULT {
+    return Acquire_CompareAndSwap(&state_, kUnlocked, kLocked) == kUnlocked;
+  }
+
+  // Aggregate number of Lock() calls over all spin locks that found the
+  // lock held. Imprecise under concurrency.
+  static int ContendedAcquires();
+
+ private:
+  static const Atomic32 kUnlocked = 0;
+  static const Atomic32 kLocked = 1;
+
+  void LockSlow();
+
+  volatile Atomic32 state_;
+
+  DISALLOW_COPY_AND_ASSIGN(SpinLock);
+};
+
+
 // -----------------------------------------------------------------------------
 // RecursiveMutex
 //
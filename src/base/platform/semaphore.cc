@@ -13,6 +13,7 @@
 
 #include "src/base/logging.h"
 #include "src/base/platform/elapsed-timer.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/platform/time.h"
 
 namespace v8 {
@@ -96,6 +97,16 @@ void Semaphore::Signal() {
 
 
 void Semaphore::Wait() {
+  // Spin briefly before parking. When the signal arrives within the bound,
+  // e.g. because tasks are posted at high frequency, neither this wait nor
+  // the matching post leaves user space, saving several microseconds of
+  // futex wakeup latency per signal.
+  static const int kWaitSpinCount = 256;
+  for (int i = 0; i < kWaitSpinCount; i++) {
+    if (sem_trywait(&native_handle_) == 0) return;  // Semaphore was signalled.
+    DCHECK(errno == EAGAIN || errno == EINTR);
+    RelaxCpu();
+  }
   while (true) {
     int result = sem_wait(&native_handle_);
     if (result == 0) return;  // Semaphore was signalled.
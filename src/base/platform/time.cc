@@ -17,10 +17,10 @@
 #include <ostream>
 
 #if V8_OS_WIN
-#include "src/base/lazy-instance.h"
 #include "src/base/win32-headers.h"
 #endif
 #include "src/base/cpu.h"
+#include "src/base/lazy-instance.h"
 #include "src/base/logging.h"
 #include "src/base/platform/platform.h"
 
@@ -535,7 +535,8 @@ TimeTicks TimeTicks::Now() {
 }
 
 
-TimeTicks TimeTicks::HighResolutionNow() {
+// Current monotonic time in microseconds, from the operating system clock.
+static V8_INLINE int64_t SystemTicksNow() {
   int64_t ticks;
 #if V8_OS_MACOSX
   static struct mach_timebase_info info;
@@ -556,8 +557,97 @@ TimeTicks TimeTicks::HighResolutionNow() {
   ticks = (ts.tv_sec * Time::kMicrosecondsPerSecond +
            ts.tv_nsec / Time::kNanosecondsPerMicrosecond);
 #endif  // V8_OS_MACOSX
+  return ticks;
+}
+
+
+#if defined(__GNUC__) && !V8_OS_NACL && \
+    (V8_HOST_ARCH_IA32 || V8_HOST_ARCH_X64)
+#define V8_TIME_HAS_TSC_CLOCK 1
+
+static V8_INLINE uint64_t CpuTimestamp() {
+#if V8_HOST_ARCH_X64
+  uint64_t low, high;
+  __asm__ __volatile__("rdtsc" : "=a"(low), "=d"(high));
+  return (high << 32) | low;
+#else
+  uint64_t timestamp;
+  __asm__ __volatile__("rdtsc" : "=A"(timestamp));
+  return timestamp;
+#endif
+}
+
+
+// Clock based on the invariant time stamp counter, which modern x86 CPUs
+// keep running at a constant rate independent of frequency scaling and
+// sleep states. Reading it costs a couple of nanoseconds, against roughly
+// an order of magnitude more for the system clock, which makes heavy
+// instrumentation such as GC tracing cheap enough to leave enabled. The
+// counter frequency is not architecturally reported, so it is calibrated
+// against the system clock on first use; the residual calibration error is
+// well below a tenth of a percent, which is irrelevant for the interval
+// measurements this clock backs.
+class TSCTickClock {
+ public:
+  TSCTickClock() : ticks_per_microsecond_(0), base_timestamp_(0), base_us_(0) {
+    CPU cpu;
+    if (!cpu.has_invariant_tsc()) return;
+    Calibrate();
+  }
+
+  bool Available() { return ticks_per_microsecond_ != 0; }
+
+  int64_t Now() {
+    uint64_t elapsed = CpuTimestamp() - base_timestamp_;
+    return base_us_ + static_cast<int64_t>(elapsed / ticks_per_microsecond_);
+  }
+
+ private:
+  void Calibrate() {
+    // Sample (counter, system clock) pairs at both ends of a short sleep
+    // and derive the counter frequency from their differences. The sleep
+    // duration bounds the relative calibration error at roughly the system
+    // clock granularity divided by the duration.
+    static const int64_t kCalibrationUs = 10000;
+    uint64_t start_timestamp = CpuTimestamp();
+    int64_t start_us = SystemTicksNow();
+    struct timespec ts;
+    ts.tv_sec = 0;
+    ts.tv_nsec = kCalibrationUs * Time::kNanosecondsPerMicrosecond;
+    nanosleep(&ts, NULL);
+    uint64_t end_timestamp = CpuTimestamp();
+    int64_t end_us = SystemTicksNow();
+    if (end_us <= start_us || end_timestamp <= start_timestamp) return;
+    ticks_per_microsecond_ =
+        static_cast<double>(end_timestamp - start_timestamp) /
+        static_cast<double>(end_us - start_us);
+    base_timestamp_ = end_timestamp;
+    base_us_ = end_us;
+  }
+
+  double ticks_per_microsecond_;
+  uint64_t base_timestamp_;
+  int64_t base_us_;
+};
+
+
+static LazyStaticInstance<TSCTickClock, DefaultConstructTrait<TSCTickClock>,
+                          ThreadSafeInitOnceTrait>::type tsc_tick_clock =
+    LAZY_STATIC_INSTANCE_INITIALIZER;
+
+#endif  // defined(__GNUC__) && !V8_OS_NACL && ...
+
+
+TimeTicks TimeTicks::HighResolutionNow() {
+#if V8_TIME_HAS_TSC_CLOCK
+  TSCTickClock* clock = tsc_tick_clock.Pointer();
+  if (clock->Available()) {
+    // Make sure we never return 0 here.
+    return TimeTicks(clock->Now() + 1);
+  }
+#endif
   // Make sure we never return 0 here.
-  return TimeTicks(ticks + 1);
+  return TimeTicks(SystemTicksNow() + 1);
 }
 
 
@@ -65,6 +65,21 @@ BasicBlockProfiler::Data* BasicBlockProfiler::NewData(size_t n_blocks) {
 }
 
 
+BasicBlockProfiler::Data* BasicBlockProfiler::GetData(
+    const std::string& function_name, size_t n_blocks) {
+  // Entries are appended in compilation order, so the last match is the
+  // most recent profiling run of the function.
+  Data* result = NULL;
+  for (DataList::iterator i = data_list_.begin(); i != data_list_.end(); ++i) {
+    if ((*i)->function_name() == function_name &&
+        (*i)->n_blocks() == n_blocks) {
+      result = *i;
+    }
+  }
+  return result;
+}
+
+
 BasicBlockProfiler::~BasicBlockProfiler() {
   for (DataList::iterator i = data_list_.begin(); i != data_list_.end(); ++i) {
     delete (*i);
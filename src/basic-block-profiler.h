@@ -23,6 +23,8 @@ class BasicBlockProfiler {
    public:
     size_t n_blocks() const { return n_blocks_; }
     const uint32_t* counts() const { return &counts_[0]; }
+    const std::string& function_name() const { return function_name_; }
+    size_t block_id(size_t offset) const { return block_ids_[offset]; }
 
     void SetCode(std::ostringstream* os);
     void SetFunctionName(std::ostringstream* os);
@@ -57,6 +59,10 @@ class BasicBlockProfiler {
   Data* NewData(size_t n_blocks);
   void ResetCounts();
 
+  // Returns the most recent data recorded for a function with the given name
+  // and block count, or NULL if there is none.
+  Data* GetData(const std::string& function_name, size_t n_blocks);
+
   const DataList* data_list() { return &data_list_; }
 
  private:
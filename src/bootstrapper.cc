@@ -1621,6 +1621,8 @@ void Genesis::InstallNativeFunctions() {
   INSTALL_NATIVE(JSFunction, "$promiseChain", promise_chain);
   INSTALL_NATIVE(JSFunction, "$promiseCatch", promise_catch);
   INSTALL_NATIVE(JSFunction, "$promiseThen", promise_then);
+  INSTALL_NATIVE(JSFunction, "$promiseHandleReactions",
+                 promise_handle_reactions);
 
   INSTALL_NATIVE(JSFunction, "$observeNotifyChange", observers_notify_change);
   INSTALL_NATIVE(JSFunction, "$observeEnqueueSpliceRecord",
@@ -1683,14 +1685,16 @@ void Genesis::InitializeBuiltinTypedArrays() {
   Handle<JSBuiltinsObject> builtins(native_context()->builtins());
   {  // Initially seed the per-context random number generator using the
     // per-isolate random number generator.
-    const size_t num_elements = 2;
+    const size_t num_elements = 4;
     const size_t num_bytes = num_elements * sizeof(uint32_t);
     uint32_t* state = SetBuiltinTypedArray<uint32_t>(isolate(), builtins,
                                                      kExternalUint32Array, NULL,
                                                      num_elements, "rngstate");
     do {
       isolate()->random_number_generator()->NextBytes(state, num_bytes);
-    } while (state[0] == 0 || state[1] == 0);
+      // The all-zero state is the only fixed point of xorshift128.
+    } while (state[0] == 0 && state[1] == 0 && state[2] == 0 &&
+             state[3] == 0);
   }
 
   {  // Initialize trigonometric lookup tables and constants.
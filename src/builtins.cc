@@ -700,6 +700,22 @@ BUILTIN(ArraySlice) {
     }
   }
 
+  // A slice covering all of a fast smi or object array can share the
+  // receiver's backing store instead of copying it: convert the store to
+  // copy-on-write and reference it from both arrays. The copy is deferred
+  // until either array's elements are next written, through
+  // JSObject::EnsureWritableFastElements and the equivalent checks in
+  // generated code. Sub-range slices still copy eagerly, as copy-on-write
+  // covers whole FixedArrays only.
+  if (receiver->IsJSArray() && k == 0 && final == len && len > 0 &&
+      IsFastSmiOrObjectElementsKind(kind) && elms->length() >= len) {
+    if (elms->map() != heap->fixed_cow_array_map()) {
+      elms->set_map(heap->fixed_cow_array_map());
+      isolate->counters()->cow_arrays_created_runtime()->Increment();
+    }
+    return *isolate->factory()->NewJSArrayWithElements(elms, kind, len);
+  }
+
   Handle<JSArray> result_array =
       isolate->factory()->NewJSArray(kind, result_len, result_len);
 
@@ -939,6 +955,7 @@ BUILTIN(ArrayConcat) {
   int result_len = 0;
   ElementsKind elements_kind = GetInitialFastElementsKind();
   bool has_double = false;
+  int single_source = -1;
   {
     DisallowHeapAllocation no_gc;
     Heap* heap = isolate->heap();
@@ -963,6 +980,7 @@ BUILTIN(ArrayConcat) {
         return CallJsBuiltin(isolate, "$arrayConcat", args);
       }
       int len = Smi::cast(JSArray::cast(arg)->length())->value();
+      if (len > 0) single_source = (result_len == 0) ? i : -1;
 
       // We shouldn't overflow when adding another len.
       const int kHalfOfMaxInt = 1 << (kBitsPerInt - 2);
@@ -986,6 +1004,24 @@ BUILTIN(ArrayConcat) {
     if (is_holey) elements_kind = GetHoleyElementsKind(elements_kind);
   }
 
+  // A concat with a single non-empty argument produces a copy of that
+  // argument's elements. If they are a fast smi or object store, share them
+  // copy-on-write instead of copying, the same way a full ArraySlice does.
+  // This covers the common array.concat() cloning idiom.
+  if (single_source >= 0 && IsFastSmiOrObjectElementsKind(elements_kind)) {
+    Handle<JSArray> source(JSArray::cast(args[single_source]), isolate);
+    Handle<FixedArrayBase> source_elms(source->elements(), isolate);
+    if (source_elms->length() >= result_len) {
+      Heap* heap = isolate->heap();
+      if (source_elms->map() != heap->fixed_cow_array_map()) {
+        source_elms->set_map(heap->fixed_cow_array_map());
+        isolate->counters()->cow_arrays_created_runtime()->Increment();
+      }
+      return *isolate->factory()->NewJSArrayWithElements(
+          source_elms, elements_kind, result_len);
+    }
+  }
+
   // If a double array is concatted into a fast elements array, the fast
   // elements array needs to be initialized to contain proper holes, since
   // boxing doubles may cause incremental marking.
@@ -1096,6 +1132,39 @@ MUST_USE_RESULT static MaybeHandle<Object> HandleApiCallHelper(
     LOG(isolate, ApiObjectAccess("call", JSObject::cast(*args.receiver())));
     DCHECK(raw_holder->IsJSObject());
 
+    // If the embedder declared a fast-path handler and all arguments are
+    // numbers, call it with the unwrapped values and skip the callback-info
+    // setup entirely.  Calls that don't fit fall through to the regular
+    // callback below.
+    if (!is_construct && !call_data->fast_handler()->IsUndefined()) {
+      const int kMaxFastArguments = 8;
+      double fast_arguments[kMaxFastArguments];
+      int length = args.length() - 1;
+      bool all_numbers = length <= kMaxFastArguments;
+      for (int i = 0; all_numbers && i < length; i++) {
+        Object* arg = args[i + 1];
+        if (arg->IsNumber()) {
+          fast_arguments[i] = arg->Number();
+        } else {
+          all_numbers = false;
+        }
+      }
+      if (all_numbers) {
+        v8::PrimitiveFunctionCallback fast_handler =
+            v8::ToCData<v8::PrimitiveFunctionCallback>(
+                call_data->fast_handler());
+        double fast_result;
+        {
+          VMState<EXTERNAL> state(isolate);
+          ExternalCallbackScope call_scope(isolate,
+                                           FUNCTION_ADDR(fast_handler));
+          fast_result = fast_handler(fast_arguments, length);
+        }
+        Handle<Object> result = isolate->factory()->NewNumber(fast_result);
+        return scope.CloseAndEscape(result);
+      }
+    }
+
     FunctionCallbackArguments custom(isolate,
                                      data_obj,
                                      *function,
@@ -102,6 +102,13 @@ function SetConstructor(iterable) {
       throw MakeTypeError(kPropertyNotFunction, 'add', this);
     }
 
+    // An array's length is a good hint for the final table size; reserving
+    // it up front avoids rehashing through every intermediate capacity.
+    if (IS_ARRAY(iterable) && %_IsSmi(iterable.length) &&
+        iterable.length > 4) {
+      %SetReserveCapacity(this, iterable.length);
+    }
+
     for (var value of iterable) {
       %_CallFunction(this, value, adder);
     }
@@ -265,6 +272,13 @@ function MapConstructor(iterable) {
       throw MakeTypeError(kPropertyNotFunction, 'set', this);
     }
 
+    // An array's length is a good hint for the final table size; reserving
+    // it up front avoids rehashing through every intermediate capacity.
+    if (IS_ARRAY(iterable) && %_IsSmi(iterable.length) &&
+        iterable.length > 4) {
+      %MapReserveCapacity(this, iterable.length);
+    }
+
     for (var nextItem of iterable) {
       if (!IS_SPEC_OBJECT(nextItem)) {
         throw MakeTypeError(kIteratorValueNotAnObject, nextItem);
@@ -11,9 +11,19 @@ namespace v8 {
 namespace internal {
 
 
-// The number of generations for each sub cache.
+// The default number of generations for the regexp sub cache. The cache is
+// keyed by (pattern, flags) only and its entries are context-independent, so
+// embedders running many contexts with a shared set of patterns can raise
+// the retention with --regexp_compilation_cache_generations.
 static const int kRegExpGenerations = 2;
 
+static int RegExpGenerations() {
+  if (FLAG_regexp_compilation_cache_generations > 0) {
+    return FLAG_regexp_compilation_cache_generations;
+  }
+  return kRegExpGenerations;
+}
+
 // Initial size of each compilation cache table allocated.
 static const int kInitialCacheSize = 64;
 
@@ -23,7 +33,7 @@ CompilationCache::CompilationCache(Isolate* isolate)
       script_(isolate, 1),
       eval_global_(isolate, 1),
       eval_contextual_(isolate, 1),
-      reg_exp_(isolate, kRegExpGenerations),
+      reg_exp_(isolate, RegExpGenerations()),
       enabled_(true) {
   CompilationSubCache* subcaches[kSubCacheCount] =
     {&script_, &eval_global_, &eval_contextual_, &reg_exp_};
@@ -219,9 +229,11 @@ MaybeHandle<SharedFunctionInfo> CompilationCacheEval::Lookup(
       Put(source, outer_info, function_info, scope_position);
     }
     isolate()->counters()->compilation_cache_hits()->Increment();
+    isolate()->counters()->compilation_cache_eval_hits()->Increment();
     return scope.CloseAndEscape(function_info);
   } else {
     isolate()->counters()->compilation_cache_misses()->Increment();
+    isolate()->counters()->compilation_cache_eval_misses()->Increment();
     return MaybeHandle<SharedFunctionInfo>();
   }
 }
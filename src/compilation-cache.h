@@ -8,11 +8,16 @@
 namespace v8 {
 namespace internal {
 
-// The compilation cache consists of several generational sub-caches which uses
-// this class as a base class. A sub-cache contains a compilation cache tables
-// for each generation of the sub-cache. Since the same source code string has
+// The compilation cache consists of several sub-caches which use this class
+// as a base class. A sub-cache contains a compilation cache table for each
+// generation of the sub-cache. The script and eval sub-caches use a single
+// generation whose entries are aged individually: an entry survives as long
+// as its compiled code is still considered young, so hot scripts are not
+// evicted by the periodic sweep. Multi-generation sub-caches (regexp) age by
+// retiring the oldest table wholesale. Since the same source code string has
 // different compiled code for scripts and evals, we use separate sub-caches
 // for different compilation modes, to avoid retrieving the wrong result.
+// The tables are ordinary heap objects, so all access is main-thread only.
 class CompilationSubCache {
  public:
   CompilationSubCache(Isolate* isolate, int generations)
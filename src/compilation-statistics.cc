@@ -37,6 +37,18 @@ void CompilationStatistics::RecordPhaseKindStats(const char* phase_kind_name,
 }
 
 
+void CompilationStatistics::RecordReducerStats(const char* reducer_name,
+                                               const ReducerStats& stats) {
+  std::string reducer_name_str(reducer_name);
+  auto it = reducer_map_.find(reducer_name_str);
+  if (it == reducer_map_.end()) {
+    it = reducer_map_.insert(std::make_pair(reducer_name_str, ReducerStats()))
+             .first;
+  }
+  it->second.Accumulate(stats);
+}
+
+
 void CompilationStatistics::RecordTotalStats(size_t source_size,
                                              const BasicStats& stats) {
   source_size += source_size;
@@ -44,6 +56,14 @@ void CompilationStatistics::RecordTotalStats(size_t source_size,
 }
 
 
+void CompilationStatistics::ReducerStats::Accumulate(
+    const ReducerStats& stats) {
+  delta_ += stats.delta_;
+  visited_nodes_ += stats.visited_nodes_;
+  changed_nodes_ += stats.changed_nodes_;
+}
+
+
 void CompilationStatistics::BasicStats::Accumulate(const BasicStats& stats) {
   delta_ += stats.delta_;
   total_allocated_bytes_ += stats.total_allocated_bytes_;
@@ -82,6 +102,26 @@ static void WriteLine(std::ostream& os, const char* name,
 }
 
 
+static void WriteReducerLine(std::ostream& os, const char* name,
+                             const CompilationStatistics::ReducerStats& stats,
+                             const CompilationStatistics::BasicStats&
+                                 total_stats) {
+  const size_t kBufferSize = 128;
+  char buffer[kBufferSize];
+
+  double ms = stats.delta_.InMillisecondsF();
+  double percent = stats.delta_.PercentOf(total_stats.delta_);
+  base::OS::SNPrintF(buffer, kBufferSize,
+                     "%28s %10.3f ms / %5.1f %%"
+                     "%12u nodes %12u changed",
+                     name, ms, percent,
+                     static_cast<unsigned>(stats.visited_nodes_),
+                     static_cast<unsigned>(stats.changed_nodes_));
+
+  os << buffer << std::endl;
+}
+
+
 static void WriteFullLine(std::ostream& os) {
   os << "--------------------------------------------------------"
         "--------------------------------------------------------\n";
@@ -134,6 +174,17 @@ std::ostream& operator<<(std::ostream& os, const CompilationStatistics& s) {
     WriteLine(os, phase_kind_name.c_str(), phase_kind_stats, s.total_stats_);
     os << std::endl;
   }
+  if (!s.reducer_map_.empty()) {
+    WriteFullLine(os);
+    os << "                             Turbofan reducer statistics:\n";
+    WriteFullLine(os);
+    for (const auto& reducer_it : s.reducer_map_) {
+      WriteReducerLine(os, reducer_it.first.c_str(), reducer_it.second,
+                       s.total_stats_);
+    }
+    os << std::endl;
+  }
+
   WriteFullLine(os);
   WriteLine(os, "totals", s.total_stats_, s.total_stats_);
 
@@ -36,9 +36,22 @@ class CompilationStatistics final : public Malloced {
     std::string function_name_;
   };
 
+  class ReducerStats {
+   public:
+    ReducerStats() : visited_nodes_(0), changed_nodes_(0) {}
+
+    void Accumulate(const ReducerStats& stats);
+
+    base::TimeDelta delta_;
+    size_t visited_nodes_;
+    size_t changed_nodes_;
+  };
+
   void RecordPhaseStats(const char* phase_kind_name, const char* phase_name,
                         const BasicStats& stats);
 
+  void RecordReducerStats(const char* reducer_name, const ReducerStats& stats);
+
   void RecordPhaseKindStats(const char* phase_kind_name,
                             const BasicStats& stats);
 
@@ -70,10 +83,12 @@ class CompilationStatistics final : public Malloced {
   typedef OrderedStats PhaseKindStats;
   typedef std::map<std::string, PhaseKindStats> PhaseKindMap;
   typedef std::map<std::string, PhaseStats> PhaseMap;
+  typedef std::map<std::string, ReducerStats> ReducerMap;
 
   TotalStats total_stats_;
   PhaseKindMap phase_kind_map_;
   PhaseMap phase_map_;
+  ReducerMap reducer_map_;
 
   DISALLOW_COPY_AND_ASSIGN(CompilationStatistics);
 };
@@ -10,6 +10,7 @@
 #include "src/bootstrapper.h"
 #include "src/codegen.h"
 #include "src/compilation-cache.h"
+#include "src/compilation-statistics.h"
 #include "src/compiler/pipeline.h"
 #include "src/cpu-profiler.h"
 #include "src/debug.h"
@@ -155,11 +156,13 @@ CompilationInfo::CompilationInfo(ParseInfo* parse_info, CodeStub* code_stub,
       opt_count_(has_shared_info() ? shared_info()->opt_count() : 0),
       parameter_count_(0),
       optimization_id_(-1),
-      osr_expr_stack_height_(0) {}
+      osr_expr_stack_height_(0),
+      pipeline_(nullptr) {}
 
 
 CompilationInfo::~CompilationInfo() {
   DisableFutureOptimization();
+  delete pipeline_;
   delete deferred_handles_;
   delete no_frame_ranges_;
 #ifdef DEBUG
@@ -397,11 +400,15 @@ OptimizedCompileJob::Status OptimizedCompileJob::CreateGraph() {
     }
 
     Timer t(this, &time_taken_to_create_graph_);
-    compiler::Pipeline pipeline(info());
-    pipeline.GenerateCode();
-    if (!info()->code().is_null()) {
+    info()->set_pipeline(new compiler::Pipeline(info()));
+    if (info()->pipeline()->CreateGraph()) {
       return SetLastStatus(SUCCEEDED);
     }
+
+    // TurboFan bailed out during graph creation. Release the pipeline and
+    // fall back to Crankshaft below.
+    delete info()->pipeline();
+    info()->set_pipeline(NULL);
   }
 
   if (!isolate()->use_crankshaft()) {
@@ -473,17 +480,27 @@ OptimizedCompileJob::Status OptimizedCompileJob::CreateGraph() {
 
 
 OptimizedCompileJob::Status OptimizedCompileJob::OptimizeGraph() {
+  DCHECK(last_status() == SUCCEEDED);
+
+  if (info()->pipeline() != NULL) {
+    // TurboFan: run scheduling, instruction selection, register allocation
+    // and code assembly. The generated code stays in a detached assembler
+    // buffer until the GenerateCode phase allocates the code object, so
+    // this phase only reads the heap through deferred handles and can run
+    // on the concurrent recompilation thread.
+    DisallowCodeDependencyChange no_dependency_change;
+    Timer t(this, &time_taken_to_optimize_);
+    if (info()->pipeline()->OptimizeGraph()) {
+      return SetLastStatus(SUCCEEDED);
+    }
+    return SetLastStatus(BAILED_OUT);
+  }
+
   DisallowHeapAllocation no_allocation;
   DisallowHandleAllocation no_handles;
   DisallowHandleDereference no_deref;
   DisallowCodeDependencyChange no_dependency_change;
 
-  DCHECK(last_status() == SUCCEEDED);
-  // TODO(turbofan): Currently everything is done in the first phase.
-  if (!info()->code().is_null()) {
-    return last_status();
-  }
-
   Timer t(this, &time_taken_to_optimize_);
   DCHECK(graph_ != NULL);
   BailoutReason bailout_reason = kNoReason;
@@ -501,12 +518,26 @@ OptimizedCompileJob::Status OptimizedCompileJob::OptimizeGraph() {
 
 OptimizedCompileJob::Status OptimizedCompileJob::GenerateCode() {
   DCHECK(last_status() == SUCCEEDED);
-  // TODO(turbofan): Currently everything is done in the first phase.
-  if (!info()->code().is_null()) {
-    info()->dependencies()->Commit(info()->code());
+
+  if (info()->pipeline() != NULL) {
+    // TurboFan: allocate the code object for the assembled code and register
+    // the code dependencies. These steps touch the isolate's heap and must
+    // run on the main thread.
+    DCHECK(!info()->dependencies()->HasAborted());
+    DisallowCodeDependencyChange no_dependency_change;
+    DisallowJavascriptExecution no_js(isolate());
+    Timer timer(this, &time_taken_to_codegen_);
+    Handle<Code> optimized_code = info()->pipeline()->FinalizeCode();
+    if (optimized_code.is_null()) {
+      if (info()->bailout_reason() == kNoReason) {
+        return AbortOptimization(kCodeGenerationFailed);
+      }
+      return SetLastStatus(BAILED_OUT);
+    }
+    info()->dependencies()->Commit(optimized_code);
     if (FLAG_turbo_deoptimization) {
       info()->parse_info()->context()->native_context()->AddOptimizedCode(
-          *info()->code());
+          *optimized_code);
     }
     RecordOptimizationStats();
     return last_status();
@@ -878,6 +909,14 @@ MaybeHandle<Code> Compiler::GetLazyCode(Handle<JSFunction> function) {
   ASSIGN_RETURN_ON_EXCEPTION(isolate, result, GetUnoptimizedCodeCommon(&info),
                              Code);
 
+  if (function->shared()->was_flushed()) {
+    // This compilation only happened because the code flusher discarded
+    // the previous code; account for it so embedders can tune the code
+    // retention policy.
+    isolate->heap()->IncrementRecompiledCodeStatistics(result->CodeSize());
+    function->shared()->set_was_flushed(false);
+  }
+
   if (FLAG_always_opt) {
     Handle<Code> opt_code;
     if (Compiler::GetOptimizedCode(
@@ -1535,7 +1574,7 @@ bool Compiler::DebuggerWantsEagerCompilation(Isolate* isolate,
 
 CompilationPhase::CompilationPhase(const char* name, CompilationInfo* info)
     : name_(name), info_(info) {
-  if (FLAG_hydrogen_stats) {
+  if (FLAG_hydrogen_stats || FLAG_turbo_stats) {
     info_zone_start_allocation_size_ = info->zone()->allocation_size();
     timer_.Start();
   }
@@ -1543,10 +1582,29 @@ CompilationPhase::CompilationPhase(const char* name, CompilationInfo* info)
 
 
 CompilationPhase::~CompilationPhase() {
-  if (FLAG_hydrogen_stats) {
+  if (FLAG_hydrogen_stats || FLAG_turbo_stats) {
     size_t size = zone()->allocation_size();
     size += info_->zone()->allocation_size() - info_zone_start_allocation_size_;
-    isolate()->GetHStatistics()->SaveTiming(name_, timer_.Elapsed(), size);
+    base::TimeDelta delta = timer_.Elapsed();
+    if (FLAG_hydrogen_stats) {
+      isolate()->GetHStatistics()->SaveTiming(name_, delta, size);
+    }
+    if (FLAG_turbo_stats) {
+      // Record Crankshaft phases alongside the TurboFan phases, so that a
+      // single --turbo-stats report breaks down the costs of both compilers.
+      CompilationStatistics::BasicStats stats;
+      stats.delta_ = delta;
+      stats.total_allocated_bytes_ = size;
+      stats.max_allocated_bytes_ = size;
+      stats.absolute_max_allocated_bytes_ = size;
+      if (info_->has_shared_info()) {
+        SmartArrayPointer<char> name =
+            info_->shared_info()->DebugName()->ToCString();
+        stats.function_name_ = name.get();
+      }
+      isolate()->GetTurboStatistics()->RecordPhaseStats("Crankshaft", name_,
+                                                        stats);
+    }
   }
 }
 
@@ -19,6 +19,10 @@ class HydrogenCodeStub;
 class ParseInfo;
 class ScriptData;
 
+namespace compiler {
+class Pipeline;
+}
+
 struct OffsetRange {
   OffsetRange(int from, int to) : from(from), to(to) {}
   int from;
@@ -263,6 +267,12 @@ class CompilationInfo {
   }
   void SetCode(Handle<Code> code) { code_ = code; }
 
+  // The TurboFan pipeline for this compilation when optimization is run in
+  // phases (see OptimizedCompileJob). Owned by this info, so that the
+  // pipeline state is released on every disposal path.
+  compiler::Pipeline* pipeline() const { return pipeline_; }
+  void set_pipeline(compiler::Pipeline* pipeline) { pipeline_ = pipeline; }
+
   void MarkCompilingForDebugging() { SetFlag(kCompilingForDebugging); }
   bool IsCompilingForDebugging() { return GetFlag(kCompilingForDebugging); }
   void MarkNonOptimizable() {
@@ -476,6 +486,10 @@ class CompilationInfo {
 
   int osr_expr_stack_height_;
 
+  // The TurboFan pipeline when optimization is run in phases; see the
+  // pipeline() accessor above.
+  compiler::Pipeline* pipeline_;
+
   DISALLOW_COPY_AND_ASSIGN(CompilationInfo);
 };
 
@@ -0,0 +1,122 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/allocation-folding.h"
+
+#include "src/compiler/js-graph.h"
+#include "src/compiler/node-matchers.h"
+#include "src/compiler/node-properties.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+AllocationFolding::AllocationFolding(JSGraph* jsgraph, Zone* zone)
+    : jsgraph_(jsgraph), zone_(zone) {}
+
+
+AllocationFolding::~AllocationFolding() {}
+
+
+Graph* AllocationFolding::graph() const { return jsgraph()->graph(); }
+
+
+MachineOperatorBuilder* AllocationFolding::machine() const {
+  return jsgraph()->machine();
+}
+
+
+Reduction AllocationFolding::Reduce(Node* node) {
+  switch (node->opcode()) {
+    case IrOpcode::kAllocate:
+      return ReduceAllocate(node);
+    default:
+      break;
+  }
+  return NoChange();
+}
+
+
+namespace {
+
+// Returns true if {node} is a constant allocation size that keeps the object
+// in a regular (non large object) space, i.e. one that a folded group may
+// contain. Allocation sizes are always pointer size aligned.
+bool TryGetAllocationSize(Node* node, int* size) {
+  NumberMatcher m(node);
+  if (!m.HasValue()) return false;
+  double const value = m.Value();
+  if (value <= 0 || value > Page::kMaxRegularHeapObjectSize) return false;
+  int const aligned = static_cast<int>(value);
+  if (aligned != value || !IsAligned(aligned, kPointerSize)) return false;
+  *size = aligned;
+  return true;
+}
+
+
+bool HasSingleEffectUse(Node* node) {
+  int count = 0;
+  for (Edge edge : node->use_edges()) {
+    if (NodeProperties::IsEffectEdge(edge)) count++;
+  }
+  return count == 1;
+}
+
+}  // namespace
+
+
+Reduction AllocationFolding::ReduceAllocate(Node* node) {
+  DCHECK_EQ(IrOpcode::kAllocate, node->opcode());
+  int size;
+  if (!TryGetAllocationSize(node->InputAt(0), &size)) return NoChange();
+  PretenureFlag const pretenure = OpParameter<PretenureFlag>(node->op());
+  Node* const control = NodeProperties::GetControlInput(node);
+
+  // Walk up the effect chain looking for a dominating allocation to fold
+  // into. Only initializing loads and stores may sit between the two
+  // allocations and the chain must be straight; any other effect might
+  // contain a GC point that would observe the uninitialized reserved memory.
+  Node* dominator = NodeProperties::GetEffectInput(node);
+  while (true) {
+    if (!HasSingleEffectUse(dominator)) return NoChange();
+    if (dominator->opcode() == IrOpcode::kAllocate) break;
+    switch (dominator->opcode()) {
+      case IrOpcode::kLoadField:
+      case IrOpcode::kLoadElement:
+      case IrOpcode::kStoreField:
+      case IrOpcode::kStoreElement:
+        break;
+      default:
+        return NoChange();
+    }
+    dominator = NodeProperties::GetEffectInput(dominator);
+  }
+  if (NodeProperties::GetControlInput(dominator) != control) return NoChange();
+  if (OpParameter<PretenureFlag>(dominator->op()) != pretenure) {
+    return NoChange();
+  }
+  int reserved;
+  if (!TryGetAllocationSize(dominator->InputAt(0), &reserved)) {
+    return NoChange();
+  }
+  if (reserved + size > Page::kMaxRegularHeapObjectSize) return NoChange();
+
+  // Grow the dominating allocation by the folded size and replace the folded
+  // allocation with an interior pointer at the old end of the reservation.
+  // The bitcasts keep the final tagged pointer marked as a reference for the
+  // register allocator while the offset is added on the word level.
+  dominator->ReplaceInput(0, jsgraph()->Constant(reserved + size));
+  Node* const base =
+      graph()->NewNode(machine()->BitcastTaggedToWord(), dominator);
+  Node* const address = graph()->NewNode(machine()->IntAdd(), base,
+                                         jsgraph()->IntPtrConstant(reserved));
+  Node* const folded =
+      graph()->NewNode(machine()->BitcastWordToTagged(), address);
+  NodeProperties::ReplaceWithValue(node, folded);
+  return Replace(folded);
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
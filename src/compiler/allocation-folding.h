@@ -0,0 +1,49 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_ALLOCATION_FOLDING_H_
+#define V8_COMPILER_ALLOCATION_FOLDING_H_
+
+#include "src/compiler/graph-reducer.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Forward declarations.
+class Graph;
+class JSGraph;
+class MachineOperatorBuilder;
+
+// Folds an allocation into a dominating allocation of the same space when
+// only initializing loads and stores sit between the two on a straight
+// effect chain. The dominating allocation is grown by the folded size and
+// the folded allocation is replaced with an interior pointer into the
+// reserved memory, saving one allocation call per folded object. Since no
+// GC point can run between the group members, the reserved memory is
+// always initialized before it can be observed by the garbage collector.
+class AllocationFolding final : public Reducer {
+ public:
+  AllocationFolding(JSGraph* jsgraph, Zone* zone);
+  ~AllocationFolding() final;
+
+  Reduction Reduce(Node* node) final;
+
+ private:
+  Reduction ReduceAllocate(Node* node);
+
+  Graph* graph() const;
+  JSGraph* jsgraph() const { return jsgraph_; }
+  MachineOperatorBuilder* machine() const;
+  Zone* zone() const { return zone_; }
+
+  JSGraph* const jsgraph_;
+  Zone* const zone_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_ALLOCATION_FOLDING_H_
@@ -0,0 +1,122 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/instruction-scheduler.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+int InstructionScheduler::GetTargetInstructionFlags(
+    const Instruction* instr) const {
+  switch (instr->arch_opcode()) {
+    case kArmLdr:
+    case kArmLdrb:
+    case kArmLdrsb:
+    case kArmLdrh:
+    case kArmLdrsh:
+    case kArmVldrF32:
+    case kArmVldrF64:
+      return kIsLoadOperation;
+
+    case kArmStr:
+    case kArmStrb:
+    case kArmStrh:
+    case kArmVstrF32:
+    case kArmVstrF64:
+      return kHasSideEffect;
+
+    case kArmPush:
+      // Adjusts the stack pointer, which later slot accesses may implicitly
+      // depend on.
+      return kIsBarrier;
+
+    case kArmStoreWriteBarrier:
+      // May call the record write stub and clobber registers.
+      return kIsBarrier;
+
+    default:
+      // The remaining target instructions are pure register computations.
+      return kNoOpcodeFlags;
+  }
+}
+
+
+// Approximate latencies of a Cortex-A53 class in-order core, in cycles.
+int InstructionScheduler::GetTargetInstructionLatency(
+    const Instruction* instr) const {
+  switch (instr->arch_opcode()) {
+    case kArmLdr:
+    case kArmLdrb:
+    case kArmLdrsb:
+    case kArmLdrh:
+    case kArmLdrsh:
+      return 3;
+
+    case kArmVldrF32:
+    case kArmVldrF64:
+      return 4;
+
+    case kArmMul:
+    case kArmMla:
+    case kArmMls:
+    case kArmSmmul:
+    case kArmSmmla:
+    case kArmUmull:
+      return 3;
+
+    case kArmSdiv:
+    case kArmUdiv:
+      return 8;
+
+    case kArmVaddF32:
+    case kArmVsubF32:
+    case kArmVcmpF32:
+    case kArmVabsF32:
+    case kArmVnegF32:
+    case kArmVaddF64:
+    case kArmVsubF64:
+    case kArmVcmpF64:
+    case kArmVabsF64:
+    case kArmVnegF64:
+      return 3;
+
+    case kArmVmulF32:
+    case kArmVmlaF32:
+    case kArmVmlsF32:
+    case kArmVmulF64:
+    case kArmVmlaF64:
+    case kArmVmlsF64:
+      return 4;
+
+    case kArmVdivF32:
+      return 12;
+    case kArmVdivF64:
+      return 22;
+
+    case kArmVsqrtF32:
+      return 12;
+    case kArmVsqrtF64:
+      return 22;
+
+    case kArmVcvtF32F64:
+    case kArmVcvtF64F32:
+    case kArmVcvtF64S32:
+    case kArmVcvtF64U32:
+    case kArmVcvtS32F64:
+    case kArmVcvtU32F64:
+    case kArmVrintmF64:
+    case kArmVrintpF64:
+    case kArmVrintzF64:
+    case kArmVrintaF64:
+      return 4;
+
+    default:
+      return 1;
+  }
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -1141,10 +1141,7 @@ void InstructionSelector::VisitTailCall(Node* node) {
   DCHECK_EQ(0, descriptor->flags() & CallDescriptor::kPatchableCallSite);
   DCHECK_EQ(0, descriptor->flags() & CallDescriptor::kNeedsNopAfterCall);
 
-  // TODO(turbofan): Relax restriction for stack parameters.
-  if (descriptor->UsesOnlyRegisters() &&
-      descriptor->HasSameReturnLocationsAs(
-          linkage()->GetIncomingDescriptor())) {
+  if (linkage()->GetIncomingDescriptor()->CanTailCall(node)) {
     CallBuffer buffer(zone(), descriptor, nullptr);
 
     // Compute InstructionOperands for inputs and outputs.
@@ -1153,8 +1150,6 @@ void InstructionSelector::VisitTailCall(Node* node) {
     // heuristics in the register allocator for where to emit constants.
     InitializeCallBuffer(node, &buffer, true, false);
 
-    DCHECK_EQ(0u, buffer.pushed_nodes.size());
-
     // Select the appropriate opcode based on the call type.
     InstructionCode opcode;
     switch (descriptor->kind()) {
@@ -1590,6 +1585,30 @@ void InstructionSelector::VisitFloat64InsertHighWord32(Node* node) {
 }
 
 
+void InstructionSelector::VisitFloat32x4Add(Node* node) { UNREACHABLE(); }
+
+
+void InstructionSelector::VisitFloat32x4Sub(Node* node) { UNREACHABLE(); }
+
+
+void InstructionSelector::VisitFloat32x4Mul(Node* node) { UNREACHABLE(); }
+
+
+void InstructionSelector::VisitFloat32x4Div(Node* node) { UNREACHABLE(); }
+
+
+void InstructionSelector::VisitInt32x4Add(Node* node) { UNREACHABLE(); }
+
+
+void InstructionSelector::VisitInt32x4Sub(Node* node) { UNREACHABLE(); }
+
+
+void InstructionSelector::VisitWord32Select(Node* node) { UNREACHABLE(); }
+
+
+void InstructionSelector::VisitWord64Select(Node* node) { UNREACHABLE(); }
+
+
 // static
 MachineOperatorBuilder::Flags
 InstructionSelector::SupportedMachineOperatorFlags() {
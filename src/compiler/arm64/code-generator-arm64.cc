@@ -689,6 +689,16 @@ void CodeGenerator::AssembleArchInstruction(Instruction* instr) {
     case kArm64Cmp32:
       __ Cmp(i.InputRegister32(0), i.InputOperand32(1));
       break;
+    case kArm64Csel:
+      __ Cmp(i.InputRegister32(0), 0);
+      __ Csel(i.OutputRegister64(), i.InputRegister64(1), i.InputRegister64(2),
+              ne);
+      break;
+    case kArm64Csel32:
+      __ Cmp(i.InputRegister32(0), 0);
+      __ Csel(i.OutputRegister32(), i.InputRegister32(1), i.InputRegister32(2),
+              ne);
+      break;
     case kArm64Cmn:
       __ Cmn(i.InputRegister(0), i.InputOperand(1));
       break;
@@ -21,6 +21,8 @@ namespace compiler {
   V(Arm64Clz32)                    \
   V(Arm64Cmp)                      \
   V(Arm64Cmp32)                    \
+  V(Arm64Csel)                     \
+  V(Arm64Csel32)                   \
   V(Arm64Cmn)                      \
   V(Arm64Cmn32)                    \
   V(Arm64Tst)                      \
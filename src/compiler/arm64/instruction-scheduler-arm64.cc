@@ -0,0 +1,141 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/instruction-scheduler.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+int InstructionScheduler::GetTargetInstructionFlags(
+    const Instruction* instr) const {
+  switch (instr->arch_opcode()) {
+    case kArm64Ldr:
+    case kArm64LdrW:
+    case kArm64LdrS:
+    case kArm64LdrD:
+    case kArm64Ldrb:
+    case kArm64Ldrsb:
+    case kArm64Ldrh:
+    case kArm64Ldrsh:
+      return kIsLoadOperation;
+
+    case kArm64Str:
+    case kArm64StrW:
+    case kArm64StrS:
+    case kArm64StrD:
+    case kArm64Strb:
+    case kArm64Strh:
+      return kHasSideEffect;
+
+    case kArm64Claim:
+    case kArm64Poke:
+    case kArm64PokePair:
+      // Adjust or write relative to the stack pointer.
+      return kIsBarrier;
+
+    case kArm64StoreWriteBarrier:
+      // May call the record write stub and clobber registers.
+      return kIsBarrier;
+
+    case kArm64TestAndBranch:
+    case kArm64TestAndBranch32:
+    case kArm64CompareAndBranch32:
+      return kIsBlockTerminator;
+
+    default:
+      // The remaining target instructions are pure register computations.
+      return kNoOpcodeFlags;
+  }
+}
+
+
+// Approximate latencies of a Cortex-A53 class in-order core, in cycles.
+int InstructionScheduler::GetTargetInstructionLatency(
+    const Instruction* instr) const {
+  switch (instr->arch_opcode()) {
+    case kArm64Ldr:
+    case kArm64LdrW:
+    case kArm64Ldrb:
+    case kArm64Ldrsb:
+    case kArm64Ldrh:
+    case kArm64Ldrsh:
+      return 3;
+
+    case kArm64LdrS:
+    case kArm64LdrD:
+      return 4;
+
+    case kArm64Mul:
+    case kArm64Mul32:
+    case kArm64Smull:
+    case kArm64Umull:
+    case kArm64Madd:
+    case kArm64Madd32:
+    case kArm64Msub:
+    case kArm64Msub32:
+    case kArm64Mneg:
+    case kArm64Mneg32:
+      return 3;
+
+    case kArm64Idiv32:
+    case kArm64Udiv32:
+    case kArm64Imod32:
+    case kArm64Umod32:
+      return 8;
+    case kArm64Idiv:
+    case kArm64Udiv:
+    case kArm64Imod:
+    case kArm64Umod:
+      return 16;
+
+    case kArm64Float32Add:
+    case kArm64Float32Sub:
+    case kArm64Float32Cmp:
+    case kArm64Float32Max:
+    case kArm64Float32Min:
+    case kArm64Float32Abs:
+    case kArm64Float64Add:
+    case kArm64Float64Sub:
+    case kArm64Float64Cmp:
+    case kArm64Float64Max:
+    case kArm64Float64Min:
+    case kArm64Float64Abs:
+    case kArm64Float64Neg:
+      return 3;
+
+    case kArm64Float32Mul:
+    case kArm64Float64Mul:
+      return 4;
+
+    case kArm64Float32Div:
+      return 12;
+    case kArm64Float64Div:
+      return 22;
+
+    case kArm64Float32Sqrt:
+      return 12;
+    case kArm64Float64Sqrt:
+      return 22;
+
+    case kArm64Float32ToFloat64:
+    case kArm64Float64ToFloat32:
+    case kArm64Float64ToInt32:
+    case kArm64Float64ToUint32:
+    case kArm64Int32ToFloat64:
+    case kArm64Uint32ToFloat64:
+    case kArm64Float64RoundDown:
+    case kArm64Float64RoundTiesAway:
+    case kArm64Float64RoundTruncate:
+    case kArm64Float64RoundUp:
+      return 4;
+
+    default:
+      return 1;
+  }
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
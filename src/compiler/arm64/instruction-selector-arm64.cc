@@ -1311,10 +1311,7 @@ void InstructionSelector::VisitTailCall(Node* node) {
   DCHECK_EQ(0, descriptor->flags() & CallDescriptor::kPatchableCallSite);
   DCHECK_EQ(0, descriptor->flags() & CallDescriptor::kNeedsNopAfterCall);
 
-  // TODO(turbofan): Relax restriction for stack parameters.
-  if (descriptor->UsesOnlyRegisters() &&
-      descriptor->HasSameReturnLocationsAs(
-          linkage()->GetIncomingDescriptor())) {
+  if (linkage()->GetIncomingDescriptor()->CanTailCall(node)) {
     CallBuffer buffer(zone(), descriptor, nullptr);
 
     // Compute InstructionOperands for inputs and outputs.
@@ -1323,8 +1320,6 @@ void InstructionSelector::VisitTailCall(Node* node) {
     // heuristics in the register allocator for where to emit constants.
     InitializeCallBuffer(node, &buffer, true, false);
 
-    DCHECK_EQ(0u, buffer.pushed_nodes.size());
-
     // Select the appropriate opcode based on the call type.
     InstructionCode opcode;
     switch (descriptor->kind()) {
@@ -1889,6 +1884,38 @@ void InstructionSelector::VisitFloat64InsertHighWord32(Node* node) {
 }
 
 
+void InstructionSelector::VisitFloat32x4Add(Node* node) { UNREACHABLE(); }
+
+
+void InstructionSelector::VisitFloat32x4Sub(Node* node) { UNREACHABLE(); }
+
+
+void InstructionSelector::VisitFloat32x4Mul(Node* node) { UNREACHABLE(); }
+
+
+void InstructionSelector::VisitFloat32x4Div(Node* node) { UNREACHABLE(); }
+
+
+void InstructionSelector::VisitInt32x4Add(Node* node) { UNREACHABLE(); }
+
+
+void InstructionSelector::VisitInt32x4Sub(Node* node) { UNREACHABLE(); }
+
+
+void InstructionSelector::VisitWord32Select(Node* node) {
+  Arm64OperandGenerator g(this);
+  Emit(kArm64Csel32, g.DefineAsRegister(node), g.UseRegister(node->InputAt(0)),
+       g.UseRegister(node->InputAt(1)), g.UseRegister(node->InputAt(2)));
+}
+
+
+void InstructionSelector::VisitWord64Select(Node* node) {
+  Arm64OperandGenerator g(this);
+  Emit(kArm64Csel, g.DefineAsRegister(node), g.UseRegister(node->InputAt(0)),
+       g.UseRegister(node->InputAt(1)), g.UseRegister(node->InputAt(2)));
+}
+
+
 // static
 MachineOperatorBuilder::Flags
 InstructionSelector::SupportedMachineOperatorFlags() {
@@ -1900,6 +1927,8 @@ InstructionSelector::SupportedMachineOperatorFlags() {
          MachineOperatorBuilder::kFloat64RoundTruncate |
          MachineOperatorBuilder::kFloat64RoundTiesAway |
          MachineOperatorBuilder::kWord32ShiftIsSafe |
+         MachineOperatorBuilder::kWord32Select |
+         MachineOperatorBuilder::kWord64Select |
          MachineOperatorBuilder::kInt32DivIsSafe |
          MachineOperatorBuilder::kUint32DivIsSafe;
 }
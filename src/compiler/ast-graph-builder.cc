@@ -812,12 +812,22 @@ Node* AstGraphBuilder::Environment::Checkpoint(
 
   const Operator* op = common()->FrameState(JS_FRAME, ast_id, combine);
 
-  Node* result = graph()->NewNode(op, parameters_node_, locals_node_,
-                                  stack_node_, builder()->current_context(),
-                                  builder()->GetFunctionClosure(),
-                                  builder()->jsgraph()->UndefinedConstant());
+  Node* inputs[] = {parameters_node_,
+                    locals_node_,
+                    stack_node_,
+                    builder()->current_context(),
+                    builder()->GetFunctionClosure(),
+                    builder()->jsgraph()->UndefinedConstant()};
+  Node* result;
   if (FLAG_analyze_environment_liveness) {
+    // The liveness analysis rewrites the locals input of each frame state
+    // according to its position in the control flow, so checkpoints must stay
+    // distinct nodes even when their contents coincide.
+    result = graph()->NewNode(op, arraysize(inputs), inputs);
     liveness_block()->Checkpoint(result);
+  } else {
+    result = builder()->state_values_cache_.GetFrameStateNode(op, inputs,
+                                                              arraysize(inputs));
   }
   return result;
 }
@@ -1584,55 +1594,73 @@ void AstGraphBuilder::VisitClassLiteralContents(ClassLiteral* expr) {
   environment()->Push(literal);
   environment()->Push(proto);
 
-  // Create nodes to store method values into the literal.
-  for (int i = 0; i < expr->properties()->length(); i++) {
-    ObjectLiteral::Property* property = expr->properties()->at(i);
-    environment()->Push(property->is_static() ? literal : proto);
-
-    VisitForValue(property->key());
-    Node* name = BuildToName(environment()->Pop(), expr->GetIdForProperty(i));
-    environment()->Push(name);
-
-    // The static prototype property is read only. We handle the non computed
-    // property name case in the parser. Since this is the only case where we
-    // need to check for an own read only property we special case this so we do
-    // not need to do this for every property.
-    if (property->is_static() && property->is_computed_name()) {
-      Node* check = BuildThrowIfStaticPrototype(environment()->Pop(),
-                                                expr->GetIdForProperty(i));
-      environment()->Push(check);
+  // When the class body consists only of plain prototype methods, install
+  // the whole method table with a single runtime call.
+  if (expr->HasOnlySimpleMethods()) {
+    environment()->Push(proto);
+    for (int i = 0; i < expr->properties()->length(); i++) {
+      ObjectLiteral::Property* property = expr->properties()->at(i);
+      VisitForValue(property->key());
+      Node* name = BuildToName(environment()->Pop(), expr->GetIdForProperty(i));
+      environment()->Push(name);
+      VisitForValue(property->value());
+      BuildSetHomeObject(environment()->Top(), proto, property->value());
     }
+    int argc = 2 * expr->properties()->length() + 1;
+    const Operator* op =
+        javascript()->CallRuntime(Runtime::kDefineClassMethods, argc);
+    ProcessArguments(op, argc);
+  } else {
+    // Create nodes to store method values into the literal.
+    for (int i = 0; i < expr->properties()->length(); i++) {
+      ObjectLiteral::Property* property = expr->properties()->at(i);
+      environment()->Push(property->is_static() ? literal : proto);
 
-    VisitForValue(property->value());
-    Node* value = environment()->Pop();
-    Node* key = environment()->Pop();
-    Node* receiver = environment()->Pop();
-    BuildSetHomeObject(value, receiver, property->value());
-
-    switch (property->kind()) {
-      case ObjectLiteral::Property::CONSTANT:
-      case ObjectLiteral::Property::MATERIALIZED_LITERAL:
-      case ObjectLiteral::Property::PROTOTYPE:
-        UNREACHABLE();
-      case ObjectLiteral::Property::COMPUTED: {
-        const Operator* op =
-            javascript()->CallRuntime(Runtime::kDefineClassMethod, 3);
-        NewNode(op, receiver, key, value);
-        break;
-      }
-      case ObjectLiteral::Property::GETTER: {
-        Node* attr = jsgraph()->Constant(DONT_ENUM);
-        const Operator* op = javascript()->CallRuntime(
-            Runtime::kDefineGetterPropertyUnchecked, 4);
-        NewNode(op, receiver, key, value, attr);
-        break;
+      VisitForValue(property->key());
+      Node* name = BuildToName(environment()->Pop(), expr->GetIdForProperty(i));
+      environment()->Push(name);
+
+      // The static prototype property is read only. We handle the non
+      // computed property name case in the parser. Since this is the only
+      // case where we need to check for an own read only property we special
+      // case this so we do not need to do this for every property.
+      if (property->is_static() && property->is_computed_name()) {
+        Node* check = BuildThrowIfStaticPrototype(environment()->Pop(),
+                                                  expr->GetIdForProperty(i));
+        environment()->Push(check);
       }
-      case ObjectLiteral::Property::SETTER: {
-        Node* attr = jsgraph()->Constant(DONT_ENUM);
-        const Operator* op = javascript()->CallRuntime(
-            Runtime::kDefineSetterPropertyUnchecked, 4);
-        NewNode(op, receiver, key, value, attr);
-        break;
+
+      VisitForValue(property->value());
+      Node* value = environment()->Pop();
+      Node* key = environment()->Pop();
+      Node* receiver = environment()->Pop();
+      BuildSetHomeObject(value, receiver, property->value());
+
+      switch (property->kind()) {
+        case ObjectLiteral::Property::CONSTANT:
+        case ObjectLiteral::Property::MATERIALIZED_LITERAL:
+        case ObjectLiteral::Property::PROTOTYPE:
+          UNREACHABLE();
+        case ObjectLiteral::Property::COMPUTED: {
+          const Operator* op =
+              javascript()->CallRuntime(Runtime::kDefineClassMethod, 3);
+          NewNode(op, receiver, key, value);
+          break;
+        }
+        case ObjectLiteral::Property::GETTER: {
+          Node* attr = jsgraph()->Constant(DONT_ENUM);
+          const Operator* op = javascript()->CallRuntime(
+              Runtime::kDefineGetterPropertyUnchecked, 4);
+          NewNode(op, receiver, key, value, attr);
+          break;
+        }
+        case ObjectLiteral::Property::SETTER: {
+          Node* attr = jsgraph()->Constant(DONT_ENUM);
+          const Operator* op = javascript()->CallRuntime(
+              Runtime::kDefineSetterPropertyUnchecked, 4);
+          NewNode(op, receiver, key, value, attr);
+          break;
+        }
       }
     }
   }
@@ -2269,8 +2297,12 @@ void AstGraphBuilder::VisitCall(Call* expr) {
   }
 
   // Create node to perform the function call.
-  const Operator* call =
-      javascript()->CallFunction(args->length() + 2, flags, language_mode());
+  VectorSlotPair feedback =
+      expr->IsUsingCallFeedbackICSlot(isolate())
+          ? CreateVectorSlotPair(expr->CallFeedbackICSlot())
+          : VectorSlotPair();
+  const Operator* call = javascript()->CallFunction(args->length() + 2, flags,
+                                                    language_mode(), feedback);
   Node* value = ProcessArguments(call, args->length() + 2);
   PrepareFrameState(value, expr->id(), ast_context()->GetStateCombine());
   ast_context()->ProduceValue(value);
@@ -101,6 +101,38 @@ BasicBlockProfiler::Data* BasicBlockInstrumentor::Instrument(
   return data;
 }
 
+void BasicBlockInstrumentor::MarkColdBlocks(CompilationInfo* info,
+                                            Schedule* schedule) {
+  BasicBlockProfiler* profiler = info->isolate()->basic_block_profiler();
+  if (profiler == NULL) return;
+  std::string function_name;
+  if (info->has_shared_info() && info->shared_info()->name()->IsString()) {
+    std::ostringstream os;
+    String::cast(info->shared_info()->name())->PrintUC16(os);
+    function_name = os.str();
+  }
+  size_t n_blocks = static_cast<size_t>(schedule->RpoBlockCount()) - 1;
+  BasicBlockProfiler::Data* data = profiler->GetData(function_name, n_blocks);
+  if (data == NULL) return;
+  // The profile is stale if the block structure changed since the profiling
+  // run; require the recorded block ids to match the new schedule.
+  BasicBlockVector* blocks = schedule->rpo_order();
+  size_t block_number = 0;
+  for (BasicBlockVector::iterator it = blocks->begin(); block_number < n_blocks;
+       ++it, ++block_number) {
+    if ((*it)->id().ToSize() != data->block_id(block_number)) return;
+  }
+  // Mark the blocks that were never executed as deferred, except for the
+  // entry block, which must stay hot no matter what the counters say.
+  block_number = 0;
+  for (BasicBlockVector::iterator it = blocks->begin(); block_number < n_blocks;
+       ++it, ++block_number) {
+    if (block_number != 0 && data->counts()[block_number] == 0) {
+      (*it)->set_deferred(true);
+    }
+  }
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
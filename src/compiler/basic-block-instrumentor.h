@@ -21,6 +21,12 @@ class BasicBlockInstrumentor : public AllStatic {
  public:
   static BasicBlockProfiler::Data* Instrument(CompilationInfo* info,
                                               Graph* graph, Schedule* schedule);
+
+  // Feeds the block counts collected by a previous profiling run of the same
+  // function back into the schedule: blocks that were never executed are
+  // marked as deferred, so that the code generator moves them out of the hot
+  // instruction stream. Does nothing if no matching profile data is found.
+  static void MarkColdBlocks(CompilationInfo* info, Schedule* schedule);
 };
 
 }  // namespace compiler
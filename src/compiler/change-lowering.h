@@ -23,6 +23,8 @@ class ChangeLowering final : public Reducer {
   explicit ChangeLowering(JSGraph* jsgraph) : jsgraph_(jsgraph) {}
   ~ChangeLowering() final;
 
+  const char* reducer_name() const final { return "ChangeLowering"; }
+
   Reduction Reduce(Node* node) final;
 
  private:
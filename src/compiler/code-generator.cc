@@ -56,7 +56,7 @@ CodeGenerator::CodeGenerator(Frame* frame, Linkage* linkage,
 }
 
 
-Handle<Code> CodeGenerator::GenerateCode() {
+void CodeGenerator::AssembleCode() {
   CompilationInfo* info = this->info();
 
   // Emit a code line info recording start event.
@@ -128,13 +128,18 @@ Handle<Code> CodeGenerator::GenerateCode() {
     }
   }
 
-  safepoints()->Emit(masm(), frame()->GetSpillSlotCount());
+  safepoints()->Emit(isolate(), frame()->GetSpillSlotCount());
+}
+
+
+Handle<Code> CodeGenerator::FinalizeCode() {
+  CompilationInfo* info = this->info();
 
   Handle<Code> result = v8::internal::CodeGenerator::MakeCodeEpilogue(
       masm(), info->flags(), info);
   result->set_is_turbofanned(true);
   result->set_stack_slots(frame()->GetSpillSlotCount());
-  result->set_safepoint_table_offset(safepoints()->GetCodeOffset());
+  result->set_safepoint_table(*safepoints()->GetSafepointTable());
 
   // Emit exception handler table.
   if (!handlers_.empty()) {
@@ -157,7 +162,7 @@ Handle<Code> CodeGenerator::GenerateCode() {
   }
 
   // Emit a code line info recording stop event.
-  void* line_info = recorder->DetachJITHandlerData();
+  void* line_info = masm()->positions_recorder()->DetachJITHandlerData();
   LOG_CODE_EVENT(isolate(), CodeEndLinePosInfoRecordEvent(*result, line_info));
 
   return result;
@@ -522,10 +527,12 @@ int CodeGenerator::BuildTranslation(Instruction* instr, int pc_offset,
   BuildTranslationForFrameStateDescriptor(descriptor, instr, &translation,
                                           frame_state_offset, state_combine);
 
+  int translation_index =
+      translations_.CommitEntry(translation.index(), zone());
   int deoptimization_id = static_cast<int>(deoptimization_states_.size());
 
   deoptimization_states_.push_back(new (zone()) DeoptimizationState(
-      descriptor->bailout_id(), translation.index(), pc_offset));
+      descriptor->bailout_id(), translation_index, pc_offset));
 
   return deoptimization_id;
 }
@@ -33,8 +33,15 @@ class CodeGenerator final : public GapResolver::Assembler {
   explicit CodeGenerator(Frame* frame, Linkage* linkage,
                          InstructionSequence* code, CompilationInfo* info);
 
-  // Generate native code.
-  Handle<Code> GenerateCode();
+  // Assemble native code for the instruction sequence into the assembler's
+  // buffer. This does not allocate anything on the isolate's heap and can
+  // therefore run away from the main thread.
+  void AssembleCode();
+
+  // Allocate a code object for the assembled code and attach the metadata
+  // tables (safepoints, handlers and deoptimization information) to it.
+  // Must run on the main thread.
+  Handle<Code> FinalizeCode();
 
   InstructionSequence* code() const { return code_; }
   Frame* frame() const { return frame_; }
@@ -25,6 +25,8 @@ class CommonOperatorReducer final : public Reducer {
   explicit CommonOperatorReducer(JSGraph* jsgraph) : jsgraph_(jsgraph) {}
   ~CommonOperatorReducer() final {}
 
+  const char* reducer_name() const final { return "CommonOperatorReducer"; }
+
   Reduction Reduce(Node* node) final;
 
  private:
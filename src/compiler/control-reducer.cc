@@ -64,9 +64,13 @@ class ControlReducerImpl final : public AdvancedReducer {
   CommonOperatorBuilder* common() { return jsgraph_->common(); }
   Node* dead() { return jsgraph_->DeadControl(); }
 
-  // Finish reducing the graph by trimming nodes and/or connecting NTLs.
-  bool Finish() final {
-    bool done = true;
+  const char* reducer_name() const final { return "ControlReducer"; }
+
+  // Finish reducing the graph by trimming nodes and/or connecting NTLs. Any
+  // affected nodes are enqueued for revisitation, so that reduction reaches
+  // a fixpoint without re-reducing stable parts of the graph.
+  void Finalize() final {
+    bool connected_ntls = false;
     // Gather all nodes backwards-reachable from end (through inputs).
     ReachabilityMarker marked(graph());
     NodeVector nodes(zone_);
@@ -100,6 +104,7 @@ class ControlReducerImpl final : public AdvancedReducer {
             nodes.push_back(added);
             marked.SetReachableFromEnd(added);
             AddBackwardsReachableNodes(marked, nodes, nodes.size() - 1);
+            connected_ntls = true;
 
             // Reset the use iterators for the entire stack.
             for (size_t i = 0; i < fw_stack.size(); i++) {
@@ -139,12 +144,15 @@ class ControlReducerImpl final : public AdvancedReducer {
           !marked.IsReachableFromStart(node) &&
           node->opcode() != IrOpcode::kDead) {
         TRACE("Dead: #%d:%s\n", node->id(), node->op()->mnemonic());
+        // Re-reduce the uses once they point to {dead}.
+        for (Edge edge : node->use_edges()) Revisit(edge.from());
         node->ReplaceUses(dead());
-        done = false;
       }
     }
 
-    return done;
+    // Re-reduce the end node and recurse into the nodes that any connected
+    // NTLs added to it.
+    if (connected_ntls) Revisit(graph()->end());
   }
 
   // Connect {loop}, the header of a non-terminating loop, to the end node.
@@ -0,0 +1,152 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/escape-analysis.h"
+
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "src/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+EscapeAnalysis::EscapeAnalysis(Zone* zone) : zone_(zone) {}
+
+
+EscapeAnalysis::~EscapeAnalysis() {}
+
+
+Reduction EscapeAnalysis::Reduce(Node* node) {
+  switch (node->opcode()) {
+    case IrOpcode::kAllocate:
+      return ReduceAllocate(node);
+    default:
+      break;
+  }
+  return NoChange();
+}
+
+
+Reduction EscapeAnalysis::ReduceAllocate(Node* node) {
+  DCHECK_EQ(IrOpcode::kAllocate, node->opcode());
+  if (AllocationEscapes(node)) return NoChange();
+
+  // Collect the field accesses on the allocation; also serves as a guard
+  // against re-reducing an allocation that was already scalar replaced.
+  ZoneVector<Node*> loads(zone());
+  ZoneVector<Node*> stores(zone());
+  for (Edge edge : node->use_edges()) {
+    if (!NodeProperties::IsValueEdge(edge)) continue;
+    Node* const use = edge.from();
+    if (use->opcode() == IrOpcode::kLoadField) {
+      loads.push_back(use);
+    } else {
+      DCHECK_EQ(IrOpcode::kStoreField, use->opcode());
+      stores.push_back(use);
+    }
+  }
+  if (loads.empty() && stores.empty()) return NoChange();
+
+  // Make sure every load can be resolved to a dominating store before
+  // rewriting anything.
+  for (Node* const load : loads) {
+    if (FindStoredValue(load, node) == nullptr) return NoChange();
+  }
+
+  // Replace the loads with the stored values first, while the stores are
+  // still on the effect chain, then take the stores and finally the
+  // allocation itself out of the effect chain.
+  for (Node* const load : loads) {
+    Node* const value = FindStoredValue(load, node);
+    DCHECK_NOT_NULL(value);
+    NodeProperties::ReplaceWithValue(load, value);
+  }
+  for (Node* const store : stores) {
+    NodeProperties::ReplaceWithValue(store, store);
+  }
+  NodeProperties::ReplaceWithValue(node, node);
+  return Changed(node);
+}
+
+
+// Returns true if the allocation has a use that might let it be observed
+// from outside the function, or a use we cannot scalar replace.
+bool EscapeAnalysis::AllocationEscapes(Node* node) {
+  for (Edge edge : node->use_edges()) {
+    if (!NodeProperties::IsValueEdge(edge)) continue;
+    Node* const use = edge.from();
+    switch (use->opcode()) {
+      case IrOpcode::kLoadField:
+      case IrOpcode::kStoreField: {
+        // The allocation must be the object being accessed; a store of the
+        // allocation itself as a field value publishes it.
+        if (edge.index() != 0) return true;
+        break;
+      }
+      default:
+        // Calls, element accesses, phis, frame states and everything else
+        // conservatively keep the allocation alive. Note that treating
+        // frame state uses as escaping means no materialization at
+        // deoptimization points is ever needed.
+        return true;
+    }
+  }
+  return false;
+}
+
+
+// Walks the effect chain upwards from {node}, a field load from the
+// non-escaping allocation {object}, looking for the store that produced the
+// loaded value. Since {object} is a fresh allocation, stores to any other
+// object can never alias it. Returns nullptr if no store is found before an
+// effect node with unknown side effects.
+Node* EscapeAnalysis::FindStoredValue(Node* node, Node* object) {
+  DCHECK_EQ(IrOpcode::kLoadField, node->opcode());
+  FieldAccess const access = FieldAccessOf(node->op());
+  for (Node* effect = NodeProperties::GetEffectInput(node);;
+       effect = NodeProperties::GetEffectInput(effect)) {
+    switch (effect->opcode()) {
+      case IrOpcode::kStoreField: {
+        if (object == NodeProperties::GetValueInput(effect, 0)) {
+          if (access == FieldAccessOf(effect->op())) {
+            return NodeProperties::GetValueInput(effect, 1);
+          }
+          // A store to the same offset with an incompatible access would
+          // clobber the field; the allocation builders never do that.
+          if (access.offset == FieldAccessOf(effect->op()).offset) {
+            return nullptr;
+          }
+        }
+        break;
+      }
+      case IrOpcode::kLoadField:
+      case IrOpcode::kLoadElement:
+      case IrOpcode::kStoreElement:
+      case IrOpcode::kStoreBuffer: {
+        // These can never interfere with fields of a fresh allocation.
+        break;
+      }
+      case IrOpcode::kAllocate: {
+        // Reaching the allocation itself means the field is loaded before
+        // it was initialized; other allocations write nothing.
+        if (effect == object) return nullptr;
+        break;
+      }
+      default: {
+        if (!effect->op()->HasProperty(Operator::kNoWrite) ||
+            effect->op()->EffectInputCount() != 1) {
+          return nullptr;
+        }
+        break;
+      }
+    }
+  }
+  UNREACHABLE();
+  return nullptr;
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
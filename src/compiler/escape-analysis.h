@@ -0,0 +1,45 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_ESCAPE_ANALYSIS_H_
+#define V8_COMPILER_ESCAPE_ANALYSIS_H_
+
+#include "src/compiler/graph-reducer.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Performs scalar replacement of allocations that do not escape the
+// optimized function. An allocation escapes unless its only value uses are
+// field loads and stores where the allocation is the object being accessed;
+// in particular uses by calls, element accesses, phis or frame states are
+// treated as escaping, since virtual objects are not materialized at
+// deoptimization points yet. For a non-escaping allocation the field loads
+// are replaced by the stored values, and the stores and the allocation
+// itself are removed from the effect chain.
+class EscapeAnalysis final : public Reducer {
+ public:
+  explicit EscapeAnalysis(Zone* zone);
+  ~EscapeAnalysis() final;
+
+  const char* reducer_name() const final { return "EscapeAnalysis"; }
+
+  Reduction Reduce(Node* node) final;
+
+ private:
+  Reduction ReduceAllocate(Node* node);
+  bool AllocationEscapes(Node* node);
+  Node* FindStoredValue(Node* node, Node* object);
+
+  Zone* zone() const { return zone_; }
+
+  Zone* const zone_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_ESCAPE_ANALYSIS_H_
@@ -5,16 +5,18 @@
 #include <functional>
 #include <limits>
 
+#include "src/base/platform/elapsed-timer.h"
 #include "src/compiler/graph.h"
 #include "src/compiler/graph-reducer.h"
 #include "src/compiler/node.h"
 #include "src/compiler/node-properties.h"
+#include "src/compiler/pipeline-statistics.h"
 
 namespace v8 {
 namespace internal {
 namespace compiler {
 
-bool Reducer::Finish() { return true; }
+void Reducer::Finalize() {}
 
 
 enum class GraphReducer::State : uint8_t {
@@ -25,19 +27,32 @@ enum class GraphReducer::State : uint8_t {
 };
 
 
-GraphReducer::GraphReducer(Graph* graph, Zone* zone)
+GraphReducer::GraphReducer(Graph* graph, Zone* zone,
+                           PipelineStatistics* statistics)
     : graph_(graph),
+      statistics_(statistics),
       state_(graph, 4),
       reducers_(zone),
+      reducer_stats_(zone),
       revisit_(zone),
       stack_(zone) {}
 
 
-GraphReducer::~GraphReducer() {}
+GraphReducer::~GraphReducer() {
+  if (statistics_ != nullptr) {
+    for (size_t i = 0; i < reducers_.size(); ++i) {
+      ReducerStats const& stats = reducer_stats_[i];
+      statistics_->RecordReducerStats(reducers_[i]->reducer_name(),
+                                      stats.elapsed, stats.visited_nodes,
+                                      stats.changed_nodes);
+    }
+  }
+}
 
 
 void GraphReducer::AddReducer(Reducer* reducer) {
   reducers_.push_back(reducer);
+  reducer_stats_.push_back(ReducerStats());
 }
 
 
@@ -59,7 +74,13 @@ void GraphReducer::ReduceNode(Node* node) {
         Push(node);
       }
     } else {
-      break;
+      // Run all finalizers. Any of them may enqueue further nodes via the
+      // editor, in which case the fixpoint is not yet reached and reduction
+      // continues with precisely the nodes that were dirtied.
+      for (Reducer* const reducer : reducers_) reducer->Finalize();
+
+      // Check if we have new nodes to revisit.
+      if (revisit_.empty()) break;
     }
   }
   DCHECK(revisit_.empty());
@@ -67,30 +88,25 @@ void GraphReducer::ReduceNode(Node* node) {
 }
 
 
-void GraphReducer::ReduceGraph() {
-  for (;;) {
-    ReduceNode(graph()->end());
-    // TODO(turbofan): Remove this once the dead node trimming is in the
-    // GraphReducer.
-    bool done = true;
-    for (Reducer* const reducer : reducers_) {
-      if (!reducer->Finish()) {
-        done = false;
-        break;
-      }
-    }
-    if (done) break;
-    // Reset all marks on the graph in preparation to re-reduce the graph.
-    state_.Reset(graph());
-  }
-}
+void GraphReducer::ReduceGraph() { ReduceNode(graph()->end()); }
 
 
 Reduction GraphReducer::Reduce(Node* const node) {
   auto skip = reducers_.end();
   for (auto i = reducers_.begin(); i != reducers_.end();) {
     if (i != skip) {
-      Reduction reduction = (*i)->Reduce(node);
+      Reduction reduction;
+      if (statistics_ != nullptr) {
+        base::ElapsedTimer timer;
+        timer.Start();
+        reduction = (*i)->Reduce(node);
+        ReducerStats& stats = reducer_stats_[i - reducers_.begin()];
+        stats.elapsed += timer.Elapsed();
+        stats.visited_nodes++;
+        if (reduction.Changed()) stats.changed_nodes++;
+      } else {
+        reduction = (*i)->Reduce(node);
+      }
       if (!reduction.Changed()) {
         // No change from this reducer.
       } else if (reduction.replacement() == node) {
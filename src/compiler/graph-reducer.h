@@ -5,6 +5,7 @@
 #ifndef V8_COMPILER_GRAPH_REDUCER_H_
 #define V8_COMPILER_GRAPH_REDUCER_H_
 
+#include "src/base/platform/time.h"
 #include "src/compiler/node-marker.h"
 #include "src/zone-containers.h"
 
@@ -15,6 +16,7 @@ namespace compiler {
 // Forward declarations.
 class Graph;
 class Node;
+class PipelineStatistics;
 
 
 // NodeIds are identifying numbers for nodes that can be used to index auxiliary
@@ -44,15 +46,18 @@ class Reducer {
  public:
   virtual ~Reducer() {}
 
+  // The name of this reducer, used for per-reducer compilation statistics
+  // and tracing.
+  virtual const char* reducer_name() const { return "unknown"; }
+
   // Try to reduce a node if possible.
   virtual Reduction Reduce(Node* node) = 0;
 
-  // Ask this reducer to finish operation, returns {true} if the reducer is
-  // done, while {false} indicates that the graph might need to be reduced
-  // again.
-  // TODO(turbofan): Remove this once the dead node trimming is in the
-  // GraphReducer.
-  virtual bool Finish();
+  // Invoked by the graph reducer when the reduction has reached a fixpoint,
+  // i.e. no nodes are waiting to be reduced or revisited. Can be used to do
+  // additional reductions at the end, which in turn can cause a new round of
+  // reductions by enqueueing precisely the affected nodes for revisitation.
+  virtual void Finalize();
 
   // Helper functions for subclasses to produce reductions for a node.
   static Reduction NoChange() { return Reduction(); }
@@ -126,7 +131,10 @@ class AdvancedReducer : public Reducer {
 // Performs an iterative reduction of a node graph.
 class GraphReducer final : public AdvancedReducer::Editor {
  public:
-  GraphReducer(Graph* graph, Zone* zone);
+  // If {statistics} is non-null, per-reducer time and node counters are
+  // accumulated and recorded when the graph reducer is destroyed.
+  GraphReducer(Graph* graph, Zone* zone,
+               PipelineStatistics* statistics = nullptr);
   ~GraphReducer() final;
 
   Graph* graph() const { return graph_; }
@@ -144,6 +152,14 @@ class GraphReducer final : public AdvancedReducer::Editor {
     Node* node;
     int input_index;
   };
+  // Per-reducer accumulators, only maintained when {statistics_} is
+  // non-null.
+  struct ReducerStats {
+    ReducerStats() : visited_nodes(0), changed_nodes(0) {}
+    base::TimeDelta elapsed;
+    size_t visited_nodes;
+    size_t changed_nodes;
+  };
 
   // Reduce a single node.
   Reduction Reduce(Node* const);
@@ -173,8 +189,10 @@ class GraphReducer final : public AdvancedReducer::Editor {
   void Revisit(Node* node) final;
 
   Graph* const graph_;
+  PipelineStatistics* const statistics_;
   NodeMarker<State> state_;
   ZoneVector<Reducer*> reducers_;
+  ZoneVector<ReducerStats> reducer_stats_;
   ZoneStack<Node*> revisit_;
   ZoneStack<NodeState> stack_;
 
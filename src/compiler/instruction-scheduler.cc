@@ -0,0 +1,358 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/instruction-scheduler.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+InstructionScheduler::ScheduleGraphNode::ScheduleGraphNode(Zone* zone,
+                                                           Instruction* instr,
+                                                           int latency)
+    : instr_(instr),
+      successors_(zone),
+      unscheduled_predecessors_count_(0),
+      latency_(latency),
+      total_latency_(-1),
+      start_cycle_(-1) {}
+
+
+void InstructionScheduler::ScheduleGraphNode::AddSuccessor(
+    ScheduleGraphNode* node) {
+  successors_.push_back(node);
+  node->unscheduled_predecessors_count_++;
+}
+
+
+InstructionScheduler::InstructionScheduler(Zone* zone,
+                                           InstructionSequence* sequence)
+    : zone_(zone),
+      sequence_(sequence),
+      graph_(zone),
+      ready_list_(zone),
+      last_side_effect_instr_(NULL),
+      pending_loads_(zone),
+      last_barrier_(NULL),
+      last_writers_(zone),
+      readers_(zone) {}
+
+
+void InstructionScheduler::ScheduleSequence() {
+  for (const InstructionBlock* block : sequence()->instruction_blocks()) {
+    ScheduleBlock(block);
+  }
+}
+
+
+void InstructionScheduler::ScheduleBlock(const InstructionBlock* block) {
+  DCHECK(graph_.empty());
+  DCHECK(ready_list_.empty());
+
+  for (int i = block->first_instruction_index();
+       i <= block->last_instruction_index(); ++i) {
+    AddInstruction(sequence()->InstructionAt(i));
+  }
+
+  ComputeTotalLatencies();
+
+  for (ScheduleGraphNode* node : graph_) {
+    if (!node->HasUnscheduledPredecessor()) {
+      node->set_start_cycle(0);
+      ready_list_.push_back(node);
+    }
+  }
+
+  // Write the instructions back in list scheduling order: repeatedly pick
+  // the ready instruction on the longest latency path whose inputs are
+  // expected to be available, preferring not to stall when there is none.
+  int index = block->first_instruction_index();
+  int cycle = 0;
+  size_t scheduled_count = 0;
+  while (!ready_list_.empty()) {
+    ScheduleGraphNode* candidate = PopBestCandidate(cycle);
+    if (candidate != NULL) {
+      sequence()->SetInstructionAt(index++, candidate->instruction());
+      scheduled_count++;
+      for (ScheduleGraphNode* successor : candidate->successors()) {
+        successor->DropUnscheduledPredecessor();
+        successor->set_start_cycle(
+            std::max(successor->start_cycle(),
+                     cycle + candidate->latency()));
+        if (!successor->HasUnscheduledPredecessor()) {
+          ready_list_.push_back(successor);
+        }
+      }
+    }
+    cycle++;
+  }
+  DCHECK(scheduled_count == graph_.size());
+  DCHECK(index == block->code_end());
+  USE(scheduled_count);
+
+  graph_.clear();
+  pending_loads_.clear();
+  readers_.clear();
+  last_writers_.clear();
+  last_side_effect_instr_ = NULL;
+  last_barrier_ = NULL;
+}
+
+
+void InstructionScheduler::AddInstruction(Instruction* instr) {
+  ScheduleGraphNode* new_node =
+      new (zone()) ScheduleGraphNode(zone(), instr, GetInstructionLatency(instr));
+
+  if (IsBlockTerminator(instr)) {
+    // Keep terminators at the end of the block by ordering them after
+    // every other instruction.
+    for (ScheduleGraphNode* node : graph_) {
+      node->AddSuccessor(new_node);
+    }
+  } else if (IsBarrier(instr)) {
+    // Calls and stack manipulating instructions read and write state that
+    // is not visible in their operands, so nothing may cross them in
+    // either direction.
+    for (ScheduleGraphNode* node : graph_) {
+      node->AddSuccessor(new_node);
+    }
+    last_barrier_ = new_node;
+  } else {
+    if (last_barrier_ != NULL) {
+      last_barrier_->AddSuccessor(new_node);
+    }
+    if (HasSideEffect(instr)) {
+      if (last_side_effect_instr_ != NULL) {
+        last_side_effect_instr_->AddSuccessor(new_node);
+      }
+      for (ScheduleGraphNode* load : pending_loads_) {
+        load->AddSuccessor(new_node);
+      }
+      pending_loads_.clear();
+      last_side_effect_instr_ = new_node;
+    } else if (IsLoadOperation(instr)) {
+      // Loads must not be moved above a preceding effect, but may be
+      // reordered relative to other loads.
+      if (last_side_effect_instr_ != NULL) {
+        last_side_effect_instr_->AddSuccessor(new_node);
+      }
+      pending_loads_.push_back(new_node);
+    }
+    AddOperandDependencies(new_node);
+  }
+
+  graph_.push_back(new_node);
+}
+
+
+void InstructionScheduler::AddOperandDependencies(ScheduleGraphNode* node) {
+  Instruction* instr = node->instruction();
+
+  // Parallel moves in the start position happen before the instruction
+  // proper, moves in the end position after it; all are scheduled as part
+  // of the node, so it suffices to account for their reads and writes in
+  // order.
+  const ParallelMove* start_moves =
+      instr->GetParallelMove(Instruction::START);
+  if (start_moves != NULL) {
+    for (MoveOperands* move : *start_moves) {
+      if (move->IsRedundant()) continue;
+      AddReadDependency(node, &move->source());
+      AddWriteDependency(node, &move->destination());
+    }
+  }
+
+  for (size_t i = 0; i < instr->InputCount(); ++i) {
+    AddReadDependency(node, instr->InputAt(i));
+  }
+  for (size_t i = 0; i < instr->OutputCount(); ++i) {
+    AddWriteDependency(node, instr->OutputAt(i));
+  }
+  for (size_t i = 0; i < instr->TempCount(); ++i) {
+    AddWriteDependency(node, instr->TempAt(i));
+  }
+
+  const ParallelMove* end_moves = instr->GetParallelMove(Instruction::END);
+  if (end_moves != NULL) {
+    for (MoveOperands* move : *end_moves) {
+      if (move->IsRedundant()) continue;
+      AddReadDependency(node, &move->source());
+      AddWriteDependency(node, &move->destination());
+    }
+  }
+}
+
+
+void InstructionScheduler::AddReadDependency(ScheduleGraphNode* node,
+                                             const InstructionOperand* op) {
+  int64_t key;
+  if (!GetOperandKey(op, &key)) return;
+  auto it = last_writers_.find(key);
+  if (it != last_writers_.end() && it->second != node) {
+    it->second->AddSuccessor(node);
+  }
+  readers_.push_back(std::make_pair(key, node));
+}
+
+
+void InstructionScheduler::AddWriteDependency(ScheduleGraphNode* node,
+                                              const InstructionOperand* op) {
+  int64_t key;
+  if (!GetOperandKey(op, &key)) return;
+  // Anti dependencies: everything that still reads the previous value must
+  // do so before it is overwritten.
+  for (size_t i = 0; i < readers_.size();) {
+    if (readers_[i].first == key) {
+      if (readers_[i].second != node) {
+        readers_[i].second->AddSuccessor(node);
+      }
+      readers_[i] = readers_.back();
+      readers_.pop_back();
+    } else {
+      i++;
+    }
+  }
+  // Output dependency on the previous writer.
+  auto it = last_writers_.find(key);
+  if (it != last_writers_.end() && it->second != node) {
+    it->second->AddSuccessor(node);
+  }
+  last_writers_[key] = node;
+}
+
+
+bool InstructionScheduler::GetOperandKey(const InstructionOperand* op,
+                                         int64_t* key) {
+  if (!op->IsAllocated()) return false;
+  const AllocatedOperand* allocated = AllocatedOperand::cast(op);
+  // Keyed on the location only; two accesses to the same slot with
+  // different machine types still alias.
+  *key = static_cast<int64_t>(allocated->index()) * 4 +
+         static_cast<int64_t>(allocated->allocated_kind());
+  return true;
+}
+
+
+void InstructionScheduler::ComputeTotalLatencies() {
+  // All dependency edges point forwards in program order, so a backwards
+  // walk sees every successor before the node itself.
+  for (auto it = graph_.rbegin(); it != graph_.rend(); ++it) {
+    ScheduleGraphNode* node = *it;
+    int max_latency = 0;
+    for (ScheduleGraphNode* successor : node->successors()) {
+      DCHECK(successor->total_latency() != -1);
+      if (successor->total_latency() > max_latency) {
+        max_latency = successor->total_latency();
+      }
+    }
+    node->set_total_latency(max_latency + node->latency());
+  }
+}
+
+
+InstructionScheduler::ScheduleGraphNode*
+InstructionScheduler::PopBestCandidate(int cycle) {
+  ScheduleGraphNode* candidate = NULL;
+  size_t candidate_index = 0;
+  for (size_t i = 0; i < ready_list_.size(); ++i) {
+    ScheduleGraphNode* node = ready_list_[i];
+    if (node->start_cycle() > cycle) continue;
+    if (candidate == NULL ||
+        node->total_latency() > candidate->total_latency()) {
+      candidate = node;
+      candidate_index = i;
+    }
+  }
+  if (candidate != NULL) {
+    ready_list_[candidate_index] = ready_list_.back();
+    ready_list_.pop_back();
+  }
+  return candidate;
+}
+
+
+bool InstructionScheduler::IsBlockTerminator(const Instruction* instr) const {
+  return (GetInstructionFlags(instr) & kIsBlockTerminator) != 0 ||
+         instr->flags_mode() == kFlags_branch;
+}
+
+
+int InstructionScheduler::GetInstructionFlags(const Instruction* instr) const {
+  switch (instr->arch_opcode()) {
+    case kArchNop:
+    case kArchStackPointer:
+    case kArchTruncateDoubleToI:
+      return kNoOpcodeFlags;
+
+    case kArchCallCodeObject:
+    case kArchCallJSFunction:
+      // Covered by Instruction::IsCall as well; kept here for clarity.
+      return kIsBarrier;
+
+    case kArchTailCallCodeObject:
+    case kArchTailCallJSFunction:
+    case kArchJmp:
+    case kArchLookupSwitch:
+    case kArchTableSwitch:
+    case kArchRet:
+    case kArchDeoptimize:
+      return kIsBlockTerminator;
+
+    case kCheckedLoadInt8:
+    case kCheckedLoadUint8:
+    case kCheckedLoadInt16:
+    case kCheckedLoadUint16:
+    case kCheckedLoadWord32:
+    case kCheckedLoadFloat32:
+    case kCheckedLoadFloat64:
+      return kIsLoadOperation;
+
+    case kCheckedStoreWord8:
+    case kCheckedStoreWord16:
+    case kCheckedStoreWord32:
+    case kCheckedStoreFloat32:
+    case kCheckedStoreFloat64:
+      return kHasSideEffect;
+
+    default:
+      return GetTargetInstructionFlags(instr);
+  }
+}
+
+
+int InstructionScheduler::GetInstructionLatency(
+    const Instruction* instr) const {
+  switch (instr->arch_opcode()) {
+    case kCheckedLoadInt8:
+    case kCheckedLoadUint8:
+    case kCheckedLoadInt16:
+    case kCheckedLoadUint16:
+    case kCheckedLoadWord32:
+    case kCheckedLoadFloat32:
+    case kCheckedLoadFloat64:
+      return 3;
+    default:
+      return GetTargetInstructionLatency(instr);
+  }
+}
+
+
+#if !V8_TARGET_ARCH_ARM && !V8_TARGET_ARCH_ARM64 && !V8_TARGET_ARCH_X64
+// Targets without a scheduling table conservatively treat every target
+// instruction as an effect, which keeps the program order intact.
+int InstructionScheduler::GetTargetInstructionFlags(
+    const Instruction* instr) const {
+  return kHasSideEffect;
+}
+
+
+int InstructionScheduler::GetTargetInstructionLatency(
+    const Instruction* instr) const {
+  return 1;
+}
+#endif
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,154 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_INSTRUCTION_SCHEDULER_H_
+#define V8_COMPILER_INSTRUCTION_SCHEDULER_H_
+
+#include "src/compiler/instruction.h"
+#include "src/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// A post register allocation list scheduler.  Within each basic block the
+// instructions are reordered to reduce stalls on in-order cores, typically
+// by hoisting loads above independent arithmetic.  Dependencies are derived
+// from the registers and stack slots an instruction (and its parallel
+// moves) reads and writes, plus conservative ordering edges for memory
+// accesses; among ready instructions the one on the longest latency path
+// is emitted first.
+class InstructionScheduler final : public ZoneObject {
+ public:
+  InstructionScheduler(Zone* zone, InstructionSequence* sequence);
+
+  void ScheduleSequence();
+
+ private:
+  // Scheduling constraints of an instruction, beyond the register and slot
+  // dependencies that are computed from its operands.
+  enum ArchOpcodeFlags {
+    kNoOpcodeFlags = 0,
+    kIsBlockTerminator = 1,  // Ends a basic block; must stay at the end.
+    kHasSideEffect = 2,      // Writes memory; keeps its order relative to
+                             // other effects and is not crossed by loads.
+    kIsLoadOperation = 4,    // Reads memory; may be hoisted, but not above
+                             // a preceding effect.
+    kIsBarrier = 8,          // Implicitly reads or writes state that is not
+                             // visible in the operands (stack pointer,
+                             // register clobbers); nothing may cross it.
+  };
+
+  // A node of the per-block dependency graph.
+  class ScheduleGraphNode : public ZoneObject {
+   public:
+    ScheduleGraphNode(Zone* zone, Instruction* instr, int latency);
+
+    // Marks {node} as needing to be scheduled after this one.
+    void AddSuccessor(ScheduleGraphNode* node);
+
+    bool HasUnscheduledPredecessor() const {
+      return unscheduled_predecessors_count_ != 0;
+    }
+    void DropUnscheduledPredecessor() {
+      DCHECK(unscheduled_predecessors_count_ > 0);
+      unscheduled_predecessors_count_--;
+    }
+
+    Instruction* instruction() const { return instr_; }
+    ZoneDeque<ScheduleGraphNode*>& successors() { return successors_; }
+    int latency() const { return latency_; }
+
+    int total_latency() const { return total_latency_; }
+    void set_total_latency(int latency) { total_latency_ = latency; }
+
+    int start_cycle() const { return start_cycle_; }
+    void set_start_cycle(int cycle) { start_cycle_ = cycle; }
+
+   private:
+    Instruction* instr_;
+    ZoneDeque<ScheduleGraphNode*> successors_;
+    int unscheduled_predecessors_count_;
+    // Estimated cycles until the result of the instruction is available.
+    int latency_;
+    // Length of the longest latency path from this node to a leaf of the
+    // graph; used as the scheduling priority.
+    int total_latency_;
+    // Cycle at which all inputs of the node are expected to be ready.
+    int start_cycle_;
+  };
+
+  void ScheduleBlock(const InstructionBlock* block);
+  void AddInstruction(Instruction* instr);
+  void AddOperandDependencies(ScheduleGraphNode* node);
+  void AddReadDependency(ScheduleGraphNode* node,
+                         const InstructionOperand* op);
+  void AddWriteDependency(ScheduleGraphNode* node,
+                          const InstructionOperand* op);
+  void ComputeTotalLatencies();
+
+  // Pops the highest priority instruction whose inputs are expected to be
+  // ready at {cycle} off the ready list, or NULL if there is none.
+  ScheduleGraphNode* PopBestCandidate(int cycle);
+
+  int GetInstructionFlags(const Instruction* instr) const;
+  int GetTargetInstructionFlags(const Instruction* instr) const;
+  int GetInstructionLatency(const Instruction* instr) const;
+  int GetTargetInstructionLatency(const Instruction* instr) const;
+
+  bool IsBlockTerminator(const Instruction* instr) const;
+  bool HasSideEffect(const Instruction* instr) const {
+    return (GetInstructionFlags(instr) & kHasSideEffect) != 0;
+  }
+  bool IsLoadOperation(const Instruction* instr) const {
+    return (GetInstructionFlags(instr) & kIsLoadOperation) != 0;
+  }
+  bool IsBarrier(const Instruction* instr) const {
+    return instr->IsCall() ||
+           (GetInstructionFlags(instr) & kIsBarrier) != 0;
+  }
+
+  // Computes a key identifying the register or stack slot {op} refers to.
+  // Returns false for operands that carry no dependency (immediates and
+  // constants).
+  static bool GetOperandKey(const InstructionOperand* op, int64_t* key);
+
+  Zone* zone() { return zone_; }
+  InstructionSequence* sequence() { return sequence_; }
+
+  Zone* zone_;
+  InstructionSequence* sequence_;
+
+  // All nodes of the block being scheduled, in program order.
+  ZoneDeque<ScheduleGraphNode*> graph_;
+
+  // Nodes whose predecessors have all been scheduled.
+  ZoneDeque<ScheduleGraphNode*> ready_list_;
+
+  // The most recent instruction with a side effect; loads and later
+  // effects are ordered after it.
+  ScheduleGraphNode* last_side_effect_instr_;
+
+  // Loads seen since the last side effect; the next effect is ordered
+  // after them.
+  ZoneDeque<ScheduleGraphNode*> pending_loads_;
+
+  // The most recent barrier; later instructions are ordered after it.
+  ScheduleGraphNode* last_barrier_;
+
+  // The last writer of each register or stack slot.
+  ZoneMap<int64_t, ScheduleGraphNode*> last_writers_;
+
+  // Readers of each register or stack slot since its last write; a new
+  // write is ordered after them.
+  ZoneDeque<std::pair<int64_t, ScheduleGraphNode*> > readers_;
+
+  DISALLOW_COPY_AND_ASSIGN(InstructionScheduler);
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_INSTRUCTION_SCHEDULER_H_
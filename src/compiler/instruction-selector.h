@@ -157,6 +157,7 @@ class InstructionSelector final {
   void MarkAsWord64(Node* node) { MarkAsRepresentation(kRepWord64, node); }
   void MarkAsFloat32(Node* node) { MarkAsRepresentation(kRepFloat32, node); }
   void MarkAsFloat64(Node* node) { MarkAsRepresentation(kRepFloat64, node); }
+  void MarkAsSimd128(Node* node) { MarkAsRepresentation(kRepSimd128, node); }
   void MarkAsReference(Node* node) { MarkAsRepresentation(kRepTagged, node); }
 
   // Inform the register allocation of the representation of the unallocated
@@ -1085,6 +1085,13 @@ class InstructionSequence final : public ZoneObject {
     return instructions_[index];
   }
 
+  // Used by the instruction scheduler to reorder instructions in place.
+  void SetInstructionAt(int index, Instruction* instr) {
+    DCHECK(index >= 0);
+    DCHECK(index < static_cast<int>(instructions_.size()));
+    instructions_[index] = instr;
+  }
+
   Isolate* isolate() const { return isolate_; }
   const ReferenceMapDeque* reference_maps() const { return &reference_maps_; }
   Zone* zone() const { return zone_; }
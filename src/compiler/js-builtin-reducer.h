@@ -23,12 +23,17 @@ class JSBuiltinReducer final : public Reducer {
   explicit JSBuiltinReducer(JSGraph* jsgraph);
   ~JSBuiltinReducer() final {}
 
+  const char* reducer_name() const final { return "JSBuiltinReducer"; }
+
   Reduction Reduce(Node* node) final;
 
  private:
+  Reduction ReduceMathAbs(Node* node);
+  Reduction ReduceMathClz32(Node* node);
   Reduction ReduceMathMax(Node* node);
   Reduction ReduceMathImul(Node* node);
   Reduction ReduceMathFround(Node* node);
+  Reduction ReduceMathSqrt(Node* node);
 
   JSGraph* jsgraph() const { return jsgraph_; }
   Graph* graph() const;
@@ -19,6 +19,8 @@ class JSContextSpecializer : public Reducer {
  public:
   explicit JSContextSpecializer(JSGraph* jsgraph) : jsgraph_(jsgraph) {}
 
+  const char* reducer_name() const override { return "JSContextSpecializer"; }
+
   Reduction Reduce(Node* node) override;
 
   // Visible for unit testing.
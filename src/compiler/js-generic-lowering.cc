@@ -550,6 +550,10 @@ void JSGenericLowering::LowerJSCallFunction(Node* node) {
   CallFunctionStub stub(isolate(), arg_count, p.flags());
   CallInterfaceDescriptor d = stub.GetCallInterfaceDescriptor();
   CallDescriptor::Flags flags = AdjustFrameStatesForCall(node);
+  // Calls through a function variable can be tail calls as well; the stub
+  // dispatches to the actual target (via the arguments adaptor trampoline on
+  // arity mismatch) with the caller's frame already gone.
+  if (is_strict(p.language_mode())) flags |= CallDescriptor::kSupportsTailCalls;
   CallDescriptor* desc = Linkage::GetStubCallDescriptor(
       isolate(), zone(), d, static_cast<int>(p.arity() - 1), flags);
   Node* stub_code = jsgraph()->HeapConstant(stub.GetCode());
@@ -27,6 +27,8 @@ class JSGenericLowering final : public Reducer {
   JSGenericLowering(bool is_typing_enabled, JSGraph* jsgraph);
   ~JSGenericLowering() final;
 
+  const char* reducer_name() const final { return "JSGenericLowering"; }
+
   Reduction Reduce(Node* node) final;
 
  protected:
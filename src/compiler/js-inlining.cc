@@ -18,6 +18,7 @@
 #include "src/parser.h"
 #include "src/rewriter.h"
 #include "src/scopes.h"
+#include "src/type-feedback-vector.h"
 
 namespace v8 {
 namespace internal {
@@ -299,6 +300,36 @@ Reduction JSInliner::Reduce(Node* node) {
     return NoChange();
   }
 
+  if (mode_ == kGeneralInlining) {
+    // Spend the node budget where the cycles are: stop inlining altogether
+    // once the cumulative budget is exhausted, and only inline functions
+    // above the per-function size limit into call sites whose recorded
+    // invocation count shows they are hot.
+    int ast_node_count = function->shared()->ast_node_count();
+    if (cumulative_count_ + ast_node_count >
+        FLAG_max_inlined_nodes_cumulative) {
+      TRACE("Not inlining %s into %s because cumulative budget is exhausted\n",
+            function->shared()->DebugName()->ToCString().get(),
+            info_->shared_info()->DebugName()->ToCString().get());
+      return NoChange();
+    }
+    if (ast_node_count > FLAG_max_inlined_nodes) {
+      const VectorSlotPair& feedback =
+          CallFunctionParametersOf(node->op()).feedback();
+      int call_count = -1;
+      if (!feedback.vector().is_null() && !feedback.slot().IsInvalid()) {
+        CallICNexus nexus(feedback.vector(), feedback.slot());
+        call_count = nexus.ExtractCallCount();
+      }
+      if (call_count < FLAG_turbo_inlining_min_call_count) {
+        TRACE("Not inlining %s into %s because call site is not hot enough\n",
+              function->shared()->DebugName()->ToCString().get(),
+              info_->shared_info()->DebugName()->ToCString().get());
+        return NoChange();
+      }
+    }
+  }
+
   Zone zone;
   ParseInfo parse_info(&zone, function);
   CompilationInfo info(&parse_info);
@@ -363,6 +394,7 @@ Reduction JSInliner::Reduce(Node* node) {
     }
   }
 
+  cumulative_count_ += function->shared()->ast_node_count();
   return InlineCall(node, inlinee);
 }
 
@@ -25,7 +25,10 @@ class JSInliner final : public AdvancedReducer {
         mode_(mode),
         local_zone_(local_zone),
         info_(info),
-        jsgraph_(jsgraph) {}
+        jsgraph_(jsgraph),
+        cumulative_count_(0) {}
+
+  const char* reducer_name() const final { return "JSInliner"; }
 
   Reduction Reduce(Node* node) final;
 
@@ -34,6 +37,9 @@ class JSInliner final : public AdvancedReducer {
   Zone* local_zone_;
   CompilationInfo* info_;
   JSGraph* jsgraph_;
+  // Cumulative AST node count of all functions inlined so far, used to
+  // budget inlining across the whole graph.
+  int cumulative_count_;
 
   Node* CreateArgumentsAdaptorFrameState(JSCallFunctionAccessor* call,
                                          Zone* temp_zone);
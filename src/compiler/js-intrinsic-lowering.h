@@ -25,6 +25,8 @@ class JSIntrinsicLowering final : public Reducer {
   explicit JSIntrinsicLowering(JSGraph* jsgraph);
   ~JSIntrinsicLowering() final {}
 
+  const char* reducer_name() const final { return "JSIntrinsicLowering"; }
+
   Reduction Reduce(Node* node) final;
 
  private:
@@ -5,6 +5,7 @@
 #ifndef V8_COMPILER_JS_OPERATOR_H_
 #define V8_COMPILER_JS_OPERATOR_H_
 
+#include "src/base/functional.h"
 #include "src/runtime/runtime.h"
 #include "src/unique.h"
 
@@ -17,14 +18,40 @@ class Operator;
 struct JSOperatorGlobalCache;
 
 
+// Pairs a type feedback vector with a slot into that vector, identifying a
+// particular feedback site in the function being compiled.
+class VectorSlotPair {
+ public:
+  VectorSlotPair() : slot_(FeedbackVectorICSlot::Invalid()) {}
+  VectorSlotPair(Handle<TypeFeedbackVector> vector, FeedbackVectorICSlot slot)
+      : vector_(vector), slot_(slot) {}
+
+  Handle<TypeFeedbackVector> vector() const { return vector_; }
+  FeedbackVectorICSlot slot() const { return slot_; }
+
+  int index() const { return vector_->GetIndex(slot_); }
+
+ private:
+  const Handle<TypeFeedbackVector> vector_;
+  const FeedbackVectorICSlot slot_;
+};
+
+
+bool operator==(VectorSlotPair const& lhs, VectorSlotPair const& rhs);
+
+size_t hash_value(VectorSlotPair const&);
+
+
 // Defines the arity and the call flags for a JavaScript function call. This is
 // used as a parameter by JSCallFunction operators.
 class CallFunctionParameters final {
  public:
   CallFunctionParameters(size_t arity, CallFunctionFlags flags,
-                         LanguageMode language_mode)
+                         LanguageMode language_mode,
+                         const VectorSlotPair& feedback)
       : bit_field_(ArityField::encode(arity) | FlagsField::encode(flags) |
-                   LanguageModeField::encode(language_mode)) {}
+                   LanguageModeField::encode(language_mode)),
+        feedback_(feedback) {}
 
   size_t arity() const { return ArityField::decode(bit_field_); }
   CallFunctionFlags flags() const { return FlagsField::decode(bit_field_); }
@@ -32,8 +59,13 @@ class CallFunctionParameters final {
     return LanguageModeField::decode(bit_field_);
   }
 
+  // The type feedback for the call site, used to drive inlining heuristics;
+  // may refer to an invalid slot if no feedback was collected for the call.
+  const VectorSlotPair& feedback() const { return feedback_; }
+
   bool operator==(CallFunctionParameters const& that) const {
-    return this->bit_field_ == that.bit_field_;
+    return this->bit_field_ == that.bit_field_ &&
+           this->feedback_ == that.feedback_;
   }
   bool operator!=(CallFunctionParameters const& that) const {
     return !(*this == that);
@@ -41,7 +73,7 @@ class CallFunctionParameters final {
 
  private:
   friend size_t hash_value(CallFunctionParameters const& p) {
-    return p.bit_field_;
+    return base::hash_combine(p.bit_field_, p.feedback_);
   }
 
   typedef BitField<size_t, 0, 28> ArityField;
@@ -49,6 +81,7 @@ class CallFunctionParameters final {
   typedef BitField<LanguageMode, 30, 2> LanguageModeField;
 
   const uint32_t bit_field_;
+  const VectorSlotPair feedback_;
 };
 
 size_t hash_value(CallFunctionParameters const&);
@@ -112,25 +145,6 @@ std::ostream& operator<<(std::ostream&, ContextAccess const&);
 ContextAccess const& ContextAccessOf(Operator const*);
 
 
-class VectorSlotPair {
- public:
-  VectorSlotPair(Handle<TypeFeedbackVector> vector, FeedbackVectorICSlot slot)
-      : vector_(vector), slot_(slot) {}
-
-  Handle<TypeFeedbackVector> vector() const { return vector_; }
-  FeedbackVectorICSlot slot() const { return slot_; }
-
-  int index() const { return vector_->GetIndex(slot_); }
-
- private:
-  const Handle<TypeFeedbackVector> vector_;
-  const FeedbackVectorICSlot slot_;
-};
-
-
-bool operator==(VectorSlotPair const& lhs, VectorSlotPair const& rhs);
-
-
 // For (Load|Store)Named operators, the mode of the IC that needs
 // to be called. This is needed because (Load|Store)Property nodes can be
 // reduced to named versions, but still need to call the correct original
@@ -289,8 +303,9 @@ class JSOperatorBuilder final : public ZoneObject {
   const Operator* CreateLiteralArray(int literal_flags);
   const Operator* CreateLiteralObject(int literal_flags);
 
-  const Operator* CallFunction(size_t arity, CallFunctionFlags flags,
-                               LanguageMode language_mode);
+  const Operator* CallFunction(
+      size_t arity, CallFunctionFlags flags, LanguageMode language_mode,
+      const VectorSlotPair& feedback = VectorSlotPair());
   const Operator* CallRuntime(Runtime::FunctionId id, size_t arity);
 
   const Operator* CallConstruct(int arguments);
@@ -286,8 +286,22 @@ Reduction JSTypeFeedbackSpecializer::ReduceJSLoadNamedForGlobalVariable(
       }
     }
   } else {
-    // TODO(turbofan): non-configurable properties on the global object
-    // should be loadable through a cell without deoptimization support.
+    // Without deoptimization support only cells that can never change are
+    // usable. A non-configurable, read-only data property on the global
+    // object keeps its value for the lifetime of the cell, so its current
+    // value can be embedded without registering a dependency.
+    LookupIterator it(global_object_, name, LookupIterator::OWN);
+    if (it.state() == LookupIterator::DATA && !it.IsConfigurable() &&
+        it.IsReadOnly()) {
+      Handle<Object> constant_value(it.GetPropertyCell()->value(),
+                                    jsgraph()->isolate());
+      if (constant_value->IsConsString()) {
+        constant_value = String::Flatten(Handle<String>::cast(constant_value));
+      }
+      Node* constant = jsgraph()->Constant(constant_value);
+      ReplaceWithValue(node, constant);
+      return Replace(constant);
+    }
   }
 
   return NoChange();
@@ -77,6 +77,8 @@ class JSTypeFeedbackSpecializer : public AdvancedReducer {
     CHECK(js_type_feedback);
   }
 
+  const char* reducer_name() const override { return "JSTypeFeedbackSpecializer"; }
+
   Reduction Reduce(Node* node) override;
 
   // Visible for unit testing.
@@ -31,6 +31,8 @@ class JSTypedLowering final : public AdvancedReducer {
   JSTypedLowering(Editor* editor, JSGraph* jsgraph, Zone* zone);
   ~JSTypedLowering() final {}
 
+  const char* reducer_name() const final { return "JSTypedLowering"; }
+
   Reduction Reduce(Node* node) final;
 
  private:
@@ -4,6 +4,7 @@
 
 #include "src/code-stubs.h"
 #include "src/compiler.h"
+#include "src/compiler/common-operator.h"
 #include "src/compiler/linkage.h"
 #include "src/compiler/node.h"
 #include "src/compiler/pipeline.h"
@@ -48,6 +49,74 @@ bool CallDescriptor::HasSameReturnLocationsAs(
 }
 
 
+bool CallDescriptor::CanTailCall(const Node* node) const {
+  // Determine the number of stack parameters passed in.
+  size_t stack_params = 0;
+  for (size_t i = 0; i < InputCount(); ++i) {
+    if (!GetInputLocation(i).is_register()) ++stack_params;
+  }
+  // Ensure the incoming linkage contains the stack parameters in the right
+  // order, i.e. as the last slots of the caller's frame.
+  size_t current_stack_param = 0;
+  for (size_t i = 0; i < InputCount(); ++i) {
+    if (!GetInputLocation(i).is_register()) {
+      if (GetInputLocation(i) !=
+          LinkageLocation(static_cast<int>(current_stack_param) -
+                          static_cast<int>(stack_params))) {
+        return false;
+      }
+      ++current_stack_param;
+    }
+  }
+  // Tail calling is currently allowed if return locations match and all
+  // stack parameters of the callee reuse the caller's own argument slots
+  // without being written: each one must receive the Parameter that already
+  // lives in exactly that slot. Register parameters can differ freely.
+  CallDescriptor const* other = OpParameter<CallDescriptor const*>(node);
+  if (!HasSameReturnLocationsAs(other)) return false;
+  size_t current_input = 0;
+  size_t other_input = 0;
+  for (;;) {
+    if (other_input >= other->InputCount()) {
+      while (current_input < InputCount()) {
+        if (!GetInputLocation(current_input).is_register()) return false;
+        ++current_input;
+      }
+      return true;
+    }
+    if (current_input >= InputCount()) {
+      while (other_input < other->InputCount()) {
+        if (!other->GetInputLocation(other_input).is_register()) return false;
+        ++other_input;
+      }
+      return true;
+    }
+    if (GetInputLocation(current_input).is_register()) {
+      ++current_input;
+      continue;
+    }
+    if (other->GetInputLocation(other_input).is_register()) {
+      ++other_input;
+      continue;
+    }
+    if (GetInputLocation(current_input) !=
+        other->GetInputLocation(other_input)) {
+      return false;
+    }
+    Node* input = node->InputAt(static_cast<int>(other_input));
+    if (input->opcode() != IrOpcode::kParameter) return false;
+    // Make sure the parameter passed through to the tail call lives in the
+    // stack slot it is about to fill (input location 0 is the target).
+    size_t param_index = static_cast<size_t>(ParameterIndexOf(input->op()));
+    if (param_index != current_input - 1) return false;
+    ++current_input;
+    ++other_input;
+  }
+  UNREACHABLE();
+  return false;
+}
+
+
 CallDescriptor* Linkage::ComputeIncoming(Zone* zone, CompilationInfo* info) {
   if (info->code_stub() != NULL) {
     // Use the code stub interface descriptor.
@@ -112,6 +181,7 @@ bool Linkage::NeedsFrameState(Runtime::FunctionId function) {
   switch (function) {
     case Runtime::kAllocateInTargetSpace:
     case Runtime::kDefineClassMethod:              // TODO(jarin): Is it safe?
+    case Runtime::kDefineClassMethods:             // TODO(jarin): Is it safe?
     case Runtime::kDefineGetterPropertyUnchecked:  // TODO(jarin): Is it safe?
     case Runtime::kDefineSetterPropertyUnchecked:  // TODO(jarin): Is it safe?
     case Runtime::kForInCacheArrayLength:
@@ -20,6 +20,7 @@ class CallInterfaceDescriptor;
 
 namespace compiler {
 
+class Node;
 class OsrHelper;
 
 // Describes the location for a parameter or a return value to a call.
@@ -155,6 +156,13 @@ class CallDescriptor final : public ZoneObject {
 
   bool HasSameReturnLocationsAs(const CallDescriptor* other) const;
 
+  // Returns {true} if a tail call from a function with this (incoming)
+  // descriptor to the given call node can be emitted as a jump: all stack
+  // parameters of the callee must reuse the caller's own argument slots
+  // without any writes, i.e. each one receives the caller's parameter that
+  // already lives in exactly that slot.
+  bool CanTailCall(const Node* call) const;
+
  private:
   friend class Linkage;
 
@@ -6,11 +6,100 @@
 
 #include "src/compiler/node-properties.h"
 #include "src/compiler/simplified-operator.h"
+#include "src/types.h"
 
 namespace v8 {
 namespace internal {
 namespace compiler {
 
+namespace {
+
+// Returns true if a field of {a} could be the same field of {b}. Objects of
+// disjoint types can never alias; the types of parameters, constants and
+// feedback-specialized loads carry the stable map information recorded by
+// the type feedback specializer.
+bool MayAlias(Node* a, Node* b) {
+  if (a == b) return true;
+  if (NodeProperties::IsTyped(a) && NodeProperties::IsTyped(b)) {
+    Type* const a_type = NodeProperties::GetBounds(a).upper;
+    Type* const b_type = NodeProperties::GetBounds(b).upper;
+    if (!a_type->Maybe(b_type)) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+
+bool LoadElimination::AbstractState::Equals(AbstractState const* that) const {
+  if (this == that) return true;
+  if (this->fields_.size() != that->fields_.size()) return false;
+  for (Field const& field : this->fields_) {
+    if (that->Lookup(field.object, field.offset) != field.value) return false;
+  }
+  return true;
+}
+
+
+LoadElimination::AbstractState const* LoadElimination::AbstractState::Extend(
+    Node* object, int offset, Node* value, Zone* zone) const {
+  AbstractState* that = new (zone) AbstractState(zone);
+  that->fields_ = this->fields_;
+  Field field = {object, offset, value};
+  that->fields_.push_back(field);
+  return that;
+}
+
+
+LoadElimination::AbstractState const* LoadElimination::AbstractState::Kill(
+    Node* object, int offset, Zone* zone) const {
+  for (Field const& field : this->fields_) {
+    if (field.offset == offset && MayAlias(object, field.object)) {
+      // At least one field state dies; filter the surviving ones.
+      AbstractState* that = new (zone) AbstractState(zone);
+      for (Field const& surviving : this->fields_) {
+        if (surviving.offset == offset &&
+            MayAlias(object, surviving.object)) {
+          continue;
+        }
+        that->fields_.push_back(surviving);
+      }
+      return that;
+    }
+  }
+  return this;
+}
+
+
+LoadElimination::AbstractState const* LoadElimination::AbstractState::Merge(
+    AbstractState const* that, Zone* zone) const {
+  if (this->Equals(that)) return this;
+  // Keep only the field states that both sides agree on.
+  AbstractState* result = new (zone) AbstractState(zone);
+  for (Field const& field : this->fields_) {
+    if (that->Lookup(field.object, field.offset) == field.value) {
+      result->fields_.push_back(field);
+    }
+  }
+  return result;
+}
+
+
+Node* LoadElimination::AbstractState::Lookup(Node* object, int offset) const {
+  for (Field const& field : this->fields_) {
+    if (field.object == object && field.offset == offset) return field.value;
+  }
+  return nullptr;
+}
+
+
+LoadElimination::LoadElimination(Editor* editor, Zone* zone)
+    : AdvancedReducer(editor),
+      zone_(zone),
+      empty_state_(new (zone) AbstractState(zone)),
+      node_states_(zone) {}
+
+
 LoadElimination::~LoadElimination() {}
 
 
@@ -18,10 +107,15 @@ Reduction LoadElimination::Reduce(Node* node) {
   switch (node->opcode()) {
     case IrOpcode::kLoadField:
       return ReduceLoadField(node);
+    case IrOpcode::kStoreField:
+      return ReduceStoreField(node);
+    case IrOpcode::kEffectPhi:
+      return ReduceEffectPhi(node);
+    case IrOpcode::kStart:
+      return ReduceStart(node);
     default:
-      break;
+      return ReduceOtherNode(node);
   }
-  return NoChange();
 }
 
 
@@ -29,48 +123,149 @@ Reduction LoadElimination::ReduceLoadField(Node* node) {
   DCHECK_EQ(IrOpcode::kLoadField, node->opcode());
   FieldAccess const access = FieldAccessOf(node->op());
   Node* const object = NodeProperties::GetValueInput(node, 0);
-  for (Node* effect = NodeProperties::GetEffectInput(node);;
-       effect = NodeProperties::GetEffectInput(effect)) {
-    switch (effect->opcode()) {
-      case IrOpcode::kLoadField: {
-        if (object == NodeProperties::GetValueInput(effect, 0) &&
-            access == FieldAccessOf(effect->op())) {
-          Node* const value = effect;
-          NodeProperties::ReplaceWithValue(node, value);
-          return Replace(value);
-        }
-        break;
-      }
-      case IrOpcode::kStoreField: {
-        if (access == FieldAccessOf(effect->op())) {
-          if (object == NodeProperties::GetValueInput(effect, 0)) {
-            Node* const value = NodeProperties::GetValueInput(effect, 1);
-            NodeProperties::ReplaceWithValue(node, value);
-            return Replace(value);
-          }
-          // TODO(turbofan): Alias analysis to the rescue?
-          return NoChange();
-        }
-        break;
-      }
+  Node* const effect = NodeProperties::GetEffectInput(node);
+  AbstractState const* state = GetState(effect);
+  if (state == nullptr) return NoChange();
+  if (Node* const replacement = state->Lookup(object, access.offset)) {
+    ReplaceWithValue(node, replacement, effect);
+    return Replace(replacement);
+  }
+  return UpdateState(node, state->Extend(object, access.offset, node, zone()));
+}
+
+
+Reduction LoadElimination::ReduceStoreField(Node* node) {
+  DCHECK_EQ(IrOpcode::kStoreField, node->opcode());
+  FieldAccess const access = FieldAccessOf(node->op());
+  Node* const object = NodeProperties::GetValueInput(node, 0);
+  Node* const value = NodeProperties::GetValueInput(node, 1);
+  Node* const effect = NodeProperties::GetEffectInput(node);
+  AbstractState const* state = GetState(effect);
+  if (state == nullptr) return NoChange();
+  if (state->Lookup(object, access.offset) == value) {
+    // The store is unnecessary; the field already has this value.
+    ReplaceWithValue(node, value, effect);
+    return Replace(effect);
+  }
+  state = state->Kill(object, access.offset, zone());
+  return UpdateState(node,
+                     state->Extend(object, access.offset, value, zone()));
+}
+
+
+Reduction LoadElimination::ReduceEffectPhi(Node* node) {
+  DCHECK_EQ(IrOpcode::kEffectPhi, node->opcode());
+  Node* const effect0 = NodeProperties::GetEffectInput(node, 0);
+  Node* const control = NodeProperties::GetControlInput(node);
+  AbstractState const* state0 = GetState(effect0);
+  if (state0 == nullptr) return NoChange();
+  if (control->opcode() == IrOpcode::kLoop) {
+    // The loop entry dominates the header, so take the state at the entry
+    // and invalidate whatever the loop body might overwrite.
+    return UpdateState(node, ComputeLoopState(node, state0));
+  }
+  if (control->opcode() != IrOpcode::kMerge) return NoChange();
+
+  // Shortcut for the case when we do not know anything about some input.
+  int const input_count = node->op()->EffectInputCount();
+  for (int i = 1; i < input_count; ++i) {
+    if (GetState(NodeProperties::GetEffectInput(node, i)) == nullptr) {
+      return NoChange();
+    }
+  }
+
+  AbstractState const* state = state0;
+  for (int i = 1; i < input_count; ++i) {
+    state = state->Merge(GetState(NodeProperties::GetEffectInput(node, i)),
+                         zone());
+  }
+  return UpdateState(node, state);
+}
+
+
+Reduction LoadElimination::ReduceStart(Node* node) {
+  DCHECK_EQ(IrOpcode::kStart, node->opcode());
+  return UpdateState(node, empty_state());
+}
+
+
+Reduction LoadElimination::ReduceOtherNode(Node* node) {
+  if (node->op()->EffectInputCount() == 1 &&
+      node->op()->EffectOutputCount() == 1) {
+    AbstractState const* state = GetState(NodeProperties::GetEffectInput(node));
+    if (state == nullptr) return NoChange();
+    switch (node->opcode()) {
       case IrOpcode::kStoreBuffer:
-      case IrOpcode::kStoreElement: {
+      case IrOpcode::kStoreElement:
         // These can never interfere with field loads.
         break;
-      }
-      default: {
-        if (!effect->op()->HasProperty(Operator::kNoWrite) ||
-            effect->op()->EffectInputCount() != 1) {
-          return NoChange();
-        }
+      default:
+        // If this {node} has some uncontrolled side effects, start over with
+        // an empty state; otherwise the node does not matter for field states.
+        if (!node->op()->HasProperty(Operator::kNoWrite)) state = empty_state();
         break;
-      }
     }
+    return UpdateState(node, state);
+  }
+  return NoChange();
+}
+
+
+Reduction LoadElimination::UpdateState(Node* node, AbstractState const* state) {
+  AbstractState const* const original = GetState(node);
+  // Only signal that the node has changed if the state actually changed.
+  if (state != original &&
+      (original == nullptr || !state->Equals(original))) {
+    SetState(node, state);
+    return Changed(node);
   }
-  UNREACHABLE();
   return NoChange();
 }
 
+
+LoadElimination::AbstractState const* LoadElimination::ComputeLoopState(
+    Node* node, AbstractState const* state) const {
+  DCHECK_EQ(IrOpcode::kEffectPhi, node->opcode());
+  ZoneQueue<Node*> queue(zone());
+  ZoneSet<Node*> visited(zone());
+  visited.insert(node);
+  for (int i = 1; i < node->op()->EffectInputCount(); ++i) {
+    queue.push(NodeProperties::GetEffectInput(node, i));
+  }
+  while (!queue.empty()) {
+    Node* const current = queue.front();
+    queue.pop();
+    if (visited.find(current) != visited.end()) continue;
+    visited.insert(current);
+    if (current->opcode() == IrOpcode::kStoreField) {
+      FieldAccess const access = FieldAccessOf(current->op());
+      Node* const object = NodeProperties::GetValueInput(current, 0);
+      state = state->Kill(object, access.offset, zone());
+    } else if (!current->op()->HasProperty(Operator::kNoWrite)) {
+      return empty_state();
+    }
+    for (int i = 0; i < current->op()->EffectInputCount(); ++i) {
+      queue.push(NodeProperties::GetEffectInput(current, i));
+    }
+  }
+  return state;
+}
+
+
+LoadElimination::AbstractState const* LoadElimination::GetState(
+    Node* node) const {
+  size_t const id = static_cast<size_t>(node->id());
+  if (id < node_states_.size()) return node_states_[id];
+  return nullptr;
+}
+
+
+void LoadElimination::SetState(Node* node, AbstractState const* state) {
+  size_t const id = static_cast<size_t>(node->id());
+  if (id >= node_states_.size()) node_states_.resize(id + 1, nullptr);
+  node_states_[id] = state;
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
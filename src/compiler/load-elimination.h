@@ -6,20 +6,74 @@
 #define V8_COMPILER_LOAD_ELIMINATION_H_
 
 #include "src/compiler/graph-reducer.h"
+#include "src/zone-containers.h"
 
 namespace v8 {
 namespace internal {
 namespace compiler {
 
-class LoadElimination final : public Reducer {
+// Eliminates redundant field loads (and stores of already known values) by
+// tracking an abstract state of known field values along the effect chains
+// of the graph. States are merged where effect chains merge, computed
+// conservatively around loops, and cleared at operators with unknown side
+// effects. A store only invalidates the states of fields it may alias,
+// judged by field offset and by the types of the objects involved, which
+// carry the stable map information recorded during type feedback
+// specialization.
+class LoadElimination final : public AdvancedReducer {
  public:
-  LoadElimination() {}
+  LoadElimination(Editor* editor, Zone* zone);
   ~LoadElimination() final;
 
+  const char* reducer_name() const final { return "LoadElimination"; }
+
   Reduction Reduce(Node* node) final;
 
  private:
+  // An immutable mapping from (object, field offset) pairs to the last known
+  // value of the field at some point in the effect chain.
+  class AbstractState final : public ZoneObject {
+   public:
+    explicit AbstractState(Zone* zone) : fields_(zone) {}
+
+    bool Equals(AbstractState const* that) const;
+    AbstractState const* Extend(Node* object, int offset, Node* value,
+                                Zone* zone) const;
+    AbstractState const* Kill(Node* object, int offset, Zone* zone) const;
+    AbstractState const* Merge(AbstractState const* that, Zone* zone) const;
+    Node* Lookup(Node* object, int offset) const;
+
+   private:
+    struct Field {
+      Node* object;
+      int offset;
+      Node* value;
+    };
+
+    ZoneVector<Field> fields_;
+  };
+
   Reduction ReduceLoadField(Node* node);
+  Reduction ReduceStoreField(Node* node);
+  Reduction ReduceEffectPhi(Node* node);
+  Reduction ReduceStart(Node* node);
+  Reduction ReduceOtherNode(Node* node);
+
+  Reduction UpdateState(Node* node, AbstractState const* state);
+  AbstractState const* ComputeLoopState(Node* node,
+                                        AbstractState const* state) const;
+
+  AbstractState const* GetState(Node* node) const;
+  void SetState(Node* node, AbstractState const* state);
+
+  AbstractState const* empty_state() const { return empty_state_; }
+  Zone* zone() const { return zone_; }
+
+  Zone* const zone_;
+  AbstractState const* const empty_state_;
+  ZoneVector<AbstractState const*> node_states_;
+
+  DISALLOW_COPY_AND_ASSIGN(LoadElimination);
 };
 
 }  // namespace compiler
@@ -0,0 +1,338 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/common-operator.h"
+#include "src/compiler/graph.h"
+#include "src/compiler/loop-unrolling.h"
+#include "src/compiler/node.h"
+#include "src/compiler/node-marker.h"
+#include "src/compiler/node-properties.h"
+#include "src/zone.h"
+
+// Loop unrolling is an optimization that copies the body of a loop so that
+// several iterations of the original loop are performed per trip around the
+// backedge. Unlike loop peeling (loop-peeling.cc), the copies remain inside
+// the loop: the header phis of copied iteration {i} are mapped to the values
+// on the backedge of iteration {i - 1}, chaining the iterations together,
+// and the backedge of the loop is redirected to come from the last copy.
+
+// Each copied iteration retains its own copy of the loop condition and exit
+// branch, so the iteration count is unchanged; the benefit comes from the
+// reduced per-iteration control overhead and from lowering being able to
+// combine checks across the copies, e.g. eliminating all but one range check
+// for the unrolled accesses during simplified lowering. Since exits can now
+// be taken from any of the copies, the exit projections are merged and any
+// value or effect that escapes the loop is routed through a phi at that
+// merge, selecting the copy that produced it.
+
+// Only innermost counted loops with a single backedge and a single exit are
+// unrolled, and only when the body is small enough that the duplication is
+// likely paid for by the saved overhead.
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+// The number of nodes an unrolled loop may grow to before unrolling is
+// considered unprofitable.
+const size_t kMaxUnrolledSize = 64;
+const int kMaxUnrollingFactor = 4;
+
+
+// Keeps track of the values the loop nodes take in each unrolled iteration.
+// Iteration 0 in this mapping is the first copy, i.e. the second iteration
+// performed per trip; the original loop body serves as the first.
+struct Unrolling {
+  // Maps a node of the loop to 1 + its index into the per-iteration value
+  // vectors; zero means the node is outside the loop.
+  NodeMarker<size_t> node_map;
+  // The loop nodes in mapping order (header nodes first, then body nodes).
+  NodeVector nodes;
+  size_t header_count;
+  // values[i] holds the value each mapped node takes in copied iteration
+  // {i}: for a header node the value entering that iteration, for a body
+  // node its copy.
+  ZoneVector<NodeVector> values;
+
+  Unrolling(Graph* graph, Zone* tmp_zone, size_t max)
+      : node_map(graph, static_cast<uint32_t>(max)),
+        nodes(tmp_zone),
+        header_count(0),
+        values(tmp_zone) {}
+
+  // Returns the value of {node} in copied iteration {i}; nodes from outside
+  // the loop are invariant across iterations.
+  Node* map(size_t i, Node* node) {
+    size_t m = node_map.Get(node);
+    if (m == 0) return node;
+    return values[i][m - 1];
+  }
+};
+
+
+// Look for returns and if projections that are outside the loop but whose
+// control input is inside the loop (cf. loop peeling).
+void FindLoopExits(LoopTree* loop_tree, LoopTree::Loop* loop,
+                   NodeVector& exits, NodeVector& rets) {
+  for (Node* node : loop_tree->LoopNodes(loop)) {
+    for (Node* use : node->uses()) {
+      if (!loop_tree->Contains(loop, use)) {
+        if (IrOpcode::IsIfProjectionOpcode(use->opcode())) {
+          exits.push_back(use);
+        } else if (use->opcode() == IrOpcode::kReturn &&
+                   loop_tree->Contains(loop,
+                                       NodeProperties::GetControlInput(use))) {
+          rets.push_back(use);
+        }
+      }
+    }
+  }
+}
+
+
+bool IsConstant(Node* node) {
+  switch (node->opcode()) {
+    case IrOpcode::kInt32Constant:
+    case IrOpcode::kInt64Constant:
+    case IrOpcode::kFloat32Constant:
+    case IrOpcode::kFloat64Constant:
+    case IrOpcode::kNumberConstant:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// An induction variable is a phi at the loop header whose value on the
+// backedge is the phi itself incremented or decremented by a constant.
+bool IsInductionVariable(Node* loop_node, Node* phi) {
+  if (phi->opcode() != IrOpcode::kPhi) return false;
+  if (NodeProperties::GetControlInput(phi) != loop_node) return false;
+  Node* arith = phi->InputAt(1);
+  switch (arith->opcode()) {
+    case IrOpcode::kNumberAdd:
+    case IrOpcode::kNumberSubtract:
+    case IrOpcode::kInt32Add:
+    case IrOpcode::kInt32Sub:
+      break;
+    default:
+      return false;
+  }
+  Node* left = arith->InputAt(0);
+  Node* right = arith->InputAt(1);
+  return (left == phi && IsConstant(right)) ||
+         (right == phi && IsConstant(left));
+}
+
+
+// A counted loop exit is a branch on a comparison of an induction variable,
+// e.g. {i < length} for a typical counting loop.
+bool IsCountedLoopExit(Node* loop_node, Node* exit) {
+  Node* branch = NodeProperties::GetControlInput(exit);
+  if (branch->opcode() != IrOpcode::kBranch) return false;
+  Node* cond = branch->InputAt(0);
+  switch (cond->opcode()) {
+    case IrOpcode::kNumberLessThan:
+    case IrOpcode::kNumberLessThanOrEqual:
+    case IrOpcode::kInt32LessThan:
+    case IrOpcode::kInt32LessThanOrEqual:
+    case IrOpcode::kUint32LessThan:
+    case IrOpcode::kUint32LessThanOrEqual:
+      break;
+    default:
+      return false;
+  }
+  return IsInductionVariable(loop_node, cond->InputAt(0)) ||
+         IsInductionVariable(loop_node, cond->InputAt(1));
+}
+
+
+void CollectInnermostLoops(LoopTree::Loop* loop,
+                           ZoneVector<LoopTree::Loop*>* loops) {
+  if (loop->children().empty()) {
+    loops->push_back(loop);
+    return;
+  }
+  for (LoopTree::Loop* child : loop->children()) {
+    CollectInnermostLoops(child, loops);
+  }
+}
+
+}  // namespace
+
+
+int LoopUnroller::UnrollingFactor(LoopTree* loop_tree, LoopTree::Loop* loop,
+                                  Zone* tmp_zone) {
+  if (!loop->children().empty()) return 1;  // only innermost loops.
+  Node* loop_node = loop_tree->GetLoopControl(loop);
+  if (loop_node->InputCount() != 2) return 1;  // multiple backedges.
+
+  NodeVector exits(tmp_zone);
+  NodeVector rets(tmp_zone);
+  FindLoopExits(loop_tree, loop, exits, rets);
+  if (exits.size() != 1 || rets.size() != 0) return 1;
+  if (!IsCountedLoopExit(loop_node, exits[0])) return 1;
+
+  // Choose the largest factor for which the unrolled loop stays small.
+  int factor = kMaxUnrollingFactor;
+  while (factor > 1 && loop->TotalSize() * factor > kMaxUnrolledSize) {
+    factor /= 2;
+  }
+  return factor;
+}
+
+
+void LoopUnroller::Unroll(Graph* graph, CommonOperatorBuilder* common,
+                          LoopTree* loop_tree, LoopTree::Loop* loop,
+                          int factor, Zone* tmp_zone) {
+  DCHECK(factor > 1);
+  NodeVector exits(tmp_zone);
+  NodeVector rets(tmp_zone);
+  FindLoopExits(loop_tree, loop, exits, rets);
+  DCHECK_EQ(1u, exits.size());
+  DCHECK_EQ(0u, rets.size());
+  Node* exit = exits[0];
+  Node* branch = NodeProperties::GetControlInput(exit);
+  NodeId first_new_id = graph->NodeCount();
+
+  //============================================================================
+  // Map out the nodes of the loop.
+  //============================================================================
+  Unrolling unrolling(graph, tmp_zone, loop->TotalSize() + 1);
+  for (Node* node : loop_tree->HeaderNodes(loop)) {
+    unrolling.node_map.Set(node, 1 + unrolling.nodes.size());
+    unrolling.nodes.push_back(node);
+  }
+  unrolling.header_count = unrolling.nodes.size();
+  for (Node* node : loop_tree->BodyNodes(loop)) {
+    unrolling.node_map.Set(node, 1 + unrolling.nodes.size());
+    unrolling.nodes.push_back(node);
+  }
+
+  //============================================================================
+  // Construct the copied iterations. The header nodes of each copy map to
+  // the values on the backedge of the previous iteration, chaining the
+  // copies together.
+  //============================================================================
+  NodeVector inputs(tmp_zone);
+  for (int c = 0; c < factor - 1; c++) {
+    unrolling.values.push_back(NodeVector(tmp_zone));
+    NodeVector& values = unrolling.values.back();
+    for (size_t i = 0; i < unrolling.header_count; i++) {
+      Node* backedge_value = unrolling.nodes[i]->InputAt(1);
+      values.push_back(c == 0 ? backedge_value
+                              : unrolling.map(c - 1, backedge_value));
+    }
+    // Copy the body nodes first, keeping the original inputs.
+    for (size_t i = unrolling.header_count; i < unrolling.nodes.size(); i++) {
+      Node* node = unrolling.nodes[i];
+      inputs.clear();
+      for (Node* input : node->inputs()) inputs.push_back(input);
+      values.push_back(
+          graph->NewNode(node->op(), node->InputCount(), &inputs[0]));
+    }
+    // Now that all copies exist, redirect their inputs into this iteration.
+    for (size_t i = unrolling.header_count; i < unrolling.nodes.size(); i++) {
+      Node* original = unrolling.nodes[i];
+      Node* copy = values[i];
+      for (int j = 0; j < copy->InputCount(); j++) {
+        copy->ReplaceInput(j, unrolling.map(c, original->InputAt(j)));
+      }
+    }
+  }
+
+  //============================================================================
+  // Redirect the backedge of the loop to come from the last copy.
+  //============================================================================
+  int last = factor - 2;
+  for (size_t i = 0; i < unrolling.header_count; i++) {
+    Node* node = unrolling.nodes[i];
+    node->ReplaceInput(1, unrolling.map(last, node->InputAt(1)));
+  }
+
+  //============================================================================
+  // Each copied iteration checks the loop condition itself; merge the
+  // per-iteration exits into a single exit.
+  //============================================================================
+  inputs.clear();
+  inputs.push_back(exit);
+  for (int c = 0; c < factor - 1; c++) {
+    inputs.push_back(graph->NewNode(exit->op(), unrolling.map(c, branch)));
+  }
+  Node* merge = graph->NewNode(common->Merge(factor), factor, &inputs[0]);
+  exit->ReplaceUses(merge);
+  merge->ReplaceInput(0, exit);  // input 0 overwritten by above line.
+
+  //============================================================================
+  // Find and update all the edges into the loop from outside. A value that
+  // escapes the loop is now produced by whichever iteration took the exit,
+  // so such uses are routed through phis at the exit merge.
+  //============================================================================
+  ZoneVector<Edge> value_edges(tmp_zone);
+  ZoneVector<Edge> effect_edges(tmp_zone);
+  for (Node* node : unrolling.nodes) {
+    // Gather value and effect edges from outside the loop.
+    for (Edge edge : node->use_edges()) {
+      Node* from = edge.from();
+      if (from->id() >= first_new_id) continue;         // created above.
+      if (unrolling.node_map.Get(from) != 0) continue;  // inside the loop.
+      if (NodeProperties::IsValueEdge(edge) ||
+          NodeProperties::IsContextEdge(edge)) {
+        value_edges.push_back(edge);
+      } else if (NodeProperties::IsEffectEdge(edge)) {
+        effect_edges.push_back(edge);
+      } else {
+        // don't do anything for control edges.
+        // TODO(titzer): should update control edges to unrolled?
+      }
+    }
+
+    // Update all the value and effect edges at once.
+    if (!value_edges.empty()) {
+      inputs.clear();
+      inputs.push_back(node);
+      for (int c = 0; c < factor - 1; c++) {
+        inputs.push_back(unrolling.map(c, node));
+      }
+      inputs.push_back(merge);
+      // TODO(titzer): machine type is wrong here.
+      Node* phi = graph->NewNode(common->Phi(kMachAnyTagged, factor),
+                                 factor + 1, &inputs[0]);
+      for (Edge edge : value_edges) edge.UpdateTo(phi);
+      value_edges.clear();
+    }
+    if (!effect_edges.empty()) {
+      inputs.clear();
+      inputs.push_back(node);
+      for (int c = 0; c < factor - 1; c++) {
+        inputs.push_back(unrolling.map(c, node));
+      }
+      inputs.push_back(merge);
+      Node* effect_phi =
+          graph->NewNode(common->EffectPhi(factor), factor + 1, &inputs[0]);
+      for (Edge edge : effect_edges) edge.UpdateTo(effect_phi);
+      effect_edges.clear();
+    }
+  }
+}
+
+
+void LoopUnroller::UnrollLoops(Graph* graph, CommonOperatorBuilder* common,
+                               LoopTree* loop_tree, Zone* tmp_zone) {
+  ZoneVector<LoopTree::Loop*> loops(tmp_zone);
+  for (LoopTree::Loop* loop : loop_tree->outer_loops()) {
+    CollectInnermostLoops(loop, &loops);
+  }
+  for (LoopTree::Loop* loop : loops) {
+    int factor = UnrollingFactor(loop_tree, loop, tmp_zone);
+    if (factor > 1) Unroll(graph, common, loop_tree, loop, factor, tmp_zone);
+  }
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
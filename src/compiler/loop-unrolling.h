@@ -0,0 +1,42 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_LOOP_UNROLLING_H_
+#define V8_COMPILER_LOOP_UNROLLING_H_
+
+#include "src/compiler/loop-analysis.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class CommonOperatorBuilder;
+
+// Implements loop unrolling for small counted loops.
+class LoopUnroller {
+ public:
+  // Unroll all profitable innermost loops found in {loop_tree}.
+  static void UnrollLoops(Graph* graph, CommonOperatorBuilder* common,
+                          LoopTree* loop_tree, Zone* tmp_zone);
+
+  // Compute the unrolling factor for {loop}. Returns a factor greater than
+  // one only for innermost counted loops with a single backedge, a single
+  // exit, and a body small enough that duplicating it is profitable.
+  static int UnrollingFactor(LoopTree* loop_tree, LoopTree::Loop* loop,
+                             Zone* tmp_zone);
+
+  // Unroll {loop} by the given {factor}, i.e. make the loop body perform
+  // {factor} iterations per trip around the backedge. The loop must satisfy
+  // the conditions checked by {UnrollingFactor}.
+  static void Unroll(Graph* graph, CommonOperatorBuilder* common,
+                     LoopTree* loop_tree, LoopTree::Loop* loop, int factor,
+                     Zone* tmp_zone);
+};
+
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_LOOP_UNROLLING_H_
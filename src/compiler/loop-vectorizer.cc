@@ -0,0 +1,408 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-vectorizer.h"
+
+#include "src/compiler/common-operator.h"
+#include "src/compiler/graph.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/machine-operator.h"
+#include "src/compiler/node.h"
+#include "src/compiler/node-properties.h"
+#include "src/types.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// This pass rewrites innermost counted loops of the restricted shape
+//
+//   for (i = phi(i0, i + 1); i < len; ) {
+//     a[i] = <elementwise arithmetic over b[i], c[i], ...>;
+//   }
+//
+// where every array access is a {LoadBuffer} or {StoreBuffer} on typed array
+// backing stores of the same element type, indexed directly by the induction
+// variable. The loop body is split into a diamond: when at least four
+// elements remain, one iteration processes four consecutive lanes with the
+// packed 128-bit machine operators and advances the induction variable by
+// four; otherwise the original scalar body runs and advances it by one. The
+// scalar side thus doubles as the remainder loop, and the loop's exit check
+// and exit value are unchanged.
+//
+//            Loop<-------------------------------+
+//             |                                  |
+//           Branch(i < len)                      |
+//            / \                                 |
+//       IfFalse IfTrue                         Merge
+//         exit    |                             / \
+//               Branch(i + 3 < len, kTrue)     /   \
+//                 /              \            /     \
+//              IfTrue          IfFalse-------/       |
+//                 |          (scalar body, i + 1)    |
+//          (packed body, i + 4)----------------------+
+namespace {
+
+// The matched parts of a vectorizable loop.
+struct VectorLoop {
+  Node* loop;        // the kLoop node.
+  Node* phi;         // the induction variable.
+  Node* effect_phi;  // the loop's only effect phi.
+  Node* increment;   // NumberAdd(phi, 1) on the backedge.
+  Node* branch;      // the loop's exit check.
+  Node* condition;   // NumberLessThan(phi, length).
+  Node* if_true;     // the continue projection; start of the body.
+  Node* length;      // the common length of all accessed buffers.
+  ExternalArrayType array_type;  // the common element type.
+  bool has_store;    // whether the body contains at least one store.
+};
+
+
+bool IsOne(Node* node) {
+  return node->opcode() == IrOpcode::kNumberConstant &&
+         OpParameter<double>(node) == 1;
+}
+
+
+// Matches the loop header: a two-input loop with exactly one value phi and
+// one effect phi, where the value phi is incremented by one per iteration
+// and controls a less-than exit check at the top of the body.
+bool MatchLoopHeader(LoopTree* loop_tree, LoopTree::Loop* loop,
+                     VectorLoop* match) {
+  match->loop = nullptr;
+  match->phi = nullptr;
+  match->effect_phi = nullptr;
+  for (Node* node : loop_tree->HeaderNodes(loop)) {
+    switch (node->opcode()) {
+      case IrOpcode::kLoop:
+        match->loop = node;
+        break;
+      case IrOpcode::kPhi:
+        if (match->phi != nullptr) return false;
+        match->phi = node;
+        break;
+      case IrOpcode::kEffectPhi:
+        if (match->effect_phi != nullptr) return false;
+        match->effect_phi = node;
+        break;
+      default:
+        return false;
+    }
+  }
+  if (match->loop == nullptr || match->phi == nullptr ||
+      match->effect_phi == nullptr) {
+    return false;
+  }
+  if (match->loop->InputCount() != 2) return false;  // single backedge only.
+
+  // The induction variable must advance by exactly one per iteration, and
+  // the increment must not be used for anything else.
+  match->increment = match->phi->InputAt(1);
+  if (match->increment->opcode() != IrOpcode::kNumberAdd) return false;
+  if (match->increment->InputAt(0) != match->phi ||
+      !IsOne(match->increment->InputAt(1))) {
+    return false;
+  }
+  if (match->increment->UseCount() != 1) return false;
+
+  // The loop must exit through a single branch on {phi < length} directly at
+  // the header, continuing into the body on the true projection.
+  match->branch = nullptr;
+  for (Node* use : match->loop->uses()) {
+    if (use->opcode() != IrOpcode::kBranch) continue;
+    if (match->branch != nullptr) return false;
+    match->branch = use;
+  }
+  if (match->branch == nullptr) return false;
+  match->condition = match->branch->InputAt(0);
+  if (match->condition->opcode() != IrOpcode::kNumberLessThan) return false;
+  if (match->condition->InputAt(0) != match->phi) return false;
+  if (match->condition->UseCount() != 1) return false;
+  match->length = match->condition->InputAt(1);
+  if (loop_tree->Contains(loop, match->length)) return false;
+
+  match->if_true = nullptr;
+  for (Node* use : match->branch->uses()) {
+    if (use->opcode() == IrOpcode::kIfTrue) match->if_true = use;
+  }
+  if (match->if_true == nullptr) return false;
+  // The body must be straight-line code: the backedge comes directly from
+  // the continue projection.
+  if (match->loop->InputAt(1) != match->if_true) return false;
+  return true;
+}
+
+
+// Matches the loop body: besides the exit check matched above, only buffer
+// accesses at offset {phi} into same-typed arrays of length {length} and
+// elementwise arithmetic over them, none of which is used outside the loop.
+bool MatchLoopBody(LoopTree* loop_tree, LoopTree::Loop* loop,
+                   VectorLoop* match) {
+  bool seen_access = false;
+  match->has_store = false;
+  for (Node* node : loop_tree->BodyNodes(loop)) {
+    switch (node->opcode()) {
+      case IrOpcode::kBranch:
+        if (node != match->branch) return false;
+        break;
+      case IrOpcode::kIfTrue:
+        if (node != match->if_true) return false;
+        break;
+      case IrOpcode::kNumberLessThan:
+        if (node != match->condition) return false;
+        break;
+      case IrOpcode::kLoadBuffer:
+      case IrOpcode::kStoreBuffer: {
+        BufferAccess access = BufferAccessOf(node->op());
+        if (access.external_array_type() != kExternalFloat32Array &&
+            access.external_array_type() != kExternalInt32Array) {
+          return false;
+        }
+        if (seen_access && access.external_array_type() != match->array_type) {
+          return false;
+        }
+        match->array_type = access.external_array_type();
+        seen_access = true;
+        // The buffer must be loop-invariant, the offset must be the
+        // induction variable and the length must match the exit check, so
+        // that the lane guard inserted below covers all four lanes.
+        if (loop_tree->Contains(loop, node->InputAt(0))) return false;
+        if (node->InputAt(1) != match->phi) return false;
+        if (node->InputAt(2) != match->length) return false;
+        if (NodeProperties::GetControlInput(node) != match->if_true) {
+          return false;
+        }
+        if (node->opcode() == IrOpcode::kStoreBuffer) match->has_store = true;
+        break;
+      }
+      case IrOpcode::kNumberAdd:
+        if (node == match->increment) break;
+      // Fall through.
+      case IrOpcode::kNumberSubtract:
+      case IrOpcode::kNumberMultiply:
+      case IrOpcode::kNumberDivide:
+        // Inputs are checked during translation; only loads and other
+        // packable arithmetic are allowed there.
+        break;
+      default:
+        return false;
+    }
+    // No loop-carried or escaping values other than the induction variable
+    // and the effect chain.
+    if (node != match->branch && node != match->if_true) {
+      for (Node* use : node->uses()) {
+        if (!loop_tree->Contains(loop, use)) return false;
+      }
+    }
+  }
+  return match->has_store;
+}
+
+
+// Builds the packed copy of the loop body. Effectful nodes are translated
+// along the effect chain; pure arithmetic is translated on demand.
+class PackedBodyBuilder {
+ public:
+  PackedBodyBuilder(Graph* graph, MachineOperatorBuilder* machine,
+                    const VectorLoop& match, Node* index, Node* control,
+                    Zone* zone)
+      : graph_(graph),
+        machine_(machine),
+        match_(match),
+        index_(index),
+        control_(control),
+        memo_(zone) {}
+
+  // Returns the packed equivalent of {node}, or {nullptr} if the body turns
+  // out not to be vectorizable after all. Nothing is mutated either way.
+  Node* Translate(Node* node) {
+    if (node == match_.effect_phi) return node;  // The incoming effect.
+    auto it = memo_.find(node);
+    if (it != memo_.end()) return it->second;
+    Node* copy = nullptr;
+    switch (node->opcode()) {
+      case IrOpcode::kLoadBuffer: {
+        Node* effect = Translate(NodeProperties::GetEffectInput(node));
+        if (effect == nullptr) return nullptr;
+        // The lane guard makes all four lanes in-bounds, so the packed load
+        // does not need the checked semantics of {LoadBuffer}.
+        copy = graph_->NewNode(machine_->Load(kMachSimd128), node->InputAt(0),
+                               index_, effect, control_);
+        break;
+      }
+      case IrOpcode::kStoreBuffer: {
+        Node* value = Translate(node->InputAt(3));
+        if (value == nullptr) return nullptr;
+        Node* effect = Translate(NodeProperties::GetEffectInput(node));
+        if (effect == nullptr) return nullptr;
+        copy = graph_->NewNode(
+            machine_->Store(StoreRepresentation(kMachSimd128, kNoWriteBarrier)),
+            node->InputAt(0), index_, value, effect, control_);
+        break;
+      }
+      case IrOpcode::kNumberAdd:
+      case IrOpcode::kNumberSubtract:
+      case IrOpcode::kNumberMultiply:
+      case IrOpcode::kNumberDivide: {
+        const Operator* op = PackedOperator(node->opcode());
+        if (op == nullptr) return nullptr;
+        if (match_.array_type == kExternalInt32Array &&
+            !NodeProperties::GetBounds(node).upper->Is(Type::Signed32())) {
+          // Packed integer arithmetic wraps, which is only equivalent to the
+          // number operation when the result cannot overflow.
+          return nullptr;
+        }
+        Node* left = Translate(node->InputAt(0));
+        if (left == nullptr) return nullptr;
+        Node* right = Translate(node->InputAt(1));
+        if (right == nullptr) return nullptr;
+        copy = graph_->NewNode(op, left, right);
+        break;
+      }
+      default:
+        return nullptr;
+    }
+    memo_[node] = copy;
+    return copy;
+  }
+
+ private:
+  const Operator* PackedOperator(IrOpcode::Value opcode) {
+    if (match_.array_type == kExternalFloat32Array) {
+      switch (opcode) {
+        case IrOpcode::kNumberAdd:
+          return machine_->Float32x4Add();
+        case IrOpcode::kNumberSubtract:
+          return machine_->Float32x4Sub();
+        case IrOpcode::kNumberMultiply:
+          return machine_->Float32x4Mul();
+        case IrOpcode::kNumberDivide:
+          return machine_->Float32x4Div();
+        default:
+          return nullptr;
+      }
+    }
+    switch (opcode) {
+      case IrOpcode::kNumberAdd:
+        return machine_->Int32x4Add();
+      case IrOpcode::kNumberSubtract:
+        return machine_->Int32x4Sub();
+      default:
+        return nullptr;
+    }
+  }
+
+  Graph* const graph_;
+  MachineOperatorBuilder* const machine_;
+  const VectorLoop& match_;
+  Node* const index_;
+  Node* const control_;
+  ZoneMap<Node*, Node*> memo_;
+};
+
+}  // namespace
+
+
+LoopVectorizer::LoopVectorizer(JSGraph* jsgraph, Zone* zone)
+    : jsgraph_(jsgraph),
+      simplified_(jsgraph->graph()->zone()),
+      zone_(zone) {}
+
+
+void LoopVectorizer::VectorizeLoops() {
+  if (!machine()->HasSimd128()) return;
+  LoopTree* loop_tree = LoopFinder::BuildLoopTree(graph(), zone());
+  ZoneVector<LoopTree::Loop*> innermost(zone());
+  ZoneQueue<LoopTree::Loop*> queue(zone());
+  for (LoopTree::Loop* loop : loop_tree->outer_loops()) queue.push(loop);
+  while (!queue.empty()) {
+    LoopTree::Loop* loop = queue.front();
+    queue.pop();
+    if (loop->children().empty()) {
+      innermost.push_back(loop);
+    } else {
+      for (LoopTree::Loop* child : loop->children()) queue.push(child);
+    }
+  }
+  for (LoopTree::Loop* loop : innermost) {
+    VectorizeLoop(loop_tree, loop);
+  }
+}
+
+
+bool LoopVectorizer::VectorizeLoop(LoopTree* loop_tree,
+                                   LoopTree::Loop* loop) {
+  VectorLoop match;
+  if (!MatchLoopHeader(loop_tree, loop, &match)) return false;
+  if (!MatchLoopBody(loop_tree, loop, &match)) return false;
+
+  // Split the body start into a diamond, guarded by all four lanes being
+  // in-bounds: {phi + 3 < length}.
+  Node* guard = graph()->NewNode(
+      simplified()->NumberLessThan(),
+      graph()->NewNode(simplified()->NumberAdd(), match.phi,
+                       jsgraph()->Constant(3)),
+      match.length);
+  Node* guard_branch = graph()->NewNode(common()->Branch(BranchHint::kTrue),
+                                        guard, match.if_true);
+  Node* if_packed = graph()->NewNode(common()->IfTrue(), guard_branch);
+  Node* if_scalar = graph()->NewNode(common()->IfFalse(), guard_branch);
+
+  // Compute the byte offset of lane zero once; the element size of both
+  // supported array types is four bytes.
+  Node* index = graph()->NewNode(machine()->Word32Shl(), match.phi,
+                                 jsgraph()->Int32Constant(2));
+  if (machine()->Is64()) {
+    index = graph()->NewNode(machine()->ChangeUint32ToUint64(), index);
+  }
+
+  // Build the packed body before mutating anything, so that a failed
+  // translation leaves only unreachable nodes behind.
+  PackedBodyBuilder builder(graph(), machine(), match, index, if_packed,
+                            zone());
+  Node* packed_effect = builder.Translate(match.effect_phi->InputAt(1));
+  if (packed_effect == nullptr) return false;
+  Node* packed_increment = graph()->NewNode(
+      simplified()->NumberAdd(), match.phi, jsgraph()->Constant(4));
+
+  // Move the scalar body and the backedge onto the false projection.
+  NodeVector body_uses(zone());
+  for (Node* use : match.if_true->uses()) {
+    if (use != guard_branch) body_uses.push_back(use);
+  }
+  for (Node* use : body_uses) {
+    for (Edge edge : use->input_edges()) {
+      if (edge.to() == match.if_true) edge.UpdateTo(if_scalar);
+    }
+  }
+
+  // Merge the two sides back into the backedge.
+  Node* merge = graph()->NewNode(common()->Merge(2), if_packed,
+                                 match.loop->InputAt(1));
+  match.loop->ReplaceInput(1, merge);
+  match.phi->ReplaceInput(
+      1, graph()->NewNode(common()->Phi(kMachAnyTagged, 2), packed_increment,
+                          match.increment, merge));
+  match.effect_phi->ReplaceInput(
+      1, graph()->NewNode(common()->EffectPhi(2), packed_effect,
+                          match.effect_phi->InputAt(1), merge));
+  return true;
+}
+
+
+CommonOperatorBuilder* LoopVectorizer::common() const {
+  return jsgraph()->common();
+}
+
+
+Graph* LoopVectorizer::graph() const { return jsgraph()->graph(); }
+
+
+MachineOperatorBuilder* LoopVectorizer::machine() const {
+  return jsgraph()->machine();
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
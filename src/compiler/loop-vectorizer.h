@@ -0,0 +1,52 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_LOOP_VECTORIZER_H_
+#define V8_COMPILER_LOOP_VECTORIZER_H_
+
+#include "src/compiler/loop-analysis.h"
+#include "src/compiler/simplified-operator.h"
+#include "src/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Forward declarations.
+class CommonOperatorBuilder;
+class JSGraph;
+class MachineOperatorBuilder;
+
+// Vectorizes innermost counted loops whose bodies consist entirely of
+// lane-wise arithmetic on contiguous typed array accesses, using the packed
+// 128-bit machine operators. Only loops matching a very restricted shape are
+// rewritten; everything else is left alone.
+class LoopVectorizer final {
+ public:
+  LoopVectorizer(JSGraph* jsgraph, Zone* zone);
+
+  void VectorizeLoops();
+
+ private:
+  bool VectorizeLoop(LoopTree* loop_tree, LoopTree::Loop* loop);
+
+  CommonOperatorBuilder* common() const;
+  Graph* graph() const;
+  JSGraph* jsgraph() const { return jsgraph_; }
+  MachineOperatorBuilder* machine() const;
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+  Zone* zone() const { return zone_; }
+
+  JSGraph* const jsgraph_;
+  SimplifiedOperatorBuilder simplified_;
+  Zone* const zone_;
+
+  DISALLOW_COPY_AND_ASSIGN(LoopVectorizer);
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_LOOP_VECTORIZER_H_
@@ -24,6 +24,8 @@ class MachineOperatorReducer final : public Reducer {
   explicit MachineOperatorReducer(JSGraph* jsgraph);
   ~MachineOperatorReducer();
 
+  const char* reducer_name() const override { return "MachineOperatorReducer"; }
+
   Reduction Reduce(Node* node) override;
 
  private:
@@ -83,7 +83,10 @@ class MachineOperatorBuilder final : public ZoneObject {
     kFloat64RoundTiesAway = 1u << 6,
     kInt32DivIsSafe = 1u << 7,
     kUint32DivIsSafe = 1u << 8,
-    kWord32ShiftIsSafe = 1u << 9
+    kWord32ShiftIsSafe = 1u << 9,
+    kSimd128 = 1u << 10,
+    kWord32Select = 1u << 11,
+    kWord64Select = 1u << 12
   };
   typedef base::Flags<Flag, unsigned> Flags;
 
@@ -99,7 +102,11 @@ class MachineOperatorBuilder final : public ZoneObject {
   const Operator* Word32Ror();
   const Operator* Word32Equal();
   const Operator* Word32Clz();
+  // Select(cond, vtrue, vfalse) as a conditional move; only usable when the
+  // corresponding flag reports back-end support.
+  const Operator* Word32Select();
   bool Word32ShiftIsSafe() const { return flags_ & kWord32ShiftIsSafe; }
+  bool Word32SelectIsSupported() const { return flags_ & kWord32Select; }
 
   const Operator* Word64And();
   const Operator* Word64Or();
@@ -109,6 +116,8 @@ class MachineOperatorBuilder final : public ZoneObject {
   const Operator* Word64Sar();
   const Operator* Word64Ror();
   const Operator* Word64Equal();
+  const Operator* Word64Select();
+  bool Word64SelectIsSupported() const { return flags_ & kWord64Select; }
 
   const Operator* Int32Add();
   const Operator* Int32AddWithOverflow();
@@ -158,6 +167,13 @@ class MachineOperatorBuilder final : public ZoneObject {
   const Operator* TruncateFloat64ToInt32();  // JavaScript semantics.
   const Operator* TruncateInt64ToInt32();
 
+  // These operators reinterpret the bits of a tagged pointer as a word and
+  // vice versa, without changing the value. They are needed e.g. for interior
+  // pointers into folded allocations, where the register allocator must keep
+  // treating the final tagged result as a reference.
+  const Operator* BitcastTaggedToWord();
+  const Operator* BitcastWordToTagged();
+
   // Floating point operators always operate with IEEE 754 round-to-nearest
   // (single-precision).
   const Operator* Float32Add();
@@ -211,6 +227,17 @@ class MachineOperatorBuilder final : public ZoneObject {
   bool HasFloat64RoundTruncate() { return flags_ & kFloat64RoundTruncate; }
   bool HasFloat64RoundTiesAway() { return flags_ & kFloat64RoundTiesAway; }
 
+  // Packed 128-bit operators, operating lane-wise on four 32-bit float or
+  // integer lanes. Only available on back-ends that advertise the kSimd128
+  // flag.
+  const Operator* Float32x4Add();
+  const Operator* Float32x4Sub();
+  const Operator* Float32x4Mul();
+  const Operator* Float32x4Div();
+  const Operator* Int32x4Add();
+  const Operator* Int32x4Sub();
+  bool HasSimd128() const { return flags_ & kSimd128; }
+
   // Floating point bit representation.
   const Operator* Float64ExtractLowWord32();
   const Operator* Float64ExtractHighWord32();
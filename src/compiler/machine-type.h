@@ -28,15 +28,16 @@ enum MachineType {
   kRepFloat32 = 1 << 5,
   kRepFloat64 = 1 << 6,
   kRepTagged = 1 << 7,
+  kRepSimd128 = 1 << 8,
 
   // Types.
-  kTypeBool = 1 << 8,
-  kTypeInt32 = 1 << 9,
-  kTypeUint32 = 1 << 10,
-  kTypeInt64 = 1 << 11,
-  kTypeUint64 = 1 << 12,
-  kTypeNumber = 1 << 13,
-  kTypeAny = 1 << 14,
+  kTypeBool = 1 << 9,
+  kTypeInt32 = 1 << 10,
+  kTypeUint32 = 1 << 11,
+  kTypeInt64 = 1 << 12,
+  kTypeUint64 = 1 << 13,
+  kTypeNumber = 1 << 14,
+  kTypeAny = 1 << 15,
 
   // Machine types.
   kMachNone = 0,
@@ -54,7 +55,8 @@ enum MachineType {
   kMachIntPtr = (kPointerSize == 4) ? kMachInt32 : kMachInt64,
   kMachUintPtr = (kPointerSize == 4) ? kMachUint32 : kMachUint64,
   kMachPtr = (kPointerSize == 4) ? kRepWord32 : kRepWord64,
-  kMachAnyTagged = kRepTagged | kTypeAny
+  kMachAnyTagged = kRepTagged | kTypeAny,
+  kMachSimd128 = kRepSimd128
 };
 
 std::ostream& operator<<(std::ostream& os, const MachineType& type);
@@ -64,7 +66,7 @@ typedef uint16_t MachineTypeUnion;
 // Globally useful machine types and constants.
 const MachineTypeUnion kRepMask = kRepBit | kRepWord8 | kRepWord16 |
                                   kRepWord32 | kRepWord64 | kRepFloat32 |
-                                  kRepFloat64 | kRepTagged;
+                                  kRepFloat64 | kRepTagged | kRepSimd128;
 const MachineTypeUnion kTypeMask = kTypeBool | kTypeInt32 | kTypeUint32 |
                                    kTypeInt64 | kTypeUint64 | kTypeNumber |
                                    kTypeAny;
@@ -98,6 +100,8 @@ inline int ElementSizeLog2Of(MachineType machine_type) {
       return 3;
     case kRepTagged:
       return kPointerSizeLog2;
+    case kRepSimd128:
+      return 4;
     default:
       break;
   }
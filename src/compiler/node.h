@@ -55,10 +55,18 @@ class Node final {
     return static_cast<IrOpcode::Value>(op_->opcode());
   }
 
-  NodeId id() const { return id_; }
+  NodeId id() const { return IdField::decode(bit_field_); }
 
-  int InputCount() const { return input_count(); }
-  Node* InputAt(int index) const { return GetInputRecordPtr(index)->to; }
+  int InputCount() const {
+    return has_inline_inputs() ? InlineCountField::decode(bit_field_)
+                               : outline_inputs()->count_;
+  }
+
+  Node* InputAt(int index) const {
+    DCHECK_LE(0, index);
+    DCHECK_LT(index, InputCount());
+    return *GetInputPtrConst(index);
+  }
   inline void ReplaceInput(int index, Node* new_to);
   void AppendInput(Zone* zone, Node* new_to);
   void InsertInput(Zone* zone, int index, Node* new_to);
@@ -142,50 +150,118 @@ class Node final {
   Uses uses() { return Uses(this); }
 
   // Returns true if {owner} is the user of {this} node.
-  bool OwnedBy(Node* owner) const {
-    return first_use_ && first_use_->from == owner && !first_use_->next;
-  }
+  inline bool OwnedBy(Node* owner) const;
 
   // Returns true if {owner1} and {owner2} are the only users of {this} node.
   bool OwnedBy(Node const* owner1, Node const* owner2) const;
 
+#ifdef DEBUG
+  void Verify();
+#else
+  inline void Verify() {}
+#endif
+
  private:
-  struct Use final : public ZoneObject {
-    Node* from;
+  // A link in the use chain of a node. {Use} links are laid out in memory
+  // directly before their {Node}, so that the node, the input pointer and
+  // the index can all be computed from the address of the use itself; see
+  // the memory layout comment below.
+  struct Use final {
     Use* next;
     Use* prev;
-    int input_index;
+    uint32_t bit_field_;
+
+    int input_index() const { return InputIndexField::decode(bit_field_); }
+    bool is_inline_use() const { return InlineField::decode(bit_field_); }
+    inline Node** input_ptr();
+    inline Node* from();
+
+    typedef BitField<bool, 0, 1> InlineField;
+    typedef BitField<unsigned, 1, 17> InputIndexField;
+    // Leaving some space in the bitfield in case we ever need to record the
+    // output index.
   };
 
-  class Input final {
-   public:
-    Node* to;
-    Use* use;
+  //============================================================================
+  //== Memory layout ===========================================================
+  //============================================================================
+  // Saving space for big graphs is important. We use a memory layout trick to
+  // be able to map {Node} objects to {Use} objects and vice-versa in a
+  // space-efficient manner.
+  //
+  // {Use} links are laid out in memory directly before a {Node}, followed by
+  // direct pointers to input {Node}s.
+  //
+  // inline case:
+  // |Use #N  |Use #N-1|...|Use #1  |Use #0  |Node xxxx |I#0|I#1|...|I#N-1|I#N|
+  //          ^                              ^                  ^
+  //          + Use                          + Node             + Input
+  //
+  // Small inputs count (<= kMaxInlineCapacity) are inlined directly behind
+  // the node, so that for the common arities the node, its inputs and its
+  // uses share one or two cache lines.
+  //
+  // out-of-line case:
+  //     |Node xxxx |
+  //     ^       + outline ------------------+
+  //     +----------------------------------------+
+  //                                         |    |
+  //                                         v    | node
+  // |Use #N  |Use #N-1|...|Use #1  |Use #0  |OOL xxxxx |I#0|I#1|...|I#N-1|I#N|
+  //          ^                                                 ^
+  //          + Use                                             + Input
+  //
+  // Out-of-line storage is only used for input counts that exceed the inline
+  // capacity, or when appending inputs would overflow it.
+
+  struct OutOfLineInputs final {
+    Node* node_;
+    int count_;
+    int capacity_;
 
-    void Update(Node* new_to);
+    // Inputs are allocated right behind the OutOfLineInputs instance.
+    inline Node** inputs();
+
+    static OutOfLineInputs* New(Zone* zone, int capacity);
+    void ExtractFrom(Use* use_ptr, Node** input_ptr, int count);
   };
 
-  inline Node(NodeId id, const Operator* op, int input_count,
-              int reserve_input_count);
+  inline Node(NodeId id, const Operator* op, int inline_count,
+              int inline_capacity);
+
+  Node* const* GetInputPtrConst(int input_index) const {
+    return has_inline_inputs() ? &(inline_inputs()[input_index])
+                               : &(outline_inputs()->inputs()[input_index]);
+  }
+  Node** GetInputPtr(int input_index) {
+    return has_inline_inputs() ? &(inline_inputs()[input_index])
+                               : &(outline_inputs()->inputs()[input_index]);
+  }
+  Use* GetUsePtr(int input_index) {
+    Use* ptr = has_inline_inputs() ? reinterpret_cast<Use*>(this)
+                                   : reinterpret_cast<Use*>(outline_inputs());
+    return &ptr[-1 - input_index];
+  }
 
-  inline void EnsureAppendableInputs(Zone* zone);
+  inline char* inputs_location() const {
+    return reinterpret_cast<char*>(const_cast<Node*>(this)) + sizeof(Node);
+  }
 
-  Input* GetInputRecordPtr(int index) {
-    return has_appendable_inputs() ? &((*inputs_.appendable_)[index])
-                                   : &inputs_.static_[index];
+  Node** inline_inputs() const {
+    return reinterpret_cast<Node**>(inputs_location());
+  }
+  OutOfLineInputs* outline_inputs() const {
+    return *reinterpret_cast<OutOfLineInputs**>(inputs_location());
   }
-  const Input* GetInputRecordPtr(int index) const {
-    return has_appendable_inputs() ? &((*inputs_.appendable_)[index])
-                                   : &inputs_.static_[index];
+  void set_outline_inputs(OutOfLineInputs* outline) {
+    *reinterpret_cast<OutOfLineInputs**>(inputs_location()) = outline;
   }
 
-  inline void AppendUse(Use* const use);
-  inline void RemoveUse(Use* const use);
+  void AppendUse(Use* const use);
+  void RemoveUse(Use* const use);
 
   void* operator new(size_t, void* location) { return location; }
 
-  typedef ZoneDeque<Input> InputDeque;
-
   // Only NodeProperties should manipulate the bounds.
   Bounds bounds() { return bounds_; }
   void set_bounds(Bounds b) { bounds_ = b; }
@@ -194,48 +270,23 @@ class Node final {
   Mark mark() { return mark_; }
   void set_mark(Mark mark) { mark_ = mark; }
 
-  int input_count() const { return InputCountField::decode(bit_field_); }
-  void set_input_count(int input_count) {
-    DCHECK_LE(0, input_count);
-    bit_field_ = InputCountField::update(bit_field_, input_count);
+  bool has_inline_inputs() const {
+    return InlineCountField::decode(bit_field_) != kOutlineMarker;
   }
 
-  int reserved_input_count() const {
-    return ReservedInputCountField::decode(bit_field_);
-  }
-  void set_reserved_input_count(int reserved_input_count) {
-    DCHECK_LE(0, reserved_input_count);
-    bit_field_ =
-        ReservedInputCountField::update(bit_field_, reserved_input_count);
-  }
-
-  bool has_appendable_inputs() const {
-    return HasAppendableInputsField::decode(bit_field_);
-  }
-  void set_has_appendable_inputs(bool has_appendable_inputs) {
-    bit_field_ =
-        HasAppendableInputsField::update(bit_field_, has_appendable_inputs);
-  }
+  void ClearInputs(int start, int count);
 
-  typedef BitField<unsigned, 0, 29> InputCountField;
-  typedef BitField<unsigned, 29, 2> ReservedInputCountField;
-  typedef BitField<unsigned, 31, 1> HasAppendableInputsField;
-  static const int kDefaultReservedInputs = ReservedInputCountField::kMax;
+  typedef BitField<NodeId, 0, 24> IdField;
+  typedef BitField<unsigned, 24, 4> InlineCountField;
+  typedef BitField<unsigned, 28, 4> InlineCapacityField;
+  static const int kOutlineMarker = InlineCountField::kMax;
+  static const int kMaxInlineCapacity = InlineCapacityField::kMax - 1;
 
   const Operator* op_;
   Bounds bounds_;
   Mark mark_;
-  NodeId const id_;
-  unsigned bit_field_;
+  uint32_t bit_field_;
   Use* first_use_;
-  union {
-    // When a node is initially allocated, it uses a static buffer to hold its
-    // inputs under the assumption that the number of outputs will not increase.
-    // When the first input is appended, the static buffer is converted into a
-    // deque to allow for space-efficient growing.
-    Input static_[1];
-    InputDeque* appendable_;
-  } inputs_;
 
   friend class Edge;
   friend class NodeMarkerBase;
@@ -248,6 +299,34 @@ class Node final {
 std::ostream& operator<<(std::ostream& os, const Node& n);
 
 
+Node** Node::OutOfLineInputs::inputs() {
+  return reinterpret_cast<Node**>(reinterpret_cast<char*>(this) +
+                                  sizeof(Node::OutOfLineInputs));
+}
+
+
+Node** Node::Use::input_ptr() {
+  int index = input_index();
+  Use* start = this + 1 + index;
+  Node** inputs = is_inline_use()
+                      ? reinterpret_cast<Node*>(start)->inline_inputs()
+                      : reinterpret_cast<OutOfLineInputs*>(start)->inputs();
+  return &inputs[index];
+}
+
+
+Node* Node::Use::from() {
+  Use* start = this + 1 + input_index();
+  return is_inline_use() ? reinterpret_cast<Node*>(start)
+                         : reinterpret_cast<OutOfLineInputs*>(start)->node_;
+}
+
+
+bool Node::OwnedBy(Node* owner) const {
+  return first_use_ && first_use_->from() == owner && !first_use_->next;
+}
+
+
 // Typedefs to shorten commonly used Node containers.
 typedef ZoneDeque<Node*> NodeDeque;
 typedef ZoneSet<Node*> NodeSet;
@@ -267,26 +346,38 @@ static inline const T& OpParameter(const Node* node) {
 // the node having the input.
 class Edge final {
  public:
-  Node* from() const { return input_->use->from; }
-  Node* to() const { return input_->to; }
+  Node* from() const { return use_->from(); }
+  Node* to() const { return *input_ptr_; }
   int index() const {
-    int const index = input_->use->input_index;
-    DCHECK_LT(index, input_->use->from->input_count());
+    int const index = use_->input_index();
+    DCHECK_LT(index, use_->from()->InputCount());
     return index;
   }
 
-  bool operator==(const Edge& other) { return input_ == other.input_; }
+  bool operator==(const Edge& other) { return input_ptr_ == other.input_ptr_; }
   bool operator!=(const Edge& other) { return !(*this == other); }
 
-  void UpdateTo(Node* new_to) { input_->Update(new_to); }
+  void UpdateTo(Node* new_to) {
+    Node* old_to = *input_ptr_;
+    if (old_to != new_to) {
+      if (old_to) old_to->RemoveUse(use_);
+      *input_ptr_ = new_to;
+      if (new_to) new_to->AppendUse(use_);
+    }
+  }
 
  private:
   friend class Node::UseEdges::iterator;
   friend class Node::InputEdges::iterator;
 
-  explicit Edge(Node::Input* input) : input_(input) { DCHECK_NOT_NULL(input); }
+  Edge(Node::Use* use, Node** input_ptr) : use_(use), input_ptr_(input_ptr) {
+    DCHECK_NOT_NULL(use);
+    DCHECK_NOT_NULL(input_ptr);
+    DCHECK_EQ(input_ptr, use->input_ptr());
+  }
 
-  Node::Input* input_;
+  Node::Use* use_;
+  Node** input_ptr_;
 };
 
 
@@ -299,16 +390,18 @@ class Node::InputEdges::iterator final {
   typedef Edge* pointer;
   typedef Edge& reference;
 
-  iterator() : input_(nullptr) {}
-  iterator(const iterator& other) : input_(other.input_) {}
+  iterator() : use_(nullptr), input_ptr_(nullptr) {}
+  iterator(const iterator& other)
+      : use_(other.use_), input_ptr_(other.input_ptr_) {}
 
-  Edge operator*() const { return Edge(input_); }
+  Edge operator*() const { return Edge(use_, input_ptr_); }
   bool operator==(const iterator& other) const {
-    return input_ == other.input_;
+    return input_ptr_ == other.input_ptr_;
   }
   bool operator!=(const iterator& other) const { return !(*this == other); }
   iterator& operator++() {
-    SetInput(Edge(input_).from(), input_->use->input_index + 1);
+    input_ptr_++;
+    use_--;
     return *this;
   }
   iterator operator++(int);
@@ -316,20 +409,11 @@ class Node::InputEdges::iterator final {
  private:
   friend class Node;
 
-  explicit iterator(Node* from, int index = 0) : input_(nullptr) {
-    SetInput(from, index);
-  }
+  explicit iterator(Node* from, int index = 0)
+      : use_(from->GetUsePtr(index)), input_ptr_(from->GetInputPtr(index)) {}
 
-  void SetInput(Node* from, int index) {
-    DCHECK(index >= 0 && index <= from->InputCount());
-    if (index < from->InputCount()) {
-      input_ = from->GetInputRecordPtr(index);
-    } else {
-      input_ = nullptr;
-    }
-  }
-
-  Input* input_;
+  Node::Use* use_;
+  Node** input_ptr_;
 };
 
 
@@ -392,9 +476,7 @@ class Node::UseEdges::iterator final {
   iterator(const iterator& other)
       : current_(other.current_), next_(other.next_) {}
 
-  Edge operator*() const {
-    return Edge(current_->from->GetInputRecordPtr(current_->input_index));
-  }
+  Edge operator*() const { return Edge(current_, current_->input_ptr()); }
 
   bool operator==(const iterator& other) const {
     return current_ == other.current_;
@@ -442,7 +524,7 @@ class Node::Uses::const_iterator final {
 
   const_iterator(const const_iterator& other) : current_(other.current_) {}
 
-  Node* operator*() const { return current_->from; }
+  Node* operator*() const { return current_->from(); }
   bool operator==(const const_iterator& other) const {
     return other.current_ == current_;
   }
@@ -475,7 +557,16 @@ Node::Uses::const_iterator Node::Uses::end() const { return const_iterator(); }
 
 
 void Node::ReplaceInput(int index, Node* new_to) {
-  GetInputRecordPtr(index)->Update(new_to);
+  DCHECK_LE(0, index);
+  DCHECK_LT(index, InputCount());
+  Node** input_ptr = GetInputPtr(index);
+  Node* old_to = *input_ptr;
+  if (old_to != new_to) {
+    Use* use = GetUsePtr(index);
+    if (old_to) old_to->RemoveUse(use);
+    *input_ptr = new_to;
+    if (new_to) new_to->AppendUse(use);
+  }
 }
 
 }  // namespace compiler
@@ -213,6 +213,7 @@
   V(Word32Sar)                  \
   V(Word32Ror)                  \
   V(Word32Clz)                  \
+  V(Word32Select)               \
   V(Word64And)                  \
   V(Word64Or)                   \
   V(Word64Xor)                  \
@@ -220,6 +221,7 @@
   V(Word64Shr)                  \
   V(Word64Sar)                  \
   V(Word64Ror)                  \
+  V(Word64Select)               \
   V(Int32Add)                   \
   V(Int32AddWithOverflow)       \
   V(Int32Sub)                   \
@@ -248,6 +250,8 @@
   V(TruncateFloat64ToFloat32)   \
   V(TruncateFloat64ToInt32)     \
   V(TruncateInt64ToInt32)       \
+  V(BitcastTaggedToWord)        \
+  V(BitcastWordToTagged)        \
   V(Float32Add)                 \
   V(Float32Sub)                 \
   V(Float32Mul)                 \
@@ -272,6 +276,12 @@
   V(Float64ExtractHighWord32)   \
   V(Float64InsertLowWord32)     \
   V(Float64InsertHighWord32)    \
+  V(Float32x4Add)               \
+  V(Float32x4Sub)               \
+  V(Float32x4Mul)               \
+  V(Float32x4Div)               \
+  V(Int32x4Add)                 \
+  V(Int32x4Sub)                 \
   V(LoadStackPointer)           \
   V(CheckedLoad)                \
   V(CheckedStore)
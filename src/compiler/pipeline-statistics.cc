@@ -68,6 +68,18 @@ PipelineStatistics::~PipelineStatistics() {
 }
 
 
+void PipelineStatistics::RecordReducerStats(const char* reducer_name,
+                                            base::TimeDelta elapsed,
+                                            size_t visited_nodes,
+                                            size_t changed_nodes) {
+  CompilationStatistics::ReducerStats stats;
+  stats.delta_ = elapsed;
+  stats.visited_nodes_ = visited_nodes;
+  stats.changed_nodes_ = changed_nodes;
+  compilation_stats_->RecordReducerStats(reducer_name, stats);
+}
+
+
 void PipelineStatistics::BeginPhaseKind(const char* phase_kind_name) {
   DCHECK(!InPhase());
   if (InPhaseKind()) EndPhaseKind();
@@ -9,6 +9,7 @@
 
 #include "src/compilation-statistics.h"
 #include "src/compiler/zone-pool.h"
+#include "src/tracing/trace-event.h"
 
 namespace v8 {
 namespace internal {
@@ -23,6 +24,11 @@ class PipelineStatistics : public Malloced {
 
   void BeginPhaseKind(const char* phase_kind_name);
 
+  // Accumulate per-reducer counters reported by the graph reducer; see
+  // GraphReducer for the producing side.
+  void RecordReducerStats(const char* reducer_name, base::TimeDelta elapsed,
+                          size_t visited_nodes, size_t changed_nodes);
+
  private:
   size_t OuterZoneSize() {
     return static_cast<size_t>(outer_zone_->allocation_size());
@@ -75,7 +81,8 @@ class PipelineStatistics : public Malloced {
 class PhaseScope {
  public:
   PhaseScope(PipelineStatistics* pipeline_stats, const char* name)
-      : pipeline_stats_(pipeline_stats) {
+      : pipeline_stats_(pipeline_stats),
+        tracer_(tracing::GetCategoryGroupEnabled("v8.compile"), name) {
     if (pipeline_stats_ != NULL) pipeline_stats_->BeginPhase(name);
   }
   ~PhaseScope() {
@@ -84,6 +91,7 @@ class PhaseScope {
 
  private:
   PipelineStatistics* const pipeline_stats_;
+  tracing::ScopedTracer tracer_;
 
   DISALLOW_COPY_AND_ASSIGN(PhaseScope);
 };
@@ -9,6 +9,7 @@
 
 #include "src/base/adapters.h"
 #include "src/base/platform/elapsed-timer.h"
+#include "src/compiler/allocation-folding.h"
 #include "src/compiler/ast-graph-builder.h"
 #include "src/compiler/ast-loop-assignment-analyzer.h"
 #include "src/compiler/basic-block-instrumentor.h"
@@ -17,10 +18,12 @@
 #include "src/compiler/common-operator-reducer.h"
 #include "src/compiler/control-flow-optimizer.h"
 #include "src/compiler/control-reducer.h"
+#include "src/compiler/escape-analysis.h"
 #include "src/compiler/frame-elider.h"
 #include "src/compiler/graph-replay.h"
 #include "src/compiler/graph-visualizer.h"
 #include "src/compiler/instruction.h"
+#include "src/compiler/instruction-scheduler.h"
 #include "src/compiler/instruction-selector.h"
 #include "src/compiler/js-builtin-reducer.h"
 #include "src/compiler/js-context-specialization.h"
@@ -33,6 +36,8 @@
 #include "src/compiler/load-elimination.h"
 #include "src/compiler/loop-analysis.h"
 #include "src/compiler/loop-peeling.h"
+#include "src/compiler/loop-unrolling.h"
+#include "src/compiler/loop-vectorizer.h"
 #include "src/compiler/machine-operator-reducer.h"
 #include "src/compiler/move-optimizer.h"
 #include "src/compiler/osr.h"
@@ -49,6 +54,7 @@
 #include "src/compiler/value-numbering-reducer.h"
 #include "src/compiler/verifier.h"
 #include "src/compiler/zone-pool.h"
+#include "src/deoptimizer.h"
 #include "src/ostreams.h"
 #include "src/type-info.h"
 #include "src/utils.h"
@@ -69,6 +75,8 @@ class PipelineData {
         pipeline_statistics_(pipeline_statistics),
         compilation_failed_(false),
         code_(Handle<Code>::null()),
+        code_generator_(nullptr),
+        profiler_data_(nullptr),
         graph_zone_scope_(zone_pool_),
         graph_zone_(graph_zone_scope_.zone()),
         graph_(nullptr),
@@ -110,6 +118,8 @@ class PipelineData {
         pipeline_statistics_(nullptr),
         compilation_failed_(false),
         code_(Handle<Code>::null()),
+        code_generator_(nullptr),
+        profiler_data_(nullptr),
         graph_zone_scope_(zone_pool_),
         graph_zone_(nullptr),
         graph_(graph),
@@ -140,6 +150,8 @@ class PipelineData {
         pipeline_statistics_(nullptr),
         compilation_failed_(false),
         code_(Handle<Code>::null()),
+        code_generator_(nullptr),
+        profiler_data_(nullptr),
         graph_zone_scope_(zone_pool_),
         graph_zone_(nullptr),
         graph_(nullptr),
@@ -160,6 +172,7 @@ class PipelineData {
         register_allocation_data_(nullptr) {}
 
   ~PipelineData() {
+    delete code_generator_;
     DeleteRegisterAllocationZone();
     DeleteInstructionZone();
     DeleteGraphZone();
@@ -177,6 +190,24 @@ class PipelineData {
     code_ = code;
   }
 
+  CodeGenerator* code_generator() const { return code_generator_; }
+  void set_code_generator(CodeGenerator* code_generator) {
+    DCHECK(code_generator_ == nullptr);
+    code_generator_ = code_generator;
+  }
+
+  BasicBlockProfiler::Data* profiler_data() const { return profiler_data_; }
+  void set_profiler_data(BasicBlockProfiler::Data* profiler_data) {
+    profiler_data_ = profiler_data;
+  }
+
+  std::string const& source_position_output() const {
+    return source_position_output_;
+  }
+  void set_source_position_output(std::string const& source_position_output) {
+    source_position_output_ = source_position_output;
+  }
+
   // RawMachineAssembler generally produces graphs which cannot be verified.
   bool MayHaveUnverifiableGraph() const { return outer_zone_ == nullptr; }
 
@@ -276,6 +307,9 @@ class PipelineData {
   PipelineStatistics* pipeline_statistics_;
   bool compilation_failed_;
   Handle<Code> code_;
+  CodeGenerator* code_generator_;
+  BasicBlockProfiler::Data* profiler_data_;
+  std::string source_position_output_;
 
   // All objects in the following group of fields are allocated in graph_zone_.
   // They are all set to NULL when the graph_zone_ is destroyed.
@@ -397,6 +431,8 @@ class SourcePositionWrapper final : public Reducer {
       : reducer_(reducer), table_(table) {}
   ~SourcePositionWrapper() final {}
 
+  const char* reducer_name() const final { return reducer_->reducer_name(); }
+
   Reduction Reduce(Node* node) final {
     SourcePosition const pos = table_->GetSourcePosition(node);
     SourcePositionTable::Scope position(table_, pos);
@@ -489,7 +525,8 @@ struct ContextSpecializerPhase {
 
   void Run(PipelineData* data, Zone* temp_zone) {
     JSContextSpecializer spec(data->jsgraph());
-    GraphReducer graph_reducer(data->graph(), temp_zone);
+    GraphReducer graph_reducer(data->graph(), temp_zone,
+                               data->pipeline_statistics());
     AddReducer(data, &graph_reducer, &spec);
     graph_reducer.ReduceGraph();
   }
@@ -500,7 +537,8 @@ struct InliningPhase {
   static const char* phase_name() { return "inlining"; }
 
   void Run(PipelineData* data, Zone* temp_zone) {
-    GraphReducer graph_reducer(data->graph(), temp_zone);
+    GraphReducer graph_reducer(data->graph(), temp_zone,
+                               data->pipeline_statistics());
     JSInliner inliner(&graph_reducer, data->info()->is_inlining_enabled()
                                           ? JSInliner::kGeneralInlining
                                           : JSInliner::kBuiltinsInlining,
@@ -536,7 +574,8 @@ struct JSTypeFeedbackPhase {
     TypeFeedbackOracle oracle(data->isolate(), temp_zone,
                               data->info()->unoptimized_code(),
                               data->info()->feedback_vector(), native_context);
-    GraphReducer graph_reducer(data->graph(), temp_zone);
+    GraphReducer graph_reducer(data->graph(), temp_zone,
+                               data->pipeline_statistics());
     Handle<GlobalObject> global_object = Handle<GlobalObject>::null();
     if (data->info()->has_global_object()) {
       global_object =
@@ -557,8 +596,9 @@ struct TypedLoweringPhase {
   static const char* phase_name() { return "typed lowering"; }
 
   void Run(PipelineData* data, Zone* temp_zone) {
-    GraphReducer graph_reducer(data->graph(), temp_zone);
-    LoadElimination load_elimination;
+    GraphReducer graph_reducer(data->graph(), temp_zone,
+                               data->pipeline_statistics());
+    LoadElimination load_elimination(&graph_reducer, temp_zone);
     JSBuiltinReducer builtin_reducer(data->jsgraph());
     JSTypedLowering typed_lowering(&graph_reducer, data->jsgraph(), temp_zone);
     JSIntrinsicLowering intrinsic_lowering(data->jsgraph());
@@ -575,6 +615,32 @@ struct TypedLoweringPhase {
 };
 
 
+struct EscapeAnalysisPhase {
+  static const char* phase_name() { return "escape analysis"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    GraphReducer graph_reducer(data->graph(), temp_zone,
+                               data->pipeline_statistics());
+    EscapeAnalysis escape_analysis(temp_zone);
+    AddReducer(data, &graph_reducer, &escape_analysis);
+    graph_reducer.ReduceGraph();
+  }
+};
+
+
+struct AllocationFoldingPhase {
+  static const char* phase_name() { return "allocation folding"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    GraphReducer graph_reducer(data->graph(), temp_zone,
+                               data->pipeline_statistics());
+    AllocationFolding allocation_folding(data->jsgraph(), temp_zone);
+    AddReducer(data, &graph_reducer, &allocation_folding);
+    graph_reducer.ReduceGraph();
+  }
+};
+
+
 struct SimplifiedLoweringPhase {
   static const char* phase_name() { return "simplified lowering"; }
 
@@ -586,7 +652,8 @@ struct SimplifiedLoweringPhase {
     SimplifiedOperatorReducer simple_reducer(data->jsgraph());
     MachineOperatorReducer machine_reducer(data->jsgraph());
     CommonOperatorReducer common_reducer(data->jsgraph());
-    GraphReducer graph_reducer(data->graph(), temp_zone);
+    GraphReducer graph_reducer(data->graph(), temp_zone,
+                               data->pipeline_statistics());
     AddReducer(data, &graph_reducer, &vn_reducer);
     AddReducer(data, &graph_reducer, &simple_reducer);
     AddReducer(data, &graph_reducer, &machine_reducer);
@@ -615,7 +682,8 @@ struct ChangeLoweringPhase {
     ChangeLowering lowering(data->jsgraph());
     MachineOperatorReducer machine_reducer(data->jsgraph());
     CommonOperatorReducer common_reducer(data->jsgraph());
-    GraphReducer graph_reducer(data->graph(), temp_zone);
+    GraphReducer graph_reducer(data->graph(), temp_zone,
+                               data->pipeline_statistics());
     AddReducer(data, &graph_reducer, &vn_reducer);
     AddReducer(data, &graph_reducer, &simple_reducer);
     AddReducer(data, &graph_reducer, &lowering);
@@ -657,15 +725,40 @@ struct StressLoopPeelingPhase {
 };
 
 
+struct LoopUnrollingPhase {
+  static const char* phase_name() { return "loop unrolling"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(data->graph(), temp_zone);
+    if (loop_tree != NULL) {
+      LoopUnroller::UnrollLoops(data->graph(), data->common(), loop_tree,
+                                temp_zone);
+    }
+  }
+};
+
+
+struct LoopVectorizationPhase {
+  static const char* phase_name() { return "loop vectorization"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    LoopVectorizer vectorizer(data->jsgraph(), temp_zone);
+    vectorizer.VectorizeLoops();
+  }
+};
+
+
 struct GenericLoweringPhase {
   static const char* phase_name() { return "generic lowering"; }
 
   void Run(PipelineData* data, Zone* temp_zone) {
     JSGenericLowering generic(data->info()->is_typing_enabled(),
                               data->jsgraph());
-    SelectLowering select(data->jsgraph()->graph(), data->jsgraph()->common());
+    SelectLowering select(data->jsgraph()->graph(), data->jsgraph()->common(),
+                          data->jsgraph()->machine());
     TailCallOptimization tco(data->common(), data->graph());
-    GraphReducer graph_reducer(data->graph(), temp_zone);
+    GraphReducer graph_reducer(data->graph(), temp_zone,
+                               data->pipeline_statistics());
     AddReducer(data, &graph_reducer, &generic);
     AddReducer(data, &graph_reducer, &select);
     // TODO(turbofan): TCO is currently limited to stubs.
@@ -837,6 +930,16 @@ struct FrameElisionPhase {
 };
 
 
+struct ScheduleInstructionsPhase {
+  static const char* phase_name() { return "schedule instructions"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    InstructionScheduler scheduler(temp_zone, data->sequence());
+    scheduler.ScheduleSequence();
+  }
+};
+
+
 struct JumpThreadingPhase {
   static const char* phase_name() { return "jump threading"; }
 
@@ -849,13 +952,23 @@ struct JumpThreadingPhase {
 };
 
 
-struct GenerateCodePhase {
-  static const char* phase_name() { return "generate code"; }
+struct AssembleCodePhase {
+  static const char* phase_name() { return "assemble code"; }
 
   void Run(PipelineData* data, Zone* temp_zone, Linkage* linkage) {
-    CodeGenerator generator(data->frame(), linkage, data->sequence(),
-                            data->info());
-    data->set_code(generator.GenerateCode());
+    data->set_code_generator(new CodeGenerator(data->frame(), linkage,
+                                               data->sequence(),
+                                               data->info()));
+    data->code_generator()->AssembleCode();
+  }
+};
+
+
+struct FinalizeCodePhase {
+  static const char* phase_name() { return "finalize code"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    data->set_code(data->code_generator()->FinalizeCode());
   }
 };
 
@@ -921,7 +1034,26 @@ void Pipeline::RunPrintAndVerify(const char* phase, bool untyped) {
 }
 
 
+Pipeline::~Pipeline() {
+  // When the pipeline has been run in phases (see CreateGraph), the pipeline
+  // state is owned here; the testing entry points instead point {data_} at
+  // caller-owned state.
+  if (zone_pool_ != nullptr) {
+    delete data_;
+    delete pipeline_statistics_;
+    delete zone_pool_;
+  }
+}
+
+
 Handle<Code> Pipeline::GenerateCode() {
+  if (!CreateGraph()) return Handle<Code>::null();
+  if (!OptimizeGraph()) return Handle<Code>::null();
+  return FinalizeCode();
+}
+
+
+bool Pipeline::CreateGraph() {
   // TODO(mstarzinger): This is just a temporary hack to make TurboFan work,
   // the correct solution is to restore the context register after invoking
   // builtins from full-codegen.
@@ -929,21 +1061,21 @@ Handle<Code> Pipeline::GenerateCode() {
   for (int i = 0; i < Builtins::NumberOfJavaScriptBuiltins(); i++) {
     Builtins::JavaScript id = static_cast<Builtins::JavaScript>(i);
     Object* builtin = isolate()->js_builtins_object()->javascript_builtin(id);
-    if (*info()->closure() == builtin) return Handle<Code>::null();
+    if (*info()->closure() == builtin) return false;
   }
 
   // TODO(dslomov): support turbo optimization of subclass constructors.
   if (IsSubclassConstructor(shared->kind())) {
     shared->DisableOptimization(kSuperReference);
-    return Handle<Code>::null();
+    return false;
   }
 
-  ZonePool zone_pool;
-  SmartPointer<PipelineStatistics> pipeline_statistics;
+  DCHECK(zone_pool_ == nullptr);
+  zone_pool_ = new ZonePool();
 
   if (FLAG_turbo_stats) {
-    pipeline_statistics.Reset(new PipelineStatistics(info(), &zone_pool));
-    pipeline_statistics->BeginPhaseKind("initializing");
+    pipeline_statistics_ = new PipelineStatistics(info(), zone_pool_);
+    pipeline_statistics_->BeginPhaseKind("initializing");
   }
 
   if (FLAG_trace_turbo) {
@@ -972,12 +1104,11 @@ Handle<Code> Pipeline::GenerateCode() {
     }
   }
 
-  PipelineData data(&zone_pool, info(), pipeline_statistics.get());
-  this->data_ = &data;
+  data_ = new PipelineData(zone_pool_, info(), pipeline_statistics_);
 
   if (info()->is_type_feedback_enabled()) {
-    data.set_js_type_feedback(new (data.graph_zone())
-                                  JSTypeFeedbackTable(data.graph_zone()));
+    data_->set_js_type_feedback(new (data_->graph_zone())
+                                    JSTypeFeedbackTable(data_->graph_zone()));
   }
 
   BeginPhaseKind("graph creation");
@@ -991,14 +1122,14 @@ Handle<Code> Pipeline::GenerateCode() {
     tcf << AsC1VCompilation(info());
   }
 
-  data.source_positions()->AddDecorator();
+  data_->source_positions()->AddDecorator();
 
   if (FLAG_loop_assignment_analysis) {
     Run<LoopAssignmentAnalysisPhase>();
   }
 
   Run<GraphBuilderPhase>(info()->is_context_specializing());
-  if (data.compilation_failed()) return Handle<Code>::null();
+  if (data_->compilation_failed()) return false;
   RunPrintAndVerify("Initial untyped", true);
 
   Run<EarlyControlReductionPhase>();
@@ -1017,11 +1148,11 @@ Handle<Code> Pipeline::GenerateCode() {
 
   if (FLAG_print_turbo_replay) {
     // Print a replay of the initial graph.
-    GraphReplayPrinter::PrintReplay(data.graph());
+    GraphReplayPrinter::PrintReplay(data_->graph());
   }
 
   // Bailout here in case target architecture is not supported.
-  if (!SupportedTarget()) return Handle<Code>::null();
+  if (!SupportedTarget()) return false;
 
   if (info()->is_typing_enabled()) {
     // Type the graph.
@@ -1036,6 +1167,11 @@ Handle<Code> Pipeline::GenerateCode() {
     Run<TypedLoweringPhase>();
     RunPrintAndVerify("Lowered typed");
 
+    if (FLAG_turbo_escape) {
+      Run<EscapeAnalysisPhase>();
+      RunPrintAndVerify("Escape analysis");
+    }
+
     if (FLAG_turbo_stress_loop_peeling) {
       Run<StressLoopPeelingPhase>();
       RunPrintAndVerify("Loop peeled", true);
@@ -1053,6 +1189,28 @@ Handle<Code> Pipeline::GenerateCode() {
       RunPrintAndVerify("JSType feedback");
     }
 
+    // Unroll small counted loops before simplified lowering, so that the
+    // unrolled iterations can share the checks that lowering eliminates.
+    if (FLAG_turbo_loop_unrolling) {
+      Run<LoopUnrollingPhase>();
+      RunPrintAndVerify("Loops unrolled", true);
+    }
+
+    // Vectorize counted loops over typed arrays while the buffer accesses
+    // are still recognizable, i.e. before they are lowered to machine loads
+    // and stores.
+    if (FLAG_turbo_vectorize) {
+      Run<LoopVectorizationPhase>();
+      RunPrintAndVerify("Loops vectorized", true);
+    }
+
+    // Fold consecutive allocations while they are still recognizable as
+    // such, i.e. before they are lowered to allocation calls.
+    if (FLAG_turbo_allocation_folding) {
+      Run<AllocationFoldingPhase>();
+      RunPrintAndVerify("Allocations folded", true);
+    }
+
     // Lower simplified operators and insert changes.
     Run<SimplifiedLoweringPhase>();
     RunPrintAndVerify("Lowered simplified");
@@ -1073,7 +1231,7 @@ Handle<Code> Pipeline::GenerateCode() {
   } else {
     if (info()->is_osr()) {
       Run<OsrDeconstructionPhase>();
-      if (info()->bailout_reason() != kNoReason) return Handle<Code>::null();
+      if (info()->bailout_reason() != kNoReason) return false;
       RunPrintAndVerify("OSR deconstruction");
     }
   }
@@ -1083,12 +1241,30 @@ Handle<Code> Pipeline::GenerateCode() {
   // TODO(jarin, rossberg): Remove UNTYPED once machine typing works.
   RunPrintAndVerify("Lowered generic", true);
 
-  BeginPhaseKind("block building");
+  data_->source_positions()->RemoveDecorator();
 
-  data.source_positions()->RemoveDecorator();
+  // Deoptimization entry points are generated lazily on first use, which
+  // would allocate code on the isolate's heap during assembly. Make sure
+  // they all exist up front, so that OptimizeGraph can run on the
+  // concurrent recompilation thread.
+  if (info()->is_deoptimization_enabled()) {
+    Deoptimizer::EnsureCodeForDeoptimizationEntry(
+        isolate(), Deoptimizer::EAGER, Deoptimizer::kMaxNumberOfEntries - 1);
+    Deoptimizer::EnsureCodeForDeoptimizationEntry(
+        isolate(), Deoptimizer::SOFT, Deoptimizer::kMaxNumberOfEntries - 1);
+    Deoptimizer::EnsureCodeForDeoptimizationEntry(
+        isolate(), Deoptimizer::LAZY, Deoptimizer::kMaxNumberOfEntries - 1);
+  }
 
-  return ScheduleAndGenerateCode(
-      Linkage::ComputeIncoming(data.instruction_zone(), info()));
+  return true;
+}
+
+
+bool Pipeline::OptimizeGraph() {
+  BeginPhaseKind("block building");
+
+  return ScheduleAndAssembleCode(
+      Linkage::ComputeIncoming(data_->instruction_zone(), info()));
 }
 
 
@@ -1151,6 +1327,12 @@ bool Pipeline::AllocateRegistersForTesting(const RegisterConfiguration* config,
 
 Handle<Code> Pipeline::ScheduleAndGenerateCode(
     CallDescriptor* call_descriptor) {
+  if (!ScheduleAndAssembleCode(call_descriptor)) return Handle<Code>();
+  return FinalizeCode();
+}
+
+
+bool Pipeline::ScheduleAndAssembleCode(CallDescriptor* call_descriptor) {
   PipelineData* data = this->data_;
 
   DCHECK_NOT_NULL(data->graph());
@@ -1159,17 +1341,20 @@ Handle<Code> Pipeline::ScheduleAndGenerateCode(
   if (data->schedule() == nullptr) Run<ComputeSchedulePhase>();
   TraceSchedule(data->info(), data->schedule());
 
-  BasicBlockProfiler::Data* profiler_data = NULL;
+  if (FLAG_turbo_profile_guided_layout) {
+    BasicBlockInstrumentor::MarkColdBlocks(info(), data->schedule());
+  }
+
   if (FLAG_turbo_profiling) {
-    profiler_data = BasicBlockInstrumentor::Instrument(info(), data->graph(),
-                                                       data->schedule());
+    data->set_profiler_data(BasicBlockInstrumentor::Instrument(
+        info(), data->graph(), data->schedule()));
   }
 
   data->InitializeInstructionSequence();
 
   // Select and schedule instructions covering the scheduled graph.
-  Linkage linkage(call_descriptor);
-  Run<InstructionSelectionPhase>(&linkage);
+  Linkage* linkage = new (data->instruction_zone()) Linkage(call_descriptor);
+  Run<InstructionSelectionPhase>(linkage);
 
   if (FLAG_trace_turbo && !data->MayHaveUnverifiableGraph()) {
     TurboCfgFile tcf(isolate());
@@ -1177,10 +1362,11 @@ Handle<Code> Pipeline::ScheduleAndGenerateCode(
                  data->sequence());
   }
 
-  std::ostringstream source_position_output;
   if (FLAG_trace_turbo) {
-    // Output source position information before the graph is deleted.
-    data_->source_positions()->Print(source_position_output);
+    // Capture source position information before the graph is deleted.
+    std::ostringstream source_position_output;
+    data->source_positions()->Print(source_position_output);
+    data->set_source_position_output(source_position_output.str());
   }
 
   data->DeleteGraphZone();
@@ -1192,25 +1378,39 @@ Handle<Code> Pipeline::ScheduleAndGenerateCode(
   AllocateRegisters(RegisterConfiguration::ArchDefault(), run_verifier);
   if (data->compilation_failed()) {
     info()->AbortOptimization(kNotEnoughVirtualRegistersRegalloc);
-    return Handle<Code>();
+    return false;
   }
 
   BeginPhaseKind("code generation");
 
+  // Reorder instructions for in-order cores.
+  if (FLAG_turbo_instruction_scheduling) {
+    Run<ScheduleInstructionsPhase>();
+  }
+
   // Optimimize jumps.
   if (FLAG_turbo_jt) {
     Run<JumpThreadingPhase>();
   }
 
-  // Generate final machine code.
-  Run<GenerateCodePhase>(&linkage);
+  // Assemble machine code into the assembler's buffer; the code object
+  // itself is allocated by FinalizeCode on the main thread.
+  Run<AssembleCodePhase>(linkage);
+  return true;
+}
+
+
+Handle<Code> Pipeline::FinalizeCode() {
+  PipelineData* data = this->data_;
+
+  Run<FinalizeCodePhase>();
 
   Handle<Code> code = data->code();
-  if (profiler_data != NULL) {
+  if (data->profiler_data() != NULL) {
 #if ENABLE_DISASSEMBLER
     std::ostringstream os;
     code->Disassemble(NULL, os);
-    profiler_data->SetCode(&os);
+    data->profiler_data()->SetCode(&os);
 #endif
   }
 
@@ -1233,7 +1433,7 @@ Handle<Code> Pipeline::ScheduleAndGenerateCode(
 #endif  // ENABLE_DISASSEMBLER
       json_of << "\"}\n],\n";
       json_of << "\"nodePositions\":";
-      json_of << source_position_output.str();
+      json_of << data->source_position_output();
       json_of << "}";
       fclose(json_file);
     }
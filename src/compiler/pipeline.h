@@ -18,16 +18,35 @@ class Graph;
 class InstructionSequence;
 class Linkage;
 class PipelineData;
+class PipelineStatistics;
 class RegisterConfiguration;
 class Schedule;
+class ZonePool;
 
 class Pipeline {
  public:
-  explicit Pipeline(CompilationInfo* info) : info_(info) {}
+  explicit Pipeline(CompilationInfo* info)
+      : info_(info),
+        data_(nullptr),
+        zone_pool_(nullptr),
+        pipeline_statistics_(nullptr) {}
+  ~Pipeline();
 
   // Run the entire pipeline and generate a handle to a code object.
   Handle<Code> GenerateCode();
 
+  // Alternatively, the pipeline can be run in three separate phases that
+  // mirror those of OptimizedCompileJob: CreateGraph builds and optimizes
+  // the graph and must run on the main thread, OptimizeGraph runs the
+  // backend (scheduling, instruction selection, register allocation and
+  // code assembly into a detached buffer) and may run on the concurrent
+  // recompilation thread, and FinalizeCode allocates the code object on
+  // the isolate's heap and must run on the main thread again. CreateGraph
+  // and OptimizeGraph return false if compilation should bail out.
+  bool CreateGraph();
+  bool OptimizeGraph();
+  Handle<Code> FinalizeCode();
+
   // Run the pipeline on a machine graph and generate code. If {schedule} is
   // {nullptr}, then compute a new schedule for code generation.
   static Handle<Code> GenerateCodeForTesting(CompilationInfo* info,
@@ -57,6 +76,12 @@ class Pipeline {
   CompilationInfo* info_;
   PipelineData* data_;
 
+  // Pipeline state owned here when the pipeline is run in phases (see
+  // CreateGraph); the testing entry points instead point {data_} at
+  // caller-owned state.
+  ZonePool* zone_pool_;
+  PipelineStatistics* pipeline_statistics_;
+
   // Helpers for executing pipeline phases.
   template <typename Phase>
   void Run();
@@ -69,6 +94,7 @@ class Pipeline {
   void BeginPhaseKind(const char* phase_kind);
   void RunPrintAndVerify(const char* phase, bool untyped = false);
   Handle<Code> ScheduleAndGenerateCode(CallDescriptor* call_descriptor);
+  bool ScheduleAndAssembleCode(CallDescriptor* call_descriptor);
   void AllocateRegisters(const RegisterConfiguration* config,
                          bool run_verifier);
 };
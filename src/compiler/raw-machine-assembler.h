@@ -176,6 +176,9 @@ class RawMachineAssembler : public GraphBuilder {
     return NewNode(machine()->Word32Ror(), a, b);
   }
   Node* Word32Clz(Node* a) { return NewNode(machine()->Word32Clz(), a); }
+  Node* Word32Select(Node* cond, Node* vtrue, Node* vfalse) {
+    return NewNode(machine()->Word32Select(), cond, vtrue, vfalse);
+  }
   Node* Word32Equal(Node* a, Node* b) {
     return NewNode(machine()->Word32Equal(), a, b);
   }
@@ -209,6 +212,9 @@ class RawMachineAssembler : public GraphBuilder {
   Node* Word64Equal(Node* a, Node* b) {
     return NewNode(machine()->Word64Equal(), a, b);
   }
+  Node* Word64Select(Node* cond, Node* vtrue, Node* vfalse) {
+    return NewNode(machine()->Word64Select(), cond, vtrue, vfalse);
+  }
   Node* Word64NotEqual(Node* a, Node* b) {
     return Word64BinaryNot(Word64Equal(a, b));
   }
@@ -424,6 +430,12 @@ class RawMachineAssembler : public GraphBuilder {
   Node* TruncateInt64ToInt32(Node* a) {
     return NewNode(machine()->TruncateInt64ToInt32(), a);
   }
+  Node* BitcastTaggedToWord(Node* a) {
+    return NewNode(machine()->BitcastTaggedToWord(), a);
+  }
+  Node* BitcastWordToTagged(Node* a) {
+    return NewNode(machine()->BitcastWordToTagged(), a);
+  }
   Node* Float64RoundDown(Node* a) {
     return NewNode(machine()->Float64RoundDown(), a);
   }
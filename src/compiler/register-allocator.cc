@@ -104,6 +104,8 @@ int GetByteWidth(MachineType machine_type) {
     case kRepWord64:
     case kRepFloat64:
       return 8;
+    case kRepSimd128:
+      return 16;
     default:
       UNREACHABLE();
       return 0;
@@ -311,6 +313,9 @@ RegisterKind LiveRange::kind() const {
   switch (RepresentationOf(machine_type())) {
     case kRepFloat32:
     case kRepFloat64:
+    // TODO(turbofan): packed values are allocated to the FP registers, but
+    // spilling and gap moves only preserve the low 64 bits of them.
+    case kRepSimd128:
       return DOUBLE_REGISTERS;
     default:
       break;
@@ -1792,6 +1797,22 @@ LifetimePosition RegisterAllocator::FindOptimalSplitPos(LifetimePosition start,
     return end;
   }
 
+  if (end_block->IsDeferred() && !start_block->IsDeferred()) {
+    // The end of the interval lies in cold code. Split where the deferred
+    // code begins, so that the hot part of the range is allocated as if the
+    // cold blocks did not exist.
+    auto deferred_block = end_block;
+    while (deferred_block->rpo_number().ToInt() >
+           start_block->rpo_number().ToInt()) {
+      auto pred = code()->InstructionBlockAt(
+          RpoNumber::FromInt(deferred_block->rpo_number().ToInt() - 1));
+      if (!pred->IsDeferred()) break;
+      deferred_block = pred;
+    }
+    return LifetimePosition::GapFromInstructionIndex(
+        deferred_block->first_instruction_index());
+  }
+
   auto block = end_block;
   // Find header of outermost loop.
   // TODO(titzer): fix redundancy below.
@@ -1813,6 +1834,9 @@ LifetimePosition RegisterAllocator::FindOptimalSplitPos(LifetimePosition start,
 LifetimePosition RegisterAllocator::FindOptimalSpillingPos(
     LiveRange* range, LifetimePosition pos) {
   auto block = GetInstructionBlock(code(), pos.Start());
+  // Hoisting a spill out of cold code would put the store on the hot path;
+  // leave spills that already sit in deferred code where they are.
+  if (block->IsDeferred()) return pos;
   auto loop_header =
       block->IsLoopHeader() ? block : GetContainingLoop(code(), block);
 
@@ -1095,6 +1095,10 @@ void Scheduler::ComputeSpecialRPONumbering() {
 }
 
 
+// Incremental dominator propagation along the special-RPO chain, used when
+// floating control is fused into an existing schedule. Predecessors outside
+// the given chain fragment keep their final dominators, so this walks the
+// dominator tree through the BasicBlock structures directly.
 void Scheduler::PropagateImmediateDominators(BasicBlock* block) {
   for (/*nop*/; block != NULL; block = block->rpo_next()) {
     auto pred = block->predecessors().begin();
@@ -1120,6 +1124,97 @@ void Scheduler::PropagateImmediateDominators(BasicBlock* block) {
 }
 
 
+namespace {
+
+// Finds the common dominator of two blocks given as indices into the
+// special-RPO order, walking up the {idom} array. Since an immediate
+// dominator always precedes its dominated blocks in any reverse-post-order,
+// the block with the larger index can always be moved towards the entry.
+int32_t IntersectDominators(int32_t b1, int32_t b2,
+                            const ZoneVector<int32_t>& idom) {
+  while (b1 != b2) {
+    while (b1 > b2) b1 = idom[b1];
+    while (b2 > b1) b2 = idom[b2];
+  }
+  return b1;
+}
+
+}  // namespace
+
+
+// Computes immediate dominators for the whole schedule with the iterative
+// algorithm of Cooper, Harvey and Kennedy. The special-RPO chain and the
+// predecessor lists are first packed into flat index arrays, so the fixpoint
+// iteration and the dominator intersections run over contiguous int32 data
+// instead of chasing BasicBlock pointers; on large graphs this is
+// considerably faster than propagating through the block structures.
+void Scheduler::ComputeImmediateDominators() {
+  // Number the blocks along the special-RPO chain.
+  ZoneVector<BasicBlock*> order(zone_);
+  ZoneVector<int32_t> rpo_index(schedule_->BasicBlockCount(), -1, zone_);
+  for (BasicBlock* b = schedule_->start(); b != NULL; b = b->rpo_next()) {
+    rpo_index[b->id().ToSize()] = static_cast<int32_t>(order.size());
+    order.push_back(b);
+  }
+  int32_t const count = static_cast<int32_t>(order.size());
+
+  // Flatten the predecessor lists into one packed edge array. Predecessors
+  // that are not on the chain are unreachable and cannot contribute.
+  ZoneVector<int32_t> pred_begin(zone_);
+  pred_begin.reserve(count + 1);
+  ZoneVector<int32_t> preds(zone_);
+  for (int32_t b = 0; b < count; b++) {
+    pred_begin.push_back(static_cast<int32_t>(preds.size()));
+    for (BasicBlock* pred : order[b]->predecessors()) {
+      int32_t const index = rpo_index[pred->id().ToSize()];
+      if (index >= 0) preds.push_back(index);
+    }
+  }
+  pred_begin.push_back(static_cast<int32_t>(preds.size()));
+
+  // Iterate to a fixpoint. The entry dominates itself; every other block
+  // intersects the dominators of its processed predecessors, which skips
+  // backedges on the first pass. For reducible graphs the first pass already
+  // yields the final answer and the second pass merely confirms it.
+  ZoneVector<int32_t> idom(count, -1, zone_);
+  idom[0] = 0;
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (int32_t b = 1; b < count; b++) {
+      int32_t new_idom = -1;
+      for (int32_t i = pred_begin[b]; i < pred_begin[b + 1]; i++) {
+        int32_t const pred = preds[i];
+        if (idom[pred] < 0) continue;  // Not yet processed.
+        new_idom =
+            new_idom < 0 ? pred : IntersectDominators(new_idom, pred, idom);
+      }
+      DCHECK_LE(0, new_idom);
+      if (idom[b] != new_idom) {
+        idom[b] = new_idom;
+        changed = true;
+      }
+    }
+  }
+
+  // Write the result back into the blocks; dominator depths follow from the
+  // RPO processing order. A block is deferred if all forward predecessors
+  // are deferred, just as in the incremental propagation above.
+  for (int32_t b = 1; b < count; b++) {
+    BasicBlock* const block = order[b];
+    BasicBlock* const dominator = order[idom[b]];
+    bool deferred = true;
+    for (int32_t i = pred_begin[b]; i < pred_begin[b + 1]; i++) {
+      if (preds[i] < b) deferred = deferred & order[preds[i]]->deferred();
+    }
+    block->set_dominator(dominator);
+    block->set_dominator_depth(dominator->dominator_depth() + 1);
+    block->set_deferred(deferred | block->deferred());
+    TRACE("Block id:%d's idom is id:%d, depth = %d\n", block->id().ToInt(),
+          dominator->id().ToInt(), block->dominator_depth());
+  }
+}
+
+
 void Scheduler::GenerateImmediateDominatorTree() {
   TRACE("--- IMMEDIATE BLOCK DOMINATORS -----------------------------\n");
 
@@ -1127,7 +1222,7 @@ void Scheduler::GenerateImmediateDominatorTree() {
   schedule_->start()->set_dominator_depth(0);
 
   // Build the block dominator tree resulting from the above seed.
-  PropagateImmediateDominators(schedule_->start()->rpo_next());
+  ComputeImmediateDominators();
 }
 
 
@@ -85,6 +85,7 @@ class Scheduler {
   void DecrementUnscheduledUseCount(Node* node, int index, Node* from);
 
   void PropagateImmediateDominators(BasicBlock* block);
+  void ComputeImmediateDominators();
 
   // Phase 1: Build control-flow graph.
   friend class CFGBuilder;
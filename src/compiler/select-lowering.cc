@@ -7,15 +7,53 @@
 #include "src/compiler/common-operator.h"
 #include "src/compiler/diamond.h"
 #include "src/compiler/graph.h"
+#include "src/compiler/machine-operator.h"
 #include "src/compiler/node.h"
 
 namespace v8 {
 namespace internal {
 namespace compiler {
 
-SelectLowering::SelectLowering(Graph* graph, CommonOperatorBuilder* common)
+namespace {
+
+// Value inputs of a conditional move are computed unconditionally, whereas
+// only the selected arm of a diamond is. A node is a cheap input if making
+// it unconditional costs at most one extra instruction: impure nodes are
+// anchored on the effect chain and computed either way, and pure leaves are
+// already available.
+bool IsAnchoredOrLeaf(Node* node) {
+  switch (node->opcode()) {
+    case IrOpcode::kInt32Constant:
+    case IrOpcode::kInt64Constant:
+    case IrOpcode::kFloat32Constant:
+    case IrOpcode::kFloat64Constant:
+    case IrOpcode::kNumberConstant:
+    case IrOpcode::kHeapConstant:
+    case IrOpcode::kParameter:
+    case IrOpcode::kPhi:
+      return true;
+    default:
+      return !node->op()->HasProperty(Operator::kPure);
+  }
+}
+
+
+bool IsCheapInput(Node* node) {
+  if (IsAnchoredOrLeaf(node)) return true;
+  for (Node* const input : node->inputs()) {
+    if (!IsAnchoredOrLeaf(input)) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+
+SelectLowering::SelectLowering(Graph* graph, CommonOperatorBuilder* common,
+                               MachineOperatorBuilder* machine)
     : common_(common),
       graph_(graph),
+      machine_(machine),
       merges_(Merges::key_compare(), Merges::allocator_type(graph->zone())) {}
 
 
@@ -31,6 +69,18 @@ Reduction SelectLowering::Reduce(Node* node) {
   Node* velse = node->InputAt(2);
   Node* merge = nullptr;
 
+  // Prefer a conditional move over a diamond where the target supports one
+  // for this representation: without a useful branch hint the branch is
+  // assumed hard to predict, and cheap inputs make the unconditional
+  // evaluation of both arms affordable.
+  if (p.hint() == BranchHint::kNone && IsCheapInput(vthen) &&
+      IsCheapInput(velse)) {
+    if (const Operator* cmov = ConditionalMoveOperatorFor(p.type())) {
+      node->set_op(cmov);
+      return Changed(node);
+    }
+  }
+
   // Check if we already have a diamond for this condition.
   auto range = merges_.equal_range(cond);
   for (auto i = range.first;; ++i) {
@@ -59,6 +109,23 @@ Reduction SelectLowering::Reduce(Node* node) {
 }
 
 
+const Operator* SelectLowering::ConditionalMoveOperatorFor(MachineType type) {
+  switch (RepresentationOf(type)) {
+    case kRepBit:
+    case kRepWord32:
+      return machine()->Word32SelectIsSupported() ? machine()->Word32Select()
+                                                  : nullptr;
+    case kRepWord64:
+      return machine()->Word64SelectIsSupported() ? machine()->Word64Select()
+                                                  : nullptr;
+    default:
+      // Tagged values would lose their reference marking and floating point
+      // selects have no conditional move operator; use a diamond.
+      return nullptr;
+  }
+}
+
+
 bool SelectLowering::ReachableFrom(Node* const sink, Node* const source) {
   // TODO(turbofan): This is probably horribly expensive, and it should be moved
   // into node.h or somewhere else?!
@@ -8,6 +8,7 @@
 #include <map>
 
 #include "src/compiler/graph-reducer.h"
+#include "src/compiler/machine-type.h"
 #include "src/zone-allocator.h"
 
 namespace v8 {
@@ -17,14 +18,20 @@ namespace compiler {
 // Forward declarations.
 class CommonOperatorBuilder;
 class Graph;
+class MachineOperatorBuilder;
+class Operator;
 
 
-// Lowers Select nodes to diamonds.
+// Lowers Select nodes to conditional moves where the target supports them
+// and the inputs are cheap, and to diamonds otherwise.
 class SelectLowering final : public Reducer {
  public:
-  SelectLowering(Graph* graph, CommonOperatorBuilder* common);
+  SelectLowering(Graph* graph, CommonOperatorBuilder* common,
+                 MachineOperatorBuilder* machine);
   ~SelectLowering();
 
+  const char* reducer_name() const override { return "SelectLowering"; }
+
   Reduction Reduce(Node* node) override;
 
  private:
@@ -32,12 +39,15 @@ class SelectLowering final : public Reducer {
                         zone_allocator<std::pair<Node* const, Node*>>> Merges;
 
   bool ReachableFrom(Node* const sink, Node* const source);
+  const Operator* ConditionalMoveOperatorFor(MachineType type);
 
   CommonOperatorBuilder* common() const { return common_; }
   Graph* graph() const { return graph_; }
+  MachineOperatorBuilder* machine() const { return machine_; }
 
   CommonOperatorBuilder* common_;
   Graph* graph_;
+  MachineOperatorBuilder* machine_;
   Merges merges_;
 };
 
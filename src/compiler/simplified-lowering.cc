@@ -1001,6 +1001,11 @@ class RepresentationSelector {
         return VisitUnop(node, kTypeInt32 | kRepWord64,
                          kTypeInt32 | kRepWord32);
 
+      case IrOpcode::kBitcastTaggedToWord:
+        return VisitUnop(node, kMachAnyTagged, kMachPtr);
+      case IrOpcode::kBitcastWordToTagged:
+        return VisitUnop(node, kMachPtr, kMachAnyTagged);
+
       case IrOpcode::kChangeFloat32ToFloat64:
         return VisitUnop(node, kTypeNumber | kRepFloat32,
                          kTypeNumber | kRepFloat64);
@@ -1040,6 +1045,13 @@ class RepresentationSelector {
       case IrOpcode::kFloat64InsertLowWord32:
       case IrOpcode::kFloat64InsertHighWord32:
         return VisitBinop(node, kMachFloat64, kMachInt32, kMachFloat64);
+      case IrOpcode::kFloat32x4Add:
+      case IrOpcode::kFloat32x4Sub:
+      case IrOpcode::kFloat32x4Mul:
+      case IrOpcode::kFloat32x4Div:
+      case IrOpcode::kInt32x4Add:
+      case IrOpcode::kInt32x4Sub:
+        return VisitBinop(node, kMachSimd128, kMachSimd128);
       case IrOpcode::kLoadStackPointer:
         return VisitLeaf(node, kMachPtr);
       case IrOpcode::kStateValues:
@@ -1150,16 +1162,69 @@ Node* SimplifiedLowering::OffsetMinusTagConstant(int32_t offset) {
 
 namespace {
 
-WriteBarrierKind ComputeWriteBarrierKind(BaseTaggedness base_is_tagged,
+// Returns true if {object} is a new space allocation that is still guaranteed
+// to be in new space at {effect}, in which case a store into it needs no
+// write barrier. The allocation must dominate the store on the effect chain
+// with nothing but heap accesses in between, since any other effect might
+// contain a GC point that promotes the object into old space. Objects above
+// the regular size limit end up in the large object space instead, so those
+// are excluded as well.
+bool IsFreshNewSpaceAllocation(Node* object, Node* effect) {
+  // Look through the interior pointer computation introduced by allocation
+  // folding.
+  if (object->opcode() == IrOpcode::kBitcastWordToTagged) {
+    Node* const address = object->InputAt(0);
+    if (address->opcode() == IrOpcode::kInt32Add ||
+        address->opcode() == IrOpcode::kInt64Add) {
+      Node* const base = address->InputAt(0);
+      if (base->opcode() == IrOpcode::kBitcastTaggedToWord) {
+        object = base->InputAt(0);
+      }
+    }
+  }
+  if (object->opcode() != IrOpcode::kAllocate) return false;
+  if (OpParameter<PretenureFlag>(object->op()) != NOT_TENURED) return false;
+  NumberMatcher m(object->InputAt(0));
+  if (!m.HasValue() || m.Value() > Page::kMaxRegularHeapObjectSize) {
+    return false;
+  }
+  while (effect != object) {
+    switch (effect->opcode()) {
+      case IrOpcode::kLoadField:
+      case IrOpcode::kLoadElement:
+      case IrOpcode::kStoreField:
+      case IrOpcode::kStoreElement:
+      case IrOpcode::kLoad:
+      case IrOpcode::kStore:
+        // Heap accesses never cause a GC; note that stores and loads that
+        // were already lowered to machine operators show up here as well.
+        effect = NodeProperties::GetEffectInput(effect);
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
+
+WriteBarrierKind ComputeWriteBarrierKind(Node* object, Node* effect,
+                                         BaseTaggedness base_is_tagged,
                                          MachineType representation,
                                          Type* type) {
   if (type->Is(Type::TaggedSigned())) {
     // Write barriers are only for writes of heap objects.
     return kNoWriteBarrier;
   }
+  if (type->Is(Type::Boolean()) || type->Is(Type::Undefined()) ||
+      type->Is(Type::Null())) {
+    // Write barriers are never needed for immortal immovable roots.
+    return kNoWriteBarrier;
+  }
   if (base_is_tagged == kTaggedBase &&
       RepresentationOf(representation) == kRepTagged) {
     // Write barriers are only for writes into heap objects (i.e. tagged base).
+    if (IsFreshNewSpaceAllocation(object, effect)) return kNoWriteBarrier;
     return kFullWriteBarrier;
   }
   return kNoWriteBarrier;
@@ -1196,8 +1261,9 @@ void SimplifiedLowering::DoLoadField(Node* node) {
 void SimplifiedLowering::DoStoreField(Node* node) {
   const FieldAccess& access = FieldAccessOf(node->op());
   Type* type = NodeProperties::GetBounds(node->InputAt(1)).upper;
-  WriteBarrierKind kind =
-      ComputeWriteBarrierKind(access.base_is_tagged, access.machine_type, type);
+  WriteBarrierKind kind = ComputeWriteBarrierKind(
+      node->InputAt(0), NodeProperties::GetEffectInput(node),
+      access.base_is_tagged, access.machine_type, type);
   node->set_op(
       machine()->Store(StoreRepresentation(access.machine_type, kind)));
   Node* offset = jsgraph()->IntPtrConstant(access.offset - access.tag());
@@ -1303,10 +1369,12 @@ void SimplifiedLowering::DoLoadElement(Node* node) {
 void SimplifiedLowering::DoStoreElement(Node* node) {
   const ElementAccess& access = ElementAccessOf(node->op());
   Type* type = NodeProperties::GetBounds(node->InputAt(2)).upper;
-  node->set_op(machine()->Store(
-      StoreRepresentation(access.machine_type,
-                          ComputeWriteBarrierKind(access.base_is_tagged,
-                                                  access.machine_type, type))));
+  node->set_op(machine()->Store(StoreRepresentation(
+      access.machine_type,
+      ComputeWriteBarrierKind(node->InputAt(0),
+                              NodeProperties::GetEffectInput(node),
+                              access.base_is_tagged, access.machine_type,
+                              type))));
   node->ReplaceInput(1, ComputeIndex(access, node->InputAt(1)));
 }
 
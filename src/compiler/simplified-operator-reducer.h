@@ -26,6 +26,8 @@ class SimplifiedOperatorReducer final : public Reducer {
   explicit SimplifiedOperatorReducer(JSGraph* jsgraph);
   ~SimplifiedOperatorReducer() final;
 
+  const char* reducer_name() const final { return "SimplifiedOperatorReducer"; }
+
   Reduction Reduce(Node* node) final;
 
  private:
@@ -12,6 +12,9 @@ StateValuesCache::StateValuesCache(JSGraph* js_graph)
     : js_graph_(js_graph),
       hash_map_(AreKeysEqual, ZoneHashMap::kDefaultHashMapCapacity,
                 ZoneAllocationPolicy(zone())),
+      frame_state_map_(AreFrameStateKeysEqual,
+                       ZoneHashMap::kDefaultHashMapCapacity,
+                       ZoneAllocationPolicy(zone())),
       working_space_(zone()),
       empty_state_values_(nullptr) {}
 
@@ -71,6 +74,64 @@ bool StateValuesCache::AreValueKeysEqual(StateValuesKey* key1,
 }
 
 
+// static
+bool StateValuesCache::AreFrameStateKeysEqual(void* key1, void* key2) {
+  NodeKey* node_key1 = reinterpret_cast<NodeKey*>(key1);
+  NodeKey* node_key2 = reinterpret_cast<NodeKey*>(key2);
+
+  if (node_key1->node == nullptr) {
+    if (node_key2->node == nullptr) {
+      FrameStateKey* state_key1 = reinterpret_cast<FrameStateKey*>(key1);
+      FrameStateKey* state_key2 = reinterpret_cast<FrameStateKey*>(key2);
+      if (OpParameter<FrameStateCallInfo>(state_key1->op) !=
+          OpParameter<FrameStateCallInfo>(state_key2->op)) {
+        return false;
+      }
+      if (state_key1->count != state_key2->count) {
+        return false;
+      }
+      for (size_t i = 0; i < state_key1->count; i++) {
+        if (state_key1->inputs[i] != state_key2->inputs[i]) {
+          return false;
+        }
+      }
+      return true;
+    } else {
+      return IsFrameStateKeyEqualToNode(
+          reinterpret_cast<FrameStateKey*>(key1), node_key2->node);
+    }
+  } else {
+    if (node_key2->node == nullptr) {
+      // If the nodes are already processed, they must be the same.
+      return IsFrameStateKeyEqualToNode(
+          reinterpret_cast<FrameStateKey*>(key2), node_key1->node);
+    } else {
+      return node_key1->node == node_key2->node;
+    }
+  }
+  UNREACHABLE();
+}
+
+
+// static
+bool StateValuesCache::IsFrameStateKeyEqualToNode(FrameStateKey* key,
+                                                  Node* node) {
+  if (OpParameter<FrameStateCallInfo>(key->op) !=
+      OpParameter<FrameStateCallInfo>(node->op())) {
+    return false;
+  }
+  if (key->count != static_cast<size_t>(node->InputCount())) {
+    return false;
+  }
+  for (size_t i = 0; i < key->count; i++) {
+    if (key->inputs[i] != node->InputAt(static_cast<int>(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
 Node* StateValuesCache::GetEmptyStateValues() {
   if (empty_state_values_ == nullptr) {
     empty_state_values_ = graph()->NewNode(common()->StateValues(0));
@@ -98,6 +159,15 @@ int StateValuesHashKey(Node** nodes, size_t count) {
   return static_cast<int>(hash & 0x7fffffff);
 }
 
+
+int FrameStateHashKey(const Operator* op, Node** inputs, size_t count) {
+  size_t hash = hash_value(OpParameter<FrameStateCallInfo>(op));
+  for (size_t i = 0; i < count; i++) {
+    hash = hash * 23 + inputs[i]->id();
+  }
+  return static_cast<int>(hash & 0x7fffffff);
+}
+
 }  // namespace
 
 
@@ -122,6 +192,27 @@ Node* StateValuesCache::GetValuesNodeFromCache(Node** nodes, size_t count) {
 }
 
 
+Node* StateValuesCache::GetFrameStateNode(const Operator* op, Node** inputs,
+                                          size_t count) {
+  DCHECK_EQ(IrOpcode::kFrameState, op->opcode());
+  FrameStateKey key(op, count, inputs);
+  int hash = FrameStateHashKey(op, inputs, count);
+  ZoneHashMap::Entry* lookup =
+      frame_state_map_.LookupOrInsert(&key, hash, ZoneAllocationPolicy(zone()));
+  DCHECK_NOT_NULL(lookup);
+  Node* node;
+  if (lookup->value == nullptr) {
+    node = graph()->NewNode(op, static_cast<int>(count), inputs);
+    NodeKey* new_key = new (zone()->New(sizeof(NodeKey))) NodeKey(node);
+    lookup->key = new_key;
+    lookup->value = node;
+  } else {
+    node = reinterpret_cast<Node*>(lookup->value);
+  }
+  return node;
+}
+
+
 class StateValuesCache::ValueArrayIterator {
  public:
   ValueArrayIterator(Node** values, size_t count)
@@ -20,6 +20,13 @@ class StateValuesCache {
 
   Node* GetNodeForValues(Node** values, size_t count);
 
+  // Returns a FrameState node with the given operator and inputs, reusing an
+  // existing node if an identical frame state has been requested before. Note
+  // that interned frame states must not be mutated in place afterwards, so
+  // callers that rewrite frame state inputs (e.g. the environment liveness
+  // analysis) have to build their frame states without this cache.
+  Node* GetFrameStateNode(const Operator* op, Node** inputs, size_t count);
+
  private:
   static const size_t kMaxInputCount = 8;
 
@@ -38,12 +45,25 @@ class StateValuesCache {
         : NodeKey(nullptr), count(count), values(values) {}
   };
 
+  struct FrameStateKey : public NodeKey {
+    // Operator and input array ({node} has to be nullptr).
+    const Operator* op;
+    size_t count;
+    Node** inputs;
+
+    FrameStateKey(const Operator* op, size_t count, Node** inputs)
+        : NodeKey(nullptr), op(op), count(count), inputs(inputs) {}
+  };
+
   class ValueArrayIterator;
 
   static bool AreKeysEqual(void* key1, void* key2);
   static bool IsKeysEqualToNode(StateValuesKey* key, Node* node);
   static bool AreValueKeysEqual(StateValuesKey* key1, StateValuesKey* key2);
 
+  static bool AreFrameStateKeysEqual(void* key1, void* key2);
+  static bool IsFrameStateKeyEqualToNode(FrameStateKey* key, Node* node);
+
   Node* BuildTree(ValueArrayIterator* it, size_t max_height);
   NodeVector* GetWorkingSpace(size_t level);
   Node* GetEmptyStateValues();
@@ -56,6 +76,7 @@ class StateValuesCache {
 
   JSGraph* js_graph_;
   ZoneHashMap hash_map_;
+  ZoneHashMap frame_state_map_;
   ZoneVector<NodeVector*> working_space_;  // One working space per level.
   Node* empty_state_values_;
 };
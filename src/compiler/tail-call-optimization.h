@@ -23,6 +23,8 @@ class TailCallOptimization final : public Reducer {
   TailCallOptimization(CommonOperatorBuilder* common, Graph* graph)
       : common_(common), graph_(graph) {}
 
+  const char* reducer_name() const final { return "TailCallOptimization"; }
+
   Reduction Reduce(Node* node) final;
 
  private:
@@ -8,6 +8,7 @@
 #include "src/compiler/js-operator.h"
 #include "src/compiler/node.h"
 #include "src/compiler/node-properties.h"
+#include "src/zone-containers.h"
 #include "src/compiler/simplified-operator.h"
 #include "src/compiler/typer.h"
 
@@ -141,6 +142,36 @@ class LazyTypeCache final : public ZoneObject {
 };
 
 
+// Memoizes the result type of an operation typer function for given input
+// types, for one compilation. The operation typers are pure functions, and
+// input and result types are canonical zone pointers (bitset types are
+// tagged immediates), so a cache hit skips recomputing the whole lattice
+// operation during fixpoint iteration.
+class Typer::OperationCache final : public ZoneObject {
+ public:
+  explicit OperationCache(Zone* zone) : entries_(zone) {}
+
+  bool Lookup(const void* fun, Type* lhs, Type* rhs, Type** result_out) const {
+    Entries::const_iterator i =
+        entries_.find(Key(fun, std::make_pair(lhs, rhs)));
+    if (i == entries_.end()) return false;
+    *result_out = i->second;
+    return true;
+  }
+
+  void Insert(const void* fun, Type* lhs, Type* rhs, Type* result) {
+    entries_.insert(
+        std::make_pair(Key(fun, std::make_pair(lhs, rhs)), result));
+  }
+
+ private:
+  typedef std::pair<const void*, std::pair<Type*, Type*>> Key;
+  typedef ZoneMap<Key, Type*> Entries;
+
+  Entries entries_;
+};
+
+
 class Typer::Decorator final : public GraphDecorator {
  public:
   explicit Decorator(Typer* typer) : typer_(typer) {}
@@ -156,7 +187,8 @@ Typer::Typer(Isolate* isolate, Graph* graph, MaybeHandle<Context> context)
       graph_(graph),
       context_(context),
       decorator_(NULL),
-      cache_(new (graph->zone()) LazyTypeCache(isolate, graph->zone())) {
+      cache_(new (graph->zone()) LazyTypeCache(isolate, graph->zone())),
+      operation_cache_(new (graph->zone()) OperationCache(graph->zone())) {
   Zone* zone = this->zone();
   Factory* f = isolate->factory();
 
@@ -210,10 +242,14 @@ Typer::~Typer() {
 }
 
 
-class Typer::Visitor : public Reducer {
+class Typer::Visitor : public AdvancedReducer {
  public:
-  explicit Visitor(Typer* typer)
-      : typer_(typer), weakened_nodes_(typer->zone()) {}
+  explicit Visitor(Typer* typer, Editor* editor = nullptr)
+      : AdvancedReducer(editor),
+        typer_(typer),
+        weakened_nodes_(typer->zone()) {}
+
+  const char* reducer_name() const override { return "Typer"; }
 
   Reduction Reduce(Node* node) override {
     if (node->op()->ValueOutputCount() == 0) return NoChange();
@@ -352,6 +388,9 @@ class Typer::Visitor : public Reducer {
   Bounds TypeUnaryOp(Node* node, UnaryTyperFun);
   Bounds TypeBinaryOp(Node* node, BinaryTyperFun);
 
+  Type* Memoized(UnaryTyperFun, Type* input);
+  Type* Memoized(BinaryTyperFun, Type* lhs, Type* rhs);
+
   enum ComparisonOutcomeFlags {
     kComparisonTrue = 1,
     kComparisonFalse = 2,
@@ -403,14 +442,24 @@ class Typer::Visitor : public Reducer {
 
       NodeProperties::SetBounds(node, current);
       if (!(previous.Narrows(current) && current.Narrows(previous))) {
-        // If something changed, revisit all uses.
-        return Changed(node);
+        // If something changed, only the nodes that consume this node's
+        // value can be affected; users reached through effect or control
+        // edges never read its type, so don't make the graph reducer
+        // reconsider them.
+        RevisitValueUses(node);
       }
       return NoChange();
     } else {
       // No previous type, simply update the bounds.
       NodeProperties::SetBounds(node, current);
-      return Changed(node);
+      RevisitValueUses(node);
+      return NoChange();
+    }
+  }
+
+  void RevisitValueUses(Node* node) {
+    for (Edge edge : node->use_edges()) {
+      if (NodeProperties::IsValueEdge(edge)) Revisit(edge.from());
     }
   }
 };
@@ -438,8 +487,8 @@ void Typer::Run() {
     }
   }
 
-  Visitor visitor(this);
   GraphReducer graph_reducer(graph(), zone());
+  Visitor visitor(this, &graph_reducer);
   graph_reducer.AddReducer(&visitor);
   graph_reducer.ReduceGraph();
 }
@@ -471,15 +520,37 @@ void Typer::Decorator::Decorate(Node* node, bool incomplete) {
 // as an argument.
 
 
+Type* Typer::Visitor::Memoized(UnaryTyperFun f, Type* input) {
+  Typer::OperationCache* cache = typer_->operation_cache_;
+  const void* key = reinterpret_cast<const void*>(f);
+  Type* result;
+  if (cache->Lookup(key, input, nullptr, &result)) return result;
+  result = f(input, typer_);
+  cache->Insert(key, input, nullptr, result);
+  return result;
+}
+
+
+Type* Typer::Visitor::Memoized(BinaryTyperFun f, Type* lhs, Type* rhs) {
+  Typer::OperationCache* cache = typer_->operation_cache_;
+  const void* key = reinterpret_cast<const void*>(f);
+  Type* result;
+  if (cache->Lookup(key, lhs, rhs, &result)) return result;
+  result = f(lhs, rhs, typer_);
+  cache->Insert(key, lhs, rhs, result);
+  return result;
+}
+
+
 Bounds Typer::Visitor::TypeUnaryOp(Node* node, UnaryTyperFun f) {
   Bounds input = Operand(node, 0);
   Type* upper =
-      input.upper->IsInhabited() ? f(input.upper, typer_) : Type::None();
+      input.upper->IsInhabited() ? Memoized(f, input.upper) : Type::None();
   Type* lower = input.lower->IsInhabited()
                     ? ((input.lower == input.upper || upper->IsConstant())
                            ? upper  // TODO(neis): Extend this to Range(x,x),
                                     // NaN, MinusZero, ...?
-                           : f(input.lower, typer_))
+                           : Memoized(f, input.lower))
                     : Type::None();
   // TODO(neis): Figure out what to do with lower bound.
   return Bounds(lower, upper);
@@ -490,14 +561,14 @@ Bounds Typer::Visitor::TypeBinaryOp(Node* node, BinaryTyperFun f) {
   Bounds left = Operand(node, 0);
   Bounds right = Operand(node, 1);
   Type* upper = left.upper->IsInhabited() && right.upper->IsInhabited()
-                    ? f(left.upper, right.upper, typer_)
+                    ? Memoized(f, left.upper, right.upper)
                     : Type::None();
   Type* lower =
       left.lower->IsInhabited() && right.lower->IsInhabited()
           ? (((left.lower == left.upper && right.lower == right.upper) ||
               upper->IsConstant())
                  ? upper
-                 : f(left.lower, right.lower, typer_))
+                 : Memoized(f, left.lower, right.lower))
           : Type::None();
   // TODO(neis): Figure out what to do with lower bound.
   return Bounds(lower, upper);
@@ -1900,6 +1971,11 @@ Bounds Typer::Visitor::TypeWord32Clz(Node* node) {
 }
 
 
+Bounds Typer::Visitor::TypeWord32Select(Node* node) {
+  return Bounds::Either(Operand(node, 1), Operand(node, 2), zone());
+}
+
+
 Bounds Typer::Visitor::TypeWord64And(Node* node) {
   return Bounds(Type::Internal());
 }
@@ -1940,6 +2016,11 @@ Bounds Typer::Visitor::TypeWord64Equal(Node* node) {
 }
 
 
+Bounds Typer::Visitor::TypeWord64Select(Node* node) {
+  return Bounds::Either(Operand(node, 1), Operand(node, 2), zone());
+}
+
+
 Bounds Typer::Visitor::TypeInt32Add(Node* node) {
   return Bounds(Type::Integral32());
 }
@@ -2123,6 +2204,16 @@ Bounds Typer::Visitor::TypeTruncateInt64ToInt32(Node* node) {
 }
 
 
+Bounds Typer::Visitor::TypeBitcastTaggedToWord(Node* node) {
+  return Bounds(Type::Internal());
+}
+
+
+Bounds Typer::Visitor::TypeBitcastWordToTagged(Node* node) {
+  return Bounds(Type::Internal());
+}
+
+
 Bounds Typer::Visitor::TypeFloat32Add(Node* node) {
   return Bounds(Type::Number());
 }
@@ -2278,6 +2369,36 @@ Bounds Typer::Visitor::TypeFloat64InsertHighWord32(Node* node) {
 }
 
 
+Bounds Typer::Visitor::TypeFloat32x4Add(Node* node) {
+  return Bounds(Type::Internal());
+}
+
+
+Bounds Typer::Visitor::TypeFloat32x4Sub(Node* node) {
+  return Bounds(Type::Internal());
+}
+
+
+Bounds Typer::Visitor::TypeFloat32x4Mul(Node* node) {
+  return Bounds(Type::Internal());
+}
+
+
+Bounds Typer::Visitor::TypeFloat32x4Div(Node* node) {
+  return Bounds(Type::Internal());
+}
+
+
+Bounds Typer::Visitor::TypeInt32x4Add(Node* node) {
+  return Bounds(Type::Internal());
+}
+
+
+Bounds Typer::Visitor::TypeInt32x4Sub(Node* node) {
+  return Bounds(Type::Internal());
+}
+
+
 Bounds Typer::Visitor::TypeLoadStackPointer(Node* node) {
   return Bounds(Type::Internal());
 }
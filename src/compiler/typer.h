@@ -31,6 +31,7 @@ class Typer {
  private:
   class Visitor;
   class Decorator;
+  class OperationCache;
 
   Isolate* isolate_;
   Graph* graph_;
@@ -61,6 +62,7 @@ class Typer {
   Type* weakint_fun1_;
   Type* random_fun_;
   LazyTypeCache* cache_;
+  OperationCache* operation_cache_;
 
   DISALLOW_COPY_AND_ASSIGN(Typer);
 };
@@ -16,6 +16,8 @@ class ValueNumberingReducer final : public Reducer {
   explicit ValueNumberingReducer(Zone* zone);
   ~ValueNumberingReducer();
 
+  const char* reducer_name() const override { return "ValueNumberingReducer"; }
+
   Reduction Reduce(Node* node) override;
 
  private:
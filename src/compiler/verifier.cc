@@ -763,6 +763,7 @@ void Verifier::Visitor::Check(Node* node) {
     case IrOpcode::kWord32Ror:
     case IrOpcode::kWord32Equal:
     case IrOpcode::kWord32Clz:
+    case IrOpcode::kWord32Select:
     case IrOpcode::kWord64And:
     case IrOpcode::kWord64Or:
     case IrOpcode::kWord64Xor:
@@ -771,6 +772,7 @@ void Verifier::Visitor::Check(Node* node) {
     case IrOpcode::kWord64Sar:
     case IrOpcode::kWord64Ror:
     case IrOpcode::kWord64Equal:
+    case IrOpcode::kWord64Select:
     case IrOpcode::kInt32Add:
     case IrOpcode::kInt32AddWithOverflow:
     case IrOpcode::kInt32Sub:
@@ -822,7 +824,15 @@ void Verifier::Visitor::Check(Node* node) {
     case IrOpcode::kFloat64Equal:
     case IrOpcode::kFloat64LessThan:
     case IrOpcode::kFloat64LessThanOrEqual:
+    case IrOpcode::kFloat32x4Add:
+    case IrOpcode::kFloat32x4Sub:
+    case IrOpcode::kFloat32x4Mul:
+    case IrOpcode::kFloat32x4Div:
+    case IrOpcode::kInt32x4Add:
+    case IrOpcode::kInt32x4Sub:
     case IrOpcode::kTruncateInt64ToInt32:
+    case IrOpcode::kBitcastTaggedToWord:
+    case IrOpcode::kBitcastWordToTagged:
     case IrOpcode::kTruncateFloat64ToFloat32:
     case IrOpcode::kTruncateFloat64ToInt32:
     case IrOpcode::kChangeInt32ToInt64:
@@ -796,6 +796,24 @@ void CodeGenerator::AssembleArchInstruction(Instruction* instr) {
     case kSSEFloat32ToFloat64:
       ASSEMBLE_SSE_UNOP(cvtss2sd);
       break;
+    case kSSEFloat32x4Add:
+      ASSEMBLE_SSE_BINOP(addps);
+      break;
+    case kSSEFloat32x4Sub:
+      ASSEMBLE_SSE_BINOP(subps);
+      break;
+    case kSSEFloat32x4Mul:
+      ASSEMBLE_SSE_BINOP(mulps);
+      break;
+    case kSSEFloat32x4Div:
+      ASSEMBLE_SSE_BINOP(divps);
+      break;
+    case kSSEInt32x4Add:
+      ASSEMBLE_SSE_BINOP(paddd);
+      break;
+    case kSSEInt32x4Sub:
+      ASSEMBLE_SSE_BINOP(psubd);
+      break;
     case kSSEFloat64Cmp:
       ASSEMBLE_SSE_BINOP(ucomisd);
       break;
@@ -1144,6 +1162,15 @@ void CodeGenerator::AssembleArchInstruction(Instruction* instr) {
         __ movss(operand, i.InputDoubleRegister(index));
       }
       break;
+    case kX64Movdqu:
+      if (instr->HasOutput()) {
+        __ movdqu(i.OutputDoubleRegister(), i.MemoryOperand());
+      } else {
+        size_t index = 0;
+        Operand operand = i.MemoryOperand(&index);
+        __ movdqu(operand, i.InputDoubleRegister(index));
+      }
+      break;
     case kX64Movsd:
       if (instr->HasOutput()) {
         __ movsd(i.OutputDoubleRegister(), i.MemoryOperand());
@@ -1190,6 +1217,16 @@ void CodeGenerator::AssembleArchInstruction(Instruction* instr) {
     case kX64Lea:
       __ leaq(i.OutputRegister(), i.MemoryOperand());
       break;
+    case kX64Cmov32:
+      // The output starts out as the false value; move the true value over
+      // it if the condition is non-zero.
+      __ testl(i.InputRegister(2), i.InputRegister(2));
+      __ cmovl(not_zero, i.OutputRegister(), i.InputRegister(1));
+      break;
+    case kX64Cmov64:
+      __ testl(i.InputRegister(2), i.InputRegister(2));
+      __ cmovq(not_zero, i.OutputRegister(), i.InputRegister(1));
+      break;
     case kX64Dec32:
       __ decl(i.OutputRegister());
       break;
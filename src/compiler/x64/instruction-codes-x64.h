@@ -98,6 +98,12 @@ namespace compiler {
   V(AVXFloat64Neg)                 \
   V(AVXFloat32Abs)                 \
   V(AVXFloat32Neg)                 \
+  V(SSEFloat32x4Add)               \
+  V(SSEFloat32x4Sub)               \
+  V(SSEFloat32x4Mul)               \
+  V(SSEFloat32x4Div)               \
+  V(SSEInt32x4Add)                 \
+  V(SSEInt32x4Sub)                 \
   V(X64Movsxbl)                    \
   V(X64Movzxbl)                    \
   V(X64Movb)                       \
@@ -109,8 +115,11 @@ namespace compiler {
   V(X64Movq)                       \
   V(X64Movsd)                      \
   V(X64Movss)                      \
+  V(X64Movdqu)                     \
   V(X64Lea32)                      \
   V(X64Lea)                        \
+  V(X64Cmov32)                     \
+  V(X64Cmov64)                     \
   V(X64Dec32)                      \
   V(X64Inc32)                      \
   V(X64Push)                       \
@@ -0,0 +1,130 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/instruction-scheduler.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+int InstructionScheduler::GetTargetInstructionFlags(
+    const Instruction* instr) const {
+  switch (instr->arch_opcode()) {
+    case kX64Movsxbl:
+    case kX64Movzxbl:
+    case kX64Movsxwl:
+    case kX64Movzxwl:
+    case kX64Movl:
+    case kX64Movsxlq:
+    case kX64Movq:
+    case kX64Movsd:
+    case kX64Movss:
+    case kX64Movdqu:
+      // Moves are loads or stores, depending on whether a memory operand is
+      // read into an output register or a value is written to memory.
+      return instr->HasOutput() ? kIsLoadOperation : kHasSideEffect;
+
+    case kX64Movb:
+    case kX64Movw:
+      // Byte and word moves only exist in the store form.
+      return kHasSideEffect;
+
+    case kX64StackCheck:
+      return kIsLoadOperation;
+
+    case kX64Push:
+      // Adjusts the stack pointer, which later slot accesses may implicitly
+      // depend on.
+      return kIsBarrier;
+
+    case kX64StoreWriteBarrier:
+      // May call the record write stub and clobber registers.
+      return kIsBarrier;
+
+    default:
+      // The remaining target instructions are pure register computations.
+      return kNoOpcodeFlags;
+  }
+}
+
+
+int InstructionScheduler::GetTargetInstructionLatency(
+    const Instruction* instr) const {
+  switch (instr->arch_opcode()) {
+    case kX64Movsxbl:
+    case kX64Movzxbl:
+    case kX64Movsxwl:
+    case kX64Movzxwl:
+    case kX64Movl:
+    case kX64Movsxlq:
+    case kX64Movq:
+    case kX64Movsd:
+    case kX64Movss:
+    case kX64Movdqu:
+    case kX64StackCheck:
+      return instr->HasOutput() ? 3 : 1;
+
+    case kX64Imul:
+    case kX64Imul32:
+    case kX64ImulHigh32:
+    case kX64UmulHigh32:
+      return 3;
+
+    case kX64Idiv:
+    case kX64Udiv:
+      return 40;
+    case kX64Idiv32:
+    case kX64Udiv32:
+      return 20;
+
+    case kSSEFloat32Add:
+    case kSSEFloat32Sub:
+    case kSSEFloat32Cmp:
+    case kSSEFloat64Add:
+    case kSSEFloat64Sub:
+    case kSSEFloat64Cmp:
+    case kSSEFloat64Max:
+    case kSSEFloat64Min:
+    case kSSEFloat32Max:
+    case kSSEFloat32Min:
+    case kAVXFloat32Add:
+    case kAVXFloat32Sub:
+    case kAVXFloat64Add:
+    case kAVXFloat64Sub:
+      return 3;
+
+    case kSSEFloat32Mul:
+    case kSSEFloat64Mul:
+    case kAVXFloat32Mul:
+    case kAVXFloat64Mul:
+      return 5;
+
+    case kSSEFloat32Div:
+    case kAVXFloat32Div:
+      return 11;
+    case kSSEFloat64Div:
+    case kAVXFloat64Div:
+      return 16;
+
+    case kSSEFloat32Sqrt:
+    case kSSEFloat64Sqrt:
+      return 16;
+
+    case kSSEFloat32ToFloat64:
+    case kSSEFloat64ToFloat32:
+    case kSSEFloat64ToInt32:
+    case kSSEFloat64ToUint32:
+    case kSSEInt32ToFloat64:
+    case kSSEUint32ToFloat64:
+    case kSSEFloat64Round:
+      return 4;
+
+    default:
+      return 1;
+  }
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -130,6 +130,9 @@ void InstructionSelector::VisitLoad(Node* node) {
     case kRepWord64:
       opcode = kX64Movq;
       break;
+    case kRepSimd128:
+      opcode = kX64Movdqu;
+      break;
     default:
       UNREACHABLE();
       return;
@@ -195,6 +198,9 @@ void InstructionSelector::VisitStore(Node* node) {
     case kRepWord64:
       opcode = kX64Movq;
       break;
+    case kRepSimd128:
+      opcode = kX64Movdqu;
+      break;
     default:
       UNREACHABLE();
       return;
@@ -869,6 +875,16 @@ void VisitFloatUnop(InstructionSelector* selector, Node* node, Node* input,
 }
 
 
+// TODO(turbofan): use the AVX 3-operand forms for packed operations once the
+// assembler supports them.
+void VisitPackedBinop(InstructionSelector* selector, Node* node,
+                      ArchOpcode opcode) {
+  X64OperandGenerator g(selector);
+  selector->Emit(opcode, g.DefineSameAsFirst(node),
+                 g.UseRegister(node->InputAt(0)), g.Use(node->InputAt(1)));
+}
+
+
 }  // namespace
 
 
@@ -979,6 +995,36 @@ void InstructionSelector::VisitFloat64Min(Node* node) {
 }
 
 
+void InstructionSelector::VisitFloat32x4Add(Node* node) {
+  VisitPackedBinop(this, node, kSSEFloat32x4Add);
+}
+
+
+void InstructionSelector::VisitFloat32x4Sub(Node* node) {
+  VisitPackedBinop(this, node, kSSEFloat32x4Sub);
+}
+
+
+void InstructionSelector::VisitFloat32x4Mul(Node* node) {
+  VisitPackedBinop(this, node, kSSEFloat32x4Mul);
+}
+
+
+void InstructionSelector::VisitFloat32x4Div(Node* node) {
+  VisitPackedBinop(this, node, kSSEFloat32x4Div);
+}
+
+
+void InstructionSelector::VisitInt32x4Add(Node* node) {
+  VisitPackedBinop(this, node, kSSEInt32x4Add);
+}
+
+
+void InstructionSelector::VisitInt32x4Sub(Node* node) {
+  VisitPackedBinop(this, node, kSSEInt32x4Sub);
+}
+
+
 void InstructionSelector::VisitFloat64Abs(Node* node) {
   X64OperandGenerator g(this);
   VisitFloatUnop(this, node, node->InputAt(0), kAVXFloat64Abs, kSSEFloat64Abs);
@@ -1081,17 +1127,12 @@ void InstructionSelector::VisitTailCall(Node* node) {
   DCHECK_EQ(0, descriptor->flags() & CallDescriptor::kPatchableCallSite);
   DCHECK_EQ(0, descriptor->flags() & CallDescriptor::kNeedsNopAfterCall);
 
-  // TODO(turbofan): Relax restriction for stack parameters.
-  if (descriptor->UsesOnlyRegisters() &&
-      descriptor->HasSameReturnLocationsAs(
-          linkage()->GetIncomingDescriptor())) {
+  if (linkage()->GetIncomingDescriptor()->CanTailCall(node)) {
     CallBuffer buffer(zone(), descriptor, nullptr);
 
     // Compute InstructionOperands for inputs and outputs.
     InitializeCallBuffer(node, &buffer, true, true);
 
-    DCHECK_EQ(0u, buffer.pushed_nodes.size());
-
     // Select the appropriate opcode based on the call type.
     InstructionCode opcode;
     switch (descriptor->kind()) {
@@ -1615,6 +1656,33 @@ void InstructionSelector::VisitFloat64InsertHighWord32(Node* node) {
 }
 
 
+namespace {
+
+// Shared routine for conditional moves. The output is constrained to the
+// false value so that only the true value needs to be conditionally moved
+// over it.
+void VisitSelect(InstructionSelector* selector, Node* node,
+                 ArchOpcode opcode) {
+  X64OperandGenerator g(selector);
+  selector->Emit(opcode, g.DefineSameAsFirst(node),
+                 g.UseRegister(node->InputAt(2)),
+                 g.UseRegister(node->InputAt(1)),
+                 g.UseRegister(node->InputAt(0)));
+}
+
+}  // namespace
+
+
+void InstructionSelector::VisitWord32Select(Node* node) {
+  VisitSelect(this, node, kX64Cmov32);
+}
+
+
+void InstructionSelector::VisitWord64Select(Node* node) {
+  VisitSelect(this, node, kX64Cmov64);
+}
+
+
 // static
 MachineOperatorBuilder::Flags
 InstructionSelector::SupportedMachineOperatorFlags() {
@@ -1623,7 +1691,10 @@ InstructionSelector::SupportedMachineOperatorFlags() {
       MachineOperatorBuilder::kFloat32Min |
       MachineOperatorBuilder::kFloat64Max |
       MachineOperatorBuilder::kFloat64Min |
-      MachineOperatorBuilder::kWord32ShiftIsSafe;
+      MachineOperatorBuilder::kWord32ShiftIsSafe |
+      MachineOperatorBuilder::kWord32Select |
+      MachineOperatorBuilder::kWord64Select |
+      MachineOperatorBuilder::kSimd128;
   if (CpuFeatures::IsSupported(SSE4_1)) {
     flags |= MachineOperatorBuilder::kFloat64RoundDown |
              MachineOperatorBuilder::kFloat64RoundTruncate;
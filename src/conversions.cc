@@ -125,6 +125,16 @@ const char* DoubleToCString(double v, Vector<char> buffer) {
     case FP_INFINITE: return (v < 0.0 ? "-Infinity" : "Infinity");
     case FP_ZERO: return "0";
     default: {
+      // Integral values in the int range are the common case (indices,
+      // counters) and do not need the shortest-representation search.
+      // kMinInt stays on the generic path because IntToCString delegates
+      // it back here.
+      if (v >= kMinInt && v <= kMaxInt) {
+        int n = static_cast<int>(v);
+        if (static_cast<double>(n) == v && n != kMinInt) {
+          return IntToCString(n, buffer);
+        }
+      }
       SimpleStringBuilder builder(buffer.start(), buffer.length());
       int decimal_point;
       int sign;
@@ -174,6 +184,15 @@ const char* DoubleToCString(double v, Vector<char> buffer) {
 }
 
 
+// The decimal representations of the numbers 0..99, used to emit two digits
+// at a time when converting integers.
+static const char kTwoDigitsTable[] =
+    "000102030405060708091011121314151617181920212223242526272829"
+    "303132333435363738394041424344454647484950515253545556575859"
+    "606162636465666768697071727374757677787980818283848586878889"
+    "90919293949596979899";
+
+
 const char* IntToCString(int n, Vector<char> buffer) {
   bool negative = false;
   if (n < 0) {
@@ -182,24 +201,35 @@ const char* IntToCString(int n, Vector<char> buffer) {
     negative = true;
     n = -n;
   }
-  // Build the string backwards from the least significant digit.
+  // Build the string backwards from the least significant digit, emitting
+  // two digits per division.
   int i = buffer.length();
   buffer[--i] = '\0';
-  do {
-    buffer[--i] = '0' + (n % 10);
-    n /= 10;
-  } while (n);
+  while (n >= 100) {
+    int pair = (n % 100) << 1;
+    n /= 100;
+    buffer[--i] = kTwoDigitsTable[pair + 1];
+    buffer[--i] = kTwoDigitsTable[pair];
+  }
+  if (n >= 10) {
+    int pair = n << 1;
+    buffer[--i] = kTwoDigitsTable[pair + 1];
+    buffer[--i] = kTwoDigitsTable[pair];
+  } else {
+    buffer[--i] = '0' + n;
+  }
   if (negative) buffer[--i] = '-';
   return buffer.start() + i;
 }
 
 
-char* DoubleToFixedCString(double value, int f) {
+const char* DoubleToFixedCString(double value, int f, Vector<char> buffer) {
   const int kMaxDigitsBeforePoint = 21;
   const double kFirstNonFixed = 1e21;
   const int kMaxDigitsAfterPoint = 20;
   DCHECK(f >= 0);
   DCHECK(f <= kMaxDigitsAfterPoint);
+  DCHECK(buffer.length() >= kDoubleToFixedCStringMinBufferSize);
 
   bool negative = false;
   double abs_value = value;
@@ -211,12 +241,12 @@ char* DoubleToFixedCString(double value, int f) {
   // If abs_value has more than kMaxDigitsBeforePoint digits before the point
   // use the non-fixed conversion routine.
   if (abs_value >= kFirstNonFixed) {
-    char arr[100];
-    Vector<char> buffer(arr, arraysize(arr));
-    return StrDup(DoubleToCString(value, buffer));
+    return DoubleToCString(value, buffer);
   }
 
-  // Find a sufficiently precise decimal representation of n.
+  // Find a sufficiently precise decimal representation of n. DoubleToAscii
+  // goes through FastFixedDtoa, which only falls back to the bignum machinery
+  // for inputs it cannot prove correctly rounded.
   int decimal_point;
   int sign;
   // Add space for the '\0' byte.
@@ -228,40 +258,29 @@ char* DoubleToFixedCString(double value, int f) {
                 Vector<char>(decimal_rep, kDecimalRepCapacity),
                 &sign, &decimal_rep_length, &decimal_point);
 
-  // Create a representation that is padded with zeros if needed.
-  int zero_prefix_length = 0;
-  int zero_postfix_length = 0;
-
+  // Assemble the result directly in the buffer. decimal_rep holds the
+  // significant digits; the digit at position i relative to the start of the
+  // integer part is decimal_rep[i] when in range and a padding zero
+  // otherwise (including positions before decimal_rep for small values).
+  char* pos = buffer.start();
+  if (negative) *pos++ = '-';
   if (decimal_point <= 0) {
-    zero_prefix_length = -decimal_point + 1;
-    decimal_point = 1;
-  }
-
-  if (zero_prefix_length + decimal_rep_length < decimal_point + f) {
-    zero_postfix_length = decimal_point + f - decimal_rep_length -
-                          zero_prefix_length;
+    *pos++ = '0';
+  } else {
+    for (int i = 0; i < decimal_point; i++) {
+      *pos++ = i < decimal_rep_length ? decimal_rep[i] : '0';
+    }
   }
-
-  unsigned rep_length =
-      zero_prefix_length + decimal_rep_length + zero_postfix_length;
-  SimpleStringBuilder rep_builder(rep_length + 1);
-  rep_builder.AddPadding('0', zero_prefix_length);
-  rep_builder.AddString(decimal_rep);
-  rep_builder.AddPadding('0', zero_postfix_length);
-  char* rep = rep_builder.Finalize();
-
-  // Create the result string by appending a minus and putting in a
-  // decimal point if needed.
-  unsigned result_size = decimal_point + f + 2;
-  SimpleStringBuilder builder(result_size + 1);
-  if (negative) builder.AddCharacter('-');
-  builder.AddSubstring(rep, decimal_point);
   if (f > 0) {
-    builder.AddCharacter('.');
-    builder.AddSubstring(rep + decimal_point, f);
+    *pos++ = '.';
+    for (int i = 0; i < f; i++) {
+      int digit = decimal_point + i;
+      *pos++ = digit >= 0 && digit < decimal_rep_length ? decimal_rep[digit]
+                                                        : '0';
+    }
   }
-  DeleteArray(rep);
-  return builder.Finalize();
+  *pos = '\0';
+  return buffer.start();
 }
 
 
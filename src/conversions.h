@@ -143,9 +143,19 @@ const char* DoubleToCString(double value, Vector<char> buffer);
 // located inside the buffer, but not necessarily at the start.
 const char* IntToCString(int n, Vector<char> buffer);
 
+// Buffer size for DoubleToFixedCString: a sign, up to 21 digits before the
+// decimal point, the point itself, up to 20 digits after it and the
+// terminating '\0'. DoubleToCString output also fits, for the fallback on
+// values at or above 1e21.
+const int kDoubleToFixedCStringMinBufferSize = kDoubleToCStringMinBufferSize;
+
+// Converts a double to a fixed notation string with f digits after the
+// decimal point, as in Number.prototype.toFixed. The result is located
+// inside the buffer; no heap allocation is performed.
+const char* DoubleToFixedCString(double value, int f, Vector<char> buffer);
+
 // Additional number to string conversions for the number type.
 // The caller is responsible for calling free on the returned pointer.
-char* DoubleToFixedCString(double value, int f);
 char* DoubleToExponentialCString(double value, int f);
 char* DoubleToPrecisionCString(double value, int f);
 char* DoubleToRadixCString(double value, int radix);
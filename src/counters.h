@@ -7,6 +7,7 @@
 
 #include "include/v8.h"
 #include "src/allocation.h"
+#include "src/base/atomicops.h"
 #include "src/base/platform/elapsed-timer.h"
 #include "src/base/platform/time.h"
 #include "src/globals.h"
@@ -92,41 +93,44 @@ class StatsTable {
 //
 // Internally, a counter represents a value in a row of a StatsTable.
 // The row has a 32bit value for each process/thread in the table and also
-// a name (stored in the table metadata).  Since the storage location can be
-// thread-specific, this class cannot be shared across threads.
+// a name (stored in the table metadata).  All updates to the stored value
+// use relaxed atomic operations, so counters may be bumped concurrently
+// from background threads (compilation, sweeping, parsing) without taking
+// a lock and without losing increments.  After the first use the hot path
+// is a single atomic add on the cached location; the embedder callback is
+// not involved.
 class StatsCounter {
  public:
   StatsCounter() { }
   explicit StatsCounter(Isolate* isolate, const char* name)
-      : isolate_(isolate), name_(name), ptr_(NULL), lookup_done_(false) { }
+      : isolate_(isolate), name_(name), ptr_(NULL), lookup_done_(0) { }
 
   // Sets the counter to a specific value.
   void Set(int value) {
     int* loc = GetPtr();
-    if (loc) *loc = value;
+    if (loc) base::NoBarrier_Store(AsAtomic(loc), value);
   }
 
   // Increments the counter.
   void Increment() {
     int* loc = GetPtr();
-    if (loc) (*loc)++;
+    if (loc) base::NoBarrier_AtomicIncrement(AsAtomic(loc), 1);
   }
 
   void Increment(int value) {
     int* loc = GetPtr();
-    if (loc)
-      (*loc) += value;
+    if (loc) base::NoBarrier_AtomicIncrement(AsAtomic(loc), value);
   }
 
   // Decrements the counter.
   void Decrement() {
     int* loc = GetPtr();
-    if (loc) (*loc)--;
+    if (loc) base::NoBarrier_AtomicIncrement(AsAtomic(loc), -1);
   }
 
   void Decrement(int value) {
     int* loc = GetPtr();
-    if (loc) (*loc) -= value;
+    if (loc) base::NoBarrier_AtomicIncrement(AsAtomic(loc), -value);
   }
 
   // Is this counter enabled?
@@ -145,24 +149,34 @@ class StatsCounter {
   }
 
   // Reset the cached internal pointer.
-  void Reset() { lookup_done_ = false; }
+  void Reset() { base::NoBarrier_Store(&lookup_done_, 0); }
 
  protected:
-  // Returns the cached address of this counter location.
+  // Returns the cached address of this counter location, performing the
+  // lookup on first use.  Safe to call concurrently: if several threads
+  // race on the first use they each perform the lookup and the last
+  // published location wins; every location handed out by the embedder
+  // stays valid, so the losers' writes still land in a live cell.
   int* GetPtr() {
-    if (lookup_done_) return ptr_;
-    lookup_done_ = true;
-    ptr_ = FindLocationInStatsTable();
-    return ptr_;
+    if (base::Acquire_Load(&lookup_done_)) return ptr_;
+    int* loc = FindLocationInStatsTable();
+    ptr_ = loc;
+    base::Release_Store(&lookup_done_, 1);
+    return loc;
   }
 
  private:
+  static base::Atomic32* AsAtomic(int* loc) {
+    STATIC_ASSERT(sizeof(int) == sizeof(base::Atomic32));
+    return reinterpret_cast<base::Atomic32*>(loc);
+  }
+
   int* FindLocationInStatsTable() const;
 
   Isolate* isolate_;
   const char* name_;
   int* ptr_;
-  bool lookup_done_;
+  base::Atomic32 lookup_done_;
 };
 
 // A Histogram represents a dynamically created histogram in the StatsTable.
@@ -180,7 +194,7 @@ class Histogram {
         max_(max),
         num_buckets_(num_buckets),
         histogram_(NULL),
-        lookup_done_(false),
+        lookup_done_(0),
         isolate_(isolate) { }
 
   // Add a single sample to this histogram.
@@ -193,17 +207,20 @@ class Histogram {
 
   // Reset the cached internal pointer.
   void Reset() {
-    lookup_done_ = false;
+    base::NoBarrier_Store(&lookup_done_, 0);
   }
 
  protected:
-  // Returns the handle to the histogram.
+  // Returns the handle to the histogram, creating it on first use.  Like
+  // StatsCounter::GetPtr this tolerates concurrent first use: racing
+  // threads may each call CreateHistogram, but the embedder returns the
+  // same histogram for a given name, so any published handle is valid.
   void* GetHistogram() {
-    if (!lookup_done_) {
-      lookup_done_ = true;
-      histogram_ = CreateHistogram();
-    }
-    return histogram_;
+    if (base::Acquire_Load(&lookup_done_)) return histogram_;
+    void* histogram = CreateHistogram();
+    histogram_ = histogram;
+    base::Release_Store(&lookup_done_, 1);
+    return histogram;
   }
 
   const char* name() { return name_; }
@@ -217,7 +234,7 @@ class Histogram {
   int max_;
   int num_buckets_;
   void* histogram_;
-  bool lookup_done_;
+  base::Atomic32 lookup_done_;
   Isolate* isolate_;
 };
 
@@ -556,6 +573,9 @@ double AggregatedMemoryHistogram<Histogram>::Aggregate(double current_ms,
   SC(memory_allocated, V8.OsMemoryAllocated)                          \
   SC(normalized_maps, V8.NormalizedMaps)                              \
   SC(props_to_dictionary, V8.ObjectPropertiesToDictionary)            \
+  /* Fate of unboxed double fields across map generalization. */      \
+  SC(double_fields_kept_unboxed, V8.DoubleFieldsKeptUnboxed)          \
+  SC(double_fields_boxed, V8.DoubleFieldsBoxed)                       \
   SC(elements_to_dictionary, V8.ObjectElementsToDictionary)           \
   SC(alive_after_last_gc, V8.AliveAfterLastGC)                        \
   SC(objs_since_last_young, V8.ObjsSinceLastYoung)                    \
@@ -571,6 +591,11 @@ double AggregatedMemoryHistogram<Histogram>::Aggregate(double current_ms,
   SC(arguments_adaptors, V8.ArgumentsAdaptors)                        \
   SC(compilation_cache_hits, V8.CompilationCacheHits)                 \
   SC(compilation_cache_misses, V8.CompilationCacheMisses)             \
+  SC(compilation_cache_eval_hits, V8.CompilationCacheEvalHits)        \
+  SC(compilation_cache_eval_misses, V8.CompilationCacheEvalMisses)    \
+  SC(scope_info_cache_hits, V8.ScopeInfoCacheHits)                    \
+  SC(locker_acquisitions, V8.LockerAcquisitions)                      \
+  SC(locker_contentions, V8.LockerContentions)                        \
   SC(string_ctor_calls, V8.StringConstructorCalls)                    \
   SC(string_ctor_conversions, V8.StringConstructorConversions)        \
   SC(string_ctor_cached_number, V8.StringConstructorCachedNumber)     \
@@ -615,6 +640,9 @@ double AggregatedMemoryHistogram<Histogram>::Aggregate(double current_ms,
      V8.GCCompactorCausedByOldspaceExhaustion)                                 \
   SC(gc_last_resort_from_js, V8.GCLastResortFromJS)                            \
   SC(gc_last_resort_from_handles, V8.GCLastResortFromHandles)                  \
+  /* How effective is the descriptor lookup cache? */                          \
+  SC(descriptor_lookup_cache_hits, V8.DescriptorLookupCacheHits)               \
+  SC(descriptor_lookup_cache_misses, V8.DescriptorLookupCacheMisses)           \
   /* How is the generic keyed-load stub used? */                               \
   SC(keyed_load_generic_smi, V8.KeyedLoadGenericSmi)                           \
   SC(keyed_load_generic_symbol, V8.KeyedLoadGenericSymbol)                     \
@@ -656,6 +684,11 @@ double AggregatedMemoryHistogram<Histogram>::Aggregate(double current_ms,
   SC(megamorphic_stub_cache_probes, V8.MegamorphicStubCacheProbes)             \
   SC(megamorphic_stub_cache_misses, V8.MegamorphicStubCacheMisses)             \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
+  SC(megamorphic_stub_cache_primary_hits,                                      \
+     V8.MegamorphicStubCachePrimaryHits)                                       \
+  SC(megamorphic_stub_cache_secondary_hits,                                    \
+     V8.MegamorphicStubCacheSecondaryHits)                                     \
+  SC(megamorphic_stub_cache_evictions, V8.MegamorphicStubCacheEvictions)       \
   SC(array_function_runtime, V8.ArrayFunctionRuntime)                          \
   SC(array_function_native, V8.ArrayFunctionNative)                            \
   SC(for_in, V8.ForIn)                                                         \
@@ -19,6 +19,7 @@
 
 #ifndef V8_SHARED
 #include <algorithm>
+#include <cmath>
 #endif  // !V8_SHARED
 
 #ifdef V8_SHARED
@@ -118,6 +119,9 @@ class PerIsolateData {
   explicit PerIsolateData(Isolate* isolate) : isolate_(isolate), realms_(NULL) {
     HandleScope scope(isolate);
     isolate->SetData(0, this);
+#ifndef V8_SHARED
+    isolate->SetGCStatisticsCallback(Shell::GCStatisticsReceived);
+#endif  // !V8_SHARED
   }
 
   ~PerIsolateData() {
@@ -145,6 +149,12 @@ class PerIsolateData {
   int realm_switch_;
   Persistent<Context>* realms_;
   Persistent<Value> realm_shared_;
+#ifndef V8_SHARED
+  // Stop-the-world pauses (in milliseconds) of the garbage collections
+  // observed since the last performance.resetGCPauses() call, for the
+  // benchmarks/gc-latency suite.
+  i::List<double> gc_pauses_;
+#endif  // !V8_SHARED
 
   int RealmIndexOrThrow(const v8::FunctionCallbackInfo<v8::Value>& args,
                         int arg_offset);
@@ -191,6 +201,9 @@ base::Mutex Shell::context_mutex_;
 const base::TimeTicks Shell::kInitialTicks =
     base::TimeTicks::HighResolutionNow();
 Persistent<Context> Shell::utility_context_;
+base::Mutex Shell::workers_mutex_;
+bool Shell::allow_new_workers_ = true;
+i::List<Worker*> Shell::workers_;
 #endif  // !V8_SHARED
 
 Persistent<Context> Shell::evaluation_context_;
@@ -433,6 +446,118 @@ void Shell::PerformanceNow(const v8::FunctionCallbackInfo<v8::Value>& args) {
     args.GetReturnValue().Set(delta.InMillisecondsF());
   }
 }
+
+
+void Shell::GCStatisticsReceived(Isolate* isolate,
+                                 const v8::GCStatistics& statistics) {
+  PerIsolateData* data = PerIsolateData::Get(isolate);
+  if (data == NULL) return;
+  data->gc_pauses_.Add(statistics.pause_time_in_ms());
+}
+
+
+// performance.gcPauses() returns an array with the stop-the-world pause (in
+// milliseconds) of every garbage collection observed since the last call to
+// performance.resetGCPauses(), oldest first.
+void Shell::PerformanceGCPauses(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  PerIsolateData* data = PerIsolateData::Get(isolate);
+  int length = data->gc_pauses_.length();
+  Handle<Array> result = Array::New(isolate, length);
+  for (int i = 0; i < length; ++i) {
+    result->Set(i, Number::New(isolate, data->gc_pauses_[i]));
+  }
+  args.GetReturnValue().Set(result);
+}
+
+
+void Shell::PerformanceResetGCPauses(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  PerIsolateData::Get(args.GetIsolate())->gc_pauses_.Clear();
+}
+
+
+// Returns true once |function| has reached its terminal optimization state,
+// i.e. further warmup runs will not change how it is compiled. This mirrors
+// the classification done by %GetOptimizationStatus in
+// src/runtime/runtime-test.cc.
+static bool BenchmarkWarmupDone(Handle<Function> function) {
+  i::Handle<i::Object> object = Utils::OpenHandle(*function);
+  if (!object->IsJSFunction()) return true;
+  i::Handle<i::JSFunction> func = i::Handle<i::JSFunction>::cast(object);
+  return func->IsOptimized() || func->shared()->optimization_disabled();
+}
+
+
+// Nearest-rank percentile of an already sorted sample array.
+static double SampleAt(const double* sorted_samples, int count, double p) {
+  int index = static_cast<int>(p * (count - 1) + 0.5);
+  return sorted_samples[index];
+}
+
+
+// Runs the function named by --benchmark: warms it up until its optimization
+// status stabilizes (or the warmup budget is exhausted), then times
+// --benchmark-runs calls and prints summary statistics.
+bool Shell::RunBenchmark(Isolate* isolate, Handle<Context> context) {
+  HandleScope handle_scope(isolate);
+  Handle<String> name = String::NewFromUtf8(isolate, options.benchmark);
+  Handle<Value> callee = context->Global()->Get(name);
+  if (!callee->IsFunction()) {
+    printf("--benchmark: '%s' is not a function\n", options.benchmark);
+    return false;
+  }
+  Handle<Function> function = Handle<Function>::Cast(callee);
+
+  TryCatch try_catch;
+  bool warmed_up = false;
+  int warmup_runs = 0;
+  while (warmup_runs < options.benchmark_warmup && !warmed_up) {
+    function->Call(context->Global(), 0, NULL);
+    if (try_catch.HasCaught()) {
+      ReportException(isolate, &try_catch);
+      return false;
+    }
+    warmup_runs++;
+    warmed_up = BenchmarkWarmupDone(function);
+  }
+
+  int runs = options.benchmark_runs;
+  i::SmartArrayPointer<double> samples(new double[runs]);
+  for (int i = 0; i < runs; i++) {
+    base::TimeTicks start = base::TimeTicks::HighResolutionNow();
+    function->Call(context->Global(), 0, NULL);
+    base::TimeTicks end = base::TimeTicks::HighResolutionNow();
+    if (try_catch.HasCaught()) {
+      ReportException(isolate, &try_catch);
+      return false;
+    }
+    samples[i] = (end - start).InMillisecondsF();
+  }
+
+  double sum = 0;
+  for (int i = 0; i < runs; i++) sum += samples[i];
+  double mean = sum / runs;
+  double square_sum = 0;
+  for (int i = 0; i < runs; i++) {
+    square_sum += (samples[i] - mean) * (samples[i] - mean);
+  }
+  double stddev = runs > 1 ? std::sqrt(square_sum / (runs - 1)) : 0;
+  double ci95 = 1.96 * stddev / std::sqrt(static_cast<double>(runs));
+  std::sort(samples.get(), samples.get() + runs);
+
+  printf("benchmark '%s': %d warmup runs (%s), %d timed runs\n",
+         options.benchmark, warmup_runs,
+         warmed_up ? "stable" : "budget exhausted", runs);
+  printf("  mean    %10.4f ms +/- %.4f ms (95%% CI)\n", mean, ci95);
+  printf("  stddev  %10.4f ms (%.2f%%)\n", stddev,
+         mean > 0 ? 100.0 * stddev / mean : 0.0);
+  printf("  median  %10.4f ms\n", SampleAt(samples.get(), runs, 0.5));
+  printf("  p90     %10.4f ms\n", SampleAt(samples.get(), runs, 0.9));
+  printf("  range   %10.4f ms ... %.4f ms\n", samples[0], samples[runs - 1]);
+  return true;
+}
 #endif  // !V8_SHARED
 
 
@@ -661,6 +786,136 @@ void Shell::Load(const v8::FunctionCallbackInfo<v8::Value>& args) {
 }
 
 
+#ifndef V8_SHARED
+static Worker* GetWorkerFromInternalField(Isolate* isolate,
+                                          Handle<Object> object) {
+  if (object->InternalFieldCount() != 1) {
+    Throw(isolate, "this is not a Worker");
+    return NULL;
+  }
+
+  Worker* worker =
+      static_cast<Worker*>(object->GetAlignedPointerFromInternalField(0));
+  if (worker == NULL) {
+    Throw(isolate, "Worker is defunct because main thread is terminating");
+    return NULL;
+  }
+
+  return worker;
+}
+
+
+void Shell::WorkerNew(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  HandleScope handle_scope(isolate);
+  if (args.Length() < 1 || !args[0]->IsString()) {
+    Throw(isolate, "1st argument must be string");
+    return;
+  }
+
+  if (!args.IsConstructCall()) {
+    Throw(isolate, "Worker must be constructed with new Worker()");
+    return;
+  }
+
+  {
+    base::LockGuard<base::Mutex> lock_guard(&workers_mutex_);
+    if (workers_.length() >= kMaxWorkers) {
+      Throw(isolate, "Too many workers, I won't let you create more");
+      return;
+    }
+
+    // Initialize the internal field to NULL; if we return early without
+    // creating a new Worker (because the main thread is terminating) we can
+    // early-out from the instance calls.
+    args.Holder()->SetAlignedPointerInInternalField(0, NULL);
+
+    if (!allow_new_workers_) return;
+
+    Worker* worker = new Worker;
+    args.Holder()->SetAlignedPointerInInternalField(0, worker);
+    workers_.Add(worker);
+
+    String::Utf8Value script(args[0]);
+    if (!*script) {
+      Throw(isolate, "Can't get worker script");
+      return;
+    }
+    worker->StartExecuteInThread(*script);
+  }
+}
+
+
+void Shell::WorkerPostMessage(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  HandleScope handle_scope(isolate);
+
+  if (args.Length() < 1) {
+    Throw(isolate, "Invalid argument");
+    return;
+  }
+
+  Worker* worker = GetWorkerFromInternalField(isolate, args.Holder());
+  if (worker == NULL) return;
+
+  Handle<Value> message = args[0];
+  ObjectList to_transfer;
+  if (args.Length() >= 2) {
+    if (!args[1]->IsArray()) {
+      Throw(isolate, "Transfer list must be an Array");
+      return;
+    }
+
+    Handle<Array> transfer = Handle<Array>::Cast(args[1]);
+    uint32_t length = transfer->Length();
+    for (uint32_t i = 0; i < length; ++i) {
+      Handle<Value> element = transfer->Get(i);
+      if (element->IsArrayBuffer()) {
+        to_transfer.Add(Handle<Object>::Cast(element));
+      } else {
+        Throw(isolate, "Transfer array elements must be an ArrayBuffer");
+        return;
+      }
+    }
+  }
+
+  ObjectList seen_objects;
+  SerializationData* data = new SerializationData;
+  if (SerializeValue(isolate, message, to_transfer, &seen_objects, data)) {
+    worker->PostMessage(data);
+  } else {
+    delete data;
+  }
+}
+
+
+void Shell::WorkerGetMessage(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  HandleScope handle_scope(isolate);
+  Worker* worker = GetWorkerFromInternalField(isolate, args.Holder());
+  if (worker == NULL) return;
+
+  SerializationData* data = worker->GetMessage();
+  if (data) {
+    int offset = 0;
+    Handle<Value> data_value = Shell::DeserializeValue(isolate, *data, &offset);
+    args.GetReturnValue().Set(data_value);
+    delete data;
+  }
+}
+
+
+void Shell::WorkerTerminate(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  HandleScope handle_scope(isolate);
+  Worker* worker = GetWorkerFromInternalField(isolate, args.Holder());
+  if (worker == NULL) return;
+
+  worker->Terminate();
+}
+#endif  // !V8_SHARED
+
+
 void Shell::Quit(const v8::FunctionCallbackInfo<v8::Value>& args) {
   int exit_code = args[0]->Int32Value();
   OnExit(args.GetIsolate());
@@ -990,8 +1245,36 @@ Handle<ObjectTemplate> Shell::CreateGlobalTemplate(Isolate* isolate) {
   Handle<ObjectTemplate> performance_template = ObjectTemplate::New(isolate);
   performance_template->Set(String::NewFromUtf8(isolate, "now"),
                             FunctionTemplate::New(isolate, PerformanceNow));
+  performance_template->Set(
+      String::NewFromUtf8(isolate, "gcPauses"),
+      FunctionTemplate::New(isolate, PerformanceGCPauses));
+  performance_template->Set(
+      String::NewFromUtf8(isolate, "resetGCPauses"),
+      FunctionTemplate::New(isolate, PerformanceResetGCPauses));
   global_template->Set(String::NewFromUtf8(isolate, "performance"),
                        performance_template);
+
+  Handle<FunctionTemplate> worker_fun_template =
+      FunctionTemplate::New(isolate, WorkerNew);
+  Handle<Signature> worker_signature =
+      Signature::New(isolate, worker_fun_template);
+  worker_fun_template->SetClassName(String::NewFromUtf8(isolate, "Worker"));
+  worker_fun_template->ReadOnlyPrototype();
+  worker_fun_template->PrototypeTemplate()->Set(
+      String::NewFromUtf8(isolate, "terminate"),
+      FunctionTemplate::New(isolate, WorkerTerminate, Handle<Value>(),
+                            worker_signature));
+  worker_fun_template->PrototypeTemplate()->Set(
+      String::NewFromUtf8(isolate, "postMessage"),
+      FunctionTemplate::New(isolate, WorkerPostMessage, Handle<Value>(),
+                            worker_signature));
+  worker_fun_template->PrototypeTemplate()->Set(
+      String::NewFromUtf8(isolate, "getMessage"),
+      FunctionTemplate::New(isolate, WorkerGetMessage, Handle<Value>(),
+                            worker_signature));
+  worker_fun_template->InstanceTemplate()->SetInternalFieldCount(1);
+  global_template->Set(String::NewFromUtf8(isolate, "Worker"),
+                       worker_fun_template);
 #endif  // !V8_SHARED
 
   Handle<ObjectTemplate> os_templ = ObjectTemplate::New(isolate);
@@ -1380,6 +1663,442 @@ void SourceGroup::WaitForThread() {
 #endif  // !V8_SHARED
 
 
+#ifndef V8_SHARED
+void SerializationData::WriteTag(SerializationTag tag) {
+  data_.Add(static_cast<uint8_t>(tag));
+}
+
+
+void SerializationData::WriteMemory(const void* p, int length) {
+  if (length > 0) {
+    i::Vector<uint8_t> block = data_.AddBlock(0, length);
+    memcpy(&block[0], p, length);
+  }
+}
+
+
+void SerializationData::WriteArrayBufferContents(
+    const ArrayBuffer::Contents& contents) {
+  array_buffer_contents_.Add(contents);
+  WriteTag(kSerializationTagTransferredArrayBuffer);
+  int index = array_buffer_contents_.length() - 1;
+  Write(index);
+}
+
+
+SerializationTag SerializationData::ReadTag(int* offset) const {
+  return static_cast<SerializationTag>(Read<uint8_t>(offset));
+}
+
+
+void SerializationData::ReadMemory(void* p, int length, int* offset) const {
+  if (length > 0) {
+    memcpy(p, &data_[*offset], length);
+    (*offset) += length;
+  }
+}
+
+
+void SerializationData::ReadArrayBufferContents(ArrayBuffer::Contents* contents,
+                                                int* offset) const {
+  int index = Read<int>(offset);
+  DCHECK(index < array_buffer_contents_.length());
+  *contents = array_buffer_contents_[index];
+}
+
+
+void SerializationDataQueue::Enqueue(SerializationData* data) {
+  base::LockGuard<base::Mutex> lock_guard(&mutex_);
+  data_.Add(data);
+}
+
+
+bool SerializationDataQueue::Dequeue(SerializationData** data) {
+  base::LockGuard<base::Mutex> lock_guard(&mutex_);
+  *data = NULL;
+  if (data_.is_empty()) return false;
+  *data = data_.Remove(0);
+  return true;
+}
+
+
+bool SerializationDataQueue::IsEmpty() {
+  base::LockGuard<base::Mutex> lock_guard(&mutex_);
+  return data_.is_empty();
+}
+
+
+void SerializationDataQueue::Clear() {
+  base::LockGuard<base::Mutex> lock_guard(&mutex_);
+  for (int i = 0; i < data_.length(); ++i) {
+    delete data_[i];
+  }
+  data_.Clear();
+}
+
+
+Worker::Worker()
+    : in_semaphore_(0),
+      out_semaphore_(0),
+      thread_(NULL),
+      script_(NULL),
+      running_(false) {}
+
+
+Worker::~Worker() {
+  delete thread_;
+  thread_ = NULL;
+  delete[] script_;
+  script_ = NULL;
+  in_queue_.Clear();
+  out_queue_.Clear();
+}
+
+
+void Worker::StartExecuteInThread(const char* script) {
+  base::NoBarrier_Store(&running_, true);
+  script_ = i::StrDup(script);
+  thread_ = new WorkerThread(this);
+  thread_->Start();
+}
+
+
+void Worker::PostMessage(SerializationData* data) {
+  in_queue_.Enqueue(data);
+  in_semaphore_.Signal();
+}
+
+
+SerializationData* Worker::GetMessage() {
+  SerializationData* data = NULL;
+  while (!out_queue_.Dequeue(&data)) {
+    // If the worker is no longer running, and there are no messages in the
+    // queue, don't expect any more messages from it.
+    if (!base::NoBarrier_Load(&running_)) break;
+    out_semaphore_.Wait();
+  }
+  return data;
+}
+
+
+void Worker::Terminate() {
+  base::NoBarrier_Store(&running_, false);
+  // Post NULL to wake the Worker thread message loop, and tell it to stop
+  // running.
+  PostMessage(NULL);
+}
+
+
+void Worker::WaitForThread() {
+  Terminate();
+  thread_->Join();
+}
+
+
+void Worker::ExecuteInThread() {
+  ShellArrayBufferAllocator allocator;
+  Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = &allocator;
+  Isolate* isolate = Isolate::New(create_params);
+  {
+    Isolate::Scope iscope(isolate);
+    {
+      HandleScope scope(isolate);
+      PerIsolateData data(isolate);
+      Local<Context> context = Shell::CreateEvaluationContext(isolate);
+      {
+        Context::Scope cscope(context);
+        PerIsolateData::RealmScope realm_scope(PerIsolateData::Get(isolate));
+
+        Handle<Object> global = context->Global();
+
+        // The worker's postMessage closes over this Worker.
+        Handle<Value> this_value = External::New(isolate, this);
+        Handle<FunctionTemplate> postmessage_fun_template =
+            FunctionTemplate::New(isolate, PostMessageOut, this_value);
+        global->Set(String::NewFromUtf8(isolate, "postMessage"),
+                    postmessage_fun_template->GetFunction());
+
+        // First run the script.
+        Handle<String> file_name = String::NewFromUtf8(isolate, "unnamed");
+        Handle<String> source = String::NewFromUtf8(isolate, script_);
+        if (Shell::ExecuteString(isolate, source, file_name, false, true)) {
+          // Get the message handler.
+          Handle<Value> onmessage =
+              global->Get(String::NewFromUtf8(isolate, "onmessage"));
+          if (onmessage->IsFunction()) {
+            Handle<Function> onmessage_fun = Handle<Function>::Cast(onmessage);
+            // Now wait for messages.
+            while (true) {
+              in_semaphore_.Wait();
+              SerializationData* data;
+              if (!in_queue_.Dequeue(&data)) continue;
+              if (data == NULL) break;
+              int offset = 0;
+              Local<Value> data_value =
+                  Shell::DeserializeValue(isolate, *data, &offset);
+              delete data;
+              Handle<Value> argv[] = {data_value};
+              TryCatch try_catch;
+              onmessage_fun->Call(global, 1, argv);
+              if (try_catch.HasCaught()) {
+                Shell::ReportException(isolate, &try_catch);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  base::NoBarrier_Store(&running_, false);
+  // Wake up a thread that may be blocked in GetMessage.
+  out_semaphore_.Signal();
+  isolate->Dispose();
+}
+
+
+void Worker::PostMessageOut(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  HandleScope handle_scope(isolate);
+
+  if (args.Length() < 1) {
+    Throw(isolate, "Invalid argument");
+    return;
+  }
+
+  Handle<Value> message = args[0];
+
+  // Messages posted out of the worker are always copied; workers that
+  // want zero-copy replies can be restructured to keep ownership on the
+  // main thread.
+  Shell::ObjectList to_transfer;
+  Shell::ObjectList seen_objects;
+  SerializationData* data = new SerializationData;
+  if (Shell::SerializeValue(isolate, message, to_transfer, &seen_objects,
+                            data)) {
+    DCHECK(args.Data()->IsExternal());
+    Handle<External> this_value = Handle<External>::Cast(args.Data());
+    Worker* worker = static_cast<Worker*>(this_value->Value());
+    worker->out_queue_.Enqueue(data);
+    worker->out_semaphore_.Signal();
+  } else {
+    delete data;
+  }
+}
+
+
+static bool FindInObjectList(Handle<Object> object,
+                             const Shell::ObjectList& list) {
+  for (int i = 0; i < list.length(); ++i) {
+    if (list[i]->StrictEquals(object)) return true;
+  }
+  return false;
+}
+
+
+bool Shell::SerializeValue(Isolate* isolate, Handle<Value> value,
+                           const ObjectList& to_transfer,
+                           ObjectList* seen_objects,
+                           SerializationData* out_data) {
+  DCHECK(out_data);
+  HandleScope handle_scope(isolate);
+
+  if (value->IsUndefined()) {
+    out_data->WriteTag(kSerializationTagUndefined);
+  } else if (value->IsNull()) {
+    out_data->WriteTag(kSerializationTagNull);
+  } else if (value->IsTrue()) {
+    out_data->WriteTag(kSerializationTagTrue);
+  } else if (value->IsFalse()) {
+    out_data->WriteTag(kSerializationTagFalse);
+  } else if (value->IsNumber()) {
+    Handle<Number> num = Handle<Number>::Cast(value);
+    out_data->WriteTag(kSerializationTagNumber);
+    out_data->Write(num->Value());
+  } else if (value->IsString()) {
+    v8::String::Utf8Value str(value);
+    out_data->WriteTag(kSerializationTagString);
+    out_data->Write(str.length());
+    out_data->WriteMemory(*str, str.length());
+  } else if (value->IsArray()) {
+    Handle<Array> array = Handle<Array>::Cast(value);
+    if (FindInObjectList(array, *seen_objects)) {
+      Throw(isolate, "Duplicated arrays not supported");
+      return false;
+    }
+    seen_objects->Add(array);
+    out_data->WriteTag(kSerializationTagArray);
+    uint32_t length = array->Length();
+    out_data->Write(length);
+    for (uint32_t i = 0; i < length; ++i) {
+      Handle<Value> element_value = array->Get(i);
+      if (!SerializeValue(isolate, element_value, to_transfer, seen_objects,
+                          out_data)) {
+        return false;
+      }
+    }
+  } else if (value->IsArrayBuffer()) {
+    Handle<v8::ArrayBuffer> array_buffer = Handle<v8::ArrayBuffer>::Cast(value);
+    if (FindInObjectList(array_buffer, *seen_objects)) {
+      Throw(isolate, "Duplicated array buffers not supported");
+      return false;
+    }
+    seen_objects->Add(array_buffer);
+    if (FindInObjectList(array_buffer, to_transfer)) {
+      // Transfer ArrayBuffer: move the backing store to the receiver and
+      // neuter the source, following the neutering rules enforced by
+      // src/runtime/runtime-typedarray.cc.
+      if (!array_buffer->IsNeuterable()) {
+        Throw(isolate, "Can not transfer ArrayBuffer");
+        return false;
+      }
+
+      v8::ArrayBuffer::Contents contents = array_buffer->IsExternal()
+                                           ? array_buffer->GetContents()
+                                           : array_buffer->Externalize();
+      array_buffer->Neuter();
+      out_data->WriteArrayBufferContents(contents);
+    } else {
+      // Clone the ArrayBuffer.
+      v8::ArrayBuffer::Contents contents = array_buffer->GetContents();
+      uint32_t byte_length = static_cast<uint32_t>(contents.ByteLength());
+      out_data->WriteTag(kSerializationTagArrayBuffer);
+      out_data->Write(byte_length);
+      out_data->WriteMemory(contents.Data(), byte_length);
+    }
+  } else if (value->IsObject()) {
+    Handle<Object> object = Handle<Object>::Cast(value);
+    if (FindInObjectList(object, *seen_objects)) {
+      Throw(isolate, "Duplicated objects not supported");
+      return false;
+    }
+    seen_objects->Add(object);
+    Handle<Array> property_names = object->GetOwnPropertyNames();
+    uint32_t length = property_names->Length();
+    out_data->WriteTag(kSerializationTagObject);
+    out_data->Write(length);
+    for (uint32_t i = 0; i < length; ++i) {
+      Handle<Value> name = property_names->Get(i);
+      Handle<Value> property_value = object->Get(name);
+      if (!SerializeValue(isolate, name, to_transfer, seen_objects,
+                          out_data)) {
+        return false;
+      }
+      if (!SerializeValue(isolate, property_value, to_transfer, seen_objects,
+                          out_data)) {
+        return false;
+      }
+    }
+  } else {
+    Throw(isolate, "Don't know how to serialize object");
+    return false;
+  }
+
+  return true;
+}
+
+
+Handle<Value> Shell::DeserializeValue(Isolate* isolate,
+                                      const SerializationData& data,
+                                      int* offset) {
+  DCHECK(offset);
+  Handle<Value> result;
+  SerializationTag tag = data.ReadTag(offset);
+
+  switch (tag) {
+    case kSerializationTagUndefined:
+      result = Undefined(isolate);
+      break;
+    case kSerializationTagNull:
+      result = Null(isolate);
+      break;
+    case kSerializationTagTrue:
+      result = True(isolate);
+      break;
+    case kSerializationTagFalse:
+      result = False(isolate);
+      break;
+    case kSerializationTagNumber:
+      result = Number::New(isolate, data.Read<double>(offset));
+      break;
+    case kSerializationTagString: {
+      int length = data.Read<int>(offset);
+      CHECK(length >= 0);
+      i::SmartArrayPointer<char> buffer(new char[length + 1]);
+      data.ReadMemory(buffer.get(), length, offset);
+      result = String::NewFromUtf8(isolate, buffer.get(),
+                                   String::kNormalString, length);
+      break;
+    }
+    case kSerializationTagArray: {
+      uint32_t length = data.Read<uint32_t>(offset);
+      Handle<Array> array = Array::New(isolate, length);
+      for (uint32_t i = 0; i < length; ++i) {
+        array->Set(i, DeserializeValue(isolate, data, offset));
+      }
+      result = array;
+      break;
+    }
+    case kSerializationTagObject: {
+      uint32_t length = data.Read<uint32_t>(offset);
+      Handle<Object> object = Object::New(isolate);
+      for (uint32_t i = 0; i < length; ++i) {
+        Handle<Value> property_name = DeserializeValue(isolate, data, offset);
+        Handle<Value> property_value = DeserializeValue(isolate, data, offset);
+        object->Set(property_name, property_value);
+      }
+      result = object;
+      break;
+    }
+    case kSerializationTagArrayBuffer: {
+      uint32_t byte_length = data.Read<uint32_t>(offset);
+      Handle<v8::ArrayBuffer> array_buffer = v8::ArrayBuffer::New(isolate, byte_length);
+      v8::ArrayBuffer::Contents contents = array_buffer->GetContents();
+      DCHECK(static_cast<size_t>(byte_length) == contents.ByteLength());
+      data.ReadMemory(contents.Data(), byte_length, offset);
+      result = array_buffer;
+      break;
+    }
+    case kSerializationTagTransferredArrayBuffer: {
+      v8::ArrayBuffer::Contents contents;
+      data.ReadArrayBufferContents(&contents, offset);
+      result = v8::ArrayBuffer::New(isolate, contents.Data(), contents.ByteLength(),
+                                ArrayBufferCreationMode::kInternalized);
+      break;
+    }
+    default:
+      UNREACHABLE();
+  }
+
+  return result;
+}
+
+
+void Shell::CleanupWorkers() {
+  // Make a copy of workers_, because we don't want to hold the workers_mutex_
+  // when we call Worker::Terminate, because that might deadlock with a
+  // worker that is about to create a new Worker.
+  i::List<Worker*> workers_copy;
+  {
+    base::LockGuard<base::Mutex> lock_guard(&workers_mutex_);
+    allow_new_workers_ = false;
+    workers_copy.AddAll(workers_);
+    workers_.Clear();
+  }
+
+  for (int i = 0; i < workers_copy.length(); ++i) {
+    Worker* worker = workers_copy[i];
+    worker->WaitForThread();
+    delete worker;
+  }
+
+  // Now that all workers are terminated, we can re-enable Worker creation.
+  base::LockGuard<base::Mutex> lock_guard(&workers_mutex_);
+  allow_new_workers_ = true;
+}
+#endif  // !V8_SHARED
+
+
 void SetFlagsFromString(const char* flags) {
   v8::V8::SetFlagsFromString(flags, static_cast<int>(strlen(flags)));
 }
@@ -1442,6 +2161,26 @@ bool Shell::SetOptions(int argc, char* argv[]) {
       options.dump_heap_constants = true;
       argv[i] = NULL;
 #endif  // V8_SHARED
+    } else if (strcmp(argv[i], "--benchmark") == 0 ||
+               strncmp(argv[i], "--benchmark=", 12) == 0) {
+#ifdef V8_SHARED
+      printf("D8 with shared library does not support benchmarking\n");
+      return false;
+#else
+      const char* value = argv[i] + 11;
+      options.benchmark = (*value == '=') ? value + 1 : "benchmark";
+      argv[i] = NULL;
+#endif  // V8_SHARED
+    } else if (strncmp(argv[i], "--benchmark-runs=", 17) == 0) {
+      options.benchmark_runs = atoi(argv[i] + 17);
+      if (options.benchmark_runs <= 0) {
+        printf("--benchmark-runs expects a positive number.\n");
+        return false;
+      }
+      argv[i] = NULL;
+    } else if (strncmp(argv[i], "--benchmark-warmup=", 19) == 0) {
+      options.benchmark_warmup = atoi(argv[i] + 19);
+      argv[i] = NULL;
     } else if (strcmp(argv[i], "--throws") == 0) {
       options.expected_to_throw = true;
       argv[i] = NULL;
@@ -1517,6 +2256,7 @@ bool Shell::SetOptions(int argc, char* argv[]) {
 
 
 int Shell::RunMain(Isolate* isolate, int argc, char* argv[]) {
+  int result = 0;
 #ifndef V8_SHARED
   for (int i = 1; i < options.num_isolates; ++i) {
     options.isolate_sources[i].StartExecuteInThread();
@@ -1540,6 +2280,12 @@ int Shell::RunMain(Isolate* isolate, int argc, char* argv[]) {
       Context::Scope cscope(context);
       PerIsolateData::RealmScope realm_scope(PerIsolateData::Get(isolate));
       options.isolate_sources[0].Execute(isolate);
+#ifndef V8_SHARED
+      if (options.benchmark != NULL && options.last_run &&
+          !RunBenchmark(isolate, context)) {
+        result = 1;
+      }
+#endif  // !V8_SHARED
     }
   }
   if (options.send_idle_notification) {
@@ -1559,8 +2305,9 @@ int Shell::RunMain(Isolate* isolate, int argc, char* argv[]) {
   for (int i = 1; i < options.num_isolates; ++i) {
     options.isolate_sources[i].WaitForThread();
   }
+  CleanupWorkers();
 #endif  // !V8_SHARED
-  return 0;
+  return result;
 }
 
 
@@ -189,6 +189,119 @@ class BinaryResource : public v8::String::ExternalOneByteStringResource {
 };
 
 
+#ifndef V8_SHARED
+enum SerializationTag {
+  kSerializationTagUndefined,
+  kSerializationTagNull,
+  kSerializationTagTrue,
+  kSerializationTagFalse,
+  kSerializationTagNumber,
+  kSerializationTagString,
+  kSerializationTagArray,
+  kSerializationTagObject,
+  kSerializationTagArrayBuffer,
+  kSerializationTagTransferredArrayBuffer
+};
+
+
+// A flat byte representation of a postMessage payload, plus the backing
+// stores of any ArrayBuffers that were transferred rather than copied.
+class SerializationData {
+ public:
+  SerializationData() {}
+
+  void WriteTag(SerializationTag tag);
+  void WriteMemory(const void* p, int length);
+  void WriteArrayBufferContents(const ArrayBuffer::Contents& contents);
+
+  template <typename T>
+  void Write(const T& data) {
+    WriteMemory(&data, sizeof(data));
+  }
+
+  SerializationTag ReadTag(int* offset) const;
+  void ReadMemory(void* p, int length, int* offset) const;
+  void ReadArrayBufferContents(ArrayBuffer::Contents* contents,
+                               int* offset) const;
+
+  template <typename T>
+  T Read(int* offset) const {
+    T value;
+    ReadMemory(&value, sizeof(value), offset);
+    return value;
+  }
+
+ private:
+  i::List<uint8_t> data_;
+  i::List<ArrayBuffer::Contents> array_buffer_contents_;
+
+  DISALLOW_COPY_AND_ASSIGN(SerializationData);
+};
+
+
+class SerializationDataQueue {
+ public:
+  void Enqueue(SerializationData* data);
+  bool Dequeue(SerializationData** data);
+  bool IsEmpty();
+  void Clear();
+
+ private:
+  base::Mutex mutex_;
+  i::List<SerializationData*> data_;
+};
+
+
+class Worker {
+ public:
+  Worker();
+  ~Worker();
+
+  // Run the given script in an own thread and isolate. Expects the script
+  // to have installed a global function "onmessage".
+  void StartExecuteInThread(const char* script);
+  // Post a message to the worker's incoming message queue. The worker
+  // takes ownership of the SerializationData.
+  void PostMessage(SerializationData* data);
+  // Synchronously retrieve messages from the worker's outgoing message
+  // queue. If there is no message in the queue, block until a message is
+  // available. If there are no messages in the queue and the worker is no
+  // longer running, return NULL. The caller takes ownership of the
+  // returned data.
+  SerializationData* GetMessage();
+  // Terminate the worker's event loop. Messages from the worker that have
+  // been transmitted but not yet processed are not dropped.
+  void Terminate();
+  // Terminate and join the thread.
+  void WaitForThread();
+
+ private:
+  class WorkerThread : public base::Thread {
+   public:
+    explicit WorkerThread(Worker* worker)
+        : base::Thread(base::Thread::Options("WorkerThread")),
+          worker_(worker) {}
+
+    virtual void Run() { worker_->ExecuteInThread(); }
+
+   private:
+    Worker* worker_;
+  };
+
+  void ExecuteInThread();
+  static void PostMessageOut(const v8::FunctionCallbackInfo<v8::Value>& args);
+
+  base::Semaphore in_semaphore_;
+  base::Semaphore out_semaphore_;
+  SerializationDataQueue in_queue_;
+  SerializationDataQueue out_queue_;
+  base::Thread* thread_;
+  char* script_;
+  base::Atomic32 running_;
+};
+#endif  // !V8_SHARED
+
+
 class ShellOptions {
  public:
   ShellOptions()
@@ -204,6 +317,9 @@ class ShellOptions {
         dump_heap_constants(false),
         expected_to_throw(false),
         mock_arraybuffer_allocator(false),
+        benchmark(NULL),
+        benchmark_runs(30),
+        benchmark_warmup(100),
         num_isolates(1),
         compile_options(v8::ScriptCompiler::kNoCompileOptions),
         isolate_sources(NULL),
@@ -231,6 +347,9 @@ class ShellOptions {
   bool dump_heap_constants;
   bool expected_to_throw;
   bool mock_arraybuffer_allocator;
+  const char* benchmark;  // Name of the function to benchmark, NULL if none.
+  int benchmark_runs;
+  int benchmark_warmup;
   int num_isolates;
   v8::ScriptCompiler::CompileOptions compile_options;
   SourceGroup* isolate_sources;
@@ -283,6 +402,30 @@ class Shell : public i::AllStatic {
                                                 Handle<String> command);
 
   static void PerformanceNow(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void PerformanceGCPauses(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void PerformanceResetGCPauses(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void GCStatisticsReceived(Isolate* isolate,
+                                   const v8::GCStatistics& statistics);
+
+  static bool RunBenchmark(Isolate* isolate, Handle<Context> context);
+
+  typedef i::List<Handle<Object> > ObjectList;
+
+  static void WorkerNew(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void WorkerPostMessage(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void WorkerGetMessage(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void WorkerTerminate(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static bool SerializeValue(Isolate* isolate, Handle<Value> value,
+                             const ObjectList& to_transfer,
+                             ObjectList* seen_objects,
+                             SerializationData* out_data);
+  static Handle<Value> DeserializeValue(Isolate* isolate,
+                                        const SerializationData& data,
+                                        int* offset);
+  static void CleanupWorkers();
 #endif  // !V8_SHARED
 
   static void RealmCurrent(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -377,6 +520,11 @@ class Shell : public i::AllStatic {
   static base::Mutex context_mutex_;
   static const base::TimeTicks kInitialTicks;
 
+  static const int kMaxWorkers = 50;
+  static base::Mutex workers_mutex_;
+  static bool allow_new_workers_;
+  static i::List<Worker*> workers_;
+
   static Counter* GetCounter(const char* name, bool is_histogram);
   static void InstallUtilityScript(Isolate* isolate);
 #endif  // !V8_SHARED
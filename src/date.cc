@@ -40,10 +40,46 @@ void DateCache::ResetDateCache() {
   after_ = &dst_[1];
   local_offset_ms_ = kInvalidLocalOffsetInMs;
   ymd_valid_ = false;
+  for (int i = 0; i < kParseCacheSize; ++i) {
+    parse_cache_[i].length = 0;
+    parse_cache_[i].last_used = 0;
+  }
+  parse_cache_usage_counter_ = 0;
   base::OS::ClearTimezoneCache(tz_cache_);
 }
 
 
+bool DateCache::LookupParseResult(Vector<const uint8_t> str, int* output) {
+  DCHECK(str.length() <= kMaxParseStringLength);
+  for (int i = 0; i < kParseCacheSize; ++i) {
+    ParseCacheEntry* entry = &parse_cache_[i];
+    if (entry->length != str.length()) continue;
+    if (CompareChars(entry->string, str.start(), str.length()) != 0) continue;
+    entry->last_used = ++parse_cache_usage_counter_;
+    for (int j = 0; j < kParseOutputSize; ++j) {
+      output[j] = entry->output[j];
+    }
+    return true;
+  }
+  return false;
+}
+
+
+void DateCache::PutParseResult(Vector<const uint8_t> str, const int* output) {
+  DCHECK(str.length() <= kMaxParseStringLength);
+  ParseCacheEntry* lru = &parse_cache_[0];
+  for (int i = 1; i < kParseCacheSize; ++i) {
+    if (parse_cache_[i].last_used < lru->last_used) lru = &parse_cache_[i];
+  }
+  lru->length = str.length();
+  lru->last_used = ++parse_cache_usage_counter_;
+  MemCopy(lru->string, str.start(), str.length());
+  for (int j = 0; j < kParseOutputSize; ++j) {
+    lru->output[j] = output[j];
+  }
+}
+
+
 void DateCache::ClearSegment(DST* segment) {
   segment->start_sec = kMaxEpochTimeInSec;
   segment->end_sec = -kMaxEpochTimeInSec;
@@ -8,6 +8,7 @@
 #include "src/allocation.h"
 #include "src/base/platform/platform.h"
 #include "src/globals.h"
+#include "src/vector.h"
 
 
 namespace v8 {
@@ -190,6 +191,25 @@ class DateCache {
   // the first day of the given month in the given year.
   int DaysFromYearMonth(int year, int month);
 
+  // Number of components the date parser produces.
+  // This must match DateParser::OUTPUT_SIZE; runtime-date.cc checks.
+  static const int kParseOutputSize = 8;
+
+  // The longest date string the parse memo keeps.
+  static const int kMaxParseStringLength = 40;
+
+  // Sentinel in cached parse output denoting a component the parser left
+  // null, i.e. the UTC offset of local-time strings. Results containing
+  // this value as a genuine component are not cached.
+  static const int kNullParseOutput = kMaxInt;
+
+  // Memo of recently parsed date strings. Log processing tends to parse
+  // the same handful of timestamp strings over and over; remembering the
+  // parser output for the last few distinct strings makes such repeats
+  // hit a simple table instead of rerunning the parser.
+  bool LookupParseResult(Vector<const uint8_t> str, int* output);
+  void PutParseResult(Vector<const uint8_t> str, const int* output);
+
   // Cache stamp is used for invalidating caches in JSDate.
   // We increment the stamp each time when the timezone information changes.
   // JSDate objects perform stamp check and invalidate their caches if
@@ -221,6 +241,17 @@ class DateCache {
   // Size of the Daylight Savings Time cache.
   static const int kDSTSize = 32;
 
+  // Size of the parsed date string memo.
+  static const int kParseCacheSize = 8;
+
+  // An entry of the parsed date string memo.
+  struct ParseCacheEntry {
+    int length;  // Zero if the entry is empty.
+    int last_used;
+    uint8_t string[kMaxParseStringLength];
+    int output[kParseOutputSize];
+  };
+
   // Daylight Savings Time segment stores a segment of time where
   // daylight savings offset does not change.
   struct DST {
@@ -273,6 +304,10 @@ class DateCache {
   int ymd_month_;
   int ymd_day_;
 
+  // Parsed date string memo.
+  ParseCacheEntry parse_cache_[kParseCacheSize];
+  int parse_cache_usage_counter_;
+
   base::TimezoneCache* tz_cache_;
 };
 
@@ -34,6 +34,8 @@ static MemoryChunk* AllocateCodeChunk(MemoryAllocator* allocator) {
 
 DeoptimizerData::DeoptimizerData(MemoryAllocator* allocator)
     : allocator_(allocator),
+      frame_buffer_(NULL),
+      frame_buffer_size_(0),
       deoptimized_frame_info_(NULL),
       current_(NULL) {
   for (int i = 0; i < Deoptimizer::kBailoutTypesWithCodeEntry; ++i) {
@@ -48,6 +50,30 @@ DeoptimizerData::~DeoptimizerData() {
     allocator_->Free(deopt_entry_code_[i]);
     deopt_entry_code_[i] = NULL;
   }
+  free(frame_buffer_);
+  frame_buffer_ = NULL;
+}
+
+
+void* DeoptimizerData::AcquireFrameBuffer(size_t size) {
+  if (frame_buffer_ != NULL && frame_buffer_size_ >= size) {
+    void* result = frame_buffer_;
+    frame_buffer_ = NULL;
+    frame_buffer_size_ = 0;
+    return result;
+  }
+  return malloc(size);
+}
+
+
+void DeoptimizerData::ReleaseFrameBuffer(void* buffer, size_t size) {
+  if (frame_buffer_ == NULL || frame_buffer_size_ < size) {
+    free(frame_buffer_);
+    frame_buffer_ = buffer;
+    frame_buffer_size_ = size;
+  } else {
+    free(buffer);
+  }
 }
 
 
@@ -613,7 +639,12 @@ Deoptimizer::Deoptimizer(Isolate* isolate,
     PROFILE(isolate_, CodeDeoptEvent(compiled_code_, from_, fp_to_sp_delta_));
   }
   unsigned size = ComputeInputFrameSize();
-  input_ = new(size) FrameDescription(size, function);
+  // The input frame is the largest scratch allocation of a deopt event, so
+  // its storage is recycled through the per-isolate DeoptimizerData rather
+  // than malloc'd per event.
+  void* buffer = isolate->deoptimizer_data()->AcquireFrameBuffer(
+      sizeof(FrameDescription) + size - kPointerSize);
+  input_ = ::new (buffer) FrameDescription(size, function);
   input_->SetFrameType(frame_type);
 }
 
@@ -656,7 +687,8 @@ Deoptimizer::~Deoptimizer() {
 
 
 void Deoptimizer::DeleteFrameDescriptions() {
-  delete input_;
+  isolate_->deoptimizer_data()->ReleaseFrameBuffer(
+      input_, sizeof(FrameDescription) + input_->GetFrameSize() - kPointerSize);
   for (int i = 0; i < output_count_; ++i) {
     if (output_[i] != input_) delete output_[i];
   }
@@ -3023,6 +3055,30 @@ void TranslationBuffer::Add(int32_t value, Zone* zone) {
 }
 
 
+int TranslationBuffer::CommitEntry(int start, Zone* zone) {
+  int length = contents_.length() - start;
+  const uint8_t* bytes = &contents_[start];
+  uint32_t hash = 0;
+  for (int i = 0; i < length; i++) {
+    hash = hash * 33 + bytes[i];
+  }
+  // Optimized code tends to contain many deoptimization points with the
+  // same environment, which encode to identical byte sequences.  Share
+  // their encoding instead of storing every copy.
+  for (int i = 0; i < entries_.length(); i++) {
+    const Entry& entry = entries_[i];
+    if (entry.hash != hash || entry.length != length) continue;
+    if (memcmp(&contents_[entry.start], bytes, length) == 0) {
+      contents_.Rewind(start);
+      return entry.start;
+    }
+  }
+  Entry entry = {start, length, hash};
+  entries_.Add(entry, zone);
+  return start;
+}
+
+
 int32_t TranslationIterator::Next() {
   // Run through the bytes until we reach one with a least significant
   // bit of zero (marks the end).
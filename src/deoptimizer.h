@@ -355,9 +355,10 @@ class Deoptimizer : public Malloced {
 
   Isolate* isolate() const { return isolate_; }
 
+  static const int kMaxNumberOfEntries = 16384;
+
  private:
   static const int kMinNumberOfEntries = 64;
-  static const int kMaxNumberOfEntries = 16384;
 
   Deoptimizer(Isolate* isolate,
               JSFunction* function,
@@ -705,11 +706,21 @@ class DeoptimizerData {
 
   void Iterate(ObjectVisitor* v);
 
+  // Scratch storage for the Deoptimizer's input frame description.  The
+  // buffer is recycled across deoptimization events instead of being
+  // malloc'd and freed per event; only the largest buffer seen so far is
+  // retained.
+  void* AcquireFrameBuffer(size_t size);
+  void ReleaseFrameBuffer(void* buffer, size_t size);
+
  private:
   MemoryAllocator* allocator_;
   int deopt_entry_code_entries_[Deoptimizer::kBailoutTypesWithCodeEntry];
   MemoryChunk* deopt_entry_code_[Deoptimizer::kBailoutTypesWithCodeEntry];
 
+  void* frame_buffer_;
+  size_t frame_buffer_size_;
+
   DeoptimizedFrameInfo* deoptimized_frame_info_;
 
   Deoptimizer* current_;
@@ -722,15 +733,29 @@ class DeoptimizerData {
 
 class TranslationBuffer BASE_EMBEDDED {
  public:
-  explicit TranslationBuffer(Zone* zone) : contents_(256, zone) { }
+  explicit TranslationBuffer(Zone* zone)
+      : contents_(256, zone), entries_(8, zone) {}
 
   int CurrentIndex() const { return contents_.length(); }
   void Add(int32_t value, Zone* zone);
 
+  // Called once the translation starting at |start| has been fully written.
+  // If an identical translation was committed earlier, the new bytes are
+  // dropped and the index of the earlier copy is returned instead, so
+  // repeated deoptimization points share a single encoding.
+  int CommitEntry(int start, Zone* zone);
+
   Handle<ByteArray> CreateByteArray(Factory* factory);
 
  private:
+  struct Entry {
+    int start;
+    int length;
+    uint32_t hash;
+  };
+
   ZoneList<uint8_t> contents_;
+  ZoneList<Entry> entries_;
 };
 
 
@@ -395,11 +395,24 @@ static void CopyPackedSmiToDoubleElements(FixedArrayBase* from_base,
   if (copy_size == 0) return;
   FixedArray* from = FixedArray::cast(from_base);
   FixedDoubleArray* to = FixedDoubleArray::cast(to_base);
-  for (uint32_t from_end = from_start + static_cast<uint32_t>(packed_size);
-       from_start < from_end; from_start++, to_start++) {
-    Object* smi = from->get(from_start);
-    DCHECK(!smi->IsTheHole());
-    to->set(to_start, Smi::cast(smi)->value());
+  // The source prefix is known to be packed, so widen straight from the
+  // tagged words into the raw double store, four elements per iteration to
+  // keep the int-to-double conversions pipelined.
+  Object** from_slot = from->data_start() + from_start;
+  double* to_slot = reinterpret_cast<double*>(
+      to->address() + FixedDoubleArray::kHeaderSize) + to_start;
+#ifdef DEBUG
+  for (int i = 0; i < packed_size; i++) DCHECK(!from_slot[i]->IsTheHole());
+#endif
+  int i = 0;
+  for (; i <= packed_size - 4; i += 4) {
+    to_slot[i] = static_cast<double>(Smi::cast(from_slot[i])->value());
+    to_slot[i + 1] = static_cast<double>(Smi::cast(from_slot[i + 1])->value());
+    to_slot[i + 2] = static_cast<double>(Smi::cast(from_slot[i + 2])->value());
+    to_slot[i + 3] = static_cast<double>(Smi::cast(from_slot[i + 3])->value());
+  }
+  for (; i < packed_size; i++) {
+    to_slot[i] = static_cast<double>(Smi::cast(from_slot[i])->value());
   }
 }
 
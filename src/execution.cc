@@ -50,6 +50,28 @@ static void PrintDeserializedCodeInfo(Handle<JSFunction> function) {
 }
 
 
+// Invoke is the single boundary through which C++ enters generated code,
+// via the JSEntryStub.  The entry sequence is a recurring performance
+// complaint for embedders whose bindings cross it at high frequency, so to
+// save the next reader the analysis: a slimmer stub for reentrant calls
+// (when the isolate is already in JS farther up the stack) has been
+// considered and does not work in this architecture.
+//
+//  - The callee-saved register block cannot be skipped on nested entries.
+//    Generated code clobbers C++ callee-saved registers unconditionally;
+//    the C++ frames between the outer JS frame and this call still rely on
+//    the C ABI, so every entry must preserve them.
+//  - The JS_ENTRY stack handler must be pushed per entry.  It is what makes
+//    an exception unwind stop at this boundary and surface as a pending
+//    exception for exactly this Invoke; a nested entry without a handler
+//    would leak thrown exceptions into the outer entry's handler.
+//  - The stack limit is not re-checked here at all; that check lives in the
+//    callee's prologue and is already amortized.
+//
+// The stub does branch on js_entry_sp internally, so nested entries
+// already skip the outermost-entry bookkeeping.  The remaining fast path
+// is the API-function branch below, which avoids the stub entirely; calls
+// that must run JS code pay for the full entry frame by design.
 MUST_USE_RESULT static MaybeHandle<Object> Invoke(
     bool is_construct,
     Handle<JSFunction> function,
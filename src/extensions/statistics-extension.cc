@@ -8,14 +8,20 @@ namespace v8 {
 namespace internal {
 
 const char* const StatisticsExtension::kSource =
-    "native function getV8Statistics();";
+    "native function getV8Statistics();"
+    "native function getFunctionCostTable();";
 
 
 v8::Handle<v8::FunctionTemplate> StatisticsExtension::GetNativeFunctionTemplate(
     v8::Isolate* isolate,
     v8::Handle<v8::String> str) {
-  DCHECK(strcmp(*v8::String::Utf8Value(str), "getV8Statistics") == 0);
-  return v8::FunctionTemplate::New(isolate, StatisticsExtension::GetCounters);
+  if (strcmp(*v8::String::Utf8Value(str), "getV8Statistics") == 0) {
+    return v8::FunctionTemplate::New(isolate, StatisticsExtension::GetCounters);
+  } else {
+    DCHECK(strcmp(*v8::String::Utf8Value(str), "getFunctionCostTable") == 0);
+    return v8::FunctionTemplate::New(
+        isolate, StatisticsExtension::GetFunctionCostTable);
+  }
 }
 
 
@@ -126,6 +132,115 @@ void StatisticsExtension::GetCounters(
   AddNumber64(args.GetIsolate(), result,
               heap->amount_of_external_allocated_memory(),
               "amount_of_external_allocated_memory");
+
+  // Code space composition and fragmentation, for diagnosing instruction
+  // cache and iTLB pressure.
+  PagedSpace* code_space = heap->code_space();
+  v8::Local<v8::Array> page_live_bytes = v8::Array::New(args.GetIsolate());
+  v8::Local<v8::Array> page_area_bytes = v8::Array::New(args.GetIsolate());
+  PageIterator page_iterator(code_space);
+  uint32_t page_index = 0;
+  while (page_iterator.has_next()) {
+    Page* page = page_iterator.next();
+    page_live_bytes->Set(page_index,
+                         v8::Number::New(args.GetIsolate(),
+                                         static_cast<double>(
+                                             page->LiveBytes())));
+    page_area_bytes->Set(page_index,
+                         v8::Number::New(args.GetIsolate(),
+                                         static_cast<double>(
+                                             page->area_size())));
+    page_index++;
+  }
+  result->Set(v8::String::NewFromUtf8(args.GetIsolate(),
+                                      "code_space_page_live_bytes"),
+              page_live_bytes);
+  result->Set(v8::String::NewFromUtf8(args.GetIsolate(),
+                                      "code_space_page_area_bytes"),
+              page_area_bytes);
+
+  intptr_t free_small, free_medium, free_large, free_huge;
+  code_space->GetFreeListStatistics(&free_small, &free_medium, &free_large,
+                                    &free_huge);
+  AddNumber(args.GetIsolate(), result, free_small,
+            "code_space_free_small_bytes");
+  AddNumber(args.GetIsolate(), result, free_medium,
+            "code_space_free_medium_bytes");
+  AddNumber(args.GetIsolate(), result, free_large,
+            "code_space_free_large_bytes");
+  AddNumber(args.GetIsolate(), result, free_huge,
+            "code_space_free_huge_bytes");
+
+  // Count and total size of Code objects by kind, and their age
+  // distribution.
+  int code_kind_count[Code::NUMBER_OF_KINDS];
+  intptr_t code_kind_size[Code::NUMBER_OF_KINDS];
+  memset(code_kind_count, 0, sizeof(code_kind_count));
+  memset(code_kind_size, 0, sizeof(code_kind_size));
+  const int kAgeBuckets = Code::kAfterLastCodeAge - Code::kFirstCodeAge;
+  int code_age_count[kAgeBuckets];
+  memset(code_age_count, 0, sizeof(code_age_count));
+
+  {
+    HeapIterator iterator(heap);
+    for (HeapObject* obj = iterator.next(); obj != NULL;
+         obj = iterator.next()) {
+      if (!obj->IsCode()) continue;
+      Code* code = Code::cast(obj);
+      code_kind_count[code->kind()]++;
+      code_kind_size[code->kind()] += code->Size();
+      if (code->kind() == Code::FUNCTION ||
+          code->kind() == Code::OPTIMIZED_FUNCTION) {
+        code_age_count[code->GetAge() - Code::kFirstCodeAge]++;
+      }
+    }
+  }
+
+  EmbeddedVector<char, 64> name;
+  for (int i = 0; i < Code::NUMBER_OF_KINDS; i++) {
+    if (code_kind_count[i] == 0) continue;
+    Code::Kind kind = static_cast<Code::Kind>(i);
+    SNPrintF(name, "count_of_CODE_KIND_%s", Code::Kind2String(kind));
+    AddNumber(args.GetIsolate(), result, code_kind_count[i], name.start());
+    SNPrintF(name, "size_of_CODE_KIND_%s", Code::Kind2String(kind));
+    AddNumber(args.GetIsolate(), result, code_kind_size[i], name.start());
+  }
+  for (int i = 0; i < kAgeBuckets; i++) {
+    if (code_age_count[i] == 0) continue;
+    SNPrintF(name, "count_of_CODE_AGE_%d", i + Code::kFirstCodeAge);
+    AddNumber(args.GetIsolate(), result, code_age_count[i], name.start());
+  }
+
+  args.GetReturnValue().Set(result);
+}
+
+
+// Returns the per-function cost table collected by the runtime profiler
+// under --profile-function-cost as an array of records.  Passing true as
+// the first argument resets the table, starting a new measurement window.
+void StatisticsExtension::GetFunctionCostTable(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  Isolate* isolate = reinterpret_cast<Isolate*>(args.GetIsolate());
+  RuntimeProfiler* profiler = isolate->runtime_profiler();
+  v8::Local<v8::Array> result = v8::Array::New(args.GetIsolate());
+  uint32_t index = 0;
+  for (HashMap::Entry* entry = profiler->function_costs()->Start();
+       entry != NULL; entry = profiler->function_costs()->Next(entry)) {
+    RuntimeProfiler::FunctionCost* cost =
+        reinterpret_cast<RuntimeProfiler::FunctionCost*>(entry->key);
+    v8::Local<v8::Object> record = v8::Object::New(args.GetIsolate());
+    AddNumber(args.GetIsolate(), record, cost->script_id, "script_id");
+    AddNumber(args.GetIsolate(), record, cost->start_position,
+              "start_position");
+    AddNumber(args.GetIsolate(), record, cost->self_ticks, "self_ticks");
+    record->Set(v8::String::NewFromUtf8(args.GetIsolate(), "name"),
+                v8::String::NewFromUtf8(args.GetIsolate(), cost->name));
+    result->Set(index++, record);
+  }
+  if (args.Length() > 0 && args[0]->IsBoolean() &&
+      args[0]->ToBoolean(args.GetIsolate())->Value()) {
+    profiler->ResetFunctionCosts();
+  }
   args.GetReturnValue().Set(result);
 }
 
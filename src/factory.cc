@@ -634,15 +634,23 @@ Handle<String> Factory::NewProperSubString(Handle<String> str,
     offset += slice->offset();
   }
 
-  DCHECK(str->IsSeqString() || str->IsExternalString());
-  Handle<Map> map = str->IsOneByteRepresentation()
+  return NewSlicedString(str, offset, length);
+}
+
+
+Handle<String> Factory::NewSlicedString(Handle<String> parent, int offset,
+                                        int length, PretenureFlag pretenure) {
+  DCHECK(FLAG_string_slices && length >= SlicedString::kMinLength);
+  DCHECK(parent->IsSeqString() || parent->IsExternalString());
+  Handle<Map> map = parent->IsOneByteRepresentation()
                         ? sliced_one_byte_string_map()
                         : sliced_string_map();
-  Handle<SlicedString> slice = New<SlicedString>(map, NEW_SPACE);
+  AllocationSpace space = (pretenure == TENURED) ? OLD_SPACE : NEW_SPACE;
+  Handle<SlicedString> slice = New<SlicedString>(map, space);
 
   slice->set_hash_field(String::kEmptyHashField);
   slice->set_length(length);
-  slice->set_parent(*str);
+  slice->set_parent(*parent);
   slice->set_offset(offset);
   return slice;
 }
@@ -1477,6 +1485,7 @@ Handle<Code> Factory::NewCode(const CodeDesc& desc,
   code->set_deoptimization_data(*empty_fixed_array(), SKIP_WRITE_BARRIER);
   code->set_raw_type_feedback_info(Smi::FromInt(0));
   code->set_next_code_link(*undefined_value());
+  code->set_safepoint_table(*empty_byte_array(), SKIP_WRITE_BARRIER);
   code->set_handler_table(*empty_fixed_array(), SKIP_WRITE_BARRIER);
   code->set_prologue_offset(prologue_offset);
   if (code->kind() == Code::OPTIMIZED_FUNCTION) {
@@ -2411,6 +2420,7 @@ void Factory::SetRegExpIrregexpData(Handle<JSRegExp> regexp,
   store->set(JSRegExp::kIrregexpMaxRegisterCountIndex, Smi::FromInt(0));
   store->set(JSRegExp::kIrregexpCaptureCountIndex,
              Smi::FromInt(capture_count));
+  store->set(JSRegExp::kIrregexpLiteralPrefixIndex, Smi::FromInt(0));
   regexp->set_data(*store);
 }
 
@@ -220,6 +220,14 @@ class Factory final {
     return NewProperSubString(str, begin, end);
   }
 
+  // Create a sliced string over an already unpacked parent. The caller is
+  // responsible for the SlicedString invariants: the parent is flat and not
+  // itself a slice, and the piece is at least SlicedString::kMinLength long.
+  // Callers creating many slices of the same parent can use this to hoist
+  // the unpacking out of their loop; everybody else wants NewSubString.
+  Handle<String> NewSlicedString(Handle<String> parent, int offset, int length,
+                                 PretenureFlag pretenure = NOT_TENURED);
+
   // Creates a new external String object.  There are two String encodings
   // in the system: one-byte and two-byte.  Unlike other String types, it does
   // not make sense to have a UTF-8 factory function for external strings,
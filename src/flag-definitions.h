@@ -259,6 +259,9 @@ DEFINE_IMPLICATION(track_computed_fields, track_fields)
 DEFINE_BOOL(track_field_types, true, "track field types")
 DEFINE_IMPLICATION(track_field_types, track_fields)
 DEFINE_IMPLICATION(track_field_types, track_heap_object_fields)
+DEFINE_BOOL(migrate_slow_to_fast_on_access, false,
+            "migrate stable dictionary mode objects back to fast properties "
+            "after repeated runtime property accesses")
 DEFINE_BOOL(smi_binop, true, "support smi representation in binary operations")
 
 // Flags for optimization types.
@@ -308,6 +311,8 @@ DEFINE_BOOL(trace_inlining, false, "trace inlining decisions")
 DEFINE_BOOL(trace_load_elimination, false, "trace load elimination")
 DEFINE_BOOL(trace_store_elimination, false, "trace store elimination")
 DEFINE_BOOL(trace_alloc, false, "trace register allocator")
+DEFINE_BOOL(trace_spilling, false,
+            "print a spill summary for each allocated function")
 DEFINE_BOOL(trace_all_uses, false, "trace all use positions")
 DEFINE_BOOL(trace_range, false, "trace range analysis")
 DEFINE_BOOL(trace_gvn, false, "trace global value numbering")
@@ -403,6 +408,9 @@ DEFINE_BOOL(turbo_splitting, true, "split nodes during scheduling in TurboFan")
 DEFINE_BOOL(turbo_types, true, "use typed lowering in TurboFan")
 DEFINE_BOOL(turbo_type_feedback, false, "use type feedback in TurboFan")
 DEFINE_BOOL(turbo_allocate, false, "enable inline allocations in TurboFan")
+DEFINE_BOOL(turbo_allocation_folding, false,
+            "fold consecutive allocations in TurboFan")
+DEFINE_BOOL(turbo_escape, false, "enable escape analysis in TurboFan")
 DEFINE_BOOL(turbo_source_positions, false,
             "track source code positions when building TurboFan IR")
 DEFINE_IMPLICATION(trace_turbo, turbo_source_positions)
@@ -410,18 +418,30 @@ DEFINE_BOOL(context_specialization, false,
             "enable context specialization in TurboFan")
 DEFINE_BOOL(turbo_deoptimization, false, "enable deoptimization in TurboFan")
 DEFINE_BOOL(turbo_inlining, false, "enable inlining in TurboFan")
+DEFINE_INT(turbo_inlining_min_call_count, 10,
+           "minimum call site invocation count for inlining functions larger "
+           "than max_inlined_nodes in TurboFan")
 DEFINE_BOOL(turbo_builtin_inlining, true, "enable builtin inlining in TurboFan")
 DEFINE_BOOL(trace_turbo_inlining, false, "trace TurboFan inlining")
 DEFINE_BOOL(loop_assignment_analysis, true, "perform loop assignment analysis")
 DEFINE_BOOL(turbo_profiling, false, "enable profiling in TurboFan")
+DEFINE_BOOL(turbo_profile_guided_layout, false,
+            "use basic block counts from a profiling run to move cold "
+            "blocks out of line")
 DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
             "verify register allocation in TurboFan")
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
+DEFINE_BOOL(turbo_instruction_scheduling, false,
+            "enable instruction scheduling in TurboFan")
 DEFINE_BOOL(turbo_osr, true, "enable OSR in TurboFan")
 DEFINE_BOOL(turbo_exceptions, false, "enable exception handling in TurboFan")
 DEFINE_BOOL(turbo_stress_loop_peeling, false,
             "stress loop peeling optimization")
+DEFINE_BOOL(turbo_loop_unrolling, false,
+            "enable unrolling of small counted loops in TurboFan")
+DEFINE_BOOL(turbo_vectorize, false,
+            "enable vectorization of typed array loops in TurboFan")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_frame_elision, true, "elide frames in TurboFan")
 
@@ -430,6 +450,10 @@ DEFINE_INT(typed_array_max_size_in_heap, 64,
 
 // Profiler flags.
 DEFINE_INT(frame_count, 1, "number of stack frames inspected by the profiler")
+DEFINE_BOOL(profile_function_cost, false,
+            "attribute profiler ticks to the function on top of the stack "
+            "and keep a per-function cost table "
+            "(read via getFunctionCostTable in the statistics extension)")
 // 0x1800 fits in the immediate field of an ARM instruction.
 DEFINE_INT(interrupt_budget, 0x1800,
            "execution budget before interrupt is triggered")
@@ -532,6 +556,10 @@ DEFINE_INT(max_opt_count, 10,
 
 // compilation-cache.cc
 DEFINE_BOOL(compilation_cache, true, "enable compilation cache")
+DEFINE_INT(regexp_compilation_cache_generations, 2,
+           "number of generations kept in the regexp compilation cache "
+           "(entries are shared isolate-wide across contexts and age by one "
+           "generation per mark-compact)")
 
 DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
@@ -577,6 +605,12 @@ DEFINE_INT(semi_space_growth_factor, 2, "factor by which to grow the new space")
 DEFINE_BOOL(experimental_new_space_growth_heuristic, false,
             "Grow the new space based on the percentage of survivors instead "
             "of their absolute value.")
+DEFINE_BOOL(adaptive_new_space_sizing, false,
+            "grow and shrink the new space online based on survival rate "
+            "and allocation throughput")
+DEFINE_INT(number_string_cache_size, 0,
+           "max number of entries in the number-string cache "
+           "(0 to size it from the semi-space size)")
 DEFINE_INT(max_old_space_size, 0, "max size of the old space (in Mbytes)")
 DEFINE_INT(initial_old_space_size, 0, "initial old space size (in Mbytes)")
 DEFINE_INT(max_executable_size, 0, "max size of executable memory (in Mbytes)")
@@ -604,6 +638,9 @@ DEFINE_BOOL(trace_gc_verbose, false,
             "print more details following each garbage collection")
 DEFINE_INT(trace_allocation_stack_interval, -1,
            "print stack trace after <n> free-list allocations")
+DEFINE_INT(sample_allocation_interval_kb, 0,
+           "when tracking allocations, record roughly one allocation with "
+           "its stack per <n> KB allocated (0 records every allocation)")
 DEFINE_BOOL(trace_fragmentation, false, "report fragmentation for old space")
 DEFINE_BOOL(trace_fragmentation_verbose, false,
             "report fragmentation for old space (detailed)")
@@ -618,11 +655,19 @@ DEFINE_BOOL(flush_code, true,
 DEFINE_BOOL(flush_code_incrementally, true,
             "flush code that we expect not to use again (incrementally)")
 DEFINE_BOOL(trace_code_flushing, false, "trace code flushing progress")
+DEFINE_BOOL(keep_locker_thread_resources, true,
+            "keep per-thread resources alive across top-level v8::Locker "
+            "sections so that relocking by the same thread is cheap")
+DEFINE_BOOL(trace_lock_contention, false,
+            "print which threads contend for the isolate lock")
 DEFINE_BOOL(age_code, true,
             "track un-executed functions to age code and flush only "
             "old code (required for code flushing)")
 DEFINE_BOOL(incremental_marking, true, "use incremental marking")
 DEFINE_BOOL(incremental_marking_steps, true, "do incremental marking steps")
+DEFINE_BOOL(memory_reducer, true,
+            "use the memory reducer to schedule GCs when the heap is idle")
+DEFINE_BOOL(trace_memory_reducer, false, "print memory reducer events")
 DEFINE_BOOL(overapproximate_weak_closure, true,
             "overapproximate weak closer to reduce atomic pause time")
 DEFINE_INT(min_progress_during_object_groups_marking, 128,
@@ -631,6 +676,35 @@ DEFINE_INT(min_progress_during_object_groups_marking, 128,
 DEFINE_INT(max_object_groups_marking_rounds, 3,
            "at most try this many times to over approximate the weak closure")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
+DEFINE_BOOL(concurrent_array_buffer_freeing, true,
+            "free array buffer backing stores on a background thread")
+DEFINE_BOOL(background_second_pass_callbacks, true,
+            "deliver opted-in second pass weak callbacks in batches on a "
+            "background thread")
+DEFINE_BOOL(parallel_marking, false,
+            "use parallel marking tasks during full mark-compact GCs")
+DEFINE_INT(marking_tasks, 4, "number of parallel marking tasks")
+DEFINE_BOOL(parallel_compaction, false,
+            "use parallel compaction tasks to evacuate candidate pages")
+DEFINE_INT(compaction_tasks, 4, "number of parallel compaction tasks")
+DEFINE_BOOL(parallel_scavenge, false,
+            "process old-to-new pointers with parallel scavenge tasks")
+DEFINE_INT(scavenge_tasks, 4, "number of parallel scavenge tasks")
+DEFINE_BOOL(black_allocation, false,
+            "use black allocation in the old generation during incremental "
+            "marking")
+DEFINE_BOOL(concurrent_marking, false,
+            "perform the bulk of incremental marking work on a background "
+            "task")
+DEFINE_BOOL(page_remembered_sets, false,
+            "track old-to-new pointers in per-page remembered sets instead "
+            "of the global store buffer")
+DEFINE_INT(chunk_pool_size, 8,
+           "maximum number of freed pages pooled for reuse by the memory "
+           "allocator (0 disables the pool)")
+DEFINE_INT(large_chunk_pool_size, 8,
+           "maximum number of freed large object chunks pooled for reuse "
+           "by the memory allocator (0 disables the pool)")
 DEFINE_BOOL(trace_incremental_marking, false,
             "trace progress of the incremental marking")
 DEFINE_BOOL(track_gc_object_stats, false,
@@ -655,6 +729,10 @@ DEFINE_INT(histogram_interval, 600000,
 // heap-snapshot-generator.cc
 DEFINE_BOOL(heap_profiler_trace_objects, false,
             "Dump heap object allocations/movements/size_updates")
+DEFINE_INT(heap_snapshot_slice_ms, 0,
+           "report heap snapshot progress to the embedder after every slice "
+           "of this many milliseconds instead of every 10000 objects "
+           "(0 disables time-based slicing)")
 
 
 // v8.cc
@@ -662,6 +740,10 @@ DEFINE_BOOL(use_idle_notification, true,
             "Use idle notification to reduce memory footprint.")
 // ic.cc
 DEFINE_BOOL(use_ic, true, "use inline caching")
+DEFINE_INT(stub_cache_primary_bits, 11,
+           "log2 of the number of entries in the primary stub cache table")
+DEFINE_INT(stub_cache_secondary_bits, 9,
+           "log2 of the number of entries in the secondary stub cache table")
 DEFINE_BOOL(trace_ic, false, "trace inline cache state transitions")
 
 // macro-assembler-ia32.cc
@@ -704,6 +786,9 @@ DEFINE_BOOL(trace_maps, false, "trace map creation")
 
 // parser.cc
 DEFINE_BOOL(allow_natives_syntax, false, "allow natives syntax")
+DEFINE_BOOL(preparse_token_cache, false,
+            "record the tokens the preparser scans in lazy function bodies "
+            "and replay them when the functions are compiled")
 DEFINE_BOOL(trace_parse, false, "trace parsing and preparsing")
 
 // simulator-arm.cc, simulator-arm64.cc and simulator-mips.cc
@@ -780,6 +865,7 @@ DEFINE_BOOL(predictable, false, "enable predictable mode")
 DEFINE_NEG_IMPLICATION(predictable, concurrent_recompilation)
 DEFINE_NEG_IMPLICATION(predictable, concurrent_osr)
 DEFINE_NEG_IMPLICATION(predictable, concurrent_sweeping)
+DEFINE_NEG_IMPLICATION(predictable, concurrent_array_buffer_freeing)
 
 // mark-compact.cc
 DEFINE_BOOL(force_marking_deque_overflows, false,
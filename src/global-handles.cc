@@ -66,6 +66,7 @@ class GlobalHandles::Node {
     index_ = 0;
     set_independent(false);
     set_partially_dependent(false);
+    set_second_pass_off_thread(false);
     set_in_new_space_list(false);
     parameter_or_next_free_.next_free = NULL;
     weak_callback_ = NULL;
@@ -87,6 +88,7 @@ class GlobalHandles::Node {
     class_id_ = v8::HeapProfiler::kPersistentHandleNoClassId;
     set_independent(false);
     set_partially_dependent(false);
+    set_second_pass_off_thread(false);
     set_state(NORMAL);
     parameter_or_next_free_.parameter = NULL;
     weak_callback_ = NULL;
@@ -107,6 +109,7 @@ class GlobalHandles::Node {
     class_id_ = v8::HeapProfiler::kPersistentHandleNoClassId;
     set_independent(false);
     set_partially_dependent(false);
+    set_second_pass_off_thread(false);
     weak_callback_ = NULL;
     DecreaseBlockUses();
   }
@@ -160,6 +163,13 @@ class GlobalHandles::Node {
     flags_ = NodeWeaknessType::update(flags_, weakness_type);
   }
 
+  bool is_second_pass_off_thread() const {
+    return OffThreadSecondPassCallback::decode(extended_flags_);
+  }
+  void set_second_pass_off_thread(bool v) {
+    extended_flags_ = OffThreadSecondPassCallback::update(extended_flags_, v);
+  }
+
   bool IsNearDeath() const {
     // Check for PENDING to ensure correct answer when processing callbacks.
     return state() == PENDING || state() == NEAR_DEATH;
@@ -198,6 +208,11 @@ class GlobalHandles::Node {
       set_partially_dependent(true);
     }
   }
+
+  void MarkSecondPassCallbackOffThread() {
+    DCHECK(IsInUse());
+    set_second_pass_off_thread(true);
+  }
   void clear_partially_dependent() { set_partially_dependent(false); }
 
   // Callback accessor.
@@ -286,7 +301,8 @@ class GlobalHandles::Node {
     typedef v8::WeakCallbackInfo<void> Data;
     auto callback = reinterpret_cast<Data::Callback>(weak_callback_);
     pending_phantom_callbacks->Add(
-        PendingPhantomCallback(this, callback, parameter(), internal_fields));
+        PendingPhantomCallback(this, callback, parameter(), internal_fields,
+                               is_second_pass_off_thread()));
     DCHECK(IsInUse());
     set_state(NEAR_DEATH);
   }
@@ -355,6 +371,12 @@ class GlobalHandles::Node {
 
   uint8_t flags_;
 
+  // The flag byte above is full.  The second one only holds the flag that
+  // allows the second pass weak callback to run on a background thread.
+  class OffThreadSecondPassCallback : public BitField<bool, 0, 1> {};
+
+  uint8_t extended_flags_;
+
   // Handle specific callback - might be a weak reference in disguise.
   WeakCallback weak_callback_;
 
@@ -502,7 +524,9 @@ GlobalHandles::GlobalHandles(Isolate* isolate)
       first_used_block_(NULL),
       first_free_(NULL),
       post_gc_processing_count_(0),
-      object_group_connections_(kObjectGroupConnectionsCapacity) {}
+      object_group_connections_(kObjectGroupConnectionsCapacity),
+      pending_second_pass_batches_(0),
+      second_pass_batch_done_semaphore_(0) {}
 
 
 GlobalHandles::~GlobalHandles() {
@@ -546,6 +570,14 @@ void GlobalHandles::Destroy(Object** location) {
 }
 
 
+void GlobalHandles::DestroyBatch(Object*** locations, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    Object** location = locations[i];
+    if (location != NULL) Node::FromLocation(location)->Release();
+  }
+}
+
+
 void GlobalHandles::MakeWeak(Object** location, void* parameter,
                              WeakCallback weak_callback) {
   Node::FromLocation(location)->MakeWeak(parameter, weak_callback);
@@ -577,6 +609,11 @@ void GlobalHandles::MarkPartiallyDependent(Object** location) {
 }
 
 
+void GlobalHandles::MarkSecondPassCallbackOffThread(Object** location) {
+  Node::FromLocation(location)->MarkSecondPassCallbackOffThread();
+}
+
+
 bool GlobalHandles::IsIndependent(Object** location) {
   return Node::FromLocation(location)->is_independent();
 }
@@ -790,6 +827,25 @@ void GlobalHandles::UpdateListOfNewSpaceNodes() {
 }
 
 
+class GlobalHandles::PendingPhantomCallbacksSecondPassTask : public v8::Task {
+ public:
+  PendingPhantomCallbacksSecondPassTask(GlobalHandles* global_handles,
+                                        List<PendingPhantomCallback>* batch)
+      : global_handles_(global_handles), batch_(batch) {}
+
+  virtual ~PendingPhantomCallbacksSecondPassTask() {}
+
+ private:
+  // v8::Task overrides.
+  void Run() override { global_handles_->RunSecondPassCallbackBatch(batch_); }
+
+  GlobalHandles* global_handles_;
+  List<PendingPhantomCallback>* batch_;
+
+  DISALLOW_COPY_AND_ASSIGN(PendingPhantomCallbacksSecondPassTask);
+};
+
+
 int GlobalHandles::DispatchPendingPhantomCallbacks() {
   int freed_nodes = 0;
   {
@@ -803,20 +859,50 @@ int GlobalHandles::DispatchPendingPhantomCallbacks() {
       freed_nodes++;
     }
   }
-  // The second pass empties the list.
+  // The second pass empties the list.  Callbacks whose handle opted in are
+  // not invoked here; they are collected into one batch and delivered on a
+  // background thread so the GC epilogue does not pay for them.
+  List<PendingPhantomCallback>* batch = NULL;
   while (pending_phantom_callbacks_.length() != 0) {
     auto callback = pending_phantom_callbacks_.RemoveLast();
     DCHECK(callback.node() == nullptr);
     // No second pass callback required.
     if (callback.callback() == nullptr) continue;
+    if (FLAG_background_second_pass_callbacks &&
+        callback.second_pass_off_thread()) {
+      if (batch == NULL) batch = new List<PendingPhantomCallback>();
+      batch->Add(callback);
+      continue;
+    }
     // Fire second pass callback.
     callback.Invoke(isolate());
   }
   pending_phantom_callbacks_.Clear();
+  if (batch != NULL) PostSecondPassCallbackBatch(batch);
   return freed_nodes;
 }
 
 
+void GlobalHandles::PostSecondPassCallbackBatch(
+    List<PendingPhantomCallback>* batch) {
+  base::NoBarrier_AtomicIncrement(&pending_second_pass_batches_, 1);
+  V8::GetCurrentPlatform()->CallOnBackgroundThread(
+      new PendingPhantomCallbacksSecondPassTask(this, batch),
+      v8::Platform::kShortRunningTask);
+}
+
+
+void GlobalHandles::RunSecondPassCallbackBatch(
+    List<PendingPhantomCallback>* batch) {
+  for (int i = 0; i < batch->length(); ++i) {
+    batch->at(i).Invoke(isolate());
+  }
+  delete batch;
+  base::NoBarrier_AtomicIncrement(&pending_second_pass_batches_, -1);
+  second_pass_batch_done_semaphore_.Signal();
+}
+
+
 void GlobalHandles::PendingPhantomCallback::Invoke(Isolate* isolate) {
   Data::Callback* callback_addr = nullptr;
   if (node_ != nullptr) {
@@ -1059,6 +1145,11 @@ void GlobalHandles::RemoveImplicitRefGroups() {
 
 void GlobalHandles::TearDown() {
   // TODO(1428): invoke weak callbacks.
+  // Wait for outstanding second pass callback batches; their callbacks may
+  // reference embedder state that dies with the isolate.
+  while (base::NoBarrier_Load(&pending_second_pass_batches_) > 0) {
+    second_pass_batch_done_semaphore_.Wait();
+  }
 }
 
 
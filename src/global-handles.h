@@ -8,6 +8,8 @@
 #include "include/v8.h"
 #include "include/v8-profiler.h"
 
+#include "src/base/atomicops.h"
+#include "src/base/platform/semaphore.h"
 #include "src/handles.h"
 #include "src/list.h"
 #include "src/utils.h"
@@ -122,6 +124,11 @@ class GlobalHandles {
   // Destroy a global handle.
   static void Destroy(Object** location);
 
+  // Destroy a batch of global handles in one call.  Equivalent to calling
+  // Destroy on each location, but crosses into V8 only once; used by
+  // containers of persistents that are dropped wholesale.
+  static void DestroyBatch(Object*** locations, size_t count);
+
   typedef WeakCallbackData<v8::Value, void>::Callback WeakCallback;
 
   // For a phantom weak reference, the callback does not have access to the
@@ -171,6 +178,11 @@ class GlobalHandles {
   // Mark the reference to this object externaly unreachable.
   static void MarkPartiallyDependent(Object** location);
 
+  // Allow the second pass weak callback registered for the handle to be
+  // invoked on a background thread.  Such a callback must not touch the
+  // V8 heap or call back into the API.
+  static void MarkSecondPassCallbackOffThread(Object** location);
+
   static bool IsIndependent(Object** location);
 
   // Tells whether global handle is near death.
@@ -298,6 +310,12 @@ class GlobalHandles {
   class NodeBlock;
   class NodeIterator;
   class PendingPhantomCallback;
+  class PendingPhantomCallbacksSecondPassTask;
+
+  // Hands a batch of opted-in second pass callbacks to a background task.
+  void PostSecondPassCallbackBatch(List<PendingPhantomCallback>* batch);
+  // Invoked on a background thread; runs and then deletes the batch.
+  void RunSecondPassCallbackBatch(List<PendingPhantomCallback>* batch);
 
   Isolate* isolate_;
 
@@ -332,6 +350,12 @@ class GlobalHandles {
 
   List<PendingPhantomCallback> pending_phantom_callbacks_;
 
+  // Number of second pass callback batches handed to the platform but not
+  // yet finished.  TearDown waits for all of them, since the callbacks may
+  // reference embedder state that dies with the isolate.
+  base::Atomic32 pending_second_pass_batches_;
+  base::Semaphore second_pass_batch_done_semaphore_;
+
   friend class Isolate;
 
   DISALLOW_COPY_AND_ASSIGN(GlobalHandles);
@@ -343,8 +367,12 @@ class GlobalHandles::PendingPhantomCallback {
   typedef v8::WeakCallbackInfo<void> Data;
   PendingPhantomCallback(
       Node* node, Data::Callback callback, void* parameter,
-      void* internal_fields[v8::kInternalFieldsInWeakCallback])
-      : node_(node), callback_(callback), parameter_(parameter) {
+      void* internal_fields[v8::kInternalFieldsInWeakCallback],
+      bool second_pass_off_thread)
+      : node_(node),
+        callback_(callback),
+        parameter_(parameter),
+        second_pass_off_thread_(second_pass_off_thread) {
     for (int i = 0; i < v8::kInternalFieldsInWeakCallback; ++i) {
       internal_fields_[i] = internal_fields[i];
     }
@@ -354,11 +382,13 @@ class GlobalHandles::PendingPhantomCallback {
 
   Node* node() { return node_; }
   Data::Callback callback() { return callback_; }
+  bool second_pass_off_thread() const { return second_pass_off_thread_; }
 
  private:
   Node* node_;
   Data::Callback callback_;
   void* parameter_;
+  bool second_pass_off_thread_;
   void* internal_fields_[v8::kInternalFieldsInWeakCallback];
 };
 
@@ -172,6 +172,12 @@ function InnerArrayFill(value, start, end, array, length) {
     throw MakeTypeError(kArrayFunctionsOnFrozen);
   }
 
+  // Packed arrays fill their backing store directly in the runtime.
+  if (i < end && IS_ARRAY(array) && %_IsSmi(i) && %_IsSmi(end) &&
+      %FastArrayFill(array, value, i, end)) {
+    return array;
+  }
+
   for (; i < end; i++)
     array[i] = value;
   return array;
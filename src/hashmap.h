@@ -210,11 +210,9 @@ void* TemplateHashMapImpl<AllocationPolicy>::Remove(void* key, uint32_t hash) {
 
 template<class AllocationPolicy>
 void TemplateHashMapImpl<AllocationPolicy>::Clear() {
-  // Mark all entries as empty.
-  const Entry* end = map_end();
-  for (Entry* p = map_; p < end; p++) {
-    p->key = NULL;
-  }
+  // Mark all entries as empty in one bulk store; a NULL key marks an
+  // entry as empty, clearing the other fields is harmless.
+  memset(map_, 0, capacity_ * sizeof(Entry));
   occupancy_ = 0;
 }
 
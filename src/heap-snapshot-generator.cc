@@ -2537,6 +2537,7 @@ HeapSnapshotGenerator::HeapSnapshotGenerator(
 
 
 bool HeapSnapshotGenerator::GenerateSnapshot() {
+  slice_timer_.Start();
   v8_heap_explorer_.TagGlobalObjects();
 
   // TODO(1562) Profiler assumes that any object that is in the heap after
@@ -2585,13 +2586,28 @@ void HeapSnapshotGenerator::ProgressStep() {
 
 bool HeapSnapshotGenerator::ProgressReport(bool force) {
   const int kProgressReportGranularity = 10000;
-  if (control_ != NULL
-      && (force || progress_counter_ % kProgressReportGranularity == 0)) {
-      return
-          control_->ReportProgressValue(progress_counter_, progress_total_) ==
-          v8::ActivityControl::kContinue;
+  // When time-based slicing is enabled, checking the timer on every object
+  // would be too expensive, so the slice length is only probed at a coarse
+  // object granularity.
+  const int kSliceCheckGranularity = 1024;
+  if (control_ == NULL) return true;
+  if (!force) {
+    if (FLAG_heap_snapshot_slice_ms > 0) {
+      // Bound the time between embedder callbacks instead of the object
+      // count, so that abort requests and watchdogs observe a predictable
+      // latency even when reference extraction is slow.
+      if (progress_counter_ % kSliceCheckGranularity != 0 ||
+          slice_timer_.Elapsed().InMillisecondsF() <
+              FLAG_heap_snapshot_slice_ms) {
+        return true;
+      }
+    } else if (progress_counter_ % kProgressReportGranularity != 0) {
+      return true;
+    }
   }
-  return true;
+  slice_timer_.Restart();
+  return control_->ReportProgressValue(progress_counter_, progress_total_) ==
+         v8::ActivityControl::kContinue;
 }
 
 
@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_SNAPSHOT_GENERATOR_H_
 #define V8_HEAP_SNAPSHOT_GENERATOR_H_
 
+#include "src/base/platform/elapsed-timer.h"
 #include "src/strings-storage.h"
 
 namespace v8 {
@@ -548,6 +549,9 @@ class HeapSnapshotGenerator : public SnapshottingProgressReportingInterface {
   // Used during snapshot generation.
   int progress_counter_;
   int progress_total_;
+  // Measures the length of the current snapshot slice when time-based
+  // progress reporting is enabled with --heap-snapshot-slice-ms.
+  base::ElapsedTimer slice_timer_;
   Heap* heap_;
 
   DISALLOW_COPY_AND_ASSIGN(HeapSnapshotGenerator);
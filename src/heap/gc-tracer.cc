@@ -5,6 +5,7 @@
 #include "src/v8.h"
 
 #include "src/heap/gc-tracer.h"
+#include "src/tracing/trace-event.h"
 
 namespace v8 {
 namespace internal {
@@ -134,6 +135,10 @@ void GCTracer::Start(GarbageCollector collector, const char* gc_reason,
     }
   }
 
+  TRACE_EVENT_BEGIN0("v8", current_.type == Event::SCAVENGER
+                               ? "V8.GCScavenger"
+                               : "V8.GCCompactor");
+
   current_.start_time = start_time;
   current_.start_object_size = heap_->SizeOfObjects();
   current_.start_memory_size = heap_->isolate()->memory_allocator()->Size();
@@ -180,6 +185,9 @@ void GCTracer::Stop(GarbageCollector collector) {
           (current_.type == Event::MARK_COMPACTOR ||
            current_.type == Event::INCREMENTAL_MARK_COMPACTOR)));
 
+  TRACE_EVENT_END0("v8", current_.type == Event::SCAVENGER ? "V8.GCScavenger"
+                                                           : "V8.GCCompactor");
+
   current_.end_time = heap_->MonotonicallyIncreasingTimeInMs();
   current_.end_object_size = heap_->SizeOfObjects();
   current_.end_memory_size = heap_->isolate()->memory_allocator()->Size();
@@ -259,6 +267,42 @@ void GCTracer::Stop(GarbageCollector collector) {
 }
 
 
+void GCTracer::CopyStatistics(v8::GCStatistics* statistics) const {
+  const Event& event = current_;
+  statistics->type_ = event.type == Event::SCAVENGER
+                          ? kGCTypeScavenge
+                          : kGCTypeMarkSweepCompact;
+  statistics->pause_time_in_ms_ = event.end_time - event.start_time;
+  statistics->external_time_in_ms_ = event.scopes[Scope::EXTERNAL];
+  statistics->marking_time_in_ms_ = event.scopes[Scope::MC_MARK];
+  statistics->sweeping_time_in_ms_ =
+      event.scopes[Scope::MC_SWEEP] + event.scopes[Scope::MC_SWEEP_NEWSPACE] +
+      event.scopes[Scope::MC_SWEEP_OLDSPACE] +
+      event.scopes[Scope::MC_SWEEP_CODE] + event.scopes[Scope::MC_SWEEP_CELL] +
+      event.scopes[Scope::MC_SWEEP_MAP];
+  statistics->evacuation_time_in_ms_ =
+      event.scopes[Scope::MC_EVACUATE_PAGES] +
+      event.scopes[Scope::MC_UPDATE_NEW_TO_NEW_POINTERS] +
+      event.scopes[Scope::MC_UPDATE_ROOT_TO_NEW_POINTERS] +
+      event.scopes[Scope::MC_UPDATE_OLD_TO_NEW_POINTERS] +
+      event.scopes[Scope::MC_UPDATE_POINTERS_TO_EVACUATED] +
+      event.scopes[Scope::MC_UPDATE_POINTERS_BETWEEN_EVACUATED] +
+      event.scopes[Scope::MC_UPDATE_MISC_POINTERS];
+  statistics->weak_processing_time_in_ms_ =
+      event.scopes[Scope::MC_INCREMENTAL_WEAKCLOSURE] +
+      event.scopes[Scope::MC_WEAKCLOSURE] +
+      event.scopes[Scope::MC_WEAKCOLLECTION_PROCESS] +
+      event.scopes[Scope::MC_WEAKCOLLECTION_CLEAR] +
+      event.scopes[Scope::MC_WEAKCOLLECTION_ABORT];
+  statistics->promoted_size_ =
+      static_cast<size_t>(heap_->promoted_objects_size_);
+  statistics->semi_space_copied_size_ =
+      static_cast<size_t>(heap_->semi_space_copied_object_size_);
+  statistics->incremental_marking_speed_ =
+      static_cast<size_t>(IncrementalMarkingSpeedInBytesPerMillisecond());
+}
+
+
 void GCTracer::AddNewSpaceAllocationTime(double duration,
                                          intptr_t allocation_in_bytes) {
   allocation_events_.push_front(AllocationEvent(duration, allocation_in_bytes));
@@ -8,6 +8,9 @@
 #include "src/base/platform/platform.h"
 
 namespace v8 {
+
+class GCStatistics;
+
 namespace internal {
 
 // A simple ring buffer class with maximum size known at compile time.
@@ -295,6 +298,10 @@ class GCTracer {
   // Stop collecting data and print results.
   void Stop(GarbageCollector collector);
 
+  // Copies structured statistics about the last completed collection into
+  // |statistics|, for delivery to the embedder's GCStatisticsCallback.
+  void CopyStatistics(v8::GCStatistics* statistics) const;
+
   // Log an allocation throughput event.
   void AddNewSpaceAllocationTime(double duration, intptr_t allocation_in_bytes);
 
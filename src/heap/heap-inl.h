@@ -137,15 +137,17 @@ AllocationResult Heap::AllocateTwoByteInternalizedString(Vector<const uc16> str,
   return answer;
 }
 
-AllocationResult Heap::CopyFixedArray(FixedArray* src) {
+AllocationResult Heap::CopyFixedArray(FixedArray* src,
+                                      PretenureFlag pretenure) {
   if (src->length() == 0) return src;
-  return CopyFixedArrayWithMap(src, src->map());
+  return CopyFixedArrayWithMap(src, src->map(), pretenure);
 }
 
 
-AllocationResult Heap::CopyFixedDoubleArray(FixedDoubleArray* src) {
+AllocationResult Heap::CopyFixedDoubleArray(FixedDoubleArray* src,
+                                            PretenureFlag pretenure) {
   if (src->length() == 0) return src;
-  return CopyFixedDoubleArrayWithMap(src, src->map());
+  return CopyFixedDoubleArrayWithMap(src, src->map(), pretenure);
 }
 
 
@@ -200,6 +202,22 @@ AllocationResult Heap::AllocateRaw(int size_in_bytes, AllocationSpace space,
     allocation = map_space_->AllocateRawUnaligned(size_in_bytes);
   }
   if (allocation.To(&object)) {
+    if (incremental_marking()->black_allocation()) {
+      // Objects allocated in the old generation while incremental marking
+      // is running are allocated black, so marking steps never have to
+      // visit them.
+      if (incremental_marking()->concurrent_marking_in_progress()) {
+        // The concurrent marking task may be updating other mark bits in
+        // the same bitmap cell.
+        Marking::WhiteToBlackAtomic(Marking::MarkBitFrom(object));
+        MemoryChunk::FromAddress(object->address())
+            ->IncrementLiveBytesAtomic(size_in_bytes);
+      } else {
+        Marking::MarkBlack(Marking::MarkBitFrom(object));
+        MemoryChunk::IncrementLiveBytesFromMutator(object->address(),
+                                                   size_in_bytes);
+      }
+    }
     OnAllocationEvent(object, size_in_bytes);
   } else {
     old_gen_exhausted_ = true;
@@ -211,7 +229,18 @@ AllocationResult Heap::AllocateRaw(int size_in_bytes, AllocationSpace space,
 void Heap::OnAllocationEvent(HeapObject* object, int size_in_bytes) {
   HeapProfiler* profiler = isolate_->heap_profiler();
   if (profiler->is_tracking_allocations()) {
-    profiler->AllocationEvent(object->address(), size_in_bytes);
+    if (FLAG_sample_allocation_interval_kb > 0) {
+      // Sampling mode: only the allocation that exhausts the byte countdown
+      // pays for a stack walk, so tracking can stay enabled in production.
+      allocation_sample_countdown_ -= size_in_bytes;
+      if (allocation_sample_countdown_ <= 0) {
+        allocation_sample_countdown_ +=
+            static_cast<intptr_t>(FLAG_sample_allocation_interval_kb) * KB;
+        profiler->AllocationEvent(object->address(), size_in_bytes);
+      }
+    } else {
+      profiler->AllocationEvent(object->address(), size_in_bytes);
+    }
   }
 
   ++allocations_count_;
@@ -428,12 +457,12 @@ void Heap::MoveBlock(Address dst, Address src, int byte_size) {
 void Heap::ScavengePointer(HeapObject** p) { ScavengeObject(p, *p); }
 
 
-AllocationMemento* Heap::FindAllocationMemento(HeapObject* object) {
+AllocationMemento* Heap::FindAllocationMemento(Map* map, HeapObject* object) {
   // Check if there is potentially a memento behind the object. If
   // the last word of the memento is on another page we return
   // immediately.
   Address object_address = object->address();
-  Address memento_address = object_address + object->Size();
+  Address memento_address = object_address + object->SizeFromMap(map);
   Address last_memento_word_address = memento_address + kPointerSize;
   if (!NewSpacePage::OnSamePage(object_address, last_memento_word_address)) {
     return NULL;
@@ -467,20 +496,32 @@ AllocationMemento* Heap::FindAllocationMemento(HeapObject* object) {
 }
 
 
-void Heap::UpdateAllocationSiteFeedback(HeapObject* object,
-                                        ScratchpadSlotMode mode) {
-  Heap* heap = object->GetHeap();
-  DCHECK(heap->InFromSpace(object));
+void Heap::UpdateAllocationSite(Map* map, HeapObject* object,
+                                HashMap* pretenuring_feedback) {
+  DCHECK(InFromSpace(object));
 
   if (!FLAG_allocation_site_pretenuring ||
-      !AllocationSite::CanTrack(object->map()->instance_type()))
+      !AllocationSite::CanTrack(map->instance_type()))
     return;
 
-  AllocationMemento* memento = heap->FindAllocationMemento(object);
+  AllocationMemento* memento = FindAllocationMemento(map, object);
   if (memento == NULL) return;
 
-  if (memento->GetAllocationSite()->IncrementMementoFoundCount()) {
-    heap->AddAllocationSiteToScratchpad(memento->GetAllocationSite(), mode);
+  AllocationSite* site = memento->GetAllocationSite();
+  if (pretenuring_feedback == &global_pretenuring_feedback_) {
+    // The main thread maintains the found count directly on the site and
+    // registers the site for processing once it has enough feedback.
+    if (site->IncrementMementoFoundCount()) {
+      global_pretenuring_feedback_.LookupOrInsert(site,
+                                                  ComputePointerHash(site));
+    }
+  } else {
+    // Scavenge tasks only bump a task-local count; the site itself is
+    // updated when the feedback maps are merged on the main thread.
+    HashMap::Entry* entry =
+        pretenuring_feedback->LookupOrInsert(site, ComputePointerHash(site));
+    entry->value = reinterpret_cast<void*>(
+        reinterpret_cast<intptr_t>(entry->value) + 1);
   }
 }
 
@@ -503,7 +544,9 @@ void Heap::ScavengeObject(HeapObject** p, HeapObject* object) {
     return;
   }
 
-  UpdateAllocationSiteFeedback(object, IGNORE_SCRATCHPAD_SLOT);
+  Heap* heap = object->GetHeap();
+  heap->UpdateAllocationSite(first_word.ToMap(), object,
+                             &heap->global_pretenuring_feedback_);
 
   // AllocationMementos are unrooted and shouldn't survive a scavenge
   DCHECK(object->map() != object->GetHeap()->allocation_memento_map());
@@ -64,6 +64,7 @@ struct Heap::StrongRootsList {
 Heap::Heap()
     : amount_of_external_allocated_memory_(0),
       amount_of_external_allocated_memory_at_last_global_gc_(0),
+      last_global_gc_time_ms_(0.0),
       isolate_(NULL),
       code_range_size_(0),
       // semispace_size_ should be a power of 2 and old_generation_size_ should
@@ -84,6 +85,7 @@ Heap::Heap()
       maximum_committed_(0),
       survived_since_last_expansion_(0),
       survived_last_scavenge_(0),
+      low_load_scavenges_(0),
       sweep_generation_(0),
       always_allocate_scope_depth_(0),
       contexts_disposed_(0),
@@ -97,6 +99,7 @@ Heap::Heap()
       gc_state_(NOT_IN_GC),
       gc_post_processing_depth_(0),
       allocations_count_(0),
+      allocation_sample_countdown_(0),
       raw_allocations_hash_(0),
       dump_allocations_hash_countdown_(FLAG_dump_allocations_digest_at_alloc),
       ms_count_(0),
@@ -113,6 +116,15 @@ Heap::Heap()
       inline_allocation_disabled_(false),
       store_buffer_rebuilder_(store_buffer()),
       hidden_string_(NULL),
+      gc_statistics_callback_(NULL),
+      code_retention_minimum_age_in_ms_(0),
+      code_retention_hot_tick_threshold_(0),
+      code_flush_budget_per_gc_(0),
+      flushed_function_count_(0),
+      flushed_code_size_(0),
+      recompiled_function_count_(0),
+      recompiled_code_size_(0),
+      code_aging_epochs_(0),
       gc_safe_size_of_old_object_(NULL),
       total_regexp_code_generated_(0),
       tracer_(this),
@@ -137,18 +149,24 @@ Heap::Heap()
       store_buffer_(this),
       marking_(this),
       incremental_marking_(this),
+      memory_reducer_(this),
       gc_count_at_last_idle_gc_(0),
       full_codegen_bytes_generated_(0),
       crankshaft_codegen_bytes_generated_(0),
       gcs_since_last_deopt_(0),
-      allocation_sites_scratchpad_length_(0),
+      global_pretenuring_feedback_(HashMap::PointersMatch,
+                                   kInitialFeedbackCapacity),
       promotion_queue_(this),
+      pending_scavenge_tasks_semaphore_(0),
+      next_parallel_scavenge_slot_(0),
       configured_(false),
       external_string_table_(this),
       chunks_queued_for_free_(NULL),
       gc_callbacks_depth_(0),
       deserialization_complete_(false),
       concurrent_sweeping_enabled_(false),
+      pending_array_buffer_free_tasks_(0),
+      pending_array_buffer_free_tasks_semaphore_(0),
       strong_roots_list_(NULL) {
 // Allow build-time customization of the max semispace size. Building
 // V8 with snapshots and a non-default max semispace size is much
@@ -515,6 +533,26 @@ void Heap::RepairFreeListsAfterDeserialization() {
 }
 
 
+void Heap::MergeAllocationSitePretenuringFeedback(
+    HashMap* local_pretenuring_feedback) {
+  // Allocation sites are always tenured, so the scavenge that produced the
+  // local feedback cannot have moved them and the keys are still valid.
+  for (HashMap::Entry* local_entry = local_pretenuring_feedback->Start();
+       local_entry != NULL;
+       local_entry = local_pretenuring_feedback->Next(local_entry)) {
+    AllocationSite* site =
+        reinterpret_cast<AllocationSite*>(local_entry->key);
+    int value =
+        static_cast<int>(reinterpret_cast<intptr_t>(local_entry->value));
+    DCHECK(value > 0);
+    if (site->IncrementMementoFoundCount(value)) {
+      global_pretenuring_feedback_.LookupOrInsert(site,
+                                                  ComputePointerHash(site));
+    }
+  }
+}
+
+
 void Heap::ProcessPretenuringFeedback() {
   if (FLAG_allocation_site_pretenuring) {
     int tenure_decisions = 0;
@@ -523,30 +561,23 @@ void Heap::ProcessPretenuringFeedback() {
     int allocation_sites = 0;
     int active_allocation_sites = 0;
 
-    // If the scratchpad overflowed, we have to iterate over the allocation
-    // sites list.
-    // TODO(hpayer): We iterate over the whole list of allocation sites when
-    // we grew to the maximum semi-space size to deopt maybe tenured
-    // allocation sites. We could hold the maybe tenured allocation sites
-    // in a seperate data structure if this is a performance problem.
-    bool deopt_maybe_tenured = DeoptMaybeTenuredAllocationSites();
-    bool use_scratchpad =
-        allocation_sites_scratchpad_length_ < kAllocationSiteScratchpadSize &&
-        !deopt_maybe_tenured;
-
-    int i = 0;
-    Object* list_element = allocation_sites_list();
     bool trigger_deoptimization = false;
     bool maximum_size_scavenge = MaximumSizeScavenge();
-    while (use_scratchpad ? i < allocation_sites_scratchpad_length_
-                          : list_element->IsAllocationSite()) {
-      AllocationSite* site =
-          use_scratchpad
-              ? AllocationSite::cast(allocation_sites_scratchpad()->get(i))
-              : AllocationSite::cast(list_element);
-      allocation_mementos_found += site->memento_found_count();
-      if (site->memento_found_count() > 0) {
+
+    // Digest the feedback of the allocation sites that accumulated mementos
+    // since the last garbage collection.
+    for (HashMap::Entry* e = global_pretenuring_feedback_.Start(); e != NULL;
+         e = global_pretenuring_feedback_.Next(e)) {
+      AllocationSite* site = reinterpret_cast<AllocationSite*>(e->key);
+      int found_count = site->memento_found_count();
+      // An entry in the storage does not imply that the count is > 0 because
+      // allocation sites might have been reset due to too many objects dying
+      // in old space.
+      if (found_count > 0) {
+        DCHECK(site->IsAllocationSite());
+        allocation_sites++;
         active_allocation_sites++;
+        allocation_mementos_found += found_count;
         if (site->DigestPretenuringFeedback(maximum_size_scavenge)) {
           trigger_deoptimization = true;
         }
@@ -555,17 +586,23 @@ void Heap::ProcessPretenuringFeedback() {
         } else {
           dont_tenure_decisions++;
         }
-        allocation_sites++;
-      }
-
-      if (deopt_maybe_tenured && site->IsMaybeTenure()) {
-        site->set_deopt_dependent_code(true);
-        trigger_deoptimization = true;
       }
+    }
 
-      if (use_scratchpad) {
-        i++;
-      } else {
+    // TODO(hpayer): We iterate over the whole list of allocation sites when
+    // we grew to the maximum semi-space size to deopt maybe tenured
+    // allocation sites. We could hold the maybe tenured allocation sites
+    // in a seperate data structure if this is a performance problem.
+    bool deopt_maybe_tenured = DeoptMaybeTenuredAllocationSites();
+    if (deopt_maybe_tenured) {
+      Object* list_element = allocation_sites_list();
+      while (list_element->IsAllocationSite()) {
+        AllocationSite* site = AllocationSite::cast(list_element);
+        allocation_sites++;
+        if (site->IsMaybeTenure()) {
+          site->set_deopt_dependent_code(true);
+          trigger_deoptimization = true;
+        }
         list_element = site->weak_next();
       }
     }
@@ -574,8 +611,6 @@ void Heap::ProcessPretenuringFeedback() {
       isolate_->stack_guard()->RequestDeoptMarkedAllocationSites();
     }
 
-    FlushAllocationSitesScratchpad();
-
     if (FLAG_trace_pretenuring_statistics &&
         (allocation_mementos_found > 0 || tenure_decisions > 0 ||
          dont_tenure_decisions > 0)) {
@@ -583,10 +618,12 @@ void Heap::ProcessPretenuringFeedback() {
           "GC: (mode, #visited allocation sites, #active allocation sites, "
           "#mementos, #tenure decisions, #donttenure decisions) "
           "(%s, %d, %d, %d, %d, %d)\n",
-          use_scratchpad ? "use scratchpad" : "use list", allocation_sites,
-          active_allocation_sites, allocation_mementos_found, tenure_decisions,
-          dont_tenure_decisions);
+          deopt_maybe_tenured ? "also deopt maybe tenured" : "use feedback",
+          allocation_sites, active_allocation_sites,
+          allocation_mementos_found, tenure_decisions, dont_tenure_decisions);
     }
+
+    global_pretenuring_feedback_.Clear();
   }
 }
 
@@ -847,6 +884,37 @@ void Heap::CollectAllAvailableGarbage(const char* gc_reason) {
 }
 
 
+void Heap::ReportExternalMemoryPressure(const char* gc_reason) {
+  // Keep in sync with Internals::kExternalAllocationLimit in include/v8.h,
+  // which gates calls into this function.
+  static const int64_t kExternalAllocationLimit =
+      static_cast<int64_t>(192) * MB;
+  // A full collection that buys less than this much time of headroom at the
+  // current external allocation rate is not worth running; the balance may
+  // instead grow towards the hard limit below.
+  static const double kMinExternalGCIntervalMs = 1000;
+  static const int kHardLimitFactor = 4;
+
+  int64_t delta = PromotedExternalMemorySize();
+  if (delta <= kExternalAllocationLimit) return;  // Lost a race with a GC.
+  if (delta < kHardLimitFactor * kExternalAllocationLimit) {
+    // Project how long the headroom restored by a collection would last,
+    // assuming the external allocation rate observed since the last full
+    // collection. If the limit would be hit again almost immediately, defer
+    // the collection and let the balance grow, analogous to how
+    // SetOldGenerationAllocationLimit trades memory for fewer collections
+    // when on-heap allocation is fast.
+    double ms_since_gc =
+        MonotonicallyIncreasingTimeInMs() - last_global_gc_time_ms_;
+    double projected_interval_ms =
+        ms_since_gc * static_cast<double>(kExternalAllocationLimit) /
+        static_cast<double>(delta);
+    if (projected_interval_ms < kMinExternalGCIntervalMs) return;
+  }
+  CollectAllGarbage(kNoGCFlags, gc_reason);
+}
+
+
 void Heap::EnsureFillerObjectAtTop() {
   // There may be an allocation memento behind every object in new space.
   // If we evacuate a not full new space or if we are on the last page of
@@ -932,6 +1000,12 @@ bool Heap::CollectGarbage(GarbageCollector collector, const char* gc_reason,
 
     if (collector == MARK_COMPACTOR) {
       gc_idle_time_handler_.NotifyMarkCompact();
+
+      MemoryReducer::Event event;
+      event.type = MemoryReducer::kMarkCompact;
+      event.time_ms = MonotonicallyIncreasingTimeInMs();
+      event.next_gc_likely_to_collect_more = next_gc_likely_to_collect_more;
+      memory_reducer_.NotifyMarkCompact(event);
     } else {
       gc_idle_time_handler_.NotifyScavenge();
     }
@@ -939,6 +1013,19 @@ bool Heap::CollectGarbage(GarbageCollector collector, const char* gc_reason,
     tracer()->Stop(collector);
   }
 
+  if (gc_statistics_callback_ != NULL) {
+    GCCallbacksScope scope(this);
+    if (scope.CheckReenter()) {
+      AllowHeapAllocation allow_allocation;
+      VMState<EXTERNAL> state(isolate_);
+      HandleScope handle_scope(isolate_);
+      v8::GCStatistics statistics;
+      tracer()->CopyStatistics(&statistics);
+      gc_statistics_callback_(reinterpret_cast<v8::Isolate*>(isolate()),
+                              statistics);
+    }
+  }
+
   if (collector == MARK_COMPACTOR &&
       (gc_callback_flags & kGCCallbackFlagForced) != 0) {
     isolate()->CountUsage(v8::Isolate::kForcedGC);
@@ -968,6 +1055,10 @@ int Heap::NotifyContextDisposed(bool dependant_context) {
   AgeInlineCaches();
   set_retained_maps(ArrayList::cast(empty_fixed_array()));
   tracer()->AddContextDisposalTime(base::OS::TimeCurrentMillis());
+  MemoryReducer::Event event;
+  event.type = MemoryReducer::kContextDisposed;
+  event.time_ms = MonotonicallyIncreasingTimeInMs();
+  memory_reducer_.NotifyContextDisposed(event);
   return ++contexts_disposed_;
 }
 
@@ -1239,6 +1330,7 @@ bool Heap::PerformGarbageCollection(
     // Register the amount of external allocated memory.
     amount_of_external_allocated_memory_at_last_global_gc_ =
         amount_of_external_allocated_memory_;
+    last_global_gc_time_ms_ = MonotonicallyIncreasingTimeInMs();
     SetOldGenerationAllocationLimit(PromotedSpaceSizeOfObjects(),
                                     freed_global_handles);
     // We finished a marking cycle. We can uncommit the marking deque until
@@ -1337,12 +1429,34 @@ void Heap::MarkCompactEpilogue() {
 }
 
 
+bool Heap::CodeAgeSpansAtLeast(int generations, int ms) {
+  if (generations <= 0) return false;
+  // Code cannot have aged more generations than mark-compact collections
+  // have run; clamp to what the ring buffer has actually recorded.
+  int recorded = Min(code_aging_epochs_, kCodeAgingEpochCount);
+  if (recorded == 0) return false;
+  int index = (code_aging_epochs_ - Min(generations, recorded)) %
+              kCodeAgingEpochCount;
+  return MonotonicallyIncreasingTimeInMs() - code_aging_epoch_times_[index] >=
+         static_cast<double>(ms);
+}
+
+
 void Heap::MarkCompactPrologue() {
+  // Record the start time of this collection so that code aged by it can
+  // later be mapped back to a wall-clock age, see CodeAgeSpansAtLeast.
+  code_aging_epoch_times_[code_aging_epochs_ % kCodeAgingEpochCount] =
+      MonotonicallyIncreasingTimeInMs();
+  code_aging_epochs_++;
+
   // At any old GC clear the keyed lookup cache to enable collection of unused
   // maps.
   isolate_->keyed_lookup_cache()->Clear();
   isolate_->context_slot_cache()->Clear();
   isolate_->descriptor_lookup_cache()->Clear();
+  isolate_->transition_lookup_cache()->Clear();
+  isolate_->scope_info_cache()->Clear();
+  isolate_->own_property_names_cache()->Clear();
   RegExpResultsCache::Clear(string_split_cache());
   RegExpResultsCache::Clear(regexp_multiple_cache());
 
@@ -1415,7 +1529,9 @@ static void VerifyNonPointerSpacePointers(Heap* heap) {
 
 
 void Heap::CheckNewSpaceExpansionCriteria() {
-  if (FLAG_experimental_new_space_growth_heuristic) {
+  if (FLAG_adaptive_new_space_sizing) {
+    AdaptNewSpaceCapacity();
+  } else if (FLAG_experimental_new_space_growth_heuristic) {
     if (new_space_.TotalCapacity() < new_space_.MaximumCapacity() &&
         survived_last_scavenge_ * 100 / new_space_.TotalCapacity() >= 10) {
       // Grow the size of new space if there is room to grow, and more than 10%
@@ -1433,6 +1549,55 @@ void Heap::CheckNewSpaceExpansionCriteria() {
 }
 
 
+void Heap::AdaptNewSpaceCapacity() {
+  // Thresholds for the online sizing: the new space grows when the mutator
+  // would refill it within {kBurstRefillTimeMs} or when more than
+  // {kHighSurvivalRatePercent} of it survived the last scavenge, and it
+  // shrinks again after {kLowLoadScavengesBeforeShrink} consecutive
+  // scavenges with slow refill and a low average survival rate.
+  static const double kBurstRefillTimeMs = 10;
+  static const double kLowLoadRefillTimeMs = 100;
+  static const int kLowLoadScavengesBeforeShrink = 4;
+  static const int kHighSurvivalRatePercent = 10;
+
+  intptr_t const throughput =
+      tracer()->NewSpaceAllocationThroughputInBytesPerMillisecond();
+  double const refill_time_ms =
+      throughput > 0
+          ? static_cast<double>(new_space_.TotalCapacity()) / throughput
+          : V8_INFINITY;
+  int const survival_percent = static_cast<int>(
+      survived_last_scavenge_ * 100 / new_space_.TotalCapacity());
+
+  if (new_space_.TotalCapacity() < new_space_.MaximumCapacity() &&
+      (survival_percent >= kHighSurvivalRatePercent ||
+       refill_time_ms < kBurstRefillTimeMs)) {
+    // High survival means the working set does not fit the semispaces; a
+    // fast refill means scavenges come too frequently. Either way, grow.
+    new_space_.Grow();
+    survived_since_last_expansion_ = 0;
+    low_load_scavenges_ = 0;
+    return;
+  }
+
+  double const average_survival_percent =
+      tracer()->SurvivalEventsRecorded() ? tracer()->AverageSurvivalRatio()
+                                         : 0.0;
+  if (refill_time_ms > kLowLoadRefillTimeMs &&
+      average_survival_percent < kHighSurvivalRatePercent) {
+    if (++low_load_scavenges_ >= kLowLoadScavengesBeforeShrink) {
+      // The load has dropped for several scavenges in a row; release
+      // semispace memory again. Shrink() keeps headroom above the current
+      // live size, so repeated shrinking converges gradually.
+      new_space_.Shrink();
+      low_load_scavenges_ = 0;
+    }
+  } else {
+    low_load_scavenges_ = 0;
+  }
+}
+
+
 static bool IsUnscavengedHeapObject(Heap* heap, Object** p) {
   return heap->InNewSpace(*p) &&
          !HeapObject::cast(*p)->map_word().IsForwardingAddress();
@@ -1570,8 +1735,11 @@ void Heap::Scavenge() {
   // Implements Cheney's copying algorithm
   LOG(isolate_, ResourceEvent("scavenge", "begin"));
 
-  // Clear descriptor cache.
+  // Clear descriptor, transition and scope info caches.
   isolate_->descriptor_lookup_cache()->Clear();
+  isolate_->transition_lookup_cache()->Clear();
+  isolate_->scope_info_cache()->Clear();
+  isolate_->own_property_names_cache()->Clear();
 
   // Used for updating survived_since_last_expansion_ at function end.
   intptr_t survived_watermark = PromotedSpaceSizeOfObjects();
@@ -1613,7 +1781,11 @@ void Heap::Scavenge() {
   {
     StoreBufferRebuildScope scope(this, store_buffer(),
                                   &ScavengeStoreBufferCallback);
-    store_buffer()->IteratePointersToNewSpace(&ScavengeObject);
+    if (UseParallelScavenge()) {
+      ParallelScavenge();
+    } else {
+      store_buffer()->IteratePointersToNewSpace(&ScavengeObject);
+    }
   }
 
   // Copy objects reachable from the encountered weak collections list.
@@ -1653,6 +1825,11 @@ void Heap::Scavenge() {
   ScavengeWeakObjectRetainer weak_object_retainer(this);
   ProcessYoungWeakReferences(&weak_object_retainer);
 
+  // Backing stores of new space buffers that were not discovered during
+  // scavenging belong to dead ArrayBuffers; old space buffers are not
+  // looked at until the next full GC.
+  FreeDeadArrayBuffers(true);
+
   DCHECK(new_space_front == new_space_.top());
 
   // Set age mark.
@@ -1754,46 +1931,141 @@ void Heap::ProcessNativeContexts(WeakObjectRetainer* retainer) {
 }
 
 
-void Heap::RegisterNewArrayBuffer(void* data, size_t length) {
+class FreeArrayBuffersTask : public v8::Task {
+ public:
+  FreeArrayBuffersTask(Heap* heap, std::map<void*, size_t>* buffers)
+      : heap_(heap) {
+    buffers_.swap(*buffers);
+  }
+
+  virtual ~FreeArrayBuffersTask() {}
+
+ private:
+  // v8::Task overrides.
+  void Run() override {
+    heap_->FreeArrayBuffers(buffers_);
+    heap_->pending_array_buffer_free_tasks_semaphore_.Signal();
+  }
+
+  Heap* heap_;
+  std::map<void*, size_t> buffers_;
+
+  DISALLOW_COPY_AND_ASSIGN(FreeArrayBuffersTask);
+};
+
+
+void Heap::RegisterNewArrayBuffer(bool in_new_space, void* data,
+                                  size_t length) {
   if (!data) return;
-  live_array_buffers_[data] = length;
+  if (in_new_space) {
+    live_array_buffers_for_scavenge_[data] = length;
+  } else {
+    live_array_buffers_[data] = length;
+  }
   reinterpret_cast<v8::Isolate*>(isolate_)
       ->AdjustAmountOfExternalAllocatedMemory(length);
 }
 
 
-void Heap::UnregisterArrayBuffer(void* data) {
+void Heap::UnregisterArrayBuffer(bool in_new_space, void* data) {
   if (!data) return;
-  DCHECK(live_array_buffers_.count(data) > 0);
-  live_array_buffers_.erase(data);
-  not_yet_discovered_array_buffers_.erase(data);
+  std::map<void*, size_t>* live_buffers =
+      in_new_space ? &live_array_buffers_for_scavenge_ : &live_array_buffers_;
+  std::map<void*, size_t>* not_yet_discovered_buffers =
+      in_new_space ? &not_yet_discovered_array_buffers_for_scavenge_
+                   : &not_yet_discovered_array_buffers_;
+  DCHECK(live_buffers->count(data) > 0);
+  live_buffers->erase(data);
+  not_yet_discovered_buffers->erase(data);
+}
+
+
+void Heap::RegisterLiveArrayBuffer(bool in_new_space, void* data) {
+  // ArrayBuffer might be in the middle of being constructed.
+  if (data == undefined_value()) return;
+  if (in_new_space) {
+    not_yet_discovered_array_buffers_for_scavenge_.erase(data);
+  } else {
+    not_yet_discovered_array_buffers_.erase(data);
+  }
+}
+
+
+void Heap::FreeDeadArrayBuffers(bool from_scavenge) {
+  size_t freed_memory = 0;
+  std::map<void*, size_t> dead_buffers;
+  for (auto buffer = not_yet_discovered_array_buffers_for_scavenge_.begin();
+       buffer != not_yet_discovered_array_buffers_for_scavenge_.end();
+       ++buffer) {
+    dead_buffers[buffer->first] = buffer->second;
+    freed_memory += buffer->second;
+    live_array_buffers_for_scavenge_.erase(buffer->first);
+  }
+
+  if (!from_scavenge) {
+    for (auto buffer = not_yet_discovered_array_buffers_.begin();
+         buffer != not_yet_discovered_array_buffers_.end(); ++buffer) {
+      dead_buffers[buffer->first] = buffer->second;
+      freed_memory += buffer->second;
+      live_array_buffers_.erase(buffer->first);
+    }
+  }
+
+  not_yet_discovered_array_buffers_for_scavenge_ =
+      live_array_buffers_for_scavenge_;
+  if (!from_scavenge) {
+    not_yet_discovered_array_buffers_ = live_array_buffers_;
+  }
+
+  // Don't use the API method here since this could trigger another GC.
+  amount_of_external_allocated_memory_ -= freed_memory;
+
+  if (dead_buffers.empty()) return;
+  if (FLAG_concurrent_array_buffer_freeing) {
+    pending_array_buffer_free_tasks_++;
+    V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        new FreeArrayBuffersTask(this, &dead_buffers),
+        v8::Platform::kShortRunningTask);
+  } else {
+    FreeArrayBuffers(dead_buffers);
+  }
 }
 
 
-void Heap::RegisterLiveArrayBuffer(void* data) {
-  not_yet_discovered_array_buffers_.erase(data);
+void Heap::PromoteArrayBuffer(Object* obj) {
+  JSArrayBuffer* buffer = JSArrayBuffer::cast(obj);
+  if (buffer->is_external()) return;
+  void* data = buffer->backing_store();
+  if (!data) return;
+  // ArrayBuffer might be in the middle of being constructed.
+  if (data == undefined_value()) return;
+  DCHECK(live_array_buffers_for_scavenge_.count(data) > 0);
+  live_array_buffers_[data] = live_array_buffers_for_scavenge_[data];
+  live_array_buffers_for_scavenge_.erase(data);
+  not_yet_discovered_array_buffers_for_scavenge_.erase(data);
 }
 
 
-void Heap::FreeDeadArrayBuffers() {
-  for (auto buffer = not_yet_discovered_array_buffers_.begin();
-       buffer != not_yet_discovered_array_buffers_.end(); ++buffer) {
+void Heap::FreeArrayBuffers(const std::map<void*, size_t>& buffers) {
+  for (auto buffer = buffers.begin(); buffer != buffers.end(); ++buffer) {
     isolate_->array_buffer_allocator()->Free(buffer->first, buffer->second);
-    // Don't use the API method here since this could trigger another GC.
-    amount_of_external_allocated_memory_ -= buffer->second;
-    live_array_buffers_.erase(buffer->first);
   }
-  not_yet_discovered_array_buffers_ = live_array_buffers_;
 }
 
 
 void Heap::TearDownArrayBuffers() {
-  for (auto buffer = live_array_buffers_.begin();
-       buffer != live_array_buffers_.end(); ++buffer) {
-    isolate_->array_buffer_allocator()->Free(buffer->first, buffer->second);
-  }
+  // The background free tasks call into the embedder's allocator; they must
+  // be done before the embedder may tear it down.
+  while (pending_array_buffer_free_tasks_ > 0) {
+    pending_array_buffer_free_tasks_semaphore_.Wait();
+    pending_array_buffer_free_tasks_--;
+  }
+  FreeArrayBuffers(live_array_buffers_);
+  FreeArrayBuffers(live_array_buffers_for_scavenge_);
   live_array_buffers_.clear();
+  live_array_buffers_for_scavenge_.clear();
   not_yet_discovered_array_buffers_.clear();
+  not_yet_discovered_array_buffers_for_scavenge_.clear();
 }
 
 
@@ -1957,6 +2229,324 @@ Address Heap::DoScavenge(ObjectVisitor* scavenge_visitor,
 }
 
 
+class ScavengeTask : public v8::Task {
+ public:
+  explicit ScavengeTask(Heap* heap) : heap_(heap) {}
+
+  virtual ~ScavengeTask() {}
+
+ private:
+  // v8::Task overrides.
+  void Run() override {
+    heap_->RunScavengeTask();
+    heap_->pending_scavenge_tasks_semaphore_.Signal();
+  }
+
+  Heap* heap_;
+
+  DISALLOW_COPY_AND_ASSIGN(ScavengeTask);
+};
+
+
+// Returns true if objects of the given map may be scavenged by a parallel
+// scavenge task. The visitors of the remaining types have side effects
+// that are not thread safe: code flushing candidate lists, weak lists and
+// the external string table.
+static bool CanScavengeInParallel(Map* map) {
+  InstanceType type = map->instance_type();
+  if (type < FIRST_NONSTRING_TYPE) {
+    return (type & kStringRepresentationMask) != kExternalStringTag;
+  }
+  switch (type) {
+    case HEAP_NUMBER_TYPE:
+    case BYTE_ARRAY_TYPE:
+    case FIXED_ARRAY_TYPE:
+    case FIXED_DOUBLE_ARRAY_TYPE:
+    case JS_OBJECT_TYPE:
+    case JS_ARRAY_TYPE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// Task-local scavenging state. Objects are copied into labs carved out of
+// to-space or into a task-local compaction space; the forwarding pointer is
+// installed with a compare-and-swap on the map word, so tasks can race for
+// the same object and exactly one of them wins.
+class ParallelScavenger : public ObjectVisitor {
+ public:
+  static const int kLabSize = 64 * KB;
+
+  explicit ParallelScavenger(Heap* heap)
+      : heap_(heap),
+        promotion_space_(heap, heap->MaxOldGenerationSize(), OLD_SPACE,
+                         NOT_EXECUTABLE),
+        lab_top_(NULL),
+        lab_limit_(NULL),
+        recording_slots_(false),
+        semispace_copied_size_(0),
+        promoted_size_(0),
+        local_pretenuring_feedback_(HashMap::PointersMatch,
+                                    Heap::kInitialFeedbackCapacity) {}
+
+  void VisitPointer(Object** p) { VisitPointers(p, p + 1); }
+
+  void VisitPointers(Object** start, Object** end) {
+    for (Object** p = start; p < end; p++) {
+      if ((*p)->IsHeapObject()) {
+        ProcessSlot(reinterpret_cast<HeapObject**>(p));
+      }
+    }
+  }
+
+  void RunTask() {
+    int num_slots = heap_->parallel_scavenge_slots_.length();
+    for (;;) {
+      int index = base::NoBarrier_AtomicIncrement(
+                      &heap_->next_parallel_scavenge_slot_, 1) -
+                  1;
+      if (index >= num_slots) break;
+      recording_slots_ = false;
+      ProcessSlot(reinterpret_cast<HeapObject**>(
+          heap_->parallel_scavenge_slots_[index]));
+      while (!local_stack_.is_empty()) {
+        HeapObject* target = local_stack_.RemoveLast();
+        // Slots in promoted objects that keep pointing to new space must
+        // end up in the store buffer.
+        recording_slots_ = !heap_->InNewSpace(target);
+        target->Iterate(this);
+      }
+    }
+  }
+
+  void Publish() {
+    FlushLab();
+    base::LockGuard<base::Mutex> guard(&heap_->parallel_scavenge_mutex_);
+    heap_->old_space()->MergeCompactionSpace(&promotion_space_);
+    heap_->IncrementSemiSpaceCopiedObjectSize(
+        static_cast<int>(semispace_copied_size_));
+    heap_->IncrementPromotedObjectsSize(static_cast<int>(promoted_size_));
+    for (int i = 0; i < store_slots_.length(); i++) {
+      heap_->store_buffer()->EnterDirectlyIntoStoreBuffer(store_slots_[i]);
+    }
+    heap_->parallel_scavenge_deferred_slots_.AddAll(deferred_slots_);
+    heap_->parallel_scavenge_deferred_record_slots_.AddAll(
+        deferred_record_slots_);
+    heap_->MergeAllocationSitePretenuringFeedback(&local_pretenuring_feedback_);
+  }
+
+ private:
+  void ProcessSlot(HeapObject** slot) {
+    HeapObject* object = *slot;
+    if (!heap_->InFromSpace(object)) return;
+    MapWord first_word = object->map_word();
+    if (first_word.IsForwardingAddress()) {
+      *slot = first_word.ToForwardingAddress();
+      MaybeRecordSlot(slot);
+      return;
+    }
+    Map* map = first_word.ToMap();
+    // Objects with thread-unsafe visitors are scavenged on the main thread.
+    if (!CanScavengeInParallel(map)) {
+      DeferSlot(slot);
+      return;
+    }
+    int size = object->SizeFromMap(map);
+    AllocationAlignment alignment = object->NeedsToEnsureDoubleAlignment()
+                                        ? kDoubleAligned
+                                        : kWordAligned;
+    HeapObject* target = NULL;
+    if (heap_->ShouldBePromoted(object->address(), size)) {
+      AllocationResult allocation =
+          promotion_space_.AllocateRaw(size, alignment);
+      allocation.To(&target);
+    }
+    if (target == NULL) target = AllocateInLab(size, alignment);
+    if (target == NULL) {
+      AllocationResult allocation =
+          promotion_space_.AllocateRaw(size, alignment);
+      if (!allocation.To(&target)) {
+        // Let the main thread deal with allocation failure.
+        DeferSlot(slot);
+        return;
+      }
+    }
+    heap_->CopyBlock(target->address(), object->address(), size);
+
+    // Race for the object by installing the forwarding pointer with a
+    // compare-and-swap on the map word.
+    MapWord forwarding = MapWord::FromForwardingAddress(target);
+    base::AtomicWord* map_slot =
+        reinterpret_cast<base::AtomicWord*>(object->address());
+    base::AtomicWord old_value =
+        static_cast<base::AtomicWord>(first_word.ToRawValue());
+    if (base::Release_CompareAndSwap(
+            map_slot, old_value,
+            static_cast<base::AtomicWord>(forwarding.ToRawValue())) ==
+        old_value) {
+      *slot = target;
+      MaybeRecordSlot(slot);
+      // Only the winner of the race records pretenuring feedback; the map
+      // word of the source object is a forwarding address by now, so the
+      // memento is located with the map saved above.
+      heap_->UpdateAllocationSite(map, object, &local_pretenuring_feedback_);
+      if (heap_->InNewSpace(target)) {
+        semispace_copied_size_ += size;
+      } else {
+        promoted_size_ += size;
+      }
+      local_stack_.Add(target);
+    } else {
+      // Another task copied the object first; release our copy and use the
+      // winner's forwarding address.
+      heap_->CreateFillerObjectAt(target->address(), size);
+      *slot = object->map_word().ToForwardingAddress();
+      MaybeRecordSlot(slot);
+    }
+  }
+
+  HeapObject* AllocateInLab(int size_in_bytes, AllocationAlignment alignment) {
+    int reserved = size_in_bytes;
+    if (alignment == kDoubleAligned) reserved += kPointerSize;
+    if (lab_top_ == NULL || lab_top_ + reserved > lab_limit_) {
+      if (!RefillLab(reserved)) return NULL;
+    }
+    HeapObject* object = HeapObject::FromAddress(lab_top_);
+    lab_top_ += reserved;
+    if (alignment == kDoubleAligned) {
+      object = heap_->EnsureAligned(object, reserved, alignment);
+    }
+    return object;
+  }
+
+  bool RefillLab(int min_size) {
+    FlushLab();
+    base::LockGuard<base::Mutex> guard(&heap_->parallel_scavenge_mutex_);
+    int lab_size = Max(min_size, kLabSize);
+    AllocationResult allocation =
+        heap_->new_space()->AllocateRaw(lab_size, kWordAligned);
+    HeapObject* lab = NULL;
+    if (!allocation.To(&lab)) return false;
+    // Make sure the lab does not overwrite the promotion queue which is at
+    // the end of to-space.
+    heap_->promotion_queue()->SetNewLimit(heap_->new_space()->top());
+    lab_top_ = lab->address();
+    lab_limit_ = lab_top_ + lab_size;
+    return true;
+  }
+
+  void FlushLab() {
+    // Fill the unused tail of the lab so that to-space stays iterable.
+    if (lab_top_ != NULL && lab_limit_ - lab_top_ > 0) {
+      heap_->CreateFillerObjectAt(lab_top_,
+                                  static_cast<int>(lab_limit_ - lab_top_));
+    }
+    lab_top_ = lab_limit_ = NULL;
+  }
+
+  void MaybeRecordSlot(HeapObject** slot) {
+    if (recording_slots_ && heap_->InNewSpace(*slot)) {
+      store_slots_.Add(reinterpret_cast<Address>(slot));
+    }
+  }
+
+  void DeferSlot(HeapObject** slot) {
+    if (recording_slots_) {
+      deferred_record_slots_.Add(reinterpret_cast<Address>(slot));
+    } else {
+      deferred_slots_.Add(reinterpret_cast<Address>(slot));
+    }
+  }
+
+  Heap* heap_;
+  CompactionSpace promotion_space_;
+  Address lab_top_;
+  Address lab_limit_;
+  bool recording_slots_;
+  intptr_t semispace_copied_size_;
+  intptr_t promoted_size_;
+  List<HeapObject*> local_stack_;
+  List<Address> store_slots_;
+  List<Address> deferred_slots_;
+  List<Address> deferred_record_slots_;
+  HashMap local_pretenuring_feedback_;
+
+  DISALLOW_COPY_AND_ASSIGN(ParallelScavenger);
+};
+
+
+static List<Address>* parallel_scavenge_slot_list = NULL;
+
+
+static void CollectSlotForParallelScavenge(HeapObject** slot,
+                                           HeapObject* object) {
+  parallel_scavenge_slot_list->Add(reinterpret_cast<Address>(slot));
+}
+
+
+bool Heap::UseParallelScavenge() {
+  // Incremental marking transfers mark bits when objects are copied, and
+  // the logging and profiling hooks observe object moves; neither is
+  // thread safe.
+  return FLAG_parallel_scavenge && FLAG_scavenge_tasks > 0 &&
+         !incremental_marking()->IsMarking() &&
+         !isolate()->logger()->is_logging() &&
+         !isolate()->cpu_profiler()->is_profiling() &&
+         !isolate()->heap_profiler()->is_tracking_object_moves() &&
+         !FLAG_verify_predictable;
+}
+
+
+void Heap::RunScavengeTask() {
+  ParallelScavenger scavenger(this);
+  scavenger.RunTask();
+  scavenger.Publish();
+}
+
+
+void Heap::ParallelScavenge() {
+  DCHECK(parallel_scavenge_slots_.is_empty());
+  parallel_scavenge_slot_list = &parallel_scavenge_slots_;
+  store_buffer()->IteratePointersToNewSpace(&CollectSlotForParallelScavenge);
+  parallel_scavenge_slot_list = NULL;
+
+  base::NoBarrier_Store(&next_parallel_scavenge_slot_, 0);
+  int num_tasks = FLAG_scavenge_tasks;
+  for (int i = 1; i < num_tasks; i++) {
+    V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        new ScavengeTask(this), v8::Platform::kShortRunningTask);
+  }
+  // The main thread processes slots as well.
+  RunScavengeTask();
+  for (int i = 1; i < num_tasks; i++) {
+    pending_scavenge_tasks_semaphore_.Wait();
+  }
+
+  // Scavenge the slots the tasks could not handle with the sequential
+  // machinery, and record the ones living in promoted objects.
+  for (int i = 0; i < parallel_scavenge_deferred_slots_.length(); i++) {
+    HeapObject** slot =
+        reinterpret_cast<HeapObject**>(parallel_scavenge_deferred_slots_[i]);
+    if (InFromSpace(*slot)) ScavengeObject(slot, *slot);
+  }
+  for (int i = 0; i < parallel_scavenge_deferred_record_slots_.length(); i++) {
+    HeapObject** slot = reinterpret_cast<HeapObject**>(
+        parallel_scavenge_deferred_record_slots_[i]);
+    if (InFromSpace(*slot)) ScavengeObject(slot, *slot);
+    if (InNewSpace(*slot)) {
+      store_buffer()->EnterDirectlyIntoStoreBuffer(
+          reinterpret_cast<Address>(slot));
+    }
+  }
+
+  parallel_scavenge_slots_.Rewind(0);
+  parallel_scavenge_deferred_slots_.Rewind(0);
+  parallel_scavenge_deferred_record_slots_.Rewind(0);
+}
+
+
 STATIC_ASSERT((FixedDoubleArray::kHeaderSize & kDoubleAlignmentMask) ==
               0);  // NOLINT
 STATIC_ASSERT((ConstantPoolArray::kFirstEntryOffset & kDoubleAlignmentMask) ==
@@ -2050,8 +2640,7 @@ class ScavengingVisitor : public StaticVisitorBase {
     table_.Register(kVisitJSWeakCollection,
                     &ObjectEvacuationStrategy<POINTER_OBJECT>::Visit);
 
-    table_.Register(kVisitJSArrayBuffer,
-                    &ObjectEvacuationStrategy<POINTER_OBJECT>::Visit);
+    table_.Register(kVisitJSArrayBuffer, &EvacuateJSArrayBuffer);
 
     table_.Register(kVisitJSTypedArray,
                     &ObjectEvacuationStrategy<POINTER_OBJECT>::Visit);
@@ -2230,6 +2819,23 @@ class ScavengingVisitor : public StaticVisitorBase {
   }
 
 
+  static inline void EvacuateJSArrayBuffer(Map* map, HeapObject** slot,
+                                           HeapObject* object) {
+    ObjectEvacuationStrategy<POINTER_OBJECT>::Visit(map, slot, object);
+
+    Heap* heap = map->GetHeap();
+    MapWord map_word = object->map_word();
+    DCHECK(map_word.IsForwardingAddress());
+    HeapObject* target = map_word.ToForwardingAddress();
+    JSArrayBuffer* buffer = JSArrayBuffer::cast(target);
+    if (buffer->is_external()) return;
+    if (heap->InNewSpace(target)) {
+      heap->RegisterLiveArrayBuffer(true, buffer->backing_store());
+    } else {
+      heap->PromoteArrayBuffer(buffer);
+    }
+  }
+
   static inline void EvacuateJSFunction(Map* map, HeapObject** slot,
                                         HeapObject* object) {
     ObjectEvacuationStrategy<POINTER_OBJECT>::template VisitSpecialized<
@@ -2967,6 +3573,13 @@ void Heap::CreateFixedStubs() {
 }
 
 
+// Note that although most objects created here are immutable, they cannot
+// be shared between isolates in one process: string hash fields depend on
+// the isolate's hash seed, builtin and stub code embeds isolate-specific
+// external references and the isolate address itself, and every isolate's
+// GC owns the mark bits in its pages' headers. A process-wide read-only
+// space would require isolate-independent code and a heap layout in which
+// collectors can skip foreign pages entirely.
 void Heap::CreateInitialObjects() {
   HandleScope scope(isolate());
   Factory* factory = isolate()->factory();
@@ -3152,10 +3765,6 @@ void Heap::CreateInitialObjects() {
 
   set_weak_stack_trace_list(Smi::FromInt(0));
 
-  set_allocation_sites_scratchpad(
-      *factory->NewFixedArray(kAllocationSiteScratchpadSize, TENURED));
-  InitializeAllocationSitesScratchpad();
-
   // Initialize keyed lookup cache.
   isolate_->keyed_lookup_cache()->Clear();
 
@@ -3165,6 +3774,15 @@ void Heap::CreateInitialObjects() {
   // Initialize descriptor cache.
   isolate_->descriptor_lookup_cache()->Clear();
 
+  // Initialize transition cache.
+  isolate_->transition_lookup_cache()->Clear();
+
+  // Initialize scope info cache.
+  isolate_->scope_info_cache()->Clear();
+
+  // Initialize own property names cache.
+  isolate_->own_property_names_cache()->Clear();
+
   // Initialize compilation cache.
   isolate_->compilation_cache()->Clear();
 }
@@ -3183,7 +3801,6 @@ bool Heap::RootCanBeWrittenAfterInitialization(Heap::RootListIndex root_index) {
     case kEmptyScriptRootIndex:
     case kSymbolRegistryRootIndex:
     case kMaterializedObjectsRootIndex:
-    case kAllocationSitesScratchpadRootIndex:
     case kMicrotaskQueueRootIndex:
     case kDetachedContextsRootIndex:
     case kWeakObjectToCodeTableRootIndex:
@@ -3302,12 +3919,24 @@ void RegExpResultsCache::Clear(FixedArray* cache) {
 
 
 int Heap::FullSizeNumberStringCacheLength() {
-  // Compute the size of the number string cache based on the max newspace size.
-  // The number string cache has a minimum size based on twice the initial cache
-  // size to ensure that it is bigger after being made 'full size'.
-  int number_string_cache_size = max_semi_space_size_ / 512;
-  number_string_cache_size = Max(kInitialNumberStringCacheSize * 2,
-                                 Min(0x4000, number_string_cache_size));
+  // Compute the size of the number string cache based on the max newspace
+  // size, unless --number_string_cache_size asks for a specific capacity;
+  // workloads that convert a large universe of numbers want a bigger cache
+  // than the heap size suggests. The number string cache has a minimum size
+  // based on twice the initial cache size to ensure that it is bigger after
+  // being made 'full size'.
+  int number_string_cache_size;
+  if (FLAG_number_string_cache_size > 0) {
+    int configured = Min(FLAG_number_string_cache_size, 1 << 20);
+    number_string_cache_size = static_cast<int>(
+        base::bits::RoundUpToPowerOfTwo32(static_cast<uint32_t>(configured)));
+    number_string_cache_size =
+        Max(kInitialNumberStringCacheSize * 2, number_string_cache_size);
+  } else {
+    number_string_cache_size = max_semi_space_size_ / 512;
+    number_string_cache_size = Max(kInitialNumberStringCacheSize * 2,
+                                   Min(0x4000, number_string_cache_size));
+  }
   // There is a string and a number per entry so the length is twice the number
   // of entries.
   return number_string_cache_size * 2;
@@ -3323,47 +3952,6 @@ void Heap::FlushNumberStringCache() {
 }
 
 
-void Heap::FlushAllocationSitesScratchpad() {
-  for (int i = 0; i < allocation_sites_scratchpad_length_; i++) {
-    allocation_sites_scratchpad()->set_undefined(i);
-  }
-  allocation_sites_scratchpad_length_ = 0;
-}
-
-
-void Heap::InitializeAllocationSitesScratchpad() {
-  DCHECK(allocation_sites_scratchpad()->length() ==
-         kAllocationSiteScratchpadSize);
-  for (int i = 0; i < kAllocationSiteScratchpadSize; i++) {
-    allocation_sites_scratchpad()->set_undefined(i);
-  }
-}
-
-
-void Heap::AddAllocationSiteToScratchpad(AllocationSite* site,
-                                         ScratchpadSlotMode mode) {
-  if (allocation_sites_scratchpad_length_ < kAllocationSiteScratchpadSize) {
-    // We cannot use the normal write-barrier because slots need to be
-    // recorded with non-incremental marking as well. We have to explicitly
-    // record the slot to take evacuation candidates into account.
-    allocation_sites_scratchpad()->set(allocation_sites_scratchpad_length_,
-                                       site, SKIP_WRITE_BARRIER);
-    Object** slot = allocation_sites_scratchpad()->RawFieldOfElementAt(
-        allocation_sites_scratchpad_length_);
-
-    if (mode == RECORD_SCRATCHPAD_SLOT) {
-      // We need to allow slots buffer overflow here since the evacuation
-      // candidates are not part of the global list of old space pages and
-      // releasing an evacuation candidate due to a slots buffer overflow
-      // results in lost pages.
-      mark_compact_collector()->RecordSlot(slot, slot, *slot,
-                                           SlotsBuffer::IGNORE_OVERFLOW);
-    }
-    allocation_sites_scratchpad_length_++;
-  }
-}
-
-
 Map* Heap::MapForExternalArrayType(ExternalArrayType array_type) {
   return Map::cast(roots_[RootIndexForExternalArrayType(array_type)]);
 }
@@ -3551,6 +4139,13 @@ FixedArrayBase* Heap::LeftTrimFixedArray(FixedArrayBase* object,
   const int len = object->length();
   DCHECK(elements_to_trim <= len);
 
+  // Trimming moves the object start and transfers mark bits without atomic
+  // operations; the concurrent marking task must not observe the
+  // intermediate state.
+  if (incremental_marking()->concurrent_marking_in_progress()) {
+    incremental_marking()->PauseConcurrentMarking();
+  }
+
   // Calculate location of new array start.
   Address new_start = object->address() + bytes_to_trim;
 
@@ -3614,6 +4209,12 @@ void Heap::RightTrimFixedArray(FixedArrayBase* object, int elements_to_trim) {
     return;
   }
 
+  // Trimming shrinks the object in place; the concurrent marking task must
+  // not scan the array with its old length.
+  if (incremental_marking()->concurrent_marking_in_progress()) {
+    incremental_marking()->PauseConcurrentMarking();
+  }
+
   // Calculate location of new array end.
   Address new_end = object->address() + object->Size() - bytes_to_trim;
 
@@ -3774,6 +4375,9 @@ AllocationResult Heap::CopyCode(Code* code) {
   DCHECK(isolate_->code_range() == NULL || !isolate_->code_range()->valid() ||
          isolate_->code_range()->contains(code->address()));
   new_code->Relocate(new_addr - old_addr);
+  // If the copy was allocated black, push it back on the marking deque so
+  // that the embedded pointers copied above get visited.
+  incremental_marking()->RecordWrites(new_code);
   return new_code;
 }
 
@@ -3833,6 +4437,9 @@ AllocationResult Heap::CopyCode(Code* code, Vector<byte> reloc_info) {
   DCHECK(isolate_->code_range() == NULL || !isolate_->code_range()->valid() ||
          isolate_->code_range()->contains(code->address()));
   new_code->Relocate(new_addr - old_addr);
+  // If the copy was allocated black, push it back on the marking deque so
+  // that the embedded pointers copied above get visited.
+  incremental_marking()->RecordWrites(new_code);
 
 #ifdef VERIFY_HEAP
   if (FLAG_verify_heap) code->ObjectVerify();
@@ -3981,12 +4588,18 @@ AllocationResult Heap::CopyJSObject(JSObject* source, AllocationSite* site) {
 
   WriteBarrierMode wb_mode = UPDATE_WRITE_BARRIER;
 
+  // Once the site has decided that the clones it tracks should be tenured,
+  // allocate the clone directly in old space; its feedback memento is then
+  // no longer needed.
+  PretenureFlag pretenure =
+      site != NULL ? site->GetPretenureMode() : NOT_TENURED;
+
   // If we're forced to always allocate, we use the general allocation
   // functions which may leave us with an object in old space.
-  if (always_allocate()) {
+  if (always_allocate() || pretenure == TENURED) {
     {
-      AllocationResult allocation =
-          AllocateRaw(object_size, NEW_SPACE, OLD_SPACE);
+      AllocationSpace space = pretenure == TENURED ? OLD_SPACE : NEW_SPACE;
+      AllocationResult allocation = AllocateRaw(object_size, space, OLD_SPACE);
       if (!allocation.To(&clone)) return allocation;
     }
     Address clone_address = clone->address();
@@ -4052,9 +4665,10 @@ AllocationResult Heap::CopyJSObject(JSObject* source, AllocationSite* site) {
       if (elements->map() == fixed_cow_array_map()) {
         allocation = FixedArray::cast(elements);
       } else if (source->HasFastDoubleElements()) {
-        allocation = CopyFixedDoubleArray(FixedDoubleArray::cast(elements));
+        allocation = CopyFixedDoubleArray(FixedDoubleArray::cast(elements),
+                                          pretenure);
       } else {
-        allocation = CopyFixedArray(FixedArray::cast(elements));
+        allocation = CopyFixedArray(FixedArray::cast(elements), pretenure);
       }
       if (!allocation.To(&elem)) return allocation;
     }
@@ -4064,7 +4678,7 @@ AllocationResult Heap::CopyJSObject(JSObject* source, AllocationSite* site) {
   if (properties->length() > 0) {
     FixedArray* prop;
     {
-      AllocationResult allocation = CopyFixedArray(properties);
+      AllocationResult allocation = CopyFixedArray(properties, pretenure);
       if (!allocation.To(&prop)) return allocation;
     }
     JSObject::cast(clone)->set_properties(prop, wb_mode);
@@ -4275,11 +4889,12 @@ AllocationResult Heap::AllocateEmptyFixedTypedArray(
 }
 
 
-AllocationResult Heap::CopyFixedArrayWithMap(FixedArray* src, Map* map) {
+AllocationResult Heap::CopyFixedArrayWithMap(FixedArray* src, Map* map,
+                                             PretenureFlag pretenure) {
   int len = src->length();
   HeapObject* obj;
   {
-    AllocationResult allocation = AllocateRawFixedArray(len, NOT_TENURED);
+    AllocationResult allocation = AllocateRawFixedArray(len, pretenure);
     if (!allocation.To(&obj)) return allocation;
   }
   if (InNewSpace(obj)) {
@@ -4301,17 +4916,21 @@ AllocationResult Heap::CopyFixedArrayWithMap(FixedArray* src, Map* map) {
 
 
 AllocationResult Heap::CopyFixedDoubleArrayWithMap(FixedDoubleArray* src,
-                                                   Map* map) {
+                                                   Map* map,
+                                                   PretenureFlag pretenure) {
   int len = src->length();
   HeapObject* obj;
   {
-    AllocationResult allocation = AllocateRawFixedDoubleArray(len, NOT_TENURED);
+    AllocationResult allocation = AllocateRawFixedDoubleArray(len, pretenure);
     if (!allocation.To(&obj)) return allocation;
   }
   obj->set_map_no_write_barrier(map);
   CopyBlock(obj->address() + FixedDoubleArray::kLengthOffset,
             src->address() + FixedDoubleArray::kLengthOffset,
             FixedDoubleArray::SizeFor(len) - FixedDoubleArray::kLengthOffset);
+  // If the copy was allocated black, push it back on the marking deque so
+  // that the map slot written above gets visited.
+  incremental_marking()->RecordWrites(obj);
   return obj;
 }
 
@@ -4337,6 +4956,9 @@ AllocationResult Heap::CopyConstantPoolArrayWithMap(ConstantPoolArray* src,
   CopyBlock(obj->address() + ConstantPoolArray::kFirstEntryOffset,
             src->address() + ConstantPoolArray::kFirstEntryOffset,
             src->size() - ConstantPoolArray::kFirstEntryOffset);
+  // If the copy was allocated black, push it back on the marking deque so
+  // that the pointer entries copied above get visited.
+  incremental_marking()->RecordWrites(obj);
   return obj;
 }
 
@@ -5537,6 +6159,8 @@ void Heap::TearDown() {
     PrintAlloctionsHash();
   }
 
+  memory_reducer_.TearDown();
+
   TearDownArrayBuffers();
 
   isolate_->global_handles()->TearDown();
@@ -6248,6 +6872,79 @@ void DescriptorLookupCache::Clear() {
 }
 
 
+void TransitionLookupCache::Clear() {
+  for (int index = 0; index < kLength; index++) keys_[index].source = NULL;
+}
+
+
+ScopeInfo* ScopeInfoCache::GetCanonical(ScopeInfo* candidate) {
+  int length = candidate->length();
+  // Equal contents imply equal pointers for everything a shareable ScopeInfo
+  // holds (internalized strings and smis), so the contents can be hashed and
+  // compared word by word.
+  uint32_t hash = static_cast<uint32_t>(length);
+  for (int i = 0; i < length; i++) {
+    uint32_t word = static_cast<uint32_t>(
+        reinterpret_cast<uintptr_t>(candidate->get(i)) >> kPointerSizeLog2);
+    hash = (hash ^ word) * 0x9E3779B9u;
+  }
+  int index = static_cast<int>(hash >> (32 - kLengthBits));
+  ScopeInfo* entry = entries_[index];
+  if (entry != NULL && entry->length() == length) {
+    bool equal = true;
+    for (int i = 0; i < length; i++) {
+      if (entry->get(i) != candidate->get(i)) {
+        equal = false;
+        break;
+      }
+    }
+    if (equal) return entry;
+  }
+  entries_[index] = candidate;
+  return candidate;
+}
+
+
+void ScopeInfoCache::Clear() {
+  for (int index = 0; index < kLength; index++) entries_[index] = NULL;
+}
+
+
+FixedArray* OwnPropertyNamesCache::Lookup(Map* source, int filter) {
+  int index = Hash(source, filter);
+  Key& key = keys_[index];
+  if (key.source == source && key.filter == filter) return results_[index];
+  return NULL;
+}
+
+
+void OwnPropertyNamesCache::Update(Map* source, int filter,
+                                   FixedArray* names) {
+  int index = Hash(source, filter);
+  keys_[index].source = source;
+  keys_[index].filter = filter;
+  results_[index] = names;
+}
+
+
+void OwnPropertyNamesCache::Clear() {
+  for (int index = 0; index < kLength; index++) keys_[index].source = NULL;
+}
+
+
+int OwnPropertyNamesCache::Hash(Map* source, int filter) {
+  // Heap objects are allocated at consecutive, aligned addresses, so only
+  // the low pointer bits vary. Mix in the filter with a golden-ratio
+  // multiply and index with the upper product bits, which depend on all of
+  // the input bits.
+  uint32_t source_hash =
+      static_cast<uint32_t>(reinterpret_cast<uintptr_t>(source)) >>
+      kPointerSizeLog2;
+  uint32_t hash = (source_hash ^ static_cast<uint32_t>(filter)) * 0x9E3779B9u;
+  return static_cast<int>(hash >> (32 - kLengthBits));
+}
+
+
 void ExternalStringTable::CleanUp() {
   int last = 0;
   for (int i = 0; i < new_space_strings_.length(); ++i) {
@@ -6366,6 +7063,7 @@ void Heap::RememberUnmappedPage(Address page, bool compacted) {
 void Heap::ClearObjectStats(bool clear_last_time_stats) {
   memset(object_counts_, 0, sizeof(object_counts_));
   memset(object_sizes_, 0, sizeof(object_sizes_));
+  memset(map_stats_, 0, sizeof(map_stats_));
   if (clear_last_time_stats) {
     memset(object_counts_last_time_, 0, sizeof(object_counts_last_time_));
     memset(object_sizes_last_time_, 0, sizeof(object_sizes_last_time_));
@@ -6419,6 +7117,29 @@ void Heap::TraceObjectStats() {
   TraceObjectStat("*CODE_AGE_" #name, count, size, time);
   CODE_AGE_LIST_COMPLETE(TRACE_OBJECT_COUNT)
 #undef TRACE_OBJECT_COUNT
+  TraceTopMaps();
+}
+
+
+void Heap::TraceTopMaps() {
+  static const int kTopMapsToTrace = 8;
+  double time = isolate_->time_millis_since_init();
+  for (int rank = 0; rank < kTopMapsToTrace; rank++) {
+    MapStatsEntry* best = NULL;
+    for (int i = 0; i < kMapStatsTableSize; i++) {
+      MapStatsEntry* entry = &map_stats_[i];
+      if (entry->count > 0 && (best == NULL || entry->count > best->count)) {
+        best = entry;
+      }
+    }
+    if (best == NULL) break;
+    EmbeddedVector<char, 64> name;
+    SNPrintF(name, "*MAP_%p_TYPE_%d", static_cast<void*>(best->map),
+             best->map->instance_type());
+    TraceObjectStat(name.start(), static_cast<int>(best->count),
+                    static_cast<int>(best->size) / KB, time);
+    best->count = 0;  // Only report each map once.
+  }
 }
 
 
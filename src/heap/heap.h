@@ -12,10 +12,12 @@
 #include "src/assert-scope.h"
 #include "src/counters.h"
 #include "src/globals.h"
+#include "src/hashmap.h"
 #include "src/heap/gc-idle-time-handler.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/incremental-marking.h"
 #include "src/heap/mark-compact.h"
+#include "src/heap/memory-reducer.h"
 #include "src/heap/objects-visiting.h"
 #include "src/heap/spaces.h"
 #include "src/heap/store-buffer.h"
@@ -184,7 +186,6 @@ namespace internal {
   V(SeededNumberDictionary, empty_slow_element_dictionary,                     \
     EmptySlowElementDictionary)                                                \
   V(FixedArray, materialized_objects, MaterializedObjects)                     \
-  V(FixedArray, allocation_sites_scratchpad, AllocationSitesScratchpad)        \
   V(FixedArray, microtask_queue, MicrotaskQueue)                               \
   V(FixedArray, keyed_load_dummy_vector, KeyedLoadDummyVector)                 \
   V(FixedArray, detached_contexts, DetachedContexts)                           \
@@ -263,6 +264,7 @@ namespace internal {
   V(undefined_string, "undefined")                             \
   V(value_of_string, "valueOf")                                \
   V(stack_string, "stack")                                     \
+  V(stack_trace_limit_string, "stackTraceLimit")               \
   V(toJSON_string, "toJSON")                                   \
   V(KeyedLoadMonomorphic_string, "KeyedLoadMonomorphic")       \
   V(KeyedStoreMonomorphic_string, "KeyedStoreMonomorphic")     \
@@ -814,6 +816,14 @@ class Heap {
   // Last hope GC, should try to squeeze as much as possible.
   void CollectAllAvailableGarbage(const char* gc_reason = NULL);
 
+  // Invoked when the external memory registered through the API grows past
+  // its allocation limit. Collects garbage unless the external allocation
+  // rate since the last full collection is so high that collecting would
+  // just trigger again immediately; in that case the balance is allowed to
+  // grow towards a hard limit first, so that a steady stream of external
+  // allocations does not cause back-to-back full collections.
+  void ReportExternalMemoryPressure(const char* gc_reason);
+
   // Check whether the heap is currently iterable.
   bool IsHeapIterable();
 
@@ -844,6 +854,48 @@ class Heap {
                              GCType gc_type_filter, bool pass_isolate = true);
   void RemoveGCEpilogueCallback(v8::Isolate::GCEpilogueCallback callback);
 
+  void set_gc_statistics_callback(
+      v8::Isolate::GCStatisticsCallback callback) {
+    gc_statistics_callback_ = callback;
+  }
+
+  // Code retention policy (see v8::Isolate::SetCodeRetentionPolicy). The
+  // default values impose no constraints beyond the regular aging check.
+  void set_code_retention_policy(int minimum_age_in_ms,
+                                 int hot_function_tick_threshold,
+                                 size_t flush_budget_per_gc) {
+    code_retention_minimum_age_in_ms_ = minimum_age_in_ms;
+    code_retention_hot_tick_threshold_ = hot_function_tick_threshold;
+    code_flush_budget_per_gc_ = flush_budget_per_gc;
+  }
+  int code_retention_minimum_age_in_ms() {
+    return code_retention_minimum_age_in_ms_;
+  }
+  int code_retention_hot_tick_threshold() {
+    return code_retention_hot_tick_threshold_;
+  }
+  size_t code_flush_budget_per_gc() { return code_flush_budget_per_gc_; }
+
+  // Returns true if the given number of code age generations spans at
+  // least |ms| milliseconds of wall-clock time, judged from the start
+  // times of the mark-compact collections that aged the code.
+  bool CodeAgeSpansAtLeast(int generations, int ms);
+
+  // Statistics about code flushing and the lazy recompilation it caused,
+  // exposed through v8::Isolate::GetCodeFlushingStatistics.
+  void IncrementFlushedCodeStatistics(int code_size) {
+    flushed_function_count_++;
+    flushed_code_size_ += code_size;
+  }
+  void IncrementRecompiledCodeStatistics(int code_size) {
+    recompiled_function_count_++;
+    recompiled_code_size_ += code_size;
+  }
+  size_t flushed_function_count() { return flushed_function_count_; }
+  size_t flushed_code_size() { return flushed_code_size_; }
+  size_t recompiled_function_count() { return recompiled_function_count_; }
+  size_t recompiled_code_size() { return recompiled_code_size_; }
+
 // Heap root getters.  We have versions with and without type::cast() here.
 // You can't use type::cast during GC because the assert fails.
 // TODO(1490): Try removing the unchecked accessors, now that GC marking does
@@ -1059,17 +1111,26 @@ class Heap {
   static inline void ScavengePointer(HeapObject** p);
   static inline void ScavengeObject(HeapObject** p, HeapObject* object);
 
-  enum ScratchpadSlotMode { IGNORE_SCRATCHPAD_SLOT, RECORD_SCRATCHPAD_SLOT };
-
   // If an object has an AllocationMemento trailing it, return it, otherwise
-  // return NULL;
-  inline AllocationMemento* FindAllocationMemento(HeapObject* object);
-
-  // An object may have an AllocationSite associated with it through a trailing
-  // AllocationMemento. Its feedback should be updated when objects are found
-  // in the heap.
-  static inline void UpdateAllocationSiteFeedback(HeapObject* object,
-                                                  ScratchpadSlotMode mode);
+  // return NULL.  The map of the object is passed in explicitly because a
+  // parallel scavenge task may have overwritten the map word of the object
+  // with a forwarding address by the time the memento is looked for.
+  inline AllocationMemento* FindAllocationMemento(Map* map,
+                                                  HeapObject* object);
+
+  // An object may have an AllocationSite associated with it through a
+  // trailing AllocationMemento.  Its feedback is either accumulated directly
+  // on the site (when updating global_pretenuring_feedback_) or in a
+  // task-local feedback map that a scavenge task later merges with
+  // MergeAllocationSitePretenuringFeedback.
+  inline void UpdateAllocationSite(Map* map, HeapObject* object,
+                                   HashMap* pretenuring_feedback);
+
+  // Merges the local pretenuring feedback of a finished scavenge task into
+  // the global pretenuring storage.  The caller must hold the parallel
+  // scavenge lock or run on the main thread.
+  void MergeAllocationSitePretenuringFeedback(
+      HashMap* local_pretenuring_feedback);
 
   // Support for partial snapshots.  After calling this we have a linear
   // space to write objects in each space.
@@ -1239,6 +1300,10 @@ class Heap {
   // Check new space expansion criteria and expand semispaces if it was hit.
   void CheckNewSpaceExpansionCriteria();
 
+  // Adjust the new space capacity online based on the survival rate and the
+  // allocation throughput recorded by the GC tracer.
+  void AdaptNewSpaceCapacity();
+
   inline void IncrementPromotedObjectsSize(int object_size) {
     DCHECK(object_size > 0);
     promoted_objects_size_ += object_size;
@@ -1462,8 +1527,24 @@ class Heap {
     object_sizes_[FIRST_FIXED_ARRAY_SUB_TYPE + array_sub_type] += size;
   }
 
+  void RecordMapStats(Map* map, size_t size) {
+    uintptr_t hash = reinterpret_cast<uintptr_t>(map) >> kPointerSizeLog2;
+    MapStatsEntry& entry = map_stats_[hash & (kMapStatsTableSize - 1)];
+    if (entry.map == map) {
+      entry.count++;
+      entry.size += size;
+    } else if (entry.count == 0) {
+      entry.map = map;
+      entry.count = 1;
+      entry.size = size;
+    } else {
+      entry.count--;
+    }
+  }
+
   void TraceObjectStats();
   void TraceObjectStat(const char* name, int count, int size, double time);
+  void TraceTopMaps();
   void CheckpointObjectStats();
   bool GetObjectTypeName(size_t index, const char** object_type,
                          const char** object_sub_type);
@@ -1526,10 +1607,24 @@ class Heap {
 
   bool deserialization_complete() const { return deserialization_complete_; }
 
-  void RegisterNewArrayBuffer(void* data, size_t length);
-  void UnregisterArrayBuffer(void* data);
-  void RegisterLiveArrayBuffer(void* data);
-  void FreeDeadArrayBuffers();
+  // ArrayBuffer backing stores are tracked in two sets of maps keyed by the
+  // space of the owning JSArrayBuffer, so that a scavenge only has to look
+  // at the buffers owned by new space objects.
+  void RegisterNewArrayBuffer(bool in_new_space, void* data, size_t length);
+  void UnregisterArrayBuffer(bool in_new_space, void* data);
+
+  // A live ArrayBuffer was discovered during marking or scavenging.
+  void RegisterLiveArrayBuffer(bool in_new_space, void* data);
+
+  // Frees all backing stores that have not been discovered since the last
+  // GC. A scavenge only considers buffers owned by new space objects. The
+  // calls into the embedder's allocator happen on a background thread
+  // unless --noconcurrent_array_buffer_freeing is given.
+  void FreeDeadArrayBuffers(bool from_scavenge);
+
+  // Move the backing store registration of a JSArrayBuffer that was promoted
+  // to old space out of the scavenge maps.
+  void PromoteArrayBuffer(Object* buffer);
 
  protected:
   // Methods made available to tests.
@@ -1590,6 +1685,11 @@ class Heap {
   // Caches the amount of external memory registered at the last global gc.
   int64_t amount_of_external_allocated_memory_at_last_global_gc_;
 
+  // Time of the last full collection, used to estimate the external
+  // allocation rate in ReportExternalMemoryPressure. Zero until the first
+  // full collection.
+  double last_global_gc_time_ms_;
+
   // This can be calculated directly from a pointer to the heap; however, it is
   // more expedient to get at the isolate directly from within Heap methods.
   Isolate* isolate_;
@@ -1614,6 +1714,10 @@ class Heap {
   // ... and since the last scavenge.
   int survived_last_scavenge_;
 
+  // Number of consecutive scavenges with low allocation throughput and low
+  // survival, used to decide when to shrink the new space again.
+  int low_load_scavenges_;
+
   // For keeping track on when to flush RegExp code.
   int sweep_generation_;
 
@@ -1641,6 +1745,10 @@ class Heap {
   // How many "runtime allocations" happened.
   uint32_t allocations_count_;
 
+  // Bytes left until the next sampled allocation event; see
+  // --sample-allocation-interval-kb.
+  intptr_t allocation_sample_countdown_;
+
   // Running hash over allocations performed.
   uint32_t raw_allocations_hash_;
 
@@ -1767,6 +1875,29 @@ class Heap {
   };
   List<GCEpilogueCallbackPair> gc_epilogue_callbacks_;
 
+  // Invoked after each GC with structured statistics about it; NULL when the
+  // embedder did not install one.
+  v8::Isolate::GCStatisticsCallback gc_statistics_callback_;
+
+  // Embedder-configurable code retention policy, see
+  // v8::Isolate::SetCodeRetentionPolicy for the semantics of each value.
+  int code_retention_minimum_age_in_ms_;
+  int code_retention_hot_tick_threshold_;
+  size_t code_flush_budget_per_gc_;
+
+  // Cumulative code flushing statistics.
+  size_t flushed_function_count_;
+  size_t flushed_code_size_;
+  size_t recompiled_function_count_;
+  size_t recompiled_code_size_;
+
+  // Ring buffer with the start times of recent mark-compact collections,
+  // used to translate the generation-based age of a code object into
+  // elapsed wall-clock time. Recorded in MarkCompactPrologue.
+  static const int kCodeAgingEpochCount = 8;
+  double code_aging_epoch_times_[kCodeAgingEpochCount];
+  int code_aging_epochs_;
+
   // Support for computing object sizes during GC.
   HeapObjectCallback gc_safe_size_of_old_object_;
   static int GcSafeSizeOfOldObject(HeapObject* object);
@@ -1907,17 +2038,18 @@ class Heap {
 
   // Make a copy of src and return it. Returns
   // Failure::RetryAfterGC(requested_bytes, space) if the allocation failed.
-  MUST_USE_RESULT inline AllocationResult CopyFixedArray(FixedArray* src);
+  MUST_USE_RESULT inline AllocationResult CopyFixedArray(
+      FixedArray* src, PretenureFlag pretenure = NOT_TENURED);
 
   // Make a copy of src, set the map, and return the copy. Returns
   // Failure::RetryAfterGC(requested_bytes, space) if the allocation failed.
-  MUST_USE_RESULT AllocationResult
-      CopyFixedArrayWithMap(FixedArray* src, Map* map);
+  MUST_USE_RESULT AllocationResult CopyFixedArrayWithMap(
+      FixedArray* src, Map* map, PretenureFlag pretenure = NOT_TENURED);
 
   // Make a copy of src and return it. Returns
   // Failure::RetryAfterGC(requested_bytes, space) if the allocation failed.
   MUST_USE_RESULT inline AllocationResult CopyFixedDoubleArray(
-      FixedDoubleArray* src);
+      FixedDoubleArray* src, PretenureFlag pretenure = NOT_TENURED);
 
   // Make a copy of src and return it. Returns
   // Failure::RetryAfterGC(requested_bytes, space) if the allocation failed.
@@ -1958,8 +2090,8 @@ class Heap {
   MUST_USE_RESULT AllocationResult CopyAndTenureFixedCOWArray(FixedArray* src);
 
   // Make a copy of src, set the map, and return the copy.
-  MUST_USE_RESULT AllocationResult
-      CopyFixedDoubleArrayWithMap(FixedDoubleArray* src, Map* map);
+  MUST_USE_RESULT AllocationResult CopyFixedDoubleArrayWithMap(
+      FixedDoubleArray* src, Map* map, PretenureFlag pretenure = NOT_TENURED);
 
   // Allocates a fixed double array with uninitialized values. Returns
   MUST_USE_RESULT AllocationResult AllocateUninitializedFixedDoubleArray(
@@ -2046,9 +2178,15 @@ class Heap {
   // the old space.
   void EvaluateOldSpaceLocalPretenuring(uint64_t size_of_objects_before_gc);
 
-  // Called on heap tear-down.
+  // Called on heap tear-down. Waits for pending background free tasks
+  // before returning the remaining backing stores to the embedder.
   void TearDownArrayBuffers();
 
+  // Calls the embedder's allocator to free the given backing stores. Runs
+  // either on a background thread or, if background freeing is disabled,
+  // on the main thread inside the pause.
+  void FreeArrayBuffers(const std::map<void*, size_t>& buffers);
+
   // Record statistics before and after garbage collection.
   void ReportStatisticsBeforeGC();
   void ReportStatisticsAfterGC();
@@ -2056,6 +2194,18 @@ class Heap {
   // Slow part of scavenge object.
   static void ScavengeObjectSlow(HeapObject** p, HeapObject* object);
 
+  // Returns true if the old-to-new pointers recorded in the store buffer
+  // should be processed by parallel scavenge tasks.
+  bool UseParallelScavenge();
+
+  // Processes the store buffer with parallel scavenge tasks. Objects whose
+  // scavenging has side effects that are not thread safe are deferred to
+  // the main thread, which handles them with the sequential machinery.
+  void ParallelScavenge();
+
+  // Worker loop shared by the main thread and background scavenge tasks.
+  void RunScavengeTask();
+
   // Total RegExp code ever generated
   double total_regexp_code_generated_;
 
@@ -2068,16 +2218,6 @@ class Heap {
   // Flush the number to string cache.
   void FlushNumberStringCache();
 
-  // Sets used allocation sites entries to undefined.
-  void FlushAllocationSitesScratchpad();
-
-  // Initializes the allocation sites scratchpad with undefined values.
-  void InitializeAllocationSitesScratchpad();
-
-  // Adds an allocation site to the scratchpad if there is space left.
-  void AddAllocationSiteToScratchpad(AllocationSite* site,
-                                     ScratchpadSlotMode mode);
-
   void UpdateSurvivalStatistics(int start_new_space_size);
 
   static const int kYoungSurvivalRateHighThreshold = 90;
@@ -2126,6 +2266,18 @@ class Heap {
   size_t object_sizes_[OBJECT_STATS_COUNT];
   size_t object_sizes_last_time_[OBJECT_STATS_COUNT];
 
+  // Per-map counts and used memory, tracked approximately while marking.
+  // The table is direct-mapped on the map pointer; on a collision the
+  // resident entry's count is decremented and the slot is taken over once
+  // it reaches zero, so frequent maps survive infrequent colliding ones.
+  struct MapStatsEntry {
+    Map* map;
+    size_t count;
+    size_t size;
+  };
+  static const int kMapStatsTableSize = 1024;  // Must be a power of two.
+  MapStatsEntry map_stats_[kMapStatsTableSize];
+
   // Maximum GC pause.
   double max_gc_pause_;
 
@@ -2157,6 +2309,8 @@ class Heap {
 
   GCIdleTimeHandler gc_idle_time_handler_;
 
+  MemoryReducer memory_reducer_;
+
   unsigned int gc_count_at_last_idle_gc_;
 
   // These two counters are monotomically increasing and never reset.
@@ -2168,8 +2322,11 @@ class Heap {
   // deoptimization triggered by garbage collection.
   int gcs_since_last_deopt_;
 
-  static const int kAllocationSiteScratchpadSize = 256;
-  int allocation_sites_scratchpad_length_;
+  // Holds the allocation sites that accumulated memento feedback since the
+  // last garbage collection; ProcessPretenuringFeedback digests and clears
+  // it.  Keys are the site addresses, values are unused.
+  static const int kInitialFeedbackCapacity = 256;
+  HashMap global_pretenuring_feedback_;
 
   static const int kMaxMarkCompactsInIdleRound = 7;
   static const int kIdleScavengeThreshold = 5;
@@ -2177,6 +2334,22 @@ class Heap {
   // Shared state read by the scavenge collector and set by ScavengeObject.
   PromotionQueue promotion_queue_;
 
+  base::Semaphore pending_scavenge_tasks_semaphore_;
+
+  // Guards new-space lab carving and publishing of scavenge task results.
+  base::Mutex parallel_scavenge_mutex_;
+
+  // Old-to-new slots collected from the store buffer for parallel
+  // processing, and the index of the next slot to be claimed by a task.
+  List<Address> parallel_scavenge_slots_;
+  base::Atomic32 next_parallel_scavenge_slot_;
+
+  // Slots deferred to the main thread by parallel scavenge tasks. Slots in
+  // the second list belong to promoted objects and must be entered into the
+  // store buffer if they still point to new space after scavenging.
+  List<Address> parallel_scavenge_deferred_slots_;
+  List<Address> parallel_scavenge_deferred_record_slots_;
+
   // Flag is set when the heap has been configured.  The heap can be repeatedly
   // configured through the API until it is set up.
   bool configured_;
@@ -2198,6 +2371,16 @@ class Heap {
   std::map<void*, size_t> live_array_buffers_;
   std::map<void*, size_t> not_yet_discovered_array_buffers_;
 
+  // Backing stores of ArrayBuffers owned by new space objects. Keeping them
+  // in separate maps lets a scavenge ignore old space buffers entirely.
+  std::map<void*, size_t> live_array_buffers_for_scavenge_;
+  std::map<void*, size_t> not_yet_discovered_array_buffers_for_scavenge_;
+
+  // The number of background array buffer free tasks that have been posted
+  // but have not signalled their semaphore yet.
+  int pending_array_buffer_free_tasks_;
+  base::Semaphore pending_array_buffer_free_tasks_semaphore_;
+
   struct StrongRootsList;
   StrongRootsList* strong_roots_list_;
 
@@ -2210,6 +2393,9 @@ class Heap {
   friend class Isolate;
   friend class MarkCompactCollector;
   friend class MarkCompactMarkingVisitor;
+  friend class ParallelScavenger;
+  friend class ScavengeTask;
+  friend class FreeArrayBuffersTask;
   friend class MapCompact;
   friend class Page;
 
@@ -2469,19 +2655,25 @@ class DescriptorLookupCache {
   int Lookup(Map* source, Name* name) {
     if (!name->IsUniqueName()) return kAbsent;
     int index = Hash(source, name);
-    Key& key = keys_[index];
-    if ((key.source == source) && (key.name == name)) return results_[index];
+    for (int i = index; i < index + kEntriesPerBucket; i++) {
+      Key& key = keys_[i];
+      if ((key.source == source) && (key.name == name)) return results_[i];
+    }
     return kAbsent;
   }
 
-  // Update an element in the cache.
+  // Update an element in the cache. The entry is inserted at the front of
+  // its bucket, evicting the bucket's oldest entry.
   void Update(Map* source, Name* name, int result) {
     DCHECK(result != kAbsent);
     if (name->IsUniqueName()) {
       int index = Hash(source, name);
-      Key& key = keys_[index];
-      key.source = source;
-      key.name = name;
+      for (int i = index + kEntriesPerBucket - 1; i > index; i--) {
+        keys_[i] = keys_[i - 1];
+        results_[i] = results_[i - 1];
+      }
+      keys_[index].source = source;
+      keys_[index].name = name;
       results_[index] = result;
     }
   }
@@ -2500,18 +2692,27 @@ class DescriptorLookupCache {
     }
   }
 
+  // Returns the index of the first entry of the bucket for (source, name).
   static int Hash(Object* source, Name* name) {
-    // Uses only lower 32 bits if pointers are larger.
+    // Heap objects are allocated at consecutive, aligned addresses, so
+    // only the low pointer bits vary. Mix them with a golden-ratio
+    // multiply and index with the upper product bits, which depend on all
+    // of the input bits.
     uint32_t source_hash =
         static_cast<uint32_t>(reinterpret_cast<uintptr_t>(source)) >>
         kPointerSizeLog2;
     uint32_t name_hash =
         static_cast<uint32_t>(reinterpret_cast<uintptr_t>(name)) >>
         kPointerSizeLog2;
-    return (source_hash ^ name_hash) % kLength;
+    uint32_t hash = (source_hash ^ name_hash) * 0x9E3779B9u;
+    return static_cast<int>(hash >> (32 - kBucketBits)) * kEntriesPerBucket;
   }
 
-  static const int kLength = 64;
+  // The number of buckets and the bucket associativity can be tuned
+  // independently; the total size is their product.
+  static const int kBucketBits = 7;
+  static const int kEntriesPerBucket = 2;
+  static const int kLength = (1 << kBucketBits) * kEntriesPerBucket;
   struct Key {
     Map* source;
     Name* name;
@@ -2525,6 +2726,137 @@ class DescriptorLookupCache {
 };
 
 
+// Cache for mapping (map, property name) into the map the transition for
+// that name leads to. Only positive results for kData/NONE transitions are
+// cached; the transition tree is mutable, so the cache is cleared whenever
+// transitions are inserted or replaced, and prior to any gc.
+class TransitionLookupCache {
+ public:
+  // Lookup the target map of the (map, name) transition.
+  // Returns NULL if the result is not cached.
+  Map* Lookup(Map* source, Name* name) {
+    if (!name->IsUniqueName()) return NULL;
+    int index = Hash(source, name);
+    Key& key = keys_[index];
+    if ((key.source == source) && (key.name == name)) return targets_[index];
+    return NULL;
+  }
+
+  // Update an element in the cache.
+  void Update(Map* source, Name* name, Map* target) {
+    DCHECK_NOT_NULL(target);
+    if (name->IsUniqueName()) {
+      int index = Hash(source, name);
+      Key& key = keys_[index];
+      key.source = source;
+      key.name = name;
+      targets_[index] = target;
+    }
+  }
+
+  // Clear the cache.
+  void Clear();
+
+ private:
+  TransitionLookupCache() {
+    for (int i = 0; i < kLength; ++i) {
+      keys_[i].source = NULL;
+      keys_[i].name = NULL;
+      targets_[i] = NULL;
+    }
+  }
+
+  static int Hash(Object* source, Name* name) {
+    // Only the low pointer bits vary; see DescriptorLookupCache::Hash.
+    uint32_t source_hash =
+        static_cast<uint32_t>(reinterpret_cast<uintptr_t>(source)) >>
+        kPointerSizeLog2;
+    uint32_t name_hash =
+        static_cast<uint32_t>(reinterpret_cast<uintptr_t>(name)) >>
+        kPointerSizeLog2;
+    uint32_t hash = (source_hash ^ name_hash) * 0x9E3779B9u;
+    return static_cast<int>(hash >> (32 - kLengthBits));
+  }
+
+  static const int kLengthBits = 6;
+  static const int kLength = 1 << kLengthBits;
+  struct Key {
+    Map* source;
+    Name* name;
+  };
+
+  Key keys_[kLength];
+  Map* targets_[kLength];
+
+  friend class Isolate;
+  DISALLOW_COPY_AND_ASSIGN(TransitionLookupCache);
+};
+
+
+// Cache for sharing structurally identical ScopeInfo objects. Repeated eval
+// and Function constructor calls keep producing scopes with the same
+// variable layout even when the eval cache misses on the source; since a
+// ScopeInfo is immutable and fully determines the context slot layout,
+// such scopes can share one object. The cache holds raw pointers and is
+// cleared prior to any gc.
+class ScopeInfoCache {
+ public:
+  // Returns a previously created ScopeInfo with the same contents as
+  // |candidate|, or enters |candidate| into the cache and returns it.
+  ScopeInfo* GetCanonical(ScopeInfo* candidate);
+
+  // Clear the cache.
+  void Clear();
+
+ private:
+  ScopeInfoCache() { Clear(); }
+
+  static const int kLengthBits = 6;
+  static const int kLength = 1 << kLengthBits;
+
+  ScopeInfo* entries_[kLength];
+
+  friend class Isolate;
+  DISALLOW_COPY_AND_ASSIGN(ScopeInfoCache);
+};
+
+
+// Cache for the names returned by Object.getOwnPropertyNames on fast mode
+// objects without hidden prototypes. For such objects the names, including
+// the non-enumerable ones, depend only on the map and the attribute filter.
+// The cached arrays are copy-on-write, so they double as the elements of the
+// result arrays. The cache holds raw pointers and is cleared prior to any gc.
+class OwnPropertyNamesCache {
+ public:
+  // Lookup the names for (map, filter). Returns NULL on a miss.
+  FixedArray* Lookup(Map* source, int filter);
+
+  // Update an element in the cache.
+  void Update(Map* source, int filter, FixedArray* names);
+
+  // Clear the cache.
+  void Clear();
+
+ private:
+  OwnPropertyNamesCache() { Clear(); }
+
+  static int Hash(Map* source, int filter);
+
+  static const int kLengthBits = 6;
+  static const int kLength = 1 << kLengthBits;
+  struct Key {
+    Map* source;
+    int filter;
+  };
+
+  Key keys_[kLength];
+  FixedArray* results_[kLength];
+
+  friend class Isolate;
+  DISALLOW_COPY_AND_ASSIGN(OwnPropertyNamesCache);
+};
+
+
 class RegExpResultsCache {
  public:
   enum ResultsCacheType { REGEXP_MULTIPLE_INDICES, STRING_SPLIT_SUBSTRINGS };
@@ -33,6 +33,7 @@ class IdentityMapBase {
         concurrent_(false),
         gc_counter_(-1),
         size_(0),
+        occupancy_(0),
         mask_(0),
         keys_(nullptr),
         values_(nullptr) {}
@@ -56,6 +57,7 @@ class IdentityMapBase {
   bool concurrent_;
   int gc_counter_;
   int size_;
+  int occupancy_;
   int mask_;
   Object** keys_;
   void** values_;
@@ -15,6 +15,16 @@ bool IncrementalMarking::BaseRecordWrite(HeapObject* obj, Object** slot,
                                          Object* value) {
   HeapObject* value_heap_obj = HeapObject::cast(value);
   MarkBit value_bit = Marking::MarkBitFrom(value_heap_obj);
+  if (concurrent_marking_in_progress_ && Marking::IsWhite(value_bit)) {
+    // A concurrent marking task may already have scanned |obj| without
+    // seeing this store, so the barrier has to mark the value itself
+    // instead of relying on |obj| being rescanned.
+    if (Marking::WhiteToGreyAtomic(value_bit)) {
+      heap_->mark_compact_collector()->marking_deque()->PushGrey(
+          value_heap_obj);
+      RestartIfNotMarking();
+    }
+  }
   if (Marking::IsWhite(value_bit)) {
     MarkBit obj_bit = Marking::MarkBitFrom(obj);
     if (Marking::IsBlack(obj_bit)) {
@@ -83,9 +93,15 @@ void IncrementalMarking::BlackToGreyAndUnshift(HeapObject* obj,
   DCHECK(Marking::MarkBitFrom(obj) == mark_bit);
   DCHECK(obj->Size() >= 2 * kPointerSize);
   DCHECK(IsMarking());
-  Marking::BlackToGrey(mark_bit);
   int obj_size = obj->Size();
-  MemoryChunk::IncrementLiveBytesFromGC(obj->address(), -obj_size);
+  if (concurrent_marking_in_progress_) {
+    Marking::BlackToGreyAtomic(mark_bit);
+    MemoryChunk::FromAddress(obj->address())
+        ->IncrementLiveBytesAtomic(-obj_size);
+  } else {
+    Marking::BlackToGrey(mark_bit);
+    MemoryChunk::IncrementLiveBytesFromGC(obj->address(), -obj_size);
+  }
   bytes_scanned_ -= obj_size;
   int64_t old_bytes_rescanned = bytes_rescanned_;
   bytes_rescanned_ = old_bytes_rescanned + obj_size;
@@ -110,7 +126,11 @@ void IncrementalMarking::BlackToGreyAndUnshift(HeapObject* obj,
 
 
 void IncrementalMarking::WhiteToGreyAndPush(HeapObject* obj, MarkBit mark_bit) {
-  Marking::WhiteToGrey(mark_bit);
+  if (concurrent_marking_in_progress_) {
+    if (!Marking::WhiteToGreyAtomic(mark_bit)) return;
+  } else {
+    Marking::WhiteToGrey(mark_bit);
+  }
   heap_->mark_compact_collector()->marking_deque()->PushGrey(obj);
 }
 }
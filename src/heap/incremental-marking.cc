@@ -19,6 +19,11 @@ namespace internal {
 IncrementalMarking::IncrementalMarking(Heap* heap)
     : heap_(heap),
       state_(STOPPED),
+      black_allocation_(false),
+      concurrent_marking_in_progress_(false),
+      concurrent_marking_task_pending_(false),
+      concurrent_marking_active_(0),
+      pending_concurrent_marking_task_semaphore_(0),
       steps_count_(0),
       old_generation_space_available_at_start_of_incremental_(0),
       old_generation_space_used_at_start_of_incremental_(0),
@@ -535,6 +540,14 @@ void IncrementalMarking::StartMarking() {
   IncrementalMarkingRootMarkingVisitor visitor(this);
   heap_->IterateStrongRoots(&visitor, VISIT_ONLY_STRONG);
 
+  if (FLAG_black_allocation) {
+    StartBlackAllocation();
+  }
+
+  if (FLAG_concurrent_marking && !is_compacting_) {
+    StartConcurrentMarking();
+  }
+
   // Ready to start incremental marking.
   if (FLAG_trace_incremental_marking) {
     PrintF("[IncrementalMarking] Running\n");
@@ -542,6 +555,244 @@ void IncrementalMarking::StartMarking() {
 }
 
 
+void IncrementalMarking::StartBlackAllocation() {
+  DCHECK(FLAG_black_allocation);
+  DCHECK(IsMarking());
+  black_allocation_ = true;
+  if (FLAG_trace_incremental_marking) {
+    PrintF("[IncrementalMarking] Black allocation started\n");
+  }
+}
+
+
+void IncrementalMarking::FinishBlackAllocation() {
+  if (!black_allocation_) return;
+  black_allocation_ = false;
+  if (FLAG_trace_incremental_marking) {
+    PrintF("[IncrementalMarking] Black allocation finished\n");
+  }
+}
+
+
+class ConcurrentMarkingTask : public v8::Task {
+ public:
+  explicit ConcurrentMarkingTask(IncrementalMarking* marking)
+      : marking_(marking) {}
+
+  virtual ~ConcurrentMarkingTask() {}
+
+ private:
+  // v8::Task overrides.
+  void Run() override {
+    marking_->RunConcurrentMarkingTask();
+    marking_->pending_concurrent_marking_task_semaphore_.Signal();
+  }
+
+  IncrementalMarking* marking_;
+
+  DISALLOW_COPY_AND_ASSIGN(ConcurrentMarkingTask);
+};
+
+
+// Returns true if objects of the given map can be scanned by the
+// concurrent marking task while the mutator is running. The layout of
+// these objects cannot change in a way that makes a concurrent scan
+// misinterpret raw data as tagged values; the in-place layout changes
+// that would — array trimming and string externalization, which
+// overwrites cons and sliced string fields with a raw resource
+// pointer — pause the task first. Stores of unmarked values are caught
+// by the write barrier, which marks the stored value itself while
+// concurrent marking is active.
+static bool CanMarkConcurrently(Map* map) {
+  InstanceType type = map->instance_type();
+  if (type < FIRST_NONSTRING_TYPE) {
+    StringRepresentationTag rep =
+        static_cast<StringRepresentationTag>(type & kStringRepresentationMask);
+    return rep == kSeqStringTag || rep == kConsStringTag ||
+           rep == kSlicedStringTag;
+  }
+  switch (type) {
+    case HEAP_NUMBER_TYPE:
+    case BYTE_ARRAY_TYPE:
+    case FIXED_ARRAY_TYPE:
+    case FIXED_DOUBLE_ARRAY_TYPE:
+      return true;
+    case JS_OBJECT_TYPE:
+    case JS_ARRAY_TYPE:
+      // With unboxed double fields, in-place migration writes raw double
+      // bits into fields while the object still carries its old all-tagged
+      // map, so a check against the current map does not make the scan
+      // safe. Without the flag every in-place map change leaves all fields
+      // tagged.
+      return !FLAG_unbox_double_fields;
+    default:
+      return false;
+  }
+}
+
+
+// Reads a field that the mutator may be writing concurrently.
+static Object* AtomicFieldLoad(HeapObject* obj, int offset) {
+  return reinterpret_cast<Object*>(base::NoBarrier_Load(
+      reinterpret_cast<base::AtomicWord*>(obj->address() + offset)));
+}
+
+
+void IncrementalMarking::StartConcurrentMarking() {
+  DCHECK(FLAG_concurrent_marking);
+  DCHECK(!is_compacting_);
+  concurrent_marking_in_progress_ = true;
+  if (FLAG_trace_incremental_marking) {
+    PrintF("[IncrementalMarking] Concurrent marking started\n");
+  }
+  TransferObjectsToConcurrentWorklist();
+  ResumeConcurrentMarking();
+}
+
+
+void IncrementalMarking::StopConcurrentMarking() {
+  if (!concurrent_marking_in_progress_) return;
+  PauseConcurrentMarking();
+  // Return unfinished work to the marking deque.
+  MarkingDeque* marking_deque =
+      heap_->mark_compact_collector()->marking_deque();
+  for (int i = 0; i < concurrent_marking_worklist_.length(); i++) {
+    marking_deque->PushGrey(concurrent_marking_worklist_[i]);
+  }
+  concurrent_marking_worklist_.Rewind(0);
+  concurrent_marking_in_progress_ = false;
+  if (FLAG_trace_incremental_marking) {
+    PrintF("[IncrementalMarking] Concurrent marking stopped\n");
+  }
+}
+
+
+void IncrementalMarking::PauseConcurrentMarking() {
+  DCHECK(concurrent_marking_in_progress_);
+  if (concurrent_marking_task_pending_) {
+    base::NoBarrier_Store(&concurrent_marking_active_, 0);
+    pending_concurrent_marking_task_semaphore_.Wait();
+    concurrent_marking_task_pending_ = false;
+  }
+  // Hand the objects the task could not process over to the main thread.
+  MarkingDeque* marking_deque =
+      heap_->mark_compact_collector()->marking_deque();
+  for (int i = 0; i < concurrent_marking_deferred_objects_.length(); i++) {
+    marking_deque->PushGrey(concurrent_marking_deferred_objects_[i]);
+  }
+  concurrent_marking_deferred_objects_.Rewind(0);
+}
+
+
+void IncrementalMarking::ResumeConcurrentMarking() {
+  DCHECK(concurrent_marking_in_progress_);
+  if (concurrent_marking_task_pending_) return;
+  concurrent_marking_task_pending_ = true;
+  base::NoBarrier_Store(&concurrent_marking_active_, 1);
+  V8::GetCurrentPlatform()->CallOnBackgroundThread(
+      new ConcurrentMarkingTask(this), v8::Platform::kShortRunningTask);
+}
+
+
+void IncrementalMarking::TransferObjectsToConcurrentWorklist() {
+  MarkingDeque* marking_deque =
+      heap_->mark_compact_collector()->marking_deque();
+  if (marking_deque->IsEmpty()) return;
+  base::LockGuard<base::Mutex> guard(&concurrent_marking_worklist_mutex_);
+  int current = marking_deque->bottom();
+  int mask = marking_deque->mask();
+  int limit = marking_deque->top();
+  HeapObject** array = marking_deque->array();
+  int new_top = current;
+
+  while (current != limit) {
+    HeapObject* obj = array[current];
+    current = ((current + 1) & mask);
+    MarkBit mark_bit = Marking::MarkBitFrom(obj);
+    MemoryChunk* chunk = MemoryChunk::FromAddress(obj->address());
+    if (!heap_->InNewSpace(obj) && Marking::IsGrey(mark_bit) &&
+        !chunk->IsFlagSet(MemoryChunk::HAS_PROGRESS_BAR) &&
+        CanMarkConcurrently(obj->map())) {
+      concurrent_marking_worklist_.Add(obj);
+    } else {
+      array[new_top] = obj;
+      new_top = ((new_top + 1) & mask);
+      DCHECK(new_top != marking_deque->bottom());
+    }
+  }
+  marking_deque->set_top(new_top);
+}
+
+
+void IncrementalMarking::RunConcurrentMarkingTask() {
+  while (base::NoBarrier_Load(&concurrent_marking_active_) != 0) {
+    HeapObject* object = NULL;
+    {
+      base::LockGuard<base::Mutex> guard(&concurrent_marking_worklist_mutex_);
+      if (concurrent_marking_worklist_.is_empty()) break;
+      object = concurrent_marking_worklist_.RemoveLast();
+    }
+    ConcurrentlyMarkObject(object);
+  }
+}
+
+
+void IncrementalMarking::ConcurrentlyMarkObject(HeapObject* obj) {
+  Map* map = obj->map();
+  // Mark the map; maps are never scanned off the main thread.
+  ConcurrentlyMarkValue(map);
+  if (!CanMarkConcurrently(map)) {
+    // The object was retyped after it was transferred, e.g. by left
+    // trimming; let the main thread deal with it.
+    concurrent_marking_deferred_objects_.Add(obj);
+    return;
+  }
+  int size = obj->SizeFromMap(map);
+  InstanceType type = map->instance_type();
+  if (type == FIXED_ARRAY_TYPE || type == JS_OBJECT_TYPE ||
+      type == JS_ARRAY_TYPE) {
+    // Every field of these objects holds a tagged value; a racing mutator
+    // store leaves either the old or the new value in the slot and the
+    // write barrier marks new values itself.
+    for (int offset = kPointerSize; offset < size; offset += kPointerSize) {
+      ConcurrentlyMarkValue(AtomicFieldLoad(obj, offset));
+    }
+  } else if (type < FIRST_NONSTRING_TYPE) {
+    StringRepresentationTag rep =
+        static_cast<StringRepresentationTag>(type & kStringRepresentationMask);
+    if (rep == kConsStringTag) {
+      ConcurrentlyMarkValue(AtomicFieldLoad(obj, ConsString::kFirstOffset));
+      ConcurrentlyMarkValue(AtomicFieldLoad(obj, ConsString::kSecondOffset));
+    } else if (rep == kSlicedStringTag) {
+      ConcurrentlyMarkValue(AtomicFieldLoad(obj, SlicedString::kParentOffset));
+    }
+    // Sequential strings hold no pointers.
+  }
+  // Heap numbers, byte arrays and fixed double arrays hold no pointers.
+  if (Marking::GreyToBlackAtomic(Marking::MarkBitFrom(obj))) {
+    MemoryChunk::FromAddress(obj->address())->IncrementLiveBytesAtomic(size);
+  }
+}
+
+
+void IncrementalMarking::ConcurrentlyMarkValue(Object* value) {
+  if (!value->IsHeapObject()) return;
+  HeapObject* heap_object = HeapObject::cast(value);
+  MarkBit mark_bit = Marking::MarkBitFrom(heap_object);
+  if (!Marking::IsWhite(mark_bit)) return;
+  if (!Marking::WhiteToGreyAtomic(mark_bit)) return;
+  if (!heap_->InNewSpace(heap_object) &&
+      CanMarkConcurrently(heap_object->map()) &&
+      !MemoryChunk::FromAddress(heap_object->address())
+           ->IsFlagSet(MemoryChunk::HAS_PROGRESS_BAR)) {
+    base::LockGuard<base::Mutex> guard(&concurrent_marking_worklist_mutex_);
+    concurrent_marking_worklist_.Add(heap_object);
+  } else {
+    concurrent_marking_deferred_objects_.Add(heap_object);
+  }
+}
+
+
 void IncrementalMarking::MarkObjectGroups() {
   DCHECK(FLAG_overapproximate_weak_closure);
   DCHECK(!weak_closure_was_overapproximated_);
@@ -573,6 +824,9 @@ void IncrementalMarking::MarkObjectGroups() {
 
 void IncrementalMarking::PrepareForScavenge() {
   if (!IsMarking()) return;
+  // The scavenger moves objects and transfers mark bits without atomic
+  // operations; the concurrent marking task must not run in parallel.
+  if (concurrent_marking_in_progress_) PauseConcurrentMarking();
   NewSpacePageIterator it(heap_->new_space()->FromSpaceStart(),
                           heap_->new_space()->FromSpaceEnd());
   while (it.has_next()) {
@@ -628,6 +882,8 @@ void IncrementalMarking::UpdateMarkingDequeAfterScavenge() {
     }
   }
   marking_deque->set_top(new_top);
+
+  if (concurrent_marking_in_progress_) ResumeConcurrentMarking();
 }
 
 
@@ -699,6 +955,7 @@ void IncrementalMarking::ProcessMarkingDeque() {
 
 
 void IncrementalMarking::Hurry() {
+  StopConcurrentMarking();
   if (state() == MARKING) {
     double start = 0.0;
     if (FLAG_trace_incremental_marking || FLAG_print_cumulative_gc_stat) {
@@ -752,6 +1009,7 @@ void IncrementalMarking::Abort() {
   if (FLAG_trace_incremental_marking) {
     PrintF("[IncrementalMarking] Aborting.\n");
   }
+  StopConcurrentMarking();
   heap_->new_space()->LowerInlineAllocationLimit(0);
   IncrementalMarking::set_should_hurry(false);
   ResetStepCounters();
@@ -773,6 +1031,7 @@ void IncrementalMarking::Abort() {
   heap_->isolate()->stack_guard()->ClearGC();
   state_ = STOPPED;
   is_compacting_ = false;
+  FinishBlackAllocation();
 }
 
 
@@ -788,6 +1047,7 @@ void IncrementalMarking::Finalize() {
   DeactivateIncrementalWriteBarrier();
   DCHECK(heap_->mark_compact_collector()->marking_deque()->IsEmpty());
   heap_->isolate()->stack_guard()->ClearGC();
+  FinishBlackAllocation();
 }
 
 
@@ -969,8 +1229,15 @@ intptr_t IncrementalMarking::Step(intptr_t allocated_bytes,
         StartMarking();
       }
     } else if (state_ == MARKING) {
+      if (concurrent_marking_in_progress_) {
+        // Feed the concurrent marking task and pause it while the main
+        // thread processes the objects the task cannot handle.
+        TransferObjectsToConcurrentWorklist();
+        PauseConcurrentMarking();
+      }
       bytes_processed = ProcessMarkingDeque(bytes_to_process);
-      if (heap_->mark_compact_collector()->marking_deque()->IsEmpty()) {
+      if (heap_->mark_compact_collector()->marking_deque()->IsEmpty() &&
+          concurrent_marking_worklist_.is_empty()) {
         if (completion == FORCE_COMPLETION ||
             IsIdleMarkingDelayCounterLimitReached()) {
           if (FLAG_overapproximate_weak_closure &&
@@ -983,6 +1250,10 @@ intptr_t IncrementalMarking::Step(intptr_t allocated_bytes,
           IncrementIdleMarkingDelayCounter();
         }
       }
+      if (concurrent_marking_in_progress_ &&
+          !concurrent_marking_worklist_.is_empty()) {
+        ResumeConcurrentMarking();
+      }
     }
 
     steps_count_++;
@@ -167,6 +167,27 @@ class IncrementalMarking {
 
   bool IsCompacting() { return IsMarking() && is_compacting_; }
 
+  // While black allocation is active, objects allocated in the old
+  // generation are allocated black so that marking steps do not need to
+  // visit them.
+  bool black_allocation() const { return black_allocation_; }
+
+  // True while a concurrent marking task may be running. While this is
+  // the case all mark bit transitions on the main thread must use the
+  // atomic variants in Marking.
+  bool concurrent_marking_in_progress() const {
+    return concurrent_marking_in_progress_;
+  }
+
+  // Stops the concurrent marking task and moves the objects it could not
+  // process back onto the marking deque. The main thread may only touch
+  // mark bits non-atomically, process the marking deque or move objects
+  // while the task is paused.
+  void PauseConcurrentMarking();
+
+  // Restarts the concurrent marking task after a pause.
+  void ResumeConcurrentMarking();
+
   void ActivateGeneratedStub(Code* stub);
 
   void NotifyOfHighPromotionRate();
@@ -196,6 +217,23 @@ class IncrementalMarking {
 
   void StartMarking();
 
+  void StartBlackAllocation();
+  void FinishBlackAllocation();
+
+  void StartConcurrentMarking();
+  void StopConcurrentMarking();
+
+  // Moves grey objects that the concurrent marking task can handle from
+  // the marking deque to the concurrent marking worklist.
+  void TransferObjectsToConcurrentWorklist();
+
+  // Body of the concurrent marking task: drains the concurrent marking
+  // worklist until it is empty or the task is told to stop.
+  void RunConcurrentMarkingTask();
+
+  void ConcurrentlyMarkObject(HeapObject* obj);
+  void ConcurrentlyMarkValue(Object* value);
+
   void ActivateIncrementalWriteBarrier(PagedSpace* space);
   static void ActivateIncrementalWriteBarrier(NewSpace* space);
   void ActivateIncrementalWriteBarrier();
@@ -221,6 +259,21 @@ class IncrementalMarking {
 
   State state_;
   bool is_compacting_;
+  bool black_allocation_;
+
+  bool concurrent_marking_in_progress_;
+  // Whether a concurrent marking task has been spawned and not yet been
+  // joined. Only accessed on the main thread.
+  bool concurrent_marking_task_pending_;
+  // Tells a running concurrent marking task to stop.
+  base::Atomic32 concurrent_marking_active_;
+  base::Semaphore pending_concurrent_marking_task_semaphore_;
+  base::Mutex concurrent_marking_worklist_mutex_;
+  List<HeapObject*> concurrent_marking_worklist_;
+  // Objects the concurrent marking task could not process. Only written
+  // by the task while it runs and flushed back onto the marking deque by
+  // the main thread when the task is paused.
+  List<HeapObject*> concurrent_marking_deferred_objects_;
 
   int steps_count_;
   int64_t old_generation_space_available_at_start_of_incremental_;
@@ -245,6 +298,8 @@ class IncrementalMarking {
 
   GCRequestType request_type_;
 
+  friend class ConcurrentMarkingTask;
+
   DISALLOW_IMPLICIT_CONSTRUCTORS(IncrementalMarking);
 };
 }
@@ -47,9 +47,15 @@ MarkCompactCollector::MarkCompactCollector(Heap* heap)
       compacting_(false),
       was_marked_incrementally_(false),
       sweeping_in_progress_(false),
+      num_sweeping_tasks_(0),
       pending_sweeper_jobs_semaphore_(0),
+      pending_marking_tasks_semaphore_(0),
+      marking_tasks_working_(0),
+      pending_compaction_tasks_semaphore_(0),
+      next_evacuation_candidate_(0),
       evacuation_(false),
       migration_slots_buffer_(NULL),
+      scanned_weak_collections_(Smi::FromInt(0)),
       heap_(heap),
       marking_deque_memory_(NULL),
       marking_deque_memory_committed_(false),
@@ -226,6 +232,8 @@ static void VerifyEvacuation(Heap* heap) {
 
 void MarkCompactCollector::SetUp() {
   free_list_old_space_.Reset(new FreeList(heap_->old_space()));
+  free_list_code_space_.Reset(new FreeList(heap_->code_space()));
+  free_list_map_space_.Reset(new FreeList(heap_->map_space()));
   EnsureMarkingDequeIsCommittedAndInitialize(256 * KB);
 }
 
@@ -476,6 +484,45 @@ void MarkCompactCollector::ClearMarkbits() {
 }
 
 
+class MarkCompactCollector::MarkingTask : public v8::Task {
+ public:
+  explicit MarkingTask(Heap* heap) : heap_(heap) {}
+
+  virtual ~MarkingTask() {}
+
+ private:
+  // v8::Task overrides.
+  void Run() override {
+    heap_->mark_compact_collector()->RunMarkingTask();
+    heap_->mark_compact_collector()->pending_marking_tasks_semaphore_.Signal();
+  }
+
+  Heap* heap_;
+
+  DISALLOW_COPY_AND_ASSIGN(MarkingTask);
+};
+
+
+class MarkCompactCollector::CompactionTask : public v8::Task {
+ public:
+  explicit CompactionTask(Heap* heap) : heap_(heap) {}
+
+  virtual ~CompactionTask() {}
+
+ private:
+  // v8::Task overrides.
+  void Run() override {
+    heap_->mark_compact_collector()->RunCompactionTask();
+    heap_->mark_compact_collector()
+        ->pending_compaction_tasks_semaphore_.Signal();
+  }
+
+  Heap* heap_;
+
+  DISALLOW_COPY_AND_ASSIGN(CompactionTask);
+};
+
+
 class MarkCompactCollector::SweeperTask : public v8::Task {
  public:
   SweeperTask(Heap* heap, PagedSpace* space) : heap_(heap), space_(space) {}
@@ -498,9 +545,19 @@ class MarkCompactCollector::SweeperTask : public v8::Task {
 
 void MarkCompactCollector::StartSweeperThreads() {
   DCHECK(free_list_old_space_.get()->IsEmpty());
+  DCHECK(free_list_code_space_.get()->IsEmpty());
+  DCHECK(free_list_map_space_.get()->IsEmpty());
   V8::GetCurrentPlatform()->CallOnBackgroundThread(
       new SweeperTask(heap(), heap()->old_space()),
       v8::Platform::kShortRunningTask);
+  num_sweeping_tasks_++;
+}
+
+
+void MarkCompactCollector::StartSweeperThread(PagedSpace* space) {
+  V8::GetCurrentPlatform()->CallOnBackgroundThread(
+      new SweeperTask(heap(), space), v8::Platform::kShortRunningTask);
+  num_sweeping_tasks_++;
 }
 
 
@@ -511,15 +568,22 @@ void MarkCompactCollector::EnsureSweepingCompleted() {
   // here.
   if (!heap()->concurrent_sweeping_enabled() || !IsSweepingCompleted()) {
     SweepInParallel(heap()->paged_space(OLD_SPACE), 0);
+    SweepInParallel(heap()->paged_space(CODE_SPACE), 0);
+    SweepInParallel(heap()->paged_space(MAP_SPACE), 0);
   }
-  // Wait twice for both jobs.
-  if (heap()->concurrent_sweeping_enabled()) {
+  // Wait for all sweeper tasks.
+  for (int i = 0; i < num_sweeping_tasks_; i++) {
     pending_sweeper_jobs_semaphore_.Wait();
   }
+  num_sweeping_tasks_ = 0;
   ParallelSweepSpacesComplete();
   sweeping_in_progress_ = false;
   RefillFreeList(heap()->paged_space(OLD_SPACE));
+  RefillFreeList(heap()->paged_space(CODE_SPACE));
+  RefillFreeList(heap()->paged_space(MAP_SPACE));
   heap()->paged_space(OLD_SPACE)->ResetUnsweptFreeBytes();
+  heap()->paged_space(CODE_SPACE)->ResetUnsweptFreeBytes();
+  heap()->paged_space(MAP_SPACE)->ResetUnsweptFreeBytes();
 
 #ifdef VERIFY_HEAP
   if (FLAG_verify_heap && !evacuation()) {
@@ -530,12 +594,16 @@ void MarkCompactCollector::EnsureSweepingCompleted() {
 
 
 bool MarkCompactCollector::IsSweepingCompleted() {
-  if (!pending_sweeper_jobs_semaphore_.WaitFor(
-          base::TimeDelta::FromSeconds(0))) {
-    return false;
+  int signalled = 0;
+  while (signalled < num_sweeping_tasks_ &&
+         pending_sweeper_jobs_semaphore_.WaitFor(
+             base::TimeDelta::FromSeconds(0))) {
+    signalled++;
   }
-  pending_sweeper_jobs_semaphore_.Signal();
-  return true;
+  for (int i = 0; i < signalled; i++) {
+    pending_sweeper_jobs_semaphore_.Signal();
+  }
+  return signalled == num_sweeping_tasks_;
 }
 
 
@@ -544,9 +612,13 @@ void MarkCompactCollector::RefillFreeList(PagedSpace* space) {
 
   if (space == heap()->old_space()) {
     free_list = free_list_old_space_.get();
+  } else if (space == heap()->code_space()) {
+    free_list = free_list_code_space_.get();
+  } else if (space == heap()->map_space()) {
+    free_list = free_list_map_space_.get();
   } else {
     // Any PagedSpace might invoke RefillFreeLists, so we need to make sure
-    // to only refill them for the old space.
+    // to only refill them for the spaces that are swept concurrently.
     return;
   }
 
@@ -978,6 +1050,46 @@ void MarkCompactCollector::Finish() {
 // and continue with marking.  This process repeats until all reachable
 // objects have been marked.
 
+bool CodeFlusher::CanFlushCandidate(SharedFunctionInfo* shared_info) {
+  Heap* heap = isolate_->heap();
+
+  // Candidates that are already queued were charged against the budget
+  // when they were accepted; do not charge them a second time.
+  if (GetNextCandidate(shared_info) != NULL) return true;
+
+  // Functions above the configured tick threshold are considered hot and
+  // keep their code to avoid the recompilation cost on their next burst.
+  int hot_threshold = heap->code_retention_hot_tick_threshold();
+  if (hot_threshold > 0 && shared_info->profiler_ticks() >= hot_threshold) {
+    return false;
+  }
+
+  Code* code = shared_info->code();
+
+  // Besides being old in terms of GC generations the code must have gone
+  // unused for the configured wall-clock time. Code that was never
+  // executed has no execution to measure from and is always flushable.
+  int minimum_age_in_ms = heap->code_retention_minimum_age_in_ms();
+  if (minimum_age_in_ms > 0) {
+    int age = code->GetAge();
+    if (age > 0 && !heap->CodeAgeSpansAtLeast(age, minimum_age_in_ms)) {
+      return false;
+    }
+  }
+
+  // Charge the per-cycle flush budget; once it is exhausted remaining
+  // candidates keep their code until a later collection.
+  size_t budget = heap->code_flush_budget_per_gc();
+  if (budget > 0) {
+    size_t code_size = static_cast<size_t>(code->CodeSize());
+    if (flush_budget_used_ + code_size > budget) return false;
+    flush_budget_used_ += code_size;
+  }
+
+  return true;
+}
+
+
 void CodeFlusher::ProcessJSFunctionCandidates() {
   Code* lazy_compile = isolate_->builtins()->builtin(Builtins::kCompileLazy);
   Object* undefined = isolate_->heap()->undefined_value();
@@ -998,8 +1110,19 @@ void CodeFlusher::ProcessJSFunctionCandidates() {
         shared->ShortPrint();
         PrintF(" - age: %d]\n", code->GetAge());
       }
+      isolate_->heap()->IncrementFlushedCodeStatistics(code->CodeSize());
+      shared->set_was_flushed(true);
       shared->set_code(lazy_compile);
       candidate->set_code(lazy_compile);
+      // The type feedback of flushed code is stale; drop the vector so that
+      // its memory can be reclaimed and lazy recompilation allocates a fresh
+      // one.
+      shared->set_feedback_vector(
+          TypeFeedbackVector::cast(isolate_->heap()->empty_fixed_array()));
+      Object** feedback_vector_slot = HeapObject::RawField(
+          shared, SharedFunctionInfo::kFeedbackVectorOffset);
+      isolate_->heap()->mark_compact_collector()->RecordSlot(
+          feedback_vector_slot, feedback_vector_slot, *feedback_vector_slot);
     } else {
       DCHECK(Marking::IsBlack(code_mark));
       candidate->set_code(code);
@@ -1041,7 +1164,18 @@ void CodeFlusher::ProcessSharedFunctionInfoCandidates() {
         candidate->ShortPrint();
         PrintF(" - age: %d]\n", code->GetAge());
       }
+      isolate_->heap()->IncrementFlushedCodeStatistics(code->CodeSize());
+      candidate->set_was_flushed(true);
       candidate->set_code(lazy_compile);
+      // The type feedback of flushed code is stale; drop the vector so that
+      // its memory can be reclaimed and lazy recompilation allocates a fresh
+      // one.
+      candidate->set_feedback_vector(
+          TypeFeedbackVector::cast(isolate_->heap()->empty_fixed_array()));
+      Object** feedback_vector_slot = HeapObject::RawField(
+          candidate, SharedFunctionInfo::kFeedbackVectorOffset);
+      isolate_->heap()->mark_compact_collector()->RecordSlot(
+          feedback_vector_slot, feedback_vector_slot, *feedback_vector_slot);
     }
 
     Object** code_slot =
@@ -1508,6 +1642,7 @@ void MarkCompactMarkingVisitor::ObjectStatsVisitBase(
   Heap* heap = map->GetHeap();
   int object_size = obj->Size();
   heap->RecordObjectStats(map->instance_type(), object_size);
+  heap->RecordMapStats(map, object_size);
   non_count_table_.GetVisitorById(id)(map, obj);
   if (obj->IsJSObject()) {
     JSObject* object = JSObject::cast(obj);
@@ -1758,8 +1893,9 @@ class RootMarkingVisitor : public ObjectVisitor {
     MarkCompactMarkingVisitor::IterateBody(map, object);
 
     // Mark all the objects reachable from the map and body.  May leave
-    // overflowed objects in the heap.
-    collector_->EmptyMarkingDeque();
+    // overflowed objects in the heap.  With parallel marking, objects are
+    // left on the deque to be drained by the marking tasks.
+    if (!collector_->UseParallelMarking()) collector_->EmptyMarkingDeque();
   }
 
   MarkCompactCollector* collector_;
@@ -1930,7 +2066,8 @@ int MarkCompactCollector::DiscoverAndEvacuateBlackObjectsOnPage(
       int size = object->Size();
       survivors_size += size;
 
-      Heap::UpdateAllocationSiteFeedback(object, Heap::RECORD_SCRATCHPAD_SLOT);
+      heap()->UpdateAllocationSite(object->map(), object,
+                                   &heap()->global_pretenuring_feedback_);
 
       offset += 2;
       current_cell >>= 2;
@@ -2033,6 +2170,11 @@ void MarkCompactCollector::MarkRoots(RootMarkingVisitor* visitor) {
   // etc., and all objects reachable from them.
   heap()->IterateStrongRoots(visitor, VISIT_ONLY_STRONG);
 
+  // With parallel marking the root visitor has accumulated the grey objects
+  // on the marking deque instead of tracing through them; drain the deque
+  // with the help of background marking tasks now.
+  if (UseParallelMarking()) ProcessMarkingDequeInParallel();
+
   // Handle the string table specially.
   MarkStringTable(visitor);
 
@@ -2142,6 +2284,176 @@ void MarkCompactCollector::ProcessMarkingDeque() {
 }
 
 
+static const int kMarkingStealBatchSize = 32;
+static const int kLocalMarkingStackLimit = 1024;
+
+
+// Returns true if objects of the given map can be visited by a parallel
+// marking task. The visitors for the remaining types mutate global state
+// (weak lists, code flushing candidates, transition arrays) and must run on
+// the main thread.
+static bool CanMarkInParallel(Map* map) {
+  InstanceType type = map->instance_type();
+  if (type < FIRST_NONSTRING_TYPE) return true;
+  switch (type) {
+    case HEAP_NUMBER_TYPE:
+    case BYTE_ARRAY_TYPE:
+    case FIXED_ARRAY_TYPE:
+    case FIXED_DOUBLE_ARRAY_TYPE:
+    case JS_OBJECT_TYPE:
+    case JS_ARRAY_TYPE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// Visitor used by parallel marking tasks. Newly discovered objects are
+// marked black immediately and pushed on the task-local marking stack.
+class ParallelMarkingVisitor : public ObjectVisitor {
+ public:
+  explicit ParallelMarkingVisitor(List<HeapObject*>* local_stack)
+      : local_stack_(local_stack) {}
+
+  void VisitPointer(Object** p) { MarkObjectByPointer(p); }
+
+  void VisitPointers(Object** start, Object** end) {
+    for (Object** p = start; p < end; p++) MarkObjectByPointer(p);
+  }
+
+ private:
+  void MarkObjectByPointer(Object** p) {
+    if (!(*p)->IsHeapObject()) return;
+    HeapObject* object = HeapObject::cast(*p);
+    MarkBit mark_bit = Marking::MarkBitFrom(object);
+    if (!Marking::WhiteToBlackAtomic(mark_bit)) return;
+    MemoryChunk::FromAddress(object->address())
+        ->IncrementLiveBytesAtomic(object->Size());
+    local_stack_->Add(object);
+  }
+
+  List<HeapObject*>* local_stack_;
+};
+
+
+bool MarkCompactCollector::UseParallelMarking() {
+  // Object stats tracking hooks into the marking visitors and is not thread
+  // safe; incremental marking may leave grey objects on the deque, which
+  // parallel tasks do not handle.
+  return FLAG_parallel_marking && FLAG_marking_tasks > 0 &&
+         !FLAG_track_gc_object_stats && !was_marked_incrementally_;
+}
+
+
+void MarkCompactCollector::RunMarkingTask() {
+  List<HeapObject*> local_stack(kLocalMarkingStackLimit);
+  ParallelMarkingVisitor visitor(&local_stack);
+  HeapObject* buffer[kMarkingStealBatchSize];
+  for (;;) {
+    int stolen = StealMarkingWork(buffer, kMarkingStealBatchSize);
+    if (stolen == 0) {
+      // No work in the shared pool. If no other task holds local work that
+      // it could still publish, the parallel phase is over.
+      if (base::NoBarrier_Load(&marking_tasks_working_) == 0) return;
+      base::OS::Sleep(base::TimeDelta::FromMilliseconds(1));
+      continue;
+    }
+    base::NoBarrier_AtomicIncrement(&marking_tasks_working_, 1);
+    for (int i = 0; i < stolen; i++) local_stack.Add(buffer[i]);
+    while (!local_stack.is_empty()) {
+      HeapObject* object = local_stack.RemoveLast();
+      Map* map = object->map();
+      // Maps are always visited on the main thread.
+      MarkBit map_mark = Marking::MarkBitFrom(map);
+      if (Marking::WhiteToBlackAtomic(map_mark)) {
+        MemoryChunk::FromAddress(map->address())
+            ->IncrementLiveBytesAtomic(map->Size());
+        DeferToMainThreadMarking(map);
+      }
+      if (!CanMarkInParallel(map)) {
+        DeferToMainThreadMarking(object);
+        continue;
+      }
+      object->IterateBody(map->instance_type(), object->SizeFromMap(map),
+                          &visitor);
+      if (local_stack.length() >= kLocalMarkingStackLimit) {
+        // Publish the upper half of the local stack so that idle tasks can
+        // steal it.
+        int count = local_stack.length() / 2;
+        PublishMarkingWork(&local_stack[local_stack.length() - count], count);
+        local_stack.Rewind(local_stack.length() - count);
+      }
+    }
+    base::NoBarrier_AtomicIncrement(&marking_tasks_working_, -1);
+  }
+}
+
+
+int MarkCompactCollector::StealMarkingWork(HeapObject** buffer,
+                                           int max_count) {
+  base::LockGuard<base::SpinLock> guard(&parallel_marking_lock_);
+  int count = Min(max_count, shared_marking_pool_.length());
+  for (int i = 0; i < count; i++) {
+    buffer[i] = shared_marking_pool_.RemoveLast();
+  }
+  return count;
+}
+
+
+void MarkCompactCollector::PublishMarkingWork(HeapObject** buffer, int count) {
+  base::LockGuard<base::SpinLock> guard(&parallel_marking_lock_);
+  for (int i = 0; i < count; i++) {
+    shared_marking_pool_.Add(buffer[i]);
+  }
+}
+
+
+void MarkCompactCollector::DeferToMainThreadMarking(HeapObject* object) {
+  base::LockGuard<base::SpinLock> guard(&parallel_marking_lock_);
+  deferred_marking_objects_.Add(object);
+}
+
+
+void MarkCompactCollector::FlushDeferredMarkingObjects() {
+  for (int i = 0; i < deferred_marking_objects_.length(); i++) {
+    // PushBlack handles deque overflow by reverting the object to grey; the
+    // caller's ProcessMarkingDeque rediscovers it during the refill scan.
+    marking_deque_.PushBlack(deferred_marking_objects_[i]);
+  }
+  deferred_marking_objects_.Rewind(0);
+}
+
+
+void MarkCompactCollector::ProcessMarkingDequeInParallel() {
+  DCHECK(shared_marking_pool_.is_empty());
+  DCHECK(deferred_marking_objects_.is_empty());
+
+  // Seed the shared pool from the marking deque. All objects on the deque
+  // are already marked black.
+  while (!marking_deque_.IsEmpty()) {
+    shared_marking_pool_.Add(marking_deque_.Pop());
+  }
+
+  base::NoBarrier_Store(&marking_tasks_working_, 0);
+  int num_tasks = FLAG_marking_tasks;
+  for (int i = 1; i < num_tasks; i++) {
+    V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        new MarkingTask(heap()), v8::Platform::kShortRunningTask);
+  }
+  // The main thread participates as well.
+  RunMarkingTask();
+  for (int i = 1; i < num_tasks; i++) {
+    pending_marking_tasks_semaphore_.Wait();
+  }
+
+  // Visit the objects the parallel tasks could not handle and finish the
+  // transitive closure sequentially.
+  FlushDeferredMarkingObjects();
+  ProcessMarkingDeque();
+}
+
+
 // Mark all objects reachable (transitively) from objects on the marking
 // stack including references only considered in the atomic marking pause.
 void MarkCompactCollector::ProcessEphemeralMarking(
@@ -2156,7 +2468,13 @@ void MarkCompactCollector::ProcessEphemeralMarking(
     }
     ProcessWeakCollections();
     work_to_do = !marking_deque_.IsEmpty();
-    ProcessMarkingDeque();
+    // Large weak maps can release a lot of newly reachable values at once;
+    // drain them with the parallel marking tasks when enabled.
+    if (UseParallelMarking()) {
+      ProcessMarkingDequeInParallel();
+    } else {
+      ProcessMarkingDeque();
+    }
   }
 }
 
@@ -2636,6 +2954,10 @@ void MarkCompactCollector::TrimEnumCache(Map* map,
 
   FixedArray* enum_cache = descriptors->GetEnumCache();
 
+  // A copy-on-write enum cache may be aliased as the elements of arrays
+  // handed out by Object.keys, so it cannot be trimmed in place.
+  if (enum_cache->map() == heap_->fixed_cow_array_map()) return;
+
   int to_trim = enum_cache->length() - live_enum;
   if (to_trim <= 0) return;
   heap_->RightTrimFixedArray<Heap::SEQUENTIAL_TO_SWEEPER>(
@@ -2651,28 +2973,54 @@ void MarkCompactCollector::TrimEnumCache(Map* map,
 void MarkCompactCollector::ProcessWeakCollections() {
   GCTracer::Scope gc_scope(heap()->tracer(),
                            GCTracer::Scope::MC_WEAKCOLLECTION_PROCESS);
+  // Scan tables that were encountered since the previous fixpoint
+  // iteration.  Entries with a marked key have their value marked right
+  // away; the rest are queued as pending ephemerons.
   Object* weak_collection_obj = heap()->encountered_weak_collections();
-  while (weak_collection_obj != Smi::FromInt(0)) {
+  while (weak_collection_obj != scanned_weak_collections_) {
     JSWeakCollection* weak_collection =
         reinterpret_cast<JSWeakCollection*>(weak_collection_obj);
     DCHECK(MarkCompactCollector::IsMarked(weak_collection));
     if (weak_collection->table()->IsHashTable()) {
       ObjectHashTable* table = ObjectHashTable::cast(weak_collection->table());
-      Object** anchor = reinterpret_cast<Object**>(table->address());
       for (int i = 0; i < table->Capacity(); i++) {
         if (MarkCompactCollector::IsMarked(HeapObject::cast(table->KeyAt(i)))) {
-          Object** key_slot =
-              table->RawFieldOfElementAt(ObjectHashTable::EntryToIndex(i));
-          RecordSlot(anchor, key_slot, *key_slot);
-          Object** value_slot =
-              table->RawFieldOfElementAt(ObjectHashTable::EntryToValueIndex(i));
-          MarkCompactMarkingVisitor::MarkObjectByPointer(this, anchor,
-                                                         value_slot);
+          MarkPendingEphemeron(table, i);
+        } else {
+          PendingEphemeron pending = {table, i};
+          pending_ephemerons_.Add(pending);
         }
       }
     }
     weak_collection_obj = weak_collection->next();
   }
+  scanned_weak_collections_ = heap()->encountered_weak_collections();
+
+  // Revisit only the unresolved entries; an entry is resolved at most once,
+  // when its key has been marked since the last iteration.
+  int unresolved = 0;
+  for (int i = 0; i < pending_ephemerons_.length(); i++) {
+    PendingEphemeron& pending = pending_ephemerons_[i];
+    if (MarkCompactCollector::IsMarked(
+            HeapObject::cast(pending.table->KeyAt(pending.entry)))) {
+      MarkPendingEphemeron(pending.table, pending.entry);
+    } else {
+      pending_ephemerons_[unresolved++] = pending;
+    }
+  }
+  pending_ephemerons_.Rewind(unresolved);
+}
+
+
+void MarkCompactCollector::MarkPendingEphemeron(ObjectHashTable* table,
+                                                int entry) {
+  Object** anchor = reinterpret_cast<Object**>(table->address());
+  Object** key_slot =
+      table->RawFieldOfElementAt(ObjectHashTable::EntryToIndex(entry));
+  RecordSlot(anchor, key_slot, *key_slot);
+  Object** value_slot =
+      table->RawFieldOfElementAt(ObjectHashTable::EntryToValueIndex(entry));
+  MarkCompactMarkingVisitor::MarkObjectByPointer(this, anchor, value_slot);
 }
 
 
@@ -2697,6 +3045,8 @@ void MarkCompactCollector::ClearWeakCollections() {
     weak_collection->set_next(heap()->undefined_value());
   }
   heap()->set_encountered_weak_collections(Smi::FromInt(0));
+  scanned_weak_collections_ = Smi::FromInt(0);
+  pending_ephemerons_.Rewind(0);
 }
 
 
@@ -2711,6 +3061,8 @@ void MarkCompactCollector::AbortWeakCollections() {
     weak_collection->set_next(heap()->undefined_value());
   }
   heap()->set_encountered_weak_collections(Smi::FromInt(0));
+  scanned_weak_collections_ = Smi::FromInt(0);
+  pending_ephemerons_.Rewind(0);
 }
 
 
@@ -2768,11 +3120,19 @@ void MarkCompactCollector::AbortWeakCells() {
 }
 
 
-void MarkCompactCollector::RecordMigratedSlot(Object* value, Address slot) {
+void MarkCompactCollector::RecordMigratedSlot(
+    Object* value, Address slot, SlotsBuffer** evacuation_slots_buffer,
+    List<Address>* new_space_slots) {
   if (heap_->InNewSpace(value)) {
-    heap_->store_buffer()->Mark(slot);
+    if (new_space_slots != NULL) {
+      // The store buffer is not thread safe; the slot is replayed into it
+      // on the main thread when the compaction task publishes its results.
+      new_space_slots->Add(slot);
+    } else {
+      heap_->store_buffer()->Mark(slot);
+    }
   } else if (value->IsHeapObject() && IsOnEvacuationCandidate(value)) {
-    SlotsBuffer::AddTo(&slots_buffer_allocator_, &migration_slots_buffer_,
+    SlotsBuffer::AddTo(&slots_buffer_allocator_, evacuation_slots_buffer,
                        reinterpret_cast<Object**>(slot),
                        SlotsBuffer::IGNORE_OVERFLOW);
   }
@@ -2795,6 +3155,13 @@ void MarkCompactCollector::RecordMigratedSlot(Object* value, Address slot) {
 // pointers to new space.
 void MarkCompactCollector::MigrateObject(HeapObject* dst, HeapObject* src,
                                          int size, AllocationSpace dest) {
+  MigrateObject(dst, src, size, dest, &migration_slots_buffer_, NULL);
+}
+
+
+void MarkCompactCollector::MigrateObject(
+    HeapObject* dst, HeapObject* src, int size, AllocationSpace dest,
+    SlotsBuffer** evacuation_slots_buffer, List<Address>* new_space_slots) {
   Address dst_addr = dst->address();
   Address src_addr = src->address();
   DCHECK(heap()->AllowedToBeMigrated(src, dest));
@@ -2822,7 +3189,8 @@ void MarkCompactCollector::MigrateObject(HeapObject* dst, HeapObject* src,
       if (!may_contain_raw_values)
 #endif
       {
-        RecordMigratedSlot(value, dst_slot);
+        RecordMigratedSlot(value, dst_slot, evacuation_slots_buffer,
+                           new_space_slots);
       }
 
       src_slot += kPointerSize;
@@ -2834,7 +3202,7 @@ void MarkCompactCollector::MigrateObject(HeapObject* dst, HeapObject* src,
       Address code_entry = Memory::Address_at(code_entry_slot);
 
       if (Page::FromAddress(code_entry)->IsEvacuationCandidate()) {
-        SlotsBuffer::AddTo(&slots_buffer_allocator_, &migration_slots_buffer_,
+        SlotsBuffer::AddTo(&slots_buffer_allocator_, evacuation_slots_buffer,
                            SlotsBuffer::CODE_ENTRY_SLOT, code_entry_slot,
                            SlotsBuffer::IGNORE_OVERFLOW);
       }
@@ -2850,7 +3218,7 @@ void MarkCompactCollector::MigrateObject(HeapObject* dst, HeapObject* src,
         Address code_entry = Memory::Address_at(code_entry_slot);
 
         if (Page::FromAddress(code_entry)->IsEvacuationCandidate()) {
-          SlotsBuffer::AddTo(&slots_buffer_allocator_, &migration_slots_buffer_,
+          SlotsBuffer::AddTo(&slots_buffer_allocator_, evacuation_slots_buffer,
                              SlotsBuffer::CODE_ENTRY_SLOT, code_entry_slot,
                              SlotsBuffer::IGNORE_OVERFLOW);
         }
@@ -2860,13 +3228,14 @@ void MarkCompactCollector::MigrateObject(HeapObject* dst, HeapObject* src,
         Address heap_slot =
             dst_addr + array->OffsetOfElementAt(heap_iter.next_index());
         Object* value = Memory::Object_at(heap_slot);
-        RecordMigratedSlot(value, heap_slot);
+        RecordMigratedSlot(value, heap_slot, evacuation_slots_buffer,
+                           new_space_slots);
       }
     }
   } else if (dest == CODE_SPACE) {
     PROFILE(isolate(), CodeMoveEvent(src_addr, dst_addr));
     heap()->MoveBlock(dst_addr, src_addr, size);
-    SlotsBuffer::AddTo(&slots_buffer_allocator_, &migration_slots_buffer_,
+    SlotsBuffer::AddTo(&slots_buffer_allocator_, evacuation_slots_buffer,
                        SlotsBuffer::RELOCATED_CODE_OBJECT, dst_addr,
                        SlotsBuffer::IGNORE_OVERFLOW);
     Code::cast(dst)->Relocate(dst_addr - src_addr);
@@ -3110,6 +3479,11 @@ bool MarkCompactCollector::TryPromoteObject(HeapObject* object,
   AllocationResult allocation = old_space->AllocateRaw(object_size, alignment);
   if (allocation.To(&target)) {
     MigrateObject(target, object, object_size, old_space->identity());
+    // Promoted ArrayBuffers must leave the set of buffers that scavenges
+    // look at.
+    if (V8_UNLIKELY(target->IsJSArrayBuffer())) {
+      heap()->PromoteArrayBuffer(target);
+    }
     heap()->IncrementPromotedObjectsSize(object_size);
     return true;
   }
@@ -3310,8 +3684,16 @@ void MarkCompactCollector::EvacuateNewSpace() {
 
 
 void MarkCompactCollector::EvacuateLiveObjectsFromPage(Page* p) {
+  EvacuateLiveObjectsFromPage(p, static_cast<PagedSpace*>(p->owner()),
+                              &migration_slots_buffer_, NULL);
+}
+
+
+void MarkCompactCollector::EvacuateLiveObjectsFromPage(
+    Page* p, PagedSpace* target_space, SlotsBuffer** evacuation_slots_buffer,
+    List<Address>* new_space_slots) {
   AlwaysAllocateScope always_allocate(isolate());
-  PagedSpace* space = static_cast<PagedSpace*>(p->owner());
+  PagedSpace* space = target_space;
   DCHECK(p->IsEvacuationCandidate() && !p->WasSwept());
   p->SetWasSwept();
 
@@ -3336,8 +3718,9 @@ void MarkCompactCollector::EvacuateLiveObjectsFromPage(Page* p) {
                                           : kWordAligned;
       HeapObject* target_object;
       AllocationResult allocation = space->AllocateRaw(size, alignment);
-      if (!allocation.To(&target_object)) {
+      if (!allocation.To(&target_object) && space == p->owner()) {
         // If allocation failed, use emergency memory and re-try allocation.
+        // Compaction spaces have no emergency memory; they can only expand.
         CHECK(space->HasEmergencyMemory());
         space->UseEmergencyMemory();
         allocation = space->AllocateRaw(size, alignment);
@@ -3348,7 +3731,8 @@ void MarkCompactCollector::EvacuateLiveObjectsFromPage(Page* p) {
         return;
       }
 
-      MigrateObject(target_object, object, size, space->identity());
+      MigrateObject(target_object, object, size, space->identity(),
+                    evacuation_slots_buffer, new_space_slots);
       DCHECK(object->map_word().IsForwardingAddress());
     }
 
@@ -3359,7 +3743,112 @@ void MarkCompactCollector::EvacuateLiveObjectsFromPage(Page* p) {
 }
 
 
+bool MarkCompactCollector::UseParallelCompaction() {
+  // The object-move events emitted while migrating objects are not thread
+  // safe, so parallel compaction is disabled while they are observed.
+  return FLAG_parallel_compaction && FLAG_compaction_tasks > 0 &&
+         !heap()->isolate()->heap_profiler()->is_tracking_object_moves() &&
+         !isolate()->logger()->is_logging_code_events() &&
+         !FLAG_verify_predictable;
+}
+
+
+void MarkCompactCollector::RunCompactionTask() {
+  CompactionSpace compaction_space(heap(), heap()->MaxOldGenerationSize(),
+                                   OLD_SPACE, NOT_EXECUTABLE);
+  SlotsBuffer* evacuation_slots_buffer = NULL;
+  List<Address> new_space_slots;
+
+  int npages = evacuation_candidates_.length();
+  for (;;) {
+    int i =
+        base::NoBarrier_AtomicIncrement(&next_evacuation_candidate_, 1) - 1;
+    if (i >= npages) break;
+    Page* p = evacuation_candidates_[i];
+    if (!p->IsEvacuationCandidate()) continue;
+    // Candidate pages of other spaces were already evacuated on the main
+    // thread.
+    if (p->owner()->identity() != OLD_SPACE) continue;
+    EvacuateLiveObjectsFromPage(p, &compaction_space,
+                                &evacuation_slots_buffer, &new_space_slots);
+  }
+
+  // Publish the task results back to the heap.
+  base::LockGuard<base::Mutex> guard(&parallel_compaction_mutex_);
+  heap()->old_space()->MergeCompactionSpace(&compaction_space);
+  SlotsBuffer::PrependChain(&migration_slots_buffer_,
+                            evacuation_slots_buffer);
+  for (int i = 0; i < new_space_slots.length(); i++) {
+    heap()->store_buffer()->Mark(new_space_slots[i]);
+  }
+}
+
+
+void MarkCompactCollector::EvacuatePagesInParallel() {
+  int npages = evacuation_candidates_.length();
+  if (npages == 0) return;
+
+  // Candidate pages of spaces other than old space are rare; evacuate them
+  // on the main thread using the sequential path.
+  for (int i = 0; i < npages; i++) {
+    Page* p = evacuation_candidates_[i];
+    if (!p->IsEvacuationCandidate()) continue;
+    PagedSpace* space = static_cast<PagedSpace*>(p->owner());
+    if (space->identity() == OLD_SPACE) continue;
+    if (!space->HasEmergencyMemory()) {
+      space->CreateEmergencyMemory();  // If the OS lets us.
+    }
+    if (space->HasEmergencyMemory()) {
+      EvacuateLiveObjectsFromPage(p);
+      p->Unlink();
+    } else {
+      // Without room for expansion evacuation is not guaranteed to succeed.
+      slots_buffer_allocator_.DeallocateChain(p->slots_buffer_address());
+      p->ClearEvacuationCandidate();
+      p->SetFlag(Page::RESCAN_ON_EVACUATION);
+    }
+  }
+
+  base::NoBarrier_Store(&next_evacuation_candidate_, 0);
+  int num_tasks = Min(FLAG_compaction_tasks, npages);
+  for (int i = 1; i < num_tasks; i++) {
+    V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        new CompactionTask(heap()), v8::Platform::kShortRunningTask);
+  }
+  // The main thread evacuates pages as well.
+  RunCompactionTask();
+  for (int i = 1; i < num_tasks; i++) {
+    pending_compaction_tasks_semaphore_.Wait();
+  }
+
+  // Unlink the evacuated pages from their space so that they are not
+  // iterated later (e.g. when scan on scavenge pages are processed). The
+  // pages themselves stay reachable from the evacuation candidates list and
+  // are freed later.
+  for (int i = 0; i < npages; i++) {
+    Page* p = evacuation_candidates_[i];
+    if (p->IsEvacuationCandidate() && p->owner()->identity() == OLD_SPACE) {
+      p->Unlink();
+    }
+  }
+
+  // Release emergency memory possibly allocated for the sequential part.
+  PagedSpaces spaces(heap());
+  for (PagedSpace* space = spaces.next(); space != NULL;
+       space = spaces.next()) {
+    if (space->HasEmergencyMemory()) {
+      space->FreeEmergencyMemory();
+    }
+  }
+}
+
+
 void MarkCompactCollector::EvacuatePages() {
+  if (UseParallelCompaction()) {
+    EvacuatePagesInParallel();
+    return;
+  }
+
   int npages = evacuation_candidates_.length();
   int abandoned_pages = 0;
   for (int i = 0; i < npages; i++) {
@@ -4304,10 +4793,28 @@ int MarkCompactCollector::SweepInParallel(PagedSpace* space,
 int MarkCompactCollector::SweepInParallel(Page* page, PagedSpace* space) {
   int max_freed = 0;
   if (page->TryParallelSweeping()) {
-    FreeList* free_list = free_list_old_space_.get();
+    FreeList* free_list;
+    if (space == heap()->code_space()) {
+      free_list = free_list_code_space_.get();
+    } else if (space == heap()->map_space()) {
+      free_list = free_list_map_space_.get();
+    } else {
+      free_list = free_list_old_space_.get();
+    }
     FreeList private_free_list(space);
-    max_freed = Sweep<SWEEP_ONLY, SWEEP_IN_PARALLEL, IGNORE_SKIP_LIST,
-                      IGNORE_FREE_SPACE>(space, &private_free_list, page, NULL);
+    if (space->identity() == CODE_SPACE && FLAG_zap_code_space) {
+      max_freed =
+          Sweep<SWEEP_ONLY, SWEEP_IN_PARALLEL, REBUILD_SKIP_LIST,
+                ZAP_FREE_SPACE>(space, &private_free_list, page, NULL);
+    } else if (space->identity() == CODE_SPACE) {
+      max_freed =
+          Sweep<SWEEP_ONLY, SWEEP_IN_PARALLEL, REBUILD_SKIP_LIST,
+                IGNORE_FREE_SPACE>(space, &private_free_list, page, NULL);
+    } else {
+      max_freed =
+          Sweep<SWEEP_ONLY, SWEEP_IN_PARALLEL, IGNORE_SKIP_LIST,
+                IGNORE_FREE_SPACE>(space, &private_free_list, page, NULL);
+    }
     free_list->Concatenate(&private_free_list);
   }
   return max_freed;
@@ -4364,8 +4871,16 @@ void MarkCompactCollector::SweepSpace(PagedSpace* space, SweeperType sweeper) {
             PrintF("Sweeping 0x%" V8PRIxPTR ".\n",
                    reinterpret_cast<intptr_t>(p));
           }
-          Sweep<SWEEP_ONLY, SWEEP_ON_MAIN_THREAD, IGNORE_SKIP_LIST,
-                IGNORE_FREE_SPACE>(space, NULL, p, NULL);
+          if (space->identity() == CODE_SPACE && FLAG_zap_code_space) {
+            Sweep<SWEEP_ONLY, SWEEP_ON_MAIN_THREAD, REBUILD_SKIP_LIST,
+                  ZAP_FREE_SPACE>(space, NULL, p, NULL);
+          } else if (space->identity() == CODE_SPACE) {
+            Sweep<SWEEP_ONLY, SWEEP_ON_MAIN_THREAD, REBUILD_SKIP_LIST,
+                  IGNORE_FREE_SPACE>(space, NULL, p, NULL);
+          } else {
+            Sweep<SWEEP_ONLY, SWEEP_ON_MAIN_THREAD, IGNORE_SKIP_LIST,
+                  IGNORE_FREE_SPACE>(space, NULL, p, NULL);
+          }
           pages_swept++;
           parallel_sweeping_active = true;
         } else {
@@ -4419,7 +4934,7 @@ void MarkCompactCollector::SweepSpaces() {
 #ifdef DEBUG
   state_ = SWEEP_SPACES;
 #endif
-  heap()->FreeDeadArrayBuffers();
+  heap()->FreeDeadArrayBuffers(false);
 
   MoveEvacuationCandidatesToEndOfPagesList();
 
@@ -4442,7 +4957,16 @@ void MarkCompactCollector::SweepSpaces() {
   {
     GCTracer::Scope sweep_scope(heap()->tracer(),
                                 GCTracer::Scope::MC_SWEEP_CODE);
-    SweepSpace(heap()->code_space(), SEQUENTIAL_SWEEPING);
+    // Slots filtering for invalidated code reads code-space mark bits during
+    // evacuation, so the code space may only be swept concurrently when no
+    // invalidated code is left.
+    if (heap()->concurrent_sweeping_enabled() &&
+        invalidated_code_.is_empty()) {
+      SweepSpace(heap()->code_space(), CONCURRENT_SWEEPING);
+      StartSweeperThread(heap()->code_space());
+    } else {
+      SweepSpace(heap()->code_space(), SEQUENTIAL_SWEEPING);
+    }
   }
 
   EvacuateNewSpaceAndCandidates();
@@ -4453,7 +4977,12 @@ void MarkCompactCollector::SweepSpaces() {
   {
     GCTracer::Scope sweep_scope(heap()->tracer(),
                                 GCTracer::Scope::MC_SWEEP_MAP);
-    SweepSpace(heap()->map_space(), SEQUENTIAL_SWEEPING);
+    if (heap()->concurrent_sweeping_enabled()) {
+      SweepSpace(heap()->map_space(), CONCURRENT_SWEEPING);
+      StartSweeperThread(heap()->map_space());
+    } else {
+      SweepSpace(heap()->map_space(), SEQUENTIAL_SWEEPING);
+    }
   }
 
   // Deallocate unmarked objects and clear marked bits for marked objects.
@@ -4494,6 +5023,8 @@ void MarkCompactCollector::ParallelSweepSpaceComplete(PagedSpace* space) {
 
 void MarkCompactCollector::ParallelSweepSpacesComplete() {
   ParallelSweepSpaceComplete(heap()->old_space());
+  ParallelSweepSpaceComplete(heap()->code_space());
+  ParallelSweepSpaceComplete(heap()->map_space());
 }
 
 
@@ -102,11 +102,40 @@ class Marking {
     markbit.Set();
   }
 
+  // Atomically transitions an object from white to black. Returns true if
+  // the calling thread performed the transition. Parallel marking tasks
+  // only ever mark objects black, never grey.
+  INLINE(static bool WhiteToBlackAtomic(MarkBit markbit)) {
+    return markbit.SetAtomic();
+  }
+
   INLINE(static void GreyToBlack(MarkBit markbit)) {
     DCHECK(IsGrey(markbit));
     markbit.Next().Clear();
   }
 
+  // Atomically transitions an object from white to grey. Returns true if
+  // the calling thread performed the transition, i.e. the object should
+  // be pushed on a marking worklist by the caller.
+  INLINE(static bool WhiteToGreyAtomic(MarkBit markbit)) {
+    if (!markbit.SetAtomic()) return false;
+    markbit.Next().SetAtomic();
+    return true;
+  }
+
+  // Atomically transitions an object from grey to black. Returns true if
+  // the calling thread performed the transition.
+  INLINE(static bool GreyToBlackAtomic(MarkBit markbit)) {
+    return markbit.Next().ClearAtomic();
+  }
+
+  // Atomic counterpart of BlackToGrey, used while a concurrent marking
+  // task may be modifying other mark bits in the same bitmap cell.
+  INLINE(static void BlackToGreyAtomic(MarkBit markbit)) {
+    DCHECK(IsBlack(markbit));
+    markbit.Next().SetAtomic();
+  }
+
   INLINE(static void BlackToGrey(HeapObject* obj)) {
     BlackToGrey(MarkBitFrom(obj));
   }
@@ -397,6 +426,24 @@ class SlotsBuffer {
     return true;
   }
 
+  // Links the chain of buffers starting at |chain| in front of
+  // |*buffer_address| and restores the chain length invariant. Used to merge
+  // the slots recorded by a compaction task into the migration buffer.
+  static void PrependChain(SlotsBuffer** buffer_address, SlotsBuffer* chain) {
+    if (chain == NULL) return;
+    SlotsBuffer* old_head = *buffer_address;
+    SlotsBuffer* last = chain;
+    while (last->next_ != NULL) last = last->next_;
+    last->next_ = old_head;
+    int count = 0;
+    for (SlotsBuffer* b = chain; b != old_head; b = b->next_) count++;
+    int length = (old_head != NULL ? old_head->chain_length_ : 0) + count;
+    for (SlotsBuffer* b = chain; b != old_head; b = b->next_) {
+      b->chain_length_ = length--;
+    }
+    *buffer_address = chain;
+  }
+
   static bool IsTypedSlot(ObjectSlot slot);
 
   static bool AddTo(SlotsBufferAllocator* allocator,
@@ -440,7 +487,14 @@ class CodeFlusher {
       : isolate_(isolate),
         jsfunction_candidates_head_(NULL),
         shared_function_info_candidates_head_(NULL),
-        optimized_code_map_holder_head_(NULL) {}
+        optimized_code_map_holder_head_(NULL),
+        flush_budget_used_(0) {}
+
+  // Applies the embedder's code retention policy on top of the regular
+  // flushability checks: hot functions are exempted, code younger than the
+  // configured minimum wall-clock age is retained, and accepted candidates
+  // are charged against the per-cycle flush budget.
+  bool CanFlushCandidate(SharedFunctionInfo* shared_info);
 
   void AddCandidate(SharedFunctionInfo* shared_info) {
     if (GetNextCandidate(shared_info) == NULL) {
@@ -472,12 +526,14 @@ class CodeFlusher {
     ProcessOptimizedCodeMaps();
     ProcessSharedFunctionInfoCandidates();
     ProcessJSFunctionCandidates();
+    flush_budget_used_ = 0;
   }
 
   void EvictAllCandidates() {
     EvictOptimizedCodeMaps();
     EvictJSFunctionCandidates();
     EvictSharedFunctionInfoCandidates();
+    flush_budget_used_ = 0;
   }
 
   void IteratePointersToFromSpace(ObjectVisitor* v);
@@ -545,6 +601,7 @@ class CodeFlusher {
   JSFunction* jsfunction_candidates_head_;
   SharedFunctionInfo* shared_function_info_candidates_head_;
   SharedFunctionInfo* optimized_code_map_holder_head_;
+  size_t flush_budget_used_;
 
   DISALLOW_COPY_AND_ASSIGN(CodeFlusher);
 };
@@ -649,6 +706,14 @@ class MarkCompactCollector {
   void MigrateObject(HeapObject* dst, HeapObject* src, int size,
                      AllocationSpace to_old_space);
 
+  // Variant used by parallel compaction tasks: slots are recorded into the
+  // given local slots buffer, and pointers to new space are collected in
+  // new_space_slots instead of being marked in the store buffer directly.
+  void MigrateObject(HeapObject* dst, HeapObject* src, int size,
+                     AllocationSpace to_old_space,
+                     SlotsBuffer** evacuation_slots_buffer,
+                     List<Address>* new_space_slots);
+
   bool TryPromoteObject(HeapObject* object, int object_size);
 
   void InvalidateCode(Code* code);
@@ -717,6 +782,8 @@ class MarkCompactCollector {
   void VerifyIsSlotInLiveObject(Address slot, HeapObject* object);
 
  private:
+  class CompactionTask;
+  class MarkingTask;
   class SweeperTask;
 
   explicit MarkCompactCollector(Heap* heap);
@@ -732,6 +799,9 @@ class MarkCompactCollector {
 
   void StartSweeperThreads();
 
+  // Starts an additional concurrent sweeper task for the given space.
+  void StartSweeperThread(PagedSpace* space);
+
 #ifdef DEBUG
   enum CollectorState {
     IDLE,
@@ -764,8 +834,40 @@ class MarkCompactCollector {
   // True if concurrent or parallel sweeping is currently in progress.
   bool sweeping_in_progress_;
 
+  // Number of concurrent sweeper tasks started for the current sweeping
+  // cycle; each signals pending_sweeper_jobs_semaphore_ once.
+  int num_sweeping_tasks_;
+
   base::Semaphore pending_sweeper_jobs_semaphore_;
 
+  base::Semaphore pending_marking_tasks_semaphore_;
+
+  // Guards the shared marking pool and the deferred object list below. The
+  // critical sections move a handful of pointers, so waiters spin instead
+  // of taking a futex transition.
+  base::SpinLock parallel_marking_lock_;
+
+  // Objects available for stealing by any marking task.
+  List<HeapObject*> shared_marking_pool_;
+
+  // Black objects that must be visited on the main thread because their
+  // visitors have side effects that are not thread safe.
+  List<HeapObject*> deferred_marking_objects_;
+
+  // Number of marking tasks that currently hold local work.
+  base::Atomic32 marking_tasks_working_;
+
+  base::Semaphore pending_compaction_tasks_semaphore_;
+
+  // Guards publishing of compaction task results back to the heap: merging
+  // compaction spaces, concatenating slots buffers and replaying store
+  // buffer marks.
+  base::Mutex parallel_compaction_mutex_;
+
+  // Index of the next evacuation candidate to be claimed by a compaction
+  // task.
+  base::Atomic32 next_evacuation_candidate_;
+
   bool evacuation_;
 
   SlotsBufferAllocator slots_buffer_allocator_;
@@ -849,6 +951,32 @@ class MarkCompactCollector {
   // flag on the marking stack.
   void RefillMarkingDeque();
 
+  // Returns true if this collection should drain the marking deque with
+  // parallel marking tasks.
+  bool UseParallelMarking();
+
+  // Drains the marking deque with the help of background marking tasks.
+  // Objects whose visitors have side effects that are not thread safe are
+  // deferred back to the main thread, which finishes the transitive closure
+  // sequentially.
+  void ProcessMarkingDequeInParallel();
+
+  // Worker loop shared by the main thread and background marking tasks.
+  void RunMarkingTask();
+
+  // Moves up to max_count objects from the shared marking pool into buffer
+  // and returns the number of objects transferred.
+  int StealMarkingWork(HeapObject** buffer, int max_count);
+
+  // Makes locally discovered marking work available to other tasks.
+  void PublishMarkingWork(HeapObject** buffer, int count);
+
+  // Records a black object that must be visited on the main thread.
+  void DeferToMainThreadMarking(HeapObject* object);
+
+  // Pushes all deferred objects onto the marking deque.
+  void FlushDeferredMarkingObjects();
+
   // Callback function for telling whether the object *p is an unmarked
   // heap object.
   static bool IsUnmarkedHeapObject(Object** p);
@@ -866,9 +994,17 @@ class MarkCompactCollector {
 
   // Mark all values associated with reachable keys in weak collections
   // encountered so far.  This might push new object or even new weak maps onto
-  // the marking stack.
+  // the marking stack.  Tables are walked once when they are first
+  // encountered; entries whose key is still unmarked are queued on
+  // pending_ephemerons_ and only those entries are revisited on later
+  // fixpoint iterations, so the per-iteration cost is proportional to the
+  // number of unresolved entries rather than the total weak map size.
   void ProcessWeakCollections();
 
+  // Records the key slot and marks the value of a weak collection entry
+  // whose key has been marked.
+  void MarkPendingEphemeron(ObjectHashTable* table, int entry);
+
   // After all reachable objects have been marked those weak map entries
   // with an unreachable key are removed from all encountered weak maps.
   // The linked list of all encountered weak maps is destroyed.
@@ -905,8 +1041,27 @@ class MarkCompactCollector {
 
   void EvacuateLiveObjectsFromPage(Page* p);
 
+  // Variant used by parallel compaction tasks: objects are allocated in the
+  // given target space and slots are recorded into task-local buffers.
+  void EvacuateLiveObjectsFromPage(Page* p, PagedSpace* target_space,
+                                   SlotsBuffer** evacuation_slots_buffer,
+                                   List<Address>* new_space_slots);
+
   void EvacuatePages();
 
+  // Returns true if candidate pages should be evacuated by parallel
+  // compaction tasks.
+  bool UseParallelCompaction();
+
+  // Evacuates old-space candidate pages with parallel compaction tasks;
+  // candidate pages of other spaces are evacuated on the main thread.
+  void EvacuatePagesInParallel();
+
+  // Worker loop shared by the main thread and background compaction tasks.
+  // Claims candidate pages, evacuates them into a task-local compaction
+  // space and publishes the results back to the heap when done.
+  void RunCompactionTask();
+
   void EvacuateNewSpaceAndCandidates();
 
   void ReleaseEvacuationCandidates();
@@ -924,7 +1079,12 @@ class MarkCompactCollector {
   void ParallelSweepSpaceComplete(PagedSpace* space);
 
   // Updates store buffer and slot buffer for a pointer in a migrating object.
-  void RecordMigratedSlot(Object* value, Address slot);
+  // When new_space_slots is non-NULL, pointers to new space are collected
+  // there instead of being marked in the store buffer, which is not thread
+  // safe.
+  void RecordMigratedSlot(Object* value, Address slot,
+                          SlotsBuffer** evacuation_slots_buffer,
+                          List<Address>* new_space_slots);
 
 #ifdef DEBUG
   friend class MarkObjectVisitor;
@@ -934,6 +1094,22 @@ class MarkCompactCollector {
   static void UnmarkObject(HeapObject* obj);
 #endif
 
+  // A weak collection entry whose key was unmarked when its table was
+  // scanned during ephemeron marking.
+  struct PendingEphemeron {
+    ObjectHashTable* table;
+    int entry;
+  };
+
+  // Unresolved weak collection entries, revisited on each ephemeron
+  // fixpoint iteration until their key is marked or marking finishes.
+  // Table pointers stay valid because objects do not move while marking.
+  List<PendingEphemeron> pending_ephemerons_;
+
+  // Position in the encountered weak collections list up to which tables
+  // have already been scanned into pending_ephemerons_.
+  Object* scanned_weak_collections_;
+
   Heap* heap_;
   base::VirtualMemory* marking_deque_memory_;
   bool marking_deque_memory_committed_;
@@ -945,6 +1121,8 @@ class MarkCompactCollector {
   List<Code*> invalidated_code_;
 
   SmartPointer<FreeList> free_list_old_space_;
+  SmartPointer<FreeList> free_list_code_space_;
+  SmartPointer<FreeList> free_list_map_space_;
 
   friend class Heap;
 };
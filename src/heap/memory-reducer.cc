@@ -0,0 +1,190 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/memory-reducer.h"
+
+#include "src/flags.h"
+#include "src/heap/gc-tracer.h"
+#include "src/heap/heap.h"
+#include "src/heap/incremental-marking.h"
+#include "src/utils.h"
+#include "src/v8.h"
+
+namespace v8 {
+namespace internal {
+
+const int MemoryReducer::kLongDelayMs = 8000;
+const int MemoryReducer::kShortDelayMs = 500;
+const int MemoryReducer::kWatchdogDelayMs = 100000;
+const int MemoryReducer::kMaxNumberOfGCs = 3;
+
+
+void MemoryReducer::TimerTask::Run() {
+  Heap* heap = memory_reducer_->heap();
+  Event event;
+  event.type = kTimer;
+  event.time_ms = heap->MonotonicallyIncreasingTimeInMs();
+  // The allocation rate is low if the mutator allocated less than 1KB of new
+  // space per millisecond since the last GC, i.e. the heap looks idle.
+  const intptr_t kLowAllocationThroughputInBytesPerMs = 1000;
+  event.should_start_incremental_gc =
+      heap->tracer()->NewSpaceAllocationThroughputInBytesPerMillisecond() <
+      kLowAllocationThroughputInBytesPerMs;
+  event.can_start_incremental_gc =
+      heap->incremental_marking()->IsStopped() &&
+      heap->incremental_marking()->CanBeActivated();
+  memory_reducer_->NotifyTimer(event);
+}
+
+
+void MemoryReducer::NotifyTimer(const Event& event) {
+  DCHECK_EQ(kTimer, event.type);
+  // The timer task can still fire after the state machine was reset by a
+  // mark-compact or by TearDown.
+  if (state_.action == kDone) return;
+  state_ = Step(state_, event);
+  if (state_.action == kRun) {
+    DCHECK(FLAG_incremental_marking);
+    IncrementalMarking* marking = heap()->incremental_marking();
+    if (marking->IsStopped()) {
+      if (marking->CanBeActivated()) {
+        if (FLAG_trace_memory_reducer) {
+          PrintIsolate(heap()->isolate(), "Memory reducer: started GC #%d\n",
+                       state_.started_gcs);
+        }
+        marking->Start();
+      } else {
+        // The incremental GC was aborted; go back to waiting.
+        state_ = State(kWait, state_.started_gcs,
+                       event.time_ms + kLongDelayMs, state_.last_gc_time_ms);
+      }
+    } else {
+      // Make progress with the incremental GC even if the embedder never
+      // sends idle notifications.
+      const intptr_t kStepSizeInBytes = 1 * MB;
+      marking->Step(kStepSizeInBytes, IncrementalMarking::NO_GC_VIA_STACK_GUARD);
+      if (FLAG_overapproximate_weak_closure &&
+          marking->IsReadyToOverApproximateWeakClosure()) {
+        heap()->OverApproximateWeakClosure(
+            "memory reducer: overapproximate weak closure");
+      } else if (marking->IsComplete()) {
+        // Finalizing triggers a mark-compact event which advances the state
+        // machine and schedules the next timer.
+        heap()->CollectAllGarbage(Heap::kReduceMemoryFootprintMask,
+                                  "memory reducer: finalize incremental");
+      }
+    }
+  }
+  if (state_.action == kRun) {
+    // Check the marking progress again soon.
+    const int kIncrementalMarkingDelayMs = 500;
+    ScheduleTimer(kIncrementalMarkingDelayMs);
+  } else if (state_.action == kWait) {
+    ScheduleTimer(state_.next_gc_start_ms - event.time_ms);
+    if (FLAG_trace_memory_reducer) {
+      PrintIsolate(heap()->isolate(), "Memory reducer: waiting for %.f ms\n",
+                   state_.next_gc_start_ms - event.time_ms);
+    }
+  }
+}
+
+
+void MemoryReducer::NotifyMarkCompact(const Event& event) {
+  DCHECK_EQ(kMarkCompact, event.type);
+  Action old_action = state_.action;
+  state_ = Step(state_, event);
+  if (old_action != kWait && state_.action == kWait) {
+    ScheduleTimer(state_.next_gc_start_ms - event.time_ms);
+  }
+  if (old_action == kRun && FLAG_trace_memory_reducer) {
+    PrintIsolate(heap()->isolate(), "Memory reducer: finished GC #%d (%s)\n",
+                 state_.started_gcs,
+                 state_.action == kWait ? "will do more" : "done");
+  }
+}
+
+
+void MemoryReducer::NotifyContextDisposed(const Event& event) {
+  DCHECK_EQ(kContextDisposed, event.type);
+  Action old_action = state_.action;
+  state_ = Step(state_, event);
+  if (old_action != kWait && state_.action == kWait) {
+    ScheduleTimer(state_.next_gc_start_ms - event.time_ms);
+  }
+}
+
+
+MemoryReducer::State MemoryReducer::Step(const State& state,
+                                         const Event& event) {
+  if (!FLAG_incremental_marking || !FLAG_memory_reducer) {
+    return State(kDone, 0, 0, state.last_gc_time_ms);
+  }
+  switch (state.action) {
+    case kDone:
+      if (event.type == kTimer) {
+        return state;
+      } else {
+        DCHECK(event.type == kContextDisposed || event.type == kMarkCompact);
+        return State(kWait, 0, event.time_ms + kLongDelayMs,
+                     event.type == kMarkCompact ? event.time_ms
+                                                : state.last_gc_time_ms);
+      }
+    case kWait:
+      switch (event.type) {
+        case kContextDisposed:
+          return state;
+        case kTimer:
+          if (state.started_gcs >= kMaxNumberOfGCs) {
+            return State(kDone, 0, 0, state.last_gc_time_ms);
+          } else if (event.can_start_incremental_gc &&
+                     (event.should_start_incremental_gc ||
+                      WatchdogGC(state, event))) {
+            if (state.next_gc_start_ms <= event.time_ms) {
+              return State(kRun, state.started_gcs + 1, 0,
+                           state.last_gc_time_ms);
+            } else {
+              return state;
+            }
+          } else {
+            return State(kWait, state.started_gcs,
+                         event.time_ms + kLongDelayMs, state.last_gc_time_ms);
+          }
+        case kMarkCompact:
+          return State(kWait, state.started_gcs,
+                       event.time_ms + kLongDelayMs, event.time_ms);
+      }
+      UNREACHABLE();
+      break;
+    case kRun:
+      if (event.type != kMarkCompact) {
+        return state;
+      } else {
+        if (state.started_gcs < kMaxNumberOfGCs &&
+            (event.next_gc_likely_to_collect_more ||
+             state.started_gcs == 1)) {
+          return State(kWait, state.started_gcs,
+                       event.time_ms + kShortDelayMs, event.time_ms);
+        } else {
+          return State(kDone, 0, 0, event.time_ms);
+        }
+      }
+  }
+  UNREACHABLE();
+  return State(kDone, 0, 0, 0);  // Make the compiler happy.
+}
+
+
+void MemoryReducer::ScheduleTimer(double delay_ms) {
+  DCHECK(delay_ms > 0);
+  // Leave some room for precision error in the task scheduler.
+  const double kSlackMs = 100;
+  v8::Isolate* isolate = reinterpret_cast<v8::Isolate*>(heap()->isolate());
+  V8::GetCurrentPlatform()->CallDelayedOnForegroundThread(
+      isolate, new TimerTask(this), (delay_ms + kSlackMs) / 1000.0);
+}
+
+
+void MemoryReducer::TearDown() { state_ = State(kDone, 0, 0, 0); }
+}
+}  // namespace v8::internal
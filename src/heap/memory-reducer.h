@@ -0,0 +1,114 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_MEMORY_REDUCER_H_
+#define V8_HEAP_MEMORY_REDUCER_H_
+
+#include "include/v8-platform.h"
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+
+
+// The memory reducer detects when the heap is idle after a load spike and
+// schedules incremental GCs on its own timer-driven tasks, so that committed
+// memory returns to baseline even if the embedder never sends idle
+// notifications.
+//
+// The memory reducer is implemented as a state machine with the states:
+// - DONE
+// - WAIT <started_gcs> <next_gc_start_ms>
+// - RUN <started_gcs>
+// The deterministic state transition function is implemented in the Step
+// function, driven by the following events:
+// - TIMER: a posted timer task fired.
+// - MARK_COMPACT: a full GC finished.
+// - CONTEXT_DISPOSED: a context was disposed.
+//
+// A mark-compact or context disposal moves the machine from DONE to WAIT.
+// While waiting, each timer event checks whether the allocation rate has
+// dropped; once it has (or the watchdog delay expires), the machine moves to
+// RUN and starts an incremental GC. Timer events in RUN make progress with
+// the incremental marking and finalize it when it completes. After
+// kMaxNumberOfGCs garbage collections, or when a GC frees nothing more, the
+// machine goes back to DONE.
+class MemoryReducer {
+ public:
+  enum Action { kDone, kWait, kRun };
+
+  struct State {
+    State(Action action, int started_gcs, double next_gc_start_ms,
+          double last_gc_time_ms)
+        : action(action),
+          started_gcs(started_gcs),
+          next_gc_start_ms(next_gc_start_ms),
+          last_gc_time_ms(last_gc_time_ms) {}
+    Action action;
+    int started_gcs;
+    double next_gc_start_ms;
+    // The last time a mark-compact finished, used by the watchdog to force
+    // a GC on heaps that have not seen one for a very long time.
+    double last_gc_time_ms;
+  };
+
+  enum EventType { kTimer, kMarkCompact, kContextDisposed };
+
+  struct Event {
+    EventType type;
+    double time_ms;
+    bool next_gc_likely_to_collect_more;
+    bool should_start_incremental_gc;
+    bool can_start_incremental_gc;
+  };
+
+  explicit MemoryReducer(Heap* heap) : heap_(heap), state_(kDone, 0, 0, 0) {}
+  // Callbacks.
+  void NotifyTimer(const Event& event);
+  void NotifyMarkCompact(const Event& event);
+  void NotifyContextDisposed(const Event& event);
+  // The step function that computes the next state from the current state and
+  // the incoming event.
+  static State Step(const State& state, const Event& event);
+  // Posts a timer task that will call NotifyTimer after the given delay.
+  void ScheduleTimer(double delay_ms);
+  void TearDown();
+
+  static const int kLongDelayMs;
+  static const int kShortDelayMs;
+  static const int kWatchdogDelayMs;
+  static const int kMaxNumberOfGCs;
+
+  Heap* heap() { return heap_; }
+
+ private:
+  class TimerTask : public v8::Task {
+   public:
+    explicit TimerTask(MemoryReducer* memory_reducer)
+        : memory_reducer_(memory_reducer) {}
+
+   private:
+    // v8::Task overrides.
+    void Run() override;
+
+    MemoryReducer* memory_reducer_;
+    DISALLOW_COPY_AND_ASSIGN(TimerTask);
+  };
+
+  static bool WatchdogGC(const State& state, const Event& event) {
+    return state.last_gc_time_ms != 0 &&
+           event.time_ms > state.last_gc_time_ms + kWatchdogDelayMs;
+  }
+
+  Heap* heap_;
+  State state_;
+
+  DISALLOW_COPY_AND_ASSIGN(MemoryReducer);
+};
+}
+}  // namespace v8::internal
+
+#endif  // V8_HEAP_MEMORY_REDUCER_H_
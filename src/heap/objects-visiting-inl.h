@@ -532,7 +532,8 @@ void StaticMarkingVisitor<StaticVisitor>::VisitJSArrayBuffer(
       HeapObject::RawField(object, JSArrayBuffer::BodyDescriptor::kStartOffset),
       HeapObject::RawField(object, JSArrayBuffer::kSizeWithInternalFields));
   if (!JSArrayBuffer::cast(object)->is_external()) {
-    heap->RegisterLiveArrayBuffer(JSArrayBuffer::cast(object)->backing_store());
+    heap->RegisterLiveArrayBuffer(heap->InNewSpace(object),
+                                  JSArrayBuffer::cast(object)->backing_store());
   }
 }
 
@@ -733,6 +734,13 @@ bool StaticMarkingVisitor<StaticVisitor>::IsFlushable(
     return false;
   }
 
+  // Finally the embedder's code retention policy gets a veto; this also
+  // charges accepted candidates against the per-cycle flush budget.
+  if (!heap->mark_compact_collector()->code_flusher()->CanFlushCandidate(
+          shared_info)) {
+    return false;
+  }
+
   return true;
 }
 
@@ -823,6 +831,7 @@ void Code::CodeIterateBody(ObjectVisitor* v) {
   // There are two places where we iterate code bodies: here and the
   // templated CodeIterateBody (below). They should be kept in sync.
   IteratePointer(v, kRelocationInfoOffset);
+  IteratePointer(v, kSafepointTableOffset);
   IteratePointer(v, kHandlerTableOffset);
   IteratePointer(v, kDeoptimizationDataOffset);
   IteratePointer(v, kTypeFeedbackInfoOffset);
@@ -854,6 +863,9 @@ void Code::CodeIterateBody(Heap* heap) {
   StaticVisitor::VisitPointer(
       heap,
       reinterpret_cast<Object**>(this->address() + kRelocationInfoOffset));
+  StaticVisitor::VisitPointer(
+      heap,
+      reinterpret_cast<Object**>(this->address() + kSafepointTableOffset));
   StaticVisitor::VisitPointer(
       heap, reinterpret_cast<Object**>(this->address() + kHandlerTableOffset));
   StaticVisitor::VisitPointer(
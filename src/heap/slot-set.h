@@ -0,0 +1,176 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_SLOT_SET_H_
+#define V8_HEAP_SLOT_SET_H_
+
+#include "src/allocation.h"
+#include "src/base/atomicops.h"
+#include "src/base/bits.h"
+#include "src/base/logging.h"
+#include "src/globals.h"
+#include "src/utils.h"
+
+namespace v8 {
+namespace internal {
+
+enum SlotCallbackResult { KEEP_SLOT, REMOVE_SLOT };
+
+// Data structure for maintaining a set of slots in a standard-sized chunk of
+// memory.  The set is represented as a two-level bitmap: an array of buckets,
+// each covering a fixed range of slot offsets, where the buckets themselves
+// are allocated on demand.  A sparsely populated page therefore pays only for
+// the buckets it actually uses.  Insertion and removal use compare-and-swap
+// operations on the bitmap cells so that entries can be recorded and removed
+// concurrently, without the global compaction step the store buffer needs.
+class SlotSet {
+ public:
+  SlotSet() {
+    for (int i = 0; i < kBuckets; i++) {
+      base::NoBarrier_Store(&bucket_[i], 0);
+    }
+  }
+
+  ~SlotSet() {
+    for (int i = 0; i < kBuckets; i++) {
+      ReleaseBucket(i);
+    }
+  }
+
+  // The slot offset specifies the slot at address page_start + slot_offset,
+  // where page_start is the address passed to Iterate.
+  void Insert(int slot_offset) {
+    int bucket_index, cell_index, bit_index;
+    SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
+    base::Atomic32* cells = bucket(bucket_index);
+    if (cells == NULL) cells = AllocateBucket(bucket_index);
+    base::Atomic32 mask = 1 << bit_index;
+    if ((base::NoBarrier_Load(&cells[cell_index]) & mask) == 0) {
+      SetCellBits(&cells[cell_index], mask);
+    }
+  }
+
+  // Removes the slot at address page_start + slot_offset if it was present.
+  void Remove(int slot_offset) {
+    int bucket_index, cell_index, bit_index;
+    SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
+    base::Atomic32* cells = bucket(bucket_index);
+    if (cells == NULL) return;
+    ClearCellBits(&cells[cell_index], 1 << bit_index);
+  }
+
+  // Iterates over the slots in the set, invoking the callback with the
+  // address of each slot.  The callback returns KEEP_SLOT to retain the slot
+  // in the set or REMOVE_SLOT to drop it.  Removed bits are cleared with
+  // compare-and-swap, so slots that are inserted concurrently into a cell
+  // that has already been visited survive until the next iteration.  Returns
+  // the number of retained slots.
+  template <typename Callback>
+  int Iterate(Address page_start, Callback* callback) {
+    int retained = 0;
+    for (int bucket_index = 0; bucket_index < kBuckets; bucket_index++) {
+      base::Atomic32* cells = bucket(bucket_index);
+      if (cells == NULL) continue;
+      int bucket_offset = bucket_index * kBitsPerBucket * kPointerSize;
+      for (int cell_index = 0; cell_index < kCellsPerBucket; cell_index++) {
+        base::Atomic32 cell = base::NoBarrier_Load(&cells[cell_index]);
+        if (cell == 0) continue;
+        int cell_offset = bucket_offset + cell_index * kBitsPerCell * kPointerSize;
+        base::Atomic32 mask_to_clear = 0;
+        while (cell != 0) {
+          int bit_index = base::bits::CountTrailingZeros32(cell);
+          base::Atomic32 bit_mask = 1 << bit_index;
+          Address slot_address = page_start + cell_offset + bit_index * kPointerSize;
+          if ((*callback)(slot_address) == KEEP_SLOT) {
+            retained++;
+          } else {
+            mask_to_clear |= bit_mask;
+          }
+          cell ^= bit_mask;
+        }
+        if (mask_to_clear != 0) {
+          ClearCellBits(&cells[cell_index], mask_to_clear);
+        }
+      }
+    }
+    return retained;
+  }
+
+ private:
+  static const int kMaxSlots = (1 << kPageSizeBits) / kPointerSize;
+  static const int kCellsPerBucket = 32;
+  static const int kCellsPerBucketLog2 = 5;
+  static const int kBitsPerCell = 32;
+  static const int kBitsPerCellLog2 = 5;
+  static const int kBitsPerBucket = kCellsPerBucket * kBitsPerCell;
+  static const int kBitsPerBucketLog2 = kCellsPerBucketLog2 + kBitsPerCellLog2;
+  static const int kBuckets = kMaxSlots / kBitsPerBucket;
+
+  base::Atomic32* AllocateBucket(int bucket_index) {
+    base::Atomic32* cells = NewArray<base::Atomic32>(kCellsPerBucket);
+    for (int i = 0; i < kCellsPerBucket; i++) {
+      base::NoBarrier_Store(&cells[i], 0);
+    }
+    base::AtomicWord expected = base::Release_CompareAndSwap(
+        &bucket_[bucket_index], 0, reinterpret_cast<base::AtomicWord>(cells));
+    if (expected != 0) {
+      // Another thread installed a bucket for this range first.
+      DeleteArray(cells);
+      return reinterpret_cast<base::Atomic32*>(expected);
+    }
+    return cells;
+  }
+
+  void ReleaseBucket(int bucket_index) {
+    DeleteArray(bucket(bucket_index));
+    base::NoBarrier_Store(&bucket_[bucket_index], 0);
+  }
+
+  base::Atomic32* bucket(int bucket_index) {
+    return reinterpret_cast<base::Atomic32*>(
+        base::Acquire_Load(&bucket_[bucket_index]));
+  }
+
+  static void SetCellBits(base::Atomic32* cell, base::Atomic32 mask) {
+    base::Atomic32 old_cell = base::NoBarrier_Load(cell);
+    base::Atomic32 new_cell = old_cell | mask;
+    while (old_cell != new_cell) {
+      base::Atomic32 actual =
+          base::Release_CompareAndSwap(cell, old_cell, new_cell);
+      if (actual == old_cell) break;
+      old_cell = actual;
+      new_cell = old_cell | mask;
+    }
+  }
+
+  static void ClearCellBits(base::Atomic32* cell, base::Atomic32 mask) {
+    base::Atomic32 old_cell = base::NoBarrier_Load(cell);
+    base::Atomic32 new_cell = old_cell & ~mask;
+    while (old_cell != new_cell) {
+      base::Atomic32 actual =
+          base::Release_CompareAndSwap(cell, old_cell, new_cell);
+      if (actual == old_cell) break;
+      old_cell = actual;
+      new_cell = old_cell & ~mask;
+    }
+  }
+
+  void SlotToIndices(int slot_offset, int* bucket_index, int* cell_index,
+                     int* bit_index) {
+    DCHECK(IsAligned(slot_offset, kPointerSize));
+    int slot = slot_offset >> kPointerSizeLog2;
+    DCHECK(slot >= 0 && slot < kMaxSlots);
+    *bucket_index = slot >> kBitsPerBucketLog2;
+    *cell_index = (slot >> kBitsPerCellLog2) & (kCellsPerBucket - 1);
+    *bit_index = slot & (kBitsPerCell - 1);
+  }
+
+  base::AtomicWord bucket_[kBuckets];
+
+  DISALLOW_COPY_AND_ASSIGN(SlotSet);
+};
+}
+}  // namespace v8::internal
+
+#endif  // V8_HEAP_SLOT_SET_H_
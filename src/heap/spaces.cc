@@ -8,6 +8,7 @@
 #include "src/base/platform/platform.h"
 #include "src/full-codegen.h"
 #include "src/heap/mark-compact.h"
+#include "src/heap/slot-set.h"
 #include "src/macro-assembler.h"
 #include "src/msan.h"
 #include "src/snapshot/snapshot.h"
@@ -300,7 +301,19 @@ MemoryAllocator::MemoryAllocator(Isolate* isolate)
       size_(0),
       size_executable_(0),
       lowest_ever_allocated_(reinterpret_cast<void*>(-1)),
-      highest_ever_allocated_(reinterpret_cast<void*>(0)) {}
+      highest_ever_allocated_(reinterpret_cast<void*>(0)),
+      incoming_pooled_chunks_(0),
+      ready_pooled_chunks_(0),
+      pooled_chunk_count_(0),
+      incoming_pooled_large_chunks_(0),
+      pooled_large_chunk_count_(0),
+      pool_task_active_(0),
+      pool_tasks_spawned_(0),
+      pending_pool_task_semaphore_(0) {
+  for (int i = 0; i < kLargeChunkPoolClassCount; i++) {
+    ready_pooled_large_chunks_[i] = 0;
+  }
+}
 
 
 bool MemoryAllocator::SetUp(intptr_t capacity, intptr_t capacity_executable) {
@@ -316,6 +329,12 @@ bool MemoryAllocator::SetUp(intptr_t capacity, intptr_t capacity_executable) {
 
 
 void MemoryAllocator::TearDown() {
+  // Wait for background pool tasks; each spawned task signals the semaphore
+  // exactly once when it is done.
+  for (int i = 0; i < base::NoBarrier_Load(&pool_tasks_spawned_); i++) {
+    pending_pool_task_semaphore_.Wait();
+  }
+  ReleaseChunkPool();
   // Check that spaces were torn down before MemoryAllocator.
   DCHECK(size_ == 0);
   // TODO(gc) this will be true again when we fix FreeMemory.
@@ -487,6 +506,7 @@ MemoryChunk* MemoryChunk::Initialize(Heap* heap, Address base, size_t size,
   chunk->InitializeReservedMemory();
   chunk->slots_buffer_ = NULL;
   chunk->skip_list_ = NULL;
+  chunk->old_to_new_slots_ = NULL;
   chunk->write_barrier_counter_ = kWriteBarrierCounterGranularity;
   chunk->progress_bar_ = 0;
   chunk->high_water_mark_ = static_cast<int>(area_start - base);
@@ -565,6 +585,20 @@ bool MemoryChunk::CommitArea(size_t requested) {
 }
 
 
+void MemoryChunk::AllocateOldToNewSlots() {
+  size_t pages = (size_ + Page::kPageSize - 1) / Page::kPageSize;
+  DCHECK(pages > 0);
+  DCHECK(old_to_new_slots_ == NULL);
+  old_to_new_slots_ = new SlotSet[pages];
+}
+
+
+void MemoryChunk::ReleaseOldToNewSlots() {
+  delete[] old_to_new_slots_;
+  old_to_new_slots_ = NULL;
+}
+
+
 void MemoryChunk::InsertAfter(MemoryChunk* other) {
   MemoryChunk* other_next = other->next_chunk();
 
@@ -676,11 +710,19 @@ MemoryChunk* MemoryAllocator::AllocateChunk(intptr_t reserve_area_size,
     size_t commit_size =
         RoundUp(MemoryChunk::kObjectStartOffset + commit_area_size,
                 base::OS::CommitPageSize());
-    base =
-        AllocateAlignedMemory(chunk_size, commit_size, MemoryChunk::kAlignment,
-                              executable, &reservation);
 
-    if (base == NULL) return NULL;
+    // Fully committed standard pages can be served from the chunk pool.
+    if (chunk_size == commit_size &&
+        chunk_size == static_cast<size_t>(Page::kPageSize)) {
+      base = AllocatePooledChunk(&reservation);
+    }
+    if (base == NULL) {
+      base = AllocateAlignedMemory(chunk_size, commit_size,
+                                   MemoryChunk::kAlignment, executable,
+                                   &reservation);
+
+      if (base == NULL) return NULL;
+    }
 
     if (Heap::ShouldZapGarbage()) {
       ZapBlock(base, Page::kObjectStartOffset + commit_area_size);
@@ -730,6 +772,10 @@ Page* MemoryAllocator::AllocatePage(intptr_t size, PagedSpace* owner,
 LargePage* MemoryAllocator::AllocateLargePage(intptr_t object_size,
                                               Space* owner,
                                               Executability executable) {
+  if (executable != EXECUTABLE) {
+    LargePage* page = AllocatePooledLargePage(object_size, owner);
+    if (page != NULL) return page;
+  }
   MemoryChunk* chunk =
       AllocateChunk(object_size, object_size, executable, owner);
   if (chunk == NULL) return NULL;
@@ -737,6 +783,271 @@ LargePage* MemoryAllocator::AllocateLargePage(intptr_t object_size,
 }
 
 
+// Uncommits the body of pooled pages off the main thread.
+class UncommitPooledChunksTask : public v8::Task {
+ public:
+  explicit UncommitPooledChunksTask(MemoryAllocator* allocator)
+      : allocator_(allocator) {}
+
+  virtual ~UncommitPooledChunksTask() {}
+
+ private:
+  // v8::Task overrides.
+  void Run() override {
+    allocator_->UncommitPooledChunks();
+    base::NoBarrier_Store(&allocator_->pool_task_active_, 0);
+    allocator_->pending_pool_task_semaphore_.Signal();
+  }
+
+  MemoryAllocator* allocator_;
+
+  DISALLOW_COPY_AND_ASSIGN(UncommitPooledChunksTask);
+};
+
+
+void MemoryAllocator::PushChunkOnStack(base::AtomicWord* head,
+                                       MemoryChunk* chunk) {
+  base::AtomicWord old_head;
+  do {
+    old_head = base::Acquire_Load(head);
+    chunk->set_next_chunk(reinterpret_cast<MemoryChunk*>(old_head));
+  } while (base::Release_CompareAndSwap(
+               head, old_head, reinterpret_cast<base::AtomicWord>(chunk)) !=
+           old_head);
+}
+
+
+MemoryChunk* MemoryAllocator::PopChunkFromStack(base::AtomicWord* head) {
+  // Only a single thread pops from a given stack, so the head cannot be
+  // recycled underneath the compare-and-swap below.
+  base::AtomicWord old_head;
+  MemoryChunk* chunk;
+  do {
+    old_head = base::Acquire_Load(head);
+    if (old_head == 0) return NULL;
+    chunk = reinterpret_cast<MemoryChunk*>(old_head);
+  } while (base::Release_CompareAndSwap(
+               head, old_head,
+               reinterpret_cast<base::AtomicWord>(chunk->next_chunk())) !=
+           old_head);
+  chunk->set_next_chunk(NULL);
+  return chunk;
+}
+
+
+size_t MemoryAllocator::PooledChunkHeaderSize() {
+  return RoundUp(static_cast<size_t>(MemoryChunk::kObjectStartOffset),
+                 base::OS::CommitPageSize());
+}
+
+
+bool MemoryAllocator::TryPoolChunk(MemoryChunk* chunk) {
+  if (FLAG_chunk_pool_size <= 0 || chunk->executable() == EXECUTABLE) {
+    return false;
+  }
+  base::VirtualMemory* reservation = chunk->reserved_memory();
+  if (!reservation->IsReserved() ||
+      reservation->size() != static_cast<size_t>(Page::kPageSize)) {
+    return false;
+  }
+  if (base::NoBarrier_Load(&pooled_chunk_count_) >= FLAG_chunk_pool_size) {
+    return false;
+  }
+  base::NoBarrier_AtomicIncrement(&pooled_chunk_count_, 1);
+
+  // The pool keeps only the reservation and the header, so account the page
+  // as freed.
+  size_t size = reservation->size();
+  DCHECK(size_ >= size);
+  size_ -= size;
+  isolate_->counters()->memory_allocated()->Decrement(static_cast<int>(size));
+
+  PushChunkOnStack(&incoming_pooled_chunks_, chunk);
+
+  // Make sure a background task will process the incoming page; at most one
+  // task is active at a time.
+  if (base::NoBarrier_CompareAndSwap(&pool_task_active_, 0, 1) == 0) {
+    base::NoBarrier_AtomicIncrement(&pool_tasks_spawned_, 1);
+    V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        new UncommitPooledChunksTask(this), v8::Platform::kShortRunningTask);
+  }
+  return true;
+}
+
+
+void MemoryAllocator::UncommitPooledChunks() {
+  size_t header_size = PooledChunkHeaderSize();
+  MemoryChunk* chunk;
+  while ((chunk = PopChunkFromStack(&incoming_pooled_chunks_)) != NULL) {
+    // Return the body to the OS but keep the address range reserved and the
+    // header committed; the reservation lives in the header and recommitting
+    // yields zeroed pages when the chunk is reused.
+    chunk->reserved_memory()->Uncommit(chunk->address() + header_size,
+                                       Page::kPageSize - header_size);
+    PushChunkOnStack(&ready_pooled_chunks_, chunk);
+  }
+  while ((chunk = PopChunkFromStack(&incoming_pooled_large_chunks_)) != NULL) {
+    size_t size = chunk->size();
+    chunk->reserved_memory()->Uncommit(chunk->address() + header_size,
+                                       size - header_size);
+    int pool_class = LargeChunkPoolClass(size);
+    DCHECK(pool_class >= 0);
+    PushChunkOnStack(&ready_pooled_large_chunks_[pool_class], chunk);
+  }
+}
+
+
+Address MemoryAllocator::AllocatePooledChunk(base::VirtualMemory* controller) {
+  MemoryChunk* chunk = PopChunkFromStack(&ready_pooled_chunks_);
+  if (chunk == NULL) return NULL;
+  base::NoBarrier_AtomicIncrement(&pooled_chunk_count_, -1);
+
+  Address base = chunk->address();
+  base::VirtualMemory reservation;
+  reservation.TakeControl(chunk->reserved_memory());
+  size_t header_size = PooledChunkHeaderSize();
+  if (!CommitMemory(base + header_size, Page::kPageSize - header_size,
+                    NOT_EXECUTABLE)) {
+    // The page was already accounted as freed when it entered the pool.
+    reservation.Release();
+    return NULL;
+  }
+  size_ += reservation.size();
+  controller->TakeControl(&reservation);
+  return base;
+}
+
+
+int MemoryAllocator::LargeChunkPoolClass(size_t size) {
+  if (size < (static_cast<size_t>(1) << kLargeChunkPoolMinSizeLog2)) return -1;
+  if (size >= (static_cast<size_t>(1)
+               << (kLargeChunkPoolMinSizeLog2 + kLargeChunkPoolClassCount))) {
+    return -1;
+  }
+  int log2 = kLargeChunkPoolMinSizeLog2;
+  while ((static_cast<size_t>(1) << (log2 + 1)) <= size) log2++;
+  return log2 - kLargeChunkPoolMinSizeLog2;
+}
+
+
+bool MemoryAllocator::TryPoolLargeChunk(MemoryChunk* chunk) {
+  if (FLAG_large_chunk_pool_size <= 0 || chunk->executable() == EXECUTABLE) {
+    return false;
+  }
+  base::VirtualMemory* reservation = chunk->reserved_memory();
+  if (!reservation->IsReserved() || reservation->size() != chunk->size()) {
+    return false;
+  }
+  // Standard pages belong in the regular chunk pool; a large object needs
+  // more than a page, so a pooled page-sized chunk would never be reused.
+  if (chunk->size() <= static_cast<size_t>(Page::kPageSize)) return false;
+  if (LargeChunkPoolClass(chunk->size()) < 0) return false;
+  if (base::NoBarrier_Load(&pooled_large_chunk_count_) >=
+      FLAG_large_chunk_pool_size) {
+    return false;
+  }
+  base::NoBarrier_AtomicIncrement(&pooled_large_chunk_count_, 1);
+
+  // Like regular pooled pages the chunk is accounted as freed while only the
+  // reservation and the header stay behind.
+  size_t size = reservation->size();
+  DCHECK(size_ >= size);
+  size_ -= size;
+  isolate_->counters()->memory_allocated()->Decrement(static_cast<int>(size));
+
+  PushChunkOnStack(&incoming_pooled_large_chunks_, chunk);
+
+  // Make sure a background task will uncommit the body of the chunk; at most
+  // one task is active at a time.
+  if (base::NoBarrier_CompareAndSwap(&pool_task_active_, 0, 1) == 0) {
+    base::NoBarrier_AtomicIncrement(&pool_tasks_spawned_, 1);
+    V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        new UncommitPooledChunksTask(this), v8::Platform::kShortRunningTask);
+  }
+  return true;
+}
+
+
+LargePage* MemoryAllocator::AllocatePooledLargePage(intptr_t object_size,
+                                                    Space* owner) {
+  size_t needed_size = RoundUp(MemoryChunk::kObjectStartOffset + object_size,
+                               base::OS::CommitPageSize());
+  int pool_class = LargeChunkPoolClass(needed_size);
+  if (pool_class < 0) return NULL;
+  // Chunks in the class matching the request may be smaller than the
+  // request; the next class up is the first whose chunks are all large
+  // enough.
+  if ((static_cast<size_t>(1) << (kLargeChunkPoolMinSizeLog2 + pool_class)) <
+      needed_size) {
+    pool_class++;
+  }
+  MemoryChunk* chunk = NULL;
+  while (pool_class < kLargeChunkPoolClassCount &&
+         (chunk = PopChunkFromStack(&ready_pooled_large_chunks_[pool_class])) ==
+             NULL) {
+    pool_class++;
+  }
+  if (chunk == NULL) return NULL;
+  base::NoBarrier_AtomicIncrement(&pooled_large_chunk_count_, -1);
+
+  Address base = chunk->address();
+  base::VirtualMemory reservation;
+  reservation.TakeControl(chunk->reserved_memory());
+  size_t chunk_size = reservation.size();
+  DCHECK(chunk_size >= needed_size);
+  size_t header_size = PooledChunkHeaderSize();
+  if (!CommitMemory(base + header_size, chunk_size - header_size,
+                    NOT_EXECUTABLE)) {
+    // The chunk was already accounted as freed when it entered the pool.
+    reservation.Release();
+    return NULL;
+  }
+  size_ += chunk_size;
+  isolate_->counters()->memory_allocated()->Increment(
+      static_cast<int>(chunk_size));
+
+  if (Heap::ShouldZapGarbage()) {
+    ZapBlock(base, MemoryChunk::kObjectStartOffset + object_size);
+  }
+
+  Address area_start = base + MemoryChunk::kObjectStartOffset;
+  Address area_end = area_start + object_size;
+
+  LOG(isolate_, NewEvent("MemoryChunk", base, chunk_size));
+  if (owner != NULL) {
+    ObjectSpace space = static_cast<ObjectSpace>(1 << owner->identity());
+    PerformAllocationCallback(space, kAllocationActionAllocate, chunk_size);
+  }
+
+  MemoryChunk* result =
+      MemoryChunk::Initialize(isolate_->heap(), base, chunk_size, area_start,
+                              area_end, NOT_EXECUTABLE, owner);
+  result->set_reserved_memory(&reservation);
+  return LargePage::Initialize(isolate_->heap(), result);
+}
+
+
+void MemoryAllocator::ReleaseChunkPool() {
+  List<base::AtomicWord*> stacks(3 + kLargeChunkPoolClassCount);
+  stacks.Add(&incoming_pooled_chunks_);
+  stacks.Add(&ready_pooled_chunks_);
+  stacks.Add(&incoming_pooled_large_chunks_);
+  for (int i = 0; i < kLargeChunkPoolClassCount; i++) {
+    stacks.Add(&ready_pooled_large_chunks_[i]);
+  }
+  for (int i = 0; i < stacks.length(); i++) {
+    MemoryChunk* chunk;
+    while ((chunk = PopChunkFromStack(stacks[i])) != NULL) {
+      base::VirtualMemory reservation;
+      reservation.TakeControl(chunk->reserved_memory());
+      reservation.Release();
+    }
+  }
+  base::NoBarrier_Store(&pooled_chunk_count_, 0);
+  base::NoBarrier_Store(&pooled_large_chunk_count_, 0);
+}
+
+
 void MemoryAllocator::Free(MemoryChunk* chunk) {
   LOG(isolate_, DeleteEvent("MemoryChunk", chunk));
   if (chunk->owner() != NULL) {
@@ -750,6 +1061,10 @@ void MemoryAllocator::Free(MemoryChunk* chunk) {
 
   delete chunk->slots_buffer();
   delete chunk->skip_list();
+  chunk->ReleaseOldToNewSlots();
+
+  if (TryPoolChunk(chunk)) return;
+  if (TryPoolLargeChunk(chunk)) return;
 
   base::VirtualMemory* reservation = chunk->reserved_memory();
   if (reservation->IsReserved()) {
@@ -1044,6 +1359,29 @@ bool PagedSpace::Expand() {
 }
 
 
+void PagedSpace::MergeCompactionSpace(CompactionSpace* other) {
+  // Return the remaining linear allocation area of the compaction space to
+  // its free list before taking over its pages.
+  other->EmptyAllocationInfo();
+
+  accounting_stats_.Merge(other->accounting_stats_);
+  other->accounting_stats_.Clear();
+
+  free_list_.Concatenate(other->free_list());
+
+  // Relink the pages of the compaction space at the end of this space's
+  // page list.
+  Page* p = other->anchor()->next_page();
+  while (p != other->anchor()) {
+    Page* next = p->next_page();
+    p->Unlink();
+    p->set_owner(this);
+    p->InsertAfter(anchor_.prev_page());
+    p = next;
+  }
+}
+
+
 int PagedSpace::CountTotalPages() {
   PageIterator it(this);
   int count = 0;
@@ -1077,6 +1415,11 @@ void PagedSpace::IncreaseCapacity(int size) {
 }
 
 
+void PagedSpace::DecreaseCapacity(int size) {
+  accounting_stats_.DecreaseCapacity(size);
+}
+
+
 void PagedSpace::ReleasePage(Page* page) {
   DCHECK(page->LiveBytes() == 0);
   DCHECK(AreaSize() == page->area_size());
@@ -2166,6 +2509,12 @@ FreeSpace* FreeListCategory::PickNodeFromList(int size_in_bytes,
 }
 
 
+FreeSpace* FreeListCategory::TryPickNodeFromList(int* node_size) {
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  return PickNodeFromList(node_size);
+}
+
+
 void FreeListCategory::Free(FreeSpace* free_space, int size_in_bytes) {
   DCHECK_LE(FreeList::kSmallListMin, size_in_bytes);
   free_space->set_next(top());
@@ -2437,6 +2786,73 @@ HeapObject* FreeList::Allocate(int size_in_bytes) {
 }
 
 
+FreeSpace* FreeList::TryRemoveMemory(intptr_t hint_size_in_bytes,
+                                     int* node_size) {
+  FreeSpace* node = NULL;
+
+  // Start with the smallest category whose blocks can still cover the hint.
+  if (hint_size_in_bytes <= kSmallListMax) {
+    node = small_list_.TryPickNodeFromList(node_size);
+    if (node != NULL) {
+      Page::FromAddress(node->address())
+          ->add_available_in_small_free_list(-(*node_size));
+      return node;
+    }
+  }
+  if (hint_size_in_bytes <= kMediumListMax) {
+    node = medium_list_.TryPickNodeFromList(node_size);
+    if (node != NULL) {
+      Page::FromAddress(node->address())
+          ->add_available_in_medium_free_list(-(*node_size));
+      return node;
+    }
+  }
+  if (hint_size_in_bytes <= kLargeListMax) {
+    node = large_list_.TryPickNodeFromList(node_size);
+    if (node != NULL) {
+      Page::FromAddress(node->address())
+          ->add_available_in_large_free_list(-(*node_size));
+      return node;
+    }
+  }
+  node = huge_list_.TryPickNodeFromList(node_size);
+  if (node != NULL) {
+    Page::FromAddress(node->address())
+        ->add_available_in_huge_free_list(-(*node_size));
+    return node;
+  }
+
+  // No block of at least the hinted size is free.  Any memory is better
+  // than none, so retry the categories that were skipped above.
+  if (hint_size_in_bytes > kLargeListMax) {
+    node = large_list_.TryPickNodeFromList(node_size);
+    if (node != NULL) {
+      Page::FromAddress(node->address())
+          ->add_available_in_large_free_list(-(*node_size));
+      return node;
+    }
+  }
+  if (hint_size_in_bytes > kMediumListMax) {
+    node = medium_list_.TryPickNodeFromList(node_size);
+    if (node != NULL) {
+      Page::FromAddress(node->address())
+          ->add_available_in_medium_free_list(-(*node_size));
+      return node;
+    }
+  }
+  if (hint_size_in_bytes > kSmallListMax) {
+    node = small_list_.TryPickNodeFromList(node_size);
+    if (node != NULL) {
+      Page::FromAddress(node->address())
+          ->add_available_in_small_free_list(-(*node_size));
+      return node;
+    }
+  }
+
+  return NULL;
+}
+
+
 intptr_t FreeList::EvictFreeListItems(Page* p) {
   intptr_t sum = huge_list_.EvictFreeListItemsInList(p);
   p->set_available_in_huge_free_list(0);
@@ -2645,6 +3061,52 @@ HeapObject* PagedSpace::SlowAllocateRaw(int size_in_bytes) {
 }
 
 
+static base::LazyMutex compaction_space_expand_mutex = LAZY_MUTEX_INITIALIZER;
+
+
+HeapObject* CompactionSpace::SlowAllocateRaw(int size_in_bytes) {
+  // First try to carve a bounded allocation buffer out of the main space
+  // free list.  Carving takes one lock per removed node and refills this
+  // space's private, segregated free list, so the common allocation path of
+  // a compaction task stays synchronization free.
+  PagedSpace* main_space = heap()->paged_space(identity());
+  if (main_space != NULL) {
+    intptr_t carved = 0;
+    while (carved < kCompactionMemoryWanted) {
+      int node_size = 0;
+      FreeSpace* node = main_space->free_list()->TryRemoveMemory(
+          Max(static_cast<intptr_t>(size_in_bytes),
+              kCompactionMemoryWanted - carved),
+          &node_size);
+      if (node == NULL) break;
+      carved += node_size;
+      // The carved memory stays on a page of the main space; moving it over
+      // transfers capacity but not size, and MergeCompactionSpace moves it
+      // back when the task is done.
+      IncreaseCapacity(node_size);
+      Free(node->address(), node_size);
+    }
+    if (carved > 0) {
+      {
+        base::LockGuard<base::Mutex> guard(
+            compaction_space_expand_mutex.Pointer());
+        main_space->DecreaseCapacity(static_cast<int>(carved));
+      }
+      HeapObject* object = free_list_.Allocate(size_in_bytes);
+      if (object != NULL) return object;
+    }
+  }
+
+  // The memory allocator and the heap growing checks are not thread safe,
+  // so page expansion is serialized across all compaction tasks.
+  base::LockGuard<base::Mutex> guard(compaction_space_expand_mutex.Pointer());
+  if (Expand()) {
+    return free_list_.Allocate(size_in_bytes);
+  }
+  return NULL;
+}
+
+
 #ifdef DEBUG
 void PagedSpace::ReportCodeStatistics(Isolate* isolate) {
   CommentStatistic* comments_statistics =
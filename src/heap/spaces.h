@@ -92,6 +92,7 @@ class Isolate;
 
 
 class PagedSpace;
+class CompactionSpace;
 class MemoryAllocator;
 class AllocationInfo;
 class Space;
@@ -127,6 +128,35 @@ class MarkBit {
   inline bool Get() { return (*cell_ & mask_) != 0; }
   inline void Clear() { *cell_ &= ~mask_; }
 
+  // Atomically sets the bit if it is currently clear. Returns true if this
+  // call performed the transition, i.e. the caller now owns the newly
+  // marked object.
+  inline bool SetAtomic() {
+    base::Atomic32* cell = reinterpret_cast<base::Atomic32*>(cell_);
+    base::Atomic32 mask = static_cast<base::Atomic32>(mask_);
+    base::Atomic32 old_value;
+    do {
+      old_value = base::NoBarrier_Load(cell);
+      if ((old_value & mask) != 0) return false;
+    } while (base::Release_CompareAndSwap(cell, old_value, old_value | mask) !=
+             old_value);
+    return true;
+  }
+
+  // Atomically clears the bit if it is currently set. Returns true if this
+  // call performed the transition.
+  inline bool ClearAtomic() {
+    base::Atomic32* cell = reinterpret_cast<base::Atomic32*>(cell_);
+    base::Atomic32 mask = static_cast<base::Atomic32>(mask_);
+    base::Atomic32 old_value;
+    do {
+      old_value = base::NoBarrier_Load(cell);
+      if ((old_value & mask) == 0) return false;
+    } while (base::Release_CompareAndSwap(cell, old_value, old_value & ~mask) !=
+             old_value);
+    return true;
+  }
+
   CellType* cell_;
   CellType mask_;
 
@@ -258,6 +288,7 @@ class Bitmap {
 
 
 class SkipList;
+class SlotSet;
 class SlotsBuffer;
 
 // MemoryChunk represents a memory region owned by a specific space.
@@ -478,6 +509,12 @@ class MemoryChunk {
     live_byte_count_ += by;
     DCHECK_LE(static_cast<unsigned>(live_byte_count_), size_);
   }
+  // Variant of IncrementLiveBytes that may be called concurrently from
+  // parallel marking tasks.
+  void IncrementLiveBytesAtomic(int by) {
+    base::NoBarrier_AtomicIncrement(
+        reinterpret_cast<base::Atomic32*>(&live_byte_count_), by);
+  }
   int LiveBytes() {
     DCHECK(static_cast<unsigned>(live_byte_count_) <= size_);
     return live_byte_count_;
@@ -539,7 +576,8 @@ class MemoryChunk {
 
   static const size_t kHeaderSize =
       kWriteBarrierCounterOffset + kPointerSize + kIntSize + kIntSize +
-      kPointerSize + 5 * kPointerSize + kPointerSize + kPointerSize;
+      kPointerSize + 5 * kPointerSize + kPointerSize + kPointerSize +
+      kPointerSize;
 
   static const int kBodyOffset =
       CODE_POINTER_ALIGN(kHeaderSize + Bitmap::kSize);
@@ -624,6 +662,13 @@ class MemoryChunk {
 
   inline SlotsBuffer** slots_buffer_address() { return &slots_buffer_; }
 
+  inline SlotSet* old_to_new_slots() { return old_to_new_slots_; }
+
+  // Allocates the remembered set covering this chunk, one slot set per
+  // page-sized region so that large object chunks are covered as well.
+  void AllocateOldToNewSlots();
+  void ReleaseOldToNewSlots();
+
   void MarkEvacuationCandidate() {
     DCHECK(!IsFlagSet(NEVER_EVACUATE));
     DCHECK(slots_buffer_ == NULL);
@@ -684,6 +729,10 @@ class MemoryChunk {
   intptr_t available_in_huge_free_list_;
   intptr_t non_available_small_blocks_;
 
+  // Remembered set of old-to-new pointers in this chunk, used when
+  // --page-remembered-sets is on.  NULL until the first slot is recorded.
+  SlotSet* old_to_new_slots_;
+
   static MemoryChunk* Initialize(Heap* heap, Address base, size_t size,
                                  Address area_start, Address area_end,
                                  Executability executable, Space* owner);
@@ -1143,6 +1192,56 @@ class MemoryAllocator {
                                               size_t reserved_size);
 
  private:
+  // A bounded pool of standard non-executable pages kept for reuse, so that
+  // page recycling does not have to go to the OS (--chunk-pool-size).  Freed
+  // pages are pushed onto a lock-free incoming stack, which lets concurrent
+  // tasks return pages without taking a mutex.  A background task uncommits
+  // the body of incoming pages, keeping only the header and the reservation,
+  // and moves them to the ready stack from which AllocateChunk takes them.
+
+  // Puts the chunk into the pool if it is a standard fully reserved page and
+  // the pool is not full.  Returns whether the chunk was pooled.
+  bool TryPoolChunk(MemoryChunk* chunk);
+
+  // Takes a page from the pool, recommits its body and transfers the
+  // reservation to |controller|.  Returns NULL if the pool is empty.
+  Address AllocatePooledChunk(base::VirtualMemory* controller);
+
+  // Large object chunks are pooled separately in power-of-two size classes
+  // (--large-chunk-pool-size), which avoids VMA churn and zero-page faults
+  // for workloads that allocate and free big buffers constantly.  A chunk
+  // is stored under the largest class that does not exceed its size and
+  // taken from the smallest class that covers a request, so a popped chunk
+  // always fits.
+  static const int kLargeChunkPoolMinSizeLog2 = 20;  // 1MB
+  static const int kLargeChunkPoolClassCount = 8;    // up to 256MB
+
+  // Returns the pool class for the given chunk size, or -1 when the size
+  // is outside the pooled range.
+  static int LargeChunkPoolClass(size_t size);
+
+  // Puts a freed large object chunk into the pool if it is non-executable,
+  // within the pooled size range and the pool is not full.  Returns
+  // whether the chunk was pooled.
+  bool TryPoolLargeChunk(MemoryChunk* chunk);
+
+  // Takes a pooled large chunk whose reservation covers |object_size|,
+  // recommits its body and reinitializes the recycled header.  Returns
+  // NULL if no pooled chunk fits.
+  LargePage* AllocatePooledLargePage(intptr_t object_size, Space* owner);
+
+  // Drains the incoming stack on the background task.
+  void UncommitPooledChunks();
+
+  void ReleaseChunkPool();
+
+  static void PushChunkOnStack(base::AtomicWord* head, MemoryChunk* chunk);
+  static MemoryChunk* PopChunkFromStack(base::AtomicWord* head);
+
+  // Returns the committed size of the header of a pooled page, including
+  // the marking bitmap; the rest of the page is uncommitted while pooled.
+  static size_t PooledChunkHeaderSize();
+
   Isolate* isolate_;
 
   // Maximum space size in bytes.
@@ -1163,6 +1262,19 @@ class MemoryAllocator {
   void* lowest_ever_allocated_;
   void* highest_ever_allocated_;
 
+  // Chunk pool state.  The stacks are Treiber stacks linked through
+  // MemoryChunk::next_chunk; the ready stack is only popped on the main
+  // thread, the incoming stack only by the single active background task.
+  base::AtomicWord incoming_pooled_chunks_;
+  base::AtomicWord ready_pooled_chunks_;
+  base::Atomic32 pooled_chunk_count_;
+  base::AtomicWord incoming_pooled_large_chunks_;
+  base::AtomicWord ready_pooled_large_chunks_[kLargeChunkPoolClassCount];
+  base::Atomic32 pooled_large_chunk_count_;
+  base::Atomic32 pool_task_active_;
+  base::Atomic32 pool_tasks_spawned_;
+  base::Semaphore pending_pool_task_semaphore_;
+
   struct MemoryAllocationCallbackRegistration {
     MemoryAllocationCallbackRegistration(MemoryAllocationCallback callback,
                                          ObjectSpace space,
@@ -1188,6 +1300,8 @@ class MemoryAllocator {
     highest_ever_allocated_ = Max(highest_ever_allocated_, high);
   }
 
+  friend class UncommitPooledChunksTask;
+
   DISALLOW_IMPLICIT_CONSTRUCTORS(MemoryAllocator);
 };
 
@@ -1399,6 +1513,26 @@ class AllocationStats BASE_EMBEDDED {
     DCHECK(size_ >= 0);
   }
 
+  // Shrink the space by removing free bytes, e.g. when free list memory is
+  // carved out for a compaction space.  Unlike ShrinkSpace, the removed
+  // bytes were not part of the size.
+  void DecreaseCapacity(intptr_t size_in_bytes) {
+    capacity_ -= size_in_bytes;
+    DCHECK(capacity_ >= 0);
+    DCHECK(capacity_ >= size_);
+  }
+
+  // Merge the accounting of a compaction space whose pages are moved into
+  // the space this accounting belongs to.
+  void Merge(const AllocationStats& other) {
+    capacity_ += other.capacity_;
+    size_ += other.size_;
+    waste_ += other.waste_;
+    if (capacity_ > max_capacity_) {
+      max_capacity_ = capacity_;
+    }
+  }
+
   // Allocate from available bytes (available -> size).
   void AllocateBytes(intptr_t size_in_bytes) {
     size_ += size_in_bytes;
@@ -1443,6 +1577,11 @@ class FreeListCategory {
   FreeSpace* PickNodeFromList(int* node_size);
   FreeSpace* PickNodeFromList(int size_in_bytes, int* node_size);
 
+  // Variant of PickNodeFromList that holds the category mutex, for
+  // callers that run concurrently with each other or with Concatenate.
+  // See FreeList::TryRemoveMemory.
+  FreeSpace* TryPickNodeFromList(int* node_size);
+
   intptr_t EvictFreeListItemsInList(Page* p);
   bool ContainsPageFreeListItemsInList(Page* p);
 
@@ -1550,6 +1689,18 @@ class FreeList {
   // 'wasted_bytes'.  The size should be a non-zero multiple of the word size.
   MUST_USE_RESULT HeapObject* Allocate(int size_in_bytes);
 
+  // Carve a single free space node of preferably at least
+  // 'hint_size_in_bytes' out of the free list.  The caller takes ownership
+  // of the whole node: compaction tasks use it as a bounded thread-local
+  // allocation buffer by freeing it into their own segregated free list,
+  // from which allocation needs no further synchronization.  Each removal
+  // locks only the category it pops from, so concurrent carving by several
+  // tasks is safe; the unsynchronized Allocate path must not run at the
+  // same time.  The per-page free list availability counters are only
+  // compaction heuristics and may be slightly skewed by concurrent carving.
+  MUST_USE_RESULT FreeSpace* TryRemoveMemory(intptr_t hint_size_in_bytes,
+                                             int* node_size);
+
   bool IsEmpty() {
     return small_list_.IsEmpty() && medium_list_.IsEmpty() &&
            large_list_.IsEmpty() && huge_list_.IsEmpty();
@@ -1810,7 +1961,12 @@ class PagedSpace : public Space {
 
   void Allocate(int bytes) { accounting_stats_.AllocateBytes(bytes); }
 
+  // Moves the pages, free list and accounting of a compaction space into
+  // this space after a compaction task has finished.
+  void MergeCompactionSpace(CompactionSpace* other);
+
   void IncreaseCapacity(int size);
+  void DecreaseCapacity(int size);
 
   // Releases an unused page and shrinks the space.
   void ReleasePage(Page* page);
@@ -1893,6 +2049,16 @@ class PagedSpace : public Space {
 
   bool HasEmergencyMemory() { return emergency_memory_ != NULL; }
 
+  // Reports bytes available in the free list by size category; used by the
+  // statistics extension to expose fragmentation.
+  void GetFreeListStatistics(intptr_t* small_size, intptr_t* medium_size,
+                             intptr_t* large_size, intptr_t* huge_size) {
+    *small_size = free_list_.small_list()->available();
+    *medium_size = free_list_.medium_list()->available();
+    *large_size = free_list_.large_list()->available();
+    *huge_size = free_list_.huge_list()->available();
+  }
+
  protected:
   FreeList* free_list() { return &free_list_; }
 
@@ -1948,14 +2114,41 @@ class PagedSpace : public Space {
   MUST_USE_RESULT HeapObject* WaitForSweeperThreadsAndRetryAllocation(
       int size_in_bytes);
 
-  // Slow path of AllocateRaw.  This function is space-dependent.
-  MUST_USE_RESULT HeapObject* SlowAllocateRaw(int size_in_bytes);
+  // Slow path of AllocateRaw.  This function is space-dependent.  Virtual so
+  // that compaction spaces, which must not sweep or wait for the main space,
+  // can override it.
+  MUST_USE_RESULT virtual HeapObject* SlowAllocateRaw(int size_in_bytes);
 
+  friend class CompactionSpace;
   friend class PageIterator;
   friend class MarkCompactCollector;
 };
 
 
+// A space owned by a single compaction task.  Objects are evacuated into
+// pages of a compaction space without synchronization; when the task is
+// done, the pages are moved into the corresponding main space with
+// MergeCompactionSpace.
+class CompactionSpace : public PagedSpace {
+ public:
+  CompactionSpace(Heap* heap, intptr_t max_capacity, AllocationSpace id,
+                  Executability executable)
+      : PagedSpace(heap, max_capacity, id, executable) {}
+
+  // The amount of memory a compaction task tries to carve out of the main
+  // space free list at once.  Larger buffers mean fewer synchronized free
+  // list operations, smaller ones less memory stranded in tasks that finish
+  // early.
+  static const intptr_t kCompactionMemoryWanted = 500 * KB;
+
+ protected:
+  // Compaction spaces are not swept concurrently and never wait for the
+  // main space; they can only expand.  Expansion is serialized across
+  // compaction tasks because the memory allocator is not thread safe.
+  MUST_USE_RESULT HeapObject* SlowAllocateRaw(int size_in_bytes) override;
+};
+
+
 class NumberAndSizeInfo BASE_EMBEDDED {
  public:
   NumberAndSizeInfo() : number_(0), bytes_(0) {}
@@ -33,6 +33,10 @@ void StoreBuffer::EnterDirectlyIntoStoreBuffer(Address addr) {
   if (store_buffer_rebuilding_enabled_) {
     SLOW_DCHECK(!heap_->code_space()->Contains(addr) &&
                 !heap_->new_space()->Contains(addr));
+    if (FLAG_page_remembered_sets) {
+      InsertIntoRememberedSet(addr);
+      return;
+    }
     Address* top = old_top_;
     *top++ = addr;
     old_top_ = top;
@@ -7,6 +7,7 @@
 #include "src/v8.h"
 
 #include "src/counters.h"
+#include "src/heap/slot-set.h"
 #include "src/heap/store-buffer-inl.h"
 
 namespace v8 {
@@ -369,6 +370,10 @@ void StoreBuffer::IteratePointersInStoreBuffer(
 
 void StoreBuffer::ClearInvalidStoreBufferEntries() {
   Compact();
+  if (FLAG_page_remembered_sets) {
+    ClearInvalidRememberedSetEntries();
+    return;
+  }
   Address* new_top = old_start_;
   for (Address* current = old_start_; current < old_top_; current++) {
     Address addr = *current;
@@ -400,6 +405,10 @@ void StoreBuffer::ClearInvalidStoreBufferEntries() {
 
 
 void StoreBuffer::VerifyValidStoreBufferEntries() {
+  if (FLAG_page_remembered_sets) {
+    VerifyValidRememberedSetEntries();
+    return;
+  }
   for (Address* current = old_start_; current < old_top_; current++) {
     Object** slot = reinterpret_cast<Object**>(*current);
     Object* object = *slot;
@@ -411,7 +420,144 @@ void StoreBuffer::VerifyValidStoreBufferEntries() {
 }
 
 
+void StoreBuffer::InsertIntoRememberedSet(Address addr) {
+  MemoryChunk* chunk = MemoryChunk::FromAnyPointerAddress(heap_, addr);
+  if (chunk->old_to_new_slots() == NULL) chunk->AllocateOldToNewSlots();
+  uintptr_t offset = addr - chunk->address();
+  chunk->old_to_new_slots()[offset >> kPageSizeBits].Insert(
+      static_cast<int>(offset & Page::kPageAlignmentMask));
+}
+
+
+// Forwards a recorded old-to-new slot to the scavenge callback and decides
+// whether the slot stays in the remembered set.
+class ScavengeSlotVisitor {
+ public:
+  ScavengeSlotVisitor(Heap* heap, ObjectSlotCallback slot_callback)
+      : heap_(heap), slot_callback_(slot_callback) {}
+
+  SlotCallbackResult operator()(Address slot_address) {
+    Object** slot = reinterpret_cast<Object**>(slot_address);
+    Object* object = *slot;
+    if (heap_->InFromSpace(object)) {
+      HeapObject* heap_object = reinterpret_cast<HeapObject*>(object);
+      DCHECK(heap_object->IsHeapObject());
+      slot_callback_(reinterpret_cast<HeapObject**>(slot), heap_object);
+      object = *slot;
+    }
+    // Slots whose target was promoted, or that were already updated through
+    // another route, no longer point to new space and can be dropped.
+    return heap_->InNewSpace(object) ? KEEP_SLOT : REMOVE_SLOT;
+  }
+
+ private:
+  Heap* heap_;
+  ObjectSlotCallback slot_callback_;
+};
+
+
+void StoreBuffer::IterateRememberedSetPointersToNewSpace(
+    ObjectSlotCallback slot_callback) {
+  // Move the entries the mutator has accumulated since the last compaction
+  // into the per-page sets.
+  Compact();
+
+  ScavengeSlotVisitor visitor(heap_, slot_callback);
+  PointerChunkIterator it(heap_);
+  MemoryChunk* chunk;
+  while ((chunk = it.next()) != NULL) {
+    SlotSet* slots = chunk->old_to_new_slots();
+    if (slots == NULL) continue;
+    size_t pages = (chunk->size() + Page::kPageSize - 1) / Page::kPageSize;
+    for (size_t page = 0; page < pages; page++) {
+      slots[page].Iterate(chunk->address() + page * Page::kPageSize, &visitor);
+    }
+  }
+}
+
+
+// Removes remembered set entries that are not part of live objects anymore,
+// mirroring what ClearInvalidStoreBufferEntries does for the old buffer.
+class ClearInvalidSlotVisitor {
+ public:
+  explicit ClearInvalidSlotVisitor(Heap* heap) : heap_(heap) {}
+
+  SlotCallbackResult operator()(Address slot_address) {
+    Object** slot = reinterpret_cast<Object**>(slot_address);
+    Object* object = *slot;
+    if (!heap_->InNewSpace(object) || !object->IsHeapObject()) {
+      return REMOVE_SLOT;
+    }
+    // If the target object is not black, the source slot must be part
+    // of a non-black (dead) object.
+    HeapObject* heap_object = HeapObject::cast(object);
+    if (!Marking::IsBlack(Marking::MarkBitFrom(heap_object)) ||
+        !heap_->mark_compact_collector()->IsSlotInLiveObject(slot_address)) {
+      return REMOVE_SLOT;
+    }
+    return KEEP_SLOT;
+  }
+
+ private:
+  Heap* heap_;
+};
+
+
+void StoreBuffer::ClearInvalidRememberedSetEntries() {
+  ClearInvalidSlotVisitor visitor(heap_);
+  PointerChunkIterator it(heap_);
+  MemoryChunk* chunk;
+  while ((chunk = it.next()) != NULL) {
+    SlotSet* slots = chunk->old_to_new_slots();
+    if (slots == NULL) continue;
+    size_t pages = (chunk->size() + Page::kPageSize - 1) / Page::kPageSize;
+    for (size_t page = 0; page < pages; page++) {
+      slots[page].Iterate(chunk->address() + page * Page::kPageSize, &visitor);
+    }
+  }
+}
+
+
+class VerifySlotVisitor {
+ public:
+  explicit VerifySlotVisitor(Heap* heap) : heap_(heap) {}
+
+  SlotCallbackResult operator()(Address slot_address) {
+    Object** slot = reinterpret_cast<Object**>(slot_address);
+    Object* object = *slot;
+    CHECK(object->IsHeapObject());
+    CHECK(heap_->InNewSpace(object));
+    heap_->mark_compact_collector()->VerifyIsSlotInLiveObject(
+        slot_address, HeapObject::cast(object));
+    return KEEP_SLOT;
+  }
+
+ private:
+  Heap* heap_;
+};
+
+
+void StoreBuffer::VerifyValidRememberedSetEntries() {
+  VerifySlotVisitor visitor(heap_);
+  PointerChunkIterator it(heap_);
+  MemoryChunk* chunk;
+  while ((chunk = it.next()) != NULL) {
+    SlotSet* slots = chunk->old_to_new_slots();
+    if (slots == NULL) continue;
+    size_t pages = (chunk->size() + Page::kPageSize - 1) / Page::kPageSize;
+    for (size_t page = 0; page < pages; page++) {
+      slots[page].Iterate(chunk->address() + page * Page::kPageSize, &visitor);
+    }
+  }
+}
+
+
 void StoreBuffer::IteratePointersToNewSpace(ObjectSlotCallback slot_callback) {
+  if (FLAG_page_remembered_sets) {
+    IterateRememberedSetPointersToNewSpace(slot_callback);
+    return;
+  }
+
   // We do not sort or remove duplicated entries from the store buffer because
   // we expect that callback will rebuild the store buffer thus removing
   // all duplicates and pointers to old space.
@@ -538,6 +684,19 @@ void StoreBuffer::Compact() {
   // the worst case (compaction doesn't eliminate any pointers).
   DCHECK(top <= limit_);
   heap_->public_set_store_buffer_top(start_);
+
+  if (FLAG_page_remembered_sets) {
+    // Move the entries to the remembered sets of the pages that contain
+    // them.  The slot sets deduplicate inherently and never run out of
+    // space, so no filtering or page exemption step is needed.
+    for (Address* current = start_; current < top; current++) {
+      DCHECK(!heap_->code_space()->Contains(*current));
+      InsertIntoRememberedSet(*current);
+    }
+    heap_->isolate()->counters()->store_buffer_compactions()->Increment();
+    return;
+  }
+
   EnsureSpace(top - start_);
   DCHECK(may_move_store_buffer_entries_);
   // Goes through the addresses in the store buffer attempting to remove
@@ -136,6 +136,18 @@ class StoreBuffer {
   bool SpaceAvailable(intptr_t space_needed);
   void ExemptPopularPages(int prime_sample_step, int threshold);
 
+  // The remaining private methods implement the --page-remembered-sets mode,
+  // where old-to-new pointers are kept in per-page slot sets instead of the
+  // old buffer.  Entries are moved to the page that contains them, so the
+  // old buffer can never overflow and no pages have to be exempted from the
+  // store buffer and rescanned.
+  void InsertIntoRememberedSet(Address addr);
+
+  void IterateRememberedSetPointersToNewSpace(ObjectSlotCallback slot_callback);
+
+  void ClearInvalidRememberedSetEntries();
+  void VerifyValidRememberedSetEntries();
+
   void ProcessOldToNewSlot(Address slot_address,
                            ObjectSlotCallback slot_callback);
 
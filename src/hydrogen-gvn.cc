@@ -18,7 +18,9 @@ class HInstructionMap final : public ZoneObject {
         array_(NULL),
         lists_(NULL),
         free_list_head_(kNil),
-        side_effects_tracker_(side_effects_tracker) {
+        side_effects_tracker_(side_effects_tracker),
+        zone_(zone),
+        shared_(false) {
     ResizeLists(kInitialSize, zone);
     Resize(kInitialSize, zone);
   }
@@ -32,7 +34,10 @@ class HInstructionMap final : public ZoneObject {
 
   HInstruction* Lookup(HInstruction* instr) const;
 
-  HInstructionMap* Copy(Zone* zone) const {
+  // Copies are copy-on-write: the new map shares the table with this one
+  // until either of the two is written to, so that the dominator tree
+  // traversal only pays for a table copy where a block actually changes it.
+  HInstructionMap* Copy(Zone* zone) {
     return new(zone) HInstructionMap(zone, this);
   }
 
@@ -49,11 +54,12 @@ class HInstructionMap final : public ZoneObject {
   // Must be a power of 2.
   static const int kInitialSize = 16;
 
-  HInstructionMap(Zone* zone, const HInstructionMap* other);
+  HInstructionMap(Zone* zone, HInstructionMap* other);
 
   void Resize(int new_size, Zone* zone);
   void ResizeLists(int new_size, Zone* zone);
   void Insert(HInstruction* instr, Zone* zone);
+  void EnsureOwnTable();
   uint32_t Bound(uint32_t value) const { return value & (array_size_ - 1); }
 
   int array_size_;
@@ -67,6 +73,8 @@ class HInstructionMap final : public ZoneObject {
   // The linked lists containing hash collisions.
   int free_list_head_;  // Unused elements in lists_ are on the free list.
   SideEffectsTracker* side_effects_tracker_;
+  Zone* zone_;
+  bool shared_;  // The table is shared with another map; copy before writing.
 };
 
 
@@ -131,24 +139,25 @@ void TraceGVN(const char* msg, ...) {
   }
 
 
-HInstructionMap::HInstructionMap(Zone* zone, const HInstructionMap* other)
+HInstructionMap::HInstructionMap(Zone* zone, HInstructionMap* other)
     : array_size_(other->array_size_),
       lists_size_(other->lists_size_),
       count_(other->count_),
       present_depends_on_(other->present_depends_on_),
-      array_(zone->NewArray<HInstructionMapListElement>(other->array_size_)),
-      lists_(zone->NewArray<HInstructionMapListElement>(other->lists_size_)),
+      array_(other->array_),
+      lists_(other->lists_),
       free_list_head_(other->free_list_head_),
-      side_effects_tracker_(other->side_effects_tracker_) {
-  MemCopy(array_, other->array_,
-          array_size_ * sizeof(HInstructionMapListElement));
-  MemCopy(lists_, other->lists_,
-          lists_size_ * sizeof(HInstructionMapListElement));
+      side_effects_tracker_(other->side_effects_tracker_),
+      zone_(zone),
+      shared_(true) {
+  // Share the table with {other} until either map is written to.
+  other->shared_ = true;
 }
 
 
 void HInstructionMap::Kill(SideEffects changes) {
   if (!present_depends_on_.ContainsAnyOf(changes)) return;
+  EnsureOwnTable();
   present_depends_on_.RemoveAll();
   for (int i = 0; i < array_size_; ++i) {
     HInstruction* instr = array_[i].instr;
@@ -281,6 +290,7 @@ void HInstructionMap::ResizeLists(int new_size, Zone* zone) {
 
 void HInstructionMap::Insert(HInstruction* instr, Zone* zone) {
   DCHECK(instr != NULL);
+  EnsureOwnTable();
   // Resizing when half of the hashtable is filled up.
   if (count_ >= array_size_ >> 1) Resize(array_size_ << 1, zone);
   DCHECK(count_ < array_size_);
@@ -304,6 +314,22 @@ void HInstructionMap::Insert(HInstruction* instr, Zone* zone) {
 }
 
 
+void HInstructionMap::EnsureOwnTable() {
+  if (!shared_) return;
+  HInstructionMapListElement* array_copy =
+      zone_->NewArray<HInstructionMapListElement>(array_size_);
+  MemCopy(array_copy, array_,
+          array_size_ * sizeof(HInstructionMapListElement));
+  array_ = array_copy;
+  HInstructionMapListElement* lists_copy =
+      zone_->NewArray<HInstructionMapListElement>(lists_size_);
+  MemCopy(lists_copy, lists_,
+          lists_size_ * sizeof(HInstructionMapListElement));
+  lists_ = lists_copy;
+  shared_ = false;
+}
+
+
 HSideEffectMap::HSideEffectMap() : count_(0) {
   memset(data_, 0, kNumberOfTrackedSideEffects * kPointerSize);
 }
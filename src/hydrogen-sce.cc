@@ -8,6 +8,58 @@
 namespace v8 {
 namespace internal {
 
+// Upper bound on a provable loop trip count for which the back-edge stack
+// check is elided.  The interrupt latency contract tolerates a few thousand
+// iterations between checks; every elided loop iterates at most this often
+// and any call in its body carries a stack check of its own.
+static const int64_t kMaxElidedTripCount = 1024;
+
+
+// Tries to prove a constant bound on the number of iterations of the loop
+// with the given header: the loop must be guarded by a numeric compare of
+// an induction variable with constant base and increment against a constant
+// limit.  Returns false if no bound can be proven.
+static bool ComputeConstantTripCount(HBasicBlock* header, int64_t* count) {
+  HLoopInformation* loop = header->loop_information();
+  HControlInstruction* end = header->end();
+  for (int i = 0; i < end->SuccessorCount(); i++) {
+    HBasicBlock* body = end->SuccessorAt(i);
+    if (!loop->blocks()->Contains(body)) continue;
+    InductionVariableData::LimitFromPredecessorBlock limit;
+    InductionVariableData::ComputeLimitFromPredecessorBlock(body, &limit);
+    if (!limit.LimitIsValid()) continue;
+    InductionVariableData* data = limit.variable;
+    if (data->phi()->block() != header) continue;
+    if (!data->base()->IsInteger32Constant()) continue;
+    if (!limit.limit->IsInteger32Constant()) continue;
+    int64_t base = data->base()->GetInteger32Constant();
+    int64_t bound = limit.limit->GetInteger32Constant();
+    int64_t increment = data->increment();
+    if (increment == 0) continue;
+    // In iteration k the induction variable holds base + k * increment and
+    // the loop is only re-entered while the limit condition holds.
+    Token::Value token = limit.token;
+    if ((token == Token::LT || token == Token::LTE) && increment > 0) {
+      if (token == Token::LTE) bound++;
+      *count = bound <= base ? 0 : (bound - base + increment - 1) / increment;
+      return true;
+    }
+    if ((token == Token::GT || token == Token::GTE) && increment < 0) {
+      if (token == Token::GTE) bound--;
+      *count = bound >= base ? 0 : (base - bound - increment - 1) / -increment;
+      return true;
+    }
+    if (token == Token::NE && (increment == 1 || increment == -1)) {
+      int64_t distance = increment == 1 ? bound - base : base - bound;
+      if (distance < 0) continue;  // Runs until the variable wraps around.
+      *count = distance;
+      return true;
+    }
+  }
+  return false;
+}
+
+
 void HStackCheckEliminationPhase::Run() {
   // For each loop block walk the dominator tree from the backwards branch to
   // the loop header. If a call instruction is encountered the backwards branch
@@ -16,6 +68,16 @@ void HStackCheckEliminationPhase::Run() {
   for (int i = 0; i < graph()->blocks()->length(); i++) {
     HBasicBlock* block = graph()->blocks()->at(i);
     if (block->IsLoopHeader()) {
+      // A loop with a provably small trip count cannot delay an interrupt
+      // for long, so its back-edge check can be dropped outright.
+      HStackCheck* stack_check = block->loop_information()->stack_check();
+      int64_t trip_count;
+      if (stack_check != NULL && ComputeConstantTripCount(block, &trip_count) &&
+          trip_count <= kMaxElidedTripCount) {
+        stack_check->Eliminate();
+        continue;
+      }
+
       HBasicBlock* back_edge = block->loop_information()->GetLastBackEdge();
       HBasicBlock* dominator = back_edge;
       while (true) {
@@ -4177,7 +4177,11 @@ void TestContext::BuildBranch(HValue* value) {
   // branch.
   HOptimizedGraphBuilder* builder = owner();
   if (value != NULL && value->CheckFlag(HValue::kIsArguments)) {
-    builder->Bailout(kArgumentsObjectValueInATestContext);
+    // The arguments object is always a JSObject and hence always truthy;
+    // branch directly instead of materializing it for an HBranch.
+    builder->Goto(if_true(), builder->function_state());
+    builder->set_current_block(NULL);
+    return;
   }
   ToBooleanStub::Types expected(condition()->to_boolean_types());
   ReturnControl(owner()->New<HBranch>(value, expected), BailoutId::None());
@@ -5436,9 +5440,15 @@ void HOptimizedGraphBuilder::VisitVariableProxy(VariableProxy* expr) {
 
       if (type == kUseCell) {
         Handle<PropertyCell> cell = it.GetPropertyCell();
-        top_info()->dependencies()->AssumePropertyCell(cell);
+        // A non-configurable, read-only data property on the global object
+        // can never change its value, so its cell content can be embedded
+        // without registering a code dependency.
+        bool cell_is_immutable = !it.IsConfigurable() && it.IsReadOnly();
+        if (!cell_is_immutable) {
+          top_info()->dependencies()->AssumePropertyCell(cell);
+        }
         auto cell_type = it.property_details().cell_type();
-        if (cell_type == PropertyCellType::kConstant ||
+        if (cell_is_immutable || cell_type == PropertyCellType::kConstant ||
             cell_type == PropertyCellType::kUndefined) {
           Handle<Object> constant_object(cell->value(), isolate());
           if (constant_object->IsConsString()) {
@@ -7135,17 +7145,28 @@ static bool CanInlineElementAccess(Handle<Map> map) {
 }
 
 
-HInstruction* HOptimizedGraphBuilder::TryBuildConsolidatedElementLoad(
+HInstruction* HOptimizedGraphBuilder::TryBuildConsolidatedElementAccess(
     HValue* object,
     HValue* key,
     HValue* val,
-    SmallMapList* maps) {
-  // For polymorphic loads of similar elements kinds (i.e. all tagged or all
-  // double), always use the "worst case" code without a transition.  This is
-  // much faster than transitioning the elements to the worst case, trading a
-  // HTransitionElements for a HCheckMaps, and avoiding mutation of the array.
+    SmallMapList* maps,
+    PropertyAccessType access_type,
+    KeyedAccessStoreMode store_mode) {
+  // For polymorphic accesses of similar elements kinds (i.e. all tagged or
+  // all double), always use the "worst case" code without a transition.  This
+  // is much faster than transitioning the elements to the worst case, trading
+  // a HTransitionElements for a HCheckMaps, and avoiding mutation of the
+  // array.  The single map check is loop invariant for a loop-invariant
+  // receiver, so loops over mixed packed and holey arrays get unchecked
+  // element accesses in the body.
+  //
+  // Stores may not widen the representation of an array whose map claims a
+  // more specific elements kind, so they only consolidate within one
+  // representation class (smi, double or object) and without growing.
+  if (access_type == STORE && store_mode != STANDARD_STORE) return NULL;
   bool has_double_maps = false;
-  bool has_smi_or_object_maps = false;
+  bool has_smi_maps = false;
+  bool has_object_maps = false;
   bool has_js_array_access = false;
   bool has_non_js_array_access = false;
   bool has_seen_holey_elements = false;
@@ -7164,11 +7185,16 @@ HInstruction* HOptimizedGraphBuilder::TryBuildConsolidatedElementLoad(
     }
     // Don't allow mixed, incompatible elements kinds.
     if (map->has_fast_double_elements()) {
-      if (has_smi_or_object_maps) return NULL;
+      if (has_smi_maps || has_object_maps) return NULL;
       has_double_maps = true;
-    } else if (map->has_fast_smi_or_object_elements()) {
+    } else if (map->has_fast_smi_elements()) {
       if (has_double_maps) return NULL;
-      has_smi_or_object_maps = true;
+      if (access_type == STORE && has_object_maps) return NULL;
+      has_smi_maps = true;
+    } else if (map->has_fast_object_elements()) {
+      if (has_double_maps) return NULL;
+      if (access_type == STORE && has_smi_maps) return NULL;
+      has_object_maps = true;
     } else {
       return NULL;
     }
@@ -7176,7 +7202,7 @@ HInstruction* HOptimizedGraphBuilder::TryBuildConsolidatedElementLoad(
     if (IsHoleyElementsKind(map->elements_kind())) {
       has_seen_holey_elements = true;
     }
-    // Remember the most general elements kind, the code for its load will
+    // Remember the most general elements kind, the code for its access will
     // properly handle all of the more specific cases.
     if ((i == 0) || IsMoreGeneralElementsKindTransition(
             most_general_consolidated_map->elements_kind(),
@@ -7184,11 +7210,11 @@ HInstruction* HOptimizedGraphBuilder::TryBuildConsolidatedElementLoad(
       most_general_consolidated_map = map;
     }
   }
-  if (!has_double_maps && !has_smi_or_object_maps) return NULL;
+  if (!has_double_maps && !has_smi_maps && !has_object_maps) return NULL;
 
   HCheckMaps* checked_object = Add<HCheckMaps>(object, maps);
   // FAST_ELEMENTS is considered more general than FAST_HOLEY_SMI_ELEMENTS.
-  // If we've seen both, the consolidated load must use FAST_HOLEY_ELEMENTS.
+  // If we've seen both, the consolidated access must use FAST_HOLEY_ELEMENTS.
   ElementsKind consolidated_elements_kind = has_seen_holey_elements
       ? GetHoleyElementsKind(most_general_consolidated_map->elements_kind())
       : most_general_consolidated_map->elements_kind();
@@ -7196,7 +7222,7 @@ HInstruction* HOptimizedGraphBuilder::TryBuildConsolidatedElementLoad(
       checked_object, key, val,
       most_general_consolidated_map->instance_type() == JS_ARRAY_TYPE,
       consolidated_elements_kind,
-      LOAD, NEVER_RETURN_HOLE, STANDARD_STORE);
+      access_type, NEVER_RETURN_HOLE, store_mode);
   return instr;
 }
 
@@ -7213,13 +7239,11 @@ HValue* HOptimizedGraphBuilder::HandlePolymorphicElementAccess(
   *has_side_effects = false;
   BuildCheckHeapObject(object);
 
-  if (access_type == LOAD) {
-    HInstruction* consolidated_load =
-        TryBuildConsolidatedElementLoad(object, key, val, maps);
-    if (consolidated_load != NULL) {
-      *has_side_effects |= consolidated_load->HasObservableSideEffects();
-      return consolidated_load;
-    }
+  HInstruction* consolidated_access = TryBuildConsolidatedElementAccess(
+      object, key, val, maps, access_type, store_mode);
+  if (consolidated_access != NULL) {
+    *has_side_effects |= consolidated_access->HasObservableSideEffects();
+    return access_type == STORE ? val : consolidated_access;
   }
 
   // Elements_kind transition support.
@@ -7686,8 +7710,36 @@ HInstruction* HOptimizedGraphBuilder::NewArgumentAdaptorCall(
 }
 
 
+int HOptimizedGraphBuilder::PadUnderAppliedArguments(
+    Handle<JSFunction> target, int argument_count) {
+  int formal_parameter_count =
+      target->shared()->internal_formal_parameter_count();
+  int arity = argument_count - 1;
+  if (formal_parameter_count ==
+          SharedFunctionInfo::kDontAdaptArgumentsSentinel ||
+      arity >= formal_parameter_count ||
+      target->shared()->uses_arguments()) {
+    return argument_count;
+  }
+  // Under-application of a function that does not touch its arguments
+  // object: store undefined into the out-arg slots of the missing trailing
+  // parameters right at the call site, so the function can be invoked
+  // directly with its expected arity instead of through the arguments
+  // adaptor frame. This must be called after the actual arguments have been
+  // pushed; the padding then lands exactly where the callee expects its
+  // missing parameters.
+  HPushArguments* push_args = New<HPushArguments>();
+  for (int i = arity; i < formal_parameter_count; ++i) {
+    push_args->AddInput(graph()->GetConstantUndefined());
+  }
+  AddInstruction(push_args);
+  return formal_parameter_count + 1;
+}
+
+
 HInstruction* HOptimizedGraphBuilder::BuildCallConstantFunction(
     Handle<JSFunction> jsfun, int argument_count) {
+  argument_count = PadUnderAppliedArguments(jsfun, argument_count);
   HValue* target = Add<HConstant>(jsfun);
   // For constant functions, we try to avoid calling the
   // argument adaptor and instead call the function directly
@@ -7750,9 +7802,8 @@ void HOptimizedGraphBuilder::HandlePolymorphicCallNamed(Call* expr,
   bool handled_string = false;
   int ordered_functions = 0;
 
-  int i;
-  for (i = 0; i < maps->length() && ordered_functions < kMaxCallPolymorphism;
-       ++i) {
+  for (int i = 0;
+       i < maps->length() && ordered_functions < kMaxCallPolymorphism; ++i) {
     PropertyAccessInfo info(this, LOAD, maps->at(i), name);
     if (info.CanAccessMonomorphic() && info.IsDataConstant() &&
         info.constant()->IsJSFunction()) {
@@ -7770,13 +7821,12 @@ void HOptimizedGraphBuilder::HandlePolymorphicCallNamed(Call* expr,
     }
   }
 
+  // Order the targets by hotness so that the dominant receiver shapes are
+  // checked (and possibly inlined) first; maps beyond kMaxCallPolymorphism
+  // fall through to the generic call below instead of discarding the map
+  // checks altogether.
   std::sort(order, order + ordered_functions);
 
-  if (i < maps->length()) {
-    maps->Clear();
-    ordered_functions = -1;
-  }
-
   HBasicBlock* number_block = NULL;
   HBasicBlock* join = NULL;
   handled_string = false;
@@ -7839,7 +7889,10 @@ void HOptimizedGraphBuilder::HandlePolymorphicCallNamed(Call* expr,
     Push(receiver);
     CHECK_ALIVE(VisitExpressions(expr->arguments()));
     bool needs_wrapping = info.NeedsWrappingFor(target);
-    bool try_inline = FLAG_polymorphic_inlining && !needs_wrapping;
+    // Only consider the hottest targets for inlining; the rest are called
+    // directly so that dispatch-heavy sites don't blow up in code size.
+    bool try_inline = FLAG_polymorphic_inlining && !needs_wrapping &&
+                      count <= kMaxPolymorphicInlinedCalls;
     if (FLAG_trace_inlining && try_inline) {
       Handle<JSFunction> caller = current_info()->closure();
       SmartArrayPointer<char> caller_name =
@@ -7857,11 +7910,17 @@ void HOptimizedGraphBuilder::HandlePolymorphicCallNamed(Call* expr,
       // use the regular CallFunctionStub for method calls to wrap the receiver.
       // TODO(verwaest): Support creation of value wrappers directly in
       // HWrapReceiver.
-      HInstruction* call = needs_wrapping
-          ? NewUncasted<HCallFunction>(
-              function, argument_count, WRAP_AND_CALL)
-          : BuildCallConstantFunction(target, argument_count);
-      PushArgumentsFromEnvironment(argument_count);
+      HInstruction* call;
+      if (needs_wrapping) {
+        call = NewUncasted<HCallFunction>(
+            function, argument_count, WRAP_AND_CALL);
+        PushArgumentsFromEnvironment(argument_count);
+      } else {
+        // Push the arguments first; BuildCallConstantFunction may pad an
+        // under-applied call with trailing undefined values.
+        PushArgumentsFromEnvironment(argument_count);
+        call = BuildCallConstantFunction(target, argument_count);
+      }
       AddInstruction(call);
       Drop(1);  // Drop the function.
       if (!ast_context()->IsEffect()) Push(call);
@@ -8991,6 +9050,10 @@ void HOptimizedGraphBuilder::HandleIndirectCall(Call* expr, HValue* function,
   }
 
   PushArgumentsFromEnvironment(arguments_count);
+  if (!known_function.is_null()) {
+    arguments_count = PadUnderAppliedArguments(known_function,
+                                               arguments_count);
+  }
   HInvokeFunction* call =
       New<HInvokeFunction>(function, known_function, arguments_count);
   Drop(1);  // Function
@@ -9094,6 +9157,67 @@ void HOptimizedGraphBuilder::BuildFunctionCall(Call* expr) {
 }
 
 
+// f(...) where f is a bound function: call through to the bound target,
+// bypassing the bind trampoline.
+bool HOptimizedGraphBuilder::TryHandleBoundFunctionCall(Call* expr) {
+  Handle<JSFunction> bound_function = expr->target();
+  if (!bound_function->shared()->bound()) return false;
+
+  Handle<FixedArray> bindings(bound_function->function_bindings());
+  Handle<Object> bound_target(bindings->get(JSFunction::kBoundFunctionIndex),
+                              isolate());
+  // Function proxies can be bound as well; leave those to the trampoline.
+  if (!bound_target->IsJSFunction()) return false;
+  Handle<JSFunction> target = Handle<JSFunction>::cast(bound_target);
+  // Nested bindings are flattened when the bound function is created.
+  DCHECK(!target->shared()->bound());
+
+  Handle<Object> bound_this(bindings->get(JSFunction::kBoundThisIndex),
+                            isolate());
+  bool implicit_receiver = false;
+  if (is_sloppy(target->shared()->language_mode()) &&
+      !target->shared()->native() && !bound_this->IsJSReceiver()) {
+    if (!bound_this->IsUndefined() && !bound_this->IsNull()) {
+      // A primitive receiver would be wrapped in its value wrapper on
+      // entry to a sloppy-mode target; leave that to the trampoline.
+      return false;
+    }
+    // ImplicitReceiverFor cannot embed the global proxy when serializing.
+    if (isolate()->serializer_enabled()) return false;
+    implicit_receiver = true;
+  }
+
+  int bound_argument_count =
+      bindings->length() - JSFunction::kBoundArgumentsStartIndex;
+  int argument_count = expr->arguments()->length();
+
+  // The call site is monomorphic in the bound function and its bindings
+  // are immutable, so the target and the bound values can be embedded as
+  // constants. Rewrite the expression stack from
+  //   [f, receiver, a1, ..., aN]
+  // to
+  //   [target, bound_this, b1, ..., bM, a1, ..., aN]
+  // and dispatch through the machinery shared with .call and .apply.
+  ZoneList<HValue*> arguments(argument_count, zone());
+  for (int i = 0; i < argument_count; ++i) arguments.Add(Pop(), zone());
+  HValue* target_value = Add<HConstant>(target);
+  environment()->SetExpressionStackAt(1, target_value);
+  environment()->SetExpressionStackAt(
+      0, implicit_receiver ? ImplicitReceiverFor(target_value, target)
+                           : Add<HConstant>(bound_this));
+  for (int i = 0; i < bound_argument_count; ++i) {
+    Push(Add<HConstant>(
+        handle(bindings->get(JSFunction::kBoundArgumentsStartIndex + i),
+               isolate())));
+  }
+  for (int i = argument_count - 1; i >= 0; --i) Push(arguments.at(i));
+
+  HandleIndirectCall(expr, target_value,
+                     bound_argument_count + argument_count + 1);
+  return true;
+}
+
+
 HValue* HOptimizedGraphBuilder::ImplicitReceiverFor(HValue* function,
                                                     Handle<JSFunction> target) {
   SharedFunctionInfo* shared = target->shared();
@@ -9364,6 +9488,10 @@ void HOptimizedGraphBuilder::VisitCall(Call* expr) {
       if (TryIndirectCall(expr)) return;
       CHECK_ALIVE(VisitExpressions(expr->arguments()));
 
+      // The function is a constant, so no HCheckValue is needed to
+      // guarantee its identity for calling through a binding.
+      if (TryHandleBoundFunctionCall(expr)) return;
+
       Handle<Map> map = maps->length() == 1 ? maps->first() : Handle<Map>();
       if (TryInlineBuiltinMethodCall(expr, known_function, map,
                                      expr->arguments()->length())) {
@@ -9385,9 +9513,13 @@ void HOptimizedGraphBuilder::VisitCall(Call* expr) {
         // HWrapReceiver.
         call = New<HCallFunction>(
             function, argument_count, WRAP_AND_CALL);
+        PushArgumentsFromEnvironment(argument_count);
       } else if (TryInlineCall(expr)) {
         return;
       } else {
+        // Push the arguments first; BuildCallConstantFunction may pad an
+        // under-applied call with trailing undefined values.
+        PushArgumentsFromEnvironment(argument_count);
         call = BuildCallConstantFunction(known_function, argument_count);
       }
 
@@ -9410,8 +9542,8 @@ void HOptimizedGraphBuilder::VisitCall(Call* expr) {
       CallFunctionFlags flags = receiver->type().IsJSObject()
           ? NO_CALL_FUNCTION_FLAGS : CALL_AS_METHOD;
       call = New<HCallFunction>(function, argument_count, flags);
+      PushArgumentsFromEnvironment(argument_count);
     }
-    PushArgumentsFromEnvironment(argument_count);
 
   } else {
     VariableProxy* proxy = expr->expression()->AsVariableProxy();
@@ -9437,6 +9569,8 @@ void HOptimizedGraphBuilder::VisitCall(Call* expr) {
     if (expr->IsMonomorphic()) {
       Add<HCheckValue>(function, expr->target());
 
+      if (TryHandleBoundFunctionCall(expr)) return;
+
       // Patch the global object on the stack by the expected receiver.
       HValue* receiver = ImplicitReceiverFor(function, expr->target());
       const int receiver_index = argument_count - 1;
@@ -10103,6 +10237,314 @@ void HOptimizedGraphBuilder::GenerateTypedArrayGetLength(
 }
 
 
+static int DataViewElementSize(ExternalArrayType type) {
+  switch (type) {
+#define TYPED_ARRAY_CASE(Type, type, TYPE, ctype, size) \
+  case kExternal##Type##Array:                          \
+    return size;
+    TYPED_ARRAYS(TYPED_ARRAY_CASE)
+#undef TYPED_ARRAY_CASE
+  }
+  UNREACHABLE();
+  return 0;
+}
+
+
+// Emits the common prologue of the DataView accessor intrinsics: deopt if
+// the underlying buffer has been neutered, check that all accessed bytes
+// are in bounds and compute the address of the first one. The caller has
+// already checked that the receiver is a JSDataView and that the byte
+// offset is a positive integer.
+HValue* HOptimizedGraphBuilder::BuildDataViewAccessSetup(HValue* view,
+                                                         HValue* byte_offset,
+                                                         int element_size,
+                                                         HValue** checked_key) {
+  Add<HCheckArrayBufferNotNeutered>(view);
+
+  HValue* byte_length = Add<HLoadNamedField>(
+      view, nullptr,
+      HObjectAccess::ForObservableJSObjectOffset(
+          JSArrayBufferView::kByteLengthOffset, Representation::Tagged()));
+  HValue* last_valid_offset = byte_length;
+  if (element_size > 1) {
+    HInstruction* adjusted =
+        AddUncasted<HSub>(byte_length, Add<HConstant>(element_size - 1));
+    adjusted->ClearFlag(HValue::kCanOverflow);
+    last_valid_offset = adjusted;
+  }
+  *checked_key = Add<HBoundsCheck>(byte_offset, last_valid_offset);
+
+  HValue* view_byte_offset = Add<HLoadNamedField>(
+      view, nullptr,
+      HObjectAccess::ForObservableJSObjectOffset(
+          JSArrayBufferView::kByteOffsetOffset, Representation::Tagged()));
+  HValue* buffer = Add<HLoadNamedField>(
+      view, nullptr, HObjectAccess::ForJSArrayBufferViewBuffer());
+  HValue* backing_store = Add<HLoadNamedField>(
+      buffer, nullptr, HObjectAccess::ForJSArrayBufferBackingStore());
+  HInstruction* data_start =
+      AddUncasted<HAdd>(backing_store, view_byte_offset);
+  data_start->ClearFlag(HValue::kCanOverflow);
+  return data_start;
+}
+
+
+// Loads the |element_size| bytes starting at |key| and combines them into
+// an untagged integer, taking byte |first_significance| as least
+// significant and stepping significance by |significance_step| (+1 for
+// little endian byte order, -1 with the last byte first for big endian).
+// The most significant byte is sign extended for signed types.
+HValue* HOptimizedGraphBuilder::BuildDataViewCombineBytes(
+    HValue* data_start, HValue* key, int element_size, int first_significance,
+    int significance_step, bool is_signed) {
+  HValue* result = NULL;
+  for (int i = 0; i < element_size; i++) {
+    int significance = first_significance + i * significance_step;
+    HValue* index = key;
+    if (i != 0) {
+      HInstruction* advanced = AddUncasted<HAdd>(key, Add<HConstant>(i));
+      advanced->ClearFlag(HValue::kCanOverflow);
+      index = advanced;
+    }
+    bool is_most_significant = significance == element_size - 1;
+    ElementsKind kind = (is_signed && is_most_significant)
+                            ? EXTERNAL_INT8_ELEMENTS
+                            : EXTERNAL_UINT8_ELEMENTS;
+    HValue* byte = AddElementAccess(data_start, index, NULL, NULL, kind, LOAD);
+    if (significance != 0) {
+      byte = AddUncasted<HShl>(byte, Add<HConstant>(8 * significance));
+    }
+    result = (result == NULL) ? byte
+                              : AddUncasted<HBitwise>(Token::BIT_OR, result,
+                                                      byte);
+  }
+  return result;
+}
+
+
+// Stores the |element_size| low-order bytes of the untagged integer
+// |value|, using the same significance scheme as above.
+void HOptimizedGraphBuilder::BuildDataViewScatterBytes(
+    HValue* data_start, HValue* key, HValue* value, int element_size,
+    int first_significance, int significance_step) {
+  for (int i = 0; i < element_size; i++) {
+    int significance = first_significance + i * significance_step;
+    HValue* index = key;
+    if (i != 0) {
+      HInstruction* advanced = AddUncasted<HAdd>(key, Add<HConstant>(i));
+      advanced->ClearFlag(HValue::kCanOverflow);
+      index = advanced;
+    }
+    HValue* byte = value;
+    if (significance != 0) {
+      byte = AddUncasted<HSar>(value, Add<HConstant>(8 * significance));
+    }
+    AddElementAccess(data_start, index, byte, NULL, EXTERNAL_UINT8_ELEMENTS,
+                     STORE);
+  }
+}
+
+
+void HOptimizedGraphBuilder::BuildDataViewGet(CallRuntime* expr,
+                                              ExternalArrayType type) {
+  DCHECK(expr->arguments()->length() == 3);
+  CHECK_ALIVE(VisitForValue(expr->arguments()->at(0)));
+  CHECK_ALIVE(VisitForValue(expr->arguments()->at(1)));
+  CHECK_ALIVE(VisitForValue(expr->arguments()->at(2)));
+  HValue* is_little_endian = Pop();
+  HValue* byte_offset = Pop();
+  HValue* view = Pop();
+
+  int element_size = DataViewElementSize(type);
+  bool is_signed = type == kExternalInt8Array || type == kExternalInt16Array ||
+                   type == kExternalInt32Array;
+
+  HValue* checked_key = NULL;
+  HValue* data_start =
+      BuildDataViewAccessSetup(view, byte_offset, element_size, &checked_key);
+
+  HValue* result;
+  if (element_size == 1) {
+    result = BuildDataViewCombineBytes(data_start, checked_key, 1, 0, 1,
+                                       is_signed);
+  } else {
+    IfBuilder byte_order(this);
+    byte_order.If<HCompareObjectEqAndBranch>(is_little_endian,
+                                             graph()->GetConstantTrue());
+    byte_order.Then();
+    if (type == kExternalFloat64Array) {
+      HValue* lo = BuildDataViewCombineBytes(data_start, checked_key, 4, 0, 1,
+                                             false);
+      HValue* hi = BuildDataViewCombineBytes(
+          data_start, AddUncasted<HAdd>(checked_key, Add<HConstant>(4)), 4, 0,
+          1, false);
+      Push(AddUncasted<HConstructDouble>(hi, lo));
+    } else {
+      Push(BuildDataViewCombineBytes(data_start, checked_key, element_size, 0,
+                                     1, is_signed));
+    }
+    byte_order.Else();
+    if (type == kExternalFloat64Array) {
+      HValue* hi = BuildDataViewCombineBytes(data_start, checked_key, 4, 3, -1,
+                                             false);
+      HValue* lo = BuildDataViewCombineBytes(
+          data_start, AddUncasted<HAdd>(checked_key, Add<HConstant>(4)), 4, 3,
+          -1, false);
+      Push(AddUncasted<HConstructDouble>(hi, lo));
+    } else {
+      Push(BuildDataViewCombineBytes(data_start, checked_key, element_size,
+                                     element_size - 1, -1, is_signed));
+    }
+    byte_order.End();
+    result = Pop();
+  }
+
+  if (type == kExternalUint32Array) {
+    // The combined value carries the raw bit pattern in an int32; values
+    // with the top bit set have to be returned as positive numbers.
+    IfBuilder if_negative(this);
+    if_negative.If<HCompareNumericAndBranch>(result, graph()->GetConstant0(),
+                                             Token::LT);
+    if_negative.Then();
+    Push(AddUncasted<HAdd>(result, Add<HConstant>(4294967296.0)));
+    if_negative.Else();
+    Push(result);
+    if_negative.End();
+    result = Pop();
+  }
+
+  return ast_context()->ReturnValue(result);
+}
+
+
+void HOptimizedGraphBuilder::BuildDataViewSet(CallRuntime* expr,
+                                              ExternalArrayType type) {
+  DCHECK(expr->arguments()->length() == 4);
+  CHECK_ALIVE(VisitForValue(expr->arguments()->at(0)));
+  CHECK_ALIVE(VisitForValue(expr->arguments()->at(1)));
+  CHECK_ALIVE(VisitForValue(expr->arguments()->at(2)));
+  CHECK_ALIVE(VisitForValue(expr->arguments()->at(3)));
+  HValue* is_little_endian = Pop();
+  HValue* value = Pop();
+  HValue* byte_offset = Pop();
+  HValue* view = Pop();
+
+  int element_size = DataViewElementSize(type);
+
+  HValue* checked_key = NULL;
+  HValue* data_start =
+      BuildDataViewAccessSetup(view, byte_offset, element_size, &checked_key);
+
+  if (element_size == 1) {
+    AddElementAccess(data_start, checked_key, value, NULL,
+                     EXTERNAL_UINT8_ELEMENTS, STORE);
+  } else {
+    HValue* hi = NULL;
+    HValue* lo = NULL;
+    if (type == kExternalFloat64Array) {
+      hi = AddUncasted<HDoubleBits>(value, HDoubleBits::HIGH);
+      lo = AddUncasted<HDoubleBits>(value, HDoubleBits::LOW);
+    }
+    IfBuilder byte_order(this);
+    byte_order.If<HCompareObjectEqAndBranch>(is_little_endian,
+                                             graph()->GetConstantTrue());
+    byte_order.Then();
+    if (type == kExternalFloat64Array) {
+      BuildDataViewScatterBytes(data_start, checked_key, lo, 4, 0, 1);
+      BuildDataViewScatterBytes(
+          data_start, AddUncasted<HAdd>(checked_key, Add<HConstant>(4)), hi, 4,
+          0, 1);
+    } else {
+      BuildDataViewScatterBytes(data_start, checked_key, value, element_size,
+                                0, 1);
+    }
+    byte_order.Else();
+    if (type == kExternalFloat64Array) {
+      BuildDataViewScatterBytes(data_start, checked_key, hi, 4, 3, -1);
+      BuildDataViewScatterBytes(
+          data_start, AddUncasted<HAdd>(checked_key, Add<HConstant>(4)), lo, 4,
+          3, -1);
+    } else {
+      BuildDataViewScatterBytes(data_start, checked_key, value, element_size,
+                                element_size - 1, -1);
+    }
+    byte_order.End();
+  }
+
+  return ast_context()->ReturnValue(graph()->GetConstantUndefined());
+}
+
+
+void HOptimizedGraphBuilder::GenerateDataViewGetInt8(CallRuntime* expr) {
+  return BuildDataViewGet(expr, kExternalInt8Array);
+}
+
+
+void HOptimizedGraphBuilder::GenerateDataViewGetUint8(CallRuntime* expr) {
+  return BuildDataViewGet(expr, kExternalUint8Array);
+}
+
+
+void HOptimizedGraphBuilder::GenerateDataViewGetInt16(CallRuntime* expr) {
+  return BuildDataViewGet(expr, kExternalInt16Array);
+}
+
+
+void HOptimizedGraphBuilder::GenerateDataViewGetUint16(CallRuntime* expr) {
+  return BuildDataViewGet(expr, kExternalUint16Array);
+}
+
+
+void HOptimizedGraphBuilder::GenerateDataViewGetInt32(CallRuntime* expr) {
+  return BuildDataViewGet(expr, kExternalInt32Array);
+}
+
+
+void HOptimizedGraphBuilder::GenerateDataViewGetUint32(CallRuntime* expr) {
+  return BuildDataViewGet(expr, kExternalUint32Array);
+}
+
+
+void HOptimizedGraphBuilder::GenerateDataViewGetFloat64(CallRuntime* expr) {
+  return BuildDataViewGet(expr, kExternalFloat64Array);
+}
+
+
+void HOptimizedGraphBuilder::GenerateDataViewSetInt8(CallRuntime* expr) {
+  return BuildDataViewSet(expr, kExternalInt8Array);
+}
+
+
+void HOptimizedGraphBuilder::GenerateDataViewSetUint8(CallRuntime* expr) {
+  return BuildDataViewSet(expr, kExternalUint8Array);
+}
+
+
+void HOptimizedGraphBuilder::GenerateDataViewSetInt16(CallRuntime* expr) {
+  return BuildDataViewSet(expr, kExternalInt16Array);
+}
+
+
+void HOptimizedGraphBuilder::GenerateDataViewSetUint16(CallRuntime* expr) {
+  return BuildDataViewSet(expr, kExternalUint16Array);
+}
+
+
+void HOptimizedGraphBuilder::GenerateDataViewSetInt32(CallRuntime* expr) {
+  return BuildDataViewSet(expr, kExternalInt32Array);
+}
+
+
+void HOptimizedGraphBuilder::GenerateDataViewSetUint32(CallRuntime* expr) {
+  return BuildDataViewSet(expr, kExternalUint32Array);
+}
+
+
+void HOptimizedGraphBuilder::GenerateDataViewSetFloat64(CallRuntime* expr) {
+  return BuildDataViewSet(expr, kExternalFloat64Array);
+}
+
+
 void HOptimizedGraphBuilder::VisitCallRuntime(CallRuntime* expr) {
   DCHECK(!HasStackOverflow());
   DCHECK(current_block() != NULL);
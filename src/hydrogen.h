@@ -2125,10 +2125,15 @@ class HOptimizedGraphBuilder : public HGraphBuilder, public AstVisitor {
   // Forward declarations for inner scope classes.
   class SubgraphScope;
 
-  static const int kMaxCallPolymorphism = 4;
+  static const int kMaxCallPolymorphism = 6;
   static const int kMaxLoadPolymorphism = 4;
   static const int kMaxStorePolymorphism = 4;
 
+  // Only the hottest targets of a polymorphic call site are considered for
+  // inlining; the remaining maps still get a direct call to their constant
+  // target behind the map check.
+  static const int kMaxPolymorphicInlinedCalls = 2;
+
   // Even in the 'unlimited' case we have to have some limit in order not to
   // overflow the stack.
   static const int kUnlimitedMaxInlinedSourceSize = 100000;
@@ -2218,6 +2223,21 @@ class HOptimizedGraphBuilder : public HGraphBuilder, public AstVisitor {
   F(ArrayBufferViewGetByteLength)      \
   F(ArrayBufferViewGetByteOffset)      \
   F(TypedArrayGetLength)               \
+  /* DataView */                       \
+  F(DataViewGetInt8)                   \
+  F(DataViewGetUint8)                  \
+  F(DataViewGetInt16)                  \
+  F(DataViewGetUint16)                 \
+  F(DataViewGetInt32)                  \
+  F(DataViewGetUint32)                 \
+  F(DataViewGetFloat64)                \
+  F(DataViewSetInt8)                   \
+  F(DataViewSetUint8)                  \
+  F(DataViewSetInt16)                  \
+  F(DataViewSetUint16)                 \
+  F(DataViewSetInt32)                  \
+  F(DataViewSetUint32)                 \
+  F(DataViewSetFloat64)                \
   /* ArrayBuffer */                    \
   F(ArrayBufferGetByteLength)          \
   /* Maths */                          \
@@ -2250,6 +2270,21 @@ class HOptimizedGraphBuilder : public HGraphBuilder, public AstVisitor {
   FOR_EACH_HYDROGEN_INTRINSIC(GENERATOR_DECLARATION)
 #undef GENERATOR_DECLARATION
 
+  // Shared code for the DataView accessor intrinsics. Float32 accessors
+  // have no generator because there is no instruction to transfer raw
+  // float bits; they take the runtime call path.
+  HValue* BuildDataViewAccessSetup(HValue* view, HValue* byte_offset,
+                                   int element_size, HValue** checked_key);
+  HValue* BuildDataViewCombineBytes(HValue* data_start, HValue* key,
+                                    int element_size, int first_significance,
+                                    int significance_step, bool is_signed);
+  void BuildDataViewScatterBytes(HValue* data_start, HValue* key,
+                                 HValue* value, int element_size,
+                                 int first_significance,
+                                 int significance_step);
+  void BuildDataViewGet(CallRuntime* expr, ExternalArrayType type);
+  void BuildDataViewSet(CallRuntime* expr, ExternalArrayType type);
+
   void VisitDelete(UnaryOperation* expr);
   void VisitVoid(UnaryOperation* expr);
   void VisitTypeof(UnaryOperation* expr);
@@ -2378,6 +2413,9 @@ class HOptimizedGraphBuilder : public HGraphBuilder, public AstVisitor {
   bool TryIndirectCall(Call* expr);
   void BuildFunctionApply(Call* expr);
   void BuildFunctionCall(Call* expr);
+  // Try to call through a monomorphic bound function directly to its
+  // bound target.
+  bool TryHandleBoundFunctionCall(Call* expr);
 
   bool TryHandleArrayCall(Call* expr, HValue* function);
   bool TryHandleArrayCallNew(CallNew* expr, HValue* function);
@@ -2746,10 +2784,13 @@ class HOptimizedGraphBuilder : public HGraphBuilder, public AstVisitor {
                                   HValue* key,
                                   HValue* value);
 
-  HInstruction* TryBuildConsolidatedElementLoad(HValue* object,
-                                                HValue* key,
-                                                HValue* val,
-                                                SmallMapList* maps);
+  HInstruction* TryBuildConsolidatedElementAccess(
+      HValue* object,
+      HValue* key,
+      HValue* val,
+      SmallMapList* maps,
+      PropertyAccessType access_type,
+      KeyedAccessStoreMode store_mode);
 
   LoadKeyedHoleMode BuildKeyedHoleMode(Handle<Map> map);
 
@@ -2848,6 +2889,12 @@ class HOptimizedGraphBuilder : public HGraphBuilder, public AstVisitor {
                                        int argument_count,
                                        HValue* expected_param_count);
 
+  // Pads an under-applied call to |target| with undefined values, so that
+  // the function can be invoked directly with its expected arity instead of
+  // through the arguments adaptor. Call after the actual arguments have been
+  // pushed; returns the resulting argument count including the receiver.
+  int PadUnderAppliedArguments(Handle<JSFunction> target, int argument_count);
+
   HInstruction* BuildCallConstantFunction(Handle<JSFunction> target,
                                           int argument_count);
 
@@ -676,6 +676,104 @@ Handle<ObjectTemplateInfo> I18N::GetTemplate2(Isolate* isolate) {
 }
 
 
+ICUServiceCache::~ICUServiceCache() {
+  Clear();
+}
+
+
+icu::UObject* ICUServiceCache::Lookup(Service service,
+                                      const std::string& key) {
+  for (int i = 0; i < kCapacity; i++) {
+    Entry& entry = entries_[i];
+    if (entry.backend != NULL && entry.service == service &&
+        entry.key == key) {
+      entry.age = ++age_;
+      return entry.backend;
+    }
+  }
+  return NULL;
+}
+
+
+void ICUServiceCache::Insert(Service service, const std::string& key,
+                             icu::UObject* backend) {
+  Entry* victim = &entries_[0];
+  for (int i = 1; i < kCapacity; i++) {
+    if (victim->backend == NULL) break;
+    if (entries_[i].backend == NULL || entries_[i].age < victim->age) {
+      victim = &entries_[i];
+    }
+  }
+  delete victim->backend;
+  victim->service = service;
+  victim->key = key;
+  victim->backend = backend;
+  victim->age = ++age_;
+}
+
+
+void ICUServiceCache::Clear() {
+  for (int i = 0; i < kCapacity; i++) {
+    delete entries_[i].backend;
+    entries_[i].backend = NULL;
+    entries_[i].key.clear();
+  }
+}
+
+
+// static
+bool ICUServiceCache::MakeKey(Isolate* isolate, Handle<String> locale,
+                              Handle<JSObject> options, std::string* key) {
+  // The options bags the library passes in are plain objects holding only
+  // primitive data properties, added in a fixed order, so identical
+  // requests flatten to identical keys. Anything else (accessors,
+  // interceptors, dictionary mode) is not cacheable.
+  if (!options->HasFastProperties() || options->IsAccessCheckNeeded() ||
+      options->HasNamedInterceptor() || options->HasIndexedInterceptor()) {
+    return false;
+  }
+
+  v8::String::Utf8Value bcp47_locale(v8::Utils::ToLocal(locale));
+  if (*bcp47_locale == NULL) return false;
+  key->assign(*bcp47_locale);
+
+  Handle<Map> map(options->map());
+  int own = map->NumberOfOwnDescriptors();
+  for (int i = 0; i < own; i++) {
+    PropertyDetails details = map->instance_descriptors()->GetDetails(i);
+    if (details.type() != DATA && details.type() != DATA_CONSTANT) {
+      return false;
+    }
+    Handle<Name> name(map->instance_descriptors()->GetKey(i), isolate);
+    if (!name->IsString()) return false;
+    Handle<Object> value = JSReceiver::GetDataProperty(options, name);
+    v8::String::Utf8Value utf8_name(
+        v8::Utils::ToLocal(Handle<String>::cast(name)));
+    if (*utf8_name == NULL) return false;
+    key->push_back('\1');
+    key->append(*utf8_name);
+    key->push_back('=');
+    if (value->IsString()) {
+      v8::String::Utf8Value utf8_value(
+          v8::Utils::ToLocal(Handle<String>::cast(value)));
+      if (*utf8_value == NULL) return false;
+      key->append(*utf8_value);
+    } else if (value->IsNumber()) {
+      EmbeddedVector<char, 32> buffer;
+      SNPrintF(buffer, "%g", value->Number());
+      key->append(buffer.start());
+    } else if (value->IsBoolean()) {
+      key->append(value->IsTrue() ? "true" : "false");
+    } else if (value->IsUndefined() || value->IsNull()) {
+      key->push_back('~');
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+
 // static
 icu::SimpleDateFormat* DateFormat::InitializeDateTimeFormat(
     Isolate* isolate,
@@ -697,6 +795,21 @@ icu::SimpleDateFormat* DateFormat::InitializeDateTimeFormat(
     icu_locale = icu::Locale(icu_result);
   }
 
+  ICUServiceCache* cache = isolate->icu_service_cache();
+  std::string cache_key;
+  bool cacheable =
+      ICUServiceCache::MakeKey(isolate, locale, options, &cache_key);
+  if (cacheable) {
+    icu::UObject* cached =
+        cache->Lookup(ICUServiceCache::kDateFormat, cache_key);
+    if (cached != NULL) {
+      icu::SimpleDateFormat* date_format = static_cast<icu::SimpleDateFormat*>(
+          static_cast<icu::SimpleDateFormat*>(cached)->clone());
+      SetResolvedDateSettings(isolate, icu_locale, date_format, resolved);
+      return date_format;
+    }
+  }
+
   icu::SimpleDateFormat* date_format = CreateICUDateFormat(
       isolate, icu_locale, options);
   if (!date_format) {
@@ -713,6 +826,10 @@ icu::SimpleDateFormat* DateFormat::InitializeDateTimeFormat(
         isolate, no_extension_locale, date_format, resolved);
   } else {
     SetResolvedDateSettings(isolate, icu_locale, date_format, resolved);
+    if (cacheable) {
+      cache->Insert(ICUServiceCache::kDateFormat, cache_key,
+                    date_format->clone());
+    }
   }
 
   return date_format;
@@ -776,6 +893,21 @@ icu::DecimalFormat* NumberFormat::InitializeNumberFormat(
     icu_locale = icu::Locale(icu_result);
   }
 
+  ICUServiceCache* cache = isolate->icu_service_cache();
+  std::string cache_key;
+  bool cacheable =
+      ICUServiceCache::MakeKey(isolate, locale, options, &cache_key);
+  if (cacheable) {
+    icu::UObject* cached =
+        cache->Lookup(ICUServiceCache::kNumberFormat, cache_key);
+    if (cached != NULL) {
+      icu::DecimalFormat* number_format = static_cast<icu::DecimalFormat*>(
+          static_cast<icu::DecimalFormat*>(cached)->clone());
+      SetResolvedNumberSettings(isolate, icu_locale, number_format, resolved);
+      return number_format;
+    }
+  }
+
   icu::DecimalFormat* number_format =
       CreateICUNumberFormat(isolate, icu_locale, options);
   if (!number_format) {
@@ -793,6 +925,10 @@ icu::DecimalFormat* NumberFormat::InitializeNumberFormat(
         isolate, no_extension_locale, number_format, resolved);
   } else {
     SetResolvedNumberSettings(isolate, icu_locale, number_format, resolved);
+    if (cacheable) {
+      cache->Insert(ICUServiceCache::kNumberFormat, cache_key,
+                    number_format->clone());
+    }
   }
 
   return number_format;
@@ -841,6 +977,20 @@ icu::Collator* Collator::InitializeCollator(
     icu_locale = icu::Locale(icu_result);
   }
 
+  ICUServiceCache* cache = isolate->icu_service_cache();
+  std::string cache_key;
+  bool cacheable =
+      ICUServiceCache::MakeKey(isolate, locale, options, &cache_key);
+  if (cacheable) {
+    icu::UObject* cached =
+        cache->Lookup(ICUServiceCache::kCollator, cache_key);
+    if (cached != NULL) {
+      icu::Collator* collator = static_cast<icu::Collator*>(cached)->clone();
+      SetResolvedCollatorSettings(isolate, icu_locale, collator, resolved);
+      return collator;
+    }
+  }
+
   icu::Collator* collator = CreateICUCollator(isolate, icu_locale, options);
   if (!collator) {
     // Remove extensions and try again.
@@ -856,6 +1006,9 @@ icu::Collator* Collator::InitializeCollator(
         isolate, no_extension_locale, collator, resolved);
   } else {
     SetResolvedCollatorSettings(isolate, icu_locale, collator, resolved);
+    if (cacheable) {
+      cache->Insert(ICUServiceCache::kCollator, cache_key, collator->clone());
+    }
   }
 
   return collator;
@@ -902,6 +1055,22 @@ icu::BreakIterator* BreakIterator::InitializeBreakIterator(
     icu_locale = icu::Locale(icu_result);
   }
 
+  ICUServiceCache* cache = isolate->icu_service_cache();
+  std::string cache_key;
+  bool cacheable =
+      ICUServiceCache::MakeKey(isolate, locale, options, &cache_key);
+  if (cacheable) {
+    icu::UObject* cached =
+        cache->Lookup(ICUServiceCache::kBreakIterator, cache_key);
+    if (cached != NULL) {
+      icu::BreakIterator* break_iterator =
+          static_cast<icu::BreakIterator*>(cached)->clone();
+      SetResolvedBreakIteratorSettings(
+          isolate, icu_locale, break_iterator, resolved);
+      return break_iterator;
+    }
+  }
+
   icu::BreakIterator* break_iterator = CreateICUBreakIterator(
       isolate, icu_locale, options);
   if (!break_iterator) {
@@ -920,6 +1089,10 @@ icu::BreakIterator* BreakIterator::InitializeBreakIterator(
   } else {
     SetResolvedBreakIteratorSettings(
         isolate, icu_locale, break_iterator, resolved);
+    if (cacheable) {
+      cache->Insert(ICUServiceCache::kBreakIterator, cache_key,
+                    break_iterator->clone());
+    }
   }
 
   return break_iterator;
@@ -6,6 +6,8 @@
 #ifndef V8_I18N_H_
 #define V8_I18N_H_
 
+#include <string>
+
 #include "src/v8.h"
 #include "unicode/uversion.h"
 
@@ -14,6 +16,7 @@ class BreakIterator;
 class Collator;
 class DecimalFormat;
 class SimpleDateFormat;
+class UObject;
 }
 
 namespace v8 {
@@ -32,6 +35,59 @@ class I18N {
 };
 
 
+// Per-isolate cache of ICU service objects, keyed by the service, the
+// requested locale and the flattened creation options. Creating an ICU
+// object resolves locale data anew every time, which dominates the cost of
+// instantiating an Intl object; repeated requests with identical options
+// are instead served by cloning a cached backend. The cache owns its
+// backends and evicts the least recently used entry when full.
+class ICUServiceCache {
+ public:
+  enum Service {
+    kCollator,
+    kNumberFormat,
+    kDateFormat,
+    kBreakIterator
+  };
+
+  ICUServiceCache() : age_(0) {}
+  ~ICUServiceCache();
+
+  // Returns the backend cached for (service, key), or NULL. The cache
+  // retains ownership; callers clone the returned object.
+  icu::UObject* Lookup(Service service, const std::string& key);
+
+  // Enters the backend into the cache, passing ownership to the cache.
+  void Insert(Service service, const std::string& key, icu::UObject* backend);
+
+  // Drops all cached backends, e.g. after a date/time configuration change.
+  void Clear();
+
+  // Flattens the requested locale and the creation options into a cache
+  // key. Returns false when the options bag is not a plain object holding
+  // only primitive data properties, in which case the request is not
+  // cacheable.
+  static bool MakeKey(Isolate* isolate, Handle<String> locale,
+                      Handle<JSObject> options, std::string* key);
+
+ private:
+  static const int kCapacity = 8;
+
+  struct Entry {
+    Entry() : backend(NULL), age(0) {}
+    Service service;
+    std::string key;
+    icu::UObject* backend;
+    int age;
+  };
+
+  Entry entries_[kCapacity];
+  int age_;
+
+  DISALLOW_COPY_AND_ASSIGN(ICUServiceCache);
+};
+
+
 class DateFormat {
  public:
   // Create a formatter for the specificied locale and options. Returns the
@@ -2262,6 +2262,12 @@ void CallIC_ArrayStub::Generate(MacroAssembler* masm) {
          factory->allocation_site_map());
   __ j(not_equal, &miss);
 
+  // Increment the call count; the count is kept in the upper bits of the
+  // extra vector slot, above the has-returned-minus-zero flag.
+  __ add(FieldOperand(ebx, edx, times_half_pointer_size,
+                      FixedArray::kHeaderSize + kPointerSize),
+         Immediate(Smi::FromInt(CallICNexus::kCallCountIncrement)));
+
   __ mov(ebx, ecx);
   __ mov(edx, edi);
   ArrayConstructorStub stub(masm->isolate(), arg_count());
@@ -2321,6 +2327,12 @@ void CallICStub::Generate(MacroAssembler* masm) {
   // convincing us that we have a monomorphic JSFunction.
   __ JumpIfSmi(edi, &extra_checks_or_miss);
 
+  // Increment the call count; the count is kept in the upper bits of the
+  // extra vector slot, above the has-returned-minus-zero flag.
+  __ add(FieldOperand(ebx, edx, times_half_pointer_size,
+                      FixedArray::kHeaderSize + kPointerSize),
+         Immediate(Smi::FromInt(CallICNexus::kCallCountIncrement)));
+
   __ bind(&have_js_function);
   if (CallAsMethod()) {
     EmitContinueIfStrictOrNative(masm, &cont);
@@ -2392,6 +2404,11 @@ void CallICStub::Generate(MacroAssembler* masm) {
   // Update stats.
   __ add(FieldOperand(ebx, with_types_offset), Immediate(Smi::FromInt(1)));
 
+  // Initialize the call count to one.
+  __ mov(FieldOperand(ebx, edx, times_half_pointer_size,
+                      FixedArray::kHeaderSize + kPointerSize),
+         Immediate(Smi::FromInt(CallICNexus::kCallCountIncrement)));
+
   // Store the function. Use a stub since we need a frame for allocation.
   // ebx - vector
   // edx - slot
@@ -3395,6 +3412,22 @@ void StringHelper::GenerateFlatOneByteStringEquals(MacroAssembler* masm,
 
   // Compare characters.
   __ bind(&compare_chars);
+
+  // Fast negative check: if both hash codes have been computed, different
+  // hashes mean different strings, and the characters never have to be
+  // looked at.
+  Label hash_not_usable;
+  STATIC_ASSERT(Name::kHashNotComputedMask != 0);
+  __ mov(scratch2, FieldOperand(left, String::kHashFieldOffset));
+  __ test(scratch2, Immediate(Name::kHashNotComputedMask));
+  __ j(not_zero, &hash_not_usable, Label::kNear);
+  __ test(FieldOperand(right, String::kHashFieldOffset),
+          Immediate(Name::kHashNotComputedMask));
+  __ j(not_zero, &hash_not_usable, Label::kNear);
+  __ cmp(scratch2, FieldOperand(right, String::kHashFieldOffset));
+  __ j(not_equal, &strings_not_equal);
+  __ bind(&hash_not_usable);
+
   GenerateOneByteCharsCompareLoop(masm, left, right, length, scratch2,
                                   &strings_not_equal, Label::kNear);
 
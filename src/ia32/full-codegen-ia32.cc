@@ -2204,12 +2204,27 @@ void FullCodeGenerator::EmitGeneratorResume(Expression *generator,
   __ mov(edx, FieldOperand(edx, FixedArray::kLengthOffset));
   __ SmiUntag(edx);
 
-  // If we are sending a value and there is no operand stack, we can jump back
-  // in directly.
+  // If we are sending a value, the saved operand stack (if any) holds plain
+  // values, so we can restore it inline and jump back in directly. The
+  // runtime is only needed to throw into the generator.
   if (resume_mode == JSGeneratorObject::NEXT) {
-    Label slow_resume;
-    __ cmp(edx, Immediate(0));
-    __ j(not_zero, &slow_resume);
+    // Push the saved operands, walking the backing store with ecx so that no
+    // extra register is needed.
+    Label push_operand, restore_done;
+    __ mov(ecx, FieldOperand(ebx, JSGeneratorObject::kOperandStackOffset));
+    __ bind(&push_operand);
+    __ sub(edx, Immediate(1));
+    __ j(carry, &restore_done);
+    __ push(FieldOperand(ecx, FixedArray::kHeaderSize));
+    __ add(ecx, Immediate(kPointerSize));
+    __ jmp(&push_operand);
+    __ bind(&restore_done);
+
+    // Detach the saved operand stack; the empty fixed array is immortal and
+    // immovable, so no write barrier is needed.
+    __ mov(FieldOperand(ebx, JSGeneratorObject::kOperandStackOffset),
+           Immediate(isolate()->factory()->empty_fixed_array()));
+
     __ mov(edx, FieldOperand(edi, JSFunction::kCodeEntryOffset));
     __ mov(ecx, FieldOperand(ebx, JSGeneratorObject::kContinuationOffset));
     __ SmiUntag(ecx);
@@ -2217,25 +2232,24 @@ void FullCodeGenerator::EmitGeneratorResume(Expression *generator,
     __ mov(FieldOperand(ebx, JSGeneratorObject::kContinuationOffset),
            Immediate(Smi::FromInt(JSGeneratorObject::kGeneratorExecuting)));
     __ jmp(edx);
-    __ bind(&slow_resume);
+  } else {
+    // Push holes for the operand stack and call the runtime to fix up the
+    // stack and throw the value.
+    Label push_operand_holes, call_resume;
+    __ bind(&push_operand_holes);
+    __ sub(edx, Immediate(1));
+    __ j(carry, &call_resume);
+    __ push(ecx);
+    __ jmp(&push_operand_holes);
+    __ bind(&call_resume);
+    __ push(ebx);
+    __ push(result_register());
+    __ Push(Smi::FromInt(resume_mode));
+    __ CallRuntime(Runtime::kResumeJSGeneratorObject, 3);
+    // Not reached: the runtime call returns elsewhere.
+    __ Abort(kGeneratorFailedToResume);
   }
 
-  // Otherwise, we push holes for the operand stack and call the runtime to fix
-  // up the stack and the handlers.
-  Label push_operand_holes, call_resume;
-  __ bind(&push_operand_holes);
-  __ sub(edx, Immediate(1));
-  __ j(carry, &call_resume);
-  __ push(ecx);
-  __ jmp(&push_operand_holes);
-  __ bind(&call_resume);
-  __ push(ebx);
-  __ push(result_register());
-  __ Push(Smi::FromInt(resume_mode));
-  __ CallRuntime(Runtime::kResumeJSGeneratorObject, 3);
-  // Not reached: the runtime call returns elsewhere.
-  __ Abort(kGeneratorFailedToResume);
-
   __ bind(&done);
   context()->Plug(result_register());
 }
@@ -2427,47 +2441,61 @@ void FullCodeGenerator::EmitClassDefineProperties(ClassLiteral* lit) {
   __ mov(scratch, FieldOperand(eax, JSFunction::kPrototypeOrInitialMapOffset));
   __ Push(scratch);
 
-  for (int i = 0; i < lit->properties()->length(); i++) {
-    ObjectLiteral::Property* property = lit->properties()->at(i);
-    Expression* value = property->value();
-
-    if (property->is_static()) {
-      __ push(Operand(esp, kPointerSize));  // constructor
-    } else {
-      __ push(Operand(esp, 0));  // prototype
-    }
-    EmitPropertyKey(property, lit->GetIdForProperty(i));
-
-    // The static prototype property is read only. We handle the non computed
-    // property name case in the parser. Since this is the only case where we
-    // need to check for an own read only property we special case this so we do
-    // not need to do this for every property.
-    if (property->is_static() && property->is_computed_name()) {
-      __ CallRuntime(Runtime::kThrowIfStaticPrototype, 1);
-      __ push(eax);
+  if (lit->HasOnlySimpleMethods()) {
+    // The class body consists only of plain prototype methods;
+    // install the whole method table with a single runtime call.
+    __ push(Operand(esp, 0));  // prototype
+    for (int i = 0; i < lit->properties()->length(); i++) {
+      ObjectLiteral::Property* property = lit->properties()->at(i);
+      EmitPropertyKey(property, lit->GetIdForProperty(i));
+      VisitForStackValue(property->value());
+      EmitSetHomeObjectIfNeeded(property->value(), 2 * i + 2);
     }
+    __ CallRuntime(Runtime::kDefineClassMethods,
+                   2 * lit->properties()->length() + 1);
+  } else {
+    for (int i = 0; i < lit->properties()->length(); i++) {
+      ObjectLiteral::Property* property = lit->properties()->at(i);
+      Expression* value = property->value();
 
-    VisitForStackValue(value);
-    EmitSetHomeObjectIfNeeded(value, 2);
+      if (property->is_static()) {
+        __ push(Operand(esp, kPointerSize));  // constructor
+      } else {
+        __ push(Operand(esp, 0));  // prototype
+      }
+      EmitPropertyKey(property, lit->GetIdForProperty(i));
+
+      // The static prototype property is read only. We handle the non
+      // computed property name case in the parser. Since this is the only
+      // case where we need to check for an own read only property we special
+      // case this so we do not need to do this for every property.
+      if (property->is_static() && property->is_computed_name()) {
+        __ CallRuntime(Runtime::kThrowIfStaticPrototype, 1);
+        __ push(eax);
+      }
 
-    switch (property->kind()) {
-      case ObjectLiteral::Property::CONSTANT:
-      case ObjectLiteral::Property::MATERIALIZED_LITERAL:
-      case ObjectLiteral::Property::PROTOTYPE:
-        UNREACHABLE();
-      case ObjectLiteral::Property::COMPUTED:
-        __ CallRuntime(Runtime::kDefineClassMethod, 3);
-        break;
+      VisitForStackValue(value);
+      EmitSetHomeObjectIfNeeded(value, 2);
 
-      case ObjectLiteral::Property::GETTER:
-        __ push(Immediate(Smi::FromInt(DONT_ENUM)));
-        __ CallRuntime(Runtime::kDefineGetterPropertyUnchecked, 4);
-        break;
+      switch (property->kind()) {
+        case ObjectLiteral::Property::CONSTANT:
+        case ObjectLiteral::Property::MATERIALIZED_LITERAL:
+        case ObjectLiteral::Property::PROTOTYPE:
+          UNREACHABLE();
+        case ObjectLiteral::Property::COMPUTED:
+          __ CallRuntime(Runtime::kDefineClassMethod, 3);
+          break;
 
-      case ObjectLiteral::Property::SETTER:
-        __ push(Immediate(Smi::FromInt(DONT_ENUM)));
-        __ CallRuntime(Runtime::kDefineSetterPropertyUnchecked, 4);
-        break;
+        case ObjectLiteral::Property::GETTER:
+          __ push(Immediate(Smi::FromInt(DONT_ENUM)));
+          __ CallRuntime(Runtime::kDefineGetterPropertyUnchecked, 4);
+          break;
+
+        case ObjectLiteral::Property::SETTER:
+          __ push(Immediate(Smi::FromInt(DONT_ENUM)));
+          __ CallRuntime(Runtime::kDefineSetterPropertyUnchecked, 4);
+          break;
+      }
     }
   }
 
@@ -136,7 +136,7 @@ void StubCache::GenerateProbe(MacroAssembler* masm, Code::Kind ic_kind,
   __ Eor(scratch, scratch, flags);
   // We shift out the last two bits because they are not part of the hash.
   __ Ubfx(scratch, scratch, kCacheIndexShift,
-          CountTrailingZeros(kPrimaryTableSize, 64));
+          CountTrailingZeros(primary_table_size(), 64));
 
   // Probe the primary table.
   ProbeTable(isolate, masm, ic_kind, flags, leave_frame, kPrimary, receiver,
@@ -145,7 +145,7 @@ void StubCache::GenerateProbe(MacroAssembler* masm, Code::Kind ic_kind,
   // Primary miss: Compute hash for secondary table.
   __ Sub(scratch, scratch, Operand(name, LSR, kCacheIndexShift));
   __ Add(scratch, scratch, flags >> kCacheIndexShift);
-  __ And(scratch, scratch, kSecondaryTableSize - 1);
+  __ And(scratch, scratch, secondary_table_size() - 1);
 
   // Probe the secondary table.
   ProbeTable(isolate, masm, ic_kind, flags, leave_frame, kSecondary, receiver,
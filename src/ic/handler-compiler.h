@@ -16,6 +16,15 @@ class CallOptimization;
 enum PrototypeCheckType { CHECK_ALL_MAPS, SKIP_RECEIVER };
 enum ReturnHolder { RETURN_HOLDER, DONT_RETURN_ANYTHING };
 
+// Compiles property access handlers that are cached per map through
+// Map::UpdateCodeCache.  Handlers compiled here are inherently map and
+// context dependent: the frontend embeds the receiver map's weak cell and
+// (with --eliminate-prototype-chain-checks) its prototype chain validity
+// cell, and holders contribute property and accessor references.  Handlers
+// that depend only on scalar parameters (field index, constant index,
+// length, ...) do not go through this compiler at all; they are expressed
+// as parameterized HandlerStubs, which the code-stub cache already shares
+// isolate-wide and therefore across native contexts.
 class PropertyHandlerCompiler : public PropertyAccessCompiler {
  public:
   static Handle<Code> Find(Handle<Name> name, Handle<Map> map, Code::Kind kind,
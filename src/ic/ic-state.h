@@ -133,6 +133,9 @@ class BinaryOpICState final BASE_EMBEDDED {
  private:
   friend std::ostream& operator<<(std::ostream& os, const BinaryOpICState& s);
 
+  // Operand kinds generalize along this order, so sites mixing Smi and
+  // double operands settle in NUMBER (unboxed double arithmetic in the
+  // stub) rather than falling through to GENERIC.
   enum Kind { NONE, SMI, INT32, NUMBER, STRING, GENERIC };
 
   Kind UpdateKind(Handle<Object> object, Kind kind) const;
@@ -18,6 +18,7 @@
 #include "src/ic/stub-cache.h"
 #include "src/prototype.h"
 #include "src/runtime/runtime.h"
+#include "src/tracing/trace-event.h"
 
 namespace v8 {
 namespace internal {
@@ -723,6 +724,12 @@ MaybeHandle<Object> LoadIC::Load(Handle<Object> object, Handle<Name> name) {
     }
   }
 
+  if (FLAG_migrate_slow_to_fast_on_access && object->IsJSObject()) {
+    // A miss on a dictionary mode receiver counts towards migrating the
+    // receiver back to fast properties once it has stopped changing shape.
+    JSObject::RecordSlowModeAccess(Handle<JSObject>::cast(object));
+  }
+
   // Named lookup in the object.
   LookupIterator it(object, name);
   LookupForRead(&it);
@@ -1507,6 +1514,12 @@ MaybeHandle<Object> StoreIC::Store(Handle<Object> object, Handle<Name> name,
     return result;
   }
 
+  if (FLAG_migrate_slow_to_fast_on_access && object->IsJSObject()) {
+    // A miss on a dictionary mode receiver counts towards migrating the
+    // receiver back to fast properties once it has stopped changing shape.
+    JSObject::RecordSlowModeAccess(Handle<JSObject>::cast(object));
+  }
+
   LookupIterator it(object, name);
   if (FLAG_use_ic) UpdateCaches(&it, value, store_mode);
 
@@ -1927,8 +1940,14 @@ KeyedAccessStoreMode KeyedStoreIC::GetStoreMode(Handle<JSObject> receiver,
   int index = smi_key->value();
   bool oob_access = IsOutOfBoundsAccess(receiver, index);
   // Don't consider this a growing store if the store would send the receiver to
-  // dictionary mode.
-  bool allow_growth = receiver->IsJSArray() && oob_access &&
+  // dictionary mode. Growing stores are allowed for arrays and for other
+  // objects with fast elements: loops that fill an object at consecutive
+  // indices then grow the backing store geometrically in the handler instead
+  // of missing to the runtime at every capacity boundary. Receivers that must
+  // not gain elements never keep a fast elements map, since making an object
+  // non-extensible normalizes its elements.
+  bool allow_growth = (receiver->IsJSArray() || receiver->HasFastElements()) &&
+                      oob_access &&
                       !receiver->WouldConvertToSlowElements(key);
   if (allow_growth) {
     // Handle growing array in stub if necessary.
@@ -2222,6 +2241,7 @@ void CallIC::HandleMiss(Handle<Object> function) {
 // Used from ic-<arch>.cc.
 RUNTIME_FUNCTION(CallIC_Miss) {
   TimerEventScope<TimerEventIcMiss> timer(isolate);
+  TRACE_EVENT_INSTANT0("v8.ic", "V8.CallIC_Miss");
   HandleScope scope(isolate);
   DCHECK(args.length() == 3);
   Handle<Object> function = args.at<Object>(0);
@@ -2254,6 +2274,7 @@ RUNTIME_FUNCTION(CallIC_Customization_Miss) {
 // Used from ic-<arch>.cc.
 RUNTIME_FUNCTION(LoadIC_Miss) {
   TimerEventScope<TimerEventIcMiss> timer(isolate);
+  TRACE_EVENT_INSTANT0("v8.ic", "V8.LoadIC_Miss");
   HandleScope scope(isolate);
   Handle<Object> receiver = args.at<Object>(0);
   Handle<Name> key = args.at<Name>(1);
@@ -2285,6 +2306,7 @@ RUNTIME_FUNCTION(LoadIC_Miss) {
 // Used from ic-<arch>.cc
 RUNTIME_FUNCTION(KeyedLoadIC_Miss) {
   TimerEventScope<TimerEventIcMiss> timer(isolate);
+  TRACE_EVENT_INSTANT0("v8.ic", "V8.KeyedLoadIC_Miss");
   HandleScope scope(isolate);
   Handle<Object> receiver = args.at<Object>(0);
   Handle<Object> key = args.at<Object>(1);
@@ -2325,6 +2347,7 @@ RUNTIME_FUNCTION(KeyedLoadIC_MissFromStubFailure) {
 // Used from ic-<arch>.cc.
 RUNTIME_FUNCTION(StoreIC_Miss) {
   TimerEventScope<TimerEventIcMiss> timer(isolate);
+  TRACE_EVENT_INSTANT0("v8.ic", "V8.StoreIC_Miss");
   HandleScope scope(isolate);
   DCHECK(args.length() == 3);
   StoreIC ic(IC::NO_EXTRA_FRAME, isolate);
@@ -2356,6 +2379,7 @@ RUNTIME_FUNCTION(StoreIC_MissFromStubFailure) {
 // Used from ic-<arch>.cc.
 RUNTIME_FUNCTION(KeyedStoreIC_Miss) {
   TimerEventScope<TimerEventIcMiss> timer(isolate);
+  TRACE_EVENT_INSTANT0("v8.ic", "V8.KeyedStoreIC_Miss");
   HandleScope scope(isolate);
   DCHECK(args.length() == 3);
   KeyedStoreIC ic(IC::NO_EXTRA_FRAME, isolate);
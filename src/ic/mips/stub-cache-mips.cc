@@ -138,7 +138,7 @@ void StubCache::GenerateProbe(MacroAssembler* masm, Code::Kind ic_kind,
   __ lw(scratch, FieldMemOperand(name, Name::kHashFieldOffset));
   __ lw(at, FieldMemOperand(receiver, HeapObject::kMapOffset));
   __ Addu(scratch, scratch, at);
-  uint32_t mask = kPrimaryTableSize - 1;
+  uint32_t mask = primary_table_size() - 1;
   // We shift out the last two bits because they are not part of the hash and
   // they are always 01 for maps.
   __ srl(scratch, scratch, kCacheIndexShift);
@@ -152,7 +152,7 @@ void StubCache::GenerateProbe(MacroAssembler* masm, Code::Kind ic_kind,
   // Primary miss: Compute hash for secondary probe.
   __ srl(at, name, kCacheIndexShift);
   __ Subu(scratch, scratch, at);
-  uint32_t mask2 = kSecondaryTableSize - 1;
+  uint32_t mask2 = secondary_table_size() - 1;
   __ Addu(scratch, scratch, Operand((flags >> kCacheIndexShift) & mask2));
   __ And(scratch, scratch, Operand(mask2));
 
@@ -139,7 +139,7 @@ void StubCache::GenerateProbe(MacroAssembler* masm, Code::Kind ic_kind,
   __ ld(scratch, FieldMemOperand(name, Name::kHashFieldOffset));
   __ ld(at, FieldMemOperand(receiver, HeapObject::kMapOffset));
   __ Daddu(scratch, scratch, at);
-  uint64_t mask = kPrimaryTableSize - 1;
+  uint64_t mask = primary_table_size() - 1;
   // We shift out the last two bits because they are not part of the hash and
   // they are always 01 for maps.
   __ dsrl(scratch, scratch, kCacheIndexShift);
@@ -153,7 +153,7 @@ void StubCache::GenerateProbe(MacroAssembler* masm, Code::Kind ic_kind,
   // Primary miss: Compute hash for secondary probe.
   __ dsrl(at, name, kCacheIndexShift);
   __ Dsubu(scratch, scratch, at);
-  uint64_t mask2 = kSecondaryTableSize - 1;
+  uint64_t mask2 = secondary_table_size() - 1;
   __ Daddu(scratch, scratch, Operand((flags >> kCacheIndexShift) & mask2));
   __ And(scratch, scratch, Operand(mask2));
 
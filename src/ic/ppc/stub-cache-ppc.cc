@@ -162,7 +162,7 @@ void StubCache::GenerateProbe(MacroAssembler* masm, Code::Kind ic_kind,
   __ xori(scratch, scratch, Operand(flags));
   // The mask omits the last two bits because they are not part of the hash.
   __ andi(scratch, scratch,
-          Operand((kPrimaryTableSize - 1) << kCacheIndexShift));
+          Operand((primary_table_size() - 1) << kCacheIndexShift));
 
   // Probe the primary table.
   ProbeTable(isolate, masm, ic_kind, flags, leave_frame, kPrimary, receiver,
@@ -172,7 +172,7 @@ void StubCache::GenerateProbe(MacroAssembler* masm, Code::Kind ic_kind,
   __ sub(scratch, scratch, name);
   __ addi(scratch, scratch, Operand(flags));
   __ andi(scratch, scratch,
-          Operand((kSecondaryTableSize - 1) << kCacheIndexShift));
+          Operand((secondary_table_size() - 1) << kCacheIndexShift));
 
   // Probe the secondary table.
   ProbeTable(isolate, masm, ic_kind, flags, leave_frame, kSecondary, receiver,
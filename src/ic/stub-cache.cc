@@ -12,12 +12,41 @@ namespace v8 {
 namespace internal {
 
 
-StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {}
+namespace {
+
+// Out-of-range flag values fall back to the default so that a bogus
+// command line cannot create degenerate or absurdly large tables.  The
+// upper bound keeps the shifted probe masks encodable as 16-bit
+// immediates on ppc.
+int TableSize(int bits, int default_bits) {
+  const int kMinTableBits = 6;
+  const int kMaxTableBits = 14;
+  if (bits < kMinTableBits || bits > kMaxTableBits) bits = default_bits;
+  return 1 << bits;
+}
+
+}  // namespace
+
+
+StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {
+  primary_table_size_ =
+      TableSize(FLAG_stub_cache_primary_bits, kPrimaryTableBits);
+  secondary_table_size_ =
+      TableSize(FLAG_stub_cache_secondary_bits, kSecondaryTableBits);
+  primary_ = NewArray<Entry>(primary_table_size_);
+  secondary_ = NewArray<Entry>(secondary_table_size_);
+}
+
+
+StubCache::~StubCache() {
+  DeleteArray(primary_);
+  DeleteArray(secondary_);
+}
 
 
 void StubCache::Initialize() {
-  DCHECK(base::bits::IsPowerOfTwo32(kPrimaryTableSize));
-  DCHECK(base::bits::IsPowerOfTwo32(kSecondaryTableSize));
+  DCHECK(base::bits::IsPowerOfTwo32(primary_table_size_));
+  DCHECK(base::bits::IsPowerOfTwo32(secondary_table_size_));
   Clear();
 }
 
@@ -63,6 +92,7 @@ Code* StubCache::Set(Name* name, Map* map, Code* code) {
     int secondary_offset = SecondaryOffset(primary->key, old_flags, seed);
     Entry* secondary = entry(secondary_, secondary_offset);
     *secondary = *primary;
+    isolate()->counters()->megamorphic_stub_cache_evictions()->Increment();
   }
 
   // Update primary cache.
@@ -79,25 +109,31 @@ Code* StubCache::Get(Name* name, Map* map, Code::Flags flags) {
   int primary_offset = PrimaryOffset(name, flags, map);
   Entry* primary = entry(primary_, primary_offset);
   if (primary->key == name && primary->map == map) {
+    isolate()->counters()->megamorphic_stub_cache_primary_hits()->Increment();
     return primary->value;
   }
   int secondary_offset = SecondaryOffset(name, flags, primary_offset);
   Entry* secondary = entry(secondary_, secondary_offset);
   if (secondary->key == name && secondary->map == map) {
+    isolate()
+        ->counters()
+        ->megamorphic_stub_cache_secondary_hits()
+        ->Increment();
     return secondary->value;
   }
+  isolate()->counters()->megamorphic_stub_cache_misses()->Increment();
   return NULL;
 }
 
 
 void StubCache::Clear() {
   Code* empty = isolate_->builtins()->builtin(Builtins::kIllegal);
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_table_size_; i++) {
     primary_[i].key = isolate()->heap()->empty_string();
     primary_[i].map = NULL;
     primary_[i].value = empty;
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < secondary_table_size_; j++) {
     secondary_[j].key = isolate()->heap()->empty_string();
     secondary_[j].map = NULL;
     secondary_[j].value = empty;
@@ -109,7 +145,7 @@ void StubCache::CollectMatchingMaps(SmallMapList* types, Handle<Name> name,
                                     Code::Flags flags,
                                     Handle<Context> native_context,
                                     Zone* zone) {
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_table_size_; i++) {
     if (primary_[i].key == *name) {
       Map* map = primary_[i].map;
       // Map can be NULL, if the stub is constant function call
@@ -124,7 +160,7 @@ void StubCache::CollectMatchingMaps(SmallMapList* types, Handle<Name> name,
     }
   }
 
-  for (int i = 0; i < kSecondaryTableSize; i++) {
+  for (int i = 0; i < secondary_table_size_; i++) {
     if (secondary_[i].key == *name) {
       Map* map = secondary_[i].map;
       // Map can be NULL, if the stub is constant function call
@@ -38,6 +38,8 @@ class StubCache {
     Map* map;
   };
 
+  ~StubCache();
+
   void Initialize();
   // Access cache for entry hash(name, map).
   Code* Set(Name* name, Map* map, Code* code);
@@ -87,11 +89,23 @@ class StubCache {
 
   Isolate* isolate() { return isolate_; }
 
+  // The tables are sized per isolate from --stub_cache_primary_bits and
+  // --stub_cache_secondary_bits.  Generated probe code reads the sizes when
+  // it is assembled; code from the startup snapshot keeps the masks it was
+  // built with and simply probes the prefix of a larger table, which is safe
+  // because every entry is validated on a hit.
+  int primary_table_size() const { return primary_table_size_; }
+  int secondary_table_size() const { return secondary_table_size_; }
+
   // Setting the entry size such that the index is shifted by Name::kHashShift
   // is convenient; shifting down the length field (to extract the hash code)
   // automatically discards the hash bit field.
   static const int kCacheIndexShift = Name::kHashShift;
 
+  // Default table sizes, in bits, used when the flags are out of range.
+  static const int kPrimaryTableBits = 11;
+  static const int kSecondaryTableBits = 9;
+
  private:
   explicit StubCache(Isolate* isolate);
 
@@ -105,7 +119,7 @@ class StubCache {
   // Hash algorithm for the primary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int PrimaryOffset(Name* name, Code::Flags flags, Map* map) {
+  int PrimaryOffset(Name* name, Code::Flags flags, Map* map) {
     STATIC_ASSERT(kCacheIndexShift == Name::kHashShift);
     // Compute the hash of the name (use entire hash field).
     DCHECK(name->HasHashCode());
@@ -121,13 +135,13 @@ class StubCache {
         (static_cast<uint32_t>(flags) & ~Code::kFlagsNotUsedInLookup);
     // Base the offset on a simple combination of name, flags, and map.
     uint32_t key = (map_low32bits + field) ^ iflags;
-    return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+    return key & ((primary_table_size_ - 1) << kCacheIndexShift);
   }
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int SecondaryOffset(Name* name, Code::Flags flags, int seed) {
+  int SecondaryOffset(Name* name, Code::Flags flags, int seed) {
     // Use the seed from the primary cache in the secondary cache.
     uint32_t name_low32bits =
         static_cast<uint32_t>(reinterpret_cast<uintptr_t>(name));
@@ -136,7 +150,7 @@ class StubCache {
     uint32_t iflags =
         (static_cast<uint32_t>(flags) & ~Code::kFlagsNotUsedInLookup);
     uint32_t key = (seed - name_low32bits) + iflags;
-    return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+    return key & ((secondary_table_size_ - 1) << kCacheIndexShift);
   }
 
   // Compute the entry for a given offset in exactly the same way as
@@ -150,14 +164,11 @@ class StubCache {
                                     offset * multiplier);
   }
 
-  static const int kPrimaryTableBits = 11;
-  static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
-  static const int kSecondaryTableBits = 9;
-  static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
-
  private:
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  Entry* primary_;
+  Entry* secondary_;
+  int primary_table_size_;
+  int secondary_table_size_;
   Isolate* isolate_;
 
   friend class Isolate;
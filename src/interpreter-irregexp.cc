@@ -65,6 +65,27 @@ static bool BackRefMatchesNoCase(Canonicalize* interp_canonicalize,
 }
 
 
+// Dispatch bytecodes with a token-threaded loop using computed gotos where
+// the compiler supports them: every handler ends in its own indirect jump,
+// which avoids the bounds check and shared, poorly predicted indirect jump
+// of a switch-based loop. Other compilers fall back to the switch.
+#if V8_CC_GNU
+#define V8_USE_COMPUTED_GOTO 1
+#endif
+
+#ifdef V8_USE_COMPUTED_GOTO
+#define CASE(name) BC_##name##_label
+#define DISPATCH()                              \
+  do {                                          \
+    insn = Load32Aligned(pc);                   \
+    goto* dispatch_table[insn & BYTECODE_MASK]; \
+  } while (false)
+#else
+#define CASE(name) case BC_##name
+#define DISPATCH() break
+#endif
+
+
 #ifdef DEBUG
 static void TraceInterpreter(const byte* code_base,
                              const byte* pc,
@@ -104,7 +125,7 @@ static void TraceInterpreter(const byte* code_base,
 
 
 #define BYTECODE(name)                                                      \
-  case BC_##name:                                                           \
+  CASE(name):                                                               \
     TraceInterpreter(code_base,                                             \
                      pc,                                                    \
                      static_cast<int>(backtrack_sp - backtrack_stack_base), \
@@ -114,7 +135,7 @@ static void TraceInterpreter(const byte* code_base,
                      #name);
 #else
 #define BYTECODE(name)                                                      \
-  case BC_##name:
+  CASE(name):
 #endif
 
 
@@ -175,9 +196,22 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
     PrintF("\n\nStart bytecode interpreter\n\n");
   }
 #endif
+#ifdef V8_USE_COMPUTED_GOTO
+  // The table is indexed by bytecode, relying on the codes in
+  // BYTECODE_ITERATOR being dense and in order.
+#define DECLARE_DISPATCH_TABLE_ENTRY(name, code, length) &&CASE(name),
+  static const void* const dispatch_table[] = {
+      BYTECODE_ITERATOR(DECLARE_DISPATCH_TABLE_ENTRY)};
+#undef DECLARE_DISPATCH_TABLE_ENTRY
+  int32_t insn;
+  DISPATCH();
+  {
+    {
+#else
   while (true) {
     int32_t insn = Load32Aligned(pc);
     switch (insn & BYTECODE_MASK) {
+#endif
       BYTECODE(BREAK)
         UNREACHABLE();
         return RegExpImpl::RE_FAILURE;
@@ -187,65 +221,65 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         }
         *backtrack_sp++ = current;
         pc += BC_PUSH_CP_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(PUSH_BT)
         if (--backtrack_stack_space < 0) {
           return RegExpImpl::RE_EXCEPTION;
         }
         *backtrack_sp++ = Load32Aligned(pc + 4);
         pc += BC_PUSH_BT_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(PUSH_REGISTER)
         if (--backtrack_stack_space < 0) {
           return RegExpImpl::RE_EXCEPTION;
         }
         *backtrack_sp++ = registers[insn >> BYTECODE_SHIFT];
         pc += BC_PUSH_REGISTER_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(SET_REGISTER)
         registers[insn >> BYTECODE_SHIFT] = Load32Aligned(pc + 4);
         pc += BC_SET_REGISTER_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(ADVANCE_REGISTER)
         registers[insn >> BYTECODE_SHIFT] += Load32Aligned(pc + 4);
         pc += BC_ADVANCE_REGISTER_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(SET_REGISTER_TO_CP)
         registers[insn >> BYTECODE_SHIFT] = current + Load32Aligned(pc + 4);
         pc += BC_SET_REGISTER_TO_CP_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(SET_CP_TO_REGISTER)
         current = registers[insn >> BYTECODE_SHIFT];
         pc += BC_SET_CP_TO_REGISTER_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(SET_REGISTER_TO_SP)
         registers[insn >> BYTECODE_SHIFT] =
             static_cast<int>(backtrack_sp - backtrack_stack_base);
         pc += BC_SET_REGISTER_TO_SP_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(SET_SP_TO_REGISTER)
         backtrack_sp = backtrack_stack_base + registers[insn >> BYTECODE_SHIFT];
         backtrack_stack_space = backtrack_stack.max_size() -
             static_cast<int>(backtrack_sp - backtrack_stack_base);
         pc += BC_SET_SP_TO_REGISTER_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(POP_CP)
         backtrack_stack_space++;
         --backtrack_sp;
         current = *backtrack_sp;
         pc += BC_POP_CP_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(POP_BT)
         backtrack_stack_space++;
         --backtrack_sp;
         pc = code_base + *backtrack_sp;
-        break;
+        DISPATCH();
       BYTECODE(POP_REGISTER)
         backtrack_stack_space++;
         --backtrack_sp;
         registers[insn >> BYTECODE_SHIFT] = *backtrack_sp;
         pc += BC_POP_REGISTER_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(FAIL)
         return RegExpImpl::RE_FAILURE;
       BYTECODE(SUCCEED)
@@ -253,14 +287,25 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
       BYTECODE(ADVANCE_CP)
         current += insn >> BYTECODE_SHIFT;
         pc += BC_ADVANCE_CP_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(GOTO)
         pc = code_base + Load32Aligned(pc + 4);
-        break;
+        DISPATCH();
       BYTECODE(ADVANCE_CP_AND_GOTO)
         current += insn >> BYTECODE_SHIFT;
         pc = code_base + Load32Aligned(pc + 4);
-        break;
+        DISPATCH();
+      BYTECODE(ADVANCE_CP_AND_LOAD_CURRENT_CHAR) {
+        current += insn >> BYTECODE_SHIFT;
+        int pos = current + Load32Aligned(pc + 4);
+        if (pos >= subject.length()) {
+          pc = code_base + Load32Aligned(pc + 8);
+        } else {
+          current_char = subject[pos];
+          pc += BC_ADVANCE_CP_AND_LOAD_CURRENT_CHAR_LENGTH;
+        }
+        DISPATCH();
+      }
       BYTECODE(CHECK_GREEDY)
         if (current == backtrack_sp[-1]) {
           backtrack_sp--;
@@ -269,7 +314,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_GREEDY_LENGTH;
         }
-        break;
+        DISPATCH();
       BYTECODE(LOAD_CURRENT_CHAR) {
         int pos = current + (insn >> BYTECODE_SHIFT);
         if (pos >= subject.length()) {
@@ -278,13 +323,13 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
           current_char = subject[pos];
           pc += BC_LOAD_CURRENT_CHAR_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(LOAD_CURRENT_CHAR_UNCHECKED) {
         int pos = current + (insn >> BYTECODE_SHIFT);
         current_char = subject[pos];
         pc += BC_LOAD_CURRENT_CHAR_UNCHECKED_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(LOAD_2_CURRENT_CHARS) {
         int pos = current + (insn >> BYTECODE_SHIFT);
@@ -296,14 +341,14 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
               (subject[pos] | (next << (kBitsPerByte * sizeof(Char))));
           pc += BC_LOAD_2_CURRENT_CHARS_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(LOAD_2_CURRENT_CHARS_UNCHECKED) {
         int pos = current + (insn >> BYTECODE_SHIFT);
         Char next = subject[pos + 1];
         current_char = (subject[pos] | (next << (kBitsPerByte * sizeof(Char))));
         pc += BC_LOAD_2_CURRENT_CHARS_UNCHECKED_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(LOAD_4_CURRENT_CHARS) {
         DCHECK(sizeof(Char) == 1);
@@ -320,7 +365,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
                           (next3 << 24));
           pc += BC_LOAD_4_CURRENT_CHARS_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(LOAD_4_CURRENT_CHARS_UNCHECKED) {
         DCHECK(sizeof(Char) == 1);
@@ -333,7 +378,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
                         (next2 << 16) |
                         (next3 << 24));
         pc += BC_LOAD_4_CURRENT_CHARS_UNCHECKED_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_4_CHARS) {
         uint32_t c = Load32Aligned(pc + 4);
@@ -342,7 +387,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_4_CHARS_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_CHAR) {
         uint32_t c = (insn >> BYTECODE_SHIFT);
@@ -351,7 +396,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_CHAR_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_NOT_4_CHARS) {
         uint32_t c = Load32Aligned(pc + 4);
@@ -360,7 +405,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_NOT_4_CHARS_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_NOT_CHAR) {
         uint32_t c = (insn >> BYTECODE_SHIFT);
@@ -369,7 +414,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_NOT_CHAR_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(AND_CHECK_4_CHARS) {
         uint32_t c = Load32Aligned(pc + 4);
@@ -378,7 +423,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_AND_CHECK_4_CHARS_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(AND_CHECK_CHAR) {
         uint32_t c = (insn >> BYTECODE_SHIFT);
@@ -387,7 +432,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_AND_CHECK_CHAR_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(AND_CHECK_NOT_4_CHARS) {
         uint32_t c = Load32Aligned(pc + 4);
@@ -396,7 +441,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_AND_CHECK_NOT_4_CHARS_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(AND_CHECK_NOT_CHAR) {
         uint32_t c = (insn >> BYTECODE_SHIFT);
@@ -405,7 +450,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_AND_CHECK_NOT_CHAR_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(MINUS_AND_CHECK_NOT_CHAR) {
         uint32_t c = (insn >> BYTECODE_SHIFT);
@@ -416,7 +461,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_MINUS_AND_CHECK_NOT_CHAR_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_CHAR_IN_RANGE) {
         uint32_t from = Load16Aligned(pc + 4);
@@ -426,7 +471,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_CHAR_IN_RANGE_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_CHAR_NOT_IN_RANGE) {
         uint32_t from = Load16Aligned(pc + 4);
@@ -436,7 +481,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_CHAR_NOT_IN_RANGE_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_BIT_IN_TABLE) {
         int mask = RegExpMacroAssembler::kTableMask;
@@ -447,7 +492,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_BIT_IN_TABLE_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_LT) {
         uint32_t limit = (insn >> BYTECODE_SHIFT);
@@ -456,7 +501,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_LT_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_GT) {
         uint32_t limit = (insn >> BYTECODE_SHIFT);
@@ -465,7 +510,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_GT_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_REGISTER_LT)
         if (registers[insn >> BYTECODE_SHIFT] < Load32Aligned(pc + 4)) {
@@ -473,21 +518,21 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_REGISTER_LT_LENGTH;
         }
-        break;
+        DISPATCH();
       BYTECODE(CHECK_REGISTER_GE)
         if (registers[insn >> BYTECODE_SHIFT] >= Load32Aligned(pc + 4)) {
           pc = code_base + Load32Aligned(pc + 8);
         } else {
           pc += BC_CHECK_REGISTER_GE_LENGTH;
         }
-        break;
+        DISPATCH();
       BYTECODE(CHECK_REGISTER_EQ_POS)
         if (registers[insn >> BYTECODE_SHIFT] == current) {
           pc = code_base + Load32Aligned(pc + 4);
         } else {
           pc += BC_CHECK_REGISTER_EQ_POS_LENGTH;
         }
-        break;
+        DISPATCH();
       BYTECODE(CHECK_NOT_REGS_EQUAL)
         if (registers[insn >> BYTECODE_SHIFT] ==
             registers[Load32Aligned(pc + 4)]) {
@@ -495,41 +540,33 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc = code_base + Load32Aligned(pc + 8);
         }
-        break;
+        DISPATCH();
       BYTECODE(CHECK_NOT_BACK_REF) {
         int from = registers[insn >> BYTECODE_SHIFT];
         int len = registers[(insn >> BYTECODE_SHIFT) + 1] - from;
         if (from < 0 || len <= 0) {
           pc += BC_CHECK_NOT_BACK_REF_LENGTH;
-          break;
+          DISPATCH();
         }
-        if (current + len > subject.length()) {
+        if (current + len > subject.length() ||
+            CompareChars(&subject[from], &subject[current], len) != 0) {
           pc = code_base + Load32Aligned(pc + 4);
-          break;
-        } else {
-          int i;
-          for (i = 0; i < len; i++) {
-            if (subject[from + i] != subject[current + i]) {
-              pc = code_base + Load32Aligned(pc + 4);
-              break;
-            }
-          }
-          if (i < len) break;
-          current += len;
+          DISPATCH();
         }
+        current += len;
         pc += BC_CHECK_NOT_BACK_REF_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_NOT_BACK_REF_NO_CASE) {
         int from = registers[insn >> BYTECODE_SHIFT];
         int len = registers[(insn >> BYTECODE_SHIFT) + 1] - from;
         if (from < 0 || len <= 0) {
           pc += BC_CHECK_NOT_BACK_REF_NO_CASE_LENGTH;
-          break;
+          DISPATCH();
         }
         if (current + len > subject.length()) {
           pc = code_base + Load32Aligned(pc + 4);
-          break;
+          DISPATCH();
         } else {
           if (BackRefMatchesNoCase(isolate->interp_canonicalize_mapping(),
                                    from, current, len, subject)) {
@@ -539,7 +576,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
             pc = code_base + Load32Aligned(pc + 4);
           }
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_AT_START)
         if (current == 0) {
@@ -547,14 +584,14 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_AT_START_LENGTH;
         }
-        break;
+        DISPATCH();
       BYTECODE(CHECK_NOT_AT_START)
         if (current == 0) {
           pc += BC_CHECK_NOT_AT_START_LENGTH;
         } else {
           pc = code_base + Load32Aligned(pc + 4);
         }
-        break;
+        DISPATCH();
       BYTECODE(SET_CURRENT_POSITION_FROM_END) {
         int by = static_cast<uint32_t>(insn) >> BYTECODE_SHIFT;
         if (subject.length() - current > by) {
@@ -562,11 +599,13 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
           current_char = subject[current - 1];
         }
         pc += BC_SET_CURRENT_POSITION_FROM_END_LENGTH;
-        break;
+        DISPATCH();
       }
+#ifndef V8_USE_COMPUTED_GOTO
       default:
         UNREACHABLE();
         break;
+#endif
     }
   }
 }
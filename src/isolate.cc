@@ -24,10 +24,14 @@
 #include "src/heap/spaces.h"
 #include "src/heap-profiler.h"
 #include "src/hydrogen.h"
+#ifdef V8_I18N_SUPPORT
+#include "src/i18n.h"
+#endif
 #include "src/ic/stub-cache.h"
 #include "src/lithium-allocator.h"
 #include "src/log.h"
 #include "src/messages.h"
+#include "src/preparse-data.h"
 #include "src/prototype.h"
 #include "src/regexp-stack.h"
 #include "src/runtime-profiler.h"
@@ -335,14 +339,13 @@ Handle<Object> Isolate::CaptureSimpleStackTrace(Handle<JSObject> error_object,
       this, js_builtins_object(), "$Error").ToHandleChecked();
   if (!error->IsJSObject()) return factory()->undefined_value();
 
-  Handle<String> stackTraceLimit =
-      factory()->InternalizeUtf8String("stackTraceLimit");
-  DCHECK(!stackTraceLimit.is_null());
   Handle<Object> stack_trace_limit = JSReceiver::GetDataProperty(
-      Handle<JSObject>::cast(error), stackTraceLimit);
+      Handle<JSObject>::cast(error), factory()->stack_trace_limit_string());
   if (!stack_trace_limit->IsNumber()) return factory()->undefined_value();
   int limit = FastD2IChecked(stack_trace_limit->Number());
   limit = Max(limit, 0);  // Ensure that limit is not negative.
+  // Apply the embedder's hard cap, if any.
+  if (stack_trace_frame_cap_ >= 0) limit = Min(limit, stack_trace_frame_cap_);
 
   int initial_size = Min(limit, 10);
   Handle<FixedArray> elements =
@@ -1743,10 +1746,16 @@ Isolate::Isolate(bool enable_serializer)
       capture_stack_trace_for_uncaught_exceptions_(false),
       stack_trace_for_uncaught_exceptions_frame_limit_(0),
       stack_trace_for_uncaught_exceptions_options_(StackTrace::kOverview),
+      stack_trace_frame_cap_(-1),
       memory_allocator_(NULL),
       keyed_lookup_cache_(NULL),
       context_slot_cache_(NULL),
       descriptor_lookup_cache_(NULL),
+      transition_lookup_cache_(NULL),
+      scope_info_cache_(NULL),
+      own_property_names_cache_(NULL),
+      icu_service_cache_(NULL),
+      preparse_token_cache_(NULL),
       handle_scope_implementer_(NULL),
       unicode_cache_(NULL),
       inner_pointer_to_code_cache_(NULL),
@@ -1944,6 +1953,18 @@ Isolate::~Isolate() {
 
   delete descriptor_lookup_cache_;
   descriptor_lookup_cache_ = NULL;
+  delete transition_lookup_cache_;
+  transition_lookup_cache_ = NULL;
+  delete scope_info_cache_;
+  scope_info_cache_ = NULL;
+  delete own_property_names_cache_;
+  own_property_names_cache_ = NULL;
+#ifdef V8_I18N_SUPPORT
+  delete icu_service_cache_;
+  icu_service_cache_ = NULL;
+#endif
+  delete preparse_token_cache_;
+  preparse_token_cache_ = NULL;
   delete context_slot_cache_;
   context_slot_cache_ = NULL;
   delete keyed_lookup_cache_;
@@ -2090,6 +2111,13 @@ bool Isolate::Init(Deserializer* des) {
   keyed_lookup_cache_ = new KeyedLookupCache();
   context_slot_cache_ = new ContextSlotCache();
   descriptor_lookup_cache_ = new DescriptorLookupCache();
+  transition_lookup_cache_ = new TransitionLookupCache();
+  scope_info_cache_ = new ScopeInfoCache();
+  own_property_names_cache_ = new OwnPropertyNamesCache();
+#ifdef V8_I18N_SUPPORT
+  icu_service_cache_ = new ICUServiceCache();
+#endif
+  preparse_token_cache_ = new PreparseTokenCache();
   unicode_cache_ = new UnicodeCache();
   inner_pointer_to_code_cache_ = new InnerPointerToCodeCache(this);
   global_handles_ = new GlobalHandles(this);
@@ -2588,8 +2616,23 @@ void Isolate::ReportPromiseReject(Handle<JSObject> promise,
 }
 
 
+namespace {
+
+// Layout of a promise reaction job, the FixedArray form in which
+// EnqueuePromiseReactionJob puts reactions on the microtask queue.
+enum PromiseReactionJobFields {
+  kReactionJobContext,
+  kReactionJobValue,
+  kReactionJobTasks,
+  kReactionJobSize
+};
+
+}  // namespace
+
+
 void Isolate::EnqueueMicrotask(Handle<Object> microtask) {
-  DCHECK(microtask->IsJSFunction() || microtask->IsCallHandlerInfo());
+  DCHECK(microtask->IsJSFunction() || microtask->IsCallHandlerInfo() ||
+         microtask->IsFixedArray());
   Handle<FixedArray> queue(heap()->microtask_queue(), this);
   int num_tasks = pending_microtask_count();
   DCHECK(num_tasks <= queue->length());
@@ -2606,6 +2649,19 @@ void Isolate::EnqueueMicrotask(Handle<Object> microtask) {
 }
 
 
+void Isolate::EnqueuePromiseReactionJob(Handle<Object> value,
+                                        Handle<Object> tasks) {
+  // Instead of allocating a closure over (value, tasks) for every resolved
+  // promise, record the reaction as a plain triple and let RunMicrotasks
+  // dispatch it to the context's PromiseHandleReactions directly.
+  Handle<FixedArray> job = factory()->NewFixedArray(kReactionJobSize);
+  job->set(kReactionJobContext, *native_context());
+  job->set(kReactionJobValue, *value);
+  job->set(kReactionJobTasks, *tasks);
+  EnqueueMicrotask(job);
+}
+
+
 void Isolate::RunMicrotasks() {
   // %RunMicrotasks may be called in mjsunit tests, which violates
   // this assertion, hence the check for --allow-natives-syntax.
@@ -2629,15 +2685,31 @@ void Isolate::RunMicrotasks() {
     for (int i = 0; i < num_tasks; i++) {
       HandleScope scope(this);
       Handle<Object> microtask(queue->get(i), this);
-      if (microtask->IsJSFunction()) {
-        Handle<JSFunction> microtask_function =
-            Handle<JSFunction>::cast(microtask);
+      if (microtask->IsJSFunction() || microtask->IsFixedArray()) {
         SaveContext save(this);
-        set_context(microtask_function->context()->native_context());
+        Handle<JSFunction> microtask_function;
+        int argc = 0;
+        Handle<Object> argv[2];
+        if (microtask->IsJSFunction()) {
+          microtask_function = Handle<JSFunction>::cast(microtask);
+          set_context(microtask_function->context()->native_context());
+        } else {
+          // A promise reaction job; dispatch the recorded (value, tasks)
+          // pair to the enqueuing context's PromiseHandleReactions.
+          Handle<FixedArray> job = Handle<FixedArray>::cast(microtask);
+          Handle<Context> native_context(
+              Context::cast(job->get(kReactionJobContext)), this);
+          microtask_function =
+              handle(native_context->promise_handle_reactions(), this);
+          argv[0] = handle(job->get(kReactionJobValue), this);
+          argv[1] = handle(job->get(kReactionJobTasks), this);
+          argc = 2;
+          set_context(*native_context);
+        }
         MaybeHandle<Object> maybe_exception;
         MaybeHandle<Object> result =
             Execution::TryCall(microtask_function, factory()->undefined_value(),
-                               0, NULL, &maybe_exception);
+                               argc, argc == 0 ? NULL : argv, &maybe_exception);
         // If execution is terminating, just bail out.
         Handle<Object> exception;
         if (result.is_null() && maybe_exception.is_null()) {
@@ -57,10 +57,12 @@ class HandleScopeImplementer;
 class HeapProfiler;
 class HStatistics;
 class HTracer;
+class ICUServiceCache;
 class InlineRuntimeFunctionsTable;
 class InnerPointerToCodeCache;
 class MaterializedObjectStore;
 class CodeAgingHelper;
+class PreparseTokenCache;
 class RegExpStack;
 class SaveContext;
 class StringTracker;
@@ -342,9 +344,12 @@ class ThreadLocalTop BASE_EMBEDDED {
 #define ISOLATE_INIT_ARRAY_LIST(V)                                             \
   /* SerializerDeserializer state. */                                          \
   V(int32_t, jsregexp_static_offsets_vector, kJSRegexpStaticOffsetsVectorSize) \
-  V(int, bad_char_shift_table, kUC16AlphabetSize)                              \
-  V(int, good_suffix_shift_table, (kBMMaxShift + 1))                           \
+  V(int, bad_char_shift_table, kUC16AlphabetSize* kStringSearchCacheSize)     \
+  V(int, good_suffix_shift_table, (kBMMaxShift + 1) * kStringSearchCacheSize) \
   V(int, suffix_table, (kBMMaxShift + 1))                                      \
+  V(uc16, string_search_cache_pattern, kBMMaxShift* kStringSearchCacheSize)   \
+  V(int, string_search_cache_meta,                                             \
+    kStringSearchCacheMetaSize* kStringSearchCacheSize)                        \
   V(uint32_t, private_random_seed, 2)                                          \
   ISOLATE_INIT_DEBUG_ARRAY_LIST(V)
 
@@ -355,6 +360,7 @@ typedef List<HeapObject*> DebugObjectCache;
   V(FatalErrorCallback, exception_behavior, NULL)                              \
   V(LogEventCallback, event_logger, NULL)                                      \
   V(AllowCodeGenerationFromStringsCallback, allow_code_gen_callback, NULL)     \
+  V(ExternalSourceStoreCallback, external_source_store_callback, NULL)         \
   /* To distinguish the function templates, so that we can find them in the */ \
   /* function cache of the native context. */                                  \
   V(int, next_serial_number, 0)                                                \
@@ -378,6 +384,8 @@ typedef List<HeapObject*> DebugObjectCache;
   V(uint32_t, per_isolate_assert_data, 0xFFFFFFFFu)                            \
   V(PromiseRejectCallback, promise_reject_callback, NULL)                      \
   V(const v8::StartupData*, snapshot_blob, NULL)                               \
+  /* LRU clock for the string search pattern-table cache. */                   \
+  V(int, string_search_cache_clock, 0)                                         \
   ISOLATE_INIT_SIMULATOR_LIST(V)
 
 #define THREAD_LOCAL_TOP_ACCESSOR(type, name)                        \
@@ -689,6 +697,11 @@ class Isolate {
       int frame_limit,
       StackTrace::StackTraceOptions options);
 
+  // Hard per-isolate cap on the number of frames captured for Error.stack,
+  // applied on top of Error.stackTraceLimit.  Negative means no cap.
+  void set_stack_trace_frame_cap(int cap) { stack_trace_frame_cap_ = cap; }
+  int stack_trace_frame_cap() const { return stack_trace_frame_cap_; }
+
   enum PrintStackMode { kPrintStackConcise, kPrintStackVerbose };
   void PrintCurrentStackTrace(FILE* out);
   void PrintStack(StringStream* accumulator,
@@ -801,8 +814,10 @@ class Isolate {
 
   static const char* const kStackOverflowMessage;
 
-  static const int kUC16AlphabetSize = 256;  // See StringSearchBase.
-  static const int kBMMaxShift = 250;        // See StringSearchBase.
+  static const int kUC16AlphabetSize = 256;      // See StringSearchBase.
+  static const int kBMMaxShift = 250;            // See StringSearchBase.
+  static const int kStringSearchCacheSize = 4;   // See StringSearchBase.
+  static const int kStringSearchCacheMetaSize = 4;  // See StringSearchBase.
 
   // Accessors.
 #define GLOBAL_ACCESSOR(type, name, initialvalue)                       \
@@ -878,6 +893,27 @@ class Isolate {
     return descriptor_lookup_cache_;
   }
 
+  TransitionLookupCache* transition_lookup_cache() {
+    return transition_lookup_cache_;
+  }
+
+  ScopeInfoCache* scope_info_cache() {
+    return scope_info_cache_;
+  }
+
+  OwnPropertyNamesCache* own_property_names_cache() {
+    return own_property_names_cache_;
+  }
+
+  // NULL unless internationalization support is compiled in.
+  ICUServiceCache* icu_service_cache() {
+    return icu_service_cache_;
+  }
+
+  PreparseTokenCache* preparse_token_cache() {
+    return preparse_token_cache_;
+  }
+
   HandleScopeData* handle_scope_data() { return &handle_scope_data_; }
 
   HandleScopeImplementer* handle_scope_implementer() {
@@ -1083,6 +1119,7 @@ class Isolate {
                            v8::PromiseRejectEvent event);
 
   void EnqueueMicrotask(Handle<Object> microtask);
+  void EnqueuePromiseReactionJob(Handle<Object> value, Handle<Object> tasks);
   void RunMicrotasks();
 
   void SetUseCounterCallback(v8::Isolate::UseCounterCallback callback);
@@ -1259,10 +1296,16 @@ class Isolate {
   bool capture_stack_trace_for_uncaught_exceptions_;
   int stack_trace_for_uncaught_exceptions_frame_limit_;
   StackTrace::StackTraceOptions stack_trace_for_uncaught_exceptions_options_;
+  int stack_trace_frame_cap_;
   MemoryAllocator* memory_allocator_;
   KeyedLookupCache* keyed_lookup_cache_;
   ContextSlotCache* context_slot_cache_;
   DescriptorLookupCache* descriptor_lookup_cache_;
+  TransitionLookupCache* transition_lookup_cache_;
+  ScopeInfoCache* scope_info_cache_;
+  OwnPropertyNamesCache* own_property_names_cache_;
+  ICUServiceCache* icu_service_cache_;
+  PreparseTokenCache* preparse_token_cache_;
   HandleScopeData handle_scope_data_;
   HandleScopeImplementer* handle_scope_implementer_;
   UnicodeCache* unicode_cache_;
@@ -1371,6 +1414,8 @@ class Isolate {
   friend class v8::Locker;
   friend class v8::Unlocker;
   friend v8::StartupData v8::V8::CreateSnapshotDataBlob(const char*);
+  friend v8::StartupData v8::V8::WarmUpSnapshotDataBlob(v8::StartupData,
+                                                        const char*);
 
   DISALLOW_COPY_AND_ASSIGN(Isolate);
 };
@@ -44,6 +44,8 @@ class JsonParser BASE_EMBEDDED {
     // Optimized fast case where we only have Latin1 characters.
     if (seq_one_byte) {
       seq_source_ = Handle<SeqOneByteString>::cast(source_);
+      transition_memo_ = factory_->NewFixedArray(kTransitionMemoSize *
+                                                 kTransitionMemoEntrySize);
     }
   }
 
@@ -183,6 +185,44 @@ class JsonParser BASE_EMBEDDED {
   static const int kInitialSpecialStringLength = 32;
   static const int kPretenureTreshold = 100 * 1024;
 
+  // Parsing an array of records with identical key sets takes the same map
+  // transition for every record. The transition memo is a small
+  // direct-mapped cache over (source map, key, target map) triples
+  // remembering the transition most recently taken from a map in this
+  // parse. Later records find their target map with a raw character
+  // comparison against the remembered key, even after the source map has
+  // accumulated several outgoing transitions and lost the single expected
+  // transition that ParseJsonObject tries first. Entries are validated on
+  // every hit, so maps moved by GC simply miss and are re-entered.
+  static const int kTransitionMemoSize = 32;
+  static const int kTransitionMemoEntrySize = 3;
+
+  inline int TransitionMemoIndex(Map* source) {
+    uint32_t hash = static_cast<uint32_t>(
+        reinterpret_cast<uintptr_t>(source) >> kPointerSizeLog2);
+    return static_cast<int>(hash & (kTransitionMemoSize - 1)) *
+           kTransitionMemoEntrySize;
+  }
+
+  inline bool LookupTransitionMemo(Handle<Map> source, Handle<String>* key,
+                                   Handle<Map>* target) {
+    int index = TransitionMemoIndex(*source);
+    if (transition_memo_->get(index) != *source) return false;
+    *key = Handle<String>(String::cast(transition_memo_->get(index + 1)),
+                          isolate());
+    *target =
+        Handle<Map>(Map::cast(transition_memo_->get(index + 2)), isolate());
+    return true;
+  }
+
+  inline void StoreTransitionMemo(Handle<Map> source, Handle<String> key,
+                                  Handle<Map> target) {
+    int index = TransitionMemoIndex(*source);
+    transition_memo_->set(index, *source);
+    transition_memo_->set(index + 1, *key);
+    transition_memo_->set(index + 2, *target);
+  }
+
 
  private:
   Zone* zone() { return &zone_; }
@@ -193,6 +233,7 @@ class JsonParser BASE_EMBEDDED {
   Handle<String> source_;
   int source_length_;
   Handle<SeqOneByteString> seq_source_;
+  Handle<FixedArray> transition_memo_;
 
   PretenureFlag pretenure_;
   Isolate* isolate_;
@@ -381,11 +422,19 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
       if (seq_one_byte) {
         key = TransitionArray::ExpectedTransitionKey(map);
         follow_expected = !key.is_null() && ParseJsonString(key);
+        // If the expected transition hits, follow it.
+        if (follow_expected) {
+          target = TransitionArray::ExpectedTransitionTarget(map);
+        } else if (key.is_null()) {
+          // There is no single expected transition, either because the map
+          // is at the tip of the transition tree or because records of
+          // several shapes have given it multiple outgoing transitions.
+          // Retry the transition this parse last took from the map.
+          follow_expected =
+              LookupTransitionMemo(map, &key, &target) && ParseJsonString(key);
+        }
       }
-      // If the expected transition hits, follow it.
-      if (follow_expected) {
-        target = TransitionArray::ExpectedTransitionTarget(map);
-      } else {
+      if (!follow_expected) {
         // If the expected transition failed, parse an internalized string and
         // try to find a matching transition.
         key = ParseJsonInternalizedString();
@@ -394,6 +443,9 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
         target = TransitionArray::FindTransitionToField(map, key);
         // If a transition was found, follow it and continue.
         transitioning = !target.is_null();
+        if (seq_one_byte && transitioning) {
+          StoreTransitionMemo(map, key, target);
+        }
       }
       if (c0_ != ':') return ReportUnexpectedCharacter();
 
@@ -628,6 +680,47 @@ inline Handle<SeqOneByteString> NewRawString(Factory* factory,
 }
 
 
+// Returns the position of the first character in chars[position..length)
+// that cannot be part of a plain JSON string run: the terminating quote, a
+// backslash introducing an escape sequence, or a control character. Reads
+// whole words at a time in the style of the word-wise scans in
+// src/scanner-character-streams.cc; a candidate byte sets the most
+// significant bit of its lane and is then located exactly by the trailing
+// character loop.
+inline int ScanPlainJsonStringRun(const uint8_t* chars, int position,
+                                  int length) {
+  static const uintptr_t kOneInEveryByte = kUintptrAllBitsSet / 0xFF;
+  static const uintptr_t kMsbInEveryByte = kOneInEveryByte << 7;
+
+  while (position < length &&
+         !IsAligned(reinterpret_cast<intptr_t>(chars + position),
+                    sizeof(uintptr_t))) {
+    uint8_t c = chars[position];
+    if (c == '"' || c == '\\' || c < 0x20) return position;
+    position++;
+  }
+  while (position + static_cast<int>(sizeof(uintptr_t)) <= length) {
+    uintptr_t w = *reinterpret_cast<const uintptr_t*>(chars + position);
+    // A byte equal to the probe character zeroes its lane in the xor, and a
+    // zeroed or below-0x20 lane carries into its most significant bit when
+    // subtracting one from every byte.
+    uintptr_t quotes = w ^ (kOneInEveryByte * '"');
+    uintptr_t backslashes = w ^ (kOneInEveryByte * '\\');
+    uintptr_t candidates = ((quotes - kOneInEveryByte) & ~quotes) |
+                           ((backslashes - kOneInEveryByte) & ~backslashes) |
+                           ((w - kOneInEveryByte * 0x20) & ~w);
+    if ((candidates & kMsbInEveryByte) != 0) break;
+    position += sizeof(uintptr_t);
+  }
+  while (position < length) {
+    uint8_t c = chars[position];
+    if (c == '"' || c == '\\' || c < 0x20) return position;
+    position++;
+  }
+  return position;
+}
+
+
 // Scans the rest of a JSON string starting from position_ and writes
 // prefix[start..end] along with the scanned characters into a
 // sequential string of type StringType.
@@ -652,12 +745,27 @@ Handle<String> JsonParser<seq_one_byte>::SlowScanJsonString(
       return SlowScanJsonString<StringType, SinkChar>(seq_string, 0, count);
     }
     if (c0_ != '\\') {
-      // If the sink can contain UC16 characters, or source_ contains only
-      // Latin1 characters, there's no need to test whether we can store the
-      // character. Otherwise check whether the UC16 source character can fit
-      // in the Latin1 sink.
-      if (sizeof(SinkChar) == kUC16Size || seq_one_byte ||
-          c0_ <= String::kMaxOneByteCharCode) {
+      if (seq_one_byte) {
+        // Bulk-copy the plain run starting at the current character instead
+        // of testing and storing one character at a time. The run is capped
+        // at the remaining sink capacity; a capped run re-enters the loop
+        // and grows the sink above.
+        int run_start = position_;
+        int run_end = ScanPlainJsonStringRun(seq_source_->GetChars(),
+                                             run_start, source_length_);
+        if (run_end - run_start > length - count) {
+          run_end = run_start + (length - count);
+        }
+        CopyChars(seq_string->GetChars() + count,
+                  seq_source_->GetChars() + run_start, run_end - run_start);
+        count += run_end - run_start;
+        position_ = run_end - 1;
+        Advance();
+      } else if (sizeof(SinkChar) == kUC16Size ||
+                 c0_ <= String::kMaxOneByteCharCode) {
+        // If the sink can contain UC16 characters there's no need to test
+        // whether we can store the character. Otherwise check whether the
+        // UC16 source character can fit in the Latin1 sink.
         SeqStringSet(seq_string, count++, c0_);
         Advance();
       } else {
@@ -808,8 +916,15 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
   }
 
   int beg_pos = position_;
+  if (seq_one_byte) {
+    // Skip the plain prefix of the string a word at a time; only the
+    // character that ends the run needs individual handling below.
+    position_ = ScanPlainJsonStringRun(seq_source_->GetChars(), position_,
+                                       source_length_) - 1;
+    Advance();
+  }
   // Fast case for Latin1 only without escape characters.
-  do {
+  while (c0_ != '"') {
     // Check for control character (0x00-0x1f) or unterminated string (<0).
     if (c0_ < 0x20) return Handle<String>::null();
     if (c0_ != '\\') {
@@ -825,7 +940,7 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
                                                            beg_pos,
                                                            position_);
     }
-  } while (c0_ != '"');
+  }
   int length = position_ - beg_pos;
   Handle<String> result =
       factory()->NewRawOneByteString(length, pretenure_).ToHandleChecked();
@@ -134,6 +134,39 @@ static bool HasFewDifferentCharacters(Handle<String> pattern) {
 // Generic RegExp methods. Dispatches to implementation specific methods.
 
 
+// Returns true and sets |prefix| to the literal string that every match of
+// |tree| must begin with, if such a prefix can be read off the parse tree.
+// IrregexpExec uses the prefix to skip ahead to candidate match positions
+// with the string search kernels. Case-insensitive patterns are skipped
+// because the search would have to be case-folded as well, and sticky
+// patterns because they must match at the start index exactly.
+static bool GetLiteralMatchPrefix(Isolate* isolate, RegExpTree* tree,
+                                  JSRegExp::Flags flags,
+                                  Handle<String>* prefix) {
+  if (flags.is_ignore_case() || flags.is_sticky()) return false;
+  if (tree->IsAlternative()) {
+    ZoneList<RegExpTree*>* nodes = tree->AsAlternative()->nodes();
+    if (nodes->is_empty()) return false;
+    tree = nodes->at(0);
+  }
+  RegExpAtom* atom = NULL;
+  if (tree->IsAtom()) {
+    atom = tree->AsAtom();
+  } else if (tree->IsText()) {
+    ZoneList<TextElement>* elements = tree->AsText()->elements();
+    if (elements->is_empty()) return false;
+    TextElement first = elements->at(0);
+    if (first.text_type() != TextElement::ATOM) return false;
+    atom = first.atom();
+  }
+  if (atom == NULL || atom->length() == 0) return false;
+  *prefix = isolate->factory()
+                ->NewStringFromTwoByte(atom->data())
+                .ToHandleChecked();
+  return true;
+}
+
+
 MaybeHandle<Object> RegExpImpl::Compile(Handle<JSRegExp> re,
                                         Handle<String> pattern,
                                         JSRegExp::Flags flags) {
@@ -189,6 +222,11 @@ MaybeHandle<Object> RegExpImpl::Compile(Handle<JSRegExp> re,
   }
   if (!has_been_compiled) {
     IrregexpInitialize(re, pattern, flags, parse_result.capture_count);
+    Handle<String> prefix;
+    if (GetLiteralMatchPrefix(isolate, parse_result.tree, flags, &prefix)) {
+      FixedArray::cast(re->data())
+          ->set(JSRegExp::kIrregexpLiteralPrefixIndex, *prefix);
+    }
   }
   DCHECK(re->data()->IsFixedArray());
   // Compilation succeeded so the data is set on the regexp
@@ -537,39 +575,89 @@ int RegExpImpl::IrregexpExecRaw(Handle<JSRegExp> regexp,
   return RE_EXCEPTION;
 #else  // V8_INTERPRETED_REGEXP
 
-  DCHECK(output_size >= IrregexpNumberOfRegisters(*irregexp));
   // We must have done EnsureCompiledIrregexp, so we can get the number of
   // registers.
   int number_of_capture_registers =
       (IrregexpNumberOfCaptures(*irregexp) + 1) * 2;
-  int32_t* raw_output = &output[number_of_capture_registers];
-  // We do not touch the actual capture result registers until we know there
-  // has been a match so that we can use those capture results to set the
-  // last match info.
-  for (int i = number_of_capture_registers - 1; i >= 0; i--) {
-    raw_output[i] = -1;
-  }
+  // Each match occupies one block of registers_per_match registers in the
+  // output array: the capture results in front, followed by the raw
+  // interpreter registers.  See IrregexpPrepare.
+  int registers_per_match =
+      IrregexpNumberOfRegisters(*irregexp) + number_of_capture_registers;
+  DCHECK(output_size >= registers_per_match);
+  int max_matches = output_size / registers_per_match;
   Handle<ByteArray> byte_codes(IrregexpByteCode(*irregexp, is_one_byte),
                                isolate);
 
-  IrregexpResult result = IrregexpInterpreter::Match(isolate,
-                                                     byte_codes,
-                                                     subject,
-                                                     raw_output,
-                                                     index);
-  if (result == RE_SUCCESS) {
-    // Copy capture results to the start of the registers array.
-    MemCopy(output, raw_output, number_of_capture_registers * sizeof(int32_t));
-  }
-  if (result == RE_EXCEPTION) {
-    DCHECK(!isolate->has_pending_exception());
-    isolate->StackOverflow();
-  }
-  return result;
+  int matches = 0;
+  while (matches < max_matches) {
+    int32_t* match_output = &output[matches * registers_per_match];
+    int32_t* raw_output = &match_output[number_of_capture_registers];
+    // We do not touch the actual capture result registers until we know there
+    // has been a match so that we can use those capture results to set the
+    // last match info.
+    for (int i = number_of_capture_registers - 1; i >= 0; i--) {
+      raw_output[i] = -1;
+    }
+    IrregexpResult result = IrregexpInterpreter::Match(isolate,
+                                                       byte_codes,
+                                                       subject,
+                                                       raw_output,
+                                                       index);
+    if (result == RE_EXCEPTION) {
+      DCHECK(!isolate->has_pending_exception());
+      isolate->StackOverflow();
+      return RE_EXCEPTION;
+    }
+    if (result == RE_FAILURE) break;
+    DCHECK(result == RE_SUCCESS);
+    // Copy capture results to the start of this match's register block.
+    MemCopy(match_output, raw_output,
+            number_of_capture_registers * sizeof(int32_t));
+    matches++;
+    index = raw_output[1];
+    if (raw_output[0] == raw_output[1]) {
+      // A zero-length match; advance by one character so the next iteration
+      // makes progress, mirroring the global loop in generated regexp code
+      // and in GlobalCache::FetchNext.
+      index++;
+    }
+    if (index > subject->length()) break;
+  }
+  // For a single-match caller max_matches is 1, so a successful match
+  // returns RE_SUCCESS and a miss returns RE_FAILURE.  Batching callers
+  // get the number of matches stored in the output array.
+  STATIC_ASSERT(RE_FAILURE == 0);
+  STATIC_ASSERT(RE_SUCCESS == 1);
+  return matches;
 #endif  // V8_INTERPRETED_REGEXP
 }
 
 
+// Finds the first occurrence of |prefix| in |subject| at or after |index|,
+// or -1 if there is none.
+static int SearchLiteralPrefix(Isolate* isolate, Handle<String> subject,
+                               Handle<String> prefix, int index) {
+  subject = String::Flatten(subject);
+  DisallowHeapAllocation no_gc;  // ensure vectors stay valid
+  String::FlatContent subject_content = subject->GetFlatContent();
+  String::FlatContent prefix_content = prefix->GetFlatContent();
+  DCHECK(subject_content.IsFlat());
+  DCHECK(prefix_content.IsFlat());
+  return prefix_content.IsOneByte()
+             ? (subject_content.IsOneByte()
+                    ? SearchString(isolate, subject_content.ToOneByteVector(),
+                                   prefix_content.ToOneByteVector(), index)
+                    : SearchString(isolate, subject_content.ToUC16Vector(),
+                                   prefix_content.ToOneByteVector(), index))
+             : (subject_content.IsOneByte()
+                    ? SearchString(isolate, subject_content.ToOneByteVector(),
+                                   prefix_content.ToUC16Vector(), index)
+                    : SearchString(isolate, subject_content.ToUC16Vector(),
+                                   prefix_content.ToUC16Vector(), index));
+}
+
+
 MaybeHandle<Object> RegExpImpl::IrregexpExec(Handle<JSRegExp> regexp,
                                              Handle<String> subject,
                                              int previous_index,
@@ -592,6 +680,17 @@ MaybeHandle<Object> RegExpImpl::IrregexpExec(Handle<JSRegExp> regexp,
     return MaybeHandle<Object>();
   }
 
+  // A match can only begin where the pattern's mandatory literal prefix
+  // occurs, so skip ahead to its next occurrence with the string search
+  // kernels instead of probing every earlier position in generated code.
+  Object* prefix = regexp->DataAt(JSRegExp::kIrregexpLiteralPrefixIndex);
+  if (prefix->IsString()) {
+    previous_index = SearchLiteralPrefix(
+        isolate, subject, handle(String::cast(prefix), isolate),
+        previous_index);
+    if (previous_index < 0) return isolate->factory()->null_value();
+  }
+
   int32_t* output_registers = NULL;
   if (required_registers > Isolate::kJSRegexpStaticOffsetsVectorSize) {
     output_registers = NewArray<int32_t>(required_registers);
@@ -649,17 +748,9 @@ RegExpImpl::GlobalCache::GlobalCache(Handle<JSRegExp> regexp,
     register_array_size_(0),
     regexp_(regexp),
     subject_(subject) {
-#ifdef V8_INTERPRETED_REGEXP
-  bool interpreted = true;
-#else
-  bool interpreted = false;
-#endif  // V8_INTERPRETED_REGEXP
-
   if (regexp_->TypeTag() == JSRegExp::ATOM) {
     static const int kAtomRegistersPerMatch = 2;
     registers_per_match_ = kAtomRegistersPerMatch;
-    // There is no distinction between interpreted and native for atom regexps.
-    interpreted = false;
   } else {
     registers_per_match_ = RegExpImpl::IrregexpPrepare(regexp_, subject_);
     if (registers_per_match_ < 0) {
@@ -668,13 +759,14 @@ RegExpImpl::GlobalCache::GlobalCache(Handle<JSRegExp> regexp,
     }
   }
 
-  if (is_global && !interpreted) {
+  if (is_global) {
+    // Both native code (via its internal global loop) and the interpreter
+    // (via the loop in IrregexpExecRaw) fill as many matches as fit in the
+    // register array per call.
     register_array_size_ =
         Max(registers_per_match_, Isolate::kJSRegexpStaticOffsetsVectorSize);
     max_matches_ = register_array_size_ / registers_per_match_;
   } else {
-    // Global loop in interpreted regexp is not implemented.  We choose
-    // the size of the offsets vector so that it can only store one match.
     register_array_size_ = registers_per_match_;
     max_matches_ = 1;
   }
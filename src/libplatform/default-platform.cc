@@ -30,6 +30,13 @@ bool PumpMessageLoop(v8::Platform* platform, v8::Isolate* isolate) {
 }
 
 
+void RunIdleTasks(v8::Platform* platform, v8::Isolate* isolate,
+                  double idle_time_in_seconds) {
+  reinterpret_cast<DefaultPlatform*>(platform)->RunIdleTasks(
+      isolate, idle_time_in_seconds);
+}
+
+
 const int DefaultPlatform::kMaxThreadPoolSize = 4;
 
 
@@ -54,6 +61,24 @@ DefaultPlatform::~DefaultPlatform() {
       i->second.pop();
     }
   }
+  for (std::map<v8::Isolate*,
+                std::priority_queue<DelayedEntry, std::vector<DelayedEntry>,
+                                    std::greater<DelayedEntry> > >::iterator
+           i = main_thread_delayed_queue_.begin();
+       i != main_thread_delayed_queue_.end(); ++i) {
+    while (!i->second.empty()) {
+      delete i->second.top().second;
+      i->second.pop();
+    }
+  }
+  for (std::map<v8::Isolate*, std::queue<IdleTask*> >::iterator i =
+           main_thread_idle_queue_.begin();
+       i != main_thread_idle_queue_.end(); ++i) {
+    while (!i->second.empty()) {
+      delete i->second.front();
+      i->second.pop();
+    }
+  }
 }
 
 
@@ -82,6 +107,20 @@ bool DefaultPlatform::PumpMessageLoop(v8::Isolate* isolate) {
   Task* task = NULL;
   {
     base::LockGuard<base::Mutex> guard(&lock_);
+
+    // Move delayed tasks that have become ready to the main queue.
+    std::map<v8::Isolate*,
+             std::priority_queue<DelayedEntry, std::vector<DelayedEntry>,
+                                 std::greater<DelayedEntry> > >::iterator
+        delayed = main_thread_delayed_queue_.find(isolate);
+    if (delayed != main_thread_delayed_queue_.end()) {
+      double now = MonotonicallyIncreasingTime();
+      while (!delayed->second.empty() && delayed->second.top().first <= now) {
+        main_thread_queue_[isolate].push(delayed->second.top().second);
+        delayed->second.pop();
+      }
+    }
+
     std::map<v8::Isolate*, std::queue<Task*> >::iterator it =
         main_thread_queue_.find(isolate);
     if (it == main_thread_queue_.end() || it->second.empty()) {
@@ -95,10 +134,36 @@ bool DefaultPlatform::PumpMessageLoop(v8::Isolate* isolate) {
   return true;
 }
 
+
+void DefaultPlatform::RunIdleTasks(v8::Isolate* isolate,
+                                   double idle_time_in_seconds) {
+  double deadline_in_seconds =
+      MonotonicallyIncreasingTime() + idle_time_in_seconds;
+  while (deadline_in_seconds > MonotonicallyIncreasingTime()) {
+    IdleTask* task = NULL;
+    {
+      base::LockGuard<base::Mutex> guard(&lock_);
+      std::map<v8::Isolate*, std::queue<IdleTask*> >::iterator it =
+          main_thread_idle_queue_.find(isolate);
+      if (it == main_thread_idle_queue_.end() || it->second.empty()) {
+        return;
+      }
+      task = it->second.front();
+      it->second.pop();
+    }
+    task->Run(deadline_in_seconds);
+    delete task;
+  }
+}
+
 void DefaultPlatform::CallOnBackgroundThread(Task *task,
                                              ExpectedRuntime expected_runtime) {
   EnsureInitialized();
-  queue_.Append(task);
+  // Long running tasks must not delay short, latency-critical ones such as
+  // the GC helper tasks.
+  queue_.Append(task, expected_runtime == kLongRunningTask
+                          ? TaskQueue::kLowPriority
+                          : TaskQueue::kHighPriority);
 }
 
 
@@ -108,6 +173,25 @@ void DefaultPlatform::CallOnForegroundThread(v8::Isolate* isolate, Task* task) {
 }
 
 
+void DefaultPlatform::CallDelayedOnForegroundThread(Isolate* isolate,
+                                                    Task* task,
+                                                    double delay_in_seconds) {
+  base::LockGuard<base::Mutex> guard(&lock_);
+  double deadline = MonotonicallyIncreasingTime() + delay_in_seconds;
+  main_thread_delayed_queue_[isolate].push(std::make_pair(deadline, task));
+}
+
+
+void DefaultPlatform::CallIdleOnForegroundThread(Isolate* isolate,
+                                                 IdleTask* task) {
+  base::LockGuard<base::Mutex> guard(&lock_);
+  main_thread_idle_queue_[isolate].push(task);
+}
+
+
+bool DefaultPlatform::IdleTasksEnabled(Isolate* isolate) { return true; }
+
+
 double DefaultPlatform::MonotonicallyIncreasingTime() {
   return base::TimeTicks::HighResolutionNow().ToInternalValue() /
          static_cast<double>(base::Time::kMicrosecondsPerSecond);
@@ -5,8 +5,10 @@
 #ifndef V8_LIBPLATFORM_DEFAULT_PLATFORM_H_
 #define V8_LIBPLATFORM_DEFAULT_PLATFORM_H_
 
+#include <functional>
 #include <map>
 #include <queue>
+#include <utility>
 #include <vector>
 
 #include "include/v8-platform.h"
@@ -31,12 +33,18 @@ class DefaultPlatform : public Platform {
   void EnsureInitialized();
 
   bool PumpMessageLoop(v8::Isolate* isolate);
+  void RunIdleTasks(v8::Isolate* isolate, double idle_time_in_seconds);
 
   // v8::Platform implementation.
   virtual void CallOnBackgroundThread(
       Task* task, ExpectedRuntime expected_runtime) override;
   virtual void CallOnForegroundThread(v8::Isolate* isolate,
                                       Task* task) override;
+  virtual void CallDelayedOnForegroundThread(Isolate* isolate, Task* task,
+                                             double delay_in_seconds) override;
+  virtual void CallIdleOnForegroundThread(Isolate* isolate,
+                                          IdleTask* task) override;
+  virtual bool IdleTasksEnabled(Isolate* isolate) override;
   double MonotonicallyIncreasingTime() override;
 
  private:
@@ -49,6 +57,13 @@ class DefaultPlatform : public Platform {
   TaskQueue queue_;
   std::map<v8::Isolate*, std::queue<Task*> > main_thread_queue_;
 
+  typedef std::pair<double, Task*> DelayedEntry;
+  std::map<v8::Isolate*,
+           std::priority_queue<DelayedEntry, std::vector<DelayedEntry>,
+                               std::greater<DelayedEntry> > >
+      main_thread_delayed_queue_;
+  std::map<v8::Isolate*, std::queue<IdleTask*> > main_thread_idle_queue_;
+
   DISALLOW_COPY_AND_ASSIGN(DefaultPlatform);
 };
 
@@ -9,21 +9,33 @@
 namespace v8 {
 namespace platform {
 
-TaskQueue::TaskQueue() : process_queue_semaphore_(0), terminated_(false) {}
+TaskQueue::TaskQueue()
+    : process_queue_semaphore_(0), terminated_(false), waiting_(0) {}
 
 
 TaskQueue::~TaskQueue() {
   base::LockGuard<base::Mutex> guard(&lock_);
   DCHECK(terminated_);
+  DCHECK(high_priority_task_queue_.empty());
   DCHECK(task_queue_.empty());
 }
 
 
-void TaskQueue::Append(Task* task) {
+void TaskQueue::Append(Task* task, Priority priority) {
   base::LockGuard<base::Mutex> guard(&lock_);
   DCHECK(!terminated_);
-  task_queue_.push(task);
-  process_queue_semaphore_.Signal();
+  if (priority == kHighPriority) {
+    high_priority_task_queue_.push(task);
+  } else {
+    task_queue_.push(task);
+  }
+  // Only wake a parked worker. A worker that is still running re-checks both
+  // queues before it parks, so appending a burst of N tasks signals the
+  // semaphore at most min(N, parked workers) times instead of N times.
+  if (waiting_ > 0) {
+    waiting_--;
+    process_queue_semaphore_.Signal();
+  }
 }
 
 
@@ -31,6 +43,11 @@ Task* TaskQueue::GetNext() {
   for (;;) {
     {
       base::LockGuard<base::Mutex> guard(&lock_);
+      if (!high_priority_task_queue_.empty()) {
+        Task* result = high_priority_task_queue_.front();
+        high_priority_task_queue_.pop();
+        return result;
+      }
       if (!task_queue_.empty()) {
         Task* result = task_queue_.front();
         task_queue_.pop();
@@ -40,6 +57,10 @@ Task* TaskQueue::GetNext() {
         process_queue_semaphore_.Signal();
         return NULL;
       }
+      // Register as parked before releasing the lock; Append() consumes the
+      // registration when it signals, so a wakeup between here and Wait()
+      // cannot be lost.
+      waiting_++;
     }
     process_queue_semaphore_.Wait();
   }
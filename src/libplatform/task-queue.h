@@ -19,11 +19,16 @@ namespace platform {
 
 class TaskQueue {
  public:
+  // Latency-critical tasks such as GC helpers are popped before batch work
+  // such as background parsing or compilation, so a backlog of the latter
+  // cannot starve the former.
+  enum Priority { kHighPriority, kLowPriority };
+
   TaskQueue();
   ~TaskQueue();
 
   // Appends a task to the queue. The queue takes ownership of |task|.
-  void Append(Task* task);
+  void Append(Task* task, Priority priority);
 
   // Returns the next task to process. Blocks if no task is available. Returns
   // NULL if the queue is terminated.
@@ -35,8 +40,13 @@ class TaskQueue {
  private:
   base::Mutex lock_;
   base::Semaphore process_queue_semaphore_;
+  std::queue<Task*> high_priority_task_queue_;
   std::queue<Task*> task_queue_;
   bool terminated_;
+  // Number of workers parked (or about to park) in GetNext(). Guarded by
+  // |lock_|; lets Append() skip the semaphore signal when every worker is
+  // already running and will re-check the queues on its own.
+  int waiting_;
 
   DISALLOW_COPY_AND_ASSIGN(TaskQueue);
 };
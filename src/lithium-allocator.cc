@@ -1085,10 +1085,32 @@ bool LAllocator::Allocate(LChunk* chunk) {
   PopulatePointerMaps();
   ConnectRanges();
   ResolveControlFlow();
+  if (FLAG_trace_spilling) PrintSpillSummary();
   return true;
 }
 
 
+void LAllocator::PrintSpillSummary() {
+  int total = 0;
+  int spilled = 0;
+  for (int i = 0; i < live_ranges_.length(); ++i) {
+    LiveRange* range = live_ranges_.at(i);
+    if (range == NULL || range->IsChild()) continue;
+    total++;
+    if (range->HasAllocatedSpillOperand()) spilled++;
+  }
+  PrintF("[spilling: %d/%d live ranges spilled, %d spill slots",
+         spilled, total, chunk_->spill_slot_count());
+  CompilationInfo* info = chunk_->info();
+  if (info->has_shared_info()) {
+    SmartArrayPointer<char> name =
+        info->shared_info()->DebugName()->ToCString();
+    PrintF(" in %s", name.get());
+  }
+  PrintF("]\n");
+}
+
+
 void LAllocator::MeetRegisterConstraints() {
   LAllocatorPhase phase("L_Register constraints", this);
   const ZoneList<HBasicBlock*>* blocks = graph_->blocks();
@@ -1898,10 +1920,31 @@ void LAllocator::AllocateBlockedReg(LiveRange* current) {
   LifetimePosition pos = use_pos[reg];
 
   if (pos.Value() < register_use->pos().Value()) {
-    // All registers are blocked before the first use that requires a register.
-    // Spill starting part of live range up to that use.
-    SpillBetween(current, current->Start(), register_use->pos());
-    return;
+    // All registers are blocked before the first use that requires a
+    // register. Before giving up on the current range, try to evict the
+    // cheapest occupant: a range whose remaining uses sit in colder code
+    // than the uses of the current range. Without this, short cold-path
+    // ranges can force loop-carried values to be spilled on the hot path.
+    double current_weight = SpillWeight(current, current->Start());
+    int cheapest_reg = -1;
+    double cheapest_weight = current_weight;
+    for (int i = 0; i < RegisterCount(); ++i) {
+      // Registers that are hard-blocked before the use cannot be evicted.
+      if (block_pos[i].Value() < register_use->pos().Value()) continue;
+      double occupant_weight = RegisterOccupantWeight(i, current);
+      if (occupant_weight < cheapest_weight) {
+        cheapest_weight = occupant_weight;
+        cheapest_reg = i;
+      }
+    }
+    if (cheapest_reg < 0) {
+      // Spill starting part of live range up to that use.
+      SpillBetween(current, current->Start(), register_use->pos());
+      return;
+    }
+    TraceAlloc("Evicting occupants of reg %s for live range %d\n",
+               RegisterName(cheapest_reg), current->id());
+    reg = cheapest_reg;
   }
 
   if (block_pos[reg].Value() < current->End().Value()) {
@@ -1928,6 +1971,41 @@ void LAllocator::AllocateBlockedReg(LiveRange* current) {
 }
 
 
+double LAllocator::SpillWeight(LiveRange* range, LifetimePosition start) {
+  // A use at loop depth d counts as much as 10^d uses outside any loop,
+  // and a use that must have a register counts double.
+  double weight = 0.0;
+  for (UsePosition* pos = range->NextUsePosition(start);
+       pos != NULL;
+       pos = pos->next()) {
+    double use_weight = pos->RequiresRegister() ? 2.0 : 1.0;
+    int depth = GetBlock(pos->pos().InstructionStart())->LoopNestingDepth();
+    for (int i = 0; i < depth; ++i) use_weight *= 10.0;
+    weight += use_weight;
+  }
+  return weight;
+}
+
+
+double LAllocator::RegisterOccupantWeight(int reg, LiveRange* current) {
+  double weight = 0.0;
+  for (int i = 0; i < active_live_ranges_.length(); ++i) {
+    LiveRange* range = active_live_ranges_[i];
+    if (range->assigned_register() != reg) continue;
+    DCHECK(!range->IsFixed());
+    weight += SpillWeight(range, current->Start());
+  }
+  for (int i = 0; i < inactive_live_ranges_.length(); ++i) {
+    LiveRange* range = inactive_live_ranges_.at(i);
+    if (range->assigned_register() != reg || range->IsFixed()) continue;
+    if (range->FirstIntersection(current).IsValid()) {
+      weight += SpillWeight(range, current->Start());
+    }
+  }
+  return weight;
+}
+
+
 LifetimePosition LAllocator::FindOptimalSpillingPos(LiveRange* range,
                                                     LifetimePosition pos) {
   HBasicBlock* block = GetBlock(pos.InstructionStart());
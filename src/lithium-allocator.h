@@ -432,6 +432,14 @@ class LAllocator BASE_EMBEDDED {
   bool TryAllocateFreeReg(LiveRange* range);
   void AllocateBlockedReg(LiveRange* range);
 
+  // Estimated cost of spilling the given range: uses after start are
+  // counted, with uses in deeper loops weighted exponentially more.
+  double SpillWeight(LiveRange* range, LifetimePosition start);
+
+  // Combined spill weight of the evictable ranges currently assigned to
+  // the given register where they intersect the current range.
+  double RegisterOccupantWeight(int reg, LiveRange* current);
+
   // Live range splitting helpers.
 
   // Split the given range at the given position.
@@ -478,6 +486,10 @@ class LAllocator BASE_EMBEDDED {
   void Spill(LiveRange* range);
   bool IsBlockBoundary(LifetimePosition pos);
 
+  // Print the number of spilled ranges and spill slots used when
+  // --trace-spilling is on.
+  void PrintSpillSummary();
+
   // Helper methods for resolving control flow.
   void ResolveControlFlow(LiveRange* range,
                           HBasicBlock* block,
@@ -71,12 +71,18 @@ void Log::OpenStdout() {
 void Log::OpenTemporaryFile() {
   DCHECK(!IsEnabled());
   output_handle_ = base::OS::OpenTemporaryFile();
+  if (output_handle_ != NULL) {
+    setvbuf(output_handle_, NULL, _IOFBF, kOutputBufferSize);
+  }
 }
 
 
 void Log::OpenFile(const char* name) {
   DCHECK(!IsEnabled());
   output_handle_ = base::OS::FOpen(name, base::OS::LogFileOpenMode);
+  if (output_handle_ != NULL) {
+    setvbuf(output_handle_, NULL, _IOFBF, kOutputBufferSize);
+  }
 }
 
 
@@ -86,6 +92,9 @@ FILE* Log::Close() {
     if (strcmp(FLAG_logfile, kLogToTemporaryFile) != 0) {
       fclose(output_handle_);
     } else {
+      // The temporary file stays open for the caller to read back; make
+      // sure buffered output has reached it.
+      fflush(output_handle_);
       result = output_handle_;
     }
   }
@@ -41,6 +41,11 @@ class Log {
   // Size of buffer used for formatting log messages.
   static const int kMessageBufferSize = 2048;
 
+  // Size of the stdio buffer used for the log file. Messages are streamed
+  // into this buffer and only hit the OS when it fills up or the log is
+  // closed, keeping write syscalls off the paths that emit log events.
+  static const int kOutputBufferSize = 2 * MB;
+
   // This mode is only used in tests, as temporary files are automatically
   // deleted on close and thus can't be accessed afterwards.
   static const char* const kLogToTemporaryFile;
@@ -101,13 +106,13 @@ class Log {
   // Opens a temporary file for logging.
   void OpenTemporaryFile();
 
-  // Implementation of writing to a log file.
+  // Implementation of writing to a log file. Output is buffered; see
+  // kOutputBufferSize.
   int WriteToFile(const char* msg, int length) {
     DCHECK(output_handle_ != NULL);
     size_t rv = fwrite(msg, 1, length, output_handle_);
     DCHECK(static_cast<size_t>(length) == rv);
     USE(rv);
-    fflush(output_handle_);
     return length;
   }
 
@@ -135,11 +135,17 @@ function MathPowJS(x, y) {
 
 // ECMA 262 - 15.8.2.14
 function MathRandom() {
-  var r0 = (MathImul(18030, rngstate[0] & 0xFFFF) + (rngstate[0] >>> 16)) | 0;
-  rngstate[0] = r0;
-  var r1 = (MathImul(36969, rngstate[1] & 0xFFFF) + (rngstate[1] >>> 16)) | 0;
-  rngstate[1] = r1;
-  var x = ((r0 << 16) + (r1 & 0xFFFF)) | 0;
+  // xorshift128 (Marsaglia, "Xorshift RNGs"): four 32-bit state words with
+  // period 2^128 - 1, kept in a per-context typed array so the whole
+  // generator inlines into optimized code.
+  var t = rngstate[0] | 0;
+  t = (t ^ (t << 11)) | 0;
+  rngstate[0] = rngstate[1];
+  rngstate[1] = rngstate[2];
+  var w = rngstate[3] | 0;
+  rngstate[2] = w;
+  var x = ((w ^ (w >>> 19)) ^ (t ^ (t >>> 8))) | 0;
+  rngstate[3] = x;
   // Division by 0x100000000 through multiplication by reciprocal.
   return (x < 0 ? (x + 0x100000000) : x) * 2.3283064365386962890625e-10;
 }
@@ -2852,6 +2852,14 @@ void CallIC_ArrayStub::Generate(MacroAssembler* masm) {
   __ LoadRoot(at, Heap::kAllocationSiteMapRootIndex);
   __ Branch(&miss, ne, t1, Operand(at));
 
+  // Increment the call count; the count is kept in the upper bits of the
+  // extra vector slot, above the has-returned-minus-zero flag.
+  __ sll(at, a3, kPointerSizeLog2 - kSmiTagSize);
+  __ Addu(at, a2, Operand(at));
+  __ lw(t1, FieldMemOperand(at, FixedArray::kHeaderSize + kPointerSize));
+  __ Addu(t1, t1, Operand(Smi::FromInt(CallICNexus::kCallCountIncrement)));
+  __ sw(t1, FieldMemOperand(at, FixedArray::kHeaderSize + kPointerSize));
+
   __ mov(a2, t0);
   __ mov(a3, a1);
   ArrayConstructorStub stub(masm->isolate(), arg_count());
@@ -2911,6 +2919,14 @@ void CallICStub::Generate(MacroAssembler* masm) {
   // convincing us that we have a monomorphic JSFunction.
   __ JumpIfSmi(a1, &extra_checks_or_miss);
 
+  // Increment the call count; the count is kept in the upper bits of the
+  // extra vector slot, above the has-returned-minus-zero flag.
+  __ sll(t0, a3, kPointerSizeLog2 - kSmiTagSize);
+  __ Addu(t0, a2, Operand(t0));
+  __ lw(t1, FieldMemOperand(t0, FixedArray::kHeaderSize + kPointerSize));
+  __ Addu(t1, t1, Operand(Smi::FromInt(CallICNexus::kCallCountIncrement)));
+  __ sw(t1, FieldMemOperand(t0, FixedArray::kHeaderSize + kPointerSize));
+
   __ bind(&have_js_function);
   if (CallAsMethod()) {
     EmitContinueIfStrictOrNative(masm, &cont);
@@ -2986,6 +3002,12 @@ void CallICStub::Generate(MacroAssembler* masm) {
   __ Addu(t0, t0, Operand(Smi::FromInt(1)));
   __ sw(t0, FieldMemOperand(a2, with_types_offset));
 
+  // Initialize the call count to one.
+  __ sll(t0, a3, kPointerSizeLog2 - kSmiTagSize);
+  __ Addu(t0, a2, Operand(t0));
+  __ li(t1, Operand(Smi::FromInt(CallICNexus::kCallCountIncrement)));
+  __ sw(t1, FieldMemOperand(t0, FixedArray::kHeaderSize + kPointerSize));
+
   // Store the function. Use a stub since we need a frame for allocation.
   // a2 - vector
   // a3 - slot
@@ -3525,6 +3547,20 @@ void StringHelper::GenerateFlatOneByteStringEquals(
   // Compare characters.
   __ bind(&compare_chars);
 
+  // Fast negative check: if both hash codes have been computed, different
+  // hashes mean different strings, and the characters never have to be
+  // looked at.
+  Label hash_not_usable;
+  STATIC_ASSERT(Name::kHashNotComputedMask != 0);
+  __ lw(scratch2, FieldMemOperand(left, String::kHashFieldOffset));
+  __ lw(scratch3, FieldMemOperand(right, String::kHashFieldOffset));
+  __ And(at, scratch2, Operand(Name::kHashNotComputedMask));
+  __ Branch(&hash_not_usable, ne, at, Operand(zero_reg));
+  __ And(at, scratch3, Operand(Name::kHashNotComputedMask));
+  __ Branch(&hash_not_usable, ne, at, Operand(zero_reg));
+  __ Branch(&strings_not_equal, ne, scratch2, Operand(scratch3));
+  __ bind(&hash_not_usable);
+
   GenerateOneByteCharsCompareLoop(masm, left, right, length, scratch2, scratch3,
                                   v0, &strings_not_equal);
 
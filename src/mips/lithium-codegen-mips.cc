@@ -85,7 +85,7 @@ bool LCodeGen::GenerateCode() {
 void LCodeGen::FinishCode(Handle<Code> code) {
   DCHECK(is_done());
   code->set_stack_slots(GetStackSlotCount());
-  code->set_safepoint_table_offset(safepoints_.GetCodeOffset());
+  code->set_safepoint_table(*safepoints_.GetSafepointTable());
   PopulateDeoptimizationData(code);
 }
 
@@ -393,7 +393,7 @@ bool LCodeGen::GenerateJumpTable() {
 
 bool LCodeGen::GenerateSafepointTable() {
   DCHECK(is_done());
-  safepoints_.Emit(masm(), GetStackSlotCount());
+  safepoints_.Emit(isolate(), GetStackSlotCount());
   return !is_aborted();
 }
 
@@ -793,10 +793,12 @@ void LCodeGen::RegisterEnvironmentForDeoptimization(LEnvironment* environment,
     }
     Translation translation(&translations_, frame_count, jsframe_count, zone());
     WriteTranslation(environment, &translation);
+    int translation_index = translations_.CommitEntry(translation.index(),
+                                                      zone());
     int deoptimization_index = deoptimizations_.length();
     int pc_offset = masm()->pc_offset();
     environment->Register(deoptimization_index,
-                          translation.index(),
+                          translation_index,
                           (mode == Safepoint::kLazyDeopt) ? pc_offset : -1);
     deoptimizations_.Add(environment, zone());
   }
@@ -798,6 +798,9 @@ void JSRegExp::JSRegExpVerify() {
 
       CHECK(arr->get(JSRegExp::kIrregexpCaptureCountIndex)->IsSmi());
       CHECK(arr->get(JSRegExp::kIrregexpMaxRegisterCountIndex)->IsSmi());
+      Object* literal_prefix =
+          arr->get(JSRegExp::kIrregexpLiteralPrefixIndex);
+      CHECK(literal_prefix->IsSmi() || literal_prefix->IsString());
       break;
     }
     default:
@@ -936,6 +939,7 @@ void CallHandlerInfo::CallHandlerInfoVerify() {
   CHECK(IsCallHandlerInfo());
   VerifyPointer(callback());
   VerifyPointer(data());
+  VerifyPointer(fast_handler());
 }
 
 
@@ -1032,7 +1036,14 @@ void NormalizedMapCache::NormalizedMapCacheVerify() {
     for (int i = 0; i < length(); i++) {
       Object* e = FixedArray::get(i);
       if (e->IsMap()) {
-        Map::cast(e)->DictionaryMapVerify();
+        if (i < kRestoredEntriesOffset) {
+          Map::cast(e)->DictionaryMapVerify();
+        } else {
+          // Restored-map entries hold the fast maps installed by
+          // JSObject::MigrateSlowToFast.
+          CHECK(!Map::cast(e)->is_dictionary_map());
+          Map::cast(e)->MapVerify();
+        }
       } else {
         CHECK(e->IsUndefined());
       }
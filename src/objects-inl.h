@@ -933,7 +933,7 @@ int NormalizedMapCache::GetIndex(Handle<Map> map) {
 
 bool NormalizedMapCache::IsNormalizedMapCache(const Object* obj) {
   if (!obj->IsFixedArray()) return false;
-  if (FixedArray::cast(obj)->length() != NormalizedMapCache::kEntries) {
+  if (FixedArray::cast(obj)->length() != 2 * NormalizedMapCache::kEntries) {
     return false;
   }
 #ifdef VERIFY_HEAP
@@ -1687,12 +1687,12 @@ inline void AllocationSite::set_memento_found_count(int count) {
       SKIP_WRITE_BARRIER);
 }
 
-inline bool AllocationSite::IncrementMementoFoundCount() {
+inline bool AllocationSite::IncrementMementoFoundCount(int increment) {
   if (IsZombie()) return false;
 
   int value = memento_found_count();
-  set_memento_found_count(value + 1);
-  return memento_found_count() == kPretenureMinimumCreated;
+  set_memento_found_count(value + increment);
+  return memento_found_count() >= kPretenureMinimumCreated;
 }
 
 
@@ -3038,12 +3038,16 @@ int DescriptorArray::SearchWithCache(Name* name, Map* map) {
   int number_of_own_descriptors = map->NumberOfOwnDescriptors();
   if (number_of_own_descriptors == 0) return kNotFound;
 
-  DescriptorLookupCache* cache = GetIsolate()->descriptor_lookup_cache();
+  Isolate* isolate = GetIsolate();
+  DescriptorLookupCache* cache = isolate->descriptor_lookup_cache();
   int number = cache->Lookup(map, name);
 
   if (number == DescriptorLookupCache::kAbsent) {
+    isolate->counters()->descriptor_lookup_cache_misses()->Increment();
     number = Search(name, number_of_own_descriptors);
     cache->Update(map, name, number);
+  } else {
+    isolate->counters()->descriptor_lookup_cache_hits()->Increment();
   }
 
   return number;
@@ -3292,14 +3296,16 @@ int HashTable<Derived, Shape, Key>::FindEntry(Isolate* isolate, Key key) {
   uint32_t capacity = Capacity();
   uint32_t entry = FirstProbe(HashTable::Hash(key), capacity);
   uint32_t count = 1;
+  // Uses raw unchecked accessors because it is called by the string table
+  // during bootstrapping. Hoisted out of the probe loop so each probe only
+  // touches the entry itself.
+  Object* undefined = isolate->heap()->raw_unchecked_undefined_value();
+  Object* the_hole = isolate->heap()->raw_unchecked_the_hole_value();
   // EnsureCapacity will guarantee the hash table is never full.
   while (true) {
     Object* element = KeyAt(entry);
-    // Empty entry. Uses raw unchecked accessors because it is called by the
-    // string table during bootstrapping.
-    if (element == isolate->heap()->raw_unchecked_undefined_value()) break;
-    if (element != isolate->heap()->raw_unchecked_the_hole_value() &&
-        Shape::IsMatch(key, element)) return entry;
+    if (element == undefined) break;  // Empty entry.
+    if (element != the_hole && Shape::IsMatch(key, element)) return entry;
     entry = NextProbe(entry, count++, capacity);
   }
   return kNotFound;
@@ -5046,23 +5052,6 @@ void Code::set_stack_slots(unsigned slots) {
 }
 
 
-unsigned Code::safepoint_table_offset() {
-  DCHECK(is_crankshafted());
-  return SafepointTableOffsetField::decode(
-      READ_UINT32_FIELD(this, kKindSpecificFlags2Offset));
-}
-
-
-void Code::set_safepoint_table_offset(unsigned offset) {
-  CHECK(offset <= (1 << kSafepointTableOffsetBitCount));
-  DCHECK(is_crankshafted());
-  DCHECK(IsAligned(offset, static_cast<unsigned>(kIntSize)));
-  int previous = READ_UINT32_FIELD(this, kKindSpecificFlags2Offset);
-  int updated = SafepointTableOffsetField::update(previous, offset);
-  WRITE_UINT32_FIELD(this, kKindSpecificFlags2Offset, updated);
-}
-
-
 unsigned Code::back_edge_table_offset() {
   DCHECK_EQ(FUNCTION, kind());
   return BackEdgeTableOffsetField::decode(
@@ -5498,6 +5487,7 @@ BOOL_ACCESSORS(InterceptorInfo, flags, non_masking, kNonMasking)
 
 ACCESSORS(CallHandlerInfo, callback, Object, kCallbackOffset)
 ACCESSORS(CallHandlerInfo, data, Object, kDataOffset)
+ACCESSORS(CallHandlerInfo, fast_handler, Object, kFastHandlerOffset)
 
 ACCESSORS(TemplateInfo, tag, Object, kTagOffset)
 ACCESSORS(TemplateInfo, property_list, Object, kPropertyListOffset)
@@ -5795,6 +5785,7 @@ BOOL_ACCESSORS(SharedFunctionInfo, compiler_hints, is_anonymous, kIsAnonymous)
 BOOL_ACCESSORS(SharedFunctionInfo, compiler_hints, is_function, kIsFunction)
 BOOL_ACCESSORS(SharedFunctionInfo, compiler_hints, dont_cache, kDontCache)
 BOOL_ACCESSORS(SharedFunctionInfo, compiler_hints, dont_flush, kDontFlush)
+BOOL_ACCESSORS(SharedFunctionInfo, compiler_hints, was_flushed, kWasFlushed)
 BOOL_ACCESSORS(SharedFunctionInfo, compiler_hints, is_arrow, kIsArrow)
 BOOL_ACCESSORS(SharedFunctionInfo, compiler_hints, is_generator, kIsGenerator)
 BOOL_ACCESSORS(SharedFunctionInfo, compiler_hints, is_concise_method,
@@ -6340,6 +6331,7 @@ SMI_ACCESSORS(JSMessageObject, end_position, kEndPositionOffset)
 INT_ACCESSORS(Code, instruction_size, kInstructionSizeOffset)
 INT_ACCESSORS(Code, prologue_offset, kPrologueOffset)
 ACCESSORS(Code, relocation_info, ByteArray, kRelocationInfoOffset)
+ACCESSORS(Code, safepoint_table, ByteArray, kSafepointTableOffset)
 ACCESSORS(Code, handler_table, FixedArray, kHandlerTableOffset)
 ACCESSORS(Code, deoptimization_data, FixedArray, kDeoptimizationDataOffset)
 ACCESSORS(Code, raw_type_feedback_info, Object, kTypeFeedbackInfoOffset)
@@ -6348,6 +6340,7 @@ ACCESSORS(Code, next_code_link, Object, kNextCodeLinkOffset)
 
 void Code::WipeOutHeader() {
   WRITE_FIELD(this, kRelocationInfoOffset, NULL);
+  WRITE_FIELD(this, kSafepointTableOffset, NULL);
   WRITE_FIELD(this, kHandlerTableOffset, NULL);
   WRITE_FIELD(this, kDeoptimizationDataOffset, NULL);
   WRITE_FIELD(this, kConstantPoolOffset, NULL);
@@ -6857,10 +6850,27 @@ inline void StringHasher::AddCharacters(const Char* chars, int length) {
       }
     }
   }
+  // The Jenkins one-at-a-time recurrence is strictly sequential, but keeping
+  // the running hash in a register and reading four characters ahead lets
+  // the compiler combine the loads and hide them behind the hash
+  // computation, without changing any hash values.
+  uint32_t running_hash = raw_running_hash_;
+  for (; i + 4 <= length; i += 4) {
+    DCHECK(!is_array_index_);
+    uint16_t c0 = chars[i];
+    uint16_t c1 = chars[i + 1];
+    uint16_t c2 = chars[i + 2];
+    uint16_t c3 = chars[i + 3];
+    running_hash = AddCharacterCore(running_hash, c0);
+    running_hash = AddCharacterCore(running_hash, c1);
+    running_hash = AddCharacterCore(running_hash, c2);
+    running_hash = AddCharacterCore(running_hash, c3);
+  }
   for (; i < length; i++) {
     DCHECK(!is_array_index_);
-    AddCharacter(chars[i]);
+    running_hash = AddCharacterCore(running_hash, chars[i]);
   }
+  raw_running_hash_ = running_hash;
 }
 
 
@@ -7188,6 +7198,44 @@ Handle<FixedArray> NameDictionary::DoGenerateNewEnumerationIndices(
 }
 
 
+bool NameDictionary::HasEnumKeysCache() {
+  return get(kEnumKeysCacheIndex)->IsFixedArray();
+}
+
+
+FixedArray* NameDictionary::GetEnumKeysCache() {
+  DCHECK(HasEnumKeysCache());
+  return FixedArray::cast(get(kEnumKeysCacheIndex));
+}
+
+
+void NameDictionary::SetEnumKeysCache(FixedArray* keys) {
+  set(kEnumKeysCacheIndex, keys);
+}
+
+
+void NameDictionary::ClearEnumKeysCache() {
+  set(kEnumKeysCacheIndex, Smi::FromInt(0), SKIP_WRITE_BARRIER);
+}
+
+
+int NameDictionary::SlowAccessCount() {
+  Object* count = get(kSlowAccessCountIndex);
+  return count->IsSmi() ? Smi::cast(count)->value() : 0;
+}
+
+
+void NameDictionary::IncrementSlowAccessCount() {
+  set(kSlowAccessCountIndex, Smi::FromInt(SlowAccessCount() + 1),
+      SKIP_WRITE_BARRIER);
+}
+
+
+void NameDictionary::ResetSlowAccessCount() {
+  set(kSlowAccessCountIndex, Smi::FromInt(0), SKIP_WRITE_BARRIER);
+}
+
+
 bool ObjectHashTableShape::IsMatch(Handle<Object> key, Object* other) {
   return key->SameValue(other);
 }
@@ -922,6 +922,7 @@ void CallHandlerInfo::CallHandlerInfoPrint(std::ostream& os) {  // NOLINT
   HeapObject::PrintHeader(os, "CallHandlerInfo");
   os << "\n - callback: " << Brief(callback());
   os << "\n - data: " << Brief(data());
+  os << "\n - fast_handler: " << Brief(fast_handler());
   os << "\n";
 }
 
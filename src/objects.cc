@@ -580,6 +580,8 @@ void JSObject::SetNormalizedProperty(Handle<JSObject> object,
     }
     property_dictionary =
         NameDictionary::Add(property_dictionary, name, value, details);
+    property_dictionary->ClearEnumKeysCache();
+    property_dictionary->ResetSlowAccessCount();
     object->set_properties(*property_dictionary);
     return;
   }
@@ -594,6 +596,10 @@ void JSObject::SetNormalizedProperty(Handle<JSObject> object,
   DCHECK(enumeration_index > 0);
   details = details.set_index(enumeration_index);
   property_dictionary->SetEntry(entry, name, value, details);
+  // The attributes may have changed, e.g. the property may no longer be
+  // enumerable.
+  property_dictionary->ClearEnumKeysCache();
+  property_dictionary->ResetSlowAccessCount();
 }
 
 
@@ -928,6 +934,74 @@ void Smi::SmiPrint(std::ostream& os) const {  // NOLINT
 }
 
 
+int Smi::LexicographicCompare(int x_value, int y_value) {
+  // If the integers are equal so are the string representations.
+  if (x_value == y_value) return EQUAL;
+
+  // If one of the integers is zero the normal integer order is the
+  // same as the lexicographic order of the string representations.
+  if (x_value == 0 || y_value == 0) return x_value < y_value ? LESS : GREATER;
+
+  // If only one of the integers is negative the negative number is
+  // smallest because the char code of '-' is less than the char code
+  // of any digit.  Otherwise, we make both values positive.
+
+  // Use unsigned values otherwise the logic is incorrect for -MIN_INT on
+  // architectures using 32-bit Smis.
+  uint32_t x_scaled = x_value;
+  uint32_t y_scaled = y_value;
+  if (x_value < 0 || y_value < 0) {
+    if (y_value >= 0) return LESS;
+    if (x_value >= 0) return GREATER;
+    x_scaled = -x_value;
+    y_scaled = -y_value;
+  }
+
+  static const uint32_t kPowersOf10[] = {
+      1,                 10,                100,         1000,
+      10 * 1000,         100 * 1000,        1000 * 1000, 10 * 1000 * 1000,
+      100 * 1000 * 1000, 1000 * 1000 * 1000};
+
+  // If the integers have the same number of decimal digits they can be
+  // compared directly as the numeric order is the same as the
+  // lexicographic order.  If one integer has fewer digits, it is scaled
+  // by some power of 10 to have the same number of digits as the longer
+  // integer.  If the scaled integers are equal it means the shorter
+  // integer comes first in the lexicographic order.
+
+  // From http://graphics.stanford.edu/~seander/bithacks.html#IntegerLog10
+  int x_log2 = 31 - base::bits::CountLeadingZeros32(x_scaled);
+  int x_log10 = ((x_log2 + 1) * 1233) >> 12;
+  x_log10 -= x_scaled < kPowersOf10[x_log10];
+
+  int y_log2 = 31 - base::bits::CountLeadingZeros32(y_scaled);
+  int y_log10 = ((y_log2 + 1) * 1233) >> 12;
+  y_log10 -= y_scaled < kPowersOf10[y_log10];
+
+  int tie = EQUAL;
+
+  if (x_log10 < y_log10) {
+    // X has fewer digits.  We would like to simply scale up X but that
+    // might overflow, e.g when comparing 9 with 1_000_000_000, 9 would
+    // be scaled up to 9_000_000_000. So we scale up by the next
+    // smallest power and scale down Y to drop one digit. It is OK to
+    // drop one digit from the longer integer since the final digit is
+    // past the length of the shorter integer.
+    x_scaled *= kPowersOf10[y_log10 - x_log10 - 1];
+    y_scaled /= 10;
+    tie = LESS;
+  } else if (y_log10 < x_log10) {
+    y_scaled *= kPowersOf10[x_log10 - y_log10 - 1];
+    x_scaled /= 10;
+    tie = GREATER;
+  }
+
+  if (x_scaled < y_scaled) return LESS;
+  if (x_scaled > y_scaled) return GREATER;
+  return tie;
+}
+
+
 // Should a word be prefixed by 'a' or 'an' in order to read naturally in
 // English?  Returns false for non-ASCII or words that don't start with
 // a capital letter.  The a/an rule follows pronunciation in English.
@@ -1027,6 +1101,14 @@ bool String::MakeExternal(v8::String::ExternalStringResource* resource) {
                        : heap->external_string_map());
   }
 
+  // Externalization replaces the map and then stores the raw resource
+  // pointer over the former string contents, including the first field of
+  // cons and sliced strings; the concurrent marking task must not scan
+  // the intermediate states.
+  if (heap->incremental_marking()->concurrent_marking_in_progress()) {
+    heap->incremental_marking()->PauseConcurrentMarking();
+  }
+
   // Byte size of the external String object.
   int new_size = this->SizeFromMap(new_map);
   heap->CreateFillerObjectAt(this->address() + new_size, size - new_size);
@@ -1088,6 +1170,14 @@ bool String::MakeExternal(v8::String::ExternalOneByteStringResource* resource) {
                   : heap->external_one_byte_string_map();
   }
 
+  // Externalization replaces the map and then stores the raw resource
+  // pointer over the former string contents, including the first field of
+  // cons and sliced strings; the concurrent marking task must not scan
+  // the intermediate states.
+  if (heap->incremental_marking()->concurrent_marking_in_progress()) {
+    heap->incremental_marking()->PauseConcurrentMarking();
+  }
+
   // Byte size of the external String object.
   int new_size = this->SizeFromMap(new_map);
   heap->CreateFillerObjectAt(this->address() + new_size, size - new_size);
@@ -1825,6 +1915,8 @@ void JSObject::AddSlowProperty(Handle<JSObject> object,
   }
   Handle<NameDictionary> result =
       NameDictionary::Add(dict, name, value, details);
+  result->ClearEnumKeysCache();
+  result->ResetSlowAccessCount();
   if (*dict != *result) object->set_properties(*result);
 }
 
@@ -2210,14 +2302,30 @@ Handle<Map> Map::CopyGeneralizeAllRepresentations(
       DescriptorArray::CopyUpTo(old_descriptors, number_of_own_descriptors);
 
   for (int i = 0; i < number_of_own_descriptors; i++) {
+    PropertyDetails details = descriptors->GetDetails(i);
+    // Double fields other than the modified one keep their representation,
+    // so that their storage stays unboxed across the migration. Only the
+    // modified field has to take arbitrary values and generalizes all the
+    // way to tagged.
+    if (FLAG_unbox_double_fields && i != modify_index &&
+        details.type() == DATA && details.representation().IsDouble()) {
+      isolate->counters()->double_fields_kept_unboxed()->Increment();
+      descriptors->SetValue(i, HeapType::Any());
+      continue;
+    }
+    if (details.representation().IsDouble()) {
+      isolate->counters()->double_fields_boxed()->Increment();
+    }
     descriptors->SetRepresentation(i, Representation::Tagged());
-    if (descriptors->GetDetails(i).type() == DATA) {
+    if (details.type() == DATA) {
       descriptors->SetValue(i, HeapType::Any());
     }
   }
 
-  Handle<LayoutDescriptor> new_layout_descriptor(
-      LayoutDescriptor::FastPointerLayout(), isolate);
+  Handle<LayoutDescriptor> new_layout_descriptor =
+      FLAG_unbox_double_fields
+          ? LayoutDescriptor::New(map, descriptors, number_of_own_descriptors)
+          : handle(LayoutDescriptor::FastPointerLayout(), isolate);
   Handle<Map> new_map = CopyReplaceDescriptors(
       map, descriptors, new_layout_descriptor, OMIT_TRANSITION,
       MaybeHandle<Name>(), reason, SPECIAL_TRANSITION);
@@ -4562,7 +4670,7 @@ Maybe<PropertyAttributes> JSObject::GetElementAttributeWithoutInterceptor(
 
 Handle<NormalizedMapCache> NormalizedMapCache::New(Isolate* isolate) {
   Handle<FixedArray> array(
-      isolate->factory()->NewFixedArray(kEntries, TENURED));
+      isolate->factory()->NewFixedArray(2 * kEntries, TENURED));
   return Handle<NormalizedMapCache>::cast(array);
 }
 
@@ -4587,6 +4695,29 @@ void NormalizedMapCache::Set(Handle<Map> fast_map,
 }
 
 
+MaybeHandle<Map> NormalizedMapCache::GetRestored(Handle<Map> normalized_map) {
+  DisallowHeapAllocation no_gc;
+  Object* value =
+      FixedArray::get(kRestoredEntriesOffset + GetIndex(normalized_map));
+  if (!value->IsMap() || Map::cast(value)->is_deprecated() ||
+      !Map::cast(value)->EquivalentToForNormalization(
+          *normalized_map, KEEP_INOBJECT_PROPERTIES)) {
+    return MaybeHandle<Map>();
+  }
+  return handle(Map::cast(value));
+}
+
+
+void NormalizedMapCache::SetRestored(Handle<Map> normalized_map,
+                                     Handle<Map> restored_map) {
+  DisallowHeapAllocation no_gc;
+  DCHECK(normalized_map->is_dictionary_map());
+  DCHECK(!restored_map->is_dictionary_map());
+  FixedArray::set(kRestoredEntriesOffset + GetIndex(normalized_map),
+                  *restored_map);
+}
+
+
 void NormalizedMapCache::Clear() {
   int entries = length();
   for (int i = 0; i != entries; i++) {
@@ -4656,6 +4787,7 @@ void JSObject::MigrateFastToSlow(Handle<JSObject> object,
         Handle<Object> value;
         if (object->IsUnboxedDoubleField(index)) {
           double old_value = object->RawFastDoublePropertyAt(index);
+          isolate->counters()->double_fields_boxed()->Increment();
           value = isolate->factory()->NewHeapNumber(old_value);
         } else {
           value = handle(object->RawFastPropertyAt(index), isolate);
@@ -4733,6 +4865,91 @@ void JSObject::MigrateFastToSlow(Handle<JSObject> object,
 }
 
 
+// Checks whether a fast map produced by an earlier slow-to-fast migration
+// still describes the current contents of |dictionary|: the same keys in the
+// same enumeration order, with the same attributes and kinds, and matching
+// values for constant descriptors.
+static bool RestoredMapMatchesDictionary(Isolate* isolate, Map* map,
+                                         NameDictionary* dictionary) {
+  DisallowHeapAllocation no_gc;
+  int number_of_descriptors = map->NumberOfOwnDescriptors();
+  if (number_of_descriptors != dictionary->NumberOfElements()) return false;
+  DescriptorArray* descriptors = map->instance_descriptors();
+  for (int i = 0; i < number_of_descriptors; i++) {
+    int entry = dictionary->FindEntry(handle(descriptors->GetKey(i), isolate));
+    if (entry == NameDictionary::kNotFound) return false;
+    PropertyDetails details = descriptors->GetDetails(i);
+    PropertyDetails dictionary_details = dictionary->DetailsAt(entry);
+    if (details.attributes() != dictionary_details.attributes()) return false;
+    // The descriptor order is the enumeration order of the dictionary the
+    // map was originally restored for.
+    if (dictionary_details.dictionary_index() != i + 1) return false;
+    Object* value = dictionary->ValueAt(entry);
+    switch (details.type()) {
+      case DATA:
+        // A fresh migration would have installed a function value as a
+        // constant, so the maps would diverge.
+        if (dictionary_details.type() != DATA || value->IsJSFunction()) {
+          return false;
+        }
+        if (!details.representation().IsTagged()) return false;
+        break;
+      case DATA_CONSTANT:
+        if (dictionary_details.type() != DATA ||
+            value != descriptors->GetValue(i)) {
+          return false;
+        }
+        break;
+      case ACCESSOR_CONSTANT:
+        if (dictionary_details.type() != ACCESSOR_CONSTANT ||
+            value != descriptors->GetValue(i)) {
+          return false;
+        }
+        break;
+      case ACCESSOR:
+        return false;
+    }
+  }
+  return true;
+}
+
+
+// Transforms |object| to a previously restored fast map whose descriptors
+// are known to match the contents of |dictionary|.
+static void MigrateSlowToRestoredMap(Handle<JSObject> object,
+                                     Handle<NameDictionary> dictionary,
+                                     Handle<Map> new_map) {
+  Isolate* isolate = object->GetIsolate();
+  int inobject_props = new_map->inobject_properties();
+  int external_fields = new_map->NumberOfFields() +
+                        new_map->unused_property_fields() - inobject_props;
+  DCHECK_LE(0, external_fields);
+  Handle<FixedArray> fields =
+      isolate->factory()->NewFixedArray(external_fields);
+
+  DisallowHeapAllocation no_gc;
+  DescriptorArray* descriptors = new_map->instance_descriptors();
+  int number_of_descriptors = new_map->NumberOfOwnDescriptors();
+  for (int i = 0; i < number_of_descriptors; i++) {
+    if (descriptors->GetDetails(i).type() != DATA) continue;
+    int entry = dictionary->FindEntry(handle(descriptors->GetKey(i), isolate));
+    DCHECK_NE(NameDictionary::kNotFound, entry);
+    Object* value = dictionary->ValueAt(entry);
+    int offset = descriptors->GetFieldIndex(i);
+    if (offset < inobject_props) {
+      object->InObjectPropertyAtPut(offset, value, UPDATE_WRITE_BARRIER);
+    } else {
+      fields->set(offset - inobject_props, value);
+    }
+  }
+
+  // Transform the object.
+  object->synchronized_set_map(*new_map);
+  object->set_properties(*fields);
+  DCHECK(object->HasFastProperties());
+}
+
+
 void JSObject::MigrateSlowToFast(Handle<JSObject> object,
                                  int unused_property_fields,
                                  const char* reason) {
@@ -4740,6 +4957,7 @@ void JSObject::MigrateSlowToFast(Handle<JSObject> object,
   DCHECK(!object->IsGlobalObject());
   Isolate* isolate = object->GetIsolate();
   Factory* factory = isolate->factory();
+  Handle<Map> old_map(object->map());
   Handle<NameDictionary> dictionary(object->property_dictionary());
 
   // Make sure we preserve dictionary representation if there are too many
@@ -4747,6 +4965,34 @@ void JSObject::MigrateSlowToFast(Handle<JSObject> object,
   int number_of_elements = dictionary->NumberOfElements();
   if (number_of_elements > kMaxNumberOfDescriptors) return;
 
+  // If another object with an equivalent dictionary shape was already
+  // migrated back to fast properties, reuse the map it got so that accesses
+  // to the re-fastified objects stay monomorphic. Prototype maps are kept
+  // private, matching Map::Normalize.
+  Handle<NormalizedMapCache> cache;
+  if (FLAG_migrate_slow_to_fast_on_access && !old_map->is_prototype_map() &&
+      isolate->native_context()->normalized_map_cache()->
+          IsNormalizedMapCache()) {
+    cache = Handle<NormalizedMapCache>(
+        NormalizedMapCache::cast(
+            isolate->native_context()->normalized_map_cache()),
+        isolate);
+    Handle<Map> restored_map;
+    if (number_of_elements == dictionary->NextEnumerationIndex() &&
+        cache->GetRestored(old_map).ToHandle(&restored_map) &&
+        RestoredMapMatchesDictionary(isolate, *restored_map, *dictionary)) {
+#if TRACE_MAPS
+      if (FLAG_trace_maps) {
+        PrintF("[TraceMaps: SlowToFast from= %p to= %p reason= %s (cached) ]\n",
+               reinterpret_cast<void*>(*old_map),
+               reinterpret_cast<void*>(*restored_map), reason);
+      }
+#endif
+      MigrateSlowToRestoredMap(object, dictionary, restored_map);
+      return;
+    }
+  }
+
   Handle<FixedArray> iteration_order;
   if (number_of_elements != dictionary->NextEnumerationIndex()) {
     iteration_order =
@@ -4773,7 +5019,7 @@ void JSObject::MigrateSlowToFast(Handle<JSObject> object,
   int inobject_props = object->map()->inobject_properties();
 
   // Allocate new map.
-  Handle<Map> new_map = Map::CopyDropDescriptors(handle(object->map()));
+  Handle<Map> new_map = Map::CopyDropDescriptors(old_map);
   new_map->set_dictionary_map(false);
 
   if (object->map()->is_prototype_map()) {
@@ -4889,6 +5135,27 @@ void JSObject::MigrateSlowToFast(Handle<JSObject> object,
 
   // Check that it really works.
   DCHECK(object->HasFastProperties());
+
+  // Remember the restored map so that other objects with an equivalent
+  // dictionary shape migrate to the same map.
+  if (!cache.is_null()) cache->SetRestored(old_map, new_map);
+}
+
+
+// static
+void JSObject::RecordSlowModeAccess(Handle<JSObject> object) {
+  DCHECK(FLAG_migrate_slow_to_fast_on_access);
+  if (object->HasFastProperties()) return;
+  if (object->IsGlobalObject()) return;
+  // Prototypes are re-fastified by OptimizeAsPrototype instead.
+  if (object->map()->is_prototype_map()) return;
+  Handle<NameDictionary> dictionary(object->property_dictionary());
+  dictionary->IncrementSlowAccessCount();
+  if (dictionary->SlowAccessCount() <
+      NameDictionary::kSlowAccessMigrationThreshold) {
+    return;
+  }
+  MigrateSlowToFast(object, 0, "SlowModeAccessThreshold");
 }
 
 
@@ -5417,6 +5684,8 @@ void JSObject::DeleteNormalizedProperty(Handle<JSObject> object,
   NameDictionary::DeleteProperty(dictionary, entry);
   Handle<NameDictionary> new_properties =
       NameDictionary::Shrink(dictionary, name);
+  new_properties->ClearEnumKeysCache();
+  new_properties->ResetSlowAccessCount();
   object->set_properties(*new_properties);
 }
 
@@ -6335,6 +6604,13 @@ Handle<FixedArray> JSObject::GetEnumPropertyKeys(Handle<JSObject> object,
         isolate->factory()->NewFixedArray(
             DescriptorArray::kEnumCacheBridgeLength);
     DescriptorArray* desc = object->map()->instance_descriptors();
+    // Install the keys as a copy-on-write array, so that Object.keys can hand
+    // the cache out as the elements of its result without cloning it. The gc
+    // leaves copy-on-write enum caches untrimmed for the same reason (see
+    // MarkCompactCollector::TrimEnumCache).
+    if (storage->length() > 0) {
+      storage->set_map(isolate->heap()->fixed_cow_array_map());
+    }
     desc->SetEnumCache(*bridge_storage,
                        *storage,
                        indices.is_null() ? Object::cast(Smi::FromInt(0))
@@ -6345,12 +6621,21 @@ Handle<FixedArray> JSObject::GetEnumPropertyKeys(Handle<JSObject> object,
     return storage;
   } else {
     Handle<NameDictionary> dictionary(object->property_dictionary());
+    // For non-global receivers the enumerable keys are cached in the
+    // dictionary itself. Global objects are excluded because their cell
+    // updates do not go through the paths that clear the cache.
+    if (!object->IsGlobalObject() && dictionary->HasEnumKeysCache()) {
+      return Handle<FixedArray>(dictionary->GetEnumKeysCache(), isolate);
+    }
     int length = dictionary->NumberOfEnumElements(*object);
     if (length == 0) {
       return Handle<FixedArray>(isolate->heap()->empty_fixed_array());
     }
     Handle<FixedArray> storage = isolate->factory()->NewFixedArray(length);
     dictionary->CopyEnumKeysTo(*object, *storage);
+    if (cache_result && !object->IsGlobalObject()) {
+      dictionary->SetEnumKeysCache(*storage);
+    }
     return storage;
   }
 }
@@ -9200,13 +9485,15 @@ Handle<FixedArray> String::CalculateLineEnds(Handle<String> src,
 }
 
 
-// Compares the contents of two strings by reading and comparing
-// int-sized blocks of characters.
+// Compares the contents of two strings with the same character size for
+// equality. Unlike the ordered comparison in CompareChars, equality of the
+// characters is simply equality of their bytes, so two-byte contents can be
+// handed to memcmp as well.
 template <typename Char>
 static inline bool CompareRawStringContents(const Char* const a,
                                             const Char* const b,
                                             int length) {
-  return CompareChars(a, b, length) == 0;
+  return memcmp(a, b, length * sizeof(Char)) == 0;
 }
 
 
@@ -10561,21 +10848,48 @@ void Oddball::Initialize(Isolate* isolate,
 }
 
 
+void Script::DropSource(Handle<Script> script) {
+  Isolate* isolate = script->GetIsolate();
+  DCHECK(isolate->external_source_store_callback() != NULL);
+  DCHECK(script->source()->IsString());
+  script->set_source(isolate->heap()->undefined_value());
+}
+
+
+MaybeHandle<String> Script::EnsureSource(Handle<Script> script) {
+  Isolate* isolate = script->GetIsolate();
+  if (script->source()->IsString()) {
+    return Handle<String>(String::cast(script->source()), isolate);
+  }
+  v8::ExternalSourceStoreCallback callback =
+      isolate->external_source_store_callback();
+  if (callback == NULL) return MaybeHandle<String>();
+  v8::String::ExternalOneByteStringResource* resource = callback(
+      reinterpret_cast<v8::Isolate*>(isolate), script->id()->value());
+  if (resource == NULL) return MaybeHandle<String>();
+  Handle<String> source;
+  ASSIGN_RETURN_ON_EXCEPTION(
+      isolate, source,
+      isolate->factory()->NewExternalStringFromOneByte(resource), String);
+  script->set_source(*source);
+  return source;
+}
+
+
 void Script::InitLineEnds(Handle<Script> script) {
   if (!script->line_ends()->IsUndefined()) return;
 
   Isolate* isolate = script->GetIsolate();
 
-  if (!script->source()->IsString()) {
-    DCHECK(script->source()->IsUndefined());
+  Handle<String> src;
+  if (!EnsureSource(script).ToHandle(&src)) {
+    if (isolate->has_pending_exception()) isolate->clear_pending_exception();
     Handle<FixedArray> empty = isolate->factory()->NewFixedArray(0);
     script->set_line_ends(*empty);
     DCHECK(script->line_ends()->IsFixedArray());
     return;
   }
 
-  Handle<String> src(String::cast(script->source()), isolate);
-
   Handle<FixedArray> array = String::CalculateLineEnds(src, true);
 
   if (*array != isolate->heap()->empty_fixed_array()) {
@@ -10709,10 +11023,16 @@ bool SharedFunctionInfo::HasSourceCode() const {
 
 
 Handle<Object> SharedFunctionInfo::GetSourceCode() {
-  if (!HasSourceCode()) return GetIsolate()->factory()->undefined_value();
-  Handle<String> source(String::cast(Script::cast(script())->source()));
-  return GetIsolate()->factory()->NewSubString(
-      source, start_position(), end_position());
+  Isolate* isolate = GetIsolate();
+  if (script()->IsUndefined()) return isolate->factory()->undefined_value();
+  Handle<String> source;
+  if (!Script::EnsureSource(handle(Script::cast(script()), isolate))
+           .ToHandle(&source)) {
+    if (isolate->has_pending_exception()) isolate->clear_pending_exception();
+    return isolate->factory()->undefined_value();
+  }
+  return isolate->factory()->NewSubString(source, start_position(),
+                                          end_position());
 }
 
 
@@ -11900,9 +12220,7 @@ void Code::Disassemble(const char* name, std::ostream& os) {  // NOLINT
   os << "Instructions (size = " << instruction_size() << ")\n";
   {
     Isolate* isolate = GetIsolate();
-    int decode_size = is_crankshafted()
-                          ? static_cast<int>(safepoint_table_offset())
-                          : instruction_size();
+    int decode_size = instruction_size();
     // If there might be a back edge table, stop before reaching it.
     if (kind() == Code::FUNCTION) {
       decode_size =
@@ -13606,7 +13924,8 @@ void JSObject::UpdateAllocationSite(Handle<JSObject> object,
   {
     DisallowHeapAllocation no_allocation;
 
-    AllocationMemento* memento = heap->FindAllocationMemento(*object);
+    AllocationMemento* memento =
+        heap->FindAllocationMemento(object->map(), *object);
     if (memento == NULL) return;
 
     // Walk through to the Allocation Site
@@ -16452,6 +16771,20 @@ Handle<Derived> OrderedHashTable<Derived, Iterator, entrysize>::EnsureGrowable(
 }
 
 
+template<class Derived, class Iterator, int entrysize>
+Handle<Derived> OrderedHashTable<Derived, Iterator, entrysize>::Reserve(
+    Handle<Derived> table, int capacity) {
+  DCHECK(!table->IsObsolete());
+
+  // Allocate rounds the capacity up to a power of two; staying at or below
+  // half of kMaxCapacity keeps that within the supported range.
+  if (capacity <= table->Capacity() || capacity > kMaxCapacity / 2) {
+    return table;
+  }
+  return Rehash(table, capacity);
+}
+
+
 template<class Derived, class Iterator, int entrysize>
 Handle<Derived> OrderedHashTable<Derived, Iterator, entrysize>::Shrink(
     Handle<Derived> table) {
@@ -16534,6 +16867,10 @@ template Handle<OrderedHashSet>
 OrderedHashTable<OrderedHashSet, JSSetIterator, 1>::EnsureGrowable(
     Handle<OrderedHashSet> table);
 
+template Handle<OrderedHashSet>
+OrderedHashTable<OrderedHashSet, JSSetIterator, 1>::Reserve(
+    Handle<OrderedHashSet> table, int capacity);
+
 template Handle<OrderedHashSet>
 OrderedHashTable<OrderedHashSet, JSSetIterator, 1>::Shrink(
     Handle<OrderedHashSet> table);
@@ -16551,6 +16888,10 @@ template Handle<OrderedHashMap>
 OrderedHashTable<OrderedHashMap, JSMapIterator, 2>::EnsureGrowable(
     Handle<OrderedHashMap> table);
 
+template Handle<OrderedHashMap>
+OrderedHashTable<OrderedHashMap, JSMapIterator, 2>::Reserve(
+    Handle<OrderedHashMap> table, int capacity);
+
 template Handle<OrderedHashMap>
 OrderedHashTable<OrderedHashMap, JSMapIterator, 2>::Shrink(
     Handle<OrderedHashMap> table);
@@ -17095,7 +17436,8 @@ Handle<JSArrayBuffer> JSTypedArray::MaterializeArrayBuffer(
   void* backing_store =
       isolate->array_buffer_allocator()->AllocateUninitialized(
           fixed_typed_array->DataSize());
-  isolate->heap()->RegisterNewArrayBuffer(backing_store,
+  isolate->heap()->RegisterNewArrayBuffer(isolate->heap()->InNewSpace(*buffer),
+                                          backing_store,
                                           fixed_typed_array->DataSize());
   buffer->set_backing_store(backing_store);
   buffer->set_is_external(false);
@@ -1322,6 +1322,10 @@ class Smi: public Object {
 
   DECLARE_CAST(Smi)
 
+  // Compares two integers by the lexicographic order of their string
+  // representations, as used by the default Array.prototype.sort comparator.
+  static int LexicographicCompare(int x_value, int y_value);
+
   // Dispatched behavior.
   void SmiPrint(std::ostream& os) const;  // NOLINT
   DECLARE_VERIFIER(Smi)
@@ -2107,6 +2111,11 @@ class JSObject: public JSReceiver {
   static void MigrateSlowToFast(Handle<JSObject> object,
                                 int unused_property_fields, const char* reason);
 
+  // Counts a property access on a dictionary mode object that reached the
+  // runtime, and migrates the object back to fast properties once enough
+  // accesses have been seen without an intervening structural change.
+  static void RecordSlowModeAccess(Handle<JSObject> object);
+
   inline bool IsUnboxedDoubleField(FieldIndex index);
 
   // Access fast-case object properties at index.
@@ -3774,7 +3783,7 @@ class NameDictionaryShape : public BaseShape<Handle<Name> > {
   static inline uint32_t Hash(Handle<Name> key);
   static inline uint32_t HashForObject(Handle<Name> key, Object* object);
   static inline Handle<Object> AsHandle(Isolate* isolate, Handle<Name> key);
-  static const int kPrefixSize = 2;
+  static const int kPrefixSize = 4;
   static const int kEntrySize = 3;
   static const bool kIsEnumerable = true;
 };
@@ -3803,9 +3812,33 @@ class NameDictionary: public Dictionary<NameDictionary,
   inline static Handle<FixedArray> DoGenerateNewEnumerationIndices(
       Handle<NameDictionary> dictionary);
 
+  // Cache of the enumerable keys in enumeration order, used by for-in over
+  // non-global dictionary-mode receivers. The cache must be cleared whenever
+  // the key set or property attributes change; value-only stores keep it
+  // valid. Holds a smi zero while invalid.
+  inline bool HasEnumKeysCache();
+  inline FixedArray* GetEnumKeysCache();
+  inline void SetEnumKeysCache(FixedArray* keys);
+  inline void ClearEnumKeysCache();
+
+  // Counter of property accesses that reached the runtime while the holder
+  // stayed in dictionary mode. Structural changes reset the counter; once it
+  // crosses kSlowAccessMigrationThreshold the holder is considered stable
+  // and is migrated back to fast properties.
+  inline int SlowAccessCount();
+  inline void IncrementSlowAccessCount();
+  inline void ResetSlowAccessCount();
+
   // Find entry for key, otherwise return kNotFound. Optimized version of
   // HashTable::FindEntry.
   int FindEntry(Handle<Name> key);
+
+  static const int kEnumKeysCacheIndex = kNextEnumerationIndexIndex + 1;
+  static const int kSlowAccessCountIndex = kEnumKeysCacheIndex + 1;
+
+  // Number of counted runtime accesses after which a dictionary mode holder
+  // is migrated back to fast properties.
+  static const int kSlowAccessMigrationThreshold = 16;
 };
 
 
@@ -4013,6 +4046,11 @@ class OrderedHashTable: public FixedArray {
   // to add at least one new element.
   static Handle<Derived> EnsureGrowable(Handle<Derived> table);
 
+  // Returns an OrderedHashTable (possibly |table|) with space for at least
+  // |capacity| elements, so bulk insertion of a known number of elements
+  // does not rehash through every intermediate table size.
+  static Handle<Derived> Reserve(Handle<Derived> table, int capacity);
+
   // Returns an OrderedHashTable (possibly |table|) that's shrunken
   // if possible.
   static Handle<Derived> Shrink(Handle<Derived> table);
@@ -4494,6 +4532,12 @@ class NormalizedMapCache: public FixedArray {
                                        PropertyNormalizationMode mode);
   void Set(Handle<Map> fast_map, Handle<Map> normalized_map);
 
+  // Remembers which fast map an object with the given normalized map got
+  // when it was migrated back to fast properties, so that equivalent objects
+  // re-fastified later share it.
+  MUST_USE_RESULT MaybeHandle<Map> GetRestored(Handle<Map> normalized_map);
+  void SetRestored(Handle<Map> normalized_map, Handle<Map> restored_map);
+
   void Clear();
 
   DECLARE_CAST(NormalizedMapCache)
@@ -4504,6 +4548,10 @@ class NormalizedMapCache: public FixedArray {
  private:
   static const int kEntries = 64;
 
+  // Entries at kRestoredEntriesOffset + GetIndex(normalized_map) remember
+  // the fast maps installed by JSObject::MigrateSlowToFast.
+  static const int kRestoredEntriesOffset = kEntries;
+
   static inline int GetIndex(Handle<Map> map);
 
   // The following declarations hide base class methods.
@@ -5372,10 +5420,11 @@ class Code: public HeapObject {
   inline unsigned stack_slots();
   inline void set_stack_slots(unsigned slots);
 
-  // [safepoint_table_start]: For kind OPTIMIZED_FUNCTION, the offset in
-  // the instruction stream where the safepoint table starts.
-  inline unsigned safepoint_table_offset();
-  inline void set_safepoint_table_offset(unsigned offset);
+  // [safepoint_table]: For kind STUB and OPTIMIZED_FUNCTION, a byte array
+  // holding the safepoint table; the empty byte array for all other kinds.
+  // Keeping the table in a separate old-space object leaves the executable
+  // part of code space holding only headers and instruction bytes.
+  DECL_ACCESSORS(safepoint_table, ByteArray)
 
   // [back_edge_table_start]: For kind FUNCTION, the offset in the
   // instruction stream where the back edge table starts.
@@ -5611,7 +5660,9 @@ class Code: public HeapObject {
       kDeoptimizationDataOffset + kPointerSize;
   static const int kNextCodeLinkOffset = kTypeFeedbackInfoOffset + kPointerSize;
   static const int kGCMetadataOffset = kNextCodeLinkOffset + kPointerSize;
-  static const int kInstructionSizeOffset = kGCMetadataOffset + kPointerSize;
+  static const int kSafepointTableOffset = kGCMetadataOffset + kPointerSize;
+  static const int kInstructionSizeOffset =
+      kSafepointTableOffset + kPointerSize;
   static const int kICAgeOffset = kInstructionSizeOffset + kIntSize;
   static const int kFlagsOffset = kICAgeOffset + kIntSize;
   static const int kKindSpecificFlags1Offset = kFlagsOffset + kIntSize;
@@ -5679,18 +5730,6 @@ class Code: public HeapObject {
   class IsCrankshaftedField: public BitField<bool,
       kIsCrankshaftedBit, 1> {};  // NOLINT
 
-  // KindSpecificFlags2 layout (STUB and OPTIMIZED_FUNCTION)
-  static const int kSafepointTableOffsetFirstBit = kIsCrankshaftedBit + 1;
-  static const int kSafepointTableOffsetBitCount = 24;
-
-  STATIC_ASSERT(kSafepointTableOffsetFirstBit +
-                kSafepointTableOffsetBitCount <= 32);
-  STATIC_ASSERT(1 + kSafepointTableOffsetBitCount <= 32);
-
-  class SafepointTableOffsetField: public BitField<int,
-      kSafepointTableOffsetFirstBit,
-      kSafepointTableOffsetBitCount> {};  // NOLINT
-
   // KindSpecificFlags2 layout (FUNCTION)
   class BackEdgeTableOffsetField: public BitField<int,
       kIsCrankshaftedBit + 1, 27> {};  // NOLINT
@@ -6634,6 +6673,14 @@ class Box : public Struct {
 
 
 // Container for metadata stored on each prototype map.
+//
+// Together with --eliminate-prototype-chain-checks this implements cached
+// prototype-chain validity: every map using this object as a prototype
+// registers in [prototype_users], and compiled handlers guard whole chains
+// by checking [validity_cell] (see HandlerFrontendHeader in the handler
+// compilers) instead of walking the chain.  The cell is invalidated, and
+// the users deoptimized, only when the prototype actually changes
+// (JSObject::SetPrototype and map transitions on prototype maps).
 class PrototypeInfo : public Struct {
  public:
   // [prototype_users]: WeakFixedArray containing maps using this prototype,
@@ -6763,6 +6810,17 @@ class Script: public Struct {
   // Init line_ends array with code positions of line ends inside script source.
   static void InitLineEnds(Handle<Script> script);
 
+  // Drops the on-heap source string of the script. Only valid when an
+  // external source store callback is registered on the isolate, which is
+  // then responsible for providing the source again on demand.
+  static void DropSource(Handle<Script> script);
+
+  // Returns the source of the script, re-attaching it from the embedder's
+  // external source store if it was dropped. Fails if the script never had
+  // a string source or the store cannot provide it.
+  MUST_USE_RESULT static MaybeHandle<String> EnsureSource(
+      Handle<Script> script);
+
   // Get the JS object wrapping the given script; create it if none exists.
   static Handle<JSObject> GetWrapper(Handle<Script> script);
 
@@ -7100,6 +7158,10 @@ class SharedFunctionInfo: public HeapObject {
   // Indicates that code for this function cannot be flushed.
   DECL_BOOLEAN_ACCESSORS(dont_flush)
 
+  // Indicates that code for this function was flushed and has not been
+  // recompiled yet; used for the code flushing statistics.
+  DECL_BOOLEAN_ACCESSORS(was_flushed)
+
   // Indicates that this function is a generator.
   DECL_BOOLEAN_ACCESSORS(is_generator)
 
@@ -7370,6 +7432,7 @@ class SharedFunctionInfo: public HeapObject {
     kInClassLiteral,
     kIsAsmFunction,
     kDeserialized,
+    kWasFlushed,
     kCompilerHintsCount  // Pseudo entry
   };
   // Add hints for other modes when they're added.
@@ -8152,8 +8215,12 @@ class JSRegExp: public JSObject {
   static const int kIrregexpMaxRegisterCountIndex = kDataIndex + 4;
   // Number of captures in the compiled regexp.
   static const int kIrregexpCaptureCountIndex = kDataIndex + 5;
+  // Literal string that every match must start with, used to skip ahead to
+  // candidate match positions before entering generated code. Smi zero when
+  // no such prefix is known.
+  static const int kIrregexpLiteralPrefixIndex = kDataIndex + 6;
 
-  static const int kIrregexpDataSize = kIrregexpCaptureCountIndex + 1;
+  static const int kIrregexpDataSize = kIrregexpLiteralPrefixIndex + 1;
 
   // Offsets directly into the data fixed array.
   static const int kDataTagOffset =
@@ -8496,7 +8563,7 @@ class AllocationSite: public Struct {
 
   // Increments the mementos found counter and returns true when the first
   // memento was found for a given allocation site.
-  inline bool IncrementMementoFoundCount();
+  inline bool IncrementMementoFoundCount(int increment = 1);
 
   inline void IncrementMementoCreateCount();
 
@@ -10723,6 +10790,10 @@ class CallHandlerInfo: public Struct {
  public:
   DECL_ACCESSORS(callback, Object)
   DECL_ACCESSORS(data, Object)
+  // Optional declared fast-path callback taking unwrapped number arguments;
+  // undefined if the embedder did not provide one.  See
+  // v8::FunctionTemplate::SetFastPrimitiveHandler.
+  DECL_ACCESSORS(fast_handler, Object)
 
   DECLARE_CAST(CallHandlerInfo)
 
@@ -10732,7 +10803,8 @@ class CallHandlerInfo: public Struct {
 
   static const int kCallbackOffset = HeapObject::kHeaderSize;
   static const int kDataOffset = kCallbackOffset + kPointerSize;
-  static const int kSize = kDataOffset + kPointerSize;
+  static const int kFastHandlerOffset = kDataOffset + kPointerSize;
+  static const int kSize = kFastHandlerOffset + kPointerSize;
 
  private:
   DISALLOW_IMPLICIT_CONSTRUCTORS(CallHandlerInfo);
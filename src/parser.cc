@@ -19,6 +19,7 @@
 #include "src/scanner-character-streams.h"
 #include "src/scopeinfo.h"
 #include "src/string-stream.h"
+#include "src/version.h"
 
 namespace v8 {
 namespace internal {
@@ -278,6 +279,8 @@ bool ParseData::IsSane() {
   if (data_length < PreparseDataConstants::kHeaderSize) return false;
   if (Magic() != PreparseDataConstants::kMagicNumber) return false;
   if (Version() != PreparseDataConstants::kCurrentVersion) return false;
+  // Reject data produced by another build, e.g. a stale on-disk cache.
+  if (VersionHash() != Version::Hash()) return false;
   if (HasError()) return false;
   // Check that the space allocated for function entries is sane.
   int functions_size = FunctionsSize();
@@ -315,6 +318,11 @@ unsigned ParseData::Version() {
 }
 
 
+unsigned ParseData::VersionHash() {
+  return Data()[PreparseDataConstants::kVersionHashOffset];
+}
+
+
 int ParseData::FunctionsSize() {
   return static_cast<int>(Data()[PreparseDataConstants::kFunctionsSizeOffset]);
 }
@@ -898,7 +906,7 @@ FunctionLiteral* Parser::ParseProgram(Isolate* isolate, ParseInfo* info) {
   DCHECK(parsing_on_main_thread_);
 
   HistogramTimerScope timer_scope(isolate->counters()->parse(), true);
-  Handle<String> source(String::cast(info->script()->source()));
+  Handle<String> source = Script::EnsureSource(info->script()).ToHandleChecked();
   isolate->counters()->total_parse_size()->Increment(source->length());
   base::ElapsedTimer timer;
   if (FLAG_trace_parse) {
@@ -953,6 +961,7 @@ FunctionLiteral* Parser::ParseProgram(Isolate* isolate, ParseInfo* info) {
     if (result != NULL) *info->cached_data() = recorder.GetScriptData();
     log_ = NULL;
   }
+  if (result != NULL) InstallPreparseTokenLogs(isolate, info->script());
   return result;
 }
 
@@ -1054,7 +1063,9 @@ FunctionLiteral* Parser::ParseLazy(Isolate* isolate, ParseInfo* info) {
   // called in the main thread.
   DCHECK(parsing_on_main_thread_);
   HistogramTimerScope timer_scope(isolate->counters()->parse_lazy());
-  Handle<String> source(String::cast(info->script()->source()));
+  // Lazily compiled functions may belong to a script whose source was
+  // dropped; re-attach it from the embedder's external source store.
+  Handle<String> source = Script::EnsureSource(info->script()).ToHandleChecked();
   isolate->counters()->total_parse_size()->Increment(source->length());
   base::ElapsedTimer timer;
   if (FLAG_trace_parse) {
@@ -1094,6 +1105,15 @@ FunctionLiteral* Parser::ParseLazy(Isolate* isolate, ParseInfo* info,
   DCHECK(scope_ == NULL);
   DCHECK(target_stack_ == NULL);
 
+  PreparseTokenLog* token_log = NULL;
+  if (FLAG_preparse_token_cache) {
+    // If the eager parse of the script recorded the tokens of this function
+    // body, replay them instead of re-scanning the source.
+    token_log = isolate->preparse_token_cache()->Remove(
+        info->script()->id()->value(), shared_info->start_position());
+    if (token_log != NULL) scanner_.SetTokenLogToReplay(token_log);
+  }
+
   Handle<String> name(String::cast(shared_info->name()));
   DCHECK(ast_value_factory());
   fni_ = new (zone()) FuncNameInferrer(ast_value_factory(), zone());
@@ -1183,7 +1203,13 @@ FunctionLiteral* Parser::ParseLazy(Isolate* isolate, ParseInfo* info,
   // Make sure the target stack is empty.
   DCHECK(target_stack_ == NULL);
 
+  if (token_log != NULL) {
+    scanner_.SetTokenLogToReplay(NULL);
+    delete token_log;
+  }
   if (result != NULL) {
+    // Inner functions skipped during this parse recorded their own logs.
+    InstallPreparseTokenLogs(isolate, info->script());
     Handle<String> inferred_name(shared_info->inferred_name());
     result->set_inferred_name(inferred_name);
   }
@@ -4084,8 +4110,29 @@ void Parser::SkipLazyFunctionBody(int* materialized_literal_count,
   // With no cached data, we partially parse the function, without building an
   // AST. This gathers the data needed to build a lazy function.
   SingletonLogger logger;
+  PreparseTokenLog* token_log = NULL;
+  if (FLAG_preparse_token_cache && parsing_on_main_thread_) {
+    // Record the body's tokens as the preparser scans them, so the lazy
+    // compile of this function can replay them instead of re-scanning the
+    // source. The log starts right after the '{' that is the current token.
+    // Background parses skip this; they have no isolate to hand the logs to.
+    token_log = new PreparseTokenLog(scanner()->location().end_pos);
+    scanner()->StartLoggingTokens(token_log);
+  }
   PreParser::PreParseResult result =
       ParseLazyFunctionBodyWithPreParser(&logger, bookmark);
+  if (token_log != NULL) {
+    scanner()->StopLoggingTokens();
+    if (result == PreParser::kPreParseSuccess && !logger.has_error() &&
+        token_log->is_valid() && !(bookmark && bookmark->HasBeenReset())) {
+      // The function is keyed the way SharedFunctionInfo records its start
+      // position; the script id is filled in when the log is installed.
+      token_log->set_function_start(scope_->start_position());
+      preparse_token_logs_.Add(token_log);
+    } else {
+      delete token_log;
+    }
+  }
   if (bookmark && bookmark->HasBeenReset()) {
     return;  // Return immediately if pre-parser devided to abort parsing.
   }
@@ -4125,6 +4172,21 @@ void Parser::SkipLazyFunctionBody(int* materialized_literal_count,
 }
 
 
+void Parser::InstallPreparseTokenLogs(Isolate* isolate,
+                                      Handle<Script> script) {
+  if (preparse_token_logs_.length() == 0) return;
+  DCHECK(parsing_on_main_thread_);
+  PreparseTokenCache* cache = isolate->preparse_token_cache();
+  int script_id = script->id()->value();
+  for (int i = 0; i < preparse_token_logs_.length(); i++) {
+    PreparseTokenLog* log = preparse_token_logs_[i];
+    log->set_script_id(script_id);
+    cache->Put(log);  // Transfers ownership.
+  }
+  preparse_token_logs_.Clear();
+}
+
+
 void Parser::AddAssertIsConstruct(ZoneList<Statement*>* body, int pos) {
   ZoneList<Expression*>* arguments =
       new (zone()) ZoneList<Expression*>(0, zone());
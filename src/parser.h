@@ -272,6 +272,7 @@ class ParseData {
   bool IsSane();
   unsigned Magic();
   unsigned Version();
+  unsigned VersionHash();
   int FunctionsSize();
   int Length() const {
     // Script data length is already checked to be a multiple of unsigned size.
@@ -858,6 +859,9 @@ class Parser : public ParserBase<ParserTraits> {
     reusable_preparser_ = NULL;
     delete cached_parse_data_;
     cached_parse_data_ = NULL;
+    for (int i = 0; i < preparse_token_logs_.length(); i++) {
+      delete preparse_token_logs_[i];
+    }
   }
 
   // Parses the source code represented by the compilation info and sets its
@@ -1123,6 +1127,11 @@ class Parser : public ParserBase<ParserTraits> {
   PreParser::PreParseResult ParseLazyFunctionBodyWithPreParser(
       SingletonLogger* logger, Scanner::BookmarkScope* bookmark = nullptr);
 
+  // Hands the token logs recorded while skipping lazy function bodies over
+  // to the isolate's cache, where the lazy compiles of those functions pick
+  // them up. Only called on the main thread.
+  void InstallPreparseTokenLogs(Isolate* isolate, Handle<Script> script);
+
   // Consumes the ending }.
   ZoneList<Statement*>* ParseEagerFunctionBody(
       const AstRawString* function_name, int pos, Variable* fvar,
@@ -1158,6 +1167,9 @@ class Parser : public ParserBase<ParserTraits> {
   // parsing.
   int use_counts_[v8::Isolate::kUseCounterFeatureCount];
   int total_preparse_skipped_;
+  // Token logs recorded for lazy functions but not yet installed in the
+  // isolate's cache; owned by the parser until handed over.
+  List<PreparseTokenLog*> preparse_token_logs_;
   HistogramTimer* pre_parse_timer_;
 
   bool parsing_on_main_thread_;
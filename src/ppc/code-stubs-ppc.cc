@@ -2896,6 +2896,15 @@ void CallIC_ArrayStub::Generate(MacroAssembler* masm) {
   __ CompareRoot(r8, Heap::kAllocationSiteMapRootIndex);
   __ bne(&miss);
 
+  // Increment the call count; the count is kept in the upper bits of the
+  // extra vector slot, above the has-returned-minus-zero flag.
+  __ SmiToPtrArrayOffset(r8, r6);
+  __ add(r8, r5, r8);
+  __ LoadP(r9, FieldMemOperand(r8, FixedArray::kHeaderSize + kPointerSize));
+  __ AddSmiLiteral(r9, r9, Smi::FromInt(CallICNexus::kCallCountIncrement), r0);
+  __ StoreP(r9, FieldMemOperand(r8, FixedArray::kHeaderSize + kPointerSize),
+            r0);
+
   __ mr(r5, r7);
   __ mr(r6, r4);
   ArrayConstructorStub stub(masm->isolate(), arg_count());
@@ -2953,6 +2962,15 @@ void CallICStub::Generate(MacroAssembler* masm) {
   // convincing us that we have a monomorphic JSFunction.
   __ JumpIfSmi(r4, &extra_checks_or_miss);
 
+  // Increment the call count; the count is kept in the upper bits of the
+  // extra vector slot, above the has-returned-minus-zero flag.
+  __ SmiToPtrArrayOffset(r7, r6);
+  __ add(r7, r5, r7);
+  __ LoadP(r8, FieldMemOperand(r7, FixedArray::kHeaderSize + kPointerSize));
+  __ AddSmiLiteral(r8, r8, Smi::FromInt(CallICNexus::kCallCountIncrement), r0);
+  __ StoreP(r8, FieldMemOperand(r7, FixedArray::kHeaderSize + kPointerSize),
+            r0);
+
   __ bind(&have_js_function);
   if (CallAsMethod()) {
     EmitContinueIfStrictOrNative(masm, &cont);
@@ -3029,6 +3047,13 @@ void CallICStub::Generate(MacroAssembler* masm) {
   __ AddSmiLiteral(r7, r7, Smi::FromInt(1), r0);
   __ StoreP(r7, FieldMemOperand(r5, with_types_offset), r0);
 
+  // Initialize the call count to one.
+  __ SmiToPtrArrayOffset(r7, r6);
+  __ add(r7, r5, r7);
+  __ LoadSmiLiteral(r8, Smi::FromInt(CallICNexus::kCallCountIncrement));
+  __ StoreP(r8, FieldMemOperand(r7, FixedArray::kHeaderSize + kPointerSize),
+            r0);
+
   // Store the function. Use a stub since we need a frame for allocation.
   // r5 - vector
   // r6 - slot
@@ -3545,6 +3570,22 @@ void StringHelper::GenerateFlatOneByteStringEquals(MacroAssembler* masm,
 
   // Compare characters.
   __ bind(&compare_chars);
+
+  // Fast negative check: if both hash codes have been computed, different
+  // hashes mean different strings, and the characters never have to be
+  // looked at.
+  Label hash_not_usable;
+  STATIC_ASSERT(Name::kHashNotComputedMask != 0);
+  __ lwz(scratch2, FieldMemOperand(left, String::kHashFieldOffset));
+  __ lwz(ip, FieldMemOperand(right, String::kHashFieldOffset));
+  __ andi(r0, scratch2, Operand(Name::kHashNotComputedMask));
+  __ bne(&hash_not_usable, cr0);
+  __ andi(r0, ip, Operand(Name::kHashNotComputedMask));
+  __ bne(&hash_not_usable, cr0);
+  __ cmp(scratch2, ip);
+  __ bne(&strings_not_equal);
+  __ bind(&hash_not_usable);
+
   GenerateOneByteCharsCompareLoop(masm, left, right, length, scratch2,
                                   &strings_not_equal);
 
@@ -2242,12 +2242,29 @@ void FullCodeGenerator::EmitGeneratorResume(
   __ LoadP(r6, FieldMemOperand(r6, FixedArray::kLengthOffset));
   __ SmiUntag(r6, SetRC);
 
-  // If we are sending a value and there is no operand stack, we can jump back
-  // in directly.
-  Label call_resume;
+  // If we are sending a value, the saved operand stack (if any) holds plain
+  // values, so we can restore it inline and jump back in directly. The
+  // runtime is only needed to throw into the generator.
   if (resume_mode == JSGeneratorObject::NEXT) {
-    Label slow_resume;
-    __ bne(&slow_resume, cr0);
+    // Push the saved operands, walking the backing store with r5.
+    Label restore_done;
+    __ LoadP(r5, FieldMemOperand(r4, JSGeneratorObject::kOperandStackOffset));
+    __ beq(&restore_done, cr0);
+    Label push_operand;
+    __ mtctr(r6);
+    __ bind(&push_operand);
+    __ LoadP(ip, FieldMemOperand(r5, FixedArray::kHeaderSize));
+    __ push(ip);
+    __ addi(r5, r5, Operand(kPointerSize));
+    __ bdnz(&push_operand);
+    __ bind(&restore_done);
+
+    // Detach the saved operand stack; the empty fixed array is immortal and
+    // immovable, so no write barrier is needed.
+    __ mov(r5, Operand(isolate()->factory()->empty_fixed_array()));
+    __ StoreP(r5, FieldMemOperand(r4, JSGeneratorObject::kOperandStackOffset),
+              r0);
+
     __ LoadP(ip, FieldMemOperand(r7, JSFunction::kCodeEntryOffset));
     {
       __ LoadP(r5, FieldMemOperand(r4, JSGeneratorObject::kContinuationOffset));
@@ -2258,28 +2275,27 @@ void FullCodeGenerator::EmitGeneratorResume(
       __ StoreP(r5, FieldMemOperand(r4, JSGeneratorObject::kContinuationOffset),
                 r0);
       __ Jump(ip);
-      __ bind(&slow_resume);
     }
   } else {
+    // Push holes for the operand stack and call the runtime to fix up the
+    // stack and throw the value.
+    Label call_resume;
     __ beq(&call_resume, cr0);
+    Label operand_loop;
+    __ mtctr(r6);
+    __ bind(&operand_loop);
+    __ push(r5);
+    __ bdnz(&operand_loop);
+
+    __ bind(&call_resume);
+    DCHECK(!result_register().is(r4));
+    __ Push(r4, result_register());
+    __ Push(Smi::FromInt(resume_mode));
+    __ CallRuntime(Runtime::kResumeJSGeneratorObject, 3);
+    // Not reached: the runtime call returns elsewhere.
+    __ stop("not-reached");
   }
 
-  // Otherwise, we push holes for the operand stack and call the runtime to fix
-  // up the stack and the handlers.
-  Label operand_loop;
-  __ mtctr(r6);
-  __ bind(&operand_loop);
-  __ push(r5);
-  __ bdnz(&operand_loop);
-
-  __ bind(&call_resume);
-  DCHECK(!result_register().is(r4));
-  __ Push(r4, result_register());
-  __ Push(Smi::FromInt(resume_mode));
-  __ CallRuntime(Runtime::kResumeJSGeneratorObject, 3);
-  // Not reached: the runtime call returns elsewhere.
-  __ stop("not-reached");
-
   __ bind(&done);
   context()->Plug(result_register());
 }
@@ -2505,53 +2521,68 @@ void FullCodeGenerator::EmitClassDefineProperties(ClassLiteral* lit) {
            FieldMemOperand(r3, JSFunction::kPrototypeOrInitialMapOffset));
   __ push(scratch);
 
-  for (int i = 0; i < lit->properties()->length(); i++) {
-    ObjectLiteral::Property* property = lit->properties()->at(i);
-    Expression* value = property->value();
-
-    if (property->is_static()) {
-      __ LoadP(scratch, MemOperand(sp, kPointerSize));  // constructor
-    } else {
-      __ LoadP(scratch, MemOperand(sp, 0));  // prototype
-    }
+  if (lit->HasOnlySimpleMethods()) {
+    // The class body consists only of plain prototype methods;
+    // install the whole method table with a single runtime call.
+    __ LoadP(scratch, MemOperand(sp, 0));  // prototype
     __ push(scratch);
-    EmitPropertyKey(property, lit->GetIdForProperty(i));
-
-    // The static prototype property is read only. We handle the non computed
-    // property name case in the parser. Since this is the only case where we
-    // need to check for an own read only property we special case this so we do
-    // not need to do this for every property.
-    if (property->is_static() && property->is_computed_name()) {
-      __ CallRuntime(Runtime::kThrowIfStaticPrototype, 1);
-      __ push(r3);
+    for (int i = 0; i < lit->properties()->length(); i++) {
+      ObjectLiteral::Property* property = lit->properties()->at(i);
+      EmitPropertyKey(property, lit->GetIdForProperty(i));
+      VisitForStackValue(property->value());
+      EmitSetHomeObjectIfNeeded(property->value(), 2 * i + 2);
     }
+    __ CallRuntime(Runtime::kDefineClassMethods,
+                   2 * lit->properties()->length() + 1);
+  } else {
+    for (int i = 0; i < lit->properties()->length(); i++) {
+      ObjectLiteral::Property* property = lit->properties()->at(i);
+      Expression* value = property->value();
 
-    VisitForStackValue(value);
-    EmitSetHomeObjectIfNeeded(value, 2);
+      if (property->is_static()) {
+        __ LoadP(scratch, MemOperand(sp, kPointerSize));  // constructor
+      } else {
+        __ LoadP(scratch, MemOperand(sp, 0));  // prototype
+      }
+      __ push(scratch);
+      EmitPropertyKey(property, lit->GetIdForProperty(i));
+
+      // The static prototype property is read only. We handle the non
+      // computed property name case in the parser. Since this is the only
+      // case where we need to check for an own read only property we special
+      // case this so we do not need to do this for every property.
+      if (property->is_static() && property->is_computed_name()) {
+        __ CallRuntime(Runtime::kThrowIfStaticPrototype, 1);
+        __ push(r3);
+      }
 
-    switch (property->kind()) {
-      case ObjectLiteral::Property::CONSTANT:
-      case ObjectLiteral::Property::MATERIALIZED_LITERAL:
-      case ObjectLiteral::Property::PROTOTYPE:
-        UNREACHABLE();
-      case ObjectLiteral::Property::COMPUTED:
-        __ CallRuntime(Runtime::kDefineClassMethod, 3);
-        break;
+      VisitForStackValue(value);
+      EmitSetHomeObjectIfNeeded(value, 2);
 
-      case ObjectLiteral::Property::GETTER:
-        __ mov(r3, Operand(Smi::FromInt(DONT_ENUM)));
-        __ push(r3);
-        __ CallRuntime(Runtime::kDefineGetterPropertyUnchecked, 4);
-        break;
+      switch (property->kind()) {
+        case ObjectLiteral::Property::CONSTANT:
+        case ObjectLiteral::Property::MATERIALIZED_LITERAL:
+        case ObjectLiteral::Property::PROTOTYPE:
+          UNREACHABLE();
+        case ObjectLiteral::Property::COMPUTED:
+          __ CallRuntime(Runtime::kDefineClassMethod, 3);
+          break;
 
-      case ObjectLiteral::Property::SETTER:
-        __ mov(r3, Operand(Smi::FromInt(DONT_ENUM)));
-        __ push(r3);
-        __ CallRuntime(Runtime::kDefineSetterPropertyUnchecked, 4);
-        break;
+        case ObjectLiteral::Property::GETTER:
+          __ mov(r3, Operand(Smi::FromInt(DONT_ENUM)));
+          __ push(r3);
+          __ CallRuntime(Runtime::kDefineGetterPropertyUnchecked, 4);
+          break;
 
-      default:
-        UNREACHABLE();
+        case ObjectLiteral::Property::SETTER:
+          __ mov(r3, Operand(Smi::FromInt(DONT_ENUM)));
+          __ push(r3);
+          __ CallRuntime(Runtime::kDefineSetterPropertyUnchecked, 4);
+          break;
+
+        default:
+          UNREACHABLE();
+      }
     }
   }
 
@@ -9,19 +9,29 @@ namespace v8 {
 namespace internal {
 
 // Generic and general data used by preparse data recorders and readers.
+//
+// The preparse data is a flat array of unsigned ints without embedded
+// pointers, and consumers never write to it, so a buffer produced by one
+// process can be written out and mapped read-only into any number of other
+// processes. The version hash word ties a buffer to the exact V8 build that
+// produced it; buffers from other builds fail the sanity check and are
+// rejected like any other invalid cached data. Keying buffers on disk
+// (e.g. by a hash of the script source) and all file I/O are left to the
+// embedder.
 
 struct PreparseDataConstants {
  public:
   // Layout and constants of the preparse data exchange format.
   static const unsigned kMagicNumber = 0xBadDead;
-  static const unsigned kCurrentVersion = 10;
+  static const unsigned kCurrentVersion = 11;
 
   static const int kMagicOffset = 0;
   static const int kVersionOffset = 1;
-  static const int kHasErrorOffset = 2;
-  static const int kFunctionsSizeOffset = 3;
-  static const int kSizeOffset = 4;
-  static const int kHeaderSize = 5;
+  static const int kVersionHashOffset = 2;
+  static const int kHasErrorOffset = 3;
+  static const int kFunctionsSizeOffset = 4;
+  static const int kSizeOffset = 5;
+  static const int kHeaderSize = 6;
 
   // If encoding a message, the following positions are fixed.
   static const int kMessageStartPos = 0;
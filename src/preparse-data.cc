@@ -5,9 +5,12 @@
 #include "src/base/logging.h"
 #include "src/globals.h"
 #include "src/hashmap.h"
+#include "src/list-inl.h"
 #include "src/parser.h"
 #include "src/preparse-data.h"
 #include "src/preparse-data-format.h"
+#include "src/utils.h"
+#include "src/version.h"
 
 namespace v8 {
 namespace internal {
@@ -18,10 +21,11 @@ CompleteParserRecorder::CompleteParserRecorder() {
       PreparseDataConstants::kMagicNumber;
   preamble_[PreparseDataConstants::kVersionOffset] =
       PreparseDataConstants::kCurrentVersion;
+  preamble_[PreparseDataConstants::kVersionHashOffset] = Version::Hash();
   preamble_[PreparseDataConstants::kHasErrorOffset] = false;
   preamble_[PreparseDataConstants::kFunctionsSizeOffset] = 0;
   preamble_[PreparseDataConstants::kSizeOffset] = 0;
-  DCHECK_EQ(5, PreparseDataConstants::kHeaderSize);
+  DCHECK_EQ(6, PreparseDataConstants::kHeaderSize);
 #ifdef DEBUG
   prev_start_ = -1;
 #endif
@@ -76,4 +80,147 @@ ScriptData* CompleteParserRecorder::GetScriptData() {
 }
 
 
+PreparseTokenLog::PreparseTokenLog(int body_start_pos)
+    : store_(128),
+      body_start_pos_(body_start_pos),
+      last_end_pos_(body_start_pos),
+      valid_(true) {
+  STATIC_ASSERT(Token::NUM_TOKENS <= static_cast<int>(kKindMask) + 1);
+  key_.script_id = -1;
+  key_.function_start = -1;
+}
+
+
+void PreparseTokenLog::Add(const TokenEntry& entry) {
+  if (!valid_) return;
+  if (store_.length() >= kMaxLengthInWords) {
+    Invalidate();
+    return;
+  }
+  unsigned word = static_cast<unsigned>(entry.kind) & kKindMask;
+  if (entry.newline_before) word |= 1u << kNewlineBit;
+  if (entry.needs_rescan) word |= 1u << kRescanBit;
+  int gap = entry.beg_pos - last_end_pos_;
+  int length = entry.end_pos - entry.beg_pos;
+  if (gap < 0 || gap >= static_cast<int>(kGapOverflow) ||
+      length >= static_cast<int>(kLengthOverflow)) {
+    // A huge token or gap, or a look-ahead token the scanner went back over
+    // (e.g. after a regular expression); store the positions in full.
+    word |= kGapOverflow << kGapShift;
+    word |= kLengthOverflow << kLengthShift;
+    store_.Add(word);
+    store_.Add(static_cast<unsigned>(entry.beg_pos));
+    store_.Add(static_cast<unsigned>(entry.end_pos));
+  } else {
+    word |= static_cast<unsigned>(gap) << kGapShift;
+    word |= static_cast<unsigned>(length) << kLengthShift;
+    store_.Add(word);
+  }
+  last_end_pos_ = entry.end_pos;
+}
+
+
+bool PreparseTokenLog::Read(int* index, int* prev_end,
+                            TokenEntry* entry) const {
+  if (*index >= store_.length()) return false;
+  unsigned word = store_.at(*index);
+  entry->kind = static_cast<Token::Value>(word & kKindMask);
+  entry->newline_before = (word & (1u << kNewlineBit)) != 0;
+  entry->needs_rescan = (word & (1u << kRescanBit)) != 0;
+  unsigned gap = (word >> kGapShift) & kGapOverflow;
+  unsigned length = (word >> kLengthShift) & kLengthOverflow;
+  if (gap == kGapOverflow && length == kLengthOverflow) {
+    entry->beg_pos = static_cast<int>(store_.at(*index + 1));
+    entry->end_pos = static_cast<int>(store_.at(*index + 2));
+    *index += 3;
+  } else {
+    entry->beg_pos = *prev_end + static_cast<int>(gap);
+    entry->end_pos = entry->beg_pos + static_cast<int>(length);
+    *index += 1;
+  }
+  *prev_end = entry->end_pos;
+  return true;
+}
+
+
+void PreparseTokenLog::Invalidate() {
+  valid_ = false;
+  store_.Clear();
+}
+
+
+int PreparseTokenLog::SizeInBytes() const {
+  return static_cast<int>(sizeof(*this)) +
+         store_.capacity() * static_cast<int>(sizeof(unsigned));
+}
+
+
+PreparseTokenCache::PreparseTokenCache() : map_(Match), total_size_(0) {}
+
+
+PreparseTokenCache::~PreparseTokenCache() { Clear(); }
+
+
+bool PreparseTokenCache::Match(void* first, void* second) {
+  PreparseTokenLog::CacheKey* a =
+      reinterpret_cast<PreparseTokenLog::CacheKey*>(first);
+  PreparseTokenLog::CacheKey* b =
+      reinterpret_cast<PreparseTokenLog::CacheKey*>(second);
+  return a->script_id == b->script_id &&
+         a->function_start == b->function_start;
+}
+
+
+uint32_t PreparseTokenCache::Hash(int script_id, int function_start) {
+  return ComputeIntegerHash(static_cast<uint32_t>(function_start),
+                            static_cast<uint32_t>(script_id));
+}
+
+
+void PreparseTokenCache::Put(PreparseTokenLog* log) {
+  DCHECK(log->is_valid());
+  DCHECK(log->cache_key()->script_id >= 0);
+  int size = log->SizeInBytes();
+  if (size > kMaxTotalSize) {
+    delete log;
+    return;
+  }
+  if (total_size_ + size > kMaxTotalSize) Clear();
+  uint32_t hash = Hash(log->cache_key()->script_id,
+                       log->cache_key()->function_start);
+  HashMap::Entry* entry = map_.LookupOrInsert(log->cache_key(), hash);
+  if (entry->value != NULL) {
+    // A re-parse of the same function; replace the previous log.
+    PreparseTokenLog* old = static_cast<PreparseTokenLog*>(entry->value);
+    total_size_ -= old->SizeInBytes();
+    delete old;
+  }
+  entry->key = log->cache_key();
+  entry->value = log;
+  total_size_ += size;
+}
+
+
+PreparseTokenLog* PreparseTokenCache::Remove(int script_id,
+                                             int function_start) {
+  PreparseTokenLog::CacheKey key;
+  key.script_id = script_id;
+  key.function_start = function_start;
+  void* value = map_.Remove(&key, Hash(script_id, function_start));
+  if (value == NULL) return NULL;
+  PreparseTokenLog* log = static_cast<PreparseTokenLog*>(value);
+  total_size_ -= log->SizeInBytes();
+  return log;
+}
+
+
+void PreparseTokenCache::Clear() {
+  for (HashMap::Entry* p = map_.Start(); p != NULL; p = map_.Next(p)) {
+    delete static_cast<PreparseTokenLog*>(p->value);
+  }
+  map_.Clear();
+  total_size_ = 0;
+}
+
+
 } }  // namespace v8::internal.
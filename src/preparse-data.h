@@ -7,8 +7,10 @@
 
 #include "src/allocation.h"
 #include "src/hashmap.h"
+#include "src/list.h"
 #include "src/messages.h"
 #include "src/preparse-data-format.h"
+#include "src/token.h"
 
 namespace v8 {
 namespace internal {
@@ -199,6 +201,116 @@ class CompleteParserRecorder : public ParserRecorder {
 };
 
 
+// Compact log of the tokens scanned in a lazy function body, recorded while
+// the preparser skips the body during the eager parse and replayed by the
+// scanner when the function is compiled lazily, so the source is not
+// tokenized a second time (see FLAG_preparse_token_cache).
+//
+// Each token is normally a single unsigned word holding the token kind, a
+// line-terminator-before bit, a needs-rescan bit for tokens that carry
+// scanner state a log entry does not capture, the distance from the end of
+// the previous token and the token length. Tokens that do not fit this
+// encoding are stored with their full positions in two extra words.
+class PreparseTokenLog {
+ public:
+  struct TokenEntry {
+    int beg_pos;
+    int end_pos;
+    Token::Value kind;
+    bool newline_before;
+    bool needs_rescan;
+  };
+
+  // Key under which the log is cached, see PreparseTokenCache.
+  struct CacheKey {
+    int script_id;
+    int function_start;
+  };
+
+  // |body_start_pos| is the position right after the '{' of the body; the
+  // scanner uses it to recognize when replay should engage.
+  explicit PreparseTokenLog(int body_start_pos);
+
+  void Add(const TokenEntry& entry);
+
+  // Reads the next token. |*index| and |*prev_end| hold the read cursor;
+  // initialize them to 0 and body_start_pos(). Returns false at the end of
+  // the log.
+  bool Read(int* index, int* prev_end, TokenEntry* entry) const;
+
+  // Marks the log as unusable, e.g. after the scanner was reset to a
+  // bookmark and recorded positions no longer line up with the input.
+  void Invalidate();
+  bool is_valid() const { return valid_; }
+
+  int body_start_pos() const { return body_start_pos_; }
+  int SizeInBytes() const;
+
+  CacheKey* cache_key() { return &key_; }
+  void set_script_id(int script_id) { key_.script_id = script_id; }
+  void set_function_start(int pos) { key_.function_start = pos; }
+
+ private:
+  // Single-word encoding; the all-ones gap and length fields together mark
+  // a record whose positions follow in two extra words.
+  static const unsigned kKindMask = 0xff;
+  static const int kNewlineBit = 8;
+  static const int kRescanBit = 9;
+  static const int kGapShift = 10;
+  static const int kGapBits = 10;
+  static const int kLengthShift = 20;
+  static const int kLengthBits = 12;
+  static const unsigned kGapOverflow = (1 << kGapBits) - 1;
+  static const unsigned kLengthOverflow = (1 << kLengthBits) - 1;
+
+  // Give up on pathologically large bodies instead of keeping a log that
+  // would crowd everything else out of the cache.
+  static const int kMaxLengthInWords = 32 * KB;
+
+  List<unsigned> store_;
+  int body_start_pos_;
+  int last_end_pos_;
+  bool valid_;
+  CacheKey key_;
+
+  DISALLOW_COPY_AND_ASSIGN(PreparseTokenLog);
+};
+
+
+// Per-isolate cache that carries token logs from the eager parse of a script
+// to the later lazy compiles of its functions. Entries are keyed by script
+// id and function start position, owned by the cache, and handed out at most
+// once; a lazy compile removes its entry, so memory is returned as functions
+// get compiled. Like the other per-isolate caches, the cache makes room by
+// dropping all entries once its size budget is exceeded; a dropped entry
+// only costs a re-scan. Used on the main thread only.
+class PreparseTokenCache {
+ public:
+  PreparseTokenCache();
+  ~PreparseTokenCache();
+
+  // Takes ownership of |log|. The log's cache key must be filled in.
+  void Put(PreparseTokenLog* log);
+
+  // Removes and returns the log for the given function, transferring
+  // ownership to the caller, or NULL if there is none.
+  PreparseTokenLog* Remove(int script_id, int function_start);
+
+  void Clear();
+
+ private:
+  static const int kMaxTotalSize = 1 * MB;
+
+  static bool Match(void* first, void* second);
+  static uint32_t Hash(int script_id, int function_start);
+
+  HashMap map_;
+  int total_size_;
+
+  DISALLOW_COPY_AND_ASSIGN(PreparseTokenCache);
+};
+
+
 } }  // namespace v8::internal.
 
 #endif  // V8_PREPARSE_DATA_H_
@@ -8,6 +8,7 @@ var $promiseReject;
 var $promiseChain;
 var $promiseCatch;
 var $promiseThen;
+var $promiseHandleReactions;
 var $promiseHasUserDefinedRejectHandler;
 var $promiseStatus;
 var $promiseValue;
@@ -123,24 +124,28 @@ function PromiseHandle(value, handler, deferred) {
   }
 }
 
+function PromiseHandleReactions(value, tasks) {
+  for (var i = 0; i < tasks.length; i += 2) {
+    PromiseHandle(value, tasks[i], tasks[i + 1])
+  }
+}
+
 function PromiseEnqueue(value, tasks, status) {
-  var id, name, instrumenting = DEBUG_IS_ACTIVE;
+  if (!DEBUG_IS_ACTIVE) {
+    // The microtask queue dispatches the job straight to
+    // PromiseHandleReactions, so no closure is allocated here.
+    %EnqueuePromiseReactionJob(value, tasks);
+    return;
+  }
+  var id, name;
   %EnqueueMicrotask(function() {
-    if (instrumenting) {
-      %DebugAsyncTaskEvent({ type: "willHandle", id: id, name: name });
-    }
-    for (var i = 0; i < tasks.length; i += 2) {
-      PromiseHandle(value, tasks[i], tasks[i + 1])
-    }
-    if (instrumenting) {
-      %DebugAsyncTaskEvent({ type: "didHandle", id: id, name: name });
-    }
+    %DebugAsyncTaskEvent({ type: "willHandle", id: id, name: name });
+    PromiseHandleReactions(value, tasks);
+    %DebugAsyncTaskEvent({ type: "didHandle", id: id, name: name });
   });
-  if (instrumenting) {
-    id = ++lastMicrotaskId;
-    name = status > 0 ? "Promise.resolve" : "Promise.reject";
-    %DebugAsyncTaskEvent({ type: "enqueue", id: id, name: name });
-  }
+  id = ++lastMicrotaskId;
+  name = status > 0 ? "Promise.resolve" : "Promise.reject";
+  %DebugAsyncTaskEvent({ type: "enqueue", id: id, name: name });
 }
 
 function PromiseIdResolveHandler(x) { return x }
@@ -392,6 +397,7 @@ $promiseReject = PromiseReject;
 $promiseChain = PromiseChain;
 $promiseCatch = PromiseCatch;
 $promiseThen = PromiseThen;
+$promiseHandleReactions = PromiseHandleReactions;
 $promiseHasUserDefinedRejectHandler = PromiseHasUserDefinedRejectHandler;
 $promiseStatus = promiseStatus;
 $promiseValue = promiseValue;
@@ -218,6 +218,17 @@ void RegExpMacroAssemblerIrregexp::LoadCurrentCharacter(int cp_offset,
                                                         int characters) {
   DCHECK(cp_offset >= kMinCPOffset);
   DCHECK(cp_offset <= kMaxCPOffset);
+  if (advance_current_end_ == pc_ && check_bounds && characters == 1) {
+    // Combine advance current and load current char. Labels bound between
+    // the two instructions reset advance_current_end_, so no jump can target
+    // the load when it is fused.
+    pc_ = advance_current_start_;
+    Emit(BC_ADVANCE_CP_AND_LOAD_CURRENT_CHAR, advance_current_offset_);
+    Emit32(cp_offset);
+    EmitOrLink(on_failure);
+    advance_current_end_ = kInvalidPC;
+    return;
+  }
   int bytecode;
   if (check_bounds) {
     if (characters == 4) {
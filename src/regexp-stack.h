@@ -74,8 +74,11 @@ class RegExpStack {
   // Artificial limit used when no memory has been allocated.
   static const uintptr_t kMemoryTop = static_cast<uintptr_t>(-1);
 
-  // Minimal size of allocated stack area.
-  static const size_t kMinimumStackSize = 1 * KB;
+  // Minimal size of allocated stack area, and the size retained across
+  // executions.  Keeping a generous buffer means backtracking-heavy patterns
+  // do not re-run the grow-and-copy sequence on every match; the buffer only
+  // shrinks back to this size, and is freed with the thread's resources.
+  static const size_t kMinimumStackSize = 64 * KB;
 
   // Maximal size of allocated stack area.
   static const size_t kMaximumStackSize = 64 * MB;
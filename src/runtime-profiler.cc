@@ -22,7 +22,14 @@ namespace internal {
 
 
 // Number of times a function has to be seen on the stack before it is
-// optimized.
+// optimized. Persisting tier-up decisions across process restarts has been
+// considered and rejected: optimization is gated on type feedback, and
+// feedback consists of heap pointers (maps, cells, functions) that cannot
+// outlive the isolate, so an imported "hot" set would still have to wait
+// for feedback to be regathered here -- which, with the thresholds below,
+// is also what bounds how fast a restarted process reaches steady state.
+// Sharing unoptimized code across restarts is covered by the script code
+// cache; see CodeSerializer.
 static const int kProfilerTicksBeforeOptimization = 2;
 // If the function optimization was disabled due to high deoptimization count,
 // but the function is hot and has been seen on the stack this number of times,
@@ -52,7 +59,61 @@ static const int kMaxSizeEarlyOpt =
 
 RuntimeProfiler::RuntimeProfiler(Isolate* isolate)
     : isolate_(isolate),
-      any_ic_changed_(false) {
+      any_ic_changed_(false),
+      function_costs_(MatchFunctionCost) {
+}
+
+
+RuntimeProfiler::~RuntimeProfiler() {
+  ResetFunctionCosts();
+}
+
+
+bool RuntimeProfiler::MatchFunctionCost(void* key1, void* key2) {
+  FunctionCost* a = reinterpret_cast<FunctionCost*>(key1);
+  FunctionCost* b = reinterpret_cast<FunctionCost*>(key2);
+  return a->script_id == b->script_id &&
+         a->start_position == b->start_position;
+}
+
+
+static uint32_t FunctionCostHash(int script_id, int start_position) {
+  uint32_t key = static_cast<uint32_t>(script_id) * 31 +
+                 static_cast<uint32_t>(start_position);
+  return ComputeIntegerHash(key, kZeroHashSeed);
+}
+
+
+void RuntimeProfiler::RecordFunctionCost(SharedFunctionInfo* shared) {
+  FunctionCost key;
+  Object* script = shared->script();
+  key.script_id = script->IsScript() ? Script::cast(script)->id()->value() : -1;
+  key.start_position = shared->start_position();
+  uint32_t hash = FunctionCostHash(key.script_id, key.start_position);
+  HashMap::Entry* entry = function_costs_.Lookup(&key, hash);
+  if (entry == NULL) {
+    FunctionCost* cost = new FunctionCost;
+    cost->script_id = key.script_id;
+    cost->start_position = key.start_position;
+    cost->self_ticks = 0;
+    SmartArrayPointer<char> name =
+        shared->DebugName()->ToCString(DISALLOW_NULLS,
+                                       ROBUST_STRING_TRAVERSAL);
+    StrNCpy(Vector<char>(cost->name, sizeof(cost->name)), name.get(),
+            sizeof(cost->name) - 1);
+    cost->name[sizeof(cost->name) - 1] = '\0';
+    entry = function_costs_.LookupOrInsert(cost, hash);
+  }
+  reinterpret_cast<FunctionCost*>(entry->key)->self_ticks++;
+}
+
+
+void RuntimeProfiler::ResetFunctionCosts() {
+  for (HashMap::Entry* entry = function_costs_.Start(); entry != NULL;
+       entry = function_costs_.Next(entry)) {
+    delete reinterpret_cast<FunctionCost*>(entry->key);
+  }
+  function_costs_.Clear();
 }
 
 
@@ -160,6 +221,12 @@ void RuntimeProfiler::OptimizeNow() {
     SharedFunctionInfo* shared = function->shared();
     Code* shared_code = shared->code();
 
+    // Attribute the tick to the function on top of the stack; this is a
+    // cheap self-time estimate with the resolution of the profiler tick.
+    if (FLAG_profile_function_cost && frame_count == 1) {
+      RecordFunctionCost(shared);
+    }
+
     List<JSFunction*> functions(4);
     frame->GetFunctions(&functions);
     for (int i = functions.length(); --i >= 0; ) {
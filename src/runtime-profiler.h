@@ -6,6 +6,7 @@
 #define V8_RUNTIME_PROFILER_H_
 
 #include "src/allocation.h"
+#include "src/hashmap.h"
 
 namespace v8 {
 
@@ -18,10 +19,23 @@ namespace internal {
 class Isolate;
 class JSFunction;
 class Object;
+class SharedFunctionInfo;
 
 class RuntimeProfiler {
  public:
   explicit RuntimeProfiler(Isolate* isolate);
+  ~RuntimeProfiler();
+
+  // Accumulated cost of a single function when --profile-function-cost
+  // is on.  Entries are keyed by (script id, start position) rather than
+  // by SharedFunctionInfo pointer, so they survive the GC moving the
+  // SharedFunctionInfo.
+  struct FunctionCost {
+    int script_id;
+    int start_position;
+    int self_ticks;
+    char name[64];
+  };
 
   void OptimizeNow();
 
@@ -29,14 +43,27 @@ class RuntimeProfiler {
 
   void AttemptOnStackReplacement(JSFunction* function, int nesting_levels = 1);
 
+  // The table of FunctionCost entries collected so far; entries are
+  // hanging off the keys of the map.
+  HashMap* function_costs() { return &function_costs_; }
+
+  void ResetFunctionCosts();
+
  private:
   void Optimize(JSFunction* function, const char* reason);
 
   bool CodeSizeOKForOSR(Code* shared_code);
 
+  // Attribute one profiler tick to the given function.
+  void RecordFunctionCost(SharedFunctionInfo* shared);
+
+  static bool MatchFunctionCost(void* key1, void* key2);
+
   Isolate* isolate_;
 
   bool any_ic_changed_;
+
+  HashMap function_costs_;
 };
 
 } }  // namespace v8::internal
@@ -771,10 +771,15 @@ MathFloor_STUB = function MathFloor_STUB(f, i, v) {
   var r = %_MathFloor(+v);
   if (%_IsMinusZero(r)) {
     // Collect type feedback when the result of the floor is -0. This is
-    // accomplished by storing a sentinel in the second, "extra"
+    // accomplished by setting the low bit of the second, "extra"
     // TypeFeedbackVector slot corresponding to the Math.floor CallIC call in
-    // the caller's TypeVector.
-    %_FixedArraySet(%_GetTypeFeedbackVector(f), ((i|0)+1)|0, 1);
+    // the caller's TypeVector. The upper bits of that slot hold the call
+    // count collected by the CallIC and must be preserved.
+    var vector = %_GetTypeFeedbackVector(f);
+    var extra_index = ((i|0)+1)|0;
+    var count = %_FixedArrayGet(vector, extra_index);
+    if (!%_IsSmi(count)) count = 0;
+    %_FixedArraySet(vector, extra_index, (count | 1) | 0);
     return -0;
   }
   // Return integers in smi range as smis.
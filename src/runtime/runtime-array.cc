@@ -4,7 +4,11 @@
 
 #include "src/v8.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "src/arguments.h"
+#include "src/conversions.h"
 #include "src/messages.h"
 #include "src/runtime/runtime-utils.h"
 
@@ -948,6 +952,272 @@ RUNTIME_FUNCTION(Runtime_RemoveArrayHoles) {
 }
 
 
+// Gives an array a fast backing store with room for an expected number of
+// elements, so builtins that write a dense result of known size neither grow
+// the store step by step nor build the result in dictionary mode when the
+// size is beyond the fast-case construction limit.
+RUNTIME_FUNCTION(Runtime_PreallocateArrayElements) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 2);
+  CONVERT_ARG_HANDLE_CHECKED(JSArray, array, 0);
+  CONVERT_SMI_ARG_CHECKED(capacity, 1);
+  RUNTIME_ASSERT(capacity >= 0);
+  if (capacity > FixedArray::kMaxLength) return *array;
+
+  if (array->HasFastSmiOrObjectElements()) {
+    Handle<FixedArray> elements(FixedArray::cast(array->elements()), isolate);
+    if (elements->length() >= capacity) return *array;
+    Handle<FixedArray> new_elements =
+        isolate->factory()->NewFixedArrayWithHoles(capacity);
+    elements->CopyTo(0, *new_elements, 0, elements->length());
+    array->set_elements(*new_elements);
+  } else if (array->HasDictionaryElements()) {
+    // Only a dictionary that holds nothing yet can be replaced wholesale;
+    // Array(n) beyond kInitialMaxFastElementArray starts out this way.
+    Handle<SeededNumberDictionary> dictionary(
+        SeededNumberDictionary::cast(array->elements()), isolate);
+    if (dictionary->NumberOfElements() != 0) return *array;
+    uint32_t length = 0;
+    CHECK(array->length()->ToArrayIndex(&length));
+    if (length > static_cast<uint32_t>(capacity)) return *array;
+    JSObject::SetFastElementsCapacityAndLength(array, capacity, length,
+                                               JSObject::kForceSmiElements);
+    // All the preallocated slots start out as holes.
+    JSObject::TransitionElementsKind(array, FAST_HOLEY_SMI_ELEMENTS);
+    JSObject::ValidateElements(array);
+  }
+  return *array;
+}
+
+
+// Checks that the receiver is a non-observed JSArray whose packed backing
+// store can be read and written in place, and extracts its kind and length.
+// Packedness also guarantees that reads never consult the prototype chain.
+static bool GetFastPackedArray(Handle<JSObject> object, Handle<JSArray>* array,
+                               ElementsKind* kind, int* length) {
+  if (!object->IsJSArray() || object->map()->is_observed()) return false;
+  Handle<JSArray> candidate = Handle<JSArray>::cast(object);
+  ElementsKind elements_kind = candidate->GetElementsKind();
+  if (elements_kind != FAST_SMI_ELEMENTS &&
+      elements_kind != FAST_DOUBLE_ELEMENTS &&
+      elements_kind != FAST_ELEMENTS) {
+    return false;
+  }
+  *array = candidate;
+  *kind = elements_kind;
+  *length = Smi::cast(candidate->length())->value();
+  return true;
+}
+
+
+// Fills [start, end) of a packed array with the given value directly in the
+// backing store.  Returns true if the array was handled; false means the
+// caller has to take the generic JavaScript path.
+RUNTIME_FUNCTION(Runtime_FastArrayFill) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 4);
+  CONVERT_ARG_HANDLE_CHECKED(JSObject, object, 0);
+  CONVERT_ARG_HANDLE_CHECKED(Object, value, 1);
+  CONVERT_SMI_ARG_CHECKED(start, 2);
+  CONVERT_SMI_ARG_CHECKED(end, 3);
+  Heap* heap = isolate->heap();
+  Handle<JSArray> array;
+  ElementsKind kind;
+  int length;
+  if (!GetFastPackedArray(object, &array, &kind, &length)) {
+    return heap->false_value();
+  }
+  RUNTIME_ASSERT(start >= 0 && end <= length && start <= end);
+  // Writing a value the current kind cannot hold would need a transition;
+  // leave that to the generic path.
+  if (kind == FAST_SMI_ELEMENTS && !value->IsSmi()) return heap->false_value();
+  if (kind == FAST_DOUBLE_ELEMENTS && !value->IsNumber()) {
+    return heap->false_value();
+  }
+  if (start == end) return heap->true_value();
+
+  if (kind == FAST_DOUBLE_ELEMENTS) {
+    DisallowHeapAllocation no_gc;
+    FixedDoubleArray* elements = FixedDoubleArray::cast(array->elements());
+    double double_value = value->Number();
+    for (int i = start; i < end; i++) {
+      elements->set(i, double_value);
+    }
+    return heap->true_value();
+  }
+
+  // The backing store may be shared copy-on-write.
+  JSObject::EnsureWritableFastElements(array);
+  DisallowHeapAllocation no_gc;
+  FixedArray* elements = FixedArray::cast(array->elements());
+  MemsetPointer(elements->data_start() + start, *value, end - start);
+  if (kind == FAST_ELEMENTS && value->IsHeapObject()) {
+    // Batch the write barrier over the filled range.
+    if (!heap->InNewSpace(elements)) {
+      heap->RecordWrites(elements->address(),
+                         elements->OffsetOfElementAt(start), end - start);
+    }
+    heap->incremental_marking()->RecordWrites(elements);
+  }
+  return heap->true_value();
+}
+
+
+// Reverses a packed array in place.  Returns true if the array was handled.
+RUNTIME_FUNCTION(Runtime_FastArrayReverse) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 1);
+  CONVERT_ARG_HANDLE_CHECKED(JSObject, object, 0);
+  Heap* heap = isolate->heap();
+  Handle<JSArray> array;
+  ElementsKind kind;
+  int length;
+  if (!GetFastPackedArray(object, &array, &kind, &length)) {
+    return heap->false_value();
+  }
+  if (length < 2) return heap->true_value();
+
+  if (kind == FAST_DOUBLE_ELEMENTS) {
+    DisallowHeapAllocation no_gc;
+    FixedDoubleArray* elements = FixedDoubleArray::cast(array->elements());
+    double* data = reinterpret_cast<double*>(elements->address() +
+                                             FixedDoubleArray::kHeaderSize);
+    std::reverse(data, data + length);
+    return heap->true_value();
+  }
+
+  // The backing store may be shared copy-on-write.
+  JSObject::EnsureWritableFastElements(array);
+  DisallowHeapAllocation no_gc;
+  FixedArray* elements = FixedArray::cast(array->elements());
+  Object** data = elements->data_start();
+  std::reverse(data, data + length);
+  if (kind == FAST_ELEMENTS) {
+    // The values only moved within the array, but the remembered set and
+    // marking deltas still have to cover the rewritten slots.
+    if (!heap->InNewSpace(elements)) {
+      heap->RecordWrites(elements->address(), elements->OffsetOfElementAt(0),
+                         length);
+    }
+    heap->incremental_marking()->RecordWrites(elements);
+  }
+  return heap->true_value();
+}
+
+
+// Finds the first occurrence of a number in a packed smi or double array,
+// starting at the given index, with strict-equals semantics.  Returns the
+// index or -1, or undefined if the caller has to take the generic path.
+RUNTIME_FUNCTION(Runtime_FastArrayIndexOf) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 3);
+  CONVERT_ARG_HANDLE_CHECKED(JSObject, object, 0);
+  CONVERT_ARG_HANDLE_CHECKED(Object, element, 1);
+  CONVERT_SMI_ARG_CHECKED(from_index, 2);
+  Heap* heap = isolate->heap();
+  Handle<JSArray> array;
+  ElementsKind kind;
+  int length;
+  if (!GetFastPackedArray(object, &array, &kind, &length) ||
+      kind == FAST_ELEMENTS) {
+    return heap->undefined_value();
+  }
+  RUNTIME_ASSERT(from_index >= 0);
+  // A packed array of numbers cannot strict-equal anything but a number,
+  // and NaN never equals itself.
+  if (!element->IsNumber()) return Smi::FromInt(-1);
+  double value = element->Number();
+  if (std::isnan(value)) return Smi::FromInt(-1);
+
+  DisallowHeapAllocation no_gc;
+  if (kind == FAST_SMI_ELEMENTS) {
+    // Strict equality on numbers ignores the sign of zero.
+    if (IsMinusZero(value)) value = 0;
+    if (!IsSmiDouble(value)) return Smi::FromInt(-1);
+    Object* smi = Smi::FromInt(FastD2I(value));
+    Object** data = FixedArray::cast(array->elements())->data_start();
+    for (int i = from_index; i < length; i++) {
+      if (data[i] == smi) return Smi::FromInt(i);
+    }
+  } else {
+    FixedDoubleArray* elements = FixedDoubleArray::cast(array->elements());
+    for (int i = from_index; i < length; i++) {
+      if (elements->get_scalar(i) == value) return Smi::FromInt(i);
+    }
+  }
+  return Smi::FromInt(-1);
+}
+
+
+// Orders two array elements the way the default (comparator-less)
+// Array.prototype.sort comparator does: by the lexicographic order of their
+// string representations.  Integer values are compared without materializing
+// strings; everything else falls back to the shortest decimal representation.
+static bool DefaultNumberCompare(double x, double y) {
+  if (IsInt32Double(x) && IsInt32Double(y)) {
+    return Smi::LexicographicCompare(FastD2I(x), FastD2I(y)) < 0;
+  }
+  char x_buffer[kDoubleToCStringMinBufferSize];
+  char y_buffer[kDoubleToCStringMinBufferSize];
+  const char* x_string =
+      DoubleToCString(x, Vector<char>(x_buffer, sizeof(x_buffer)));
+  const char* y_string =
+      DoubleToCString(y, Vector<char>(y_buffer, sizeof(y_buffer)));
+  return strcmp(x_string, y_string) < 0;
+}
+
+
+// Sorts a packed array of numbers into the default Array.prototype.sort
+// order without leaving the runtime.  Returns true if the array was handled;
+// false means the caller has to take the generic JavaScript path.
+RUNTIME_FUNCTION(Runtime_SortDefaultNumberElements) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 1);
+  CONVERT_ARG_HANDLE_CHECKED(JSObject, object, 0);
+  Heap* heap = isolate->heap();
+  // Observed arrays have to deliver change records for every move, and holey
+  // or non-number elements need the full ToString comparison protocol.
+  if (!object->IsJSArray() || object->map()->is_observed()) {
+    return heap->false_value();
+  }
+  Handle<JSArray> array = Handle<JSArray>::cast(object);
+  ElementsKind kind = array->GetElementsKind();
+  if (kind != FAST_SMI_ELEMENTS && kind != FAST_DOUBLE_ELEMENTS) {
+    return heap->false_value();
+  }
+  int length = Smi::cast(array->length())->value();
+  if (length < 2) return heap->true_value();
+
+  if (kind == FAST_SMI_ELEMENTS) {
+    // The backing store may be shared copy-on-write.
+    JSObject::EnsureWritableFastElements(array);
+  }
+
+  ScopedVector<double> values(length);
+  DisallowHeapAllocation no_gc;
+  if (kind == FAST_SMI_ELEMENTS) {
+    FixedArray* elements = FixedArray::cast(array->elements());
+    for (int i = 0; i < length; i++) {
+      values[i] = Smi::cast(elements->get(i))->value();
+    }
+    std::sort(values.start(), values.start() + length, DefaultNumberCompare);
+    for (int i = 0; i < length; i++) {
+      elements->set(i, Smi::FromInt(FastD2I(values[i])));
+    }
+  } else {
+    FixedDoubleArray* elements = FixedDoubleArray::cast(array->elements());
+    for (int i = 0; i < length; i++) {
+      values[i] = elements->get_scalar(i);
+    }
+    std::sort(values.start(), values.start() + length, DefaultNumberCompare);
+    for (int i = 0; i < length; i++) {
+      elements->set(i, values[i]);
+    }
+  }
+  return heap->true_value();
+}
+
+
 // Move contents of argument 0 (an array) to argument 1 (an array)
 RUNTIME_FUNCTION(Runtime_MoveArrayContents) {
   HandleScope scope(isolate);
@@ -193,13 +193,9 @@ RUNTIME_FUNCTION(Runtime_DefineClass) {
 }
 
 
-RUNTIME_FUNCTION(Runtime_DefineClassMethod) {
-  HandleScope scope(isolate);
-  DCHECK(args.length() == 3);
-  CONVERT_ARG_HANDLE_CHECKED(JSObject, object, 0);
-  CONVERT_ARG_HANDLE_CHECKED(Name, name, 1);
-  CONVERT_ARG_HANDLE_CHECKED(JSFunction, function, 2);
-
+static Object* DefineClassMethod(Isolate* isolate, Handle<JSObject> object,
+                                 Handle<Name> name,
+                                 Handle<JSFunction> function) {
   uint32_t index;
   if (name->AsArrayIndex(&index)) {
     RETURN_FAILURE_ON_EXCEPTION(
@@ -214,6 +210,50 @@ RUNTIME_FUNCTION(Runtime_DefineClassMethod) {
 }
 
 
+RUNTIME_FUNCTION(Runtime_DefineClassMethod) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 3);
+  CONVERT_ARG_HANDLE_CHECKED(JSObject, object, 0);
+  CONVERT_ARG_HANDLE_CHECKED(Name, name, 1);
+  CONVERT_ARG_HANDLE_CHECKED(JSFunction, function, 2);
+
+  return DefineClassMethod(isolate, object, name, function);
+}
+
+
+// Batched version of %DefineClassMethod that installs a whole method table
+// with a single runtime call. Arguments are the receiver followed by
+// (name, function) pairs.
+RUNTIME_FUNCTION(Runtime_DefineClassMethods) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() >= 3 && args.length() % 2 == 1);
+  CONVERT_ARG_HANDLE_CHECKED(JSObject, object, 0);
+
+  // Installing the methods in dictionary mode and migrating back afterwards
+  // builds the final map with a single descriptor array allocation instead
+  // of one transition map and descriptor array copy per method, the same way
+  // object literal boilerplates are built.
+  int number_of_methods = (args.length() - 1) / 2;
+  bool normalized = object->HasFastProperties() && number_of_methods > 1;
+  if (normalized) {
+    JSObject::NormalizeProperties(object, KEEP_INOBJECT_PROPERTIES,
+                                  number_of_methods, "DefineClassMethods");
+  }
+
+  for (int i = 1; i < args.length(); i += 2) {
+    CONVERT_ARG_HANDLE_CHECKED(Name, name, i);
+    CONVERT_ARG_HANDLE_CHECKED(JSFunction, function, i + 1);
+    Object* result = DefineClassMethod(isolate, object, name, function);
+    if (result->IsException()) return result;
+  }
+
+  if (normalized) {
+    JSObject::MigrateSlowToFast(object, 0, "DefineClassMethods");
+  }
+  return isolate->heap()->undefined_value();
+}
+
+
 RUNTIME_FUNCTION(Runtime_ClassGetSourceCode) {
   HandleScope shs(isolate);
   DCHECK(args.length() == 1);
@@ -55,6 +55,19 @@ RUNTIME_FUNCTION(Runtime_SetInitialize) {
 }
 
 
+RUNTIME_FUNCTION(Runtime_SetReserveCapacity) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 2);
+  CONVERT_ARG_HANDLE_CHECKED(JSSet, holder, 0);
+  CONVERT_SMI_ARG_CHECKED(expected, 1);
+  RUNTIME_ASSERT(expected >= 0);
+  Handle<OrderedHashSet> table(OrderedHashSet::cast(holder->table()));
+  table = OrderedHashSet::Reserve(table, expected);
+  holder->set_table(*table);
+  return isolate->heap()->undefined_value();
+}
+
+
 RUNTIME_FUNCTION(Runtime_SetGrow) {
   HandleScope scope(isolate);
   DCHECK(args.length() == 1);
@@ -153,6 +166,19 @@ RUNTIME_FUNCTION(Runtime_MapInitialize) {
 }
 
 
+RUNTIME_FUNCTION(Runtime_MapReserveCapacity) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 2);
+  CONVERT_ARG_HANDLE_CHECKED(JSMap, holder, 0);
+  CONVERT_SMI_ARG_CHECKED(expected, 1);
+  RUNTIME_ASSERT(expected >= 0);
+  Handle<OrderedHashMap> table(OrderedHashMap::cast(holder->table()));
+  table = OrderedHashMap::Reserve(table, expected);
+  holder->set_table(*table);
+  return isolate->heap()->undefined_value();
+}
+
+
 RUNTIME_FUNCTION(Runtime_MapShrink) {
   HandleScope scope(isolate);
   DCHECK(args.length() == 1);
@@ -244,6 +244,18 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
     }
 
     job = dispatcher->FindReadyOSRCandidate(function, ast_id);
+
+    // If an OSR compile of this function is already in flight for another
+    // loop entry, don't stack a second full compile on top of it; keep
+    // spinning until the first one is done.
+    if (job == NULL && dispatcher->IsQueuedForOSR(*function)) {
+      if (FLAG_trace_osr) {
+        PrintF("[OSR - Still waiting for queued (other entry): ");
+        function->PrintName();
+        PrintF(" at AST id %d]\n", ast_id.ToInt());
+      }
+      return NULL;
+    }
   }
 
   if (job != NULL) {
@@ -88,6 +88,45 @@ RUNTIME_FUNCTION(Runtime_DateCurrentTime) {
 }
 
 
+STATIC_ASSERT(DateParser::OUTPUT_SIZE == DateCache::kParseOutputSize);
+
+
+// Copies the parser output between a FixedArray, where components are Smis
+// or null, and the plain int representation the DateCache memo stores.
+static void CopyParseResultToCache(FixedArray* output_array, int* cached) {
+  for (int i = 0; i < DateParser::OUTPUT_SIZE; i++) {
+    Object* value = output_array->get(i);
+    cached[i] = value->IsSmi() ? Smi::cast(value)->value()
+                               : DateCache::kNullParseOutput;
+  }
+}
+
+
+static void CopyParseResultFromCache(const int* cached,
+                                     FixedArray* output_array) {
+  for (int i = 0; i < DateParser::OUTPUT_SIZE; i++) {
+    if (cached[i] == DateCache::kNullParseOutput) {
+      output_array->set_null(i);
+    } else {
+      output_array->set(i, Smi::FromInt(cached[i]));
+    }
+  }
+}
+
+
+// Only results whose components are all representable in the memo can be
+// cached; a genuine component equal to the null sentinel cannot.
+static bool IsCacheableParseResult(const int* cached) {
+  for (int i = 0; i < DateParser::OUTPUT_SIZE; i++) {
+    if (cached[i] == DateCache::kNullParseOutput &&
+        i != DateParser::UTC_OFFSET) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
 RUNTIME_FUNCTION(Runtime_DateParseString) {
   HandleScope scope(isolate);
   DCHECK(args.length() == 2);
@@ -103,11 +142,27 @@ RUNTIME_FUNCTION(Runtime_DateParseString) {
   str = String::Flatten(str);
   DisallowHeapAllocation no_gc;
 
+  DateCache* date_cache = isolate->date_cache();
+  int cached[DateParser::OUTPUT_SIZE];
+
   bool result;
   String::FlatContent str_content = str->GetFlatContent();
   if (str_content.IsOneByte()) {
-    result = DateParser::Parse(str_content.ToOneByteVector(), *output_array,
+    Vector<const uint8_t> vector = str_content.ToOneByteVector();
+    bool use_cache =
+        vector.length() <= DateCache::kMaxParseStringLength;
+    if (use_cache && date_cache->LookupParseResult(vector, cached)) {
+      CopyParseResultFromCache(cached, *output_array);
+      return *output;
+    }
+    result = DateParser::Parse(vector, *output_array,
                                isolate->unicode_cache());
+    if (result && use_cache) {
+      CopyParseResultToCache(*output_array, cached);
+      if (IsCacheableParseResult(cached)) {
+        date_cache->PutParseResult(vector, cached);
+      }
+    }
   } else {
     DCHECK(str_content.IsTwoByte());
     result = DateParser::Parse(str_content.ToUC16Vector(), *output_array,
@@ -122,6 +177,79 @@ RUNTIME_FUNCTION(Runtime_DateParseString) {
 }
 
 
+// Pairs of consecutive decimal digits, i.e. "00" at index 0 up to "99"
+// at index 99, used to emit two-digit date components directly.
+static const char kTwoDigits[] =
+    "00010203040506070809101112131415161718192021222324"
+    "25262728293031323334353637383940414243444546474849"
+    "50515253545556575859606162636465666768697071727374"
+    "75767778798081828384858687888990919293949596979899";
+
+
+static INLINE(int EmitTwoDigits(Handle<SeqOneByteString> dest, int position,
+                                int value)) {
+  DCHECK(0 <= value && value < 100);
+  dest->SeqOneByteStringSet(position, kTwoDigits[value * 2]);
+  dest->SeqOneByteStringSet(position + 1, kTwoDigits[value * 2 + 1]);
+  return position + 2;
+}
+
+
+RUNTIME_FUNCTION(Runtime_DateToISOString) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 1);
+  CONVERT_DOUBLE_ARG_CHECKED(time, 0);
+  RUNTIME_ASSERT(time >= -DateCache::kMaxTimeInMs &&
+                 time <= DateCache::kMaxTimeInMs);
+
+  int64_t time_ms = static_cast<int64_t>(time);
+  int days = DateCache::DaysFromTime(time_ms);
+  int time_in_day = DateCache::TimeInDay(time_ms, days);
+  int year, month, day;
+  isolate->date_cache()->YearMonthDayFromDays(days, &year, &month, &day);
+  int hour = time_in_day / (60 * 60 * 1000);
+  int minute = (time_in_day / (60 * 1000)) % 60;
+  int second = (time_in_day / 1000) % 60;
+  int millisecond = time_in_day % 1000;
+
+  // "1970-01-01T00:00:00.000Z" is 24 characters; the expanded years of
+  // ECMA-262 15.9.1.15.1 ("+275760" / "-271821") take three more.
+  bool expanded_year = year < 0 || year > 9999;
+  int length = expanded_year ? 27 : 24;
+  Handle<SeqOneByteString> dest =
+      isolate->factory()->NewRawOneByteString(length).ToHandleChecked();
+
+  int p = 0;
+  if (expanded_year) {
+    dest->SeqOneByteStringSet(p++, year < 0 ? '-' : '+');
+    int y = year < 0 ? -year : year;
+    p = EmitTwoDigits(dest, p, y / 10000);
+    p = EmitTwoDigits(dest, p, (y / 100) % 100);
+    p = EmitTwoDigits(dest, p, y % 100);
+  } else {
+    p = EmitTwoDigits(dest, p, year / 100);
+    p = EmitTwoDigits(dest, p, year % 100);
+  }
+  dest->SeqOneByteStringSet(p++, '-');
+  p = EmitTwoDigits(dest, p, month + 1);
+  dest->SeqOneByteStringSet(p++, '-');
+  p = EmitTwoDigits(dest, p, day);
+  dest->SeqOneByteStringSet(p++, 'T');
+  p = EmitTwoDigits(dest, p, hour);
+  dest->SeqOneByteStringSet(p++, ':');
+  p = EmitTwoDigits(dest, p, minute);
+  dest->SeqOneByteStringSet(p++, ':');
+  p = EmitTwoDigits(dest, p, second);
+  dest->SeqOneByteStringSet(p++, '.');
+  dest->SeqOneByteStringSet(p++, '0' + millisecond / 100);
+  p = EmitTwoDigits(dest, p, millisecond % 100);
+  dest->SeqOneByteStringSet(p++, 'Z');
+  DCHECK(p == length);
+
+  return *dest;
+}
+
+
 RUNTIME_FUNCTION(Runtime_DateLocalTimezone) {
   HandleScope scope(isolate);
   DCHECK(args.length() == 1);
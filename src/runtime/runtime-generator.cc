@@ -85,13 +85,13 @@ RUNTIME_FUNCTION(Runtime_SuspendJSGeneratorObject) {
 }
 
 
-// Note that this function is the slow path for resuming generators.  It is only
-// called if the suspended activation had operands on the stack, stack handlers
-// needing rewinding, or if the resume should throw an exception.  The fast path
-// is handled directly in FullCodeGenerator::EmitGeneratorResume(), which is
-// inlined into GeneratorNext and GeneratorThrow.  EmitGeneratorResumeResume is
-// called in any case, as it needs to reconstruct the stack frame and make space
-// for arguments and operands.
+// Note that this function is the slow path for resuming generators.  It is
+// only called if the resume should throw an exception into the generator.
+// Sending a value is handled entirely in FullCodeGenerator::
+// EmitGeneratorResume(), which reconstructs the stack frame and restores the
+// saved operand stack itself.  EmitGeneratorResume is inlined into
+// GeneratorNext and GeneratorThrow and runs in any case, as it needs to make
+// space for arguments and operands before entering the runtime.
 RUNTIME_FUNCTION(Runtime_ResumeJSGeneratorObject) {
   SealHandleScope shs(isolate);
   DCHECK(args.length() == 3);
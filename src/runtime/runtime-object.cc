@@ -927,6 +927,21 @@ RUNTIME_FUNCTION(Runtime_GetOwnPropertyNames) {
   // Find the number of objects making up this.
   int length = OwnPrototypeChainLength(*obj);
 
+  // For a fast mode object without hidden prototypes the names, including
+  // the non-enumerable ones, depend only on the map and the filter, so the
+  // result can be memoized. Cached name arrays are copy-on-write and are
+  // handed out as the elements of the result without cloning.
+  bool cacheable =
+      obj->HasFastProperties() && !obj->IsAccessCheckNeeded() && length == 1;
+  if (cacheable) {
+    FixedArray* cached =
+        isolate->own_property_names_cache()->Lookup(obj->map(), filter_value);
+    if (cached != NULL) {
+      return *isolate->factory()->NewJSArrayWithElements(
+          Handle<FixedArray>(cached, isolate));
+    }
+  }
+
   // Find the number of own properties for each of the objects.
   ScopedVector<int> own_property_count(length);
   int total_property_count = 0;
@@ -1006,6 +1021,14 @@ RUNTIME_FUNCTION(Runtime_GetOwnPropertyNames) {
     DCHECK_EQ(0, hidden_strings);
   }
 
+  if (cacheable) {
+    // The empty fixed array is a shared singleton and keeps its regular map.
+    if (names->length() > 0) {
+      names->set_map(isolate->heap()->fixed_cow_array_map());
+    }
+    isolate->own_property_names_cache()->Update(obj->map(), filter_value,
+                                                *names);
+  }
   return *isolate->factory()->NewJSArrayWithElements(names);
 }
 
@@ -1099,6 +1122,18 @@ RUNTIME_FUNCTION(Runtime_OwnKeys) {
     object = Handle<JSObject>::cast(PrototypeIterator::GetCurrent(iter));
   }
 
+  // Fast case: an object whose enumerable own keys are exactly the fast
+  // properties on its map. The enumeration cache holds those keys and is
+  // copy-on-write, so it doubles as the elements of the result; a caller
+  // that mutates the result triggers an ordinary copy-on-write clone.
+  if (object->HasFastProperties() && !object->IsAccessCheckNeeded() &&
+      !object->IsJSValue() && !object->HasNamedInterceptor() &&
+      !object->HasIndexedInterceptor() &&
+      object->NumberOfEnumElements() == 0) {
+    Handle<FixedArray> keys = JSObject::GetEnumPropertyKeys(object, true);
+    return *isolate->factory()->NewJSArrayWithElements(keys);
+  }
+
   Handle<FixedArray> contents;
   ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
       isolate, contents, JSReceiver::GetKeys(object, JSReceiver::OWN_ONLY));
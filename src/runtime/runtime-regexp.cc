@@ -727,24 +727,45 @@ RUNTIME_FUNCTION(Runtime_StringSplit) {
   // Create JSArray of substrings separated by separator.
   int part_count = indices.length();
 
-  Handle<JSArray> result = isolate->factory()->NewJSArray(part_count);
-  JSObject::EnsureCanContainHeapObjectElements(result);
-  result->set_length(Smi::FromInt(part_count));
+  // Results that are going to be cached below are long-lived, so allocate
+  // them straight into old space.
+  PretenureFlag tenure = (limit == 0xffffffffu) ? TENURED : NOT_TENURED;
+
+  Handle<FixedArray> elements =
+      isolate->factory()->NewFixedArray(part_count, tenure);
+  Handle<JSArray> result =
+      isolate->factory()->NewJSArrayWithElements(elements);
 
   DCHECK(result->HasFastObjectElements());
 
   if (part_count == 1 && indices.at(0) == subject_length) {
-    FixedArray::cast(result->elements())->set(0, *subject);
+    elements->set(0, *subject);
     return *result;
   }
 
-  Handle<FixedArray> elements(FixedArray::cast(result->elements()));
+  // Unpack a sliced subject once instead of letting every part creation
+  // redo it; long parts become slices of the same parent below.
+  Handle<String> parent = subject;
+  int parent_offset = 0;
+  if (subject->IsSlicedString()) {
+    Handle<SlicedString> slice = Handle<SlicedString>::cast(subject);
+    parent = Handle<String>(slice->parent(), isolate);
+    parent_offset = slice->offset();
+  }
+
   int part_start = 0;
   for (int i = 0; i < part_count; i++) {
     HandleScope local_loop_handle(isolate);
     int part_end = indices.at(i);
-    Handle<String> substring =
-        isolate->factory()->NewProperSubString(subject, part_start, part_end);
+    int part_length = part_end - part_start;
+    Handle<String> substring;
+    if (FLAG_string_slices && part_length >= SlicedString::kMinLength) {
+      substring = isolate->factory()->NewSlicedString(
+          parent, parent_offset + part_start, part_length, tenure);
+    } else {
+      substring =
+          isolate->factory()->NewProperSubString(subject, part_start, part_end);
+    }
     elements->set(i, *substring);
     part_start = part_end + pattern_length;
   }
@@ -5,6 +5,7 @@
 #include "src/v8.h"
 
 #include "src/arguments.h"
+#include "src/base/bits.h"
 #include "src/jsregexp-inl.h"
 #include "src/jsregexp.h"
 #include "src/runtime/runtime-utils.h"
@@ -313,6 +314,25 @@ RUNTIME_FUNCTION(Runtime_SubString) {
 }
 
 
+// Minimal length at which a growing concatenation chain is eagerly
+// flattened during the build phase.
+const int kEagerFlattenMinLength = 64 * KB;
+
+
+// Returns true if |length| has reached a doubling threshold that neither
+// operand had reached, i.e. the largest power of two not above |length|
+// exceeds both operand lengths. Such a threshold is crossed only once per
+// concatenation chain, so flattening at each crossing keeps the total
+// copying linear in the final length.
+static inline bool CrossedFlattenThreshold(int left_length, int right_length,
+                                           int length) {
+  if (length < kEagerFlattenMinLength) return false;
+  int threshold = static_cast<int>(
+      base::bits::RoundDownToPowerOfTwo32(static_cast<uint32_t>(length)));
+  return left_length < threshold && right_length < threshold;
+}
+
+
 RUNTIME_FUNCTION(Runtime_StringAddRT) {
   HandleScope scope(isolate);
   DCHECK(args.length() == 2);
@@ -322,6 +342,18 @@ RUNTIME_FUNCTION(Runtime_StringAddRT) {
   Handle<String> result;
   ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
       isolate, result, isolate->factory()->NewConsString(str1, str2));
+  // Growing concatenation chains defer all copying to the first flattening
+  // access, which for a very long result means one giant pause walking a
+  // deep cons tree. Flatten eagerly whenever the result crosses a doubling
+  // threshold: the geometric spacing spreads the copying over the build
+  // phase at linear total cost and keeps the tree shallow for the final
+  // flatten. A string this long is likely to survive, so the flat copy is
+  // pretenured.
+  if (result->IsConsString() &&
+      CrossedFlattenThreshold(str1->length(), str2->length(),
+                              result->length())) {
+    result = String::Flatten(result, TENURED);
+  }
   return *result;
 }
 
@@ -572,6 +604,34 @@ RUNTIME_FUNCTION(Runtime_StringBuilderConcat) {
 }
 
 
+template <typename sinkchar>
+static void WriteJoinedArray(FixedArray* fixed_array, int array_length,
+                             String* separator, sinkchar* sink, int length) {
+  DisallowHeapAllocation no_gc;
+#ifdef DEBUG
+  sinkchar* end = sink + length;
+#endif
+  String* first = String::cast(fixed_array->get(0));
+  int first_length = first->length();
+  String::WriteToFlat(first, sink, 0, first_length);
+  sink += first_length;
+
+  int separator_length = separator->length();
+  for (int i = 1; i < array_length; i++) {
+    DCHECK(sink + separator_length <= end);
+    String::WriteToFlat(separator, sink, 0, separator_length);
+    sink += separator_length;
+
+    String* element = String::cast(fixed_array->get(i));
+    int element_length = element->length();
+    DCHECK(sink + element_length <= end);
+    String::WriteToFlat(element, sink, 0, element_length);
+    sink += element_length;
+  }
+  DCHECK(sink == end);
+}
+
+
 RUNTIME_FUNCTION(Runtime_StringBuilderJoin) {
   HandleScope scope(isolate);
   DCHECK(args.length() == 3);
@@ -604,11 +664,13 @@ RUNTIME_FUNCTION(Runtime_StringBuilderJoin) {
   if (max_nof_separators < (array_length - 1)) {
     THROW_NEW_ERROR_RETURN_FAILURE(isolate, NewInvalidStringLengthError());
   }
+  bool one_byte = separator->HasOnlyOneByteChars();
   int length = (array_length - 1) * separator_length;
   for (int i = 0; i < array_length; i++) {
     Object* element_obj = fixed_array->get(i);
     RUNTIME_ASSERT(element_obj->IsString());
     String* element = String::cast(element_obj);
+    if (one_byte && !element->HasOnlyOneByteChars()) one_byte = false;
     int increment = element->length();
     if (increment > String::kMaxLength - length) {
       STATIC_ASSERT(String::kMaxLength < kMaxInt);
@@ -618,40 +680,24 @@ RUNTIME_FUNCTION(Runtime_StringBuilderJoin) {
     length += increment;
   }
 
+  // The inlined %_FastOneByteArrayJoin only handles flat one-byte strings and
+  // falls back here for anything else (e.g. cons string elements).  There is
+  // no reason to widen the result in that case, so build one-byte joins in a
+  // single exactly-sized one-byte allocation as well.
+  if (one_byte) {
+    Handle<SeqOneByteString> answer;
+    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+        isolate, answer, isolate->factory()->NewRawOneByteString(length));
+    WriteJoinedArray(*fixed_array, array_length, *separator,
+                     answer->GetChars(), length);
+    return *answer;
+  }
+
   Handle<SeqTwoByteString> answer;
   ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
       isolate, answer, isolate->factory()->NewRawTwoByteString(length));
-
-  DisallowHeapAllocation no_gc;
-
-  uc16* sink = answer->GetChars();
-#ifdef DEBUG
-  uc16* end = sink + length;
-#endif
-
-  RUNTIME_ASSERT(fixed_array->get(0)->IsString());
-  String* first = String::cast(fixed_array->get(0));
-  String* separator_raw = *separator;
-  int first_length = first->length();
-  String::WriteToFlat(first, sink, 0, first_length);
-  sink += first_length;
-
-  for (int i = 1; i < array_length; i++) {
-    DCHECK(sink + separator_length <= end);
-    String::WriteToFlat(separator_raw, sink, 0, separator_length);
-    sink += separator_length;
-
-    RUNTIME_ASSERT(fixed_array->get(i)->IsString());
-    String* element = String::cast(fixed_array->get(i));
-    int element_length = element->length();
-    DCHECK(sink + element_length <= end);
-    String::WriteToFlat(element, sink, 0, element_length);
-    sink += element_length;
-  }
-  DCHECK(sink == end);
-
-  // Use %_FastOneByteArrayJoin instead.
-  DCHECK(!answer->IsOneByteRepresentation());
+  WriteJoinedArray(*fixed_array, array_length, *separator, answer->GetChars(),
+                   length);
   return *answer;
 }
 
@@ -1038,6 +1084,21 @@ static bool FastAsciiConvert(char* dst, const char* src, int length,
   DCHECK(IsAligned(reinterpret_cast<intptr_t>(dst), sizeof(uintptr_t)));
   // Only attempt processing one word at a time if src is also aligned.
   if (IsAligned(reinterpret_cast<intptr_t>(src), sizeof(uintptr_t))) {
+    // Process the prefix of the input that requires no conversion two aligned
+    // (machine) words at a time, i.e. 16 bytes per iteration on 64-bit
+    // platforms. The single-word loops below pick up where this one breaks.
+    while (src <= limit - 2 * sizeof(uintptr_t)) {
+      const uintptr_t w0 = reinterpret_cast<const uintptr_t*>(src)[0];
+      const uintptr_t w1 = reinterpret_cast<const uintptr_t*>(src)[1];
+      or_acc |= w0 | w1;
+      if ((AsciiRangeMask(w0, lo, hi) | AsciiRangeMask(w1, lo, hi)) != 0) {
+        break;
+      }
+      reinterpret_cast<uintptr_t*>(dst)[0] = w0;
+      reinterpret_cast<uintptr_t*>(dst)[1] = w1;
+      src += 2 * sizeof(uintptr_t);
+      dst += 2 * sizeof(uintptr_t);
+    }
     // Process the prefix of the input that requires no conversion one aligned
     // (machine) word at a time.
     while (src <= limit - sizeof(uintptr_t)) {
@@ -1089,6 +1150,42 @@ static bool FastAsciiConvert(char* dst, const char* src, int length,
 }
 
 
+// Returns true if every character is ASCII and none of them requires
+// conversion, in which case the input string can be returned unchanged
+// without allocating a copy. Checks two aligned (machine) words, i.e.
+// 16 bytes on 64-bit platforms, per iteration.
+template <class Converter>
+static bool FastAsciiCaseCheck(const char* src, int length) {
+  static const char lo = Converter::kIsToLower ? 'A' - 1 : 'a' - 1;
+  static const char hi = Converter::kIsToLower ? 'Z' + 1 : 'z' + 1;
+  const char* const limit = src + length;
+  if (IsAligned(reinterpret_cast<intptr_t>(src), sizeof(uintptr_t))) {
+    while (src <= limit - 2 * sizeof(uintptr_t)) {
+      const uintptr_t w0 = reinterpret_cast<const uintptr_t*>(src)[0];
+      const uintptr_t w1 = reinterpret_cast<const uintptr_t*>(src)[1];
+      // AsciiRangeMask requires ASCII-only input, so test that first.
+      if (((w0 | w1) & kAsciiMask) != 0) return false;
+      if ((AsciiRangeMask(w0, lo, hi) | AsciiRangeMask(w1, lo, hi)) != 0) {
+        return false;
+      }
+      src += 2 * sizeof(uintptr_t);
+    }
+    while (src <= limit - sizeof(uintptr_t)) {
+      const uintptr_t w = *reinterpret_cast<const uintptr_t*>(src);
+      if ((w & kAsciiMask) != 0) return false;
+      if (AsciiRangeMask(w, lo, hi) != 0) return false;
+      src += sizeof(uintptr_t);
+    }
+  }
+  while (src < limit) {
+    char c = *src++;
+    if ((c & 0x80) != 0) return false;
+    if (lo < c && c < hi) return false;
+  }
+  return true;
+}
+
+
 template <class Converter>
 MUST_USE_RESULT static Object* ConvertCase(
     Handle<String> s, Isolate* isolate,
@@ -1105,6 +1202,20 @@ MUST_USE_RESULT static Object* ConvertCase(
   // might break in the future if we implement more context and locale
   // dependent upper/lower conversions.
   if (s->IsOneByteRepresentationUnderneath()) {
+    {
+      DisallowHeapAllocation no_gc;
+      String::FlatContent flat_content = s->GetFlatContent();
+      DCHECK(flat_content.IsFlat());
+      // Strings that are already fully converted ASCII are common, e.g. when
+      // normalizing strings that are usually normalized already. Detect them
+      // up front and return the input without allocating a copy.
+      if (FastAsciiCaseCheck<Converter>(
+              reinterpret_cast<const char*>(
+                  flat_content.ToOneByteVector().start()),
+              length)) {
+        return *s;
+      }
+    }
     // Same length as input.
     Handle<SeqOneByteString> result =
         isolate->factory()->NewRawOneByteString(length).ToHandleChecked();
@@ -33,7 +33,8 @@ void Runtime::SetupArrayBuffer(Isolate* isolate,
   array_buffer->set_byte_length(*byte_length);
 
   if (data && !is_external) {
-    isolate->heap()->RegisterNewArrayBuffer(data, allocated_length);
+    isolate->heap()->RegisterNewArrayBuffer(
+        isolate->heap()->InNewSpace(*array_buffer), data, allocated_length);
   }
 }
 
@@ -143,7 +144,8 @@ RUNTIME_FUNCTION(Runtime_ArrayBufferNeuter) {
   size_t byte_length = NumberToSize(isolate, array_buffer->byte_length());
   array_buffer->set_is_external(true);
   Runtime::NeuterArrayBuffer(array_buffer);
-  isolate->heap()->UnregisterArrayBuffer(backing_store);
+  isolate->heap()->UnregisterArrayBuffer(
+      isolate->heap()->InNewSpace(*array_buffer), backing_store);
   isolate->array_buffer_allocator()->Free(backing_store, byte_length);
   return isolate->heap()->undefined_value();
 }
@@ -375,21 +377,92 @@ RUNTIME_FUNCTION(Runtime_TypedArrayGetBuffer) {
 }
 
 
+// Creates a view over the buffer of an existing typed array without going
+// through the typed array constructor. The begin index and length have
+// been clamped to the source bounds by the caller.
+RUNTIME_FUNCTION(Runtime_TypedArraySubarray) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 3);
+  CONVERT_ARG_HANDLE_CHECKED(JSTypedArray, source, 0);
+  CONVERT_NUMBER_ARG_HANDLE_CHECKED(begin_obj, 1);
+  CONVERT_NUMBER_ARG_HANDLE_CHECKED(length_obj, 2);
+
+  size_t begin = 0;
+  size_t length = 0;
+  RUNTIME_ASSERT(TryNumberToSize(isolate, *begin_obj, &begin));
+  RUNTIME_ASSERT(TryNumberToSize(isolate, *length_obj, &length));
+  size_t source_length = NumberToSize(isolate, source->length());
+  RUNTIME_ASSERT(begin <= source_length);
+  RUNTIME_ASSERT(length <= source_length - begin);
+
+  size_t byte_offset = NumberToSize(isolate, source->byte_offset()) +
+                       begin * source->element_size();
+  // GetBuffer materializes the buffer for on-heap typed arrays, just like
+  // the %TypedArrayGetBuffer call in the generic construction path did.
+  Handle<JSArrayBuffer> buffer = source->GetBuffer();
+  return *isolate->factory()->NewJSTypedArray(source->type(), buffer,
+                                              byte_offset, length);
+}
+
+
 // Return codes for Runtime_TypedArraySetFastCases.
 // Should be synchronized with typedarray.js natives.
 enum TypedArraySetResultCodes {
-  // Set from typed array of the same type.
-  // This is processed by TypedArraySetFastCases
-  TYPED_ARRAY_SET_TYPED_ARRAY_SAME_TYPE = 0,
-  // Set from typed array of the different type, overlapping in memory.
-  TYPED_ARRAY_SET_TYPED_ARRAY_OVERLAPPING = 1,
-  // Set from typed array of the different type, non-overlapping.
-  TYPED_ARRAY_SET_TYPED_ARRAY_NONOVERLAPPING = 2,
+  // Set from typed array. The copy has been performed by the runtime,
+  // including between arrays of different element types.
+  TYPED_ARRAY_SET_TYPED_ARRAY_DONE = 0,
   // Set from non-typed array.
-  TYPED_ARRAY_SET_NON_TYPED_ARRAY = 3
+  TYPED_ARRAY_SET_NON_TYPED_ARRAY = 1
 };
 
 
+// Copies |count| elements from |source_base| into |target|, converting
+// each element with the same rules as the typed array element accessors
+// in objects-inl.h: integer stores wrap modulo 2^n, Uint8Clamped
+// saturates and rounds, and NaN converts to zero for integer targets.
+// Every source element type is exactly representable as a double, so the
+// conversion can uniformly go through from_double().
+template <class Traits>
+static void TypedArrayCopyElements(typename Traits::ElementType* target,
+                                   ExternalArrayType source_type,
+                                   uint8_t* source_base, size_t count) {
+  switch (source_type) {
+#define TYPED_ARRAY_SOURCE_CASE(Type, type, TYPE, ctype, size)   \
+  case kExternal##Type##Array: {                                 \
+    ctype* source = reinterpret_cast<ctype*>(source_base);       \
+    for (size_t i = 0; i < count; i++) {                         \
+      target[i] = FixedTypedArray<Traits>::from_double(          \
+          static_cast<double>(source[i]));                       \
+    }                                                            \
+    break;                                                       \
+  }
+    TYPED_ARRAYS(TYPED_ARRAY_SOURCE_CASE)
+#undef TYPED_ARRAY_SOURCE_CASE
+    default:
+      UNREACHABLE();
+  }
+}
+
+
+static void TypedArrayCopyElements(ExternalArrayType target_type,
+                                   uint8_t* target_base,
+                                   ExternalArrayType source_type,
+                                   uint8_t* source_base, size_t count) {
+  switch (target_type) {
+#define TYPED_ARRAY_TARGET_CASE(Type, type, TYPE, ctype, size)            \
+  case kExternal##Type##Array:                                            \
+    TypedArrayCopyElements<Type##ArrayTraits>(                            \
+        reinterpret_cast<ctype*>(target_base), source_type, source_base,  \
+        count);                                                           \
+    break;
+    TYPED_ARRAYS(TYPED_ARRAY_TARGET_CASE)
+#undef TYPED_ARRAY_TARGET_CASE
+    default:
+      UNREACHABLE();
+  }
+}
+
+
 RUNTIME_FUNCTION(Runtime_TypedArraySetFastCases) {
   HandleScope scope(isolate);
   DCHECK(args.length() == 3);
@@ -432,10 +505,12 @@ RUNTIME_FUNCTION(Runtime_TypedArraySetFastCases) {
   if (target->type() == source->type()) {
     memmove(target_base + offset * target->element_size(), source_base,
             source_byte_length);
-    return Smi::FromInt(TYPED_ARRAY_SET_TYPED_ARRAY_SAME_TYPE);
+    return Smi::FromInt(TYPED_ARRAY_SET_TYPED_ARRAY_DONE);
   }
 
-  // Typed arrays of different types over the same backing store
+  // Typed arrays of different types over the same backing store: copy the
+  // source elements aside first, which matches the specified behavior of
+  // reading the source before any element of the target is written.
   if ((source_base <= target_base &&
        source_base + source_byte_length > target_base) ||
       (target_base <= source_base &&
@@ -443,10 +518,17 @@ RUNTIME_FUNCTION(Runtime_TypedArraySetFastCases) {
     // We do not support overlapping ArrayBuffers
     DCHECK(target->GetBuffer()->backing_store() ==
            source->GetBuffer()->backing_store());
-    return Smi::FromInt(TYPED_ARRAY_SET_TYPED_ARRAY_OVERLAPPING);
+    SmartArrayPointer<uint8_t> copy(NewArray<uint8_t>(source_byte_length));
+    MemCopy(copy.get(), source_base, source_byte_length);
+    TypedArrayCopyElements(target->type(),
+                           target_base + offset * target->element_size(),
+                           source->type(), copy.get(), source_length);
   } else {  // Non-overlapping typed arrays
-    return Smi::FromInt(TYPED_ARRAY_SET_TYPED_ARRAY_NONOVERLAPPING);
+    TypedArrayCopyElements(target->type(),
+                           target_base + offset * target->element_size(),
+                           source->type(), source_base, source_length);
   }
+  return Smi::FromInt(TYPED_ARRAY_SET_TYPED_ARRAY_DONE);
 }
 
 
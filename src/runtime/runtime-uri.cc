@@ -14,6 +14,26 @@
 namespace v8 {
 namespace internal {
 
+static const signed char kHexValue['g'] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -0, 1,  2,  3,  4,  5,
+    6,  7,  8,  9,  -1, -1, -1, -1, -1, -1, -1, 10, 11, 12, 13, 14, 15, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, 10, 11, 12, 13, 14, 15};
+
+
+static INLINE(int TwoDigitHex(uint16_t character1, uint16_t character2)) {
+  if (character1 > 'f') return -1;
+  int hi = kHexValue[character1];
+  if (hi == -1) return -1;
+  if (character2 > 'f') return -1;
+  int lo = kHexValue[character2];
+  if (lo == -1) return -1;
+  return (hi << 4) + lo;
+}
+
+
 class URIUnescape : public AllStatic {
  public:
   template <typename Char>
@@ -21,30 +41,17 @@ class URIUnescape : public AllStatic {
                                                       Handle<String> source);
 
  private:
-  static const signed char kHexValue['g'];
-
   template <typename Char>
   MUST_USE_RESULT static MaybeHandle<String> UnescapeSlow(Isolate* isolate,
                                                           Handle<String> string,
                                                           int start_index);
 
-  static INLINE(int TwoDigitHex(uint16_t character1, uint16_t character2));
-
   template <typename Char>
   static INLINE(int UnescapeChar(Vector<const Char> vector, int i, int length,
                                  int* step));
 };
 
 
-const signed char URIUnescape::kHexValue[] = {
-    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -0, 1,  2,  3,  4,  5,
-    6,  7,  8,  9,  -1, -1, -1, -1, -1, -1, -1, 10, 11, 12, 13, 14, 15, -1,
-    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-    -1, -1, -1, -1, -1, -1, -1, 10, 11, 12, 13, 14, 15};
-
-
 template <typename Char>
 MaybeHandle<String> URIUnescape::Unescape(Isolate* isolate,
                                           Handle<String> source) {
@@ -118,17 +125,6 @@ MaybeHandle<String> URIUnescape::UnescapeSlow(Isolate* isolate,
 }
 
 
-int URIUnescape::TwoDigitHex(uint16_t character1, uint16_t character2) {
-  if (character1 > 'f') return -1;
-  int hi = kHexValue[character1];
-  if (hi == -1) return -1;
-  if (character2 > 'f') return -1;
-  int lo = kHexValue[character2];
-  if (lo == -1) return -1;
-  return (hi << 4) + lo;
-}
-
-
 template <typename Char>
 int URIUnescape::UnescapeChar(Vector<const Char> vector, int i, int length,
                               int* step) {
@@ -256,6 +252,354 @@ MaybeHandle<String> URIEscape::Escape(Isolate* isolate, Handle<String> string) {
 }
 
 
+// Percent-encoding as specified for encodeURI and encodeURIComponent,
+// ECMA-262 sections 15.1.3.3 and 15.1.3.4. Input containing unpaired
+// surrogates must raise a URIError; since error objects are made in
+// JavaScript, Encode returns undefined for such input and the caller
+// retries with the JavaScript implementation in uri.js.
+class URIEncode : public AllStatic {
+ public:
+  template <typename Char>
+  MUST_USE_RESULT static MaybeHandle<Object> Encode(Isolate* isolate,
+                                                    Handle<String> string,
+                                                    bool is_uri);
+
+ private:
+  static const char kHexChars[17];
+  static const char kUnescapedURI[128];
+  static const char kUnescapedComponent[128];
+
+  static INLINE(int AddEscapedOctet(Handle<SeqOneByteString> dest, int index,
+                                    int octet));
+};
+
+
+const char URIEncode::kHexChars[] = "0123456789ABCDEF";
+
+
+// kUnescapedURI is generated by the following:
+//
+// #!/bin/perl
+// for (my $i = 0; $i < 128; $i++) {
+//   print "\n" if $i % 24 == 0;
+//   my $c = chr($i);
+//   my $unescaped = 0;
+//   $unescaped = 1 if $c =~ m#[A-Za-z0-9!\#$&'()*+,./:;=?@_~-]#;
+//   print $unescaped ? "1, " : "0, ";
+// }
+
+const char URIEncode::kUnescapedURI[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 1, 0};
+
+
+// kUnescapedComponent is generated as kUnescapedURI above, with the
+// character class replaced by [A-Za-z0-9!'()*._~-].
+
+const char URIEncode::kUnescapedComponent[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 1, 0};
+
+
+int URIEncode::AddEscapedOctet(Handle<SeqOneByteString> dest, int index,
+                               int octet) {
+  dest->SeqOneByteStringSet(index, '%');
+  dest->SeqOneByteStringSet(index + 1, kHexChars[octet >> 4]);
+  dest->SeqOneByteStringSet(index + 2, kHexChars[octet & 0xf]);
+  return index + 3;
+}
+
+
+template <typename Char>
+MaybeHandle<Object> URIEncode::Encode(Isolate* isolate, Handle<String> string,
+                                      bool is_uri) {
+  DCHECK(string->IsFlat());
+  const char* unescaped = is_uri ? kUnescapedURI : kUnescapedComponent;
+  int length = string->length();
+
+  int encoded_length = 0;
+  {
+    DisallowHeapAllocation no_allocation;
+    Vector<const Char> vector = string->GetCharVector<Char>();
+    for (int i = 0; i < length; i++) {
+      uint16_t c = vector[i];
+      if (c < 0x80 && unescaped[c]) {
+        encoded_length++;
+      } else if (c < 0x80) {
+        encoded_length += 3;
+      } else if (c < 0x800) {
+        encoded_length += 6;
+      } else if (c < 0xD800 || c > 0xDFFF) {
+        encoded_length += 9;
+      } else if (c <= 0xDBFF && i < length - 1 && vector[i + 1] >= 0xDC00 &&
+                 vector[i + 1] <= 0xDFFF) {
+        encoded_length += 12;
+        i++;
+      } else {
+        // Lone surrogate; the caller raises the URIError.
+        return isolate->factory()->undefined_value();
+      }
+
+      // We don't allow strings that are longer than a maximal length.
+      DCHECK(String::kMaxLength < 0x7fffffff - 12);    // Cannot overflow.
+      if (encoded_length > String::kMaxLength) break;  // Provoke exception.
+    }
+  }
+
+  // No length change implies no change.  Return original string if no change.
+  if (encoded_length == length) return string;
+
+  Handle<SeqOneByteString> dest;
+  ASSIGN_RETURN_ON_EXCEPTION(
+      isolate, dest, isolate->factory()->NewRawOneByteString(encoded_length),
+      Object);
+  int dest_position = 0;
+
+  {
+    DisallowHeapAllocation no_allocation;
+    Vector<const Char> vector = string->GetCharVector<Char>();
+    for (int i = 0; i < length; i++) {
+      uint16_t c = vector[i];
+      if (c < 0x80 && unescaped[c]) {
+        dest->SeqOneByteStringSet(dest_position, c);
+        dest_position++;
+      } else if (c < 0x80) {
+        dest_position = AddEscapedOctet(dest, dest_position, c);
+      } else if (c < 0x800) {
+        dest_position = AddEscapedOctet(dest, dest_position, 0xC0 | (c >> 6));
+        dest_position =
+            AddEscapedOctet(dest, dest_position, 0x80 | (c & 0x3F));
+      } else if (c < 0xD800 || c > 0xDFFF) {
+        dest_position = AddEscapedOctet(dest, dest_position, 0xE0 | (c >> 12));
+        dest_position =
+            AddEscapedOctet(dest, dest_position, 0x80 | ((c >> 6) & 0x3F));
+        dest_position =
+            AddEscapedOctet(dest, dest_position, 0x80 | (c & 0x3F));
+      } else {
+        i++;
+        uint32_t value = 0x10000 + (((c - 0xD800) << 10) |
+                                    (vector[i] - 0xDC00));
+        dest_position =
+            AddEscapedOctet(dest, dest_position, 0xF0 | (value >> 18));
+        dest_position =
+            AddEscapedOctet(dest, dest_position, 0x80 | ((value >> 12) & 0x3F));
+        dest_position =
+            AddEscapedOctet(dest, dest_position, 0x80 | ((value >> 6) & 0x3F));
+        dest_position =
+            AddEscapedOctet(dest, dest_position, 0x80 | (value & 0x3F));
+      }
+    }
+  }
+
+  return dest;
+}
+
+
+// Percent-decoding as specified for decodeURI and decodeURIComponent,
+// ECMA-262 sections 15.1.3.1 and 15.1.3.2. As with URIEncode above,
+// malformed escape sequences must raise a URIError, so Decode returns
+// undefined for such input and the caller retries in JavaScript.
+class URIDecode : public AllStatic {
+ public:
+  template <typename Char>
+  MUST_USE_RESULT static MaybeHandle<Object> Decode(Isolate* isolate,
+                                                    Handle<String> source,
+                                                    bool is_uri);
+
+ private:
+  template <typename Char>
+  MUST_USE_RESULT static MaybeHandle<Object> DecodeSlow(Isolate* isolate,
+                                                        Handle<String> string,
+                                                        bool is_uri,
+                                                        int start_index);
+
+  // Escaped characters that decodeURI leaves escaped.
+  static bool IsReserved(int32_t c) {
+    return c == '#' || c == '$' || c == '&' || c == '+' || c == ',' ||
+           c == '/' || c == ':' || c == ';' || c == '=' || c == '?' ||
+           c == '@';
+  }
+
+  // Decodes the UTF-8 escape sequence starting at position i, which must
+  // hold a '%'. Returns the code point and sets *step to the number of
+  // source characters consumed, or returns -1 if the sequence is malformed.
+  template <typename Char>
+  static int DecodeEscapeSequence(Vector<const Char> vector, int i, int length,
+                                  int* step);
+};
+
+
+template <typename Char>
+int URIDecode::DecodeEscapeSequence(Vector<const Char> vector, int i,
+                                    int length, int* step) {
+  DCHECK(vector[i] == '%');
+  if (i > length - 3) return -1;
+  int first = TwoDigitHex(vector[i + 1], vector[i + 2]);
+  if (first < 0) return -1;
+  if (first < 0x80) {
+    *step = 3;
+    return first;
+  }
+
+  // Count the leading one bits to get the sequence length.
+  int n = 0;
+  while (((first << ++n) & 0x80) != 0) {
+  }
+  if (n == 1 || n > 4) return -1;
+  if (i > length - 3 * n) return -1;
+
+  int32_t value = first & (0x7F >> n);
+  for (int j = 1; j < n; j++) {
+    int position = i + 3 * j;
+    if (vector[position] != '%') return -1;
+    int octet = TwoDigitHex(vector[position + 1], vector[position + 2]);
+    if (octet < 0x80 || octet > 0xBF) return -1;
+    value = (value << 6) | (octet & 0x3F);
+  }
+
+  // Reject overlong sequences, surrogates and out-of-range values.
+  static const int32_t kMinValue[] = {0, 0, 0x80, 0x800, 0x10000};
+  static const int32_t kMaxValue[] = {0, 0, 0x7FF, 0xFFFF, 0x10FFFF};
+  if (value < kMinValue[n] || value > kMaxValue[n]) return -1;
+  if (value >= 0xD800 && value <= 0xDFFF) return -1;
+  *step = 3 * n;
+  return value;
+}
+
+
+template <typename Char>
+MaybeHandle<Object> URIDecode::Decode(Isolate* isolate, Handle<String> source,
+                                      bool is_uri) {
+  int index;
+  {
+    DisallowHeapAllocation no_allocation;
+    StringSearch<uint8_t, Char> search(isolate, STATIC_CHAR_VECTOR("%"));
+    index = search.Search(source->GetCharVector<Char>(), 0);
+    if (index < 0) return source;
+  }
+  return DecodeSlow<Char>(isolate, source, is_uri, index);
+}
+
+
+template <typename Char>
+MaybeHandle<Object> URIDecode::DecodeSlow(Isolate* isolate,
+                                          Handle<String> string, bool is_uri,
+                                          int start_index) {
+  bool one_byte = true;
+  int length = string->length();
+
+  int decoded_length = 0;
+  {
+    DisallowHeapAllocation no_allocation;
+    Vector<const Char> vector = string->GetCharVector<Char>();
+    for (int i = start_index; i < length;) {
+      uint16_t c = vector[i];
+      if (c == '%') {
+        int step;
+        int value = DecodeEscapeSequence(vector, i, length, &step);
+        if (value < 0) {
+          // Malformed escape sequence; the caller raises the URIError.
+          return isolate->factory()->undefined_value();
+        }
+        if (is_uri && value < 0x80 && IsReserved(value)) {
+          decoded_length += 3;
+        } else {
+          decoded_length += (value < 0x10000) ? 1 : 2;
+          if (value > String::kMaxOneByteCharCode) one_byte = false;
+        }
+        i += step;
+      } else {
+        if (c > String::kMaxOneByteCharCode) one_byte = false;
+        decoded_length++;
+        i++;
+      }
+    }
+  }
+
+  DCHECK(start_index < length);
+  Handle<String> first_part =
+      isolate->factory()->NewProperSubString(string, 0, start_index);
+
+  int dest_position = 0;
+  Handle<String> second_part;
+  DCHECK(decoded_length <= String::kMaxLength);
+  if (one_byte) {
+    Handle<SeqOneByteString> dest = isolate->factory()
+                                        ->NewRawOneByteString(decoded_length)
+                                        .ToHandleChecked();
+    DisallowHeapAllocation no_allocation;
+    Vector<const Char> vector = string->GetCharVector<Char>();
+    for (int i = start_index; i < length;) {
+      uint16_t c = vector[i];
+      if (c == '%') {
+        int step;
+        int value = DecodeEscapeSequence(vector, i, length, &step);
+        DCHECK(value >= 0);
+        if (is_uri && value < 0x80 && IsReserved(value)) {
+          dest->SeqOneByteStringSet(dest_position, '%');
+          dest->SeqOneByteStringSet(dest_position + 1, vector[i + 1]);
+          dest->SeqOneByteStringSet(dest_position + 2, vector[i + 2]);
+          dest_position += 3;
+        } else {
+          DCHECK(value <= String::kMaxOneByteCharCode);
+          dest->SeqOneByteStringSet(dest_position, value);
+          dest_position++;
+        }
+        i += step;
+      } else {
+        dest->SeqOneByteStringSet(dest_position, c);
+        dest_position++;
+        i++;
+      }
+    }
+    second_part = dest;
+  } else {
+    Handle<SeqTwoByteString> dest = isolate->factory()
+                                        ->NewRawTwoByteString(decoded_length)
+                                        .ToHandleChecked();
+    DisallowHeapAllocation no_allocation;
+    Vector<const Char> vector = string->GetCharVector<Char>();
+    for (int i = start_index; i < length;) {
+      uint16_t c = vector[i];
+      if (c == '%') {
+        int step;
+        int value = DecodeEscapeSequence(vector, i, length, &step);
+        DCHECK(value >= 0);
+        if (is_uri && value < 0x80 && IsReserved(value)) {
+          dest->SeqTwoByteStringSet(dest_position, '%');
+          dest->SeqTwoByteStringSet(dest_position + 1, vector[i + 1]);
+          dest->SeqTwoByteStringSet(dest_position + 2, vector[i + 2]);
+          dest_position += 3;
+        } else if (value < 0x10000) {
+          dest->SeqTwoByteStringSet(dest_position, value);
+          dest_position++;
+        } else {
+          dest->SeqTwoByteStringSet(dest_position, (value >> 10) + 0xD7C0);
+          dest->SeqTwoByteStringSet(dest_position + 1,
+                                    (value & 0x3FF) + 0xDC00);
+          dest_position += 2;
+        }
+        i += step;
+      } else {
+        dest->SeqTwoByteStringSet(dest_position, c);
+        dest_position++;
+        i++;
+      }
+    }
+    second_part = dest;
+  }
+  return isolate->factory()->NewConsString(first_part, second_part);
+}
+
+
 RUNTIME_FUNCTION(Runtime_URIEscape) {
   HandleScope scope(isolate);
   DCHECK(args.length() == 1);
@@ -284,5 +628,39 @@ RUNTIME_FUNCTION(Runtime_URIUnescape) {
                            : URIUnescape::Unescape<uc16>(isolate, source));
   return *result;
 }
+
+
+RUNTIME_FUNCTION(Runtime_URIEncode) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 2);
+  CONVERT_ARG_HANDLE_CHECKED(String, source, 0);
+  CONVERT_BOOLEAN_ARG_CHECKED(is_uri, 1);
+  Handle<String> string = String::Flatten(source);
+  DCHECK(string->IsFlat());
+  Handle<Object> result;
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+      isolate, result,
+      string->IsOneByteRepresentationUnderneath()
+          ? URIEncode::Encode<uint8_t>(isolate, string, is_uri)
+          : URIEncode::Encode<uc16>(isolate, string, is_uri));
+  return *result;
+}
+
+
+RUNTIME_FUNCTION(Runtime_URIDecode) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 2);
+  CONVERT_ARG_HANDLE_CHECKED(String, source, 0);
+  CONVERT_BOOLEAN_ARG_CHECKED(is_uri, 1);
+  Handle<String> string = String::Flatten(source);
+  DCHECK(string->IsFlat());
+  Handle<Object> result;
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+      isolate, result,
+      string->IsOneByteRepresentationUnderneath()
+          ? URIDecode::Decode<uint8_t>(isolate, string, is_uri)
+          : URIDecode::Decode<uc16>(isolate, string, is_uri));
+  return *result;
+}
 }
 }  // namespace v8::internal
@@ -36,6 +36,11 @@ namespace internal {
   F(PushIfAbsent, 2, 1)                                               \
   F(ArrayConcat, 1, 1)                                                \
   F(RemoveArrayHoles, 2, 1)                                           \
+  F(SortDefaultNumberElements, 1, 1)                                  \
+  F(FastArrayFill, 4, 1)                                              \
+  F(FastArrayReverse, 1, 1)                                           \
+  F(FastArrayIndexOf, 3, 1)                                           \
+  F(PreallocateArrayElements, 2, 1)                                   \
   F(MoveArrayContents, 2, 1)                                          \
   F(EstimateNumberOfElements, 1, 1)                                   \
   F(GetArrayKeys, 2, 1)                                               \
@@ -65,6 +70,7 @@ namespace internal {
   F(HomeObjectSymbol, 0, 1)                   \
   F(DefineClass, 6, 1)                        \
   F(DefineClassMethod, 3, 1)                  \
+  F(DefineClassMethods, -1, 1)                \
   F(ClassGetSourceCode, 1, 1)                 \
   F(LoadFromSuper, 3, 1)                      \
   F(LoadKeyedFromSuper, 3, 1)                 \
@@ -83,6 +89,7 @@ namespace internal {
   F(JSCollectionGetTable, 1, 1)           \
   F(GenericHash, 1, 1)                    \
   F(SetInitialize, 1, 1)                  \
+  F(SetReserveCapacity, 2, 1)             \
   F(SetGrow, 1, 1)                        \
   F(SetShrink, 1, 1)                      \
   F(SetClear, 1, 1)                       \
@@ -91,6 +98,7 @@ namespace internal {
   F(SetIteratorNext, 2, 1)                \
   F(SetIteratorDetails, 1, 1)             \
   F(MapInitialize, 1, 1)                  \
+  F(MapReserveCapacity, 2, 1)             \
   F(MapShrink, 1, 1)                      \
   F(MapClear, 1, 1)                       \
   F(MapGrow, 1, 1)                        \
@@ -124,6 +132,7 @@ namespace internal {
   F(ThrowNotDateError, 0, 1)       \
   F(DateCurrentTime, 0, 1)         \
   F(DateParseString, 2, 1)         \
+  F(DateToISOString, 1, 1)         \
   F(DateLocalTimezone, 1, 1)       \
   F(DateToUTC, 1, 1)               \
   F(DateCacheVersion, 0, 1)        \
@@ -462,6 +471,7 @@ namespace internal {
   F(IsObserved, 1, 1)                            \
   F(SetIsObserved, 1, 1)                         \
   F(EnqueueMicrotask, 1, 1)                      \
+  F(EnqueuePromiseReactionJob, 2, 1)             \
   F(RunMicrotasks, 0, 1)                         \
   F(DeliverObservationChangeRecords, 2, 1)       \
   F(GetObservationState, 0, 1)                   \
@@ -644,6 +654,7 @@ namespace internal {
   F(TypedArrayGetLength, 1, 1)               \
   F(DataViewGetBuffer, 1, 1)                 \
   F(TypedArrayGetBuffer, 1, 1)               \
+  F(TypedArraySubarray, 3, 1)                \
   F(TypedArraySetFastCases, 3, 1)            \
   F(TypedArrayMaxSizeInHeap, 0, 1)           \
   F(IsTypedArray, 1, 1)                      \
@@ -667,6 +678,8 @@ namespace internal {
 
 
 #define FOR_EACH_INTRINSIC_URI(F) \
+  F(URIDecode, 2, 1)              \
+  F(URIEncode, 2, 1)              \
   F(URIEscape, 1, 1)              \
   F(URIUnescape, 1, 1)
 
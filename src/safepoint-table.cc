@@ -38,7 +38,8 @@ bool SafepointEntry::HasRegisterAt(int reg_index) const {
 SafepointTable::SafepointTable(Code* code) {
   DCHECK(code->is_crankshafted());
   code_ = code;
-  Address header = code->instruction_start() + code->safepoint_table_offset();
+  ByteArray* table = ByteArray::cast(code->safepoint_table());
+  Address header = table->GetDataStartAddress();
   length_ = Memory::uint32_at(header + kLengthOffset);
   entry_size_ = Memory::uint32_at(header + kEntrySizeOffset);
   pc_and_deoptimization_indexes_ = header + kHeaderSize;
@@ -47,14 +48,31 @@ SafepointTable::SafepointTable(Code* code) {
   DCHECK(entry_size_ > 0);
   STATIC_ASSERT(SafepointEntry::DeoptimizationIndexField::kMax ==
                 Safepoint::kNoDeoptimizationIndex);
+#ifdef DEBUG
+  // FindEntry bisects the table, which requires the entries to be sorted by
+  // pc offset; they are recorded in emission order, which is ascending.
+  for (unsigned i = 1; i < length_; i++) {
+    DCHECK(GetPcOffset(i - 1) <= GetPcOffset(i));
+  }
+#endif
 }
 
 
 SafepointEntry SafepointTable::FindEntry(Address pc) const {
   unsigned pc_offset = static_cast<unsigned>(pc - code_->instruction_start());
-  for (unsigned i = 0; i < length(); i++) {
-    // TODO(kasperl): Replace the linear search with binary search.
-    if (GetPcOffset(i) == pc_offset) return GetEntry(i);
+  // The entries are emitted in code order, so the table can be searched by
+  // bisection.
+  unsigned low = 0;
+  unsigned high = length();
+  while (low < high) {
+    unsigned mid = low + ((high - low) >> 1);
+    unsigned mid_pc_offset = GetPcOffset(mid);
+    if (mid_pc_offset == pc_offset) return GetEntry(mid);
+    if (mid_pc_offset < pc_offset) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
   }
   return SafepointEntry();
 }
@@ -130,17 +148,14 @@ void SafepointTableBuilder::RecordLazyDeoptimizationIndex(int index) {
   }
 }
 
-unsigned SafepointTableBuilder::GetCodeOffset() const {
+Handle<ByteArray> SafepointTableBuilder::GetSafepointTable() const {
   DCHECK(emitted_);
-  return offset_;
+  return table_;
 }
 
 
-void SafepointTableBuilder::Emit(Assembler* assembler, int bits_per_entry) {
-  // Make sure the safepoint table is properly aligned. Pad with nops.
-  assembler->Align(kIntSize);
-  assembler->RecordComment(";;; Safepoint table.");
-  offset_ = assembler->pc_offset();
+void SafepointTableBuilder::Emit(Isolate* isolate, int bits_per_entry) {
+  DCHECK(!emitted_);
 
   // Take the register bits into account.
   bits_per_entry += kNumSafepointRegisters;
@@ -149,19 +164,31 @@ void SafepointTableBuilder::Emit(Assembler* assembler, int bits_per_entry) {
   int bytes_per_entry =
       RoundUp(bits_per_entry, kBitsPerByte) >> kBitsPerByteLog2;
 
-  // Emit the table header.
+  // Allocate the table outside code space; the code object only refers
+  // to it.
   int length = deoptimization_info_.length();
-  assembler->dd(length);
-  assembler->dd(bytes_per_entry);
+  int size = SafepointTable::kHeaderSize +
+             (length * (SafepointTable::kPcAndDeoptimizationIndexSize +
+                        bytes_per_entry));
+  table_ = isolate->factory()->NewByteArray(size, TENURED);
+
+  DisallowHeapAllocation no_gc;
+  Address data = table_->GetDataStartAddress();
+
+  // Write the table header.
+  Memory::uint32_at(data + SafepointTable::kLengthOffset) = length;
+  Memory::uint32_at(data + SafepointTable::kEntrySizeOffset) = bytes_per_entry;
+  Address cursor = data + SafepointTable::kHeaderSize;
 
-  // Emit sorted table of pc offsets together with deoptimization indexes.
+  // Write sorted table of pc offsets together with deoptimization indexes.
   for (int i = 0; i < length; i++) {
-    assembler->dd(deoptimization_info_[i].pc);
-    assembler->dd(EncodeExceptPC(deoptimization_info_[i],
-                                 deopt_index_list_[i]));
+    Memory::uint32_at(cursor) = deoptimization_info_[i].pc;
+    Memory::uint32_at(cursor + SafepointTable::kPcSize) =
+        EncodeExceptPC(deoptimization_info_[i], deopt_index_list_[i]);
+    cursor += SafepointTable::kPcAndDeoptimizationIndexSize;
   }
 
-  // Emit table of bitmaps.
+  // Write table of bitmaps.
   ZoneList<uint8_t> bits(bytes_per_entry, zone_);
   for (int i = 0; i < length; i++) {
     ZoneList<int>* indexes = indexes_[i];
@@ -194,11 +221,13 @@ void SafepointTableBuilder::Emit(Assembler* assembler, int bits_per_entry) {
       bits[byte_index] |= (1U << bit_index);
     }
 
-    // Emit the bitmap for the current entry.
+    // Write the bitmap for the current entry.
     for (int k = 0; k < bytes_per_entry; k++) {
-      assembler->db(bits[k]);
+      Memory::uint8_at(cursor + k) = bits[k];
     }
+    cursor += bytes_per_entry;
   }
+  DCHECK(cursor == data + size);
   emitted_ = true;
 }
 
@@ -186,8 +186,9 @@ class SafepointTableBuilder BASE_EMBEDDED {
         last_lazy_safepoint_(0),
         zone_(zone) { }
 
-  // Get the offset of the emitted safepoint table in the code.
-  unsigned GetCodeOffset() const;
+  // Get the safepoint table built by Emit, to be attached to the code
+  // object with Code::set_safepoint_table.
+  Handle<ByteArray> GetSafepointTable() const;
 
   // Define a new safepoint for the current position in the body.
   Safepoint DefineSafepoint(Assembler* assembler,
@@ -202,9 +203,9 @@ class SafepointTableBuilder BASE_EMBEDDED {
     last_lazy_safepoint_ = deopt_index_list_.length();
   }
 
-  // Emit the safepoint table after the body. The number of bits per
-  // entry must be enough to hold all the pointer indexes.
-  void Emit(Assembler* assembler, int bits_per_entry);
+  // Build the safepoint table into a tenured byte array. The number of
+  // bits per entry must be enough to hold all the pointer indexes.
+  void Emit(Isolate* isolate, int bits_per_entry);
 
 
  private:
@@ -221,7 +222,7 @@ class SafepointTableBuilder BASE_EMBEDDED {
   ZoneList<ZoneList<int>*> indexes_;
   ZoneList<ZoneList<int>*> registers_;
 
-  unsigned offset_;
+  Handle<ByteArray> table_;
   bool emitted_;
   int last_lazy_safepoint_;
 
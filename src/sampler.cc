@@ -609,14 +609,23 @@ DISABLE_ASAN void TickSample::Init(Isolate* isolate,
     has_external_callback = false;
   }
 
+  // Walk the stack in a single pass. Setting up a SafeStackFrameIterator is
+  // the expensive part of taking a sample, so don't construct a second one
+  // by delegating to GetStackSample here.
   SafeStackFrameIterator it(isolate, reinterpret_cast<Address>(regs.fp),
                             reinterpret_cast<Address>(regs.sp), js_entry_sp);
   top_frame_type = it.top_frame_type();
 
-  SampleInfo info;
-  GetStackSample(isolate, regs, record_c_entry_frame,
-                 reinterpret_cast<void**>(&stack[0]), kMaxFramesCount, &info);
-  frames_count = static_cast<unsigned>(info.frames_count);
+  unsigned i = 0;
+  if (record_c_entry_frame == kIncludeCEntryFrame && !it.done() &&
+      top_frame_type == StackFrame::EXIT) {
+    stack[i++] = isolate->c_function();
+  }
+  while (!it.done() && i < kMaxFramesCount) {
+    stack[i++] = it.frame()->pc();
+    it.Advance();
+  }
+  frames_count = i;
 }
 
 
@@ -15,6 +15,29 @@ namespace internal {
 
 namespace {
 
+const uintptr_t kUtf8OneInEveryByte = kUintptrAllBitsSet / 0xFF;
+const uintptr_t kUtf8NonAsciiMask = kUtf8OneInEveryByte << 7;
+
+// Returns the length of the longest prefix of [bytes, bytes + length) that
+// consists of one-byte (ASCII) UTF-8 characters, classifying a word at a
+// time once the cursor is aligned. Sources are mostly ASCII, so nearly all
+// of the input is covered by the word loop.
+size_t Utf8AsciiPrefixLength(const uint8_t* bytes, size_t length) {
+  size_t i = 0;
+  while (i < length &&
+         !IsAligned(reinterpret_cast<intptr_t>(bytes + i), kIntptrSize)) {
+    if (bytes[i] > unibrow::Utf8::kMaxOneByteChar) return i;
+    i++;
+  }
+  while (i + sizeof(uintptr_t) <= length) {
+    uintptr_t w = *reinterpret_cast<const uintptr_t*>(bytes + i);
+    if ((w & kUtf8NonAsciiMask) != 0) break;
+    i += sizeof(uintptr_t);
+  }
+  while (i < length && bytes[i] <= unibrow::Utf8::kMaxOneByteChar) i++;
+  return i;
+}
+
 size_t CopyCharsHelper(uint16_t* dest, size_t length, const uint8_t* src,
                        size_t* src_pos, size_t src_length,
                        ScriptCompiler::StreamedSource::Encoding encoding) {
@@ -201,7 +224,14 @@ size_t Utf8ToUtf16CharacterStream::CopyChars(uint16_t* dest, size_t length,
     if (*src_pos == src_length) break;
     unibrow::uchar c = src[*src_pos];
     if (c <= unibrow::Utf8::kMaxOneByteChar) {
-      *src_pos = *src_pos + 1;
+      // Widen the longest one-byte run that still fits into the buffer in
+      // one go instead of transferring it byte by byte.
+      size_t run = Utf8AsciiPrefixLength(
+          src + *src_pos, Min(src_length - *src_pos, length - 1 - i));
+      CopyCharsUnsigned(dest + i, src + *src_pos, run);
+      i += run;
+      *src_pos = *src_pos + run;
+      continue;
     } else {
       c = unibrow::Utf8::CalculateValue(src + *src_pos, src_length - *src_pos,
                                         src_pos);
@@ -43,7 +43,12 @@ Scanner::Scanner(UnicodeCache* unicode_cache)
       octal_pos_(Location::invalid()),
       harmony_modules_(false),
       harmony_classes_(false),
-      harmony_unicode_(false) {
+      harmony_unicode_(false),
+      token_log_(NULL),
+      replay_log_(NULL),
+      replay_index_(0),
+      replay_prev_end_(0),
+      replay_active_(false) {
   bookmark_current_.literal_chars = &bookmark_current_literal_;
   bookmark_current_.raw_literal_chars = &bookmark_current_raw_literal_;
   bookmark_next_.literal_chars = &bookmark_next_literal_;
@@ -53,6 +58,9 @@ Scanner::Scanner(UnicodeCache* unicode_cache)
 
 void Scanner::Initialize(Utf16CharacterStream* source) {
   source_ = source;
+  token_log_ = NULL;
+  replay_log_ = NULL;
+  replay_active_ = false;
   // Need to capture identifiers in order to recognize "get" and "set"
   // in object literals.
   Init();
@@ -99,6 +107,33 @@ uc32 Scanner::ScanUnlimitedLengthHexNumber(int max_value) {
 }
 
 
+const int kMaxAscii = 127;
+
+
+// One-byte fast versions of the unicode predicates used by the hot scanning
+// loops. Each resolves every character that the full predicate accepts below
+// 0x80 directly and consults the unicode cache only for non-ASCII input.
+bool Scanner::IsLineTerminator(uc32 c) {
+  if (c <= kMaxAscii) return c == '\n' || c == '\r';
+  return unicode_cache_->IsLineTerminator(c);
+}
+
+
+bool Scanner::IsIdentifierStart(uc32 c) {
+  if (c <= kMaxAscii) {
+    return IsInRange(AsciiAlphaToLower(c), 'a', 'z') || c == '_' ||
+           c == '$' || c == '\\';
+  }
+  return unicode_cache_->IsIdentifierStart(c);
+}
+
+
+bool Scanner::IsIdentifierPart(uc32 c) {
+  if (c <= kMaxAscii) return IsAsciiIdentifier(c) || c == '\\';
+  return unicode_cache_->IsIdentifierPart(c);
+}
+
+
 // Ensure that tokens can be stored in a byte.
 STATIC_ASSERT(Token::NUM_TOKENS <= 0x100);
 
@@ -243,6 +278,10 @@ Token::Value Scanner::Next() {
   current_ = next_;
   has_line_terminator_before_next_ = false;
   has_multiline_comment_before_next_ = false;
+  if (V8_UNLIKELY(replay_log_ != NULL) && ReplayNextToken()) {
+    if (V8_UNLIKELY(token_log_ != NULL)) LogNextToken();
+    return current_.token;
+  }
   if (static_cast<unsigned>(c0_) <= 0x7f) {
     Token::Value token = static_cast<Token::Value>(one_char_tokens[c0_]);
     if (token != Token::ILLEGAL) {
@@ -251,10 +290,12 @@ Token::Value Scanner::Next() {
       next_.location.beg_pos = pos;
       next_.location.end_pos = pos + 1;
       Advance();
+      if (V8_UNLIKELY(token_log_ != NULL)) LogNextToken();
       return current_.token;
     }
   }
   Scan();
+  if (V8_UNLIKELY(token_log_ != NULL)) LogNextToken();
   return current_.token;
 }
 
@@ -280,8 +321,16 @@ bool Scanner::SkipWhiteSpace() {
       // The unicode cache accepts unsigned inputs.
       if (c0_ < 0) break;
       // Advance as long as character is a WhiteSpace or LineTerminator.
-      // Remember if the latter is the case.
-      if (unicode_cache_->IsLineTerminator(c0_)) {
+      // Remember if the latter is the case. The one-byte checks cover all
+      // accepted characters below 0x80, so other ASCII input can stop
+      // without consulting the unicode cache.
+      if (c0_ == '\n' || c0_ == '\r') {
+        has_line_terminator_before_next_ = true;
+      } else if (c0_ == ' ' || c0_ == '\t' || c0_ == '\v' || c0_ == '\f') {
+        // One-byte whitespace; just advance.
+      } else if (c0_ <= kMaxAscii) {
+        break;
+      } else if (unicode_cache_->IsLineTerminator(c0_)) {
         has_line_terminator_before_next_ = true;
       } else if (!unicode_cache_->IsWhiteSpace(c0_) &&
                  !IsLittleEndianByteOrderMark(c0_)) {
@@ -322,7 +371,7 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  while (c0_ >= 0 && !unicode_cache_->IsLineTerminator(c0_)) {
+  while (c0_ >= 0 && !IsLineTerminator(c0_)) {
     Advance();
   }
 
@@ -332,7 +381,7 @@ Token::Value Scanner::SkipSingleLineComment() {
 
 Token::Value Scanner::SkipSourceURLComment() {
   TryToParseSourceURLComment();
-  while (c0_ >= 0 && !unicode_cache_->IsLineTerminator(c0_)) {
+  while (c0_ >= 0 && !IsLineTerminator(c0_)) {
     Advance();
   }
 
@@ -368,7 +417,7 @@ void Scanner::TryToParseSourceURLComment() {
   while (c0_ >= 0 && unicode_cache_->IsWhiteSpace(c0_)) {
     Advance();
   }
-  while (c0_ >= 0 && !unicode_cache_->IsLineTerminator(c0_)) {
+  while (c0_ >= 0 && !IsLineTerminator(c0_)) {
     // Disallowed characters.
     if (c0_ == '"' || c0_ == '\'') {
       value->Reset();
@@ -381,7 +430,7 @@ void Scanner::TryToParseSourceURLComment() {
     Advance();
   }
   // Allow whitespace at the end.
-  while (c0_ >= 0 && !unicode_cache_->IsLineTerminator(c0_)) {
+  while (c0_ >= 0 && !IsLineTerminator(c0_)) {
     if (!unicode_cache_->IsWhiteSpace(c0_)) {
       value->Reset();
       break;
@@ -674,7 +723,7 @@ void Scanner::Scan() {
       default:
         if (c0_ < 0) {
           token = Token::EOS;
-        } else if (unicode_cache_->IsIdentifierStart(c0_)) {
+        } else if (IsIdentifierStart(c0_)) {
           token = ScanIdentifierOrKeyword();
         } else if (IsDecimalDigit(c0_)) {
           token = ScanNumber(false);
@@ -716,6 +765,123 @@ void Scanner::SeekForward(int pos) {
 }
 
 
+void Scanner::StartLoggingTokens(PreparseTokenLog* log) {
+  DCHECK(token_log_ == NULL);
+  token_log_ = log;
+  // The look-ahead token has already been scanned; enter it as the first
+  // record so the log covers the whole function body.
+  LogNextToken();
+}
+
+
+void Scanner::SetTokenLogToReplay(const PreparseTokenLog* log) {
+  replay_log_ = log;
+  replay_active_ = false;
+  if (log != NULL) {
+    replay_index_ = 0;
+    replay_prev_end_ = log->body_start_pos();
+  }
+}
+
+
+void Scanner::LogNextToken() {
+  PreparseTokenLog::TokenEntry entry;
+  entry.beg_pos = next_.location.beg_pos;
+  entry.end_pos = next_.location.end_pos;
+  entry.kind = next_.token;
+  entry.newline_before =
+      has_line_terminator_before_next_ || has_multiline_comment_before_next_;
+  // A replayed entry must reproduce the scanner state the token left behind.
+  // That works for plain punctuators and for literals whose characters can
+  // be copied straight from the source; everything else - numbers (which
+  // carry smi_value_ and octal positions), literals with escapes, template
+  // strings, the end of input - is marked for re-scanning.
+  switch (next_.token) {
+    case Token::NUMBER:
+    case Token::EOS:
+    case Token::ILLEGAL:
+      entry.needs_rescan = true;
+      break;
+    case Token::STRING:
+      entry.needs_rescan = next_.literal_chars->length() !=
+                           entry.end_pos - entry.beg_pos - 2;
+      break;
+    default:
+      entry.needs_rescan =
+          next_.literal_chars != NULL &&
+          next_.literal_chars->length() != entry.end_pos - entry.beg_pos;
+      break;
+  }
+  token_log_->Add(entry);
+}
+
+
+void Scanner::ReplaySeek(int pos) {
+  // Make c0_ the character at |pos|. The skipped characters are known from
+  // the log to be whitespace, comments, or the rest of the token just
+  // replayed.
+  source_->SeekForward(pos - source_->pos());
+  Advance();
+}
+
+
+bool Scanner::ReplayNextToken() {
+  int pos = source_pos();
+  if (!replay_active_) {
+    if (pos != replay_log_->body_start_pos()) return false;
+    replay_active_ = true;
+  }
+  PreparseTokenLog::TokenEntry entry;
+  do {
+    if (!replay_log_->Read(&replay_index_, &replay_prev_end_, &entry)) {
+      // The log has run out; scanning continues normally from here.
+      replay_log_ = NULL;
+      replay_active_ = false;
+      return false;
+    }
+    // Skip entries the scanner has already moved past: tokens consumed
+    // through SeekForward, regular expression and template scanning, and
+    // look-ahead tokens that were scanned and then gone back over.
+  } while (entry.beg_pos < pos);
+
+  has_line_terminator_before_next_ = entry.newline_before;
+  if (entry.needs_rescan) {
+    if (entry.beg_pos > pos) ReplaySeek(entry.beg_pos);
+    Scan();
+    DCHECK(next_.token == entry.kind);
+    return true;
+  }
+
+  next_.location.beg_pos = entry.beg_pos;
+  next_.location.end_pos = entry.end_pos;
+  next_.token = entry.kind;
+  next_.raw_literal_chars = NULL;
+  if (entry.kind == Token::STRING) {
+    // An unescaped string; its characters are the source between the
+    // delimiters.
+    if (entry.beg_pos > pos) ReplaySeek(entry.beg_pos);
+    LiteralScope literal(this);
+    Advance();
+    while (source_pos() < entry.end_pos - 1) AddLiteralCharAdvance();
+    Advance();
+    literal.Complete();
+  } else if (entry.kind == Token::IDENTIFIER ||
+             entry.kind == Token::FUTURE_RESERVED_WORD ||
+             entry.kind == Token::FUTURE_STRICT_RESERVED_WORD ||
+             Token::IsKeyword(entry.kind)) {
+    // An unescaped identifier or keyword; its characters are the source.
+    if (entry.beg_pos > pos) ReplaySeek(entry.beg_pos);
+    LiteralScope literal(this);
+    while (source_pos() < entry.end_pos) AddLiteralCharAdvance();
+    literal.Complete();
+  } else {
+    next_.literal_chars = NULL;
+    ReplaySeek(entry.end_pos);
+  }
+  return true;
+}
+
+
 template <bool capture_raw, bool in_template_literal>
 bool Scanner::ScanEscape() {
   uc32 c = c0_;
@@ -798,9 +964,6 @@ uc32 Scanner::ScanOctalEscape(uc32 c, int length) {
 }
 
 
-const int kMaxAscii = 127;
-
-
 Token::Value Scanner::ScanString() {
   uc32 quote = c0_;
   Advance<false, false>();  // consume quote
@@ -824,7 +987,7 @@ Token::Value Scanner::ScanString() {
   }
 
   while (c0_ != quote && c0_ >= 0
-         && !unicode_cache_->IsLineTerminator(c0_)) {
+         && !IsLineTerminator(c0_)) {
     uc32 c = c0_;
     Advance();
     if (c == '\\') {
@@ -873,7 +1036,7 @@ Token::Value Scanner::ScanTemplateSpan() {
       ReduceRawLiteralLength(2);
       break;
     } else if (c == '\\') {
-      if (c0_ > 0 && unicode_cache_->IsLineTerminator(c0_)) {
+      if (c0_ > 0 && IsLineTerminator(c0_)) {
         // The TV of LineContinuation :: \ LineTerminatorSequence is the empty
         // code unit sequence.
         uc32 lastChar = c0_;
@@ -1058,7 +1221,7 @@ Token::Value Scanner::ScanNumber(bool seen_period) {
   // section 7.8.3, page 17 (note that we read only one decimal digit
   // if the value is 0).
   if (IsDecimalDigit(c0_) ||
-      (c0_ >= 0 && unicode_cache_->IsIdentifierStart(c0_)))
+      (c0_ >= 0 && IsIdentifierStart(c0_)))
     return Token::ILLEGAL;
 
   literal.Complete();
@@ -1224,7 +1387,7 @@ bool Scanner::IdentifierIsFutureStrictReserved(
 
 
 Token::Value Scanner::ScanIdentifierOrKeyword() {
-  DCHECK(unicode_cache_->IsIdentifierStart(c0_));
+  DCHECK(IsIdentifierStart(c0_));
   LiteralScope literal(this);
   if (IsInRange(c0_, 'a', 'z')) {
     do {
@@ -1288,7 +1451,7 @@ Token::Value Scanner::ScanIdentifierOrKeyword() {
   }
 
   // Scan the rest of the identifier characters.
-  while (c0_ >= 0 && unicode_cache_->IsIdentifierPart(c0_)) {
+  while (c0_ >= 0 && IsIdentifierPart(c0_)) {
     if (c0_ != '\\') {
       uc32 next_char = c0_;
       Advance();
@@ -1314,7 +1477,7 @@ Token::Value Scanner::ScanIdentifierOrKeyword() {
 
 Token::Value Scanner::ScanIdentifierSuffix(LiteralScope* literal) {
   // Scan the rest of the identifier characters.
-  while (c0_ >= 0 && unicode_cache_->IsIdentifierPart(c0_)) {
+  while (c0_ >= 0 && IsIdentifierPart(c0_)) {
     if (c0_ == '\\') {
       uc32 c = ScanIdentifierUnicodeEscape();
       // Only allow legal identifier part characters.
@@ -1353,10 +1516,10 @@ bool Scanner::ScanRegExpPattern(bool seen_equal) {
   }
 
   while (c0_ != '/' || in_character_class) {
-    if (c0_ < 0 || unicode_cache_->IsLineTerminator(c0_)) return false;
+    if (c0_ < 0 || IsLineTerminator(c0_)) return false;
     if (c0_ == '\\') {  // Escape sequence.
       AddLiteralCharAdvance();
-      if (c0_ < 0 || unicode_cache_->IsLineTerminator(c0_)) return false;
+      if (c0_ < 0 || IsLineTerminator(c0_)) return false;
       AddLiteralCharAdvance();
       // If the escape allows more characters, i.e., \x??, \u????, or \c?,
       // only "safe" characters are allowed (letters, digits, underscore),
@@ -1385,7 +1548,7 @@ bool Scanner::ScanRegExpPattern(bool seen_equal) {
 bool Scanner::ScanRegExpFlags() {
   // Scan regular expression flags.
   LiteralScope literal(this);
-  while (c0_ >= 0 && unicode_cache_->IsIdentifierPart(c0_)) {
+  while (c0_ >= 0 && IsIdentifierPart(c0_)) {
     if (c0_ != '\\') {
       AddLiteralCharAdvance();
     } else {
@@ -1467,6 +1630,12 @@ void Scanner::ResetToBookmark() {
   CopyTokenDesc(&next_, &bookmark_next_);
 
   bookmark_c0_ = kBookmarkWasApplied;
+
+  // The reset rewound the input, so recorded and replayed token positions no
+  // longer line up; abandon both.
+  if (token_log_ != NULL) token_log_->Invalidate();
+  replay_log_ = NULL;
+  replay_active_ = false;
 }
 
 
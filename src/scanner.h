@@ -25,6 +25,7 @@ namespace internal {
 class AstRawString;
 class AstValueFactory;
 class ParserRecorder;
+class PreparseTokenLog;
 
 
 // Returns the value (0 .. 15) of a hexadecimal character c.
@@ -510,6 +511,17 @@ class Scanner {
   Token::Value ScanTemplateStart();
   Token::Value ScanTemplateContinuation();
 
+  // Token logging and replay, see FLAG_preparse_token_cache. While a log is
+  // attached for recording, every token produced by Next() is appended to
+  // it; the current look-ahead token is entered immediately, so the log
+  // covers the look-ahead onwards.
+  void StartLoggingTokens(PreparseTokenLog* log);
+  void StopLoggingTokens() { token_log_ = NULL; }
+  // Replays a previously recorded token log instead of re-scanning the
+  // source. Replay engages when scanning reaches the position the log was
+  // recorded from and ends when the log runs out. Pass NULL to detach.
+  void SetTokenLogToReplay(const PreparseTokenLog* log);
+
   const LiteralBuffer* source_url() const { return &source_url_; }
   const LiteralBuffer* source_mapping_url() const {
     return &source_mapping_url_;
@@ -701,6 +713,18 @@ class Scanner {
   // Scans a single JavaScript token.
   void Scan();
 
+  // Token logging and replay support, defined in scanner.cc.
+  void LogNextToken();
+  bool ReplayNextToken();
+  void ReplaySeek(int pos);
+
+  // One-byte fast versions of the unicode predicates used by the hot
+  // scanning loops; they consult the unicode cache only for non-ASCII
+  // characters. Defined in scanner.cc; all callers live there.
+  inline bool IsLineTerminator(uc32 c);
+  inline bool IsIdentifierStart(uc32 c);
+  inline bool IsIdentifierPart(uc32 c);
+
   bool SkipWhiteSpace();
   Token::Value SkipSingleLineComment();
   Token::Value SkipSourceURLComment();
@@ -807,6 +831,16 @@ class Scanner {
   bool harmony_classes_;
   // Whether we allow \u{xxxxx}.
   bool harmony_unicode_;
+
+  // Token log being recorded, or NULL.
+  PreparseTokenLog* token_log_;
+  // Token log being replayed, or NULL. replay_index_ and replay_prev_end_
+  // form the read cursor; replay_active_ is set once scanning has reached
+  // the position the log was recorded from.
+  const PreparseTokenLog* replay_log_;
+  int replay_index_;
+  int replay_prev_end_;
+  bool replay_active_;
 };
 
 } }  // namespace v8::internal
@@ -161,6 +161,19 @@ Handle<ScopeInfo> ScopeInfo::Create(Isolate* isolate, Zone* zone,
   DCHECK(scope->num_heap_slots() == scope_info->ContextLength() ||
          (scope->num_heap_slots() == kVariablePartIndex &&
           scope_info->ContextLength() == 0));
+
+  // Repeated eval and Function constructor calls keep producing scopes with
+  // identical variable layouts; share one ScopeInfo between them. Scope infos
+  // holding strong mode free variable positions are excluded because those
+  // positions may be non-identical heap numbers.
+  if (strong_mode_free_variable_count == 0) {
+    ScopeInfo* canonical =
+        isolate->scope_info_cache()->GetCanonical(*scope_info);
+    if (canonical != *scope_info) {
+      isolate->counters()->scope_info_cache_hits()->Increment();
+      return Handle<ScopeInfo>(canonical, isolate);
+    }
+  }
   return scope_info;
 }
 
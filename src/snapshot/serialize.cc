@@ -516,10 +516,23 @@ void Deserializer::DecodeReservation(
 
 
 void Deserializer::FlushICacheForNewCodeObjects() {
-  PageIterator it(isolate_->heap()->code_space());
-  while (it.has_next()) {
-    Page* p = it.next();
-    CpuFeatures::FlushICache(p->area_start(), p->area_end() - p->area_start());
+  // Only the chunks the deserializer bump-allocated can contain new code.
+  // Flushing the whole code space would penalize every consumed code cache
+  // entry with the size of all code the isolate has already compiled.
+  const Heap::Reservation& reservation = reservations_[CODE_SPACE];
+  for (int i = 0; i <= current_chunk_[CODE_SPACE]; i++) {
+    Address start = reservation[i].start;
+    Address end = (i == current_chunk_[CODE_SPACE]) ? high_water_[CODE_SPACE]
+                                                    : reservation[i].end;
+    CpuFeatures::FlushICache(start, static_cast<size_t>(end - start));
+  }
+  for (int i = 0; i < deserialized_large_objects_.length(); i++) {
+    HeapObject* obj = deserialized_large_objects_[i];
+    if (obj->IsCode()) {
+      Code* code = Code::cast(obj);
+      CpuFeatures::FlushICache(code->instruction_start(),
+                               code->instruction_size());
+    }
   }
 }
 
@@ -1157,7 +1170,10 @@ bool Deserializer::ReadData(Object** current, Object** limit, int source_space,
         int repeats = source_.GetInt();
         Object* object = current[-1];
         DCHECK(!isolate->heap()->InNewSpace(object));
-        for (int i = 0; i < repeats; i++) UnalignedCopy(current++, &object);
+        // Repeats are only emitted for aligned pointer slots in object
+        // bodies, so the run can be filled in bulk.
+        MemsetPointer(current, object, repeats);
+        current += repeats;
         break;
       }
 
@@ -1218,10 +1234,10 @@ bool Deserializer::ReadData(Object** current, Object** limit, int source_space,
       STATIC_ASSERT(kNumberOfFixedRepeat == 16);
       SIXTEEN_CASES(kFixedRepeat) {
         int repeats = data - kFixedRepeatStart;
-        Object* object;
-        UnalignedCopy(&object, current - 1);
+        Object* object = current[-1];
         DCHECK(!isolate->heap()->InNewSpace(object));
-        for (int i = 0; i < repeats; i++) UnalignedCopy(current++, &object);
+        MemsetPointer(current, object, repeats);
+        current += repeats;
         break;
       }
 
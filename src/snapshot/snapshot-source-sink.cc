@@ -14,6 +14,7 @@ namespace v8 {
 namespace internal {
 
 void SnapshotByteSource::CopyRaw(byte* to, int number_of_bytes) {
+  DCHECK_LE(number_of_bytes, length_ - position_);
   memcpy(to, data_ + position_, number_of_bytes);
   position_ += number_of_bytes;
 }
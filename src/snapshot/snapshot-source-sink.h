@@ -15,6 +15,11 @@ namespace internal {
 /**
  * Source to read snapshot and builtins files from.
  *
+ * The data is consumed strictly front to back: the read position never
+ * moves backwards. Embedders streaming the snapshot from slow media rely
+ * on this to overlap read I/O (or decompression) with deserialization by
+ * staying ahead of the cursor.
+ *
  * Note: Memory ownership remains with callee.
  */
 class SnapshotByteSource final {
@@ -36,7 +41,10 @@ class SnapshotByteSource final {
     return data_[position_++];
   }
 
-  void Advance(int by) { position_ += by; }
+  void Advance(int by) {
+    DCHECK_LE(by, length_ - position_);
+    position_ += by;
+  }
 
   void CopyRaw(byte* to, int number_of_bytes);
 
@@ -16,7 +16,8 @@ namespace v8 {
 
 StartupDataHandler::StartupDataHandler(const char* exec_path,
                                        const char* natives_blob,
-                                       const char* snapshot_blob) {
+                                       const char* snapshot_blob)
+    : owns_data_(true) {
   // If we have (at least one) explicitly given blob, use those.
   // If not, use the default blob locations next to the d8 binary.
   if (natives_blob || snapshot_blob) {
@@ -33,7 +34,18 @@ StartupDataHandler::StartupDataHandler(const char* exec_path,
 }
 
 
+StartupDataHandler::StartupDataHandler(const v8::StartupData& natives,
+                                       const v8::StartupData& snapshot)
+    : owns_data_(false) {
+  natives_ = natives;
+  snapshot_ = snapshot;
+  if (natives_.data) v8::V8::SetNativesDataBlob(&natives_);
+  if (snapshot_.data) v8::V8::SetSnapshotDataBlob(&snapshot_);
+}
+
+
 StartupDataHandler::~StartupDataHandler() {
+  if (!owns_data_) return;
   delete[] natives_.data;
   delete[] snapshot_.data;
 }
@@ -26,6 +26,14 @@ class StartupDataHandler {
   // which would usually be the equivalent of argv[0].
   StartupDataHandler(const char* exec_path, const char* natives_blob,
                      const char* snapshot_blob);
+
+  // Hand blobs that are already in memory (e.g. loaded once by a supervisor
+  // process and shared with its workers) to the v8::V8::Set*DataBlob API
+  // functions without any file system access. The handler does not take
+  // ownership of the memory, which must outlive it.
+  StartupDataHandler(const v8::StartupData& natives,
+                     const v8::StartupData& snapshot);
+
   ~StartupDataHandler();
 
  private:
@@ -39,6 +47,7 @@ class StartupDataHandler {
 
   v8::StartupData natives_;
   v8::StartupData snapshot_;
+  bool owns_data_;
 
   // Disallow copy & assign.
   StartupDataHandler(const StartupDataHandler& other);
@@ -45,11 +45,14 @@ MaybeHandle<String> ReplacementStringBuilder::ToString() {
 IncrementalStringBuilder::IncrementalStringBuilder(Isolate* isolate)
     : isolate_(isolate),
       encoding_(String::ONE_BYTE_ENCODING),
+      sink_(NULL),
+      aborted_(false),
       overflowed_(false),
       part_length_(kInitialPartLength),
-      current_index_(0) {
-  // Create an accumulator handle starting with the empty string.
-  accumulator_ = Handle<String>(isolate->heap()->empty_string(), isolate);
+      current_index_(0),
+      parts_length_(0),
+      accumulated_length_(0) {
+  parts_ = factory()->NewFixedArray(kInitialPartsCapacity);
   current_part_ =
       factory()->NewRawOneByteString(part_length_).ToHandleChecked();
 }
@@ -58,17 +61,36 @@ IncrementalStringBuilder::IncrementalStringBuilder(Isolate* isolate)
 void IncrementalStringBuilder::Accumulate() {
   // Only accumulate fully written strings. Shrink first if necessary.
   DCHECK_EQ(current_index_, current_part()->length());
-  Handle<String> new_accumulator;
-  if (accumulator()->length() + current_part()->length() > String::kMaxLength) {
+  if (sink_ != NULL) {
+    // In streaming mode the completed part goes to the sink and no parts
+    // are collected. The part handle is only replaced after the sink
+    // returns, so the sink may allocate.
+    if (!aborted_ && current_part()->length() > 0) {
+      aborted_ = !sink_->WritePart(current_part());
+    }
+    return;
+  }
+  AddPart(current_part());
+}
+
+
+void IncrementalStringBuilder::AddPart(Handle<String> part) {
+  int length = part->length();
+  if (length == 0) return;
+  if (accumulated_length_ > String::kMaxLength - length) {
     // Set the flag and carry on. Delay throwing the exception till the end.
-    new_accumulator = factory()->empty_string();
     overflowed_ = true;
-  } else {
-    new_accumulator = factory()
-                          ->NewConsString(accumulator(), current_part())
-                          .ToHandleChecked();
+    return;
   }
-  set_accumulator(new_accumulator);
+  if (parts_length_ == parts_->length()) {
+    Handle<FixedArray> new_parts = factory()->NewFixedArray(parts_length_ * 2);
+    parts_->CopyTo(0, *new_parts, 0, parts_length_);
+    // Reuse the same handle to avoid being invalidated when exiting handle
+    // scope.
+    *parts_.location() = *new_parts;
+  }
+  parts_->set(parts_length_++, *part);
+  accumulated_length_ += length;
 }
 
 
@@ -95,7 +117,50 @@ MaybeHandle<String> IncrementalStringBuilder::Finish() {
   if (overflowed_) {
     THROW_NEW_ERROR(isolate_, NewInvalidStringLengthError(), String);
   }
-  return accumulator();
+  // In streaming mode all parts went to the sink; there is no result string.
+  if (sink_ != NULL) return factory()->empty_string();
+  if (parts_length_ == 0) return factory()->empty_string();
+  if (parts_length_ == 1) {
+    return Handle<String>(String::cast(parts_->get(0)), isolate_);
+  }
+  // Concatenate the collected parts with a single sized allocation and a
+  // scatter-gather copy instead of building a cons chain.
+  bool one_byte = true;
+  for (int i = 0; i < parts_length_; i++) {
+    if (!String::cast(parts_->get(i))->IsOneByteRepresentation()) {
+      one_byte = false;
+      break;
+    }
+  }
+  Handle<String> result;
+  if (one_byte) {
+    Handle<SeqOneByteString> seq;
+    ASSIGN_RETURN_ON_EXCEPTION(
+        isolate_, seq, factory()->NewRawOneByteString(accumulated_length_),
+        String);
+    DisallowHeapAllocation no_gc;
+    uint8_t* chars = seq->GetChars();
+    for (int i = 0; i < parts_length_; i++) {
+      String* part = String::cast(parts_->get(i));
+      String::WriteToFlat(part, chars, 0, part->length());
+      chars += part->length();
+    }
+    result = Handle<String>::cast(seq);
+  } else {
+    Handle<SeqTwoByteString> seq;
+    ASSIGN_RETURN_ON_EXCEPTION(
+        isolate_, seq, factory()->NewRawTwoByteString(accumulated_length_),
+        String);
+    DisallowHeapAllocation no_gc;
+    uc16* chars = seq->GetChars();
+    for (int i = 0; i < parts_length_; i++) {
+      String* part = String::cast(parts_->get(i));
+      String::WriteToFlat(part, chars, 0, part->length());
+      chars += part->length();
+    }
+    result = Handle<String>::cast(seq);
+  }
+  return result;
 }
 
 
@@ -103,9 +168,13 @@ void IncrementalStringBuilder::AppendString(Handle<String> string) {
   ShrinkCurrentPart();
   part_length_ = kInitialPartLength;  // Allocate conservatively.
   Extend();  // Attach current part and allocate new part.
-  Handle<String> concat =
-      factory()->NewConsString(accumulator(), string).ToHandleChecked();
-  set_accumulator(concat);
+  if (sink_ != NULL) {
+    if (!aborted_ && string->length() > 0) {
+      aborted_ = !sink_->WritePart(string);
+    }
+    return;
+  }
+  AddPart(string);
 }
 }
 }  // namespace v8::internal
@@ -266,6 +266,26 @@ class IncrementalStringBuilder {
  public:
   explicit IncrementalStringBuilder(Isolate* isolate);
 
+  // Receives completed parts of the built string, in order. A part is only
+  // valid for the duration of the WritePart call; the builder reuses part
+  // handles, so the sink must copy the characters out before returning.
+  class PartSink {
+   public:
+    virtual ~PartSink() {}
+    // Returns false to abort the write. Subsequent parts are dropped.
+    virtual bool WritePart(Handle<String> part) = 0;
+  };
+
+  // Switch to streaming mode: completed parts are handed to |sink| instead
+  // of being accumulated on the heap, and Finish() returns the empty string.
+  // Must be called before anything has been appended.
+  void set_sink(PartSink* sink) {
+    DCHECK(current_index_ == 0 && parts_length_ == 0);
+    sink_ = sink;
+  }
+
+  INLINE(bool aborted()) { return aborted_; }
+
   INLINE(String::Encoding CurrentEncoding()) { return encoding_; }
 
   template <typename SrcChar, typename DestChar>
@@ -324,6 +344,11 @@ class IncrementalStringBuilder {
       const uint8_t* u = reinterpret_cast<const uint8_t*>(s);
       while (*u != '\0') Append(*(u++));
     }
+    template <typename SrcChar>
+    INLINE(void AppendChars(const SrcChar* chars, int count)) {
+      CopyChars(cursor_, chars, count);
+      cursor_ += count;
+    }
 
     int written() { return static_cast<int>(cursor_ - start_); }
 
@@ -371,21 +396,20 @@ class IncrementalStringBuilder {
  private:
   Factory* factory() { return isolate_->factory(); }
 
-  INLINE(Handle<String> accumulator()) { return accumulator_; }
-
-  INLINE(void set_accumulator(Handle<String> string)) {
-    *accumulator_.location() = *string;
-  }
-
   INLINE(Handle<String> current_part()) { return current_part_; }
 
   INLINE(void set_current_part(Handle<String> string)) {
     *current_part_.location() = *string;
   }
 
-  // Add the current part to the accumulator.
+  // Add the current part to the collected parts.
   void Accumulate();
 
+  // Append |part| to the collected parts, growing the parts array as
+  // needed. Finish() concatenates the parts with a single sized allocation
+  // and a scatter-gather copy, so no cons chain is ever built.
+  void AddPart(Handle<String> part);
+
   // Finish the current part and allocate a new part.
   void Extend();
 
@@ -399,13 +423,18 @@ class IncrementalStringBuilder {
   static const int kInitialPartLength = 32;
   static const int kMaxPartLength = 16 * 1024;
   static const int kPartLengthGrowthFactor = 2;
+  static const int kInitialPartsCapacity = 16;
 
   Isolate* isolate_;
   String::Encoding encoding_;
+  PartSink* sink_;
+  bool aborted_;
   bool overflowed_;
   int part_length_;
   int current_index_;
-  Handle<String> accumulator_;
+  int parts_length_;
+  int accumulated_length_;
+  Handle<FixedArray> parts_;
   Handle<String> current_part_;
 };
 
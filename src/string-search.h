@@ -38,6 +38,23 @@ class StringSearchBase {
   // to compensate for the algorithmic overhead compared to simple brute force.
   static const int kBMMinPatternLength = 7;
 
+  // Number of pattern-table cache entries kept per isolate. The tables built
+  // by Boyer-Moore(-Horspool) are cached together with a copy of the pattern
+  // suffix they were built from, so repeated searches with the same pattern
+  // skip table construction.
+  static const int kStringSearchCacheSize = Isolate::kStringSearchCacheSize;
+
+  // Layout of the per-entry metadata of the pattern-table cache.
+  static const int kCacheMetaSize = Isolate::kStringSearchCacheMetaSize;
+  static const int kCachePatternLengthIndex = 0;
+  static const int kCacheCharSizeIndex = 1;
+  static const int kCacheValidTablesIndex = 2;
+  static const int kCacheTickIndex = 3;
+
+  // Bits in the valid-tables metadata slot.
+  static const int kBadCharTableValid = 1;
+  static const int kGoodSuffixTableValid = 2;
+
   static inline bool IsOneByteString(Vector<const uint8_t> string) {
     return true;
   }
@@ -56,7 +73,8 @@ class StringSearch : private StringSearchBase {
   StringSearch(Isolate* isolate, Vector<const PatternChar> pattern)
       : isolate_(isolate),
         pattern_(pattern),
-        start_(Max(0, pattern.length() - kBMMaxShift)) {
+        start_(Max(0, pattern.length() - kBMMaxShift)),
+        cache_entry_(-1) {
     if (sizeof(PatternChar) > sizeof(SubjectChar)) {
       if (!IsOneByteString(pattern_)) {
         strategy_ = &FailSearch;
@@ -151,22 +169,41 @@ class StringSearch : private StringSearchBase {
     return bad_char_occurrence[equiv_class];
   }
 
-  // The following tables are shared by all searches.
-  // TODO(lrn): Introduce a way for a pattern to keep its tables
-  // between searches (e.g., for an Atom RegExp).
+  // The tables below are sliced out of a small per-isolate cache, keyed by
+  // the pattern they were built from, so that repeated searches with the
+  // same pattern reuse tables built by an earlier search.
+
+  // Check whether |entry| holds tables built for the current pattern.
+  bool CacheEntryMatches(int entry);
+
+  // Find the cache entry holding tables for the current pattern, or take
+  // over the least recently used entry for it.
+  void EnsureCacheEntry();
+
+  // Per-entry views of the pattern-table cache.
+  int* cache_meta(int entry) {
+    return isolate_->string_search_cache_meta() + entry * kCacheMetaSize;
+  }
+
+  uc16* cache_pattern(int entry) {
+    return isolate_->string_search_cache_pattern() + entry * kBMMaxShift;
+  }
 
   // Store for the BoyerMoore(Horspool) bad char shift table.
   // Return a table covering the last kBMMaxShift+1 positions of
   // pattern.
   int* bad_char_table() {
-    return isolate_->bad_char_shift_table();
+    DCHECK(cache_entry_ >= 0);
+    return isolate_->bad_char_shift_table() + cache_entry_ * kUC16AlphabetSize;
   }
 
   // Store for the BoyerMoore good suffix shift table.
   int* good_suffix_shift_table() {
+    DCHECK(cache_entry_ >= 0);
     // Return biased pointer that maps the range  [start_..pattern_.length()
-    // to the kGoodSuffixShiftTable array.
-    return isolate_->good_suffix_shift_table() - start_;
+    // to the entry's slice of the good-suffix table.
+    return isolate_->good_suffix_shift_table() +
+           cache_entry_ * (kBMMaxShift + 1) - start_;
   }
 
   // Table used temporarily while building the BoyerMoore good suffix
@@ -184,9 +221,70 @@ class StringSearch : private StringSearchBase {
   SearchFunction strategy_;
   // Cache value of Max(0, pattern_length() - kBMMaxShift)
   int start_;
+  // Index of the pattern-table cache entry held by this search, or -1 while
+  // no table has been needed yet.
+  int cache_entry_;
 };
 
 
+//---------------------------------------------------------------------
+// Pattern-table cache.
+//---------------------------------------------------------------------
+
+template <typename PatternChar, typename SubjectChar>
+bool StringSearch<PatternChar, SubjectChar>::CacheEntryMatches(int entry) {
+  // An entry records the full pattern length, the pattern character size and
+  // a copy of the pattern suffix the tables cover, which together determine
+  // the table contents exactly. Zero-initialized (empty) entries never match
+  // because tables are only built for patterns of length at least
+  // kBMMinPatternLength.
+  int* meta = cache_meta(entry);
+  if (meta[kCachePatternLengthIndex] != pattern_.length()) return false;
+  if (meta[kCacheCharSizeIndex] != static_cast<int>(sizeof(PatternChar))) {
+    return false;
+  }
+  const uc16* key = cache_pattern(entry);
+  for (int i = start_; i < pattern_.length(); i++) {
+    if (key[i - start_] != pattern_[i]) return false;
+  }
+  return true;
+}
+
+
+template <typename PatternChar, typename SubjectChar>
+void StringSearch<PatternChar, SubjectChar>::EnsureCacheEntry() {
+  if (cache_entry_ >= 0) return;
+  // The tick counter may eventually wrap around, which only perturbs the
+  // eviction order, not correctness.
+  int tick = isolate_->string_search_cache_clock() + 1;
+  isolate_->set_string_search_cache_clock(tick);
+  int victim = 0;
+  for (int entry = 0; entry < kStringSearchCacheSize; entry++) {
+    if (CacheEntryMatches(entry)) {
+      cache_meta(entry)[kCacheTickIndex] = tick;
+      cache_entry_ = entry;
+      return;
+    }
+    if (cache_meta(entry)[kCacheTickIndex] <
+        cache_meta(victim)[kCacheTickIndex]) {
+      victim = entry;
+    }
+  }
+  // Reassign the least recently used entry to this pattern. Its tables start
+  // out invalid; the populate functions rebuild them on demand.
+  int* meta = cache_meta(victim);
+  meta[kCachePatternLengthIndex] = pattern_.length();
+  meta[kCacheCharSizeIndex] = static_cast<int>(sizeof(PatternChar));
+  meta[kCacheValidTablesIndex] = 0;
+  meta[kCacheTickIndex] = tick;
+  uc16* key = cache_pattern(victim);
+  for (int i = start_; i < pattern_.length(); i++) {
+    key[i - start_] = pattern_[i];
+  }
+  cache_entry_ = victim;
+}
+
+
 //---------------------------------------------------------------------
 // Single Character Pattern Search Strategy
 //---------------------------------------------------------------------
@@ -198,27 +296,45 @@ int StringSearch<PatternChar, SubjectChar>::SingleCharSearch(
     int index) {
   DCHECK_EQ(1, search->pattern_.length());
   PatternChar pattern_first_char = search->pattern_[0];
+  if (sizeof(PatternChar) > sizeof(SubjectChar)) {
+    if (exceedsOneByte(pattern_first_char)) {
+      return -1;
+    }
+  }
+  SubjectChar search_char = static_cast<SubjectChar>(pattern_first_char);
   int i = index;
-  if (sizeof(SubjectChar) == 1 && sizeof(PatternChar) == 1) {
+  int n = subject.length();
+  if (sizeof(SubjectChar) == 1) {
     const SubjectChar* pos = reinterpret_cast<const SubjectChar*>(
-        memchr(subject.start() + i,
-               pattern_first_char,
-               subject.length() - i));
+        memchr(subject.start() + i, search_char, n - i));
     if (pos == NULL) return -1;
     return static_cast<int>(pos - subject.start());
-  } else {
-    if (sizeof(PatternChar) > sizeof(SubjectChar)) {
-      if (exceedsOneByte(pattern_first_char)) {
-        return -1;
-      }
-    }
-    SubjectChar search_char = static_cast<SubjectChar>(pattern_first_char);
-    int n = subject.length();
-    while (i < n) {
-      if (subject[i++] == search_char) return i - 1;
-    }
-    return -1;
   }
+  // Word-at-a-time search for a two-byte character, analogous to what
+  // memchr does above: XOR-ing a word of the subject with the search
+  // character repeated in every lane leaves exactly the matching lanes
+  // zero, which the usual zero-in-lane test detects.
+  static const uintptr_t kOneInEveryChar = kUintptrAllBitsSet / 0xFFFF;
+  static const uintptr_t kMsbInEveryChar = kOneInEveryChar << 15;
+  const int kCharsPerWord =
+      static_cast<int>(sizeof(uintptr_t) / sizeof(SubjectChar));
+  while (i < n &&
+         !IsAligned(reinterpret_cast<intptr_t>(subject.start() + i),
+                    sizeof(uintptr_t))) {
+    if (subject[i++] == search_char) return i - 1;
+  }
+  const uintptr_t repeated_char = kOneInEveryChar * search_char;
+  while (i + kCharsPerWord <= n) {
+    uintptr_t w =
+        *reinterpret_cast<const uintptr_t*>(subject.start() + i) ^
+        repeated_char;
+    if (((w - kOneInEveryChar) & ~w & kMsbInEveryChar) != 0) break;
+    i += kCharsPerWord;
+  }
+  while (i < n) {
+    if (subject[i++] == search_char) return i - 1;
+  }
+  return -1;
 }
 
 //---------------------------------------------------------------------
@@ -335,6 +451,11 @@ int StringSearch<PatternChar, SubjectChar>::BoyerMooreSearch(
 
 template <typename PatternChar, typename SubjectChar>
 void StringSearch<PatternChar, SubjectChar>::PopulateBoyerMooreTable() {
+  EnsureCacheEntry();
+  int* meta = cache_meta(cache_entry_);
+  if ((meta[kCacheValidTablesIndex] & kGoodSuffixTableValid) != 0) return;
+  meta[kCacheValidTablesIndex] |= kGoodSuffixTableValid;
+
   int pattern_length = pattern_.length();
   const PatternChar* pattern = pattern_.start();
   // Only look at the last kBMMaxShift characters of pattern (from start_
@@ -456,6 +577,11 @@ int StringSearch<PatternChar, SubjectChar>::BoyerMooreHorspoolSearch(
 
 template <typename PatternChar, typename SubjectChar>
 void StringSearch<PatternChar, SubjectChar>::PopulateBoyerMooreHorspoolTable() {
+  EnsureCacheEntry();
+  int* meta = cache_meta(cache_entry_);
+  if ((meta[kCacheValidTablesIndex] & kBadCharTableValid) != 0) return;
+  meta[kCacheValidTablesIndex] |= kBadCharTableValid;
+
   int pattern_length = pattern_.length();
 
   int* bad_char_occurrence = bad_char_table();
@@ -229,6 +229,27 @@ static DiyFp AdjustmentPowerOfTen(int exponent) {
 }
 
 
+// Computes the full 128-bit product of a and b, like DiyFp::Multiply, but
+// without rounding: the most significant 64 bits are returned as a DiyFp and
+// the discarded half is stored in *product_low. This lets the caller bound
+// the truncation error exactly instead of charging a blind 0.5 ulp.
+static DiyFp MultiplyKeepLow(DiyFp x, DiyFp y, uint64_t* product_low) {
+  const uint64_t kM32 = 0xFFFFFFFFu;
+  uint64_t a = x.f() >> 32;
+  uint64_t b = x.f() & kM32;
+  uint64_t c = y.f() >> 32;
+  uint64_t d = y.f() & kM32;
+  uint64_t ac = a * c;
+  uint64_t bc = b * c;
+  uint64_t ad = a * d;
+  uint64_t bd = b * d;
+  uint64_t tmp = (bd >> 32) + (ad & kM32) + (bc & kM32);
+  *product_low = (tmp << 32) | (bd & kM32);
+  uint64_t result_f = ac + (ad >> 32) + (bc >> 32) + (tmp >> 32);
+  return DiyFp(result_f, x.e() + y.e() + 64);
+}
+
+
 // If the function returns true then the result is the correct double.
 // Otherwise it is either the correct double or the double that is just below
 // the correct double.
@@ -278,20 +299,31 @@ static bool DiyFpStrtod(Vector<const char> buffer,
     }
   }
 
-  input.Multiply(cached_power);
+  uint64_t product_low;
+  input = MultiplyKeepLow(input, cached_power, &product_low);
   // The error introduced by a multiplication of a*b equals
-  //   error_a + error_b + error_a*error_b/2^64 + 0.5
-  // Substituting a with 'input' and b with 'cached_power' we have
+  //   error_a + error_b + error_a*error_b/2^64
+  // plus whatever precision of the product is discarded. Substituting a with
+  // 'input' and b with 'cached_power' we have
   //   error_b = 0.5  (all cached powers have an error of less than 0.5 ulp),
   //   error_ab = 0 or 1 / kDenominator > error_a*error_b/ 2^64
+  // The top kDenominatorLog bits of the discarded product half are kept as
+  // an extension of the significand below, so truncation costs at most
+  // 1 / kDenominator instead of the 0.5 ulp a rounding multiply charges.
   int error_b = kDenominator / 2;
   int error_ab = (error == 0 ? 0 : 1);  // We round up to 1.
-  int fixed_error = kDenominator / 2;
-  error += error_b + error_ab + fixed_error;
-
-  old_e = input.e();
-  input.Normalize();
-  error <<= old_e - input.e();
+  error += error_b + error_ab + 1;
+
+  // Normalize, shifting bits in from the low half of the product.
+  const uint64_t kUint64MSB = V8_2PART_UINT64_C(0x80000000, 00000000);
+  while ((input.f() & kUint64MSB) == 0) {
+    input.set_f((input.f() << 1) | (product_low >> 63));
+    input.set_e(input.e() - 1);
+    product_low <<= 1;
+    error <<= 1;
+  }
+  int extra_bits = static_cast<int>(
+      product_low >> (DiyFp::kSignificandSize - kDenominatorLog));
 
   // See if the double's significand changes if we add/subtract the error.
   int order_of_magnitude = DiyFp::kSignificandSize + input.e();
@@ -311,6 +343,10 @@ static bool DiyFpStrtod(Vector<const char> buffer,
     // the lost precision of input.f().
     error = (error >> shift_amount) + 1 + kDenominator;
     precision_digits_count -= shift_amount;
+    // The product extension bits are now far below the discarded precision;
+    // give them up for one more unit of error.
+    if (extra_bits != 0) error += 1;
+    extra_bits = 0;
   }
   // We use uint64_ts now. This only works if the DiyFp uses uint64_ts too.
   DCHECK(DiyFp::kSignificandSize == 64);
@@ -320,6 +356,7 @@ static bool DiyFpStrtod(Vector<const char> buffer,
   uint64_t precision_bits = input.f() & precision_bits_mask;
   uint64_t half_way = one64 << (precision_digits_count - 1);
   precision_bits *= kDenominator;
+  precision_bits += extra_bits;
   half_way *= kDenominator;
   DiyFp rounded_input(input.f() >> precision_digits_count,
                       input.e() + precision_digits_count);
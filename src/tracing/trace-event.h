@@ -0,0 +1,130 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_TRACING_TRACE_EVENT_H_
+#define V8_TRACING_TRACE_EVENT_H_
+
+#include <stdint.h>
+
+#include "include/v8-platform.h"
+#include "src/base/macros.h"
+#include "src/v8.h"
+
+// Category-gated trace event macros. Records are handed straight to the
+// embedder's v8::Platform implementation, which is expected to buffer them
+// cheaply (for example in a per-thread ring buffer) and drain them to the
+// JSON trace format asynchronously. The default Platform hooks discard
+// everything, so a disabled category costs one predicted branch on a cached
+// byte per call site and the macros are safe to keep compiled into hot
+// paths.
+//
+// TRACE_EVENT0 records the enclosing scope as a single complete event.
+// TRACE_EVENT_BEGIN0 and TRACE_EVENT_END0 mark phase boundaries that do not
+// nest in a single C++ scope and must be paired by name.
+// TRACE_EVENT_INSTANT0 records a point event.
+
+// Phase indicator characters, following the trace format consumed by
+// chrome://tracing and the trace-viewer tools.
+#define TRACE_EVENT_PHASE_BEGIN ('B')
+#define TRACE_EVENT_PHASE_END ('E')
+#define TRACE_EVENT_PHASE_COMPLETE ('X')
+#define TRACE_EVENT_PHASE_INSTANT ('I')
+
+// Helpers to create call-site-unique identifiers.
+#define INTERNAL_TRACE_EVENT_UID3(a, b) trace_event_unique_##a##b
+#define INTERNAL_TRACE_EVENT_UID2(a, b) INTERNAL_TRACE_EVENT_UID3(a, b)
+#define INTERNAL_TRACE_EVENT_UID(name_prefix) \
+  INTERNAL_TRACE_EVENT_UID2(name_prefix, __LINE__)
+
+// Caches the category-enabled pointer the first time the call site is
+// reached; the embedder guarantees the pointed-to byte stays valid and
+// reflects whether the category is currently enabled.
+#define INTERNAL_TRACE_EVENT_GET_CATEGORY(category_group)  \
+  static const uint8_t* INTERNAL_TRACE_EVENT_UID(category) = \
+      v8::internal::tracing::GetCategoryGroupEnabled(category_group)
+
+#define TRACE_EVENT0(category_group, name)                              \
+  INTERNAL_TRACE_EVENT_GET_CATEGORY(category_group);                    \
+  v8::internal::tracing::ScopedTracer INTERNAL_TRACE_EVENT_UID(tracer)( \
+      INTERNAL_TRACE_EVENT_UID(category), name)
+
+#define TRACE_EVENT_BEGIN0(category_group, name)                       \
+  do {                                                                 \
+    INTERNAL_TRACE_EVENT_GET_CATEGORY(category_group);                 \
+    if (*INTERNAL_TRACE_EVENT_UID(category)) {                         \
+      v8::internal::tracing::AddTraceEvent(                            \
+          TRACE_EVENT_PHASE_BEGIN, INTERNAL_TRACE_EVENT_UID(category), \
+          name);                                                       \
+    }                                                                  \
+  } while (false)
+
+#define TRACE_EVENT_END0(category_group, name)                               \
+  do {                                                                       \
+    INTERNAL_TRACE_EVENT_GET_CATEGORY(category_group);                       \
+    if (*INTERNAL_TRACE_EVENT_UID(category)) {                               \
+      v8::internal::tracing::AddTraceEvent(                                  \
+          TRACE_EVENT_PHASE_END, INTERNAL_TRACE_EVENT_UID(category), name);  \
+    }                                                                        \
+  } while (false)
+
+#define TRACE_EVENT_INSTANT0(category_group, name)                         \
+  do {                                                                     \
+    INTERNAL_TRACE_EVENT_GET_CATEGORY(category_group);                     \
+    if (*INTERNAL_TRACE_EVENT_UID(category)) {                             \
+      v8::internal::tracing::AddTraceEvent(                                \
+          TRACE_EVENT_PHASE_INSTANT, INTERNAL_TRACE_EVENT_UID(category),   \
+          name);                                                           \
+    }                                                                      \
+  } while (false)
+
+namespace v8 {
+namespace internal {
+namespace tracing {
+
+inline const uint8_t* GetCategoryGroupEnabled(const char* category_group) {
+  return V8::GetCurrentPlatform()->GetCategoryGroupEnabled(category_group);
+}
+
+
+inline uint64_t AddTraceEvent(char phase,
+                              const uint8_t* category_group_enabled,
+                              const char* name) {
+  return V8::GetCurrentPlatform()->AddTraceEvent(
+      phase, category_group_enabled, name, 0, 0, NULL, NULL, NULL, 0);
+}
+
+
+// Records the time between its construction and destruction as a complete
+// event. Used by TRACE_EVENT0; can also be embedded as a member to trace
+// the lifetime of an existing scope object.
+class ScopedTracer {
+ public:
+  ScopedTracer(const uint8_t* category_group_enabled, const char* name)
+      : category_group_enabled_(NULL), name_(name), handle_(0) {
+    if (!*category_group_enabled) return;
+    category_group_enabled_ = category_group_enabled;
+    handle_ = AddTraceEvent(TRACE_EVENT_PHASE_COMPLETE,
+                            category_group_enabled_, name_);
+  }
+
+  ~ScopedTracer() {
+    if (category_group_enabled_ == NULL) return;
+    V8::GetCurrentPlatform()->UpdateTraceEventDuration(
+        category_group_enabled_, name_, handle_);
+  }
+
+ private:
+  // NULL when the category was disabled at construction time.
+  const uint8_t* category_group_enabled_;
+  const char* name_;
+  uint64_t handle_;
+
+  DISALLOW_COPY_AND_ASSIGN(ScopedTracer);
+};
+
+}  // namespace tracing
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_TRACING_TRACE_EVENT_H_
@@ -16,6 +16,9 @@ namespace internal {
 void TransitionArray::Insert(Handle<Map> map, Handle<Name> name,
                              Handle<Map> target, SimpleTransitionFlag flag) {
   Isolate* isolate = map->GetIsolate();
+  // Inserting may overwrite an existing transition in place, which the
+  // (map, name) memo could otherwise still report.
+  isolate->transition_lookup_cache()->Clear();
   target->SetBackPointer(*map);
 
   // If the map doesn't have any transitions at all yet, install the new one.
@@ -160,6 +163,15 @@ void TransitionArray::Insert(Handle<Map> map, Handle<Name> name,
 // static
 Map* TransitionArray::SearchTransition(Map* map, PropertyKind kind, Name* name,
                                        PropertyAttributes attributes) {
+  // The (map, name) memo only covers the query shape used on the object
+  // construction hot path; other shapes are rare enough to always search.
+  bool memoizable = kind == kData && attributes == NONE;
+  TransitionLookupCache* cache = NULL;
+  if (memoizable) {
+    cache = map->GetIsolate()->transition_lookup_cache();
+    Map* cached_target = cache->Lookup(map, name);
+    if (cached_target != NULL) return cached_target;
+  }
   Object* raw_transitions = map->raw_transitions();
   if (IsSimpleTransition(raw_transitions)) {
     Map* target = GetSimpleTransition(raw_transitions);
@@ -168,13 +180,16 @@ Map* TransitionArray::SearchTransition(Map* map, PropertyKind kind, Name* name,
     PropertyDetails details = GetSimpleTargetDetails(target);
     if (details.attributes() != attributes) return NULL;
     if (details.kind() != kind) return NULL;
+    if (memoizable) cache->Update(map, name, target);
     return target;
   }
   if (IsFullTransitionArray(raw_transitions)) {
     TransitionArray* transitions = TransitionArray::cast(raw_transitions);
     int transition = transitions->Search(kind, name, attributes);
     if (transition == kNotFound) return NULL;
-    return transitions->GetTarget(transition);
+    Map* target = transitions->GetTarget(transition);
+    if (memoizable) cache->Update(map, name, target);
+    return target;
   }
   return NULL;
 }
@@ -363,6 +378,7 @@ static void ZapTransitionArray(TransitionArray* transitions) {
 
 void TransitionArray::ReplaceTransitions(Handle<Map> map,
                                          Object* new_transitions) {
+  map->GetIsolate()->transition_lookup_cache()->Clear();
   Object* raw_transitions = map->raw_transitions();
   if (IsFullTransitionArray(raw_transitions)) {
     TransitionArray* old_transitions = TransitionArray::cast(raw_transitions);
@@ -346,6 +346,12 @@ class CallICNexus : public FeedbackNexus {
     DCHECK(vector->GetKind(slot) == Code::CALL_IC);
   }
 
+  // The extra slot of a CallIC holds a Smi whose low bit is the
+  // has-returned-minus-zero flag (see MathFloor_STUB in runtime.js) and
+  // whose upper bits count the monomorphic invocations of the call site,
+  // so counts are recorded in increments of two.
+  static const int kCallCountIncrement = 2;
+
   void Clear(Code* host);
 
   void ConfigureUninitialized();
@@ -355,6 +361,10 @@ class CallICNexus : public FeedbackNexus {
 
   InlineCacheState StateFromFeedback() const override;
 
+  // Returns the number of invocations recorded for the call site, or -1 if
+  // no count has been collected yet.
+  int ExtractCallCount();
+
   int ExtractMaps(MapHandleList* maps) const override {
     // CallICs don't record map feedback.
     return 0;
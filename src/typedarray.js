@@ -180,10 +180,7 @@ function NAMESubArray(begin, end) {
     endInt = beginInt;
   }
   var newLength = endInt - beginInt;
-  var beginByteOffset =
-      %_ArrayBufferViewGetByteOffset(this) + beginInt * ELEMENT_SIZE;
-  return new GlobalNAME(%TypedArrayGetBuffer(this),
-                        beginByteOffset, newLength);
+  return %TypedArraySubarray(this, beginInt, newLength);
 }
 endmacro
 
@@ -203,58 +200,6 @@ function TypedArraySetFromArrayLike(target, source, sourceLength, offset) {
   }
 }
 
-function TypedArraySetFromOverlappingTypedArray(target, source, offset) {
-  var sourceElementSize = source.BYTES_PER_ELEMENT;
-  var targetElementSize = target.BYTES_PER_ELEMENT;
-  var sourceLength = source.length;
-
-  // Copy left part.
-  function CopyLeftPart() {
-    // First un-mutated byte after the next write
-    var targetPtr = target.byteOffset + (offset + 1) * targetElementSize;
-    // Next read at sourcePtr. We do not care for memory changing before
-    // sourcePtr - we have already copied it.
-    var sourcePtr = source.byteOffset;
-    for (var leftIndex = 0;
-         leftIndex < sourceLength && targetPtr <= sourcePtr;
-         leftIndex++) {
-      target[offset + leftIndex] = source[leftIndex];
-      targetPtr += targetElementSize;
-      sourcePtr += sourceElementSize;
-    }
-    return leftIndex;
-  }
-  var leftIndex = CopyLeftPart();
-
-  // Copy rigth part;
-  function CopyRightPart() {
-    // First unmutated byte before the next write
-    var targetPtr =
-      target.byteOffset + (offset + sourceLength - 1) * targetElementSize;
-    // Next read before sourcePtr. We do not care for memory changing after
-    // sourcePtr - we have already copied it.
-    var sourcePtr =
-      source.byteOffset + sourceLength * sourceElementSize;
-    for(var rightIndex = sourceLength - 1;
-        rightIndex >= leftIndex && targetPtr >= sourcePtr;
-        rightIndex--) {
-      target[offset + rightIndex] = source[rightIndex];
-      targetPtr -= targetElementSize;
-      sourcePtr -= sourceElementSize;
-    }
-    return rightIndex;
-  }
-  var rightIndex = CopyRightPart();
-
-  var temp = new GlobalArray(rightIndex + 1 - leftIndex);
-  for (var i = leftIndex; i <= rightIndex; i++) {
-    temp[i - leftIndex] = source[i];
-  }
-  for (i = leftIndex; i <= rightIndex; i++) {
-    target[offset + i] = temp[i - leftIndex];
-  }
-}
-
 function TypedArraySet(obj, offset) {
   var intOffset = IS_UNDEFINED(offset) ? 0 : TO_INTEGER(offset);
   if (intOffset < 0) throw MakeTypeError(kTypedArraySetNegativeOffset);
@@ -263,16 +208,10 @@ function TypedArraySet(obj, offset) {
     throw MakeRangeError(kTypedArraySetSourceTooLarge);
   }
   switch (%TypedArraySetFastCases(this, obj, intOffset)) {
-    // These numbers should be synchronized with runtime.cc.
-    case 0: // TYPED_ARRAY_SET_TYPED_ARRAY_SAME_TYPE
-      return;
-    case 1: // TYPED_ARRAY_SET_TYPED_ARRAY_OVERLAPPING
-      TypedArraySetFromOverlappingTypedArray(this, obj, intOffset);
-      return;
-    case 2: // TYPED_ARRAY_SET_TYPED_ARRAY_NONOVERLAPPING
-      TypedArraySetFromArrayLike(this, obj, obj.length, intOffset);
+    // These numbers should be synchronized with runtime-typedarray.cc.
+    case 0: // TYPED_ARRAY_SET_TYPED_ARRAY_DONE
       return;
-    case 3: // TYPED_ARRAY_SET_NON_TYPED_ARRAY
+    case 1: // TYPED_ARRAY_SET_NON_TYPED_ARRAY
       var l = obj.length;
       if (IS_UNDEFINED(l)) {
         if (IS_NUMBER(obj)) {
@@ -401,7 +340,7 @@ function DataViewGetTYPENAMEJS(offset, little_endian) {
   }
   if (%_ArgumentsLength() < 1) throw MakeTypeError(kInvalidArgument);
   offset = $toPositiveInteger(offset, kInvalidDataViewAccessorOffset);
-  return %DataViewGetTYPENAME(this, offset, !!little_endian);
+  return %_DataViewGetTYPENAME(this, offset, !!little_endian);
 }
 
 function DataViewSetTYPENAMEJS(offset, value, little_endian) {
@@ -411,7 +350,8 @@ function DataViewSetTYPENAMEJS(offset, value, little_endian) {
   }
   if (%_ArgumentsLength() < 2) throw MakeTypeError(kInvalidArgument);
   offset = $toPositiveInteger(offset, kInvalidDataViewAccessorOffset);
-  %DataViewSetTYPENAME(this, offset, TO_NUMBER_INLINE(value), !!little_endian);
+  %_DataViewSetTYPENAME(this, offset, TO_NUMBER_INLINE(value),
+                        !!little_endian);
 }
 endmacro
 
@@ -297,6 +297,10 @@ function URIDecode(uri) {
     return false;
   };
   var string = $toString(uri);
+  var result = %URIDecode(string, true);
+  if (!IS_UNDEFINED(result)) return result;
+  // The runtime bails out on malformed input; decode again in JavaScript
+  // to raise a URIError at the offending escape sequence.
   return Decode(string, reservedPredicate);
 }
 
@@ -304,6 +308,8 @@ function URIDecode(uri) {
 function URIDecodeComponent(component) {
   var reservedPredicate = function(cc) { return false; };
   var string = $toString(component);
+  var result = %URIDecode(string, false);
+  if (!IS_UNDEFINED(result)) return result;
   return Decode(string, reservedPredicate);
 }
 
@@ -331,6 +337,10 @@ function URIEncode(uri) {
     return false;
   };
   var string = $toString(uri);
+  var result = %URIEncode(string, true);
+  if (!IS_UNDEFINED(result)) return result;
+  // The runtime bails out on unpaired surrogates; encode again in
+  // JavaScript to raise a URIError at the offending character.
   return Encode(string, unescapePredicate);
 }
 
@@ -352,6 +362,8 @@ function URIEncodeComponent(component) {
     return false;
   };
   var string = $toString(component);
+  var result = %URIEncode(string, false);
+  if (!IS_UNDEFINED(result)) return result;
   return Encode(string, unescapePredicate);
 }
 
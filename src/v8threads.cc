@@ -41,7 +41,7 @@ void Locker::Initialize(v8::Isolate* isolate) {
     // get the saved state for this thread and restore it.
     if (isolate_->thread_manager()->RestoreThread()) {
       top_level_ = false;
-    } else {
+    } else if (!isolate_->thread_manager()->TryReuseThreadResources()) {
       internal::ExecutionAccess access(isolate_);
       isolate_->stack_guard()->ClearThread(access);
       isolate_->stack_guard()->InitThread(access);
@@ -67,7 +67,9 @@ Locker::~Locker() {
   DCHECK(isolate_->thread_manager()->IsLockedByCurrentThread());
   if (has_lock_) {
     if (top_level_) {
-      isolate_->thread_manager()->FreeThreadResources();
+      if (!isolate_->thread_manager()->TryKeepThreadResources()) {
+        isolate_->thread_manager()->FreeThreadResources();
+      }
     } else {
       isolate_->thread_manager()->ArchiveThread();
     }
@@ -150,14 +152,50 @@ bool ThreadManager::RestoreThread() {
 }
 
 
+// Bounds for the adaptive spin count used before blocking on the mutex.
+static const int kMinSpinCount = 16;
+static const int kMaxSpinCount = 4096;
+
+
 void ThreadManager::Lock() {
-  mutex_.Lock();
+  isolate_->counters()->locker_acquisitions()->Increment();
+  if (!mutex_.TryLock()) LockContended();
   mutex_owner_ = ThreadId::Current();
   DCHECK(IsLockedByCurrentThread());
 }
 
 
+void ThreadManager::LockContended() {
+  isolate_->counters()->locker_contentions()->Increment();
+  if (FLAG_trace_lock_contention) {
+    PrintF("[locker] thread %d contends with thread %d for isolate %p\n",
+           ThreadId::Current().ToInteger(), mutex_owner_.ToInteger(),
+           static_cast<void*>(isolate_));
+  }
+  // Spin for a while before blocking; the lock is usually held only for the
+  // duration of a thread state roundtrip.  The spin count adapts so that
+  // workloads with long critical sections do not burn cycles spinning.
+  int spin_limit = base::NoBarrier_Load(&spin_limit_);
+  for (int i = 0; i < spin_limit; i++) {
+    if (mutex_.TryLock()) {
+      // Spinning won the lock, so it is worth trying a little longer next
+      // time.
+      if (spin_limit < kMaxSpinCount) {
+        base::NoBarrier_Store(&spin_limit_, spin_limit * 2);
+      }
+      return;
+    }
+  }
+  // Spinning did not pay off; spin less next time and block.
+  if (spin_limit > kMinSpinCount) {
+    base::NoBarrier_Store(&spin_limit_, spin_limit / 2);
+  }
+  mutex_.Lock();
+}
+
+
 void ThreadManager::Unlock() {
+  last_lock_owner_ = mutex_owner_;
   mutex_owner_ = ThreadId::Invalid();
   mutex_.Unlock();
 }
@@ -239,6 +277,8 @@ ThreadState* ThreadState::Next() {
 // defined as 0.)
 ThreadManager::ThreadManager()
     : mutex_owner_(ThreadId::Invalid()),
+      last_lock_owner_(ThreadId::Invalid()),
+      spin_limit_(kMinSpinCount),
       lazily_archived_thread_(ThreadId::Invalid()),
       lazily_archived_thread_state_(NULL),
       free_anchor_(NULL),
@@ -314,6 +354,25 @@ void ThreadManager::FreeThreadResources() {
 }
 
 
+bool ThreadManager::TryKeepThreadResources() {
+  DCHECK(IsLockedByCurrentThread());
+  if (!FLAG_keep_locker_thread_resources) return false;
+  // Persist an embedder-provided stack limit like FreeThreadResources
+  // would; everything else stays warm for the next lock by this thread.
+  isolate_->stack_guard()->FreeThreadResources();
+  return true;
+}
+
+
+bool ThreadManager::TryReuseThreadResources() {
+  DCHECK(IsLockedByCurrentThread());
+  if (!FLAG_keep_locker_thread_resources) return false;
+  // If this thread was the last one to hold the lock then its stack guard
+  // state was left in place and no other thread can have clobbered it.
+  return last_lock_owner_.Equals(ThreadId::Current());
+}
+
+
 bool ThreadManager::IsArchived() {
   Isolate::PerIsolateThreadData* data =
       isolate_->FindPerThreadDataForThisThread();
@@ -74,6 +74,17 @@ class ThreadManager {
   void FreeThreadResources();
   bool IsArchived();
 
+  // Instead of freeing the releasing thread's resources, keeps them alive
+  // and remembers the thread so that an uncontended relock by the same
+  // thread can skip re-initialization.  Returns false if resource keeping
+  // is disabled and the caller should free the resources.
+  bool TryKeepThreadResources();
+
+  // Returns true if the current thread was the last one to hold the lock
+  // and its per-thread state is therefore still valid, in which case the
+  // stack guard does not have to be re-initialized.
+  bool TryReuseThreadResources();
+
   void Iterate(ObjectVisitor* v);
   void IterateArchivedThreads(ThreadVisitor* v);
   bool IsLockedByCurrentThread() {
@@ -96,8 +107,18 @@ class ThreadManager {
 
   void EagerlyArchiveThread();
 
+  // Spins a bounded number of times before blocking on the mutex and
+  // records contention statistics.
+  void LockContended();
+
   base::Mutex mutex_;
   ThreadId mutex_owner_;
+  // The thread that most recently released the lock; only meaningful while
+  // the lock is free and only read by a thread that has taken the lock.
+  ThreadId last_lock_owner_;
+  // Number of TryLock attempts before blocking, grown when spinning wins
+  // the lock and shrunk when blocking was necessary anyway.
+  base::Atomic32 spin_limit_;
   ThreadId lazily_archived_thread_;
   ThreadState* lazily_archived_thread_state_;
 
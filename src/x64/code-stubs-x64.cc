@@ -2146,6 +2146,12 @@ void CallIC_ArrayStub::Generate(MacroAssembler* masm) {
          factory->allocation_site_map());
   __ j(not_equal, &miss);
 
+  // Increment the call count; the count is kept in the upper bits of the
+  // extra vector slot, above the has-returned-minus-zero flag.
+  __ SmiAddConstant(FieldOperand(rbx, rdx, times_pointer_size,
+                                 FixedArray::kHeaderSize + kPointerSize),
+                    Smi::FromInt(CallICNexus::kCallCountIncrement));
+
   __ movp(rbx, rcx);
   __ movp(rdx, rdi);
   ArrayConstructorStub stub(masm->isolate(), arg_count());
@@ -2207,6 +2213,12 @@ void CallICStub::Generate(MacroAssembler* masm) {
   // convincing us that we have a monomorphic JSFunction.
   __ JumpIfSmi(rdi, &extra_checks_or_miss);
 
+  // Increment the call count; the count is kept in the upper bits of the
+  // extra vector slot, above the has-returned-minus-zero flag.
+  __ SmiAddConstant(FieldOperand(rbx, rdx, times_pointer_size,
+                                 FixedArray::kHeaderSize + kPointerSize),
+                    Smi::FromInt(CallICNexus::kCallCountIncrement));
+
   __ bind(&have_js_function);
   if (CallAsMethod()) {
     EmitContinueIfStrictOrNative(masm, &cont);
@@ -2277,6 +2289,11 @@ void CallICStub::Generate(MacroAssembler* masm) {
   // Update stats.
   __ SmiAddConstant(FieldOperand(rbx, with_types_offset), Smi::FromInt(1));
 
+  // Initialize the call count to one.
+  __ Move(FieldOperand(rbx, rdx, times_pointer_size,
+                       FixedArray::kHeaderSize + kPointerSize),
+          Smi::FromInt(CallICNexus::kCallCountIncrement));
+
   // Store the function. Use a stub since we need a frame for allocation.
   // rbx - vector
   // rdx - slot (needs to be in smi form)
@@ -3354,10 +3371,54 @@ void StringHelper::GenerateFlatOneByteStringEquals(MacroAssembler* masm,
   // Compare characters.
   __ bind(&compare_chars);
   Label strings_not_equal;
-  GenerateOneByteCharsCompareLoop(masm, left, right, length, scratch2,
-                                  &strings_not_equal, Label::kNear);
+
+  // Fast negative check: if both hash codes have been computed, different
+  // hashes mean different strings, and the characters never have to be
+  // looked at.
+  Label hash_not_usable;
+  STATIC_ASSERT(Name::kHashNotComputedMask != 0);
+  __ movl(scratch2, FieldOperand(left, String::kHashFieldOffset));
+  __ testl(scratch2, Immediate(Name::kHashNotComputedMask));
+  __ j(not_zero, &hash_not_usable, Label::kNear);
+  __ testl(FieldOperand(right, String::kHashFieldOffset),
+           Immediate(Name::kHashNotComputedMask));
+  __ j(not_zero, &hash_not_usable, Label::kNear);
+  __ cmpl(scratch2, FieldOperand(right, String::kHashFieldOffset));
+  __ j(not_equal, &strings_not_equal);
+  __ bind(&hash_not_usable);
+
+  // Compare characters a word at a time; unaligned word loads are cheap on
+  // this architecture. The trailing (length mod kPointerSize) characters go
+  // through the byte loop, so nothing is read past the end of the strings.
+  __ SmiToInteger32(length, length);
+  __ leap(left,
+          FieldOperand(left, length, times_1, SeqOneByteString::kHeaderSize));
+  __ leap(right,
+          FieldOperand(right, length, times_1, SeqOneByteString::kHeaderSize));
+  __ negq(length);
+  Register index = length;  // index = -length;
+  Label word_loop, byte_loop, chars_equal;
+  __ bind(&word_loop);
+  __ cmpq(index, Immediate(-static_cast<int>(kPointerSize)));
+  __ j(greater, &byte_loop, Label::kNear);
+  __ movp(scratch2, Operand(left, index, times_1, 0));
+  __ cmpp(scratch2, Operand(right, index, times_1, 0));
+  __ j(not_equal, &strings_not_equal);
+  __ addq(index, Immediate(kPointerSize));
+  __ jmp(&word_loop, Label::kNear);
+
+  // Compare the trailing characters.
+  __ bind(&byte_loop);
+  __ testq(index, index);
+  __ j(zero, &chars_equal, Label::kNear);
+  __ movb(scratch2, Operand(left, index, times_1, 0));
+  __ cmpb(scratch2, Operand(right, index, times_1, 0));
+  __ j(not_equal, &strings_not_equal);
+  __ incq(index);
+  __ jmp(&byte_loop, Label::kNear);
 
   // Characters are equal.
+  __ bind(&chars_equal);
   __ Move(rax, Smi::FromInt(EQUAL));
   __ ret(0);
 
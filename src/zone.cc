@@ -6,6 +6,9 @@
 
 #include <cstring>
 
+#include "src/base/bits.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
 #include "src/v8.h"
 
 #ifdef V8_USE_ADDRESS_SANITIZER
@@ -73,6 +76,85 @@ class Segment {
 };
 
 
+// A process-wide pool of recycled segments.  Compilation creates and
+// destroys many zones in quick succession, and recycling their segments
+// avoids round-tripping through malloc() and free().  Segments are held in
+// power-of-two size buckets; push and pop take a lock whose critical
+// section is a few pointer updates, so zones on background compilation
+// threads share the pool with the main thread.
+class SegmentPool {
+ public:
+  SegmentPool() {
+    for (int i = 0; i < kNumBuckets; i++) {
+      buckets_[i] = nullptr;
+      bucket_counts_[i] = 0;
+    }
+  }
+
+  // Returns a recycled segment of exactly |size| bytes, or NULL if the pool
+  // has none.  The segment header is uninitialized.
+  Segment* Remove(size_t size) {
+    int bucket = BucketFor(size);
+    if (bucket < 0) return nullptr;
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    Segment* segment = buckets_[bucket];
+    if (segment != nullptr) {
+      buckets_[bucket] = segment->next();
+      bucket_counts_[bucket]--;
+    }
+    return segment;
+  }
+
+  // Takes ownership of the segment and returns true if it has been pooled.
+  // Returns false if the segment is not of bucket size or its bucket is
+  // full; the caller must free it.  The size is passed in explicitly since
+  // the segment header may have been zapped.
+  bool Add(Segment* segment, size_t size) {
+    int bucket = BucketFor(size);
+    if (bucket < 0) return false;
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    if (bucket_counts_[bucket] >= kMaxSegmentsPerBucket) return false;
+    segment->Initialize(buckets_[bucket], size);
+    buckets_[bucket] = segment;
+    bucket_counts_[bucket]++;
+    return true;
+  }
+
+ private:
+  // Pooled segment sizes range from the minimum to the maximum segment
+  // size; NewExpand rounds segment sizes up to powers of two so that they
+  // fall into these buckets.
+  static const int kNumBuckets = 8;
+
+  // Bounds the memory held by the pool to a few megabytes.
+  static const int kMaxSegmentsPerBucket = 4;
+
+  static int BucketFor(size_t size) {
+    if (!base::bits::IsPowerOfTwo32(static_cast<uint32_t>(size)) ||
+        size < Zone::kMinimumSegmentSize || size > Zone::kMaximumSegmentSize) {
+      return -1;
+    }
+    int bucket = WhichPowerOf2(static_cast<uint32_t>(size)) -
+                 WhichPowerOf2(static_cast<uint32_t>(Zone::kMinimumSegmentSize));
+    DCHECK(0 <= bucket && bucket < kNumBuckets);
+    return bucket;
+  }
+
+  STATIC_ASSERT(Zone::kMaximumSegmentSize ==
+                (Zone::kMinimumSegmentSize << (kNumBuckets - 1)));
+
+  base::Mutex mutex_;
+  Segment* buckets_[kNumBuckets];
+  int bucket_counts_[kNumBuckets];
+
+  DISALLOW_COPY_AND_ASSIGN(SegmentPool);
+};
+
+
+static base::LazyInstance<SegmentPool>::type segment_pool =
+    LAZY_INSTANCE_INITIALIZER;
+
+
 Zone::Zone()
     : allocation_size_(0),
       segment_bytes_allocated_(0),
@@ -201,7 +283,14 @@ void Zone::DeleteKeptSegment() {
 // Creates a new segment, sets it size, and pushes it to the front
 // of the segment chain. Returns the new segment.
 Segment* Zone::NewSegment(size_t size) {
-  Segment* result = reinterpret_cast<Segment*>(Malloced::New(size));
+  Segment* result = segment_pool.Pointer()->Remove(size);
+  if (result != nullptr) {
+    // The body of a recycled segment may still be poisoned from the zone
+    // that returned it.
+    ASAN_UNPOISON_MEMORY_REGION(result, size);
+  } else {
+    result = reinterpret_cast<Segment*>(Malloced::New(size));
+  }
   segment_bytes_allocated_ += size;
   if (result != nullptr) {
     result->Initialize(segment_head_, size);
@@ -214,7 +303,9 @@ Segment* Zone::NewSegment(size_t size) {
 // Deletes the given segment. Does not touch the segment chain.
 void Zone::DeleteSegment(Segment* segment, size_t size) {
   segment_bytes_allocated_ -= size;
-  Malloced::Delete(segment);
+  if (!segment_pool.Pointer()->Add(segment, size)) {
+    Malloced::Delete(segment);
+  }
 }
 
 
@@ -241,7 +332,13 @@ Address Zone::NewExpand(size_t size) {
   }
   if (new_size < kMinimumSegmentSize) {
     new_size = kMinimumSegmentSize;
-  } else if (new_size > kMaximumSegmentSize) {
+  } else if (new_size <= kMaximumSegmentSize) {
+    // Round the segment size up to the next power of two so that segments
+    // form a small number of size classes and can be recycled through the
+    // segment pool.
+    new_size =
+        base::bits::RoundUpToPowerOfTwo32(static_cast<uint32_t>(new_size));
+  } else {
     // Limit the size of new segments to avoid growing the segment size
     // exponentially, thus putting pressure on contiguous virtual address space.
     // All the while making sure to allocate a segment large enough to hold the
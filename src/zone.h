@@ -19,6 +19,7 @@ namespace internal {
 
 // Forward declarations.
 class Segment;
+class SegmentPool;
 
 
 // The Zone supports very fast allocation of small chunks of
@@ -115,6 +116,10 @@ class Zone final {
   Address limit_;
 
   Segment* segment_head_;
+
+  // The segment pool recycles segments between zones and needs to know the
+  // segment size bounds.
+  friend class SegmentPool;
 };
 
 
@@ -59,6 +59,7 @@
         'compiler/test-gap-resolver.cc',
         'compiler/test-graph-visualizer.cc',
         'compiler/test-instruction.cc',
+        'compiler/test-instruction-scheduler.cc',
         'compiler/test-js-context-specialization.cc',
         'compiler/test-js-constant-cache.cc',
         'compiler/test-js-typed-lowering.cc',
@@ -280,6 +281,33 @@
         }],
       ],
     },
+    {
+      'target_name': 'microbench',
+      'type': 'executable',
+      'dependencies': [
+        '../../tools/gyp/v8.gyp:v8_libplatform',
+      ],
+      'include_dirs': [
+        '../..',
+      ],
+      'sources': [
+        'microbench/bench-handles.cc',
+        'microbench/bench-heap.cc',
+        'microbench/bench-ic.cc',
+        'microbench/bench-strings.cc',
+        'microbench/microbench.cc',
+        'microbench/microbench.h',
+      ],
+      'conditions': [
+        ['component=="shared_library"', {
+          # microbench can't be built against a shared library, so we need
+          # to depend on the underlying static target in that case.
+          'dependencies': ['../../tools/gyp/v8.gyp:v8_maybe_snapshot'],
+        }, {
+          'dependencies': ['../../tools/gyp/v8.gyp:v8'],
+        }],
+      ],
+    },
     {
       'target_name': 'resources',
       'type': 'none',
@@ -129,7 +129,8 @@ class ChangesLoweringTester : public GraphBuilderTester<ReturnType> {
     Typer typer(this->isolate(), this->graph(), Handle<Context>());
     typer.Run();
     ChangeLowering change_lowering(&jsgraph);
-    SelectLowering select_lowering(this->graph(), this->common());
+    SelectLowering select_lowering(this->graph(), this->common(),
+                                   this->machine());
     GraphReducer reducer(this->graph(), this->zone());
     reducer.AddReducer(&change_lowering);
     reducer.AddReducer(&select_lowering);
@@ -0,0 +1,145 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/v8.h"
+#include "test/cctest/cctest.h"
+
+#include "src/compiler/instruction.h"
+#include "src/compiler/instruction-codes.h"
+#include "src/compiler/instruction-scheduler.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Builds a single block of instructions with allocated operands, the way
+// the sequence looks when the scheduler runs after register allocation.
+class SchedulerTestCode : public HandleAndZoneScope {
+ public:
+  SchedulerTestCode()
+      : HandleAndZoneScope(),
+        blocks_(main_zone()),
+        sequence_(main_isolate(), main_zone(), &blocks_),
+        rpo_number_(RpoNumber::FromInt(0)),
+        current_(NULL) {}
+
+  ZoneVector<InstructionBlock*> blocks_;
+  InstructionSequence sequence_;
+  RpoNumber rpo_number_;
+  InstructionBlock* current_;
+
+  InstructionOperand Reg(int index) {
+    return AllocatedOperand(AllocatedOperand::REGISTER, kRepWord32, index);
+  }
+
+  // A register-to-register computation; kArchNop is scheduled as a pure
+  // instruction with unit latency.
+  Instruction* Compute(int dst, int src) {
+    Start();
+    InstructionOperand outputs[] = {Reg(dst)};
+    InstructionOperand inputs[] = {Reg(src)};
+    Instruction* instr = Instruction::New(main_zone(), kArchNop, 1, outputs,
+                                          1, inputs, 0, NULL);
+    sequence_.AddInstruction(instr);
+    return instr;
+  }
+
+  Instruction* Load(int dst, int base) {
+    Start();
+    InstructionOperand outputs[] = {Reg(dst)};
+    InstructionOperand inputs[] = {Reg(base)};
+    Instruction* instr = Instruction::New(main_zone(), kCheckedLoadWord32, 1,
+                                          outputs, 1, inputs, 0, NULL);
+    sequence_.AddInstruction(instr);
+    return instr;
+  }
+
+  Instruction* Store(int base, int value) {
+    Start();
+    InstructionOperand inputs[] = {Reg(base), Reg(value)};
+    Instruction* instr = Instruction::New(main_zone(), kCheckedStoreWord32, 0,
+                                          NULL, 2, inputs, 0, NULL);
+    sequence_.AddInstruction(instr);
+    return instr;
+  }
+
+  Instruction* Ret() {
+    Start();
+    Instruction* instr = Instruction::New(main_zone(), kArchRet);
+    sequence_.AddInstruction(instr);
+    End();
+    return instr;
+  }
+
+  void Schedule() {
+    InstructionScheduler scheduler(main_zone(), &sequence_);
+    scheduler.ScheduleSequence();
+  }
+
+  int IndexOf(const Instruction* instr) {
+    for (size_t i = 0; i < sequence_.instructions().size(); ++i) {
+      if (sequence_.instructions()[i] == instr) return static_cast<int>(i);
+    }
+    return -1;
+  }
+
+ private:
+  void Start() {
+    if (current_ == NULL) {
+      current_ = new (main_zone())
+          InstructionBlock(main_zone(), rpo_number_, RpoNumber::Invalid(),
+                           RpoNumber::Invalid(), false);
+      blocks_.push_back(current_);
+      sequence_.StartBlock(rpo_number_);
+    }
+  }
+
+  void End() {
+    sequence_.EndBlock(current_->rpo_number());
+    current_ = NULL;
+    rpo_number_ = RpoNumber::FromInt(rpo_number_.ToInt() + 1);
+  }
+};
+
+
+TEST(SchedulerHoistsIndependentLoad) {
+  SchedulerTestCode code;
+  Instruction* c1 = code.Compute(1, 0);
+  Instruction* c2 = code.Compute(2, 1);
+  Instruction* c3 = code.Compute(3, 2);
+  Instruction* load = code.Load(11, 10);
+  Instruction* ret = code.Ret();
+
+  code.Schedule();
+
+  // The load does not depend on the chain of computations and has a longer
+  // latency, so it is hoisted above the tail of the chain; the dependent
+  // computations keep their order and the terminator stays at the end.
+  CHECK(code.IndexOf(load) < code.IndexOf(c2));
+  CHECK(code.IndexOf(c1) < code.IndexOf(c2));
+  CHECK(code.IndexOf(c2) < code.IndexOf(c3));
+  CHECK_EQ(static_cast<int>(code.sequence_.instructions().size()) - 1,
+           code.IndexOf(ret));
+}
+
+
+TEST(SchedulerKeepsMemoryAndRegisterOrder) {
+  SchedulerTestCode code;
+  // The load reads the location the store may have written.
+  Instruction* store = code.Store(4, 5);
+  Instruction* load = code.Load(6, 4);
+  // The write of r8 must not be hoisted above the read of its old value.
+  Instruction* read = code.Compute(7, 8);
+  Instruction* write = code.Compute(8, 9);
+  code.Ret();
+
+  code.Schedule();
+
+  CHECK(code.IndexOf(store) < code.IndexOf(load));
+  CHECK(code.IndexOf(read) < code.IndexOf(write));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,42 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Handle-management benchmarks: global handle create/destroy pairs and
+// local handle scope push/pop.
+
+#include "src/v8.h"
+
+#include "src/global-handles.h"
+#include "src/isolate.h"
+#include "test/cctest/microbench/microbench.h"
+
+namespace i = v8::internal;
+
+
+MICROBENCHMARK(GlobalHandleCreateDestroy) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  i::GlobalHandles* global_handles = i_isolate->global_handles();
+  i::Object* value = i_isolate->heap()->undefined_value();
+  for (int n = 0; n < iterations; n++) {
+    i::Handle<i::Object> handle = global_handles->Create(value);
+    i::GlobalHandles::Destroy(handle.location());
+  }
+}
+
+
+MICROBENCHMARK(HandleScopePushPop) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  i::Object* value = i_isolate->heap()->undefined_value();
+  for (int n = 0; n < iterations; n++) {
+    i::HandleScope scope(i_isolate);
+    i::Handle<i::Object> h1(value, i_isolate);
+    i::Handle<i::Object> h2(value, i_isolate);
+    i::Handle<i::Object> h3(value, i_isolate);
+    i::Handle<i::Object> h4(value, i_isolate);
+    USE(h1);
+    USE(h2);
+    USE(h3);
+    USE(h4);
+  }
+}
@@ -0,0 +1,45 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Allocation fast-path benchmarks. These go through the Factory rather
+// than calling Heap::AllocateRaw directly, so retries and GC triggering
+// behave exactly as they do in production; the allocation itself still
+// dominates.
+
+#include "src/v8.h"
+
+#include "src/factory.h"
+#include "src/isolate.h"
+#include "test/cctest/microbench/microbench.h"
+
+namespace i = v8::internal;
+
+
+MICROBENCHMARK(AllocateFixedArray) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  i::Factory* factory = i_isolate->factory();
+  for (int n = 0; n < iterations; n += 1024) {
+    // A fresh handle scope every chunk keeps handle growth out of the
+    // measurement.
+    i::HandleScope scope(i_isolate);
+    int chunk = iterations - n < 1024 ? iterations - n : 1024;
+    for (int j = 0; j < chunk; j++) {
+      factory->NewFixedArray(8);
+    }
+  }
+}
+
+
+MICROBENCHMARK(AllocateJSObject) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  i::Factory* factory = i_isolate->factory();
+  i::Handle<i::JSFunction> object_function = i_isolate->object_function();
+  for (int n = 0; n < iterations; n += 1024) {
+    i::HandleScope scope(i_isolate);
+    int chunk = iterations - n < 1024 ? iterations - n : 1024;
+    for (int j = 0; j < chunk; j++) {
+      factory->NewJSObject(object_function);
+    }
+  }
+}
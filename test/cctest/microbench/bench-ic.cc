@@ -0,0 +1,65 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Inline-cache benchmarks: keyed loads and stores through monomorphic
+// and polymorphic sites. The polymorphic variants rotate receivers with
+// different maps so the keyed ICs transition and probe the stub cache
+// on every call.
+
+#include "src/v8.h"
+
+#include "src/vector.h"
+#include "test/cctest/microbench/microbench.h"
+
+namespace i = v8::internal;
+
+
+static void CompileRun(v8::Isolate* isolate, const char* source) {
+  v8::Script::Compile(v8::String::NewFromUtf8(isolate, source))->Run();
+}
+
+
+static void RunWithIterations(v8::Isolate* isolate, const char* definition,
+                              const char* function, int iterations) {
+  CompileRun(isolate, definition);
+  i::EmbeddedVector<char, 128> call;
+  i::SNPrintF(call, "%s(%d);", function, iterations);
+  CompileRun(isolate, call.start());
+}
+
+
+MICROBENCHMARK(KeyedLoadStoreMonomorphic) {
+  RunWithIterations(isolate,
+                    "function keyedMono(n) {"
+                    "  var a = [0, 1, 2, 3, 4, 5, 6, 7];"
+                    "  var sum = 0;"
+                    "  for (var i = 0; i < n; i++) {"
+                    "    a[i & 7] = i;"
+                    "    sum += a[(i + 1) & 7];"
+                    "  }"
+                    "  return sum;"
+                    "}",
+                    "keyedMono", iterations);
+}
+
+
+MICROBENCHMARK(KeyedLoadStorePolymorphic) {
+  RunWithIterations(isolate,
+                    "function keyedPoly(n) {"
+                    "  var receivers = ["
+                    "    [0, 1, 2, 3],"
+                    "    [0.5, 1.5, 2.5, 3.5],"
+                    "    {0: 0, 1: 1, 2: 2, 3: 3},"
+                    "    new Float64Array(4)"
+                    "  ];"
+                    "  var sum = 0;"
+                    "  for (var i = 0; i < n; i++) {"
+                    "    var o = receivers[i & 3];"
+                    "    o[i & 3] = i;"
+                    "    sum += o[(i + 1) & 3];"
+                    "  }"
+                    "  return sum;"
+                    "}",
+                    "keyedPoly", iterations);
+}
@@ -0,0 +1,32 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// String-table benchmark: internalization of a recurring set of
+// property-name-like strings, i.e. the hash-plus-lookup hit path that
+// dominates parsing and property access on warmed-up code.
+
+#include "src/v8.h"
+
+#include "src/factory.h"
+#include "src/isolate.h"
+#include "test/cctest/microbench/microbench.h"
+
+namespace i = v8::internal;
+
+
+MICROBENCHMARK(InternalizeString) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  i::Factory* factory = i_isolate->factory();
+  i::EmbeddedVector<char, 64> name;
+  for (int n = 0; n < iterations; n += 256) {
+    i::HandleScope scope(i_isolate);
+    int chunk = iterations - n < 256 ? iterations - n : 256;
+    for (int j = 0; j < chunk; j++) {
+      // 256 distinct names; after the first cycle every lookup hits.
+      int length = i::SNPrintF(name, "property_%d", j);
+      factory->InternalizeUtf8String(
+          i::Vector<const char>(name.start(), length));
+    }
+  }
+}
@@ -0,0 +1,99 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "test/cctest/microbench/microbench.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "include/libplatform/libplatform.h"
+#include "src/v8.h"
+
+#include "src/base/platform/elapsed-timer.h"
+#include "src/flags.h"
+#include "src/startup-data-util.h"
+
+Microbenchmark* Microbenchmark::last_ = NULL;
+const double Microbenchmark::kMinSampleTimeMs = 50;
+
+
+Microbenchmark::Microbenchmark(const char* name, PayloadFunction payload)
+    : name_(name), payload_(payload), prev_(last_) {
+  last_ = this;
+}
+
+
+double Microbenchmark::Time(v8::Isolate* isolate, int iterations) {
+  v8::base::ElapsedTimer timer;
+  timer.Start();
+  payload_(isolate, iterations);
+  return timer.Elapsed().InMillisecondsF();
+}
+
+
+void Microbenchmark::Run(v8::Isolate* isolate) {
+  // Grow the iteration count until a single run takes long enough to be
+  // timed reliably, then report the best of several samples.
+  int iterations = 16;
+  double elapsed_ms = Time(isolate, iterations);
+  while (elapsed_ms < kMinSampleTimeMs && iterations < (1 << 28)) {
+    iterations *= 4;
+    elapsed_ms = Time(isolate, iterations);
+  }
+  double best_ms = elapsed_ms;
+  for (int i = 1; i < kSamples; i++) {
+    double sample_ms = Time(isolate, iterations);
+    if (sample_ms < best_ms) best_ms = sample_ms;
+  }
+  printf("%s: %.1f\n", name_, best_ms * 1e6 / iterations);
+}
+
+
+class MicrobenchArrayBufferAllocator : public v8::ArrayBuffer::Allocator {
+  virtual void* Allocate(size_t length) { return malloc(length); }
+  virtual void* AllocateUninitialized(size_t length) { return malloc(length); }
+  virtual void Free(void* data, size_t length) { free(data); }
+};
+
+
+int main(int argc, char* argv[]) {
+  v8::V8::InitializeICU();
+  v8::Platform* platform = v8::platform::CreateDefaultPlatform();
+  v8::V8::InitializePlatform(platform);
+  v8::internal::FlagList::SetFlagsFromCommandLine(&argc, argv, true);
+  v8::V8::Initialize();
+#ifdef V8_USE_EXTERNAL_STARTUP_DATA
+  v8::StartupDataHandler startup_data(argv[0], NULL, NULL);
+#endif
+
+  MicrobenchArrayBufferAllocator array_buffer_allocator;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = &array_buffer_allocator;
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+
+    // With no arguments all benchmarks run; otherwise arguments select
+    // benchmarks by name.
+    for (Microbenchmark* benchmark = Microbenchmark::last();
+         benchmark != NULL; benchmark = benchmark->prev()) {
+      if (argc > 1) {
+        bool selected = false;
+        for (int i = 1; i < argc; i++) {
+          if (strcmp(benchmark->name(), argv[i]) == 0) selected = true;
+        }
+        if (!selected) continue;
+      }
+      benchmark->Run(isolate);
+    }
+  }
+  isolate->Dispose();
+  v8::V8::Dispose();
+  v8::V8::ShutdownPlatform();
+  delete platform;
+  return 0;
+}
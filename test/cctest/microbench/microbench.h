@@ -0,0 +1,46 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef MICROBENCH_H_
+#define MICROBENCH_H_
+
+#include "include/v8.h"
+
+// A registered microbenchmark. The payload function runs the measured
+// operation |iterations| times; the harness calibrates the iteration
+// count until one run takes long enough to time reliably, then reports
+// the best of several samples in nanoseconds per operation, one
+// "Name: value" line per benchmark for tracking over time.
+class Microbenchmark {
+ public:
+  typedef void (*PayloadFunction)(v8::Isolate* isolate, int iterations);
+
+  Microbenchmark(const char* name, PayloadFunction payload);
+
+  void Run(v8::Isolate* isolate);
+
+  const char* name() const { return name_; }
+  Microbenchmark* prev() const { return prev_; }
+  static Microbenchmark* last() { return last_; }
+
+ private:
+  double Time(v8::Isolate* isolate, int iterations);
+
+  static const double kMinSampleTimeMs;
+  static const int kSamples = 5;
+
+  const char* name_;
+  PayloadFunction payload_;
+  Microbenchmark* prev_;
+  static Microbenchmark* last_;
+};
+
+
+#define MICROBENCHMARK(Name)                                         \
+  static void RunMicrobench##Name(v8::Isolate* isolate,              \
+                                  int iterations);                   \
+  static Microbenchmark register_##Name(#Name, &RunMicrobench##Name); \
+  static void RunMicrobench##Name(v8::Isolate* isolate, int iterations)
+
+#endif  // MICROBENCH_H_
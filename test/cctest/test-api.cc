@@ -715,6 +715,23 @@ THREADED_TEST(NewExternalForVeryLongString) {
 }
 
 
+TEST(NewExternalOneByteAdoptedBuffer) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  const char kContents[] = "adopted buffer contents";
+  char* buffer = strdup(kContents);
+  Local<String> string =
+      String::NewExternalOneByte(isolate, buffer, strlen(buffer))
+          .ToLocalChecked();
+  CHECK(string->IsExternalOneByte());
+  v8::String::Utf8Value value(string);
+  CHECK_EQ(0, strcmp(kContents, *value));
+  // The buffer now belongs to the string and is freed when the string is
+  // collected.
+}
+
+
 THREADED_TEST(ScavengeExternalString) {
   i::FLAG_stress_compaction = false;
   i::FLAG_gc_global = false;
@@ -1030,6 +1047,39 @@ THREADED_PROFILED_TEST(SimpleCallback) {
 }
 
 
+static int fast_primitive_slow_calls = 0;
+
+static void FastPrimitiveSlowCallback(
+    const v8::FunctionCallbackInfo<v8::Value>& info) {
+  fast_primitive_slow_calls++;
+  info.GetReturnValue().Set(v8_num(-1));
+}
+
+static double FastPrimitiveFastCallback(const double* args, int length) {
+  double sum = 0;
+  for (int i = 0; i < length; i++) sum += args[i];
+  return sum;
+}
+
+
+THREADED_TEST(FastPrimitiveHandler) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  Local<v8::FunctionTemplate> templ = v8::FunctionTemplate::New(isolate);
+  templ->SetCallHandler(FastPrimitiveSlowCallback);
+  templ->SetFastPrimitiveHandler(FastPrimitiveFastCallback);
+  env->Global()->Set(v8_str("f"), templ->GetFunction());
+  fast_primitive_slow_calls = 0;
+  // All-number arguments take the declared fast path.
+  CHECK_EQ(6.0, CompileRun("f(1, 2, 3)")->NumberValue());
+  CHECK_EQ(0, fast_primitive_slow_calls);
+  // Non-number arguments fall back to the regular callback.
+  CHECK_EQ(-1.0, CompileRun("f('a')")->NumberValue());
+  CHECK_EQ(1, fast_primitive_slow_calls);
+}
+
+
 template<typename T>
 void FastReturnValueCallback(const v8::FunctionCallbackInfo<v8::Value>& info);
 
@@ -3107,6 +3157,13 @@ namespace {
 class TwoPassCallbackData;
 void FirstPassCallback(const v8::WeakCallbackInfo<TwoPassCallbackData>& data);
 void SecondPassCallback(const v8::WeakCallbackInfo<TwoPassCallbackData>& data);
+void OffThreadFirstPassCallback(
+    const v8::WeakCallbackInfo<TwoPassCallbackData>& data);
+void OffThreadSecondPassCallback(
+    const v8::WeakCallbackInfo<TwoPassCallbackData>& data);
+
+// Signalled once per off-thread second pass callback.
+v8::base::Semaphore* off_thread_second_pass_done = NULL;
 
 
 class TwoPassCallbackData {
@@ -3153,6 +3210,12 @@ class TwoPassCallbackData {
     cell_.SetWeak(this, FirstPassCallback, v8::WeakCallbackType::kParameter);
   }
 
+  void SetWeakOffThread() {
+    cell_.SetWeak(this, OffThreadFirstPassCallback,
+                  v8::WeakCallbackType::kParameter);
+    cell_.MarkSecondPassCallbackOffThread();
+  }
+
   void MarkTriggerGc() { trigger_gc_ = true; }
   bool trigger_gc() { return trigger_gc_; }
 
@@ -3184,6 +3247,21 @@ void FirstPassCallback(const v8::WeakCallbackInfo<TwoPassCallbackData>& data) {
   data.SetSecondPassCallback(SecondPassCallback);
 }
 
+
+void OffThreadSecondPassCallback(
+    const v8::WeakCallbackInfo<TwoPassCallbackData>& data) {
+  // Runs on a background thread and must not call back into V8.
+  data.GetParameter()->SecondPass();
+  off_thread_second_pass_done->Signal();
+}
+
+
+void OffThreadFirstPassCallback(
+    const v8::WeakCallbackInfo<TwoPassCallbackData>& data) {
+  data.GetParameter()->FirstPass();
+  data.SetSecondPassCallback(OffThreadSecondPassCallback);
+}
+
 }  // namespace
 
 
@@ -3201,6 +3279,24 @@ TEST(TwoPassPhantomCallbacks) {
 }
 
 
+TEST(TwoPassPhantomCallbacksOffThread) {
+  auto isolate = CcTest::isolate();
+  const size_t kLength = 20;
+  int instance_counter = 0;
+  v8::base::Semaphore done(0);
+  off_thread_second_pass_done = &done;
+  for (size_t i = 0; i < kLength; ++i) {
+    auto data = new TwoPassCallbackData(isolate, &instance_counter);
+    data->SetWeakOffThread();
+  }
+  CHECK_EQ(static_cast<int>(kLength), instance_counter);
+  CcTest::heap()->CollectAllGarbage();
+  for (size_t i = 0; i < kLength; ++i) done.Wait();
+  off_thread_second_pass_done = NULL;
+  CHECK_EQ(0, instance_counter);
+}
+
+
 TEST(TwoPassPhantomCallbacksNestedGc) {
   auto isolate = CcTest::isolate();
   const size_t kLength = 20;
@@ -14155,6 +14251,23 @@ static void StackTraceForUncaughtExceptionListener(
 }
 
 
+TEST(StackTraceFrameCap) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  isolate->SetStackTraceFrameCap(2);
+  v8::Local<v8::Value> lines = CompileRun(
+      "Error.stackTraceLimit = 10;"
+      "function a() { return new Error('x'); }"
+      "function b() { return a(); }"
+      "function c() { return b(); }"
+      "c().stack.split('\\n').length");
+  // One line for the message plus at most two capped frames.
+  CHECK_EQ(3, lines->Int32Value());
+  isolate->SetStackTraceFrameCap(-1);
+}
+
+
 TEST(CaptureStackTraceForUncaughtException) {
   report_count = 0;
   LocalContext env;
@@ -16191,6 +16304,38 @@ TEST(GCCallbacks) {
 }
 
 
+static int gc_statistics_call_count = 0;
+static v8::GCType gc_statistics_last_type = v8::kGCTypeAll;
+static double gc_statistics_last_pause = -1;
+
+void GCStatisticsCallback(v8::Isolate* isolate,
+                          const v8::GCStatistics& statistics) {
+  CHECK_EQ(gc_callbacks_isolate, isolate);
+  gc_statistics_last_type = statistics.type();
+  gc_statistics_last_pause = statistics.pause_time_in_ms();
+  ++gc_statistics_call_count;
+}
+
+
+TEST(GCStatisticsCallback) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  gc_callbacks_isolate = isolate;
+  isolate->SetGCStatisticsCallback(GCStatisticsCallback);
+  CHECK_EQ(0, gc_statistics_call_count);
+  CcTest::heap()->CollectGarbage(i::NEW_SPACE);
+  CHECK_EQ(1, gc_statistics_call_count);
+  CHECK_EQ(v8::kGCTypeScavenge, gc_statistics_last_type);
+  CHECK_GE(gc_statistics_last_pause, 0);
+  CcTest::heap()->CollectAllGarbage();
+  CHECK_EQ(2, gc_statistics_call_count);
+  CHECK_EQ(v8::kGCTypeMarkSweepCompact, gc_statistics_last_type);
+  isolate->SetGCStatisticsCallback(NULL);
+  CcTest::heap()->CollectAllGarbage();
+  CHECK_EQ(2, gc_statistics_call_count);
+}
+
+
 THREADED_TEST(AddToJSFunctionResultCache) {
   i::FLAG_stress_compaction = false;
   i::FLAG_allow_natives_syntax = true;
@@ -368,6 +368,24 @@ TEST(FeedbackVectorUnaffectedByScopeChanges) {
 }
 
 
+TEST(BuiltinNativesCompileLazily) {
+  if (!i::FLAG_lazy) return;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+
+  // Builtins defined in the JS natives are installed as function objects
+  // whose code is the lazy compile builtin; a context only pays for
+  // compiling the builtins it actually calls.
+  Handle<JSFunction> f =
+      v8::Utils::OpenHandle(*v8::Handle<v8::Function>::Cast(
+          CompileRun("Number.prototype.toExponential")));
+  CHECK(!f->shared()->is_compiled());
+
+  CompileRun("(1.5).toExponential();");
+  CHECK(f->shared()->is_compiled());
+}
+
+
 // Test that optimized code for different closures is actually shared
 // immediately by the FastNewClosureStub when run in the same context.
 TEST(OptimizedCodeSharing) {
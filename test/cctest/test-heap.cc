@@ -1075,6 +1075,81 @@ UNINITIALIZED_TEST(TestCodeFlushing) {
 }
 
 
+UNINITIALIZED_TEST(CodeRetentionPolicy) {
+  // If we do not flush code this test is invalid.
+  if (!FLAG_flush_code) return;
+  i::FLAG_allow_natives_syntax = true;
+  i::FLAG_optimize_for_size = false;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  isolate->Enter();
+  Factory* factory = i_isolate->factory();
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo() {"
+        "  var x = 42;"
+        "  var y = 42;"
+        "  var z = x + y;"
+        "};"
+        "foo()";
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+
+    // Require an hour of inactivity before code may be flushed.
+    v8::CodeRetentionPolicy policy;
+    policy.set_minimum_code_age_in_ms(60 * 60 * 1000);
+    isolate->SetCodeRetentionPolicy(policy);
+
+    {
+      v8::HandleScope scope(isolate);
+      CompileRun(source);
+    }
+
+    // Check function is compiled.
+    Handle<Object> func_value = Object::GetProperty(i_isolate->global_object(),
+                                                    foo_name).ToHandleChecked();
+    CHECK(func_value->IsJSFunction());
+    Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+    CHECK(function->shared()->is_compiled());
+
+    // Simulate several GCs that use full marking. The minimum-age policy
+    // keeps the code alive even though it is old in GC generations.
+    const int kAgingThreshold = 6;
+    for (int i = 0; i < kAgingThreshold; i++) {
+      i_isolate->heap()->CollectAllGarbage();
+    }
+    CHECK(function->shared()->is_compiled());
+
+    v8::CodeFlushingStatistics statistics;
+    isolate->GetCodeFlushingStatistics(&statistics);
+    CHECK_EQ(0u, statistics.flushed_function_count());
+
+    // Dropping the policy lets the regular aging heuristic flush the code.
+    isolate->SetCodeRetentionPolicy(v8::CodeRetentionPolicy());
+    for (int i = 0; i < kAgingThreshold; i++) {
+      i_isolate->heap()->CollectAllGarbage();
+    }
+    CHECK(!function->shared()->is_compiled() || function->IsOptimized());
+
+    isolate->GetCodeFlushingStatistics(&statistics);
+    CHECK_LT(0u, statistics.flushed_function_count());
+    CHECK_LT(0u, statistics.flushed_code_size());
+
+    // Calling foo again recompiles it and shows up in the statistics.
+    CompileRun("foo()");
+    CHECK(function->shared()->is_compiled());
+    isolate->GetCodeFlushingStatistics(&statistics);
+    CHECK_LT(0u, statistics.recompiled_function_count());
+    CHECK_LT(0u, statistics.recompiled_code_size());
+  }
+  isolate->Exit();
+  isolate->Dispose();
+}
+
+
 TEST(TestCodeFlushingPreAged) {
   // If we do not flush code this test is invalid.
   if (!FLAG_flush_code) return;
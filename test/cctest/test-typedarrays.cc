@@ -69,6 +69,58 @@ TEST(CopyContentsView) {
 }
 
 
+TEST(PinContentsTypedArray) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  CompileRun(
+      "var a = new Uint8Array(4);"
+      "a[0] = 0;"
+      "a[1] = 1;"
+      "a[2] = 2;"
+      "a[3] = 3;");
+  v8::Local<v8::ArrayBufferView> view = v8::Local<v8::ArrayBufferView>::Cast(
+      env->Global()->Get(v8_str("a")));
+  v8::ArrayBufferView::Contents contents = view->PinContents();
+  CHECK_EQ(4u, contents.ByteLength());
+  unsigned char* data = static_cast<unsigned char*>(contents.Data());
+  for (size_t i = 0; i < contents.ByteLength(); ++i) {
+    CHECK_EQ(i, data[i]);
+  }
+  // Writes through the raw pointer are visible to JS without copies.
+  data[2] = 42;
+  CHECK_EQ(42, CompileRun("a[2]")->Int32Value());
+  // The backing buffer was materialized and may not be neutered while
+  // pinned.
+  CHECK(view->HasBuffer());
+  CHECK(!v8::Utils::OpenHandle(*view->Buffer())->is_neuterable());
+  view->UnpinContents();
+  CHECK(v8::Utils::OpenHandle(*view->Buffer())->is_neuterable());
+}
+
+
+TEST(PinContentsView) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  CompileRun(
+      "var b = new ArrayBuffer(6);"
+      "var c = new Uint8Array(b);"
+      "c[2] = 0;"
+      "c[3] = 1;"
+      "c[4] = 2;"
+      "c[5] = 3;"
+      "var a = new DataView(b, 2);");
+  v8::Local<v8::ArrayBufferView> view = v8::Local<v8::ArrayBufferView>::Cast(
+      env->Global()->Get(v8_str("a")));
+  v8::ArrayBufferView::Contents contents = view->PinContents();
+  CHECK_EQ(4u, contents.ByteLength());
+  unsigned char* data = static_cast<unsigned char*>(contents.Data());
+  for (size_t i = 0; i < contents.ByteLength(); ++i) {
+    CHECK_EQ(i, data[i]);
+  }
+  view->UnpinContents();
+}
+
+
 TEST(AllocateNotExternal) {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
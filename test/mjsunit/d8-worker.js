@@ -0,0 +1,43 @@
+// Copyright 2015 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Test the Worker API of d8.  This test is skipped if d8 was built against
+// the shared library, which does not include Worker support.
+
+if (this.Worker) {
+  var workerScript =
+    "onmessage = function(m) {" +
+    "  if (m instanceof ArrayBuffer) {" +
+    "    var view = new Int32Array(m);" +
+    "    view[0] += 1;" +
+    "    postMessage(m, [m]);" +
+    "  } else {" +
+    "    postMessage({echo: m, string: 'hi'});" +
+    "  }" +
+    "};";
+
+  var worker = new Worker(workerScript);
+
+  // Structured data is copied.
+  worker.postMessage({x: 1, y: [2, 3], z: "four"});
+  var reply = worker.getMessage();
+  assertEquals(1, reply.echo.x);
+  assertEquals([2, 3], reply.echo.y);
+  assertEquals("four", reply.echo.z);
+  assertEquals("hi", reply.string);
+
+  // A transferred ArrayBuffer moves its backing store and neuters the
+  // source buffer.
+  var buffer = new ArrayBuffer(16);
+  var view = new Int32Array(buffer);
+  view[0] = 41;
+  worker.postMessage(buffer, [buffer]);
+  assertEquals(0, buffer.byteLength);  // Neutered.
+  var returned = worker.getMessage();
+  assertTrue(returned instanceof ArrayBuffer);
+  assertEquals(16, returned.byteLength);
+  assertEquals(42, new Int32Array(returned)[0]);
+
+  worker.terminate();
+}
@@ -70,6 +70,48 @@ Type* const kNumberTypes[] = {
 }  // namespace
 
 
+// -----------------------------------------------------------------------------
+// Math.abs
+
+
+TEST_F(JSBuiltinReducerTest, MathAbs) {
+  Node* function = MathFunction("abs");
+
+  TRACED_FOREACH(LanguageMode, language_mode, kLanguageModes) {
+    TRACED_FOREACH(Type*, t0, kNumberTypes) {
+      Node* p0 = Parameter(t0, 0);
+      Node* call = graph()->NewNode(
+          javascript()->CallFunction(3, NO_CALL_FUNCTION_FLAGS, language_mode),
+          function, UndefinedConstant(), p0);
+      Reduction r = Reduce(call);
+
+      ASSERT_TRUE(r.Changed());
+      EXPECT_THAT(r.replacement(), IsFloat64Abs(p0));
+    }
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Math.clz32
+
+
+TEST_F(JSBuiltinReducerTest, MathClz32) {
+  Node* function = MathFunction("clz32");
+
+  TRACED_FOREACH(LanguageMode, language_mode, kLanguageModes) {
+    Node* p0 = Parameter(Type::Unsigned32(), 0);
+    Node* call = graph()->NewNode(
+        javascript()->CallFunction(3, NO_CALL_FUNCTION_FLAGS, language_mode),
+        function, UndefinedConstant(), p0);
+    Reduction r = Reduce(call);
+
+    ASSERT_TRUE(r.Changed());
+    EXPECT_THAT(r.replacement(), IsWord32Clz(p0));
+  }
+}
+
+
 // -----------------------------------------------------------------------------
 // Math.max
 
@@ -177,6 +219,28 @@ TEST_F(JSBuiltinReducerTest, MathFround) {
   }
 }
 
+
+// -----------------------------------------------------------------------------
+// Math.sqrt
+
+
+TEST_F(JSBuiltinReducerTest, MathSqrt) {
+  Node* function = MathFunction("sqrt");
+
+  TRACED_FOREACH(LanguageMode, language_mode, kLanguageModes) {
+    TRACED_FOREACH(Type*, t0, kNumberTypes) {
+      Node* p0 = Parameter(t0, 0);
+      Node* call = graph()->NewNode(
+          javascript()->CallFunction(3, NO_CALL_FUNCTION_FLAGS, language_mode),
+          function, UndefinedConstant(), p0);
+      Reduction r = Reduce(call);
+
+      ASSERT_TRUE(r.Changed());
+      EXPECT_THAT(r.replacement(), IsFloat64Sqrt(p0));
+    }
+  }
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "src/compiler/access-builder.h"
+#include "src/compiler/graph-reducer.h"
 #include "src/compiler/load-elimination.h"
 #include "src/compiler/simplified-operator.h"
 #include "test/unittests/compiler/graph-unittest.h"
@@ -14,19 +15,26 @@ namespace compiler {
 
 class LoadEliminationTest : public GraphTest {
  public:
-  LoadEliminationTest() : GraphTest(3), simplified_(zone()) {}
+  LoadEliminationTest()
+      : GraphTest(3),
+        simplified_(zone()),
+        graph_reducer_(graph(), zone()),
+        load_elimination_(&graph_reducer_, zone()) {
+    // Seed the state at the start node; the reducer is flow sensitive and
+    // computes states along the effect chain.
+    load_elimination_.Reduce(graph()->start());
+  }
   ~LoadEliminationTest() override {}
 
  protected:
-  Reduction Reduce(Node* node) {
-    LoadElimination reducer;
-    return reducer.Reduce(node);
-  }
+  Reduction Reduce(Node* node) { return load_elimination_.Reduce(node); }
 
   SimplifiedOperatorBuilder* simplified() { return &simplified_; }
 
  private:
   SimplifiedOperatorBuilder simplified_;
+  GraphReducer graph_reducer_;
+  LoadElimination load_elimination_;
 };
 
 
@@ -40,6 +48,7 @@ TEST_F(LoadEliminationTest, LoadFieldWithStoreField) {
   FieldAccess access1 = AccessBuilder::ForContextSlot(42);
   Node* store1 = graph()->NewNode(simplified()->StoreField(access1), object1,
                                   value, effect, control);
+  Reduce(store1);
   Reduction r1 = Reduce(graph()->NewNode(simplified()->LoadField(access1),
                                          object1, store1, control));
   ASSERT_TRUE(r1.Changed());
@@ -48,6 +57,7 @@ TEST_F(LoadEliminationTest, LoadFieldWithStoreField) {
   FieldAccess access2 = AccessBuilder::ForMap();
   Node* store2 = graph()->NewNode(simplified()->StoreField(access2), object1,
                                   object2, store1, control);
+  Reduce(store2);
   Reduction r2 = Reduce(graph()->NewNode(simplified()->LoadField(access2),
                                          object1, store2, control));
   ASSERT_TRUE(r2.Changed());
@@ -56,17 +66,50 @@ TEST_F(LoadEliminationTest, LoadFieldWithStoreField) {
   Node* store3 = graph()->NewNode(
       simplified()->StoreBuffer(BufferAccess(kExternalInt8Array)), object2,
       value, Int32Constant(10), object1, store2, control);
+  Reduce(store3);
 
-  Reduction r3 = Reduce(graph()->NewNode(simplified()->LoadField(access1),
-                                         object2, store3, control));
-  ASSERT_FALSE(r3.Changed());
+  // The field of {object2} is unknown; the load only records its state.
+  Node* load3 = graph()->NewNode(simplified()->LoadField(access1), object2,
+                                 store3, control);
+  Reduction r3 = Reduce(load3);
+  ASSERT_TRUE(r3.Changed());
+  EXPECT_EQ(load3, r3.replacement());
 
+  // Buffer stores do not interfere with the known field states.
   Reduction r4 = Reduce(graph()->NewNode(simplified()->LoadField(access1),
                                          object1, store3, control));
   ASSERT_TRUE(r4.Changed());
   EXPECT_EQ(value, r4.replacement());
 }
 
+
+TEST_F(LoadEliminationTest, LoadFieldAcrossEffectMerge) {
+  Node* object = Parameter(0);
+  Node* value = Parameter(1);
+  Node* check = Parameter(2);
+  Node* effect = graph()->start();
+  Node* control = graph()->start();
+
+  FieldAccess access = AccessBuilder::ForContextSlot(23);
+  Node* store = graph()->NewNode(simplified()->StoreField(access), object,
+                                 value, effect, control);
+  Reduce(store);
+
+  Node* branch = graph()->NewNode(common()->Branch(), check, control);
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* merge = graph()->NewNode(common()->Merge(2), if_true, if_false);
+  Node* effect_phi =
+      graph()->NewNode(common()->EffectPhi(2), store, store, merge);
+  Reduce(effect_phi);
+
+  // The field state survives the merge, since it holds on both paths.
+  Reduction r = Reduce(graph()->NewNode(simplified()->LoadField(access),
+                                        object, effect_phi, merge));
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(value, r.replacement());
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "src/compiler/machine-operator.h"
 #include "src/compiler/select-lowering.h"
 #include "test/unittests/compiler/graph-unittest.h"
 #include "test/unittests/compiler/node-test-utils.h"
@@ -18,12 +19,16 @@ namespace compiler {
 
 class SelectLoweringTest : public GraphTest {
  public:
-  SelectLoweringTest() : GraphTest(5), lowering_(graph(), common()) {}
+  SelectLoweringTest()
+      : GraphTest(5),
+        machine_(zone()),
+        lowering_(graph(), common(), &machine_) {}
 
  protected:
   Reduction Reduce(Node* node) { return lowering_.Reduce(node); }
 
  private:
+  MachineOperatorBuilder machine_;
   SelectLowering lowering_;
 };
 
@@ -67,6 +72,49 @@ TEST_F(SelectLoweringTest, SelectWithSameConditions) {
   }
 }
 
+class SelectLoweringConditionalMoveTest : public GraphTest {
+ public:
+  SelectLoweringConditionalMoveTest()
+      : GraphTest(5),
+        machine_(zone(), kMachPtr,
+                 MachineOperatorBuilder::kWord32Select |
+                     MachineOperatorBuilder::kWord64Select),
+        lowering_(graph(), common(), &machine_) {}
+
+ protected:
+  Reduction Reduce(Node* node) { return lowering_.Reduce(node); }
+
+  MachineOperatorBuilder* machine() { return &machine_; }
+
+ private:
+  MachineOperatorBuilder machine_;
+  SelectLowering lowering_;
+};
+
+
+TEST_F(SelectLoweringConditionalMoveTest, SelectWithCheapInputs) {
+  Node* const p0 = Parameter(0);
+  Node* const p1 = Parameter(1);
+  Node* const p2 = Parameter(2);
+  Reduction const r =
+      Reduce(graph()->NewNode(common()->Select(kMachInt32), p0, p1, p2));
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(machine()->Word32Select(), r.replacement()->op());
+}
+
+
+TEST_F(SelectLoweringConditionalMoveTest, SelectWithBranchHint) {
+  Node* const p0 = Parameter(0);
+  Node* const p1 = Parameter(1);
+  Node* const p2 = Parameter(2);
+  // A hinted branch is assumed to predict well, so no conditional move is
+  // used even though the target supports one.
+  Reduction const r = Reduce(graph()->NewNode(
+      common()->Select(kMachInt32, BranchHint::kTrue), p0, p1, p2));
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(IrOpcode::kPhi, r.replacement()->opcode());
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -144,6 +144,37 @@ TEST_F(StateValuesIteratorTest, BuildTreeIdentical) {
   }
 }
 
+
+TEST_F(StateValuesIteratorTest, FrameStateInterning) {
+  JSOperatorBuilder javascript(zone());
+  MachineOperatorBuilder machine(zone());
+  JSGraph jsgraph(isolate(), graph(), common(), &javascript, &machine);
+
+  StateValuesCache builder(&jsgraph);
+  Node* empty = builder.GetNodeForValues(nullptr, 0);
+  Node* undefined = jsgraph.UndefinedConstant();
+  Node* inputs[] = {empty, empty, empty, undefined, undefined, undefined};
+
+  // Requesting the same frame state twice yields the same node, even though
+  // the FrameState operators are distinct objects.
+  Node* node1 = builder.GetFrameStateNode(
+      common()->FrameState(JS_FRAME, BailoutId(1),
+                           OutputFrameStateCombine::Ignore()),
+      inputs, arraysize(inputs));
+  Node* node2 = builder.GetFrameStateNode(
+      common()->FrameState(JS_FRAME, BailoutId(1),
+                           OutputFrameStateCombine::Ignore()),
+      inputs, arraysize(inputs));
+  EXPECT_EQ(node1, node2);
+
+  // A different bailout id yields a distinct node.
+  Node* node3 = builder.GetFrameStateNode(
+      common()->FrameState(JS_FRAME, BailoutId(2),
+                           OutputFrameStateCombine::Ignore()),
+      inputs, arraysize(inputs));
+  EXPECT_NE(node1, node3);
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -19,6 +19,13 @@ struct MockTask : public Task {
   MOCK_METHOD0(Die, void());
 };
 
+
+struct MockIdleTask : public IdleTask {
+  virtual ~MockIdleTask() { Die(); }
+  MOCK_METHOD1(Run, void(double deadline_in_seconds));
+  MOCK_METHOD0(Die, void());
+};
+
 }  // namespace
 
 
@@ -39,5 +46,22 @@ TEST(DefaultPlatformTest, PumpMessageLoop) {
   EXPECT_FALSE(platform.PumpMessageLoop(isolate));
 }
 
+
+TEST(DefaultPlatformTest, RunIdleTasks) {
+  InSequence s;
+
+  int dummy;
+  Isolate* isolate = reinterpret_cast<Isolate*>(&dummy);
+
+  DefaultPlatform platform;
+  EXPECT_TRUE(platform.IdleTasksEnabled(isolate));
+
+  StrictMock<MockIdleTask>* task = new StrictMock<MockIdleTask>;
+  platform.CallIdleOnForegroundThread(isolate, task);
+  EXPECT_CALL(*task, Run(testing::Gt(0.0)));
+  EXPECT_CALL(*task, Die());
+  platform.RunIdleTasks(isolate, 42.0);
+}
+
 }  // namespace platform
 }  // namespace v8
@@ -38,13 +38,26 @@ class TaskQueueThread final : public base::Thread {
 TEST(TaskQueueTest, Basic) {
   TaskQueue queue;
   MockTask task;
-  queue.Append(&task);
+  queue.Append(&task, TaskQueue::kHighPriority);
   EXPECT_EQ(&task, queue.GetNext());
   queue.Terminate();
   EXPECT_THAT(queue.GetNext(), IsNull());
 }
 
 
+TEST(TaskQueueTest, PriorityOrder) {
+  TaskQueue queue;
+  MockTask batch_task;
+  MockTask latency_task;
+  queue.Append(&batch_task, TaskQueue::kLowPriority);
+  queue.Append(&latency_task, TaskQueue::kHighPriority);
+  EXPECT_EQ(&latency_task, queue.GetNext());
+  EXPECT_EQ(&batch_task, queue.GetNext());
+  queue.Terminate();
+  EXPECT_THAT(queue.GetNext(), IsNull());
+}
+
+
 TEST(TaskQueueTest, TerminateMultipleReaders) {
   TaskQueue queue;
   TaskQueueThread thread1(&queue);
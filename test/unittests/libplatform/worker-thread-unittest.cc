@@ -34,7 +34,7 @@ TEST(WorkerThreadTest, Basic) {
     StrictMock<MockTask>* task = new StrictMock<MockTask>;
     EXPECT_CALL(*task, Run());
     EXPECT_CALL(*task, Die());
-    queue.Append(task);
+    queue.Append(task, TaskQueue::kHighPriority);
   }
 
   WorkerThread thread1(&queue);
@@ -432,6 +432,8 @@
         '../../src/compiler/access-builder.cc',
         '../../src/compiler/access-builder.h',
         '../../src/compiler/all-nodes.cc',
+        '../../src/compiler/allocation-folding.cc',
+        '../../src/compiler/allocation-folding.h',
         '../../src/compiler/all-nodes.h',
         '../../src/compiler/ast-graph-builder.cc',
         '../../src/compiler/ast-graph-builder.h',
@@ -459,6 +461,8 @@
         '../../src/compiler/control-reducer.cc',
         '../../src/compiler/control-reducer.h',
         '../../src/compiler/diamond.h',
+        '../../src/compiler/escape-analysis.cc',
+        '../../src/compiler/escape-analysis.h',
         '../../src/compiler/frame.h',
         '../../src/compiler/frame-elider.cc',
         '../../src/compiler/frame-elider.h',
@@ -476,6 +480,8 @@
         '../../src/compiler/graph.cc',
         '../../src/compiler/graph.h',
         '../../src/compiler/instruction-codes.h',
+        '../../src/compiler/instruction-scheduler.cc',
+        '../../src/compiler/instruction-scheduler.h',
         '../../src/compiler/instruction-selector-impl.h',
         '../../src/compiler/instruction-selector.cc',
         '../../src/compiler/instruction-selector.h',
@@ -512,6 +518,10 @@
         '../../src/compiler/loop-analysis.h',
         '../../src/compiler/loop-peeling.cc',
         '../../src/compiler/loop-peeling.h',
+        '../../src/compiler/loop-unrolling.cc',
+        '../../src/compiler/loop-unrolling.h',
+        '../../src/compiler/loop-vectorizer.cc',
+        '../../src/compiler/loop-vectorizer.h',
         '../../src/compiler/machine-operator-reducer.cc',
         '../../src/compiler/machine-operator-reducer.h',
         '../../src/compiler/machine-operator.cc',
@@ -671,9 +681,12 @@
         '../../src/heap/mark-compact-inl.h',
         '../../src/heap/mark-compact.cc',
         '../../src/heap/mark-compact.h',
+        '../../src/heap/memory-reducer.cc',
+        '../../src/heap/memory-reducer.h',
         '../../src/heap/objects-visiting-inl.h',
         '../../src/heap/objects-visiting.cc',
         '../../src/heap/objects-visiting.h',
+        '../../src/heap/slot-set.h',
         '../../src/heap/spaces-inl.h',
         '../../src/heap/spaces.cc',
         '../../src/heap/spaces.h',
@@ -756,6 +769,7 @@
         '../../src/isolate.cc',
         '../../src/isolate.h',
         '../../src/json-parser.h',
+        '../../src/json-stringifier.cc',
         '../../src/json-stringifier.h',
         '../../src/jsregexp-inl.h',
         '../../src/jsregexp.cc',
@@ -896,6 +910,7 @@
         '../../src/ic/stub-cache.h',
         '../../src/token.cc',
         '../../src/token.h',
+        '../../src/tracing/trace-event.h',
         '../../src/transitions-inl.h',
         '../../src/transitions.cc',
         '../../src/transitions.h',
@@ -976,6 +991,7 @@
             '../../src/arm/simulator-arm.cc',
             '../../src/compiler/arm/code-generator-arm.cc',
             '../../src/compiler/arm/instruction-codes-arm.h',
+            '../../src/compiler/arm/instruction-scheduler-arm.cc',
             '../../src/compiler/arm/instruction-selector-arm.cc',
             '../../src/compiler/arm/linkage-arm.cc',
             '../../src/ic/arm/access-compiler-arm.cc',
@@ -1033,6 +1049,7 @@
             '../../src/arm64/utils-arm64.h',
             '../../src/compiler/arm64/code-generator-arm64.cc',
             '../../src/compiler/arm64/instruction-codes-arm64.h',
+            '../../src/compiler/arm64/instruction-scheduler-arm64.cc',
             '../../src/compiler/arm64/instruction-selector-arm64.cc',
             '../../src/compiler/arm64/linkage-arm64.cc',
             '../../src/ic/arm64/access-compiler-arm64.cc',
@@ -1239,6 +1256,7 @@
           'sources': [
             '../../src/compiler/x64/code-generator-x64.cc',
             '../../src/compiler/x64/instruction-codes-x64.h',
+            '../../src/compiler/x64/instruction-scheduler-x64.cc',
             '../../src/compiler/x64/instruction-selector-x64.cc',
             '../../src/compiler/x64/linkage-x64.cc',
           ],